@@ -6,6 +6,9 @@
 
 namespace CW
 {
+  // true when the envelope has finished (key up)
+  volatile static bool keyup = true;
+
   static const uint16_t __not_in_flash("fast_access_sram") gaussian_tab[312] =
   {
     32767,
@@ -1376,6 +1379,7 @@ namespace CW
         // if keydown then transition to key down
         if (keydown)
         {
+          keyup = false;
           gaussian_phase = 311;
           cw_state = CW_STATE_KEY_TRANSITION_TO_DOWN;
         }
@@ -1413,6 +1417,7 @@ namespace CW
         gaussian_phase++;
         if (gaussian_phase>=312)
         {
+          keyup = true;
           cw_state = CW_STATE_KEYUP;
         }
         break;
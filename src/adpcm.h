@@ -0,0 +1,218 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// IMA ADPCM voice prompt decoder
+//
+// Prompts are 4 bit IMA ADPCM at 7812.5Hz in blocks of 256 samples,
+// each block starting with a 4 byte header (predictor, step index) so
+// a clip can be started at any block. Speech doesn't need more than
+// 3kHz so storing at a quarter of the audio rate saves 4x the flash
+// (and XIP reads).
+//
+// Output is interpolated up to 31250Hz with a 48 tap polyphase low
+// pass, so every output sample costs 12 MACs plus one nibble decode
+// every 4th sample. The clips are made by tools/adpcm.py which has a
+// bit exact copy of this decoder and interpolator.
+//
+// Core 0 never reads the clip from flash itself. Each block is copied
+// by DMA into one half of an SRAM double buffer a whole block (33ms)
+// before it is needed, through the uncached XIP alias so prompt data
+// doesn't evict DSP code or data from the XIP cache. Only the first
+// block of a clip has to be waited for (a few us). There is one
+// buffer so only one decoder can be playing.
+
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include "hardware/dma.h"
+
+#define ADPCM_BLOCK_SAMPLES 256u
+#define ADPCM_BLOCK_BYTES   (4u+ADPCM_BLOCK_SAMPLES/2u)
+#define ADPCM_MAX_INDEX     88
+#define ADPCM_UPSAMPLE      4u
+#define ADPCM_TAPS          12u
+
+namespace ADPCM
+{
+  struct clip_t
+  {
+    const uint8_t *data;
+    uint32_t samples;
+  };
+
+  struct decoder_t
+  {
+    const uint8_t *source;
+    const uint8_t *p;
+    uint32_t remaining;
+    uint32_t n;
+    int32_t predictor;
+    int32_t index;
+    int16_t history[ADPCM_TAPS];
+    uint32_t phase;
+    uint32_t buffer;
+  };
+
+  // SRAM double buffer, filled by DMA
+  static uint8_t __attribute__((aligned(4))) buffer[2][ADPCM_BLOCK_BYTES];
+  static int dma_channel = -1;
+  static dma_channel_config dma_config;
+
+  static const int8_t __not_in_flash("adpcm") index_table[16] =
+  {
+    -1,-1,-1,-1,2,4,6,8,
+    -1,-1,-1,-1,2,4,6,8
+  };
+
+  static const int16_t __not_in_flash("adpcm") step_table[ADPCM_MAX_INDEX+1] =
+  {
+    7,8,9,10,11,12,13,14,16,17,
+    19,21,23,25,28,31,34,37,41,45,
+    50,55,60,66,73,80,88,97,107,118,
+    130,143,157,173,190,209,230,253,279,307,
+    337,371,408,449,494,544,598,658,724,796,
+    876,963,1060,1166,1282,1411,1552,1707,1878,2066,
+    2272,2499,2749,3024,3327,3660,4026,4428,4871,5358,
+    5894,6484,7132,7845,8630,9493,10442,11487,12635,13899,
+    15289,16818,18500,20350,22385,24623,27086,29794,32767
+  };
+
+  // 48 tap low pass, 3300Hz at 31250Hz (-6dB), images below -33dB
+  // [phase][tap], Q15
+  static const int16_t __not_in_flash("adpcm") interpolator[ADPCM_UPSAMPLE][ADPCM_TAPS] =
+  {
+    {0,22,-279,1263,-3520,7960,27134,1239,-1705,881,-252,27},
+    {2,-30,-101,1073,-4315,15881,22957,-2947,44,324,-136,13},
+    {13,-136,324,44,-2947,22957,15881,-4315,1073,-101,-30,2},
+    {27,-252,881,-1705,1239,27134,7960,-3520,1263,-279,22,0}
+  };
+
+  static void init(void)
+  {
+    // block copy, word at a time, as fast as the bus allows
+    dma_channel = dma_claim_unused_channel(true);
+    dma_config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&dma_config,DMA_SIZE_32);
+    channel_config_set_read_increment(&dma_config,true);
+    channel_config_set_write_increment(&dma_config,true);
+    channel_config_set_dreq(&dma_config,DREQ_FORCE);
+  }
+
+  static void __not_in_flash_func(fetch)(decoder_t &d,const uint32_t to)
+  {
+    // start copying the next block from flash
+    const uint8_t *uncached = (const uint8_t *)((uintptr_t)d.source - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE);
+    dma_channel_configure(dma_channel,&dma_config,buffer[to],uncached,ADPCM_BLOCK_BYTES/4u,true);
+    d.source += ADPCM_BLOCK_BYTES;
+  }
+
+  static void __not_in_flash_func(start)(decoder_t &d,const clip_t &clip)
+  {
+    // any fetch for the last clip finishes in a few us
+    dma_channel_wait_for_finish_blocking(dma_channel);
+    d.source = clip.data;
+    d.p = buffer[0];
+    d.remaining = clip.samples;
+    d.n = 0;
+    d.predictor = 0;
+    d.index = 0;
+    memset(d.history,0,sizeof(d.history));
+    d.phase = 0;
+    d.buffer = 0;
+    if (d.remaining>0)
+    {
+      fetch(d,0);
+    }
+  }
+
+  static const bool __not_in_flash_func(next)(decoder_t &d,int16_t &sample)
+  {
+    // next 7812.5Hz sample, false at the end of the clip
+    if (d.remaining==0)
+    {
+      return false;
+    }
+    d.remaining--;
+    if (d.n==0)
+    {
+      // this block was fetched during the last one
+      dma_channel_wait_for_finish_blocking(dma_channel);
+      d.p = buffer[d.buffer];
+      if (d.remaining>=ADPCM_BLOCK_SAMPLES)
+      {
+        // more to come, fetch the next block
+        d.buffer ^= 1u;
+        fetch(d,d.buffer);
+      }
+      // block header
+      d.predictor = (int16_t)(d.p[0] | (d.p[1] << 8));
+      d.index = min((int32_t)d.p[2],(int32_t)ADPCM_MAX_INDEX);
+      d.p += 4;
+    }
+    uint32_t nibble = 0;
+    if (d.n & 1u)
+    {
+      nibble = *d.p++ >> 4;
+    }
+    else
+    {
+      nibble = *d.p & 0x0fu;
+    }
+    d.n = (d.n + 1u) & (ADPCM_BLOCK_SAMPLES - 1u);
+    const int32_t step = step_table[d.index];
+    int32_t delta = step >> 3;
+    if (nibble & 4u) delta += step;
+    if (nibble & 2u) delta += step >> 1;
+    if (nibble & 1u) delta += step >> 2;
+    if (nibble & 8u) delta = -delta;
+    d.predictor = constrain(d.predictor + delta,-32768l,32767l);
+    d.index = constrain(d.index + index_table[nibble],0l,(int32_t)ADPCM_MAX_INDEX);
+    sample = (int16_t)d.predictor;
+    return true;
+  }
+
+  static const bool __not_in_flash_func(decode)(decoder_t &d,int16_t &sample)
+  {
+    // next 31250Hz sample, false at the end of the clip
+    if (d.phase==0)
+    {
+      int16_t s = 0;
+      if (!next(d,s))
+      {
+        return false;
+      }
+      for (uint32_t k=ADPCM_TAPS-1u;k>0;k--)
+      {
+        d.history[k] = d.history[k-1u];
+      }
+      d.history[0] = s;
+    }
+    const int16_t *h = interpolator[d.phase];
+    int32_t acc = 0;
+    for (uint32_t k=0;k<ADPCM_TAPS;k++)
+    {
+      acc += (int32_t)h[k] * d.history[k];
+    }
+    d.phase = (d.phase + 1u) & (ADPCM_UPSAMPLE - 1u);
+    sample = (int16_t)constrain(acc >> 15,-32768l,32767l);
+    return true;
+  }
+}
+
+#endif
@@ -22,6 +22,8 @@
 #ifndef ANNOUNCE_H
 #define ANNOUNCE_H
 
+#include "prompt.h"
+
 #define ANNOUNCE_MODE_LSB 0
 #define ANNOUNCE_MODE_USB 1
 #define ANNOUNCE_MODE_CWL 2
@@ -29,112 +31,25 @@
 
 namespace ANNOUNCE
 {
-  #include "audiodata.h"
-
-  static const uint32_t lsb_data_size = sizeof(LSB_data);
-  static const uint32_t usb_data_size = sizeof(USB_data);
-  static const uint32_t cwl_data_size = sizeof(CWL_data);
-  static const uint32_t cwu_data_size = sizeof(CWU_data);
-  static const uint32_t step10_data_size = sizeof(Step10_data);
-  static const uint32_t step100_data_size = sizeof(Step100_data);
-  static const uint32_t step1000_data_size = sizeof(Step1000_data);
-
-  volatile static const uint8_t *data = NULL;
-  volatile static uint32_t data_size = 0;
-  volatile static uint32_t p_sample = 0;
-  volatile static bool active = false;
-
-  static void __not_in_flash_func(setMode)(const uint32_t the_mode)
+  static void setMode(const uint32_t the_mode)
   {
-    if (active)
-    {
-      return;
-    }
     switch (the_mode)
     {
-      case ANNOUNCE_MODE_LSB:
-      {
-        data = LSB_data;
-        data_size = lsb_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
-      case ANNOUNCE_MODE_USB:
-      {
-        data = USB_data;
-        data_size = usb_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
-      case ANNOUNCE_MODE_CWL:
-      {
-        data = CWL_data;
-        data_size = cwl_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
-      case ANNOUNCE_MODE_CWU:
-      {
-        data = CWU_data;
-        data_size = cwu_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
+      case ANNOUNCE_MODE_LSB: PROMPT::speak(PROMPT::CLIP_LSB,PROMPT_PRIORITY_HIGH); break;
+      case ANNOUNCE_MODE_USB: PROMPT::speak(PROMPT::CLIP_USB,PROMPT_PRIORITY_HIGH); break;
+      case ANNOUNCE_MODE_CWL: PROMPT::speak(PROMPT::CLIP_CWL,PROMPT_PRIORITY_HIGH); break;
+      case ANNOUNCE_MODE_CWU: PROMPT::speak(PROMPT::CLIP_CWU,PROMPT_PRIORITY_HIGH); break;
     }
   }
 
-  static void __not_in_flash_func(setStep)(const uint32_t step)
+  static void setStep(const uint32_t step)
   {
-    if (active)
-    {
-      return;
-    }
     switch (step)
     {
-      case 10:
-      {
-        data = Step10_data;
-        data_size = step10_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
-      case 100:
-      {
-        data = Step100_data;
-        data_size = step100_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
-      case 1000:
-      {
-        data = Step1000_data;
-        data_size = step1000_data_size;
-        p_sample = 16 * 3;
-        active = true;
-        break;
-      }
-    }
-  }
-
-  static const int16_t __not_in_flash_func(announce)(void)
-  {
-    if (!active)
-    {
-      return 0;
-    }
-    if (p_sample>=data_size)
-    {
-      active = false;
-      return 0;
+      case 10:   PROMPT::speak(PROMPT::CLIP_STEP10,PROMPT_PRIORITY_HIGH);   break;
+      case 100:  PROMPT::speak(PROMPT::CLIP_STEP100,PROMPT_PRIORITY_HIGH);  break;
+      case 1000: PROMPT::speak(PROMPT::CLIP_STEP1000,PROMPT_PRIORITY_HIGH); break;
     }
-    const int16_t sample = (int16_t)data[p_sample++] - 128;
-    return sample<<4;
   }
 }
 
@@ -0,0 +1,322 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// CAT control, Kenwood TS-480 subset
+//
+// UART0 on GP0 (TX) and GP1 (RX). Received bytes are written by DMA
+// into a 256 byte ring that never stops, process() (a core 1 task)
+// picks up whatever has arrived since last time and feeds it to the
+// parser one byte at a time. Commands end with ';' and are held in a
+// fixed buffer, nothing is allocated. Replies are built in one half of
+// a double buffer and sent by DMA from the other.
+//
+//   FA;  FAnnnnnnnnnnn;  VFO A frequency in Hz
+//   IF;                  status (frequency, TX, mode)
+//   MD;  MDn;            mode 1 LSB, 2 USB, 3 CW (USB side), 7 CW-R
+//   TX;  RX;             PTT (SSB only)
+//   SM0;                 S meter 0000-0030
+//   ID;  AI;  AIn;  PS;  what hamlib and logging programs ask first
+//
+// Set commands aren't answered. Anything unknown, too long, or a value
+// the radio can't take is answered "?;".
+// The radio side is a set of callbacks so this knows nothing of it.
+
+#ifndef CAT_H
+#define CAT_H
+
+#include "hardware/uart.h"
+#include "hardware/dma.h"
+
+#define CAT_RX_BITS      8u
+#define CAT_RX_SIZE      (1u<<CAT_RX_BITS)
+#define CAT_TX_SIZE      128u
+#define CAT_MAX_COMMAND  24u
+#define CAT_FREQ_DIGITS  11u
+#define CAT_SMETER_MAX   30u
+#define CAT_ID           20u  // TS-480
+
+namespace CAT
+{
+  struct radio_t
+  {
+    uint32_t (*get_frequency)(void);
+    bool (*set_frequency)(const uint32_t frequency);
+    uint8_t (*get_mode)(void);            // Kenwood mode number
+    bool (*set_mode)(const uint8_t mode);
+    bool (*get_tx)(void);
+    bool (*set_tx)(const bool tx);
+    uint32_t (*get_smeter)(void);         // 0 to CAT_SMETER_MAX
+  };
+
+  static const radio_t *radio = NULL;
+  static uart_inst_t *uart = uart0;
+  static uint8_t __attribute__((aligned(CAT_RX_SIZE))) rx_ring[CAT_RX_SIZE];
+  static uint32_t rx_read = 0;
+  static int rx_channel = -1;
+  static int tx_channel = -1;
+  static dma_channel_config tx_config;
+  static char tx_buffer[2][CAT_TX_SIZE];
+  static uint32_t tx_fill = 0;
+  static uint32_t tx_length = 0;
+  static char command[CAT_MAX_COMMAND];
+  static uint32_t command_length = 0;
+  static bool overflow = false;
+
+  static void put(const char c)
+  {
+    if (tx_length<CAT_TX_SIZE)
+    {
+      tx_buffer[tx_fill][tx_length++] = c;
+    }
+  }
+
+  static void put(const char *s)
+  {
+    while (*s)
+    {
+      put(*s++);
+    }
+  }
+
+  static void put_number(uint32_t value,const uint32_t digits)
+  {
+    // zero padded, most significant first, the frequency is the widest
+    char d[CAT_FREQ_DIGITS];
+    const uint32_t n = min(digits,CAT_FREQ_DIGITS);
+    for (uint32_t i=0;i<n;i++)
+    {
+      d[i] = (char)('0' + value % 10u);
+      value /= 10u;
+    }
+    for (uint32_t i=n;i>0;i--)
+    {
+      put(d[i-1u]);
+    }
+  }
+
+  static const bool get_number(const uint32_t from,uint32_t &value)
+  {
+    // the rest of the command as a decimal number, false if it
+    // isn't one or doesn't fit in 32 bits
+    if (from>=command_length)
+    {
+      return false;
+    }
+    value = 0;
+    for (uint32_t i=from;i<command_length;i++)
+    {
+      if (command[i]<'0' || command[i]>'9')
+      {
+        return false;
+      }
+      const uint32_t digit = (uint32_t)(command[i] - '0');
+      if (value>(UINT32_MAX - digit) / 10u)
+      {
+        return false;
+      }
+      value = value * 10u + digit;
+    }
+    return true;
+  }
+
+  static void send(void)
+  {
+    // start the reply if the last one has gone
+    if (tx_length==0 || dma_channel_is_busy(tx_channel))
+    {
+      return;
+    }
+    dma_channel_configure(tx_channel,&tx_config,&uart_get_hw(uart)->dr,tx_buffer[tx_fill],tx_length,true);
+    tx_fill ^= 1u;
+    tx_length = 0;
+  }
+
+  static void info(void)
+  {
+    // TS-480 IF, 38 characters
+    put("IF");
+    put_number(radio->get_frequency(),CAT_FREQ_DIGITS);
+    put("     +0000");    // step, RIT/XIT offset
+    put("00000");         // RIT, XIT, memory channel
+    put(radio->get_tx()?'1':'0');
+    put_number(radio->get_mode(),1);
+    put("0000000;");      // VFO, scan, split, tone
+  }
+
+  static void execute(void)
+  {
+    // one complete command, without the ';'
+    if (command_length<2)
+    {
+      put("?;");
+      return;
+    }
+    const char c0 = toupper(command[0]);
+    const char c1 = toupper(command[1]);
+    const bool query = command_length==2;
+    uint32_t value = 0;
+    if (c0=='F' && c1=='A')
+    {
+      if (!query && !(get_number(2,value) && radio->set_frequency(value)))
+      {
+        put("?;");
+        return;
+      }
+      if (query)
+      {
+        put("FA");
+        put_number(radio->get_frequency(),CAT_FREQ_DIGITS);
+        put(';');
+      }
+      return;
+    }
+    if (c0=='I' && c1=='F' && query)
+    {
+      info();
+      return;
+    }
+    if (c0=='M' && c1=='D')
+    {
+      if (!query && !(get_number(2,value) && value<10u && radio->set_mode((uint8_t)value)))
+      {
+        put("?;");
+        return;
+      }
+      if (query)
+      {
+        put("MD");
+        put_number(radio->get_mode(),1);
+        put(';');
+      }
+      return;
+    }
+    if ((c0=='T' || c0=='R') && c1=='X')
+    {
+      // TX may have a 0/1/2 source digit, it's all one mic here
+      if (!radio->set_tx(c0=='T'))
+      {
+        put("?;");
+      }
+      return;
+    }
+    if (c0=='S' && c1=='M')
+    {
+      put("SM0");
+      put_number(min(radio->get_smeter(),(uint32_t)CAT_SMETER_MAX),4);
+      put(';');
+      return;
+    }
+    if (c0=='I' && c1=='D' && query)
+    {
+      put("ID");
+      put_number(CAT_ID,3);
+      put(';');
+      return;
+    }
+    if (c0=='A' && c1=='I')
+    {
+      // auto information is accepted but never sent
+      if (query)
+      {
+        put("AI0;");
+      }
+      return;
+    }
+    if (c0=='P' && c1=='S')
+    {
+      if (query)
+      {
+        put("PS1;");
+      }
+      return;
+    }
+    put("?;");
+  }
+
+  static void parse(const char c)
+  {
+    // one byte at a time
+    if (c=='\r' || c=='\n')
+    {
+      return;
+    }
+    if (c==';')
+    {
+      if (overflow)
+      {
+        put("?;");
+      }
+      else
+      {
+        execute();
+      }
+      command_length = 0;
+      overflow = false;
+      return;
+    }
+    if (command_length<CAT_MAX_COMMAND)
+    {
+      command[command_length++] = c;
+    }
+    else
+    {
+      overflow = true;
+    }
+  }
+
+  static void init(const radio_t &r,const uint32_t baud,const uint32_t pin_tx,const uint32_t pin_rx)
+  {
+    // core 1, UART0 with DMA both ways
+    radio = &r;
+    uart_init(uart,baud);
+    gpio_set_function(pin_tx,GPIO_FUNC_UART);
+    gpio_set_function(pin_rx,GPIO_FUNC_UART);
+    // receive into the ring for ever
+    rx_channel = dma_claim_unused_channel(true);
+    dma_channel_config rx_config = dma_channel_get_default_config(rx_channel);
+    channel_config_set_transfer_data_size(&rx_config,DMA_SIZE_8);
+    channel_config_set_read_increment(&rx_config,false);
+    channel_config_set_write_increment(&rx_config,true);
+    channel_config_set_ring(&rx_config,true,CAT_RX_BITS);
+    channel_config_set_dreq(&rx_config,uart_get_dreq(uart,false));
+    dma_channel_configure(rx_channel,&rx_config,rx_ring,&uart_get_hw(uart)->dr,dma_encode_endless_transfer_count(),true);
+    rx_read = 0;
+    // replies
+    tx_channel = dma_claim_unused_channel(true);
+    tx_config = dma_channel_get_default_config(tx_channel);
+    channel_config_set_transfer_data_size(&tx_config,DMA_SIZE_8);
+    channel_config_set_read_increment(&tx_config,true);
+    channel_config_set_write_increment(&tx_config,false);
+    channel_config_set_dreq(&tx_config,uart_get_dreq(uart,true));
+  }
+
+  static void process(void)
+  {
+    // core 1 task, everything received since last time
+    const uint32_t rx_write = (dma_channel_hw_addr(rx_channel)->write_addr - (uintptr_t)rx_ring) & (CAT_RX_SIZE - 1u);
+    while (rx_read!=rx_write)
+    {
+      parse((char)rx_ring[rx_read]);
+      rx_read = (rx_read + 1u) & (CAT_RX_SIZE - 1u);
+    }
+    send();
+  }
+}
+
+#endif
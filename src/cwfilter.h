@@ -0,0 +1,218 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// CW filter bank
+//
+// The audio is decimated by 8 (31250 -> 3906.25), band pass filtered
+// and interpolated back up to 31250. All three stages do a fixed
+// amount of work on every input sample:
+//  decimator:    16 taps (polyphase, transposed)
+//  band pass:    32 taps (one slice of 256 per input sample)
+//  interpolator: 16 taps (polyphase)
+// so the narrowest filter costs the same as the widest and
+// much less than a 255 tap filter at the full rate.
+//
+// The band pass coefficients are designed at run time (window method)
+// into the inactive half of a double buffer and swapped in between
+// decimated samples, so changing bandwidth doesn't glitch.
+
+#ifndef CWFILTER_H
+#define CWFILTER_H
+
+#define CWF_DECIMATE    8u
+#define CWF_LPF_PHASE   16u
+#define CWF_LPF_LENGTH  (CWF_DECIMATE*CWF_LPF_PHASE)
+#define CWF_LPF_MASK    (CWF_LPF_PHASE-1u)
+#define CWF_BPF_LENGTH  256u
+#define CWF_BPF_TAPS    255u
+#define CWF_BPF_SLICE   (CWF_BPF_LENGTH/CWF_DECIMATE)
+#define CWF_LPF_CUTOFF  1900.0f
+#define CWF_RATE        31250.0f
+#define CWF_RATE_D      (CWF_RATE/(float)CWF_DECIMATE)
+
+namespace CWFILTER
+{
+  static const uint32_t bandwidths[] = {100ul,250ul,500ul,1000ul};
+  static const uint32_t num_bandwidths = sizeof(bandwidths)/sizeof(bandwidths[0]);
+
+  // polyphase anti-alias/anti-image filter, [phase][tap]
+  static float lpf[CWF_DECIMATE][CWF_LPF_PHASE] = { 0.0f };
+
+  // double buffered band pass coefficients
+  static float bpf[2][CWF_BPF_LENGTH] = { 0.0f };
+  volatile static uint32_t bpf_active = 0;
+  volatile static uint32_t bpf_in_use = 0;
+
+  static float blackman(const uint32_t n,const uint32_t length)
+  {
+    const float a = (2.0f * (float)M_PI * (float)n) / (float)(length - 1u);
+    return 0.42f - 0.5f * cosf(a) + 0.08f * cosf(2.0f * a);
+  }
+
+  static float sinc_lpf(const float t,const float fc,const float fs)
+  {
+    // ideal low pass impulse response, unity gain at DC
+    if (fabsf(t)<1.0e-6f)
+    {
+      return 2.0f * fc / fs;
+    }
+    return sinf(2.0f * (float)M_PI * fc * t / fs) / ((float)M_PI * t);
+  }
+
+  static void design_lpf(void)
+  {
+    // low pass for both the decimator and the interpolator
+    // 31250, 1900Hz, 128 taps blackman (~70dB)
+    float h[CWF_LPF_LENGTH];
+    float sum = 0.0f;
+    const float centre = (float)(CWF_LPF_LENGTH - 1u) / 2.0f;
+    for (uint32_t n=0;n<CWF_LPF_LENGTH;n++)
+    {
+      h[n] = sinc_lpf((float)n - centre,CWF_LPF_CUTOFF,CWF_RATE) * blackman(n,CWF_LPF_LENGTH);
+      sum += h[n];
+    }
+    for (uint32_t n=0;n<CWF_LPF_LENGTH;n++)
+    {
+      lpf[n%CWF_DECIMATE][n/CWF_DECIMATE] = h[n] / sum;
+    }
+  }
+
+  static void design_bank(const uint32_t bank,const uint32_t bandwidth,const uint32_t centre_frequency)
+  {
+    // band pass at the decimated rate, 255 taps blackman
+    // modulate a low pass of half the bandwidth up to the centre
+    // frequency then normalise for unity gain at the centre
+    float *h = bpf[bank];
+    const float fc = (float)bandwidth / 2.0f;
+    const float w0 = 2.0f * (float)M_PI * (float)centre_frequency / CWF_RATE_D;
+    const float centre = (float)(CWF_BPF_TAPS - 1u) / 2.0f;
+    float re = 0.0f;
+    float im = 0.0f;
+    for (uint32_t n=0;n<CWF_BPF_TAPS;n++)
+    {
+      const float t = (float)n - centre;
+      h[n] = 2.0f * sinc_lpf(t,fc,CWF_RATE_D) * blackman(n,CWF_BPF_TAPS) * cosf(w0 * t);
+      re += h[n] * cosf(w0 * (float)n);
+      im -= h[n] * sinf(w0 * (float)n);
+    }
+    h[CWF_BPF_TAPS] = 0.0f;
+    const float gain = sqrtf(re*re + im*im);
+    if (gain>0.0f)
+    {
+      for (uint32_t n=0;n<CWF_BPF_TAPS;n++)
+      {
+        h[n] /= gain;
+      }
+    }
+  }
+
+  static void init(const uint32_t bandwidth,const uint32_t centre_frequency)
+  {
+    // call before the DSP is running
+    design_lpf();
+    design_bank(0,bandwidth,centre_frequency);
+    design_bank(1,bandwidth,centre_frequency);
+    bpf_active = 0;
+    bpf_in_use = 0;
+  }
+
+  static void set_bandwidth(const uint32_t bandwidth,const uint32_t centre_frequency)
+  {
+    // design into the inactive bank then swap
+    const uint32_t bank = bpf_active ^ 1u;
+    while (bpf_in_use==bank)
+    {
+      // core 0 still reading this bank (at most one decimated sample)
+      tight_loop_contents();
+    }
+    design_bank(bank,bandwidth,centre_frequency);
+    bpf_active = bank;
+  }
+
+  static const float __not_in_flash_func(process)(const float sample)
+  {
+    // decimator state
+    static float acc[CWF_LPF_PHASE] = { 0.0f };
+    static uint8_t slot = 0;
+    // band pass state, decimated delay line
+    static float x[CWF_BPF_LENGTH] = { 0.0f };
+    static uint8_t sample_index = 0;
+    static const float *h = bpf[0];
+    static float bpf_acc = 0.0f;
+    static float bpf_out = 0.0f;
+    // interpolator state
+    static float y[CWF_LPF_PHASE] = { 0.0f };
+    static uint8_t y_index = 0;
+    static uint8_t phase = 0;
+
+    // transposed polyphase decimator, 16 MACs per input sample
+    const float *lp = lpf[(CWF_DECIMATE - phase) & (CWF_DECIMATE - 1u)];
+    for (uint32_t k=0;k<CWF_LPF_PHASE;k++)
+    {
+      acc[(slot + k) & CWF_LPF_MASK] += lp[k] * sample;
+    }
+
+    if (phase==0)
+    {
+      // new decimated sample
+      const float decimated = acc[slot & CWF_LPF_MASK];
+      acc[slot & CWF_LPF_MASK] = 0.0f;
+      slot++;
+
+      // previous band pass result into the interpolator
+      y[y_index++ & CWF_LPF_MASK] = bpf_out;
+
+      // start the next band pass, latching the coefficient bank
+      x[sample_index--] = decimated;
+      bpf_in_use = bpf_active;
+      h = bpf[bpf_in_use];
+      bpf_acc = 0.0f;
+    }
+
+    // one slice of the band pass per input sample
+    {
+      uint8_t i = sample_index + 1u + phase * CWF_BPF_SLICE;
+      const float *hs = h + phase * CWF_BPF_SLICE;
+      float s = 0.0f;
+      for (uint32_t k=0;k<CWF_BPF_SLICE;k++)
+      {
+        s += hs[k] * x[i++];
+      }
+      bpf_acc += s;
+      if (phase==(CWF_DECIMATE - 1u))
+      {
+        bpf_out = bpf_acc;
+      }
+    }
+
+    // polyphase interpolator, 16 MACs per output sample
+    const float *ip = lpf[phase];
+    float out = 0.0f;
+    uint8_t j = y_index - 1u;
+    for (uint32_t k=0;k<CWF_LPF_PHASE;k++)
+    {
+      out += ip[k] * y[j-- & CWF_LPF_MASK];
+    }
+
+    phase = (phase + 1u) & (CWF_DECIMATE - 1u);
+    return out * (float)CWF_DECIMATE;
+  }
+}
+
+#endif
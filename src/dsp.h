@@ -21,11 +21,18 @@
 #define DSP_H
 
 #include "filter.h"
+#include "cwfilter.h"
 
 namespace DSP
 {
+  // core 0 writes it, core 1 reads it for the S meter, signal
+  // reports and to put it back after transmitting
   volatile static float agc_peak = 0.0f;
 
+  // assume S9 = 86 in 14 bits (35mv PP)
+  static const float S0_sig = 30.0f;
+  static const float S9_sig = 120.0f;
+
   static void __not_in_flash_func(mute)(void)
   {
     // set AGC to high value so that audio is temporarily muted
@@ -74,11 +81,8 @@ namespace DSP
 
   static const uint32_t __not_in_flash_func(smeter)(void)
   {
-    // assume S9 = 86 in 14 bits (35mv PP)
     volatile static uint32_t s = 0;
     volatile static uint32_t agc_update = 0;
-    static const float S0_sig = 30.0f;
-    static const float S9_sig = 120.0f;
     static const uint32_t sig_min = (uint32_t)(log10f(S0_sig) * 1024.0f);
     static const uint32_t sig_max = (uint32_t)(log10f(S9_sig) * 1024.0f);
     static const uint32_t led_min = 0ul;
@@ -98,6 +102,25 @@ namespace DSP
     return s;
   }
 
+  static void signal_report(uint32_t &s_units,uint32_t &db_over)
+  {
+    // S0 to S9 on the same scale as the S meter, then dB over S9 in 10s
+    s_units = 0;
+    db_over = 0;
+    const float peak = agc_peak;
+    if (peak<=S0_sig)
+    {
+      return;
+    }
+    if (peak<S9_sig)
+    {
+      s_units = (uint32_t)(9.0f * log10f(peak / S0_sig) / log10f(S9_sig / S0_sig) + 0.5f);
+      return;
+    }
+    s_units = 9;
+    db_over = (uint32_t)(20.0f * log10f(peak / S9_sig)) / 10ul * 10ul;
+  }
+
   static const int16_t __not_in_flash_func(process_ssb)(const float in_i,const float in_q)
   {
     const float ii = FILTER::dc1(in_i);
@@ -129,8 +152,8 @@ namespace DSP
     // reject image
     const float ssb = p45 - n45;
 
-    // BPF for CW
-    const float audio = FILTER::bpf_700(ssb);
+    // BPF for CW (selectable bandwidth)
+    const float audio = CWFILTER::process(ssb);
 
     // AGC returns 12 bit value
     return agc(audio * 8192.0f);
@@ -0,0 +1,126 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Interrupt driven rotary encoder
+//
+// Both encoder pins interrupt on every edge and the Rotary half step
+// state table is stepped in the interrupt, so no step is lost however
+// long loop1() takes (I2C, prompts, keying in TX). Each step adds one
+// to a click count and the accelerated amount to a step count, loop1()
+// takes both with interrupts off.
+//
+// Acceleration follows the spin rate. The time between steps is
+// smoothed; at slow_us or slower a step is one step, at fast_us or
+// faster it's max_steps, in between it goes up with the rate. A change
+// of direction starts again at one.
+//
+// The interrupt goes to the core that calls init(), that has to be
+// core 1 so the DSP on core 0 is never held up.
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include "Rotary.h"
+
+namespace ENCODER
+{
+  struct acceleration_t
+  {
+    uint32_t slow_us;   // steps this far apart or more are one step
+    uint32_t fast_us;   // steps this close or closer are max_steps
+    uint32_t max_steps;
+  };
+
+  static Rotary *rotary = NULL;
+  static acceleration_t acceleration = {0,0,1};
+  volatile static int32_t clicks = 0;
+  volatile static int32_t steps = 0;
+  static uint32_t last_us = 0;
+  static uint32_t period_us = 0;
+  static uint8_t last_dir = DIR_NONE;
+
+  static const int32_t __not_in_flash_func(accelerate)(const uint32_t dt)
+  {
+    // smoothed time between steps to a multiplier
+    const uint32_t slow = acceleration.slow_us;
+    const uint32_t fast = acceleration.fast_us;
+    period_us = dt>=slow?slow:period_us - (period_us>>2) + (dt>>2);
+    if (period_us>=slow || acceleration.max_steps<=1u)
+    {
+      return 1;
+    }
+    if (period_us<=fast)
+    {
+      return acceleration.max_steps;
+    }
+    // rate from 1/slow to 1/fast maps to 1 to max_steps
+    const uint32_t extra = (uint32_t)(((uint64_t)(acceleration.max_steps - 1u) * fast * (slow - period_us)) / ((uint64_t)period_us * (slow - fast)));
+    return 1 + (int32_t)extra;
+  }
+
+  static void __not_in_flash_func(isr)(void)
+  {
+    // core 1, either pin changed
+    const uint8_t dir = rotary->process();
+    if (dir==DIR_NONE)
+    {
+      return;
+    }
+    const uint32_t now = time_us_32();
+    const uint32_t dt = dir==last_dir?now - last_us:acceleration.slow_us;
+    last_us = now;
+    last_dir = dir;
+    const int32_t n = accelerate(dt);
+    if (dir==DIR_CW)
+    {
+      clicks = clicks + 1;
+      steps = steps + n;
+    }
+    else
+    {
+      clicks = clicks - 1;
+      steps = steps - n;
+    }
+  }
+
+  static void init(Rotary &r,const uint32_t pin_a,const uint32_t pin_b,const acceleration_t &a)
+  {
+    // core 1, after r.begin()
+    rotary = &r;
+    acceleration = a;
+    acceleration.fast_us = min(a.fast_us,a.slow_us - 1ul);
+    period_us = acceleration.slow_us;
+    attachInterrupt(digitalPinToInterrupt(pin_a),isr,CHANGE);
+    attachInterrupt(digitalPinToInterrupt(pin_b),isr,CHANGE);
+  }
+
+  static const int32_t take(int32_t &accelerated)
+  {
+    // core 1, clicks and accelerated steps since the last take
+    const uint32_t save = save_and_disable_interrupts();
+    const int32_t n = clicks;
+    accelerated = steps;
+    clicks = 0;
+    steps = 0;
+    restore_interrupts(save);
+    return n;
+  }
+}
+
+#endif
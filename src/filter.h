@@ -464,276 +464,6 @@ namespace FILTER
     return acc;
   }
 
-  static const float __not_in_flash_func(bpf_700)(const float sample)
-  {
-    // 31250
-    // att: 60dB
-    // Lo: 600
-    // Hi: 800
-    // 255 taps
-    static float x[FIR_LENGTH] = { 0.0f };
-    static uint8_t sample_index = 0;
-    uint8_t i = sample_index;
-    x[sample_index--] = sample;
-    float acc = 0;
-    __mac_tap(0.000032f);
-    __mac_tap(0.000029f);
-    __mac_tap(0.000024f);
-    __mac_tap(0.000015f);
-    __mac_tap(0.000003f);
-    __mac_tap(-0.000013f);
-    __mac_tap(-0.000032f);
-    __mac_tap(-0.000056f);
-    __mac_tap(-0.000084f);
-    __mac_tap(-0.000116f);
-    __mac_tap(-0.00015f);
-    __mac_tap(-0.000187f);
-    __mac_tap(-0.000225f);
-    __mac_tap(-0.000264f);
-    __mac_tap(-0.000301f);
-    __mac_tap(-0.000336f);
-    __mac_tap(-0.000367f);
-    __mac_tap(-0.000391f);
-    __mac_tap(-0.000408f);
-    __mac_tap(-0.000414f);
-    __mac_tap(-0.000409f);
-    __mac_tap(-0.000391f);
-    __mac_tap(-0.000358f);
-    __mac_tap(-0.00031f);
-    __mac_tap(-0.000244f);
-    __mac_tap(-0.000162f);
-    __mac_tap(-0.000062f);
-    __mac_tap(0.000054f);
-    __mac_tap(0.000185f);
-    __mac_tap(0.000329f);
-    __mac_tap(0.000485f);
-    __mac_tap(0.000648f);
-    __mac_tap(0.000816f);
-    __mac_tap(0.000984f);
-    __mac_tap(0.001148f);
-    __mac_tap(0.001302f);
-    __mac_tap(0.001441f);
-    __mac_tap(0.00156f);
-    __mac_tap(0.001654f);
-    __mac_tap(0.001717f);
-    __mac_tap(0.001744f);
-    __mac_tap(0.001731f);
-    __mac_tap(0.001675f);
-    __mac_tap(0.001572f);
-    __mac_tap(0.00142f);
-    __mac_tap(0.001219f);
-    __mac_tap(0.000969f);
-    __mac_tap(0.000672f);
-    __mac_tap(0.000331f);
-    __mac_tap(-0.000049f);
-    __mac_tap(-0.000463f);
-    __mac_tap(-0.000902f);
-    __mac_tap(-0.001358f);
-    __mac_tap(-0.001822f);
-    __mac_tap(-0.002282f);
-    __mac_tap(-0.002727f);
-    __mac_tap(-0.003146f);
-    __mac_tap(-0.003526f);
-    __mac_tap(-0.003855f);
-    __mac_tap(-0.004122f);
-    __mac_tap(-0.004315f);
-    __mac_tap(-0.004426f);
-    __mac_tap(-0.004446f);
-    __mac_tap(-0.004368f);
-    __mac_tap(-0.004187f);
-    __mac_tap(-0.003901f);
-    __mac_tap(-0.003511f);
-    __mac_tap(-0.003019f);
-    __mac_tap(-0.002429f);
-    __mac_tap(-0.00175f);
-    __mac_tap(-0.000992f);
-    __mac_tap(-0.000168f);
-    __mac_tap(0.000706f);
-    __mac_tap(0.001615f);
-    __mac_tap(0.002538f);
-    __mac_tap(0.003456f);
-    __mac_tap(0.004347f);
-    __mac_tap(0.005191f);
-    __mac_tap(0.005965f);
-    __mac_tap(0.006649f);
-    __mac_tap(0.007224f);
-    __mac_tap(0.007672f);
-    __mac_tap(0.007977f);
-    __mac_tap(0.008126f);
-    __mac_tap(0.008109f);
-    __mac_tap(0.00792f);
-    __mac_tap(0.007556f);
-    __mac_tap(0.007018f);
-    __mac_tap(0.006311f);
-    __mac_tap(0.005446f);
-    __mac_tap(0.004435f);
-    __mac_tap(0.003295f);
-    __mac_tap(0.002047f);
-    __mac_tap(0.000715f);
-    __mac_tap(-0.000676f);
-    __mac_tap(-0.002096f);
-    __mac_tap(-0.003515f);
-    __mac_tap(-0.004902f);
-    __mac_tap(-0.006227f);
-    __mac_tap(-0.00746f);
-    __mac_tap(-0.00857f);
-    __mac_tap(-0.009531f);
-    __mac_tap(-0.010319f);
-    __mac_tap(-0.010912f);
-    __mac_tap(-0.011294f);
-    __mac_tap(-0.011452f);
-    __mac_tap(-0.011378f);
-    __mac_tap(-0.011068f);
-    __mac_tap(-0.010526f);
-    __mac_tap(-0.009759f);
-    __mac_tap(-0.008779f);
-    __mac_tap(-0.007604f);
-    __mac_tap(-0.006257f);
-    __mac_tap(-0.004763f);
-    __mac_tap(-0.003153f);
-    __mac_tap(-0.00146f);
-    __mac_tap(0.000282f);
-    __mac_tap(0.002035f);
-    __mac_tap(0.003763f);
-    __mac_tap(0.005429f);
-    __mac_tap(0.006996f);
-    __mac_tap(0.008432f);
-    __mac_tap(0.009704f);
-    __mac_tap(0.010785f);
-    __mac_tap(0.011652f);
-    __mac_tap(0.012285f);
-    __mac_tap(0.012671f);
-    __mac_tap(0.0128f);
-    __mac_tap(0.012671f);
-    __mac_tap(0.012285f);
-    __mac_tap(0.011652f);
-    __mac_tap(0.010785f);
-    __mac_tap(0.009704f);
-    __mac_tap(0.008432f);
-    __mac_tap(0.006996f);
-    __mac_tap(0.005429f);
-    __mac_tap(0.003763f);
-    __mac_tap(0.002035f);
-    __mac_tap(0.000282f);
-    __mac_tap(-0.00146f);
-    __mac_tap(-0.003153f);
-    __mac_tap(-0.004763f);
-    __mac_tap(-0.006257f);
-    __mac_tap(-0.007604f);
-    __mac_tap(-0.008779f);
-    __mac_tap(-0.009759f);
-    __mac_tap(-0.010526f);
-    __mac_tap(-0.011068f);
-    __mac_tap(-0.011378f);
-    __mac_tap(-0.011452f);
-    __mac_tap(-0.011294f);
-    __mac_tap(-0.010912f);
-    __mac_tap(-0.010319f);
-    __mac_tap(-0.009531f);
-    __mac_tap(-0.00857f);
-    __mac_tap(-0.00746f);
-    __mac_tap(-0.006227f);
-    __mac_tap(-0.004902f);
-    __mac_tap(-0.003515f);
-    __mac_tap(-0.002096f);
-    __mac_tap(-0.000676f);
-    __mac_tap(0.000715f);
-    __mac_tap(0.002047f);
-    __mac_tap(0.003295f);
-    __mac_tap(0.004435f);
-    __mac_tap(0.005446f);
-    __mac_tap(0.006311f);
-    __mac_tap(0.007018f);
-    __mac_tap(0.007556f);
-    __mac_tap(0.00792f);
-    __mac_tap(0.008109f);
-    __mac_tap(0.008126f);
-    __mac_tap(0.007977f);
-    __mac_tap(0.007672f);
-    __mac_tap(0.007224f);
-    __mac_tap(0.006649f);
-    __mac_tap(0.005965f);
-    __mac_tap(0.005191f);
-    __mac_tap(0.004347f);
-    __mac_tap(0.003456f);
-    __mac_tap(0.002538f);
-    __mac_tap(0.001615f);
-    __mac_tap(0.000706f);
-    __mac_tap(-0.000168f);
-    __mac_tap(-0.000992f);
-    __mac_tap(-0.00175f);
-    __mac_tap(-0.002429f);
-    __mac_tap(-0.003019f);
-    __mac_tap(-0.003511f);
-    __mac_tap(-0.003901f);
-    __mac_tap(-0.004187f);
-    __mac_tap(-0.004368f);
-    __mac_tap(-0.004446f);
-    __mac_tap(-0.004426f);
-    __mac_tap(-0.004315f);
-    __mac_tap(-0.004122f);
-    __mac_tap(-0.003855f);
-    __mac_tap(-0.003526f);
-    __mac_tap(-0.003146f);
-    __mac_tap(-0.002727f);
-    __mac_tap(-0.002282f);
-    __mac_tap(-0.001822f);
-    __mac_tap(-0.001358f);
-    __mac_tap(-0.000902f);
-    __mac_tap(-0.000463f);
-    __mac_tap(-0.000049f);
-    __mac_tap(0.000331f);
-    __mac_tap(0.000672f);
-    __mac_tap(0.000969f);
-    __mac_tap(0.001219f);
-    __mac_tap(0.00142f);
-    __mac_tap(0.001572f);
-    __mac_tap(0.001675f);
-    __mac_tap(0.001731f);
-    __mac_tap(0.001744f);
-    __mac_tap(0.001717f);
-    __mac_tap(0.001654f);
-    __mac_tap(0.00156f);
-    __mac_tap(0.001441f);
-    __mac_tap(0.001302f);
-    __mac_tap(0.001148f);
-    __mac_tap(0.000984f);
-    __mac_tap(0.000816f);
-    __mac_tap(0.000648f);
-    __mac_tap(0.000485f);
-    __mac_tap(0.000329f);
-    __mac_tap(0.000185f);
-    __mac_tap(0.000054f);
-    __mac_tap(-0.000062f);
-    __mac_tap(-0.000162f);
-    __mac_tap(-0.000244f);
-    __mac_tap(-0.00031f);
-    __mac_tap(-0.000358f);
-    __mac_tap(-0.000391f);
-    __mac_tap(-0.000409f);
-    __mac_tap(-0.000414f);
-    __mac_tap(-0.000408f);
-    __mac_tap(-0.000391f);
-    __mac_tap(-0.000367f);
-    __mac_tap(-0.000336f);
-    __mac_tap(-0.000301f);
-    __mac_tap(-0.000264f);
-    __mac_tap(-0.000225f);
-    __mac_tap(-0.000187f);
-    __mac_tap(-0.00015f);
-    __mac_tap(-0.000116f);
-    __mac_tap(-0.000084f);
-    __mac_tap(-0.000056f);
-    __mac_tap(-0.000032f);
-    __mac_tap(-0.000013f);
-    __mac_tap(0.000003f);
-    __mac_tap(0.000015f);
-    __mac_tap(0.000024f);
-    __mac_tap(0.000029f);
-    __mac_tap(0.000032f);
-    return acc;
-  }
-
   static const float __not_in_flash_func(lpf_2600f_tx)(const float sample)
   {
     // 31250
@@ -0,0 +1,101 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Non-blocking I2C writes for the Si5351
+//
+// A register write (register address then data, STOP on the last
+// byte) is built as I2C data/command words and fed to the I2C TX FIFO
+// by DMA, paced by the I2C DREQ. Core 1 carries on and polls done()
+// until the STOP is seen or the write aborts (no ACK). Uses the I2C
+// block already set up by Wire, Wire is still used for reads.
+
+#ifndef I2CDMA_H
+#define I2CDMA_H
+
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "si5351.h"
+
+namespace I2CDMA
+{
+  static i2c_inst_t *i2c = i2c0;
+  static int dma_channel = -1;
+  static dma_channel_config dma_config;
+  static uint32_t commands[SI5351_XFER_MAX+1u];
+  static bool active = false;
+
+  static void start(const uint8_t address,const uint8_t reg,const uint8_t *data,const uint8_t bytes)
+  {
+    // target is fixed, the Si5351 is the only device
+    (void)address;
+    commands[0] = reg;
+    for (uint32_t i=0;i<bytes;i++)
+    {
+      commands[i+1u] = data[i];
+    }
+    commands[bytes] |= I2C_IC_DATA_CMD_STOP_BITS;
+    (void)i2c->hw->clr_tx_abrt;
+    (void)i2c->hw->clr_stop_det;
+    dma_channel_configure(dma_channel,&dma_config,&i2c->hw->data_cmd,commands,bytes+1u,true);
+    active = true;
+  }
+
+  static uint8_t done(void)
+  {
+    // SI5351_XFER_BUSY, 0 or 1 if no ACK
+    if (!active)
+    {
+      return 0;
+    }
+    const uint32_t raw = i2c->hw->raw_intr_stat;
+    if (raw & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)
+    {
+      // FIFO flushed by the abort, stop feeding it
+      dma_channel_abort(dma_channel);
+      (void)i2c->hw->clr_tx_abrt;
+      active = false;
+      return 1;
+    }
+    if (dma_channel_is_busy(dma_channel) || !(raw & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS))
+    {
+      return SI5351_XFER_BUSY;
+    }
+    (void)i2c->hw->clr_stop_det;
+    active = false;
+    return 0;
+  }
+
+  static const struct Si5351Transport transport = {start,done};
+
+  static void init(const uint8_t address)
+  {
+    // after Wire.begin(), point the block at the Si5351
+    i2c->hw->enable = 0;
+    i2c->hw->tar = address;
+    i2c->hw->enable = 1;
+    dma_channel = dma_claim_unused_channel(true);
+    dma_config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&dma_config,DMA_SIZE_32);
+    channel_config_set_read_increment(&dma_config,true);
+    channel_config_set_write_increment(&dma_config,false);
+    channel_config_set_dreq(&dma_config,i2c_get_dreq(i2c,true));
+  }
+}
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// RX I/Q imbalance correction
+//
+// Blind estimator: for a proper (circular) signal E[I^2] = E[Q^2] and
+// E[IQ] = 0, so with Q = A.sin(t+p) against I = cos(t)
+//   gain = 1/A    = sqrt(E[I^2]/E[Q^2])
+//   sin(p)        = E[IQ]/sqrt(E[I^2].E[Q^2])
+//   Q' = (gain.Q - sin(p).I)/cos(p)
+// The statistics are gathered on every 8th sample and the correction
+// is updated every block (about 0.5 seconds). Results are kept for
+// each 25kHz segment of the band.
+
+#ifndef IQBAL_H
+#define IQBAL_H
+
+#define IQB_DECIMATE      8u
+#define IQB_BLOCK         2048u
+#define IQB_SEGMENT_WIDTH 25000ul
+#define IQB_SEGMENTS      12u
+#define IQB_BAND_START    7000000ul
+
+namespace IQBAL
+{
+  static struct
+  {
+    float gain;
+    float sin_phase;
+  }
+  table[IQB_SEGMENTS] =
+  {
+    {1.0f,0.0f},{1.0f,0.0f},{1.0f,0.0f},{1.0f,0.0f},
+    {1.0f,0.0f},{1.0f,0.0f},{1.0f,0.0f},{1.0f,0.0f},
+    {1.0f,0.0f},{1.0f,0.0f},{1.0f,0.0f},{1.0f,0.0f}
+  };
+
+  volatile static uint32_t segment_request = 0;
+
+  static void set_frequency(const uint32_t frequency)
+  {
+    // core 1, select the segment for this frequency
+    uint32_t segment = 0;
+    if (frequency>IQB_BAND_START)
+    {
+      segment = (frequency - IQB_BAND_START) / IQB_SEGMENT_WIDTH;
+    }
+    segment_request = min(segment,IQB_SEGMENTS-1u);
+  }
+
+  static void __not_in_flash_func(correct)(float &in_i,float &in_q)
+  {
+    // smoothing of each new estimate
+    static const float mu = 0.25f;
+    // DC tracking for the estimator only
+    static const float k_dc = 0.001f;
+    static uint32_t segment = 0;
+    static uint32_t count = 0;
+    static uint32_t n = 0;
+    static float dc_i = 0.0f;
+    static float dc_q = 0.0f;
+    static float sii = 0.0f;
+    static float sqq = 0.0f;
+    static float siq = 0.0f;
+    static float gain = 1.0f;
+    static float sin_phase = 0.0f;
+    static float sec_phase = 1.0f;
+
+    if (++count>=IQB_DECIMATE)
+    {
+      count = 0;
+      if (segment_request!=segment)
+      {
+        // retuned to another segment, swap the correction
+        table[segment].gain = gain;
+        table[segment].sin_phase = sin_phase;
+        segment = segment_request;
+        gain = table[segment].gain;
+        sin_phase = table[segment].sin_phase;
+        sec_phase = 1.0f / sqrtf(1.0f - sin_phase*sin_phase);
+        sii = sqq = siq = 0.0f;
+        n = 0;
+      }
+      dc_i += (in_i - dc_i) * k_dc;
+      dc_q += (in_q - dc_q) * k_dc;
+      const float ii = in_i - dc_i;
+      const float qq = in_q - dc_q;
+      sii += ii * ii;
+      sqq += qq * qq;
+      siq += ii * qq;
+      if (++n>=IQB_BLOCK)
+      {
+        if (sii>0.0f && sqq>0.0f)
+        {
+          const float g = sqrtf(sii / sqq);
+          const float s = constrain(siq / sqrtf(sii * sqq),-0.5f,+0.5f);
+          gain += (g - gain) * mu;
+          sin_phase += (s - sin_phase) * mu;
+          sec_phase = 1.0f / sqrtf(1.0f - sin_phase*sin_phase);
+        }
+        sii = sqq = siq = 0.0f;
+        n = 0;
+      }
+    }
+
+    // correct Q against I
+    in_q = (gain * in_q - sin_phase * in_i) * sec_phase;
+  }
+}
+
+#endif
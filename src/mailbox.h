@@ -0,0 +1,114 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Core 1 to core 0 commands
+//
+// Core 1 stages changes for the DSP (mode, key, mute, AGC) then posts
+// them as one message. Core 0 takes the whole message between samples
+// so it never works from half a change, and keeps its own copy rather
+// than reading shared memory all through the sample.
+//
+// Lock-free: a sequence count is odd while core 1 is writing. If it is
+// odd, or moved while core 0 was copying, core 0 keeps what it has and
+// looks again next sample, it never waits. Mute and AGC are events so
+// they are counts, core 0 acts when a count changes. The SIO FIFO is
+// left to the arduino-pico core.
+
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#include "hardware/sync.h"
+
+namespace MAILBOX
+{
+  struct command_t
+  {
+    uint8_t mode;
+    bool keydown;
+    uint8_t mute;     // one more for each mute
+    uint8_t agc;      // one more for each AGC set
+    float agc_peak;
+  };
+
+  volatile static uint32_t sequence = 0;
+  static command_t box = {};
+  static command_t staged = {};  // core 1 only
+
+  static void set_mode(const uint8_t mode)
+  {
+    staged.mode = mode;
+  }
+
+  static void set_key(const bool down)
+  {
+    staged.keydown = down;
+  }
+
+  static void mute(void)
+  {
+    staged.mute++;
+  }
+
+  static void set_agc(const float peak)
+  {
+    staged.agc_peak = peak;
+    staged.agc++;
+  }
+
+  static void post(void)
+  {
+    // core 1, everything staged goes together
+    const uint32_t s = sequence;
+    sequence = s + 1u;
+    __dmb();
+    box = staged;
+    __dmb();
+    sequence = s + 2u;
+  }
+
+  static void send_key(const bool down)
+  {
+    // core 1, key changes go straight away
+    set_key(down);
+    post();
+  }
+
+  static const bool __not_in_flash_func(receive)(command_t &command)
+  {
+    // core 0, true if there was a new message
+    static uint32_t last = 0;
+    const uint32_t s = sequence;
+    if (s==last || (s & 1u))
+    {
+      return false;
+    }
+    __dmb();
+    const command_t copy = box;
+    __dmb();
+    if (sequence!=s)
+    {
+      return false;
+    }
+    command = copy;
+    last = s;
+    return true;
+  }
+}
+
+#endif
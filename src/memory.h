@@ -0,0 +1,146 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Memory channels
+//
+// Frequency, mode and tuning step, one settings record per channel
+// (the index is the channel). All of them are read into RAM at start
+// up so recall and scanning never touch flash. A frequency of zero is
+// an empty channel. Storing a frequency and mode that's already there
+// gives that channel back, otherwise it goes in the first empty channel
+// or, once they're all used, over the oldest one.
+
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include "settings.h"
+
+#define MEMORY_CHANNELS 16u
+#define MEMORY_NONE     0xffu
+
+namespace MEMORY
+{
+  struct channel_t
+  {
+    uint32_t frequency;
+    uint32_t tuning_step;
+    uint32_t serial;      // higher is newer
+    uint8_t mode;
+  };
+
+  static channel_t channels[MEMORY_CHANNELS];
+
+  static void init(const uint32_t min_frequency,const uint32_t max_frequency)
+  {
+    // after SETTINGS::init(), anything out of band is empty
+    memset(channels,0,sizeof(channels));
+    for (uint32_t ch=0;ch<MEMORY_CHANNELS;ch++)
+    {
+      channel_t c;
+      if (SETTINGS::read(SETTINGS_TYPE_MEMORY,ch,&c,sizeof(c)) && c.frequency>=min_frequency && c.frequency<=max_frequency)
+      {
+        channels[ch] = c;
+      }
+    }
+  }
+
+  static const bool used(const uint32_t ch)
+  {
+    return ch<MEMORY_CHANNELS && channels[ch].frequency!=0;
+  }
+
+  static const channel_t &get(const uint32_t ch)
+  {
+    return channels[min(ch,MEMORY_CHANNELS - 1u)];
+  }
+
+  static const uint32_t count(void)
+  {
+    uint32_t n = 0;
+    for (uint32_t ch=0;ch<MEMORY_CHANNELS;ch++)
+    {
+      if (used(ch))
+      {
+        n++;
+      }
+    }
+    return n;
+  }
+
+  static const uint32_t next(const uint32_t from,const int32_t dir)
+  {
+    // the next used channel up or down from 'from', round
+    // the end, 'from' itself if it's the only one
+    uint32_t ch = min(from,MEMORY_CHANNELS - 1u);
+    for (uint32_t i=0;i<MEMORY_CHANNELS;i++)
+    {
+      ch = (ch + (dir<0?MEMORY_CHANNELS - 1u:1u)) % MEMORY_CHANNELS;
+      if (used(ch))
+      {
+        return ch;
+      }
+    }
+    return MEMORY_NONE;
+  }
+
+  static const uint32_t store(const uint32_t frequency,const uint32_t tuning_step,const uint8_t mode)
+  {
+    // core 1, same rules as SETTINGS::write(), returns the channel
+    uint32_t ch = MEMORY_NONE;
+    uint32_t serial = 0;
+    for (uint32_t i=0;i<MEMORY_CHANNELS;i++)
+    {
+      serial = max(serial,channels[i].serial);
+      if (channels[i].frequency==frequency && channels[i].mode==mode)
+      {
+        ch = i;
+      }
+    }
+    if (ch==MEMORY_NONE)
+    {
+      ch = 0;
+      for (uint32_t i=0;i<MEMORY_CHANNELS;i++)
+      {
+        if (!used(i))
+        {
+          ch = i;
+          break;
+        }
+        if (channels[i].serial<channels[ch].serial)
+        {
+          ch = i;
+        }
+      }
+    }
+    channel_t c;
+    memset(&c,0,sizeof(c));
+    c.frequency = frequency;
+    c.tuning_step = tuning_step;
+    c.serial = serial + 1u;
+    c.mode = mode;
+    if (!SETTINGS::write(SETTINGS_TYPE_MEMORY,ch,&c,sizeof(c)))
+    {
+      return MEMORY_NONE;
+    }
+    channels[ch] = c;
+    return ch;
+  }
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Receiver and voice prompt mixer
+//
+// While a prompt is active the receiver is ducked down to a set level
+// with a short linear ramp and brought back up slowly afterwards, so
+// there are no steps in the audio. The prompt waits for the duck to
+// finish before it starts. While mixing, the sum is soft clipped into
+// the 12 bit DAC range: linear up to the knee then a quarter slope up
+// to full scale. With no prompt and the receiver back at full level it
+// passes straight through, untouched. All integer, a few operations
+// per sample.
+
+#ifndef MIXER_H
+#define MIXER_H
+
+#define MIXER_UNITY     32768l  // Q15
+#define MIXER_ATTACK    312l    // 10ms duck
+#define MIXER_RELEASE   3125l   // 100ms back to full
+#define MIXER_KNEE      1536l
+#define MIXER_FULL      2047l
+
+namespace MIXER
+{
+  volatile static int32_t duck_gain = MIXER_UNITY/8;   // written by core 1
+  volatile static int32_t prompt_gain = MIXER_UNITY;   // written by core 1
+  static int32_t gain = MIXER_UNITY;
+
+  static void set_levels(const float duck_db,const float prompt_db)
+  {
+    // receiver level under a prompt and prompt level, in dB
+    duck_gain = (int32_t)(powf(10.0f,min(duck_db,0.0f)/20.0f) * (float)MIXER_UNITY);
+    prompt_gain = (int32_t)(powf(10.0f,min(prompt_db,6.0f)/20.0f) * (float)MIXER_UNITY);
+  }
+
+  static const bool __not_in_flash_func(ducked)(void)
+  {
+    // receiver is down, ok to start talking
+    return gain<=duck_gain;
+  }
+
+  static const int32_t __not_in_flash_func(soft_clip)(const int32_t x)
+  {
+    if (x>MIXER_KNEE)
+    {
+      return min(MIXER_KNEE + ((x - MIXER_KNEE) >> 2),MIXER_FULL);
+    }
+    if (x<-MIXER_KNEE)
+    {
+      return max(-MIXER_KNEE - ((-MIXER_KNEE - x) >> 2),-MIXER_FULL-1l);
+    }
+    return x;
+  }
+
+  static const int32_t __not_in_flash_func(mix)(const int32_t rx,const int32_t prompt,const bool duck)
+  {
+    // core 0, once per sample
+    const int32_t low = duck_gain;
+    if (duck)
+    {
+      gain = max(gain - (MIXER_UNITY - low) / MIXER_ATTACK,low);
+    }
+    else if (gain<MIXER_UNITY)
+    {
+      gain = min(gain + (MIXER_UNITY - low) / MIXER_RELEASE + 1l,MIXER_UNITY);
+    }
+    if (prompt==0 && gain>=MIXER_UNITY)
+    {
+      // nothing to mix
+      return rx;
+    }
+    const int32_t out = ((rx * gain) >> 15) + ((prompt * prompt_gain) >> 15);
+    return soft_clip(out);
+  }
+}
+
+#endif
@@ -0,0 +1,347 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Voice prompt engine
+//
+// One player for all the voice prompts. Core 1 queues a phrase (a few
+// clip IDs) with a priority, core 0 plays the queue one sample at a
+// time from announce(). The queue is single producer (core 1), single
+// consumer (core 0) so it needs no locks.
+//
+// A phrase of equal or higher priority than whatever is playing or
+// queued pre-empts it: the epoch is bumped and core 0 drops anything
+// from an older epoch. A lower priority phrase waits its turn, so
+// nothing is dropped because something else was talking.
+//
+// Core 0 skips the pre-empted entries one per sample, so the ring is
+// twice the longest phrase: a phrase that pre-empts always fits beside
+// a whole phrase of stale entries. Nothing changes unless the phrase
+// fits. speak() holds a phrase that doesn't and retry() tries it
+// again, a later phrase of the same or higher priority replaces it and
+// a lower one is dropped.
+//
+// The clips (promptdata.h) are made by tools/promptpack.py, trimmed of
+// silence, so a short gap is played between clips.
+//
+// IDs above the recorded clips are made on the fly: a pause and the
+// two Morse elements, so a phrase can use a Morse letter for a word
+// that has no recording (S, plus, ...). The phrase helpers build
+// numbers from the digit clips and letters from the elements.
+
+#ifndef PROMPT_H
+#define PROMPT_H
+
+#include "adpcm.h"
+#include "CW.h"
+
+#define PROMPT_QUEUE_SIZE 32u  // longest phrase
+#define PROMPT_RING_SIZE  (2u*PROMPT_QUEUE_SIZE)
+#define PROMPT_RING_MASK  (PROMPT_RING_SIZE-1u)
+#define PROMPT_GAP        4688u // 150ms between clips
+#define PROMPT_SHIFT      4u    // clips are normalised to half scale
+#define PROMPT_DIT        1875u // 60ms, 20 WPM
+#define PROMPT_RAMP       156u  // 5ms tone rise and fall
+#define PROMPT_TONE       600ull
+#define PROMPT_TONE_SHIFT 5u    // same level as the clips
+
+#define PROMPT_PRIORITY_NONE   0u
+#define PROMPT_PRIORITY_LOW    1u // frequency and number readouts
+#define PROMPT_PRIORITY_HIGH   2u // mode and step changes
+
+namespace PROMPT
+{
+  #include "promptdata.h"
+
+  static constexpr bool index_ok(const uint32_t n)
+  {
+    // every clip aligned, inside the blob and whole ADPCM blocks
+    return n>=NUM_CLIPS ||
+      (clip_index[n].offset%PROMPT_ALIGN==0 &&
+       clip_index[n].offset+clip_index[n].bytes<=PROMPT_BLOB_SIZE &&
+       clip_index[n].bytes==(clip_index[n].samples+ADPCM_BLOCK_SAMPLES-1u)/ADPCM_BLOCK_SAMPLES*ADPCM_BLOCK_BYTES &&
+       index_ok(n+1u));
+  }
+
+  static_assert(sizeof(blob)==PROMPT_BLOB_SIZE,"prompt blob size");
+  static_assert(index_ok(0),"prompt index");
+  static_assert(CLIP_NINE==CLIP_ZERO+9 && CLIP_FIFTEEN==CLIP_ZERO+15,"digit clips out of order");
+
+  // made on the fly, not stored
+  enum
+  {
+    CLIP_PAUSE = NUM_CLIPS,
+    CLIP_DIT,
+    CLIP_DAH,
+    NUM_IDS
+  };
+
+  static_assert(NUM_IDS<256u,"clip IDs are 8 bit");
+
+  struct phrase_t
+  {
+    uint8_t ids[PROMPT_QUEUE_SIZE];
+    uint32_t count;  // past PROMPT_QUEUE_SIZE if it was too long
+  };
+
+  // queue entry: clip | priority << 8 | epoch << 16
+  volatile static uint32_t queue[PROMPT_RING_SIZE] = {0};
+  volatile static uint32_t head = 0;     // written by core 1
+  volatile static uint32_t tail = 0;     // written by core 0
+  volatile static uint32_t epoch = 0;    // written by core 1
+  volatile static bool playing = false;  // written by core 0
+  static uint32_t queued_priority = PROMPT_PRIORITY_NONE;
+  static phrase_t held = {};             // core 1, no room for it yet
+  static uint32_t held_priority = PROMPT_PRIORITY_NONE;
+
+  // core 0 player state
+  static ADPCM::decoder_t decoder;
+  static uint32_t playing_epoch = 0;
+  static uint32_t gap = 0;
+  static bool synth = false;
+  static uint32_t synth_n = 0;
+  static uint32_t synth_on = 0;
+  static uint32_t synth_length = 0;
+  static uint32_t dds = 0;
+
+  static const bool __not_in_flash_func(active)(void)
+  {
+    // something playing or waiting to play
+    return playing || head!=tail;
+  }
+
+  static const bool say(const uint8_t *ids,const uint32_t count,const uint32_t priority)
+  {
+    // core 1, queue a phrase, false and nothing changed if it won't fit
+    if (count>PROMPT_QUEUE_SIZE)
+    {
+      return false;
+    }
+    const uint32_t current = active()?queued_priority:PROMPT_PRIORITY_NONE;
+    const bool preempt = priority>=current;
+    // waiting its turn it goes behind what's still to be said, else
+    // beside entries core 0 hasn't skipped yet, one per sample
+    const uint32_t used = head - tail;
+    if (used + count>(preempt?PROMPT_RING_SIZE:PROMPT_QUEUE_SIZE))
+    {
+      return false;
+    }
+    if (preempt)
+    {
+      // pre-empt whatever is playing, queued or held
+      epoch = (epoch + 1u) & 0xffffu;
+      queued_priority = priority;
+      if (priority>=held_priority)
+      {
+        held_priority = PROMPT_PRIORITY_NONE;
+      }
+    }
+    uint32_t h = head;
+    for (uint32_t i=0;i<count;i++)
+    {
+      queue[h & PROMPT_RING_MASK] = ids[i] | (priority << 8) | (epoch << 16);
+      h++;
+    }
+    // entries visible to core 0 before the new head
+    __dmb();
+    head = h;
+    return true;
+  }
+
+  static const bool say(const uint8_t id,const uint32_t priority)
+  {
+    return say(&id,1,priority);
+  }
+
+  static const bool say(const phrase_t &phrase,const uint32_t priority)
+  {
+    return say(phrase.ids,phrase.count,priority);
+  }
+
+  static void speak(const uint8_t *ids,const uint32_t count,const uint32_t priority)
+  {
+    // core 1, say it, or hold it for retry() when there's no room
+    if (say(ids,count,priority) || count>PROMPT_QUEUE_SIZE || priority<held_priority)
+    {
+      return;
+    }
+    memcpy(held.ids,ids,count);
+    held.count = count;
+    held_priority = priority;
+  }
+
+  static void speak(const uint8_t id,const uint32_t priority)
+  {
+    speak(&id,1,priority);
+  }
+
+  static void speak(const phrase_t &phrase,const uint32_t priority)
+  {
+    speak(phrase.ids,phrase.count,priority);
+  }
+
+  static const bool retry(void)
+  {
+    // core 1, say the held phrase if there's room now, false while
+    // one is still held
+    if (held_priority==PROMPT_PRIORITY_NONE)
+    {
+      return true;
+    }
+    const uint32_t priority = held_priority;
+    held_priority = PROMPT_PRIORITY_NONE;
+    if (say(held,priority))
+    {
+      return true;
+    }
+    held_priority = priority;
+    return false;
+  }
+
+  static void add(phrase_t &phrase,const uint8_t id)
+  {
+    // too long is counted, say() won't take it
+    if (phrase.count<PROMPT_QUEUE_SIZE)
+    {
+      phrase.ids[phrase.count] = id;
+    }
+    phrase.count++;
+  }
+
+  static void add_number(phrase_t &phrase,const uint32_t number)
+  {
+    // up to fifteen as one word, otherwise digit by digit
+    if (number<=15u)
+    {
+      add(phrase,CLIP_ZERO + number);
+      return;
+    }
+    uint8_t digits[10] = {0};
+    uint32_t n = 0;
+    uint32_t value = number;
+    while (value>0)
+    {
+      digits[n++] = value % 10ul;
+      value /= 10ul;
+    }
+    while (n>0)
+    {
+      add(phrase,CLIP_ZERO + digits[--n]);
+    }
+  }
+
+  static void add_morse(phrase_t &phrase,const char *code)
+  {
+    // one letter, eg ".-.-." then a letter space
+    for (const char *c=code;*c;c++)
+    {
+      add(phrase,*c=='-'?CLIP_DAH:CLIP_DIT);
+    }
+    add(phrase,CLIP_PAUSE);
+  }
+
+  static const int16_t __not_in_flash_func(tone)(void)
+  {
+    // element with a short rise and fall, then silence
+    if (synth_n>=synth_on)
+    {
+      return 0;
+    }
+    const uint32_t edge = min(synth_n,synth_on - synth_n - 1u);
+    int32_t s = CW::dds_sin_tab[dds>>22] >> PROMPT_TONE_SHIFT;
+    if (edge<PROMPT_RAMP)
+    {
+      s = s * (int32_t)edge / (int32_t)PROMPT_RAMP;
+    }
+    static const uint32_t phase = (uint32_t)((PROMPT_TONE * (1ull << 32)) / SAMPLERATE);
+    dds += phase;
+    return (int16_t)s;
+  }
+
+  static const int16_t __not_in_flash_func(announce)(void)
+  {
+    // core 0, once per sample, O(1)
+    if (playing)
+    {
+      if (playing_epoch!=epoch)
+      {
+        // pre-empted
+        playing = false;
+        return 0;
+      }
+      if (synth)
+      {
+        if (synth_n<synth_length)
+        {
+          const int16_t sample = tone();
+          synth_n++;
+          return sample;
+        }
+        // the silence after an element is the gap
+        playing = false;
+        gap = 0;
+        return 0;
+      }
+      int16_t sample = 0;
+      if (ADPCM::decode(decoder,sample))
+      {
+        return sample >> PROMPT_SHIFT;
+      }
+      playing = false;
+      gap = PROMPT_GAP;
+      return 0;
+    }
+    if (tail!=head)
+    {
+      const uint32_t entry = queue[tail & PROMPT_RING_MASK];
+      const uint32_t id = entry & 0xffu;
+      if ((entry >> 16)!=epoch || id>=NUM_IDS)
+      {
+        // pre-empted, skip it
+        tail = tail + 1u;
+        return 0;
+      }
+      if (gap>0 && (entry >> 16)==playing_epoch)
+      {
+        // between clips of the same phrase
+        gap--;
+        return 0;
+      }
+      synth = id>=NUM_CLIPS;
+      if (synth)
+      {
+        // dit or dah and one dit of silence, or a pause
+        synth_on = id==CLIP_DIT?PROMPT_DIT:id==CLIP_DAH?3u*PROMPT_DIT:0u;
+        synth_length = id==CLIP_PAUSE?PROMPT_GAP:synth_on + PROMPT_DIT;
+        synth_n = 0;
+        dds = 0;
+      }
+      else
+      {
+        const ADPCM::clip_t clip = {blob + clip_index[id].offset,clip_index[id].samples};
+        ADPCM::start(decoder,clip);
+      }
+      playing_epoch = entry >> 16;
+      playing = true;
+      tail = tail + 1u;
+    }
+    return 0;
+  }
+}
+
+#endif
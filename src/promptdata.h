@@ -0,0 +1,4704 @@
+// generated by tools/promptpack.py from prompts/, do not edit
+// IMA ADPCM, 7812.5Hz, 256 samples per block
+
+#ifndef PROMPTDATA_H
+#define PROMPTDATA_H
+
+#define PROMPT_ALIGN     32u
+#define PROMPT_BLOB_SIZE 73588u
+
+enum clip_id_t
+{
+  CLIP_ZERO,
+  CLIP_ONE,
+  CLIP_TWO,
+  CLIP_THREE,
+  CLIP_FOUR,
+  CLIP_FIVE,
+  CLIP_SIX,
+  CLIP_SEVEN,
+  CLIP_EIGHT,
+  CLIP_NINE,
+  CLIP_TEN,
+  CLIP_ELEVEN,
+  CLIP_TWELVE,
+  CLIP_THIRTEEN,
+  CLIP_FOURTEEN,
+  CLIP_FIFTEEN,
+  CLIP_POINT,
+  CLIP_MEGAHERTZ,
+  CLIP_LSB,
+  CLIP_USB,
+  CLIP_CWL,
+  CLIP_CWU,
+  CLIP_STEP10,
+  CLIP_STEP100,
+  CLIP_STEP1000,
+  NUM_CLIPS
+};
+
+static const uint8_t __attribute__((aligned(PROMPT_ALIGN))) blob[PROMPT_BLOB_SIZE] =
+{
+  // zero
+  0x05, 0x00, 0x00, 0x00, 0xF0, 0xDF, 0xDB, 0x00, 0x88, 0x42, 0x0C, 0x73, 0x00, 0x08, 0x18, 0xEB,
+  0xA3, 0x1B, 0x0A, 0x29, 0x16, 0x10, 0x81, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x7B, 0xFF, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x90, 0x77, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xE1, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x47, 0x08, 0x28,
+  0x86, 0x00, 0x19, 0x06, 0x08, 0x80, 0x80, 0x9E, 0xC0, 0x99, 0x8C, 0xAB, 0xAB, 0x90, 0x54, 0x30,
+  0x34, 0x55, 0x32, 0x43, 0x33, 0x22, 0x80, 0xE8, 0xCB, 0xBD, 0xBD, 0xBB, 0xBC, 0xBA, 0x99, 0x19,
+  0x42, 0x44, 0x45, 0x42, 0x32, 0x33, 0x12, 0x02, 0x98, 0xCC, 0xDB, 0xBC, 0xCB, 0xBB, 0xBB, 0xAC,
+  0x9A, 0x09, 0x20, 0x42, 0x25, 0x34, 0x35, 0x43, 0x33, 0x33, 0x23, 0x01, 0x80, 0xCC, 0xBC, 0xDC,
+  0xCA, 0xCA, 0xAA, 0xAB, 0x57, 0xF2, 0x2D, 0x00, 0xA9, 0x99, 0x00, 0x32, 0x63, 0x34, 0x44, 0x43,
+  0x33, 0x33, 0x24, 0x22, 0x81, 0xB0, 0xBC, 0xBD, 0xBC, 0xBD, 0xCB, 0xBA, 0xAB, 0xA9, 0x0A, 0x01,
+  0x62, 0x33, 0x35, 0x44, 0x43, 0x32, 0x23, 0x33, 0x12, 0x80, 0xBB, 0xFB, 0xDA, 0xBB, 0xBC, 0xAC,
+  0xAB, 0xAC, 0xA8, 0x09, 0x00, 0x22, 0x35, 0x44, 0x43, 0x24, 0x33, 0x24, 0x23, 0x12, 0x91, 0x99,
+  0xEB, 0xCB, 0xBC, 0xBC, 0xAC, 0xCB, 0x9A, 0xAA, 0x99, 0x80, 0x10, 0x34, 0x63, 0x43, 0x53, 0x32,
+  0x33, 0x24, 0x22, 0x01, 0x98, 0xBA, 0xCD, 0xBC, 0xBC, 0xBC, 0xAC, 0xBA, 0x9B, 0x9A, 0x8A, 0x11,
+  0x42, 0x26, 0x43, 0x34, 0x34, 0x33, 0x53, 0x12, 0x12, 0x81, 0x98, 0xD9, 0xBC, 0xDB, 0xAC, 0xCA,
+  0x9B, 0xAB, 0xAA, 0x89, 0x08, 0x11, 0x44, 0x44, 0x43, 0x24, 0x43, 0x32, 0x33, 0x14, 0x02, 0x80,
+  0x99, 0xCB, 0xCD, 0xBA, 0xCC, 0xBA, 0xBB, 0xBA, 0xE4, 0xF6, 0x29, 0x00, 0xAB, 0x98, 0x19, 0x05,
+  0x63, 0x33, 0x34, 0x25, 0x33, 0x24, 0x33, 0x22, 0x11, 0x90, 0xBB, 0xFB, 0xAD, 0xCA, 0xCB, 0xBA,
+  0x9C, 0xBA, 0x99, 0x99, 0x10, 0x30, 0x43, 0x36, 0x43, 0x43, 0x14, 0x32, 0x23, 0x42, 0x81, 0x01,
+  0xB9, 0xAB, 0xCF, 0xAB, 0xDC, 0xA9, 0xCB, 0x99, 0xAB, 0x98, 0x0A, 0x81, 0x41, 0x33, 0x45, 0x33,
+  0x63, 0x22, 0x23, 0x33, 0x23, 0x11, 0x83, 0x99, 0xBE, 0xDA, 0xAD, 0xCB, 0xBB, 0xAC, 0xBB, 0xBA,
+  0x8A, 0x9A, 0x21, 0x24, 0x64, 0x32, 0x34, 0x43, 0x34, 0x41, 0x23, 0x31, 0x02, 0x31, 0xA8, 0xAB,
+  0xFB, 0xBC, 0xCB, 0xBC, 0xCB, 0xAB, 0xC9, 0x89, 0x98, 0x28, 0x11, 0x35, 0x34, 0x45, 0x31, 0x33,
+  0x33, 0x35, 0x12, 0x32, 0x80, 0x81, 0xAC, 0xDB, 0xAC, 0xDB, 0xBC, 0xC9, 0xAC, 0x99, 0x9A, 0xA8,
+  0x29, 0x80, 0x63, 0x21, 0x42, 0x25, 0x32, 0x23, 0x43, 0x04, 0x31, 0x01, 0x1D, 0x07, 0x21, 0x00,
+  0x81, 0xCA, 0xA9, 0xAF, 0xC9, 0xAC, 0x9B, 0xCD, 0x98, 0xBA, 0x98, 0x89, 0x08, 0x18, 0x16, 0x20,
+  0x25, 0x31, 0x15, 0x31, 0x23, 0x12, 0x14, 0x28, 0xA2, 0xAB, 0xF0, 0x0E, 0xB9, 0xAB, 0xBC, 0xBB,
+  0xBA, 0x9C, 0xD0, 0x29, 0xA2, 0x33, 0x32, 0x37, 0x51, 0x22, 0x23, 0x14, 0x34, 0x00, 0x23, 0x80,
+  0x90, 0x9A, 0x9C, 0xDD, 0x9B, 0xFA, 0xA9, 0xAA, 0x09, 0xAC, 0x01, 0x8A, 0x16, 0x28, 0x15, 0x32,
+  0x25, 0x41, 0x02, 0x32, 0x21, 0x13, 0x91, 0xC2, 0x8B, 0xBC, 0xE9, 0xAC, 0xBB, 0xDB, 0x8C, 0xAA,
+  0xAA, 0x91, 0x2A, 0x39, 0x62, 0x03, 0x45, 0x33, 0x42, 0x82, 0x44, 0x10, 0x11, 0x80, 0x01, 0xAF,
+  0xA0, 0xD9, 0x90, 0x9F, 0xB0, 0x0B, 0xCA, 0x89, 0xA9, 0x8B, 0x83, 0x0A, 0x03, 0x68, 0x16, 0x32,
+  0x83, 0x72, 0x82, 0x21, 0x91, 0x60, 0xB9, 0x01, 0xCC, 0xA4, 0x8E, 0xA1, 0x8A, 0xB1, 0x1E, 0xD1,
+  0x36, 0xF9, 0x2F, 0x00, 0x18, 0xA8, 0x42, 0x9C, 0x84, 0x39, 0x82, 0x20, 0x21, 0x50, 0xB2, 0x72,
+  0x99, 0x86, 0x3A, 0xA0, 0x08, 0x90, 0x19, 0xBB, 0x09, 0xCF, 0x10, 0x8C, 0x88, 0x19, 0x89, 0x40,
+  0x88, 0x13, 0x38, 0x06, 0x33, 0x28, 0x35, 0x85, 0x14, 0x23, 0x20, 0x12, 0x2C, 0x90, 0xAA, 0xF8,
+  0xBB, 0x9F, 0xEA, 0xA9, 0xAB, 0x9A, 0xAB, 0x88, 0x20, 0x24, 0x76, 0x12, 0x15, 0x21, 0x14, 0x10,
+  0x82, 0x19, 0xD8, 0x0A, 0xCC, 0xD1, 0x9B, 0xB9, 0xAC, 0xCA, 0x98, 0x9B, 0x08, 0x70, 0x14, 0x52,
+  0x12, 0x24, 0x21, 0x02, 0x01, 0xBA, 0xAB, 0xBB, 0xAF, 0xC2, 0x0B, 0xBB, 0xBC, 0xEC, 0x89, 0x9C,
+  0x98, 0x28, 0x24, 0x36, 0x43, 0x33, 0x22, 0x12, 0x90, 0xB9, 0xCC, 0xAB, 0x0C, 0xCA, 0xA4, 0x1A,
+  0xB9, 0xBD, 0xDC, 0xA8, 0x0B, 0x99, 0x52, 0x34, 0x36, 0x42, 0x12, 0x21, 0x88, 0xA8, 0xAC, 0xCC,
+  0xA8, 0x2A, 0x9A, 0x97, 0x79, 0x00, 0x3D, 0x00, 0x28, 0x99, 0x9A, 0xBE, 0xC0, 0x0A, 0x89, 0x41,
+  0x53, 0x44, 0x22, 0x23, 0x10, 0xB1, 0xA9, 0xAF, 0xB9, 0x8B, 0x09, 0xA0, 0x07, 0x49, 0x89, 0xA9,
+  0xBC, 0xBA, 0x8D, 0x89, 0x31, 0x64, 0x43, 0x32, 0x23, 0x01, 0xA0, 0xCA, 0xAD, 0xBB, 0xA9, 0x19,
+  0xB2, 0x37, 0x3A, 0xB1, 0xE0, 0xAC, 0xAB, 0xAB, 0x9A, 0x03, 0x66, 0x42, 0x32, 0x22, 0x01, 0xA0,
+  0xAA, 0xAE, 0xCA, 0x89, 0x88, 0x12, 0x79, 0x91, 0xA4, 0x89, 0xAD, 0xBA, 0xAB, 0xB9, 0x32, 0x70,
+  0x26, 0x33, 0x31, 0x82, 0x80, 0xAB, 0xFB, 0xA9, 0x0B, 0x89, 0x40, 0x08, 0x87, 0x30, 0x8C, 0xD9,
+  0xA9, 0x9B, 0x9A, 0x39, 0x21, 0x47, 0x43, 0x31, 0x02, 0x81, 0xA9, 0xDA, 0x9B, 0x9D, 0xA0, 0x02,
+  0x68, 0x49, 0xA1, 0x93, 0x0B, 0xAF, 0xB9, 0xA9, 0x98, 0x21, 0x71, 0x43, 0x23, 0x23, 0x01, 0x98,
+  0xAB, 0xCD, 0xB9, 0x0B, 0x1A, 0x02, 0x17, 0x79, 0x60, 0x19, 0x45, 0x00, 0x98, 0xB2, 0x89, 0x9F,
+  0xA9, 0x88, 0x89, 0x02, 0x73, 0x31, 0x14, 0x12, 0x80, 0x98, 0x9B, 0xCC, 0xB8, 0x19, 0x1A, 0x94,
+  0x16, 0x6A, 0x99, 0xC2, 0x89, 0x9D, 0xA9, 0x88, 0x88, 0x23, 0x73, 0x32, 0x05, 0x12, 0x88, 0xA8,
+  0x9B, 0xDB, 0xA8, 0x1A, 0x29, 0x84, 0x63, 0x4B, 0xE2, 0x81, 0x0C, 0xBB, 0xA8, 0x89, 0x91, 0x53,
+  0x70, 0x11, 0x04, 0x11, 0x88, 0x98, 0xAA, 0xCA, 0x89, 0x1B, 0x91, 0x07, 0x40, 0x98, 0xA5, 0x3A,
+  0x9E, 0xC8, 0x89, 0x8A, 0x81, 0x40, 0x31, 0x16, 0x32, 0x20, 0x91, 0x98, 0xCB, 0xAA, 0x8D, 0xA9,
+  0x03, 0x68, 0x00, 0x85, 0x6A, 0xAA, 0xD2, 0x09, 0x8D, 0x98, 0x18, 0x08, 0x04, 0x52, 0x30, 0x83,
+  0x12, 0x0A, 0xBA, 0xAC, 0xBB, 0xA9, 0x28, 0x30, 0x16, 0x51, 0xC1, 0x85, 0x2E, 0xBB, 0xD1, 0x89,
+  0x8A, 0x82, 0x40, 0x21, 0x16, 0x41, 0x18, 0x91, 0x88, 0x9C, 0xB9, 0xA9, 0x1E, 0xF6, 0x3C, 0x00,
+  0x98, 0x21, 0x51, 0x02, 0x34, 0x1C, 0xF4, 0x08, 0x0E, 0xC8, 0x80, 0x2A, 0x88, 0x23, 0x50, 0x12,
+  0x14, 0x28, 0xC0, 0x91, 0x0D, 0xAA, 0x90, 0x2A, 0x81, 0x34, 0x38, 0x95, 0x7A, 0xAB, 0xE3, 0x19,
+  0x9D, 0xB1, 0x20, 0x29, 0x83, 0x44, 0x30, 0x93, 0x21, 0x9B, 0xE8, 0x99, 0x9B, 0x98, 0x20, 0x13,
+  0x54, 0x00, 0x84, 0x3D, 0xF9, 0x90, 0x1D, 0xAA, 0xA2, 0x59, 0x08, 0x13, 0x51, 0x01, 0x02, 0x19,
+  0xD8, 0xA0, 0x0C, 0xAA, 0x01, 0x59, 0x81, 0x05, 0x39, 0xC1, 0x59, 0x9D, 0xD2, 0x19, 0x8C, 0xB2,
+  0x31, 0x3A, 0x84, 0x42, 0x10, 0x82, 0x19, 0xDB, 0xA0, 0x1C, 0xAA, 0x94, 0x50, 0x08, 0x94, 0x20,
+  0x99, 0x5B, 0xFB, 0xA2, 0x2C, 0xAB, 0x94, 0x49, 0x88, 0x05, 0x38, 0x91, 0x03, 0x2B, 0xD9, 0x90,
+  0x0C, 0xA0, 0x12, 0x59, 0x81, 0x12, 0x08, 0x01, 0x9F, 0xF5, 0x28, 0x8C, 0xC2, 0x38, 0x0B, 0x94,
+  0xA5, 0xE4, 0x48, 0x00, 0x40, 0x88, 0x03, 0x28, 0xB8, 0x82, 0x0E, 0xB8, 0x01, 0x3A, 0x91, 0x15,
+  0x28, 0x90, 0x80, 0xF1, 0x48, 0x8F, 0xD2, 0x28, 0x8C, 0x93, 0x49, 0x88, 0x03, 0x38, 0x81, 0x00,
+  0x8A, 0xB9, 0x8B, 0xAA, 0x22, 0x30, 0x17, 0x50, 0x98, 0xA3, 0x5C, 0x9E, 0xC5, 0x39, 0xCB, 0x93,
+  0x4B, 0xA0, 0x13, 0x28, 0x02, 0x12, 0x80, 0x88, 0xDA, 0x99, 0x8B, 0x92, 0x70, 0x00, 0x84, 0x10,
+  0x19, 0xD8, 0xC2, 0x7B, 0xBC, 0x84, 0x1E, 0xA0, 0x11, 0x19, 0x82, 0x12, 0x30, 0x00, 0x90, 0x09,
+  0xCD, 0x81, 0x0A, 0x02, 0x22, 0x22, 0x48, 0xD0, 0x02, 0x2F, 0xBA, 0xA7, 0x2E, 0xD1, 0x18, 0x88,
+  0x08, 0x02, 0x39, 0x84, 0x30, 0x08, 0xA9, 0x92, 0x9F, 0xA3, 0x2A, 0x03, 0x00, 0x14, 0x1B, 0xA3,
+  0x9B, 0x95, 0x2F, 0xF1, 0x2A, 0xC9, 0x19, 0x91, 0x49, 0x93, 0x58, 0x03, 0x08, 0x12, 0x9E, 0x91,
+  0x0C, 0x91, 0x28, 0x12, 0xD4, 0x08, 0x3A, 0x00, 0x00, 0x84, 0x3B, 0xC3, 0x19, 0x29, 0xF9, 0x0D,
+  0xC8, 0xAC, 0x20, 0x98, 0x72, 0x91, 0x41, 0x82, 0x09, 0x01, 0xBD, 0x11, 0xBA, 0x31, 0x03, 0x2A,
+  0x07, 0x0B, 0x13, 0x9C, 0x93, 0x48, 0xFD, 0x10, 0xDB, 0x09, 0x11, 0x89, 0x26, 0x09, 0x22, 0xA2,
+  0x1C, 0xA2, 0x8E, 0x02, 0xA8, 0x41, 0x91, 0x29, 0x92, 0x0A, 0x12, 0x3B, 0xD0, 0x32, 0xFF, 0x00,
+  0xBC, 0x19, 0x04, 0x89, 0x26, 0x98, 0x31, 0xA1, 0x8C, 0x04, 0xAC, 0x23, 0xB9, 0x28, 0x95, 0x0C,
+  0x12, 0x88, 0x28, 0x13, 0xBC, 0x33, 0xEF, 0x18, 0xC9, 0x19, 0x23, 0xA8, 0x63, 0x91, 0x29, 0x03,
+  0xBB, 0x41, 0xC0, 0x29, 0xB1, 0xAC, 0x11, 0xEB, 0x48, 0x03, 0x19, 0x42, 0xA2, 0x0C, 0xC0, 0x9C,
+  0xD9, 0x18, 0x00, 0x13, 0x30, 0x05, 0x19, 0x23, 0x9A, 0x38, 0x86, 0x8D, 0x84, 0xAE, 0x00, 0xDB,
+  0x19, 0x14, 0x88, 0x32, 0x03, 0xA9, 0x00, 0xFB, 0x2A, 0xFB, 0x3D, 0x00, 0x8A, 0x99, 0x20, 0x30,
+  0x12, 0x43, 0x82, 0x28, 0x14, 0x99, 0x72, 0xE0, 0x30, 0xFA, 0x0A, 0xD9, 0x9A, 0x41, 0x02, 0x29,
+  0x24, 0x80, 0x89, 0x80, 0xBD, 0x18, 0x82, 0x39, 0x16, 0x89, 0x13, 0xAA, 0x41, 0x12, 0x89, 0x07,
+  0x8C, 0xA3, 0xCF, 0x98, 0xBA, 0x1A, 0x37, 0x90, 0x40, 0x01, 0xA0, 0x0A, 0xB3, 0x8F, 0x13, 0x89,
+  0x12, 0x01, 0xA8, 0x28, 0xA0, 0x41, 0x14, 0x28, 0xF8, 0x28, 0xF9, 0x8E, 0x89, 0xA9, 0x68, 0x04,
+  0x89, 0x22, 0x08, 0xBA, 0x48, 0xD0, 0x29, 0x83, 0x09, 0x22, 0xA0, 0x9C, 0x23, 0x9A, 0x45, 0xA0,
+  0x10, 0xAD, 0x03, 0xFF, 0x08, 0xA8, 0x19, 0x34, 0x92, 0x2B, 0x06, 0xAA, 0x10, 0x88, 0x98, 0x50,
+  0x91, 0x1B, 0x14, 0xBC, 0x30, 0x90, 0x40, 0x03, 0x80, 0xFA, 0x49, 0xF1, 0x0D, 0x81, 0x9C, 0x32,
+  0x13, 0xAA, 0x72, 0xB0, 0x1A, 0x02, 0x8A, 0x30, 0x02, 0x9D, 0x41, 0xB8, 0x13, 0x01, 0x3C, 0x00,
+  0x0A, 0x22, 0x98, 0x72, 0x91, 0x09, 0xBA, 0x63, 0xEE, 0x38, 0xD8, 0x39, 0x03, 0x80, 0x09, 0x14,
+  0xAD, 0x41, 0xA8, 0x38, 0x81, 0x98, 0x1B, 0x04, 0xAC, 0x32, 0x98, 0x21, 0x31, 0xD0, 0x9B, 0x31,
+  0xF8, 0x9F, 0xA3, 0x8F, 0x43, 0x90, 0x09, 0x11, 0xC8, 0x39, 0x94, 0x0A, 0x14, 0xB9, 0x89, 0x22,
+  0xBA, 0x60, 0xA1, 0x29, 0x02, 0xA0, 0x0A, 0xC9, 0x22, 0xFF, 0x39, 0xFB, 0x40, 0x82, 0x89, 0x00,
+  0x91, 0x0C, 0x15, 0x9A, 0x32, 0xB8, 0x8A, 0x20, 0xA0, 0x59, 0x93, 0x0C, 0x03, 0x89, 0x08, 0xB8,
+  0x30, 0xFF, 0x3C, 0xF8, 0x38, 0x84, 0x89, 0x00, 0x80, 0x0B, 0x26, 0xAA, 0x42, 0xB9, 0x09, 0x10,
+  0xA0, 0x58, 0xA3, 0x8C, 0x14, 0x9A, 0x21, 0xB8, 0x09, 0xFB, 0x2D, 0xE0, 0x49, 0x85, 0x89, 0x00,
+  0x98, 0x19, 0x24, 0xAA, 0x43, 0xD9, 0x19, 0x80, 0x00, 0x20, 0x92, 0x9C, 0x22, 0xA8, 0x60, 0xD0,
+  0xE5, 0x05, 0x41, 0x00, 0x28, 0xFC, 0x20, 0xC9, 0x40, 0x02, 0x89, 0x09, 0xA1, 0x3C, 0x16, 0x8B,
+  0x13, 0xBB, 0x18, 0x80, 0x00, 0x43, 0xB9, 0x1A, 0x10, 0xB9, 0x74, 0xF8, 0x30, 0xCD, 0x21, 0xDA,
+  0x41, 0x81, 0x88, 0x19, 0xA0, 0x5B, 0x85, 0x0A, 0x02, 0xBA, 0x18, 0x01, 0x0A, 0x16, 0xAA, 0x18,
+  0x81, 0x9A, 0x37, 0xCC, 0x22, 0xAF, 0x21, 0xBB, 0x62, 0x81, 0x98, 0x18, 0xB0, 0x69, 0x83, 0x8A,
+  0x03, 0xBC, 0x38, 0x92, 0x2B, 0x17, 0xAB, 0x18, 0x82, 0x9A, 0x47, 0xBC, 0x13, 0xBE, 0x32, 0xBB,
+  0x62, 0x81, 0xA8, 0x18, 0xB0, 0x78, 0x93, 0x8A, 0x02, 0xCB, 0x30, 0x92, 0x2B, 0x06, 0xBB, 0x20,
+  0x82, 0x0D, 0x17, 0xAC, 0x03, 0xAE, 0x22, 0xAA, 0x43, 0x81, 0xAA, 0x10, 0xB8, 0x70, 0x93, 0x0A,
+  0x82, 0xBC, 0x40, 0xA2, 0x4A, 0x93, 0x9C, 0x00, 0x01, 0x1B, 0x37, 0x9F, 0x82, 0x9D, 0x12, 0x9A,
+  0x52, 0x81, 0xAA, 0x10, 0x47, 0xF9, 0x44, 0x00, 0xB8, 0x72, 0x92, 0x0A, 0x92, 0xAC, 0x31, 0xA1,
+  0x49, 0x94, 0x9C, 0x11, 0xB0, 0x58, 0x95, 0x0E, 0xB2, 0x0D, 0x83, 0x0B, 0x34, 0xA0, 0x8B, 0x83,
+  0x8C, 0x36, 0xB8, 0x38, 0xB0, 0x8E, 0x23, 0xAA, 0x43, 0xB0, 0x0B, 0x13, 0xBC, 0x74, 0xC8, 0x38,
+  0xF9, 0x28, 0xA0, 0x38, 0x12, 0xA9, 0x19, 0xA0, 0x59, 0x05, 0x8A, 0x11, 0xCA, 0x29, 0x93, 0x1C,
+  0x16, 0xAB, 0x21, 0xA8, 0x1B, 0x27, 0xAC, 0x03, 0xAF, 0x21, 0x9A, 0x52, 0x81, 0x9A, 0x10, 0xBA,
+  0x54, 0xA1, 0x18, 0x91, 0xAC, 0x22, 0xB8, 0x70, 0x91, 0x0B, 0x01, 0xAA, 0x71, 0xB1, 0x3A, 0xF1,
+  0x1D, 0xA2, 0x1A, 0x25, 0x99, 0x08, 0xA0, 0x2A, 0x16, 0x99, 0x13, 0xCB, 0x18, 0x80, 0x1A, 0x34,
+  0xBA, 0x30, 0xCA, 0x19, 0x35, 0xBC, 0x04, 0xDF, 0x11, 0xA9, 0x42, 0x82, 0xA9, 0x21, 0xCB, 0x63,
+  0xA0, 0x20, 0xA1, 0x9B, 0x11, 0xC9, 0x61, 0xA1, 0x74, 0x07, 0x42, 0x00, 0x19, 0xA2, 0x8B, 0x53,
+  0xCA, 0x42, 0xDD, 0x10, 0xB9, 0x50, 0x02, 0x98, 0x10, 0xB9, 0x60, 0x81, 0x18, 0x03, 0xBC, 0x20,
+  0xD9, 0x30, 0x82, 0x09, 0x02, 0xCC, 0x52, 0xCA, 0x13, 0xBE, 0x11, 0xAC, 0x41, 0x03, 0x89, 0x83,
+  0x9D, 0x43, 0x99, 0x42, 0xA1, 0x8B, 0x02, 0x9F, 0x32, 0xA8, 0x30, 0xB1, 0x1D, 0xA3, 0x1D, 0xD2,
+  0x0D, 0xA1, 0x0B, 0x44, 0x91, 0x18, 0xB1, 0x3B, 0x05, 0x0A, 0x34, 0xC9, 0x28, 0xD0, 0x1A, 0x04,
+  0x0A, 0x23, 0xBC, 0x22, 0xCC, 0x02, 0xAF, 0x00, 0xAA, 0x51, 0x03, 0x09, 0x83, 0x9C, 0x34, 0xA9,
+  0x52, 0xA1, 0x2B, 0xB2, 0x0E, 0x12, 0x98, 0x52, 0xB9, 0x21, 0xAD, 0xB2, 0x9F, 0xA0, 0x8A, 0x51,
+  0x03, 0x39, 0xA2, 0x2C, 0x13, 0x89, 0x54, 0xB0, 0x59, 0xC0, 0x19, 0x81, 0x08, 0x14, 0x9B, 0xA3,
+  0x0D, 0xFA, 0x8A, 0xC9, 0x08, 0x34, 0x81, 0x41, 0xB8, 0x30, 0x93, 0x3A, 0x63, 0x05, 0x35, 0x00,
+  0x27, 0x9A, 0x13, 0xAC, 0x10, 0x90, 0x40, 0xA1, 0xB0, 0x2C, 0xFA, 0x8F, 0xA8, 0x9B, 0x44, 0x88,
+  0x32, 0xA0, 0x39, 0x03, 0x0B, 0x27, 0x89, 0x31, 0xC8, 0x2A, 0xB2, 0x2A, 0x02, 0xFA, 0x10, 0xDE,
+  0x89, 0xB9, 0x0C, 0x15, 0x08, 0x23, 0x98, 0x40, 0x91, 0x28, 0x04, 0x09, 0x23, 0xB9, 0x28, 0xC1,
+  0x1B, 0xA5, 0x0F, 0xB1, 0xAF, 0x98, 0xBC, 0x30, 0x83, 0x41, 0x04, 0x09, 0x14, 0x98, 0x42, 0x91,
+  0x48, 0x92, 0x0B, 0x03, 0xBC, 0x23, 0xAF, 0xA0, 0xCC, 0xAA, 0xEB, 0x18, 0x22, 0x11, 0x35, 0x88,
+  0x32, 0x91, 0x58, 0x02, 0x29, 0x05, 0x99, 0x10, 0xCA, 0x00, 0x9C, 0xCC, 0xCB, 0xAC, 0xAB, 0x38,
+  0x43, 0x33, 0x33, 0x21, 0x34, 0x02, 0x62, 0x01, 0x11, 0x33, 0xA9, 0xA8, 0xA0, 0xFF, 0xA0, 0xAE,
+  0xAA, 0xDB, 0x29, 0x12, 0x21, 0x34, 0x90, 0x52, 0x81, 0x38, 0x14, 0x09, 0x34, 0xB0, 0x18, 0xB0,
+  0x22, 0x10, 0x2D, 0x00, 0xCF, 0xA1, 0xAF, 0x99, 0xCA, 0x19, 0x22, 0x10, 0x44, 0x80, 0x31, 0x82,
+  0x28, 0x14, 0x19, 0x53, 0x90, 0x08, 0xC1, 0x9F, 0xB8, 0xAE, 0xA9, 0xCA, 0x28, 0x13, 0x21, 0x44,
+  0x88, 0x42, 0x82, 0x39, 0x15, 0x09, 0x32, 0xC2, 0x1A, 0xF8, 0xAB, 0xA9, 0xBE, 0xA9, 0x99, 0x30,
+  0x25, 0x31, 0x23, 0x02, 0x63, 0x81, 0x31, 0x12, 0x00, 0x14, 0xBA, 0xC9, 0xBD, 0xBE, 0xCB, 0xBB,
+  0x9B, 0x22, 0x34, 0x43, 0x24, 0x12, 0x42, 0x11, 0x20, 0x33, 0x01, 0x31, 0xD0, 0xFB, 0xBA, 0xBF,
+  0xBA, 0xCB, 0x09, 0x22, 0x31, 0x35, 0x13, 0x22, 0x23, 0x10, 0x32, 0x34, 0x21, 0x13, 0xDB, 0xBE,
+  0xBE, 0xAE, 0xBA, 0xAA, 0x18, 0x22, 0x33, 0x55, 0x12, 0x11, 0x12, 0x00, 0x31, 0x04, 0x28, 0xA1,
+  0xEC, 0xBB, 0xBF, 0xBB, 0xAB, 0x0A, 0x21, 0x43, 0x53, 0x33, 0x33, 0x32, 0x21, 0x22, 0x33, 0x23,
+  0xD9, 0xCB, 0xCF, 0xBC, 0x74, 0xFB, 0x32, 0x00, 0xBB, 0xAD, 0x09, 0x10, 0x30, 0x44, 0x32, 0x33,
+  0x33, 0x22, 0x42, 0x22, 0x02, 0x99, 0xEB, 0xCD, 0xBC, 0xBC, 0xAB, 0x0A, 0x00, 0x32, 0x73, 0x32,
+  0x33, 0x34, 0x23, 0x31, 0x33, 0x88, 0xAA, 0xFC, 0xBC, 0xBC, 0xCB, 0x9B, 0x89, 0x08, 0x32, 0x25,
+  0x43, 0x34, 0x33, 0x23, 0x34, 0x01, 0x98, 0xDA, 0xCD, 0xCA, 0xBB, 0xBB, 0x9A, 0x09, 0x20, 0x25,
+  0x42, 0x34, 0x33, 0x44, 0x22, 0x12, 0x80, 0xBA, 0xFC, 0xBA, 0xAC, 0xBB, 0xA9, 0x8A, 0x21, 0x33,
+  0x44, 0x53, 0x33, 0x43, 0x33, 0x22, 0x11, 0xAA, 0xDD, 0xDB, 0xBB, 0xBC, 0x8A, 0x99, 0x18, 0x43,
+  0x23, 0x44, 0x34, 0x22, 0x43, 0x23, 0x80, 0xA0, 0xDB, 0xBD, 0xBC, 0xCB, 0xAB, 0x89, 0x80, 0x32,
+  0x44, 0x32, 0x35, 0x33, 0x31, 0x24, 0x81, 0xB8, 0xDA, 0xCC, 0xAC, 0xBC, 0xAA, 0x9A, 0x08, 0x30,
+  0x33, 0x44, 0x35, 0x22, 0x33, 0x02, 0x31, 0xD8, 0x71, 0x03, 0x22, 0x00, 0xBB, 0xBE, 0xCB, 0xBC,
+  0xAA, 0xAB, 0x08, 0x21, 0x23, 0x64, 0x33, 0x33, 0x53, 0x03, 0x38, 0xC1, 0xC9, 0xAB, 0xDC, 0xAB,
+  0xCA, 0x98, 0x2A, 0x21, 0x32, 0x35, 0x35, 0x31, 0x23, 0x33, 0x81, 0x08, 0xCC, 0xDB, 0xAA, 0xBC,
+  0x8B, 0x08, 0x88, 0x63, 0x41, 0x43, 0x22, 0x24, 0x20, 0x83, 0x08, 0xD0, 0x0B, 0xBC, 0xCB, 0x80,
+  0x8E, 0x80, 0x50, 0x80, 0x23, 0x40, 0x82, 0x08, 0x08, 0x08, 0x18, 0xFB, 0x1C, 0xEA, 0x80, 0x80,
+  0x80, 0x80, 0x90, 0x74, 0x08, 0x08, 0x08, 0x80, 0x80, 0xAF, 0x80, 0x00, 0x9E, 0x80, 0x08, 0x08,
+  0x38, 0x07, 0x08, 0x08, 0x08, 0x08, 0x80, 0x18, 0xEF, 0x80, 0x80, 0x80, 0x00, 0x88, 0x37, 0x09,
+  0x80, 0x28, 0x17, 0xC8, 0x1A, 0x88, 0x80, 0x80, 0x00, 0x08, 0x88, 0xA1, 0x74, 0x85, 0x80, 0x80,
+  0x80, 0x90, 0x75, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0xB1, 0x00, 0x10, 0x00,
+  0x08, 0x80, 0x80, 0x80, 0x80, 0x90, 0x92, 0xFF, 0xAF, 0x80, 0x80, 0xF0, 0x0B, 0x08, 0x08, 0x08,
+  0xFA, 0x1B, 0x88, 0x80, 0x80, 0x80, 0xB1, 0xEF, 0x91, 0x08, 0x80, 0x80, 0x80, 0x80, 0x90, 0xC2,
+  0xDF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x39, 0x57, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xA1, 0x77,
+  0x08, 0x81, 0x08, 0x08, 0x80, 0x08, 0x90, 0x67, 0x80, 0x80, 0x80, 0x08, 0x08, 0x37, 0x08, 0x08,
+  0x08, 0x08, 0x69, 0x06, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x88,
+  0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7B, 0xFF, 0x0D, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA0, 0xF5, 0xFF, 0x09, 0x08, 0x90,
+  0x02, 0x8A, 0x57, 0x08, 0x08, 0x08, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // one
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xBF, 0x87, 0xED, 0x89, 0x80, 0x20, 0x1A, 0xA6,
+  0x7A, 0xA1, 0x08, 0x8B, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80,
+  0x08, 0x08, 0x18, 0x7F, 0x77, 0x82, 0x1B, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x91, 0x7A, 0xFF, 0x9F, 0x08, 0x08, 0x08, 0x98, 0x67,
+  0x88, 0x32, 0x80, 0x00, 0x08, 0x08, 0x08, 0x29, 0xFC, 0xCB, 0x0C, 0xAC, 0x00, 0x88, 0x71, 0x31,
+  0x43, 0x43, 0x32, 0x14, 0x48, 0x81, 0xC0, 0xAA, 0xCD, 0xBB, 0xAD, 0xBB, 0xBB, 0xBB, 0x08, 0x28,
+  0x57, 0x44, 0x43, 0x22, 0x22, 0x12, 0x00, 0xB8, 0xDB, 0xBD, 0xBD, 0xCB, 0xAC, 0xCB, 0xAA, 0x9A,
+  0x18, 0x44, 0x35, 0x35, 0x32, 0x33, 0x22, 0x21, 0xA9, 0xDB, 0xCC, 0xBC, 0xCB, 0xCB, 0xAA, 0x9B,
+  0x99, 0x20, 0x42, 0x54, 0xFD, 0xEE, 0x35, 0x00, 0x53, 0x33, 0x43, 0x12, 0x11, 0x88, 0xA9, 0xBB,
+  0xCC, 0xBC, 0xBB, 0xAC, 0xAB, 0xBA, 0xBA, 0x99, 0x18, 0x44, 0x55, 0x34, 0x34, 0x34, 0x22, 0x11,
+  0x80, 0x98, 0xBA, 0xBD, 0xBD, 0xBC, 0xBB, 0xBA, 0xAA, 0x9B, 0x9A, 0x20, 0x53, 0x45, 0x53, 0x33,
+  0x35, 0x32, 0x33, 0x22, 0x80, 0xAA, 0xBD, 0xCC, 0xCB, 0xDB, 0xBA, 0xBA, 0xAA, 0xAB, 0x99, 0x09,
+  0x32, 0x46, 0x43, 0x34, 0x34, 0x34, 0x24, 0x32, 0x11, 0x88, 0xBA, 0xBC, 0xDC, 0xCB, 0xCB, 0xBB,
+  0xBA, 0xAA, 0xAA, 0x99, 0x28, 0x44, 0x44, 0x34, 0x43, 0x34, 0x43, 0x33, 0x22, 0x01, 0x98, 0xCA,
+  0xCC, 0xDB, 0xCB, 0xAB, 0xBB, 0xAB, 0xAA, 0x9A, 0x09, 0x32, 0x55, 0x53, 0x43, 0x33, 0x43, 0x43,
+  0x23, 0x23, 0x01, 0xA8, 0xBC, 0xCD, 0xCB, 0xCB, 0xBB, 0xBB, 0xAB, 0xBA, 0x99, 0x89, 0x32, 0x34,
+  0x46, 0x33, 0x25, 0x43, 0x33, 0x53, 0x23, 0x12, 0x9D, 0x16, 0x2F, 0x00, 0x80, 0xB8, 0xDC, 0xCB,
+  0xBC, 0xBC, 0xAB, 0xAC, 0xA9, 0x99, 0x89, 0x00, 0x21, 0x34, 0x73, 0x43, 0x33, 0x43, 0x33, 0x44,
+  0x32, 0x12, 0x81, 0xAA, 0xDC, 0xBC, 0xBC, 0xCB, 0xCA, 0xA9, 0xA9, 0x98, 0x80, 0x00, 0x32, 0x34,
+  0x35, 0x35, 0x34, 0x33, 0x53, 0x32, 0x34, 0x32, 0x01, 0xA9, 0xDC, 0xBC, 0xBC, 0xCB, 0xBB, 0xAB,
+  0xAA, 0x98, 0x99, 0x18, 0x32, 0x44, 0x43, 0x35, 0x25, 0x33, 0x34, 0x34, 0x43, 0x23, 0x02, 0xB0,
+  0xCC, 0xCC, 0xCB, 0xBB, 0xCB, 0xBA, 0x9A, 0x89, 0x99, 0x89, 0x20, 0x32, 0x45, 0x24, 0x44, 0x43,
+  0x32, 0x34, 0x34, 0x43, 0x02, 0x90, 0xBB, 0xCE, 0xBA, 0xBC, 0xBB, 0xBB, 0xAB, 0x98, 0x99, 0x98,
+  0x1A, 0x23, 0x65, 0x43, 0x43, 0x33, 0x35, 0x53, 0x42, 0x32, 0x22, 0x80, 0xCA, 0xDB, 0xAC, 0xBC,
+  0xBB, 0xAC, 0x9A, 0x89, 0x80, 0x99, 0x88, 0x20, 0x52, 0x44, 0x34, 0x34, 0x37, 0x00, 0x31, 0x00,
+  0x33, 0x44, 0x43, 0x33, 0x33, 0x90, 0xCB, 0xBD, 0xBD, 0xCA, 0xBC, 0xAA, 0x99, 0x88, 0x88, 0xA9,
+  0xA9, 0x28, 0x44, 0x34, 0x43, 0x42, 0x53, 0x43, 0x24, 0x24, 0x12, 0x80, 0xB9, 0xBE, 0xBB, 0xAD,
+  0xBB, 0xCB, 0x99, 0x08, 0x88, 0x99, 0xBB, 0x99, 0x51, 0x55, 0x22, 0x22, 0x42, 0x45, 0x24, 0x33,
+  0x22, 0x91, 0xC9, 0xBD, 0xBB, 0xBB, 0xCB, 0xCB, 0x9A, 0x10, 0x01, 0xA8, 0xCD, 0x9A, 0x30, 0x54,
+  0x22, 0x01, 0x08, 0x64, 0x45, 0x33, 0x12, 0x90, 0xA9, 0xCB, 0xBC, 0xAA, 0xAB, 0xA9, 0x9A, 0x88,
+  0x80, 0xCA, 0xBF, 0xAC, 0x89, 0x31, 0x25, 0x11, 0x88, 0x73, 0x37, 0x25, 0x12, 0xA8, 0xBA, 0x9A,
+  0x80, 0xA9, 0xCC, 0xBA, 0x99, 0x00, 0x80, 0xCC, 0xBC, 0xAA, 0x09, 0x21, 0x13, 0x01, 0x28, 0x74,
+  0x67, 0x43, 0x22, 0x81, 0xBB, 0xAC, 0x08, 0x02, 0xD9, 0xBC, 0x9A, 0x20, 0x12, 0xA8, 0xBE, 0x9A,
+  0x5C, 0xE5, 0x37, 0x00, 0x28, 0x12, 0x80, 0x99, 0x08, 0x54, 0x64, 0x34, 0x34, 0x33, 0x90, 0xCD,
+  0x9B, 0x10, 0x12, 0xDA, 0xBC, 0x8B, 0x31, 0x12, 0xC9, 0xBD, 0x89, 0x20, 0x13, 0xA0, 0xAB, 0x1A,
+  0x56, 0x36, 0x24, 0x22, 0x11, 0xB8, 0xAF, 0x8A, 0x21, 0x92, 0xEC, 0xAB, 0x18, 0x33, 0x91, 0xDC,
+  0x9A, 0x28, 0x33, 0xA0, 0xCC, 0x1A, 0x63, 0x33, 0x12, 0x32, 0x45, 0x02, 0xFA, 0xAB, 0x38, 0x33,
+  0xE8, 0xCC, 0x09, 0x32, 0x02, 0xDA, 0x9A, 0x28, 0x14, 0xA0, 0xBB, 0x19, 0x53, 0x12, 0x20, 0x63,
+  0x43, 0x23, 0xC9, 0xBE, 0x18, 0x34, 0xB1, 0xBF, 0x0A, 0x32, 0x02, 0xCB, 0x9B, 0x41, 0x03, 0xC9,
+  0x9A, 0x31, 0x23, 0xB9, 0x29, 0x67, 0x23, 0x00, 0xA8, 0xCA, 0x8A, 0x43, 0x93, 0xED, 0xAA, 0x21,
+  0x13, 0xB9, 0x9C, 0x10, 0x13, 0xB9, 0x9C, 0x32, 0x83, 0xCD, 0x3A, 0x47, 0x13, 0x88, 0x28, 0x13,
+  0xFC, 0x8A, 0x53, 0x90, 0x6C, 0x25, 0x46, 0x00, 0xCC, 0x0A, 0x23, 0x91, 0xAC, 0x28, 0x21, 0xA8,
+  0x9B, 0x30, 0x02, 0xBA, 0x9A, 0x62, 0x37, 0x23, 0x00, 0x50, 0x92, 0xDE, 0x09, 0x34, 0xB0, 0xBE,
+  0x19, 0x33, 0xA8, 0x9D, 0x21, 0x82, 0xA9, 0x0A, 0x22, 0x90, 0xAA, 0x20, 0x22, 0x57, 0x43, 0x08,
+  0x20, 0x85, 0xFB, 0x8A, 0x34, 0xB2, 0xBF, 0x29, 0x22, 0xB0, 0xAB, 0x42, 0x92, 0xAB, 0x38, 0x13,
+  0xAA, 0x0B, 0x42, 0xB8, 0x70, 0x37, 0x90, 0x19, 0x24, 0xDA, 0x8C, 0x43, 0xA2, 0xBE, 0x19, 0x23,
+  0xB8, 0x9B, 0x32, 0xA1, 0xAC, 0x22, 0x82, 0x9A, 0x28, 0x84, 0xBB, 0x71, 0x37, 0xA1, 0x00, 0x43,
+  0xD9, 0xAC, 0x43, 0x82, 0xBD, 0x0B, 0x22, 0xA1, 0xAB, 0x28, 0x92, 0xBA, 0x20, 0x31, 0x30, 0x81,
+  0x80, 0x29, 0x71, 0x57, 0x14, 0x99, 0x4A, 0x83, 0xED, 0x29, 0x23, 0xD9, 0x9C, 0x20, 0x82, 0xA9,
+  0x09, 0x81, 0x99, 0x18, 0x08, 0x73, 0x03, 0x9A, 0x5D, 0xF5, 0x3C, 0x00, 0x20, 0x00, 0x71, 0x34,
+  0xD2, 0xAB, 0x44, 0xB0, 0xAE, 0x31, 0x83, 0xBD, 0x19, 0x02, 0x98, 0x09, 0x80, 0xAA, 0x38, 0xB3,
+  0x59, 0x57, 0x90, 0x09, 0x81, 0x19, 0x36, 0x91, 0xBD, 0x38, 0x05, 0xDB, 0x1A, 0x23, 0xC0, 0x9B,
+  0x11, 0x98, 0x19, 0x81, 0xCA, 0x8A, 0x24, 0x09, 0x74, 0x03, 0x88, 0x82, 0xAC, 0x72, 0x85, 0xBB,
+  0x29, 0x12, 0xC9, 0x8B, 0x32, 0xA8, 0x0B, 0x98, 0xAC, 0x42, 0xA1, 0xAD, 0x89, 0x39, 0xB3, 0x73,
+  0x27, 0x09, 0x20, 0xD0, 0x1A, 0x37, 0xB9, 0x9C, 0x22, 0xA8, 0x89, 0x10, 0x99, 0x88, 0xA0, 0x99,
+  0x19, 0x04, 0xFA, 0x8C, 0x88, 0x31, 0x38, 0x75, 0x81, 0x10, 0x83, 0xAE, 0x71, 0x82, 0xBC, 0x28,
+  0x01, 0xAA, 0x20, 0x88, 0x09, 0x99, 0x0A, 0x84, 0x8A, 0x11, 0xDD, 0x8A, 0x21, 0x92, 0x71, 0x17,
+  0x89, 0x41, 0xB8, 0x1C, 0x36, 0xC9, 0x0B, 0x11, 0xA8, 0x08, 0x81, 0x09, 0xAC, 0xFF, 0x3E, 0x00,
+  0xA0, 0xAC, 0x43, 0xA8, 0x28, 0xD3, 0xAD, 0x21, 0x18, 0x2A, 0x65, 0xA3, 0x29, 0x13, 0xAE, 0x51,
+  0x94, 0xBA, 0x1A, 0x80, 0x90, 0x88, 0x88, 0x18, 0xB9, 0x9F, 0x34, 0xB0, 0x2C, 0x92, 0xAF, 0x21,
+  0xC2, 0x39, 0x27, 0x9A, 0x42, 0xC1, 0x1C, 0x24, 0xB8, 0x8A, 0xA1, 0x89, 0x11, 0xCA, 0x31, 0xC0,
+  0x8B, 0x21, 0x80, 0x01, 0xB1, 0xBF, 0x18, 0x28, 0x1D, 0x64, 0xA3, 0x39, 0x24, 0xDC, 0x40, 0x84,
+  0xAB, 0x00, 0xA9, 0x28, 0xA0, 0x1C, 0x04, 0xAC, 0x28, 0x92, 0x0A, 0x15, 0xD9, 0x0A, 0x88, 0x82,
+  0x41, 0x35, 0x89, 0x53, 0xC1, 0x1D, 0x34, 0xB9, 0x09, 0xD8, 0x19, 0x83, 0xAC, 0x23, 0xE9, 0x29,
+  0x92, 0x0A, 0x14, 0xAA, 0x08, 0xDA, 0x40, 0x18, 0x71, 0x91, 0x38, 0x84, 0xAD, 0x53, 0xA1, 0x8A,
+  0xA0, 0x9B, 0x24, 0xCB, 0x30, 0xE1, 0x1A, 0x02, 0x0C, 0x23, 0xC9, 0x18, 0xB9, 0x0A, 0x86, 0x18,
+  0xCB, 0xF3, 0x3D, 0x00, 0x44, 0x89, 0x63, 0xC0, 0x2B, 0x24, 0xA9, 0x88, 0xDA, 0x29, 0x01, 0xAB,
+  0x22, 0xEA, 0x28, 0x90, 0x29, 0x14, 0xAD, 0x00, 0xBC, 0x60, 0x90, 0x50, 0x92, 0x39, 0x06, 0xAC,
+  0x43, 0xA0, 0x19, 0xC8, 0x1B, 0x03, 0x9C, 0x21, 0xDA, 0x38, 0xC1, 0x29, 0x03, 0x9C, 0x02, 0xCD,
+  0x20, 0x81, 0x49, 0x15, 0x8A, 0x35, 0xB9, 0x49, 0x84, 0x89, 0xA1, 0xAD, 0x21, 0xA8, 0x18, 0xB9,
+  0x0B, 0x91, 0x09, 0x16, 0x19, 0xBA, 0xDA, 0x1A, 0x29, 0x44, 0x15, 0x82, 0x73, 0xA2, 0x0A, 0x24,
+  0x08, 0xA0, 0xDD, 0x08, 0x08, 0x00, 0xBB, 0x2A, 0xF0, 0x18, 0x82, 0x5A, 0xB1, 0xAA, 0x99, 0xA8,
+  0x70, 0x24, 0x18, 0x52, 0x93, 0x8A, 0x31, 0x20, 0x03, 0xEF, 0x0A, 0x98, 0x28, 0xC0, 0x8A, 0xC2,
+  0x29, 0x28, 0x39, 0x80, 0xBB, 0xAF, 0x01, 0x8D, 0x73, 0x92, 0x40, 0x04, 0x0A, 0x20, 0x98, 0x22,
+  0xF8, 0x8B, 0x98, 0x0A, 0x45, 0xFA, 0x39, 0x00, 0x91, 0xBB, 0x18, 0xAA, 0x20, 0x14, 0x49, 0xB8,
+  0xBD, 0x98, 0x3A, 0x79, 0x16, 0x01, 0x55, 0x90, 0x20, 0xA1, 0x18, 0xB1, 0x9E, 0x98, 0x9A, 0x88,
+  0xA9, 0x8A, 0x98, 0x08, 0x42, 0x80, 0x00, 0x99, 0xFA, 0x09, 0x89, 0x35, 0x51, 0x46, 0x22, 0x33,
+  0x14, 0x80, 0x01, 0xEB, 0xAA, 0xCB, 0xAB, 0xBA, 0x9C, 0x99, 0x0A, 0x12, 0x11, 0x22, 0x01, 0xAD,
+  0x82, 0x0E, 0x26, 0x21, 0x47, 0x12, 0x32, 0x03, 0x00, 0xB2, 0xBF, 0xAA, 0xBD, 0x99, 0xCA, 0x89,
+  0xA9, 0x18, 0x01, 0x31, 0x93, 0x89, 0xBA, 0xA8, 0x78, 0x25, 0x72, 0x25, 0x22, 0x24, 0x01, 0x10,
+  0xE8, 0xAB, 0xBB, 0xAD, 0x9A, 0xBB, 0x8A, 0x9A, 0x28, 0x22, 0x22, 0x03, 0xA8, 0x4A, 0xE0, 0x73,
+  0x03, 0x65, 0x22, 0x41, 0x03, 0x10, 0x81, 0xCC, 0xAA, 0xBC, 0xAC, 0xA9, 0xAB, 0x98, 0x89, 0x31,
+  0x12, 0x52, 0x81, 0x19, 0x83, 0x5B, 0x26, 0x42, 0x2F, 0xFE, 0x32, 0x00, 0x37, 0x21, 0x33, 0x02,
+  0x10, 0xC8, 0xAD, 0xBC, 0xCB, 0xAA, 0xBA, 0x8A, 0x99, 0x00, 0x22, 0x31, 0x04, 0x88, 0x10, 0xCB,
+  0x47, 0x20, 0x47, 0x22, 0x33, 0x12, 0x10, 0x91, 0xBE, 0xCB, 0xBC, 0xAB, 0xBB, 0xAB, 0x89, 0x99,
+  0x21, 0x01, 0x32, 0xB1, 0x21, 0xC9, 0x77, 0x12, 0x46, 0x22, 0x42, 0x12, 0x10, 0x90, 0xCC, 0xBA,
+  0xDC, 0x9A, 0xB9, 0x9A, 0x98, 0x88, 0x10, 0x18, 0x31, 0xB1, 0x60, 0xA0, 0x65, 0x12, 0x45, 0x23,
+  0x42, 0x02, 0x01, 0xA1, 0xBD, 0xCA, 0xBC, 0xBA, 0xBB, 0xAA, 0x99, 0x99, 0x01, 0x18, 0x21, 0x01,
+  0x43, 0x71, 0x26, 0x63, 0x43, 0x22, 0x23, 0x11, 0x81, 0xC9, 0xBD, 0xDB, 0xCB, 0x9A, 0xAB, 0x8A,
+  0xA9, 0x09, 0x81, 0x29, 0x12, 0x28, 0x21, 0x67, 0x32, 0x45, 0x33, 0x33, 0x22, 0x13, 0x98, 0xBE,
+  0xBC, 0xCC, 0xAB, 0xBB, 0xAA, 0xA9, 0x99, 0x90, 0x19, 0x01, 0x28, 0x82, 0x7B, 0xEC, 0x22, 0x00,
+  0x74, 0x27, 0x53, 0x33, 0x24, 0x33, 0x11, 0x02, 0xDA, 0xBB, 0xDC, 0xBB, 0xBA, 0xBB, 0x9A, 0xAB,
+  0x0A, 0xA0, 0x20, 0x38, 0x81, 0x76, 0x24, 0x64, 0x23, 0x33, 0x33, 0x21, 0x03, 0xEA, 0xBA, 0xDC,
+  0xAB, 0xBA, 0xAC, 0x99, 0xAA, 0x88, 0x98, 0x00, 0x21, 0x01, 0x47, 0x32, 0x47, 0x22, 0x33, 0x14,
+  0x11, 0x11, 0xCB, 0xBB, 0xCD, 0xAB, 0xCB, 0x9B, 0xAA, 0xAA, 0x98, 0x89, 0x81, 0x22, 0x58, 0x36,
+  0x53, 0x36, 0x22, 0x43, 0x11, 0x12, 0x90, 0xBB, 0xCD, 0xCB, 0xBB, 0xBB, 0xAC, 0xA9, 0xAA, 0x80,
+  0x09, 0x21, 0x21, 0x57, 0x23, 0x45, 0x33, 0x43, 0x13, 0x11, 0x02, 0xCB, 0xBB, 0xCE, 0xAB, 0xBA,
+  0xAC, 0xA9, 0x9B, 0x09, 0x89, 0x20, 0x82, 0x65, 0x33, 0x45, 0x33, 0x43, 0x33, 0x11, 0x01, 0xC9,
+  0xBC, 0xCC, 0xCB, 0xAB, 0xCB, 0xA9, 0xA9, 0x0A, 0x98, 0x28, 0x12, 0x54, 0x25, 0x44, 0x42, 0x32,
+  0x1F, 0x0E, 0x35, 0x00, 0x22, 0x12, 0x01, 0xD9, 0xBB, 0xCD, 0xBB, 0xCB, 0xAB, 0xAA, 0xAA, 0x88,
+  0x80, 0x32, 0x41, 0x37, 0x33, 0x36, 0x24, 0x32, 0x23, 0x11, 0x92, 0xCB, 0xDB, 0xCC, 0xAB, 0xCB,
+  0xAB, 0xAA, 0xAA, 0x08, 0x18, 0x32, 0x55, 0x24, 0x44, 0x33, 0x43, 0x23, 0x22, 0x02, 0x9A, 0xDB,
+  0xCC, 0xBB, 0xBC, 0xCB, 0xBA, 0xA9, 0xAA, 0x10, 0x08, 0x53, 0x44, 0x53, 0x34, 0x33, 0x43, 0x22,
+  0x11, 0x90, 0xCA, 0xDB, 0xBC, 0xAC, 0xCB, 0xBA, 0xAA, 0xBA, 0x08, 0x09, 0x34, 0x63, 0x44, 0x33,
+  0x53, 0x32, 0x22, 0x11, 0x88, 0xAB, 0xCE, 0xBB, 0xBC, 0xCB, 0xBA, 0xBA, 0x9A, 0x89, 0x28, 0x35,
+  0x44, 0x44, 0x43, 0x42, 0x22, 0x21, 0x01, 0xA9, 0xBA, 0xCE, 0xBA, 0xCB, 0xBB, 0xAB, 0xBB, 0x99,
+  0x08, 0x63, 0x33, 0x55, 0x43, 0x32, 0x33, 0x23, 0x13, 0xA8, 0xCA, 0xDC, 0xAC, 0xBB, 0xCB, 0xAB,
+  0xBA, 0x9A, 0x88, 0x31, 0x88, 0xF0, 0x28, 0x00, 0x27, 0x43, 0x44, 0x32, 0x42, 0x22, 0x11, 0x81,
+  0xCB, 0xCA, 0xCC, 0xAB, 0xBC, 0xBB, 0xBA, 0x9B, 0x99, 0x31, 0x35, 0x35, 0x36, 0x32, 0x43, 0x23,
+  0x11, 0x81, 0xAB, 0xCC, 0xBD, 0xCB, 0xBB, 0xAC, 0xBA, 0x8B, 0x18, 0x11, 0x45, 0x43, 0x44, 0x23,
+  0x33, 0x23, 0x82, 0x00, 0xCA, 0xCC, 0xDB, 0xAC, 0xBA, 0xBB, 0xA9, 0x8A, 0x10, 0x43, 0x46, 0x33,
+  0x44, 0x33, 0x22, 0x22, 0x90, 0x89, 0xDC, 0xBB, 0xCC, 0xBA, 0xBB, 0xAC, 0x98, 0x08, 0x32, 0x54,
+  0x43, 0x34, 0x43, 0x22, 0x12, 0x02, 0x9A, 0xDA, 0xBC, 0xCB, 0xBC, 0xAC, 0xAA, 0x9A, 0x08, 0x21,
+  0x44, 0x44, 0x43, 0x32, 0x23, 0x11, 0x01, 0xAA, 0xEB, 0xBC, 0xBC, 0xCB, 0xAB, 0xBB, 0x09, 0x18,
+  0x34, 0x45, 0x43, 0x33, 0x43, 0x13, 0x11, 0x98, 0xCB, 0xCB, 0xBD, 0xBB, 0xBD, 0xAA, 0x99, 0x08,
+  0x22, 0x54, 0x25, 0x43, 0x32, 0x23, 0x11, 0x80, 0x8E, 0x0C, 0x29, 0x00, 0xBA, 0xEB, 0xBC, 0xCB,
+  0xBB, 0xCB, 0x99, 0x89, 0x30, 0x44, 0x43, 0x35, 0x32, 0x24, 0x02, 0x01, 0xA9, 0xCB, 0xBC, 0xBD,
+  0xBB, 0xAC, 0xBA, 0x89, 0x80, 0x52, 0x43, 0x34, 0x34, 0x32, 0x23, 0x21, 0xAA, 0xDC, 0xCB, 0xCB,
+  0xCB, 0xBA, 0xAB, 0x99, 0x19, 0x33, 0x36, 0x34, 0x34, 0x33, 0x13, 0x31, 0xC8, 0xDA, 0xBA, 0xCD,
+  0xBA, 0xBA, 0x8C, 0xA9, 0x18, 0x53, 0x22, 0x54, 0x23, 0x32, 0x13, 0x12, 0x8B, 0xC0, 0xBD, 0xBA,
+  0xBD, 0xAB, 0x8A, 0xAB, 0x15, 0x22, 0x54, 0x33, 0x43, 0x23, 0x04, 0x28, 0xC2, 0xA9, 0x9A, 0xBD,
+  0xB9, 0xCA, 0x09, 0x80, 0x80, 0x54, 0x23, 0x73, 0x11, 0x82, 0x23, 0x08, 0xAD, 0xB1, 0xAB, 0xAD,
+  0x0B, 0xEA, 0x08, 0x80, 0x60, 0x80, 0x14, 0x38, 0x81, 0x80, 0x80, 0xC1, 0x0E, 0xBB, 0xC1, 0x0B,
+  0x80, 0x08, 0x80, 0x90, 0x75, 0x80, 0x18, 0x15, 0x08, 0xD9, 0x09, 0xB0, 0x77, 0xFF, 0x20, 0x00,
+  0x0C, 0x08, 0xEB, 0x41, 0x80, 0x80, 0x43, 0x88, 0x00, 0x25, 0x88, 0xB1, 0x0F, 0x08, 0x08, 0x88,
+  0x00, 0x88, 0x80, 0x90, 0x67, 0x80, 0x90, 0x61, 0x80, 0xA1, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0xA0, 0xF6, 0xFF, 0x80, 0x00, 0x88, 0x80,
+  0x00, 0x88, 0x80, 0xF2, 0x8F, 0x00, 0x88, 0x00, 0xBD, 0x00, 0x08, 0x08, 0x08, 0xF0, 0x0C, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x20, 0xFF, 0x8B, 0x80, 0x90, 0x73, 0x83, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x18, 0x7C, 0x77, 0x08, 0x08, 0x88, 0x00, 0x79, 0x02,
+  0x08, 0x08, 0x88, 0x64, 0x80, 0x80, 0x80, 0x80, 0x80, 0x78, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x01, 0x00, 0x00, 0x00, 0x10, 0x09, 0xF3, 0xFF, 0x9F, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0xA0, 0xF7, 0x3F, 0x5B, 0x08,
+  0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // two
+  0x70, 0xFF, 0x00, 0x00, 0xF0, 0x71, 0x37, 0x00, 0x08, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80,
+  0x80, 0xA0, 0xB5, 0xFF, 0xDF, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08,
+  0x08, 0x08, 0xB0, 0x57, 0x90, 0x0E, 0x80, 0x79, 0xD4, 0x48, 0xA0, 0x79, 0xA0, 0x99, 0x80, 0x00,
+  0x39, 0x15, 0x02, 0x08, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x10, 0x3A, 0xFC, 0xFF, 0x8E, 0x21, 0x3B, 0x00, 0x88, 0x50, 0x2A, 0x79, 0x3C, 0x80, 0xC0, 0xA5,
+  0x30, 0x4D, 0xF7, 0x87, 0x4F, 0x88, 0x19, 0x88, 0x88, 0x1A, 0x31, 0x99, 0x80, 0x99, 0x34, 0x89,
+  0x28, 0x1A, 0x2A, 0x0B, 0x90, 0x0E, 0x20, 0xC0, 0x83, 0xD0, 0xA5, 0xA2, 0x92, 0xC2, 0xA2, 0x01,
+  0x3C, 0x2C, 0x3C, 0x2B, 0x08, 0xA9, 0xB3, 0x92, 0x3B, 0xF0, 0xC1, 0xA3, 0x28, 0xB9, 0xB5, 0xA3,
+  0x41, 0x0F, 0xA1, 0x10, 0xC7, 0xFC, 0x29, 0x00, 0x99, 0x83, 0x0A, 0xA8, 0xF0, 0xA6, 0x00, 0xB2,
+  0xA4, 0xC6, 0x92, 0xC2, 0x82, 0x19, 0x59, 0x2C, 0x08, 0x3A, 0x19, 0x0A, 0xD7, 0x82, 0x18, 0x1A,
+  0x91, 0x00, 0x80, 0x79, 0x89, 0x29, 0x08, 0x7A, 0xB8, 0xB4, 0xA3, 0x10, 0x39, 0x6C, 0xA8, 0xC3,
+  0xC4, 0x82, 0xD2, 0xA3, 0x91, 0x82, 0x80, 0xA1, 0x01, 0x2B, 0xF3, 0xA4, 0x21, 0x3F, 0xA9, 0xA3,
+  0xC4, 0x12, 0x9A, 0x38, 0x1B, 0x69, 0x0C, 0x20, 0x2D, 0x81, 0x2C, 0xA1, 0x6D, 0x09, 0x19, 0xC0,
+  0x21, 0x9A, 0x83, 0xA9, 0x53, 0x2F, 0xA8, 0x92, 0xC2, 0xB4, 0xB2, 0xA4, 0x28, 0x0B, 0xA3, 0x90,
+  0x28, 0xAA, 0xE7, 0xA3, 0xC2, 0xA4, 0xB2, 0x82, 0x08, 0x90, 0x00, 0x7A, 0x2D, 0x88, 0x10, 0x3B,
+  0x4C, 0x0B, 0x02, 0x4E, 0x1A, 0x09, 0xD3, 0x20, 0x0A, 0xB2, 0xC7, 0x11, 0xA9, 0xA6, 0xC2, 0xA4,
+  0x80, 0xD3, 0x01, 0xA0, 0x02, 0xB8, 0x04, 0x3B, 0xB3, 0x01, 0x39, 0x00, 0xB0, 0x10, 0x00, 0x7C,
+  0x8A, 0x01, 0x4C, 0x3A, 0x2B, 0x09, 0x49, 0x9A, 0x94, 0xA1, 0x81, 0xC8, 0xA7, 0x00, 0xA1, 0x80,
+  0xD7, 0x11, 0x19, 0x89, 0x00, 0x18, 0x18, 0x1C, 0xD2, 0x31, 0x1E, 0x91, 0xA0, 0x94, 0x5A, 0xB9,
+  0xA4, 0x91, 0x02, 0x0C, 0xC4, 0x21, 0x0B, 0x91, 0xA8, 0x96, 0x5C, 0x99, 0x30, 0x0C, 0x02, 0x2D,
+  0xA0, 0x10, 0xC0, 0x12, 0x1C, 0x91, 0x80, 0xC2, 0x11, 0x89, 0x28, 0xD0, 0x21, 0x3D, 0x89, 0x29,
+  0x2C, 0xA8, 0xA5, 0xD4, 0x12, 0x1C, 0xC2, 0x82, 0x98, 0xA1, 0xB5, 0xC4, 0xA4, 0x00, 0xC1, 0x82,
+  0xC1, 0x21, 0xB9, 0x85, 0x5A, 0x8A, 0xA2, 0xA2, 0x28, 0x19, 0xF3, 0x93, 0x39, 0x0A, 0xD6, 0x11,
+  0x09, 0x3A, 0xA9, 0x96, 0x28, 0x0A, 0x90, 0x90, 0x71, 0x0C, 0xA2, 0x10, 0x90, 0x30, 0x8C, 0xA4,
+  0x18, 0xA8, 0x83, 0x1D, 0xA3, 0x78, 0x8A, 0x81, 0x3B, 0x98, 0x7A, 0x99, 0x40, 0x01, 0x31, 0x00,
+  0x31, 0x0E, 0x11, 0x0C, 0xB3, 0x10, 0xA0, 0x90, 0xB4, 0x58, 0xA8, 0x38, 0x8F, 0x94, 0x4D, 0xA8,
+  0x11, 0x99, 0x11, 0xA9, 0x41, 0xAC, 0x31, 0xFA, 0x14, 0x1C, 0xA1, 0x08, 0x82, 0x3D, 0x89, 0xB0,
+  0x85, 0x4D, 0xB1, 0x10, 0xC8, 0x13, 0x8C, 0xB5, 0x28, 0xA8, 0x83, 0x1B, 0xF3, 0x32, 0x0D, 0xA2,
+  0x29, 0xA1, 0x48, 0x99, 0x90, 0x13, 0x2E, 0xB0, 0x11, 0xA0, 0x78, 0xB9, 0x04, 0x09, 0x82, 0x1C,
+  0xD3, 0x41, 0x0D, 0xB3, 0x10, 0x90, 0x49, 0xD8, 0x94, 0x39, 0x09, 0xA2, 0x92, 0x69, 0x0C, 0x92,
+  0x80, 0x02, 0x3F, 0xC0, 0x03, 0x2B, 0x28, 0x8D, 0x95, 0x2A, 0x90, 0x29, 0x80, 0x18, 0xE4, 0x48,
+  0x8B, 0x02, 0xC8, 0x83, 0x5E, 0x8A, 0xA3, 0x18, 0x2A, 0x2B, 0xF3, 0x12, 0x3E, 0xA8, 0x92, 0x91,
+  0x39, 0x0C, 0xD3, 0x11, 0x3B, 0x89, 0x91, 0x98, 0x92, 0x4C, 0xA9, 0x93, 0xA8, 0x03, 0x3D, 0xA0,
+  0x91, 0xFD, 0x27, 0x00, 0xB0, 0xD5, 0x50, 0x1D, 0xB2, 0x38, 0x8A, 0x18, 0xF2, 0x03, 0x2D, 0xB1,
+  0x01, 0xA8, 0x02, 0x9A, 0x03, 0x1C, 0xA6, 0x49, 0x99, 0x01, 0xC1, 0x21, 0x9B, 0x07, 0x3A, 0xB1,
+  0x42, 0xB8, 0x23, 0x0F, 0xF2, 0x39, 0xAB, 0x94, 0x2A, 0x91, 0x38, 0x10, 0x20, 0x05, 0x70, 0x81,
+  0x05, 0x49, 0xA0, 0x01, 0x8B, 0xD1, 0x0D, 0xDA, 0x88, 0x9C, 0xB0, 0x1A, 0xB8, 0x63, 0x48, 0x16,
+  0x52, 0x21, 0x03, 0x12, 0x09, 0xCB, 0xDB, 0xAC, 0xCB, 0x9A, 0x9B, 0x98, 0x89, 0x20, 0x99, 0x17,
+  0x70, 0x12, 0x35, 0x31, 0x13, 0x31, 0xC8, 0xB9, 0xAF, 0xCA, 0x99, 0x9B, 0x90, 0x29, 0x99, 0xA2,
+  0x0A, 0xB9, 0x4A, 0x11, 0x77, 0x43, 0x23, 0x43, 0x20, 0xA1, 0xC9, 0xBC, 0xCC, 0xAA, 0x99, 0x89,
+  0x00, 0x10, 0x81, 0x91, 0x1E, 0xCA, 0x84, 0x68, 0x22, 0x26, 0x32, 0x12, 0x02, 0xA9, 0xEB, 0xBC,
+  0xCA, 0x9A, 0x8A, 0x90, 0x34, 0xDB, 0x3B, 0x00, 0x20, 0x11, 0x82, 0x08, 0x0B, 0x9B, 0x25, 0x72,
+  0x27, 0x43, 0x22, 0x03, 0x00, 0xCA, 0xEB, 0xAB, 0xBB, 0xAA, 0x89, 0x00, 0x31, 0x21, 0xA2, 0x00,
+  0x8F, 0xB9, 0x14, 0x70, 0x34, 0x44, 0x22, 0x12, 0x10, 0xCA, 0xDB, 0xAC, 0xAB, 0xAB, 0x98, 0x28,
+  0x18, 0x84, 0x01, 0x1A, 0x9D, 0xD1, 0x31, 0x58, 0x35, 0x44, 0x22, 0x32, 0x08, 0xC8, 0xBC, 0xAD,
+  0xBB, 0xBB, 0xA8, 0x39, 0x18, 0x05, 0x30, 0xA9, 0xE3, 0x19, 0x0B, 0x05, 0x73, 0x32, 0x24, 0x31,
+  0x82, 0x90, 0xBD, 0xFB, 0xAA, 0xAA, 0xA8, 0x80, 0x20, 0x11, 0x13, 0x80, 0x0A, 0xCD, 0xA1, 0x69,
+  0x30, 0x37, 0x42, 0x22, 0x23, 0x08, 0xD8, 0xBB, 0xAE, 0xBB, 0xA9, 0x99, 0x18, 0x11, 0x22, 0x83,
+  0x18, 0x1F, 0xDA, 0x82, 0x69, 0x21, 0x17, 0x32, 0x12, 0x12, 0xA0, 0xD8, 0xAC, 0xBC, 0xBA, 0xA9,
+  0x88, 0x00, 0x22, 0x22, 0xA3, 0x81, 0x8F, 0xBA, 0x20, 0xE8, 0x34, 0x00, 0x81, 0x70, 0x53, 0x34,
+  0x43, 0x32, 0x11, 0x90, 0xDB, 0xAD, 0xBC, 0xAA, 0xAA, 0x88, 0x18, 0x03, 0x32, 0x90, 0x81, 0x9F,
+  0xD0, 0x29, 0x00, 0x47, 0x41, 0x23, 0x43, 0x10, 0xA1, 0xBA, 0xAF, 0xCB, 0xB9, 0x8A, 0x8A, 0x00,
+  0x40, 0x10, 0x02, 0x88, 0xE0, 0x08, 0x0C, 0x94, 0x72, 0x22, 0x24, 0x32, 0x12, 0x00, 0xEA, 0xC9,
+  0xAC, 0xCA, 0x99, 0x99, 0x00, 0x20, 0x11, 0x03, 0x11, 0x3C, 0xF9, 0x92, 0x4C, 0x91, 0x27, 0x30,
+  0x03, 0x33, 0x00, 0x98, 0xBD, 0xEB, 0xAB, 0xCA, 0x98, 0x1A, 0x91, 0x42, 0x29, 0xB3, 0x02, 0x2D,
+  0xCA, 0x94, 0x79, 0x10, 0x16, 0x30, 0x02, 0x03, 0x08, 0xCA, 0xCB, 0xBC, 0xBB, 0xAA, 0x99, 0x18,
+  0x02, 0x63, 0x29, 0xC2, 0x01, 0x1F, 0xB8, 0x84, 0x58, 0x21, 0x15, 0x32, 0x12, 0x82, 0xA8, 0xBC,
+  0xBE, 0xCB, 0xAA, 0x8A, 0x89, 0x00, 0x23, 0x30, 0x81, 0xC2, 0x4A, 0x8F, 0xC6, 0xE8, 0x3A, 0x00,
+  0xB1, 0x43, 0x58, 0x14, 0x24, 0x32, 0x21, 0xA0, 0xC8, 0xBD, 0xBC, 0xCB, 0xB9, 0x09, 0x19, 0x02,
+  0x24, 0x30, 0xB1, 0xA4, 0x3E, 0xBC, 0xA4, 0x68, 0x29, 0x05, 0x32, 0x40, 0x81, 0x82, 0x9A, 0xBC,
+  0xEB, 0xAA, 0x9A, 0x8A, 0x88, 0x12, 0x31, 0x11, 0xA5, 0x38, 0xBC, 0xB4, 0x4C, 0x90, 0x25, 0x52,
+  0x32, 0x33, 0x14, 0x20, 0xAA, 0xF9, 0xAB, 0xAD, 0xAA, 0x9A, 0x88, 0x18, 0x01, 0x24, 0x5A, 0xC0,
+  0x03, 0x0D, 0xA1, 0x48, 0x10, 0x44, 0x41, 0x23, 0x33, 0x11, 0x88, 0xEB, 0xDA, 0xAC, 0xCA, 0x99,
+  0x8A, 0x90, 0x20, 0x11, 0x03, 0x21, 0x9A, 0xB1, 0x2D, 0x9A, 0x36, 0x61, 0x34, 0x25, 0x32, 0x12,
+  0x92, 0x98, 0xAF, 0xCC, 0xAA, 0x8C, 0xAA, 0x90, 0x00, 0x20, 0x11, 0x83, 0x20, 0xAB, 0xD6, 0x48,
+  0x1B, 0x87, 0x41, 0x21, 0x13, 0x22, 0x11, 0x88, 0xEB, 0xDA, 0xAB, 0xAC, 0xAA, 0x89, 0x19, 0x18,
+  0x9E, 0xE6, 0x33, 0x00, 0x83, 0x43, 0x19, 0xA4, 0x4A, 0xB9, 0x04, 0x78, 0x21, 0x25, 0x43, 0x22,
+  0x12, 0x02, 0x8B, 0xFC, 0xB9, 0xAC, 0xAB, 0xAA, 0x89, 0x29, 0x02, 0x15, 0x31, 0x18, 0xD3, 0x20,
+  0x0E, 0xA2, 0x42, 0x50, 0x33, 0x25, 0x32, 0x21, 0xA2, 0xA8, 0xBF, 0xEB, 0xAA, 0xAB, 0xA9, 0x09,
+  0x80, 0x43, 0x30, 0x93, 0x22, 0xBB, 0xA4, 0x1F, 0x91, 0x42, 0x43, 0x64, 0x11, 0x14, 0x10, 0x90,
+  0xB9, 0xBD, 0xBC, 0xDB, 0x9A, 0x99, 0x08, 0x10, 0x13, 0x31, 0x12, 0x1A, 0xC8, 0xA0, 0x2D, 0x18,
+  0x26, 0x46, 0x32, 0x24, 0x13, 0x21, 0x99, 0xFB, 0xCA, 0xAC, 0xBB, 0xA9, 0x9A, 0x18, 0x10, 0x15,
+  0x40, 0x80, 0x02, 0x1B, 0xD0, 0x01, 0x38, 0x54, 0x24, 0x26, 0x31, 0x13, 0x02, 0x99, 0xDC, 0xDA,
+  0xAB, 0xAC, 0xA9, 0x99, 0x38, 0x28, 0x04, 0x42, 0x18, 0x81, 0x08, 0xA8, 0x20, 0x13, 0x77, 0x32,
+  0x34, 0x32, 0x13, 0x81, 0x8C, 0x23, 0x31, 0x00, 0xC9, 0xDC, 0xCB, 0xAC, 0xBB, 0xA9, 0x89, 0x10,
+  0x42, 0x41, 0x22, 0x01, 0x82, 0x09, 0xAC, 0x90, 0x50, 0x72, 0x14, 0x34, 0x32, 0x23, 0x80, 0xB9,
+  0xBF, 0xCC, 0xBB, 0xAC, 0xA9, 0x89, 0x01, 0x32, 0x23, 0x44, 0x00, 0x81, 0xBA, 0x90, 0x0F, 0x82,
+  0x63, 0x42, 0x33, 0x15, 0x32, 0x88, 0xC8, 0xDB, 0xAC, 0xBC, 0xBA, 0x9A, 0x09, 0x00, 0x23, 0x24,
+  0x32, 0x82, 0x20, 0xAC, 0xB0, 0x28, 0x70, 0x27, 0x43, 0x42, 0x13, 0x13, 0x08, 0xEB, 0xCA, 0xAC,
+  0xAC, 0xB9, 0x99, 0x08, 0x11, 0x31, 0x23, 0x13, 0x20, 0xC1, 0x09, 0x80, 0x71, 0x36, 0x63, 0x23,
+  0x34, 0x12, 0x00, 0xB9, 0xCD, 0xDB, 0xAB, 0xBB, 0x9A, 0x89, 0x21, 0x31, 0x15, 0x21, 0x80, 0x89,
+  0xB9, 0x88, 0x51, 0x74, 0x34, 0x34, 0x33, 0x14, 0x81, 0xA8, 0xBE, 0xBC, 0xCC, 0x9A, 0xAA, 0x08,
+  0x00, 0x31, 0x03, 0x33, 0x80, 0x0A, 0xF8, 0x09, 0xA2, 0xF6, 0x2D, 0x00, 0x18, 0x52, 0x36, 0x44,
+  0x22, 0x23, 0x11, 0x99, 0xEC, 0xBB, 0xCC, 0xAA, 0xAA, 0x89, 0x00, 0x31, 0x22, 0x23, 0x11, 0x99,
+  0xF8, 0x89, 0x09, 0x44, 0x63, 0x44, 0x32, 0x32, 0x02, 0x80, 0xCC, 0xDB, 0xAC, 0xAC, 0xA9, 0x98,
+  0x00, 0x21, 0x12, 0x32, 0x01, 0x98, 0xD9, 0x98, 0x2A, 0x44, 0x45, 0x36, 0x32, 0x24, 0x02, 0x81,
+  0xCA, 0xDB, 0xBC, 0xBB, 0xAB, 0x8A, 0x09, 0x41, 0x21, 0x22, 0x02, 0x2A, 0xF9, 0x88, 0x1A, 0x43,
+  0x26, 0x55, 0x22, 0x32, 0x12, 0x08, 0xCA, 0xCC, 0xDB, 0xAA, 0xAB, 0x9A, 0x08, 0x18, 0x22, 0x01,
+  0x04, 0x89, 0xB0, 0x89, 0x5A, 0x53, 0x45, 0x44, 0x33, 0x33, 0x22, 0x80, 0xEA, 0xBC, 0xBC, 0xAC,
+  0xAB, 0x99, 0x09, 0x18, 0x21, 0x11, 0x01, 0x10, 0xBB, 0xC2, 0x51, 0x73, 0x53, 0x26, 0x22, 0x33,
+  0x21, 0x80, 0xCB, 0xCC, 0xBC, 0xBA, 0xAC, 0x89, 0x89, 0x18, 0x11, 0x81, 0x3C, 0xF7, 0x29, 0x00,
+  0x01, 0xAA, 0x11, 0x8E, 0x34, 0x34, 0x57, 0x22, 0x43, 0x12, 0x01, 0x98, 0xBC, 0xEB, 0xBB, 0xBA,
+  0xAB, 0xA9, 0x09, 0x18, 0x01, 0x08, 0xAA, 0xA0, 0x9F, 0x41, 0x32, 0x67, 0x13, 0x34, 0x22, 0x21,
+  0x81, 0xBC, 0xDB, 0xBC, 0xBB, 0xBB, 0x9B, 0xB8, 0x19, 0x82, 0x08, 0xA0, 0x0B, 0x18, 0x15, 0x75,
+  0x44, 0x23, 0x35, 0x32, 0x11, 0x82, 0xCA, 0xDA, 0xDB, 0xAA, 0xBA, 0x9A, 0x9A, 0x08, 0x18, 0x82,
+  0x80, 0x80, 0x40, 0x51, 0x45, 0x34, 0x44, 0x33, 0x34, 0x01, 0x02, 0xCB, 0xBB, 0xDC, 0xAB, 0xBA,
+  0x9C, 0xA8, 0x88, 0x80, 0x08, 0x80, 0x90, 0x72, 0x33, 0x45, 0x25, 0x42, 0x23, 0x02, 0x12, 0xBA,
+  0xBC, 0xDC, 0xBB, 0xCA, 0xAB, 0x99, 0x8B, 0x99, 0xB0, 0x21, 0x88, 0x73, 0x15, 0x54, 0x32, 0x33,
+  0x34, 0x20, 0x81, 0xD9, 0xBA, 0xCD, 0xAB, 0xBA, 0xAC, 0x9A, 0xA9, 0x19, 0x01, 0x18, 0x27, 0x31,
+  0x8A, 0xF9, 0x29, 0x00, 0x36, 0x24, 0x43, 0x13, 0x12, 0x01, 0xB9, 0xCA, 0xCD, 0xAB, 0xBC, 0xAB,
+  0xAA, 0x8A, 0xA9, 0x20, 0x43, 0x24, 0x36, 0x53, 0x33, 0x34, 0x22, 0x22, 0xA0, 0xB8, 0xCD, 0xDB,
+  0xBA, 0xAC, 0xBA, 0xAA, 0xA9, 0x08, 0x18, 0x43, 0x42, 0x36, 0x53, 0x33, 0x23, 0x33, 0x18, 0xA9,
+  0xCC, 0xBD, 0xBC, 0xAC, 0xBB, 0xAB, 0xA9, 0xA9, 0x48, 0x81, 0x35, 0x42, 0x35, 0x42, 0x33, 0x23,
+  0x80, 0x00, 0xCC, 0xBB, 0xCE, 0xAB, 0xBB, 0xBA, 0x99, 0x8A, 0x41, 0x41, 0x33, 0x35, 0x35, 0x32,
+  0x25, 0x11, 0x02, 0x90, 0xAB, 0xDB, 0xCC, 0xBA, 0xBB, 0xAC, 0x09, 0x80, 0x30, 0x35, 0x34, 0x36,
+  0x31, 0x43, 0x02, 0x30, 0x80, 0xBA, 0xB0, 0xCF, 0x99, 0xBA, 0x9C, 0x00, 0xBB, 0x43, 0x08, 0x25,
+  0x33, 0x43, 0x14, 0x41, 0x80, 0x08, 0xE8, 0x08, 0xBB, 0x8C, 0xCA, 0xAA, 0x80, 0x80, 0x80, 0x80,
+  0x71, 0x93, 0x63, 0x08, 0x10, 0x01, 0x21, 0x00, 0x14, 0x08, 0x90, 0x8E, 0xB0, 0x0B, 0xE8, 0x09,
+  0xC0, 0x1A, 0x88, 0x95, 0x59, 0x08, 0x03, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x28,
+  0xFF, 0x38, 0x8E, 0x50, 0x80, 0x80, 0x80, 0x80, 0x71, 0x81, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x91, 0x79, 0xFF, 0x9F, 0x80, 0x9E, 0x80, 0x08, 0xD0, 0x0B, 0x80, 0x80, 0x80, 0x08,
+  0x80, 0x08, 0x08, 0x08, 0x39, 0xFF, 0x0D, 0x08, 0x80, 0x08, 0xF0, 0x0B, 0x08, 0x08, 0x08, 0x08,
+  0x90, 0x27, 0x3F, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x19, 0x77,
+  0x86, 0x80, 0x80, 0x71, 0x81, 0x80, 0x80, 0x80, 0x71, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x90,
+  0x73, 0x86, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x17, 0x01, 0x14, 0x00, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x10, 0x7D, 0xFF, 0xA2, 0x0F, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x20, 0xFF, 0x0B, 0x08, 0x08, 0x08, 0x90, 0x73, 0x85, 0x80,
+  0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // three
+  0xAA, 0xFF, 0x00, 0x00, 0xF0, 0x76, 0x9F, 0xB9, 0x85, 0x78, 0xB9, 0x10, 0x93, 0x09, 0x11, 0xF2,
+  0x1B, 0x00, 0x04, 0xC1, 0x69, 0x09, 0x81, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x79,
+  0xF3, 0x61, 0x1A, 0x82, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80,
+  0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x10, 0x7D, 0xFF, 0x02, 0x39, 0xCF, 0x02, 0x0B, 0x90,
+  0xCB, 0xA2, 0x0A, 0x95, 0x1B, 0xF0, 0x1C, 0x91, 0x09, 0x80, 0x80, 0xB0, 0x9C, 0x4D, 0xA9, 0x28,
+  0xA8, 0x00, 0x1B, 0x2C, 0xA5, 0x9C, 0x2E, 0xC1, 0x00, 0x41, 0x90, 0x2D, 0x02, 0x2E, 0x82, 0x80,
+  0x80, 0x89, 0x02, 0x08, 0x98, 0x27, 0x28, 0x8A, 0x07, 0x88, 0x31, 0xAB, 0x16, 0x4D, 0xA2, 0x01,
+  0x30, 0x2B, 0x87, 0x08, 0x80, 0x58, 0xA9, 0x96, 0x49, 0x8A, 0x93, 0x4B, 0x91, 0x00, 0x08, 0x08,
+  0x08, 0x79, 0xB8, 0x05, 0xC8, 0x01, 0x21, 0x00, 0xAA, 0x42, 0x29, 0x9D, 0x80, 0x80, 0x80, 0x80,
+  0x00, 0xF9, 0xA0, 0x93, 0x79, 0x1A, 0xC9, 0x88, 0x80, 0x80, 0x80, 0x00, 0x29, 0xFC, 0x21, 0x1C,
+  0x83, 0x90, 0x0D, 0x8D, 0x50, 0xC3, 0x49, 0x8A, 0xA0, 0x89, 0x06, 0x4A, 0x80, 0xD8, 0x08, 0x04,
+  0x08, 0x19, 0xBA, 0x06, 0x08, 0x80, 0x88, 0x80, 0x70, 0xA0, 0x85, 0x2C, 0x91, 0x01, 0x08, 0x08,
+  0x08, 0x80, 0x08, 0x08, 0x28, 0xB7, 0x69, 0xA9, 0x00, 0x59, 0xE5, 0x40, 0xCA, 0x22, 0x8A, 0x00,
+  0x9B, 0xB5, 0x38, 0x8A, 0xA8, 0x80, 0x80, 0x18, 0xFA, 0xA1, 0xB4, 0x1C, 0x89, 0x01, 0xC9, 0x8B,
+  0x8A, 0x80, 0xF1, 0x7A, 0xB8, 0x3B, 0xC1, 0x00, 0xA0, 0x3C, 0x81, 0xE0, 0x21, 0x08, 0x8B, 0xF0,
+  0x39, 0x00, 0x89, 0xE3, 0x12, 0x3C, 0x83, 0xBA, 0x61, 0x08, 0x08, 0x88, 0x80, 0x90, 0x74, 0x0B,
+  0x86, 0x80, 0x38, 0xC0, 0x32, 0x38, 0x0E, 0x83, 0xEC, 0xFE, 0x20, 0x00, 0x48, 0xC4, 0x38, 0x08,
+  0x80, 0x90, 0x16, 0x9A, 0x31, 0x81, 0x4B, 0x8A, 0x43, 0xF9, 0x86, 0x0A, 0x10, 0x0A, 0xA3, 0x0A,
+  0x60, 0x8C, 0x11, 0xC3, 0x09, 0x08, 0x08, 0x08, 0x28, 0xD8, 0xC2, 0xB4, 0x4E, 0xC1, 0x38, 0xC0,
+  0x39, 0xB0, 0x48, 0xA9, 0xA0, 0x48, 0xC8, 0x93, 0x4D, 0x20, 0xBC, 0x04, 0x2B, 0x91, 0x2B, 0xD0,
+  0x96, 0x19, 0x19, 0x82, 0x2E, 0x88, 0x03, 0xC9, 0x03, 0x09, 0x3B, 0x78, 0xB0, 0x81, 0x08, 0x97,
+  0x2D, 0xA0, 0x23, 0x4C, 0x98, 0x20, 0xA0, 0x1B, 0x61, 0xB0, 0x00, 0xB1, 0x49, 0x7C, 0x99, 0xC3,
+  0x58, 0xB8, 0x30, 0xC2, 0x3C, 0xC2, 0x49, 0xD0, 0x39, 0x81, 0x0A, 0xE3, 0x4A, 0x90, 0x91, 0x08,
+  0x3D, 0x91, 0xC1, 0x4B, 0xB8, 0xA4, 0x11, 0x8B, 0x69, 0xC8, 0x41, 0xEA, 0x11, 0x08, 0x29, 0xD1,
+  0x28, 0xAA, 0x10, 0x15, 0xCB, 0x10, 0xD3, 0x7A, 0x90, 0x88, 0x80, 0x18, 0x78, 0xFC, 0x2E, 0x00,
+  0x08, 0xF2, 0x68, 0x99, 0x10, 0xC1, 0x38, 0x81, 0xBA, 0x15, 0x9B, 0x32, 0xF0, 0x20, 0xA8, 0x10,
+  0xB2, 0x39, 0xA1, 0x91, 0x74, 0xD2, 0x2B, 0x95, 0x4B, 0x91, 0xBB, 0x26, 0x0C, 0x82, 0xCA, 0x51,
+  0x99, 0x04, 0x09, 0x8A, 0x82, 0x00, 0x21, 0xD1, 0x09, 0xA8, 0x48, 0xB0, 0x11, 0x94, 0x0C, 0xA3,
+  0x0B, 0x18, 0xB9, 0x47, 0x0A, 0x08, 0xA9, 0x28, 0x98, 0x07, 0x20, 0x8C, 0xA4, 0x1A, 0xBA, 0xAA,
+  0x15, 0x9F, 0xA3, 0x8B, 0x59, 0xD0, 0x22, 0x89, 0x98, 0x05, 0x0A, 0x43, 0x93, 0x54, 0x99, 0x84,
+  0x89, 0x8A, 0xED, 0xA8, 0xCB, 0x8A, 0xD8, 0x0A, 0x80, 0x28, 0x27, 0x61, 0x24, 0x21, 0x23, 0xA8,
+  0x90, 0xCB, 0xAC, 0xDA, 0xAB, 0xAB, 0xDB, 0x88, 0x9C, 0x89, 0x10, 0x72, 0x24, 0x54, 0x23, 0x11,
+  0x11, 0xA9, 0xA9, 0xBD, 0x9B, 0xD9, 0x19, 0xB0, 0x99, 0xA8, 0xBF, 0x90, 0x8C, 0x01, 0x21, 0x55,
+  0xDE, 0xED, 0x3F, 0x00, 0x43, 0x35, 0x11, 0x01, 0xA8, 0xA9, 0xBC, 0xBB, 0xAA, 0x98, 0x39, 0xA0,
+  0xF1, 0x1B, 0xDE, 0x88, 0x8A, 0x08, 0x52, 0x31, 0x37, 0x33, 0x02, 0x81, 0xA9, 0xD9, 0xCA, 0xA9,
+  0x8B, 0x92, 0x29, 0xA0, 0xC8, 0x8E, 0xEA, 0x09, 0xAB, 0x81, 0x71, 0x21, 0x35, 0x43, 0x01, 0x10,
+  0xA9, 0xA8, 0xAD, 0x9B, 0xB9, 0x2A, 0xB2, 0x19, 0xD0, 0x9D, 0xD8, 0x8B, 0xC8, 0x00, 0x39, 0x27,
+  0x61, 0x33, 0x12, 0x18, 0xA1, 0x8A, 0xDA, 0x9C, 0x9A, 0x99, 0x31, 0xD9, 0x21, 0xCD, 0x08, 0xBB,
+  0x99, 0x08, 0xAA, 0x57, 0x11, 0x45, 0x12, 0x00, 0x01, 0x99, 0xA0, 0x9E, 0xA8, 0x8A, 0x08, 0x82,
+  0x8D, 0xA2, 0x9F, 0x90, 0x8C, 0x88, 0x88, 0x39, 0x37, 0x40, 0x26, 0x00, 0x01, 0x80, 0x8A, 0xB8,
+  0xAD, 0x88, 0x9A, 0x30, 0xB0, 0x1B, 0xF0, 0x9D, 0xB0, 0x9B, 0x08, 0xA0, 0x7A, 0x17, 0x30, 0x25,
+  0x08, 0x01, 0x88, 0x9A, 0x67, 0x27, 0x3E, 0x00, 0xB8, 0xAE, 0x00, 0x9A, 0x30, 0xC0, 0x0A, 0xD0,
+  0x9C, 0xA8, 0xAB, 0x28, 0xC8, 0x70, 0x07, 0x40, 0x03, 0x80, 0x01, 0xA8, 0x0A, 0xC9, 0x9C, 0x80,
+  0x9A, 0x30, 0xD0, 0x1A, 0xD0, 0x8C, 0x98, 0x9B, 0x20, 0xC9, 0x72, 0x06, 0x40, 0x04, 0x88, 0x10,
+  0xA8, 0x89, 0xB8, 0x9D, 0x81, 0xA9, 0x31, 0xD0, 0x1A, 0xC1, 0x9D, 0x80, 0xAA, 0x28, 0xD0, 0x71,
+  0x04, 0x40, 0x04, 0x88, 0x10, 0xA0, 0x0B, 0xD1, 0x8C, 0x01, 0x9A, 0x30, 0xD1, 0x1A, 0xC2, 0x9D,
+  0x00, 0xBA, 0x20, 0xC9, 0x72, 0x84, 0x61, 0x02, 0x19, 0x00, 0xA8, 0x09, 0xD8, 0x8B, 0x92, 0x9B,
+  0x24, 0xCA, 0x28, 0xE8, 0x8B, 0xA1, 0x9C, 0x12, 0xCB, 0x74, 0x81, 0x61, 0x82, 0x08, 0x01, 0xAA,
+  0x10, 0xFA, 0x19, 0x90, 0x1B, 0x03, 0xBB, 0x32, 0xFB, 0x1A, 0xB8, 0x0B, 0x02, 0xAE, 0x73, 0x91,
+  0x72, 0x92, 0x28, 0x91, 0x8A, 0x01, 0xDB, 0x29, 0x66, 0x0B, 0x43, 0x00, 0xC8, 0x29, 0x92, 0x1B,
+  0x93, 0xAE, 0x00, 0xBB, 0x80, 0x98, 0xDB, 0x74, 0x90, 0x64, 0x91, 0x20, 0x90, 0x09, 0x80, 0xBA,
+  0x09, 0xB9, 0x29, 0x81, 0x99, 0x88, 0xEC, 0x9A, 0xB9, 0x9B, 0x08, 0xF9, 0x7A, 0x84, 0x70, 0x83,
+  0x10, 0x81, 0x09, 0x90, 0xAA, 0x9A, 0xB9, 0x19, 0x98, 0x92, 0x8C, 0xD9, 0xBC, 0x99, 0xBC, 0x19,
+  0xF0, 0x6B, 0x83, 0x70, 0x04, 0x01, 0x01, 0x98, 0x81, 0x9B, 0xC8, 0x8A, 0xA9, 0x81, 0x1A, 0xF3,
+  0x1A, 0xF8, 0x19, 0xA9, 0x89, 0xA1, 0x2B, 0x16, 0x60, 0x33, 0x33, 0x02, 0x3A, 0xF0, 0x18, 0xDB,
+  0x08, 0xAA, 0x28, 0xA8, 0x40, 0xBC, 0x82, 0x9E, 0x80, 0xBB, 0x31, 0xBD, 0x34, 0x39, 0x27, 0x42,
+  0x02, 0x00, 0x80, 0x8B, 0xE1, 0x8A, 0xC9, 0x80, 0x80, 0x00, 0xB8, 0xA8, 0xFB, 0x09, 0xAC, 0xA1,
+  0x28, 0x8D, 0x16, 0x50, 0x32, 0x24, 0x10, 0x90, 0x80, 0x8A, 0xCB, 0xD9, 0xC5, 0x08, 0x3E, 0x00,
+  0x2A, 0xAB, 0x85, 0x19, 0xB9, 0xB8, 0x9C, 0xAB, 0xBA, 0xC8, 0x69, 0x1C, 0x07, 0x41, 0x23, 0x33,
+  0x00, 0x08, 0xA9, 0xB0, 0x9E, 0xDB, 0x08, 0x8B, 0x94, 0x1A, 0xA8, 0x9B, 0xF2, 0x3C, 0xDA, 0x93,
+  0x4C, 0xA8, 0x24, 0x48, 0x22, 0x14, 0x80, 0x08, 0xA8, 0x09, 0xAD, 0xC9, 0xA8, 0x18, 0x1C, 0xD3,
+  0x48, 0x8C, 0xC3, 0x18, 0x8B, 0xB1, 0x29, 0x8B, 0x04, 0x17, 0x72, 0x00, 0x82, 0x29, 0xA8, 0x81,
+  0xAA, 0xAB, 0xCB, 0xB0, 0x3B, 0xA8, 0x12, 0x7D, 0xA8, 0xA4, 0x5B, 0x9C, 0xB2, 0x3A, 0x8C, 0x96,
+  0x51, 0x29, 0xA2, 0x13, 0x18, 0x01, 0xA8, 0xE1, 0x0A, 0x8D, 0xC1, 0x81, 0x08, 0x30, 0x89, 0xA7,
+  0x48, 0x0D, 0xC1, 0x80, 0x8A, 0x88, 0x11, 0x48, 0x80, 0x07, 0x31, 0x10, 0x83, 0x88, 0xAA, 0x9A,
+  0x9C, 0xB0, 0x2D, 0xA0, 0x24, 0x98, 0xB3, 0x1F, 0xFA, 0x90, 0x1E, 0xB8, 0x83, 0x6A, 0x98, 0x86,
+  0x75, 0xF9, 0x48, 0x00, 0x30, 0x10, 0x82, 0x91, 0x90, 0x0A, 0x8C, 0xD8, 0x98, 0x09, 0x18, 0x08,
+  0x81, 0x0A, 0xF9, 0xB8, 0x1E, 0x9C, 0xA2, 0x68, 0x89, 0x96, 0x41, 0x28, 0x02, 0x01, 0x90, 0x89,
+  0xAA, 0xD9, 0x0B, 0x9C, 0x81, 0x49, 0x98, 0x82, 0x8B, 0xDA, 0x8C, 0xCB, 0x91, 0x7A, 0x19, 0x95,
+  0x24, 0x40, 0x11, 0x21, 0xA8, 0xD3, 0x08, 0x0E, 0xAA, 0xB1, 0x00, 0x19, 0x28, 0x1B, 0xF1, 0xC1,
+  0x1A, 0x8D, 0x90, 0x20, 0x29, 0x86, 0x24, 0x52, 0x21, 0x11, 0x90, 0xA0, 0xA9, 0x8E, 0x9C, 0xB9,
+  0xA1, 0x20, 0x3A, 0xA0, 0xD3, 0xA8, 0x8C, 0x0F, 0x99, 0x00, 0x10, 0x04, 0x45, 0x41, 0x13, 0x14,
+  0x18, 0xA8, 0xA8, 0x8D, 0x9E, 0xA9, 0x80, 0x2A, 0x88, 0x93, 0x11, 0x9B, 0xF9, 0xA9, 0x8C, 0x99,
+  0xA1, 0x06, 0x71, 0x30, 0x23, 0x14, 0x11, 0x88, 0xA8, 0x8C, 0xBD, 0xD9, 0x98, 0x09, 0x88, 0x02,
+  0x11, 0x08, 0xA8, 0xAC, 0x37, 0xF3, 0x31, 0x00, 0xBD, 0xD9, 0xC1, 0x48, 0x4C, 0x81, 0x07, 0x31,
+  0x20, 0x01, 0x01, 0x99, 0xF8, 0x98, 0x0D, 0xA9, 0xA2, 0x20, 0x4A, 0x98, 0xC3, 0x91, 0x9B, 0xCB,
+  0xC0, 0x4A, 0x2C, 0x92, 0x17, 0x51, 0x20, 0x02, 0x11, 0x89, 0xC0, 0x99, 0x8E, 0xB9, 0x91, 0x39,
+  0x2B, 0xB2, 0x84, 0x2B, 0x9D, 0xBA, 0xB9, 0x2B, 0x8B, 0x07, 0x44, 0x62, 0x22, 0x13, 0x12, 0x08,
+  0xC0, 0xAA, 0x9F, 0xBA, 0xA0, 0x19, 0x19, 0x81, 0x83, 0x29, 0x8F, 0xE9, 0xA0, 0x0A, 0xB9, 0x95,
+  0x61, 0x48, 0x22, 0x15, 0x20, 0x00, 0x90, 0x99, 0xAD, 0xCB, 0xB9, 0x89, 0x09, 0x92, 0x14, 0x38,
+  0xAA, 0xD0, 0x9C, 0xBC, 0xB8, 0x4B, 0x3B, 0x06, 0x35, 0x62, 0x21, 0x82, 0x02, 0x09, 0xCB, 0xE9,
+  0x9A, 0x8B, 0xB8, 0x02, 0x38, 0x10, 0xA3, 0x80, 0x9F, 0xEA, 0x99, 0x0B, 0x9A, 0x85, 0x44, 0x61,
+  0x12, 0x14, 0x11, 0x00, 0xA8, 0xC9, 0xBB, 0xBC, 0x27, 0xFD, 0x37, 0x00, 0x9A, 0x8A, 0x81, 0x04,
+  0x50, 0x09, 0xD2, 0xA0, 0x9C, 0xBA, 0xB0, 0x4A, 0x48, 0x16, 0x44, 0x32, 0x22, 0x13, 0x10, 0xAA,
+  0xEC, 0xAA, 0x8D, 0xAA, 0x90, 0x28, 0x00, 0x95, 0x02, 0x2A, 0x9C, 0xBB, 0xAB, 0x0F, 0x98, 0x84,
+  0x44, 0x42, 0x23, 0x24, 0x11, 0x81, 0xA9, 0xAE, 0xCB, 0xBA, 0xA9, 0x1A, 0x18, 0x12, 0x41, 0x10,
+  0xB8, 0xF9, 0xBB, 0xBB, 0x8D, 0x1A, 0x11, 0x37, 0x54, 0x22, 0x23, 0x13, 0x28, 0xDB, 0xD8, 0x9B,
+  0x8E, 0xA9, 0x80, 0x28, 0x18, 0x82, 0x02, 0x1A, 0xAE, 0xD8, 0x8A, 0x0D, 0x98, 0x04, 0x53, 0x42,
+  0x32, 0x33, 0x22, 0x00, 0xCA, 0xBC, 0xAD, 0xBB, 0xA9, 0x19, 0x29, 0x12, 0x85, 0x11, 0x0C, 0xAC,
+  0xEB, 0xD8, 0x80, 0x3A, 0x40, 0x24, 0x26, 0x32, 0x32, 0x02, 0x90, 0xBA, 0xBE, 0xBB, 0xCB, 0x99,
+  0x09, 0x20, 0x40, 0x01, 0xC3, 0xA8, 0xCC, 0xCB, 0x9B, 0x8B, 0x00, 0x37, 0xEC, 0xF3, 0x33, 0x00,
+  0x35, 0x44, 0x32, 0x23, 0x01, 0xA8, 0xD9, 0xAC, 0xAC, 0xBA, 0xA8, 0x18, 0x29, 0x82, 0x95, 0x09,
+  0xDA, 0xD9, 0x9A, 0x8D, 0x89, 0x11, 0x35, 0x63, 0x42, 0x32, 0x12, 0x81, 0xC0, 0xB9, 0xAD, 0xBB,
+  0xBA, 0x99, 0x19, 0x19, 0xA3, 0xB4, 0xA8, 0x0F, 0x8F, 0xB9, 0xA0, 0x20, 0x60, 0x32, 0x26, 0x42,
+  0x21, 0x81, 0x91, 0x8B, 0x9E, 0xBA, 0xB9, 0x1A, 0x1B, 0x81, 0x03, 0x18, 0xF0, 0xB0, 0x0F, 0x9C,
+  0xB8, 0x81, 0x60, 0x31, 0x24, 0x25, 0x32, 0x01, 0x92, 0x99, 0xAC, 0xDB, 0xA9, 0x8A, 0x0A, 0x81,
+  0x83, 0x08, 0xBB, 0xFB, 0xBD, 0xBB, 0x9B, 0x09, 0x34, 0x47, 0x43, 0x43, 0x32, 0x12, 0x00, 0xA9,
+  0xBA, 0xBD, 0xBB, 0xAA, 0xA9, 0x80, 0x2A, 0x9E, 0xF8, 0xC9, 0x9A, 0x8D, 0x99, 0x01, 0x53, 0x42,
+  0x34, 0x33, 0x33, 0x12, 0x90, 0xA9, 0xBD, 0xCB, 0xAA, 0x8C, 0xAA, 0x99, 0x9C, 0xDB, 0xDA, 0xAA,
+  0xAE, 0xEE, 0x30, 0x00, 0x9C, 0x89, 0x10, 0x34, 0x36, 0x34, 0x53, 0x21, 0x02, 0x92, 0x90, 0x9B,
+  0xBC, 0xDA, 0xAA, 0xAA, 0x9D, 0xBA, 0xBB, 0xAD, 0x9B, 0x99, 0x01, 0x27, 0x53, 0x53, 0x32, 0x14,
+  0x22, 0x10, 0x88, 0xA8, 0xBA, 0xEB, 0xAA, 0x9C, 0xCB, 0xD8, 0x99, 0x0C, 0xAA, 0xA1, 0x40, 0x40,
+  0x33, 0x27, 0x32, 0x23, 0x05, 0x21, 0x18, 0x99, 0xB9, 0xCA, 0xDA, 0xAA, 0x9D, 0xBB, 0xD9, 0xA9,
+  0x8A, 0x19, 0x28, 0x15, 0x27, 0x42, 0x41, 0x12, 0x13, 0x01, 0x08, 0x9A, 0xEB, 0xC9, 0xA9, 0x8D,
+  0x9C, 0xC9, 0xA0, 0x8A, 0x89, 0x01, 0x41, 0x42, 0x16, 0x33, 0x43, 0x31, 0x01, 0x92, 0xA8, 0x9C,
+  0xBE, 0xE9, 0xA9, 0xAA, 0x9B, 0xCA, 0xA8, 0x19, 0x28, 0x23, 0x27, 0x24, 0x25, 0x41, 0x11, 0x83,
+  0x01, 0x8A, 0xCB, 0xDB, 0xBB, 0xBC, 0xBB, 0xCA, 0x9A, 0x8A, 0x90, 0x32, 0x53, 0x44, 0x44, 0x33,
+  0x24, 0x33, 0x22, 0x11, 0x69, 0x0F, 0x2B, 0x00, 0x8B, 0xFB, 0xD9, 0xAA, 0xAC, 0xAB, 0xB9, 0x99,
+  0x89, 0x29, 0x32, 0x34, 0x37, 0x53, 0x43, 0x23, 0x33, 0x13, 0x10, 0xAA, 0xCD, 0xDA, 0xBB, 0xAC,
+  0xBB, 0xAA, 0x9A, 0x80, 0x28, 0x24, 0x54, 0x42, 0x34, 0x43, 0x23, 0x14, 0x11, 0x88, 0xBA, 0xEC,
+  0xBA, 0xAD, 0xBA, 0xBA, 0xA9, 0x99, 0x80, 0x41, 0x41, 0x24, 0x54, 0x32, 0x33, 0x25, 0x11, 0x00,
+  0xA8, 0xCA, 0xAE, 0xBC, 0xBB, 0xAB, 0xAA, 0x9A, 0x00, 0x12, 0x44, 0x63, 0x32, 0x25, 0x24, 0x33,
+  0x11, 0x81, 0x98, 0xCA, 0xBD, 0xBD, 0xCB, 0xBA, 0x9B, 0x8B, 0x88, 0x12, 0x35, 0x44, 0x53, 0x42,
+  0x22, 0x23, 0x22, 0x80, 0xA8, 0xDB, 0xBC, 0xCD, 0xBA, 0xBB, 0xAA, 0x8A, 0x19, 0x02, 0x27, 0x42,
+  0x42, 0x33, 0x24, 0x22, 0x21, 0x89, 0xB9, 0xEC, 0xBB, 0xBD, 0xAC, 0xBA, 0xAA, 0x88, 0x18, 0x40,
+  0x42, 0x34, 0x34, 0x43, 0x23, 0x03, 0x03, 0x09, 0xBA, 0x06, 0x24, 0x00, 0xCB, 0xEC, 0xBA, 0x9D,
+  0xAC, 0xB9, 0x98, 0x09, 0x28, 0x31, 0x26, 0x53, 0x33, 0x33, 0x33, 0x23, 0x80, 0xBA, 0xDC, 0xEB,
+  0xBB, 0xAC, 0x9B, 0x9A, 0x80, 0x22, 0x72, 0x32, 0x34, 0x24, 0x42, 0x21, 0x01, 0x82, 0x8B, 0xAB,
+  0xBE, 0xCB, 0xAC, 0xAA, 0x8A, 0x00, 0x18, 0x27, 0x41, 0x31, 0x23, 0x43, 0x00, 0x40, 0xD0, 0x08,
+  0xB8, 0xBA, 0xAC, 0xDB, 0x8A, 0xC0, 0x09, 0x08, 0x24, 0x50, 0x30, 0x92, 0x53, 0x08, 0x08, 0x80,
+  0x90, 0x9F, 0xD0, 0x09, 0xC8, 0x09, 0x00, 0x8C, 0x84, 0x08, 0x80, 0x90, 0x36, 0x88, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0x29, 0x9F, 0xF0, 0x0A, 0x18, 0x24, 0x82, 0x80, 0x00, 0x09, 0x77, 0x08,
+  0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7C, 0xFF, 0x8F, 0xFA, 0xFF, 0x21, 0x00,
+  0x80, 0x80, 0x80, 0x80, 0xBF, 0x80, 0x00, 0x08, 0x88, 0x00, 0xEF, 0x00, 0x08, 0x88, 0x00, 0xAF,
+  0x81, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x2D, 0x81, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08,
+  0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x90, 0xF4, 0x77, 0x07, 0x08, 0x08, 0x08, 0x08, 0x78,
+  0x84, 0x80, 0x80, 0x90, 0x64, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x66, 0x80, 0x08, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xB1, 0x95, 0xFF, 0xEF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA1, 0xCF,
+  0x8C, 0x80, 0x80, 0x63, 0x30, 0x09, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // four
+  0xA6, 0xFF, 0x00, 0x00, 0x70, 0x2F, 0xF4, 0xC5, 0x12, 0x2D, 0x92, 0x0B, 0x85, 0x1C, 0xD1, 0x12,
+  0x2C, 0x82, 0xAA, 0x04, 0x3B, 0x8A, 0x95, 0x29, 0x80, 0x18, 0x8F, 0x85, 0x89, 0x93, 0x09, 0x50,
+  0xC8, 0x83, 0x39, 0x2C, 0x18, 0x02, 0x0B, 0x95, 0x08, 0x96, 0x1B, 0x88, 0x80, 0x31, 0x9C, 0x81,
+  0x88, 0x03, 0x4E, 0xD3, 0x08, 0x88, 0x80, 0x00, 0x1F, 0xF2, 0x10, 0x09, 0x1B, 0xE3, 0x18, 0xC0,
+  0x0A, 0x88, 0x32, 0x8D, 0x80, 0xF0, 0x01, 0x5B, 0x9B, 0xB3, 0x4C, 0xC0, 0x30, 0x9A, 0x98, 0x00,
+  0x08, 0x18, 0x0C, 0xD8, 0x96, 0x4B, 0xB1, 0x28, 0x2B, 0x4B, 0xE1, 0x22, 0xCA, 0x13, 0x18, 0x1D,
+  0xC3, 0x38, 0x08, 0x91, 0x00, 0x08, 0x97, 0x59, 0x88, 0x81, 0x08, 0x02, 0x9A, 0x37, 0xAB, 0x17,
+  0x2B, 0xB2, 0x22, 0x88, 0x2A, 0x05, 0x2C, 0xA5, 0x4A, 0x91, 0x29, 0x08, 0x28, 0xD3, 0x29, 0xB5,
+  0x89, 0x21, 0x0B, 0xB1, 0xB6, 0x00, 0x14, 0x00, 0x70, 0xE1, 0x00, 0x08, 0x08, 0x08, 0x08, 0xEA,
+  0x04, 0x3B, 0xF1, 0x18, 0x29, 0xAB, 0x04, 0x0B, 0xB3, 0x09, 0x80, 0x80, 0x80, 0x18, 0xDA, 0xA6,
+  0x3F, 0x89, 0x83, 0xF0, 0x48, 0x2B, 0xD1, 0x82, 0x39, 0xB0, 0x08, 0xC1, 0x15, 0x89, 0x98, 0x03,
+  0x08, 0x18, 0xAF, 0x95, 0x10, 0x08, 0x80, 0x80, 0x80, 0x90, 0x75, 0xC8, 0x13, 0x18, 0xE8, 0x32,
+  0x8A, 0x11, 0x3B, 0xC0, 0x00, 0x19, 0x97, 0x29, 0x0C, 0x80, 0x08, 0x08, 0x80, 0xA0, 0x49, 0x88,
+  0x00, 0xCF, 0xA6, 0xA8, 0x09, 0x08, 0xD0, 0x69, 0xBA, 0x85, 0x0C, 0x18, 0xD1, 0x91, 0x38, 0xAC,
+  0x02, 0x8A, 0xC1, 0x5A, 0x90, 0x2D, 0xC1, 0x18, 0xB2, 0x08, 0x08, 0x90, 0x2F, 0xF3, 0x59, 0xB9,
+  0x13, 0x8B, 0x11, 0x2A, 0xD3, 0x48, 0x08, 0x0A, 0xA3, 0x11, 0x89, 0x28, 0xF6, 0x50, 0x8A, 0xA2,
+  0x28, 0x02, 0x1C, 0x91, 0x43, 0xE9, 0x33, 0x8D, 0xB4, 0xFE, 0x25, 0x00, 0x84, 0x19, 0xA1, 0x20,
+  0x19, 0x22, 0xBD, 0x36, 0xBA, 0x32, 0xE1, 0x40, 0xC0, 0x68, 0xA8, 0x28, 0x28, 0xE8, 0x32, 0xBB,
+  0x43, 0x1C, 0xA1, 0x28, 0xA8, 0x93, 0x7A, 0x99, 0x82, 0x0A, 0x80, 0x85, 0x1E, 0x00, 0xA9, 0x04,
+  0xAB, 0x16, 0x0E, 0x81, 0x19, 0x29, 0x99, 0xA1, 0x50, 0x8D, 0x02, 0x8A, 0x18, 0xB9, 0x53, 0xCC,
+  0x03, 0x0B, 0x81, 0xA0, 0xF0, 0x52, 0xBB, 0x13, 0x3E, 0xB0, 0x81, 0xC2, 0x39, 0xA0, 0x6C, 0xB0,
+  0x80, 0x00, 0x91, 0x5B, 0xB8, 0xA5, 0x49, 0x99, 0x94, 0x3F, 0xB2, 0x89, 0x22, 0x09, 0xA1, 0x2E,
+  0xB2, 0x31, 0x8E, 0xA5, 0x19, 0x30, 0xBB, 0x43, 0xE5, 0x48, 0xA0, 0x38, 0x80, 0xBC, 0x42, 0xA8,
+  0x08, 0x81, 0x28, 0x29, 0xC4, 0x49, 0xA1, 0x28, 0xA8, 0x20, 0x39, 0xE1, 0x6A, 0xB1, 0x49, 0x83,
+  0x8B, 0x82, 0xA0, 0x78, 0xB8, 0x91, 0x28, 0xAE, 0x13, 0x19, 0xC2, 0x09, 0xCF, 0x00, 0x23, 0x00,
+  0x14, 0x8A, 0x80, 0x26, 0xB8, 0x4B, 0xB3, 0x1C, 0x81, 0x34, 0xB1, 0x8E, 0xAD, 0x80, 0x90, 0xBD,
+  0xAB, 0xA8, 0x1B, 0x15, 0x53, 0x22, 0x42, 0x45, 0x32, 0x35, 0x91, 0x90, 0xDA, 0xBE, 0xBC, 0xBC,
+  0xEB, 0xBB, 0x19, 0x44, 0x34, 0x12, 0x21, 0x52, 0x33, 0x22, 0x80, 0x00, 0xDA, 0xEC, 0xBC, 0xCB,
+  0xBA, 0xBA, 0x89, 0x54, 0x34, 0x12, 0x80, 0x11, 0x43, 0x02, 0x00, 0x42, 0x25, 0xA1, 0xDD, 0xAA,
+  0x8A, 0xB9, 0xDD, 0xAB, 0x18, 0x45, 0x22, 0x80, 0x89, 0x31, 0x33, 0x90, 0x89, 0x73, 0x26, 0x90,
+  0xCB, 0xAB, 0x00, 0xA8, 0xDE, 0xAB, 0x18, 0x34, 0x14, 0x80, 0x89, 0x31, 0x23, 0xA0, 0xAB, 0x72,
+  0x36, 0x01, 0xCB, 0xAB, 0x08, 0x91, 0xEC, 0xBC, 0x89, 0x42, 0x23, 0x82, 0x88, 0x28, 0x42, 0x81,
+  0xAB, 0x19, 0x47, 0x24, 0x90, 0xCA, 0x8B, 0x08, 0xC8, 0xCD, 0xAC, 0x08, 0x42, 0x23, 0x81, 0x88,
+  0x24, 0xF8, 0x3D, 0x00, 0x18, 0x23, 0x81, 0xBA, 0x39, 0x77, 0x22, 0xA1, 0xCA, 0x9A, 0x00, 0xC8,
+  0xCD, 0xBB, 0x1A, 0x52, 0x33, 0x01, 0x88, 0x18, 0x32, 0x02, 0xBB, 0x0B, 0x76, 0x43, 0x81, 0xB9,
+  0xBB, 0x08, 0xA1, 0xFD, 0xCB, 0x8A, 0x30, 0x53, 0x02, 0x80, 0x89, 0x20, 0x23, 0xA8, 0xAB, 0x50,
+  0x47, 0x22, 0x98, 0xCB, 0x89, 0x01, 0xB8, 0xDF, 0xAB, 0x1A, 0x42, 0x33, 0x01, 0xA9, 0x08, 0x53,
+  0x02, 0xC9, 0x9A, 0x61, 0x34, 0x03, 0xB8, 0xAC, 0x19, 0x02, 0xFB, 0xCD, 0xAA, 0x18, 0x43, 0x13,
+  0x80, 0x99, 0x20, 0x34, 0x81, 0xDB, 0x8A, 0x53, 0x35, 0x01, 0xBA, 0xAB, 0x20, 0x82, 0xED, 0xBD,
+  0xAB, 0x10, 0x34, 0x23, 0x91, 0x89, 0x30, 0x25, 0x92, 0xDB, 0x8A, 0x62, 0x43, 0x01, 0xAA, 0xAB,
+  0x19, 0x02, 0xFB, 0xAF, 0x9B, 0x19, 0x43, 0x23, 0x01, 0x89, 0x10, 0x34, 0x01, 0xCB, 0x9C, 0x41,
+  0x44, 0x12, 0xA9, 0xCB, 0x4D, 0x0B, 0x3D, 0x00, 0x09, 0x01, 0xD8, 0xDD, 0xAB, 0x09, 0x42, 0x43,
+  0x02, 0x88, 0x18, 0x31, 0x13, 0xC9, 0xBC, 0x29, 0x45, 0x14, 0x90, 0xBA, 0x9A, 0x20, 0xA0, 0xDF,
+  0xBC, 0x9A, 0x30, 0x53, 0x23, 0x11, 0x88, 0x11, 0x33, 0x91, 0xDC, 0x9B, 0x30, 0x37, 0x02, 0xB8,
+  0xAD, 0x89, 0x01, 0xD8, 0xCD, 0x9C, 0x09, 0x32, 0x44, 0x11, 0x00, 0x00, 0x21, 0x12, 0xC8, 0xBC,
+  0x8B, 0x51, 0x24, 0x92, 0xCA, 0xAB, 0x09, 0x01, 0xFA, 0xCD, 0xAA, 0x18, 0x43, 0x34, 0x02, 0x00,
+  0x00, 0x42, 0x02, 0xB9, 0xBE, 0x8A, 0x42, 0x24, 0x91, 0xDB, 0xAA, 0x08, 0x00, 0xEA, 0xCC, 0xAB,
+  0x20, 0x44, 0x33, 0x03, 0x00, 0x18, 0x32, 0x13, 0xD9, 0xBD, 0x8A, 0x52, 0x34, 0x80, 0xCB, 0xAC,
+  0x89, 0x80, 0xCA, 0xCE, 0x9A, 0x28, 0x63, 0x23, 0x13, 0x81, 0x00, 0x21, 0x22, 0xB9, 0xCE, 0x9A,
+  0x40, 0x43, 0x81, 0xCB, 0xAD, 0x8A, 0x08, 0xB9, 0x7E, 0xE9, 0x39, 0x00, 0xCD, 0xAB, 0x38, 0x55,
+  0x43, 0x12, 0x81, 0x88, 0x00, 0x11, 0xA8, 0xDC, 0xAB, 0x20, 0x53, 0x12, 0xD9, 0xCB, 0x9B, 0x88,
+  0x98, 0xDA, 0xBB, 0x19, 0x55, 0x44, 0x23, 0x01, 0x90, 0x89, 0x80, 0x80, 0xDB, 0xAC, 0x8A, 0x42,
+  0x33, 0xB0, 0xDD, 0xBB, 0x89, 0x80, 0xA9, 0xBC, 0x0B, 0x73, 0x36, 0x34, 0x11, 0x90, 0x99, 0x88,
+  0x08, 0xB9, 0xCD, 0xAA, 0x20, 0x34, 0x03, 0xEB, 0xBC, 0xAA, 0x18, 0x80, 0xB9, 0xBB, 0x50, 0x47,
+  0x34, 0x33, 0x81, 0x99, 0xAA, 0x89, 0x89, 0xDB, 0xBC, 0x8B, 0x42, 0x34, 0x81, 0xEB, 0xBC, 0x8A,
+  0x08, 0x00, 0x99, 0x89, 0x72, 0x45, 0x34, 0x22, 0x80, 0xBA, 0xAB, 0x99, 0x88, 0xCB, 0xAD, 0x89,
+  0x53, 0x33, 0x91, 0xCE, 0xBB, 0x99, 0x10, 0x00, 0x98, 0x19, 0x74, 0x44, 0x24, 0x12, 0xA8, 0xBA,
+  0xAB, 0x89, 0x80, 0xBB, 0xBD, 0x19, 0x54, 0x23, 0xA0, 0xCE, 0xAC, 0x89, 0x1C, 0xDB, 0x3E, 0x00,
+  0x01, 0x11, 0x98, 0x08, 0x73, 0x35, 0x24, 0x02, 0xA9, 0xBB, 0x9B, 0x18, 0x90, 0xDB, 0xBB, 0x29,
+  0x45, 0x23, 0xB8, 0xCE, 0xAC, 0x09, 0x10, 0x10, 0x89, 0x08, 0x73, 0x35, 0x34, 0x11, 0xA8, 0xCA,
+  0xA9, 0x08, 0x80, 0xBA, 0xBC, 0x1A, 0x73, 0x23, 0x90, 0xCD, 0xBC, 0x99, 0x10, 0x02, 0x90, 0x88,
+  0x63, 0x45, 0x24, 0x13, 0x88, 0xBA, 0xBB, 0x88, 0x08, 0xB9, 0xCD, 0x89, 0x42, 0x44, 0x81, 0xDA,
+  0xBC, 0x9A, 0x08, 0x10, 0x98, 0x99, 0x38, 0x57, 0x34, 0x33, 0x01, 0xA8, 0xBB, 0x9A, 0x09, 0xB8,
+  0xDC, 0xAB, 0x38, 0x46, 0x13, 0xA8, 0xCD, 0xBB, 0x8A, 0x08, 0x90, 0xBA, 0x8C, 0x51, 0x46, 0x33,
+  0x23, 0x81, 0xA9, 0xAA, 0x09, 0x90, 0xDB, 0xBD, 0x89, 0x52, 0x25, 0x82, 0xC9, 0xCB, 0xAA, 0x98,
+  0x98, 0xCB, 0xAC, 0x89, 0x53, 0x45, 0x33, 0x22, 0x81, 0x98, 0x88, 0x00, 0xA8, 0xDD, 0xAB, 0x09,
+  0xBF, 0xF9, 0x33, 0x00, 0x35, 0x25, 0x81, 0xC9, 0xAB, 0xAA, 0x89, 0xCA, 0xBD, 0xBC, 0x88, 0x32,
+  0x37, 0x24, 0x23, 0x02, 0x88, 0x00, 0x00, 0xA8, 0xDD, 0xAB, 0x18, 0x44, 0x24, 0x82, 0xC9, 0xBA,
+  0x9A, 0xA9, 0xFB, 0xCB, 0xAB, 0x09, 0x42, 0x44, 0x24, 0x22, 0x00, 0x08, 0x10, 0x80, 0xB9, 0xBD,
+  0x8A, 0x52, 0x44, 0x12, 0xA0, 0xCB, 0xBB, 0xAC, 0xCB, 0xBC, 0xBB, 0x9B, 0x19, 0x64, 0x44, 0x33,
+  0x11, 0x88, 0x89, 0x20, 0x81, 0xB8, 0xAD, 0x1A, 0x64, 0x33, 0x82, 0xCA, 0xBC, 0xBC, 0xCB, 0xBB,
+  0xBB, 0xAB, 0x8A, 0x63, 0x55, 0x33, 0x23, 0x80, 0x99, 0x09, 0x12, 0x02, 0xA9, 0x9A, 0x52, 0x37,
+  0x12, 0x98, 0xDC, 0xCC, 0xBB, 0xBB, 0x9A, 0x89, 0x89, 0x20, 0x66, 0x53, 0x22, 0x00, 0xA9, 0x88,
+  0x32, 0x33, 0x01, 0xA9, 0x30, 0x45, 0x13, 0xC8, 0xED, 0xCB, 0xCB, 0x9A, 0x89, 0x00, 0x10, 0x22,
+  0x54, 0x34, 0x33, 0x90, 0x05, 0x0A, 0x34, 0x00, 0xAA, 0x0A, 0x53, 0x34, 0x01, 0x89, 0x19, 0x32,
+  0x04, 0xFA, 0xCD, 0xBC, 0xBB, 0xA9, 0x00, 0x12, 0x23, 0x42, 0x44, 0x34, 0x13, 0x90, 0xAB, 0x0A,
+  0x53, 0x24, 0x01, 0x89, 0x08, 0x21, 0xA0, 0xEE, 0xCC, 0xBC, 0xBB, 0x8B, 0x28, 0x42, 0x22, 0x32,
+  0x63, 0x53, 0x12, 0x98, 0xAA, 0x09, 0x53, 0x23, 0x81, 0xAA, 0x08, 0x22, 0xB0, 0xFF, 0xBC, 0xBC,
+  0xBA, 0x89, 0x20, 0x33, 0x24, 0x33, 0x44, 0x34, 0x22, 0x98, 0xBB, 0x0A, 0x63, 0x23, 0x81, 0xAA,
+  0x08, 0x43, 0x91, 0xEE, 0xCC, 0xCB, 0xAA, 0x89, 0x21, 0x23, 0x23, 0x32, 0x45, 0x34, 0x13, 0xA8,
+  0xBB, 0x1B, 0x54, 0x23, 0x81, 0x9A, 0x10, 0x43, 0x91, 0xEE, 0xBD, 0xCB, 0xAA, 0x08, 0x21, 0x21,
+  0x11, 0x43, 0x44, 0x34, 0x02, 0x98, 0xAA, 0x08, 0x34, 0x23, 0x90, 0xAA, 0x10, 0x33, 0xD0, 0xFF,
+  0xBC, 0xAC, 0x9A, 0x18, 0x21, 0x11, 0x11, 0x42, 0x7B, 0xF5, 0x32, 0x00, 0x45, 0x33, 0x01, 0xA9,
+  0x8A, 0x31, 0x25, 0x01, 0xA8, 0x89, 0x21, 0xA1, 0xDF, 0xCD, 0xAC, 0xAB, 0x8A, 0x10, 0x21, 0x12,
+  0x32, 0x45, 0x35, 0x22, 0x81, 0x99, 0x08, 0x32, 0x14, 0x90, 0xBA, 0x89, 0x22, 0xF8, 0xDD, 0xCC,
+  0xBB, 0xAB, 0x18, 0x21, 0x33, 0x32, 0x44, 0x54, 0x33, 0x02, 0x98, 0x99, 0x20, 0x24, 0x03, 0xAA,
+  0xAC, 0x89, 0x00, 0xFC, 0xCD, 0xCB, 0xAB, 0x89, 0x21, 0x33, 0x23, 0x43, 0x44, 0x35, 0x22, 0x80,
+  0x99, 0x09, 0x32, 0x22, 0xA9, 0xCC, 0xAB, 0x9B, 0xEA, 0xDD, 0xCC, 0xAA, 0x8A, 0x11, 0x33, 0x14,
+  0x32, 0x63, 0x43, 0x22, 0x80, 0x89, 0x08, 0x32, 0x11, 0xB9, 0xBE, 0xBC, 0xBB, 0xCB, 0xDD, 0xBC,
+  0xAC, 0x09, 0x32, 0x24, 0x11, 0x21, 0x73, 0x43, 0x12, 0x98, 0x89, 0x18, 0x22, 0x81, 0xCC, 0xBD,
+  0xAA, 0x9A, 0xB9, 0xDE, 0xCB, 0x99, 0x31, 0x43, 0x12, 0x11, 0x52, 0x44, 0x85, 0x06, 0x38, 0x00,
+  0x22, 0x81, 0x99, 0x08, 0x20, 0x81, 0xD9, 0xCC, 0xAC, 0x9A, 0x99, 0xCB, 0xCC, 0x9B, 0x38, 0x54,
+  0x23, 0x02, 0x12, 0x34, 0x35, 0x02, 0x98, 0xAA, 0x09, 0x01, 0xB0, 0xCE, 0xAD, 0xAA, 0xA9, 0xA9,
+  0xCC, 0xAB, 0x29, 0x64, 0x43, 0x12, 0x01, 0x22, 0x25, 0x13, 0x91, 0xAA, 0x9B, 0x08, 0x98, 0xCD,
+  0xBE, 0xAA, 0x9A, 0xBA, 0xDB, 0xAB, 0x09, 0x53, 0x35, 0x33, 0x23, 0x43, 0x34, 0x22, 0x11, 0x98,
+  0xAA, 0xAB, 0xDB, 0xEB, 0xBB, 0xBB, 0xCC, 0xBC, 0xBC, 0xAA, 0x09, 0x31, 0x44, 0x43, 0x34, 0x33,
+  0x25, 0x21, 0x10, 0x11, 0x80, 0xDA, 0xBB, 0xBB, 0xBC, 0xBC, 0xCD, 0xCB, 0xBB, 0x8A, 0x00, 0x22,
+  0x44, 0x34, 0x34, 0x34, 0x24, 0x02, 0x00, 0x00, 0x00, 0xB9, 0xCF, 0xAB, 0x99, 0xB9, 0xCC, 0xBC,
+  0x8B, 0x10, 0x32, 0x32, 0x54, 0x34, 0x25, 0x22, 0x11, 0x10, 0x11, 0xA0, 0xA9, 0xDC, 0xAC, 0xAC,
+  0xB6, 0xFF, 0x2E, 0x00, 0x99, 0xBA, 0xCC, 0xBB, 0x0A, 0x42, 0x34, 0x24, 0x32, 0x35, 0x33, 0x13,
+  0x81, 0x00, 0xA8, 0xC9, 0xBC, 0xCD, 0xAC, 0xAB, 0xAA, 0xBA, 0xDB, 0xBA, 0x39, 0x46, 0x34, 0x12,
+  0x11, 0x42, 0x24, 0x02, 0xA8, 0xA9, 0x80, 0xAA, 0xCE, 0xCC, 0xAA, 0x99, 0xAA, 0xCA, 0x89, 0x30,
+  0x45, 0x43, 0x33, 0x32, 0x23, 0x23, 0x22, 0x12, 0xB9, 0xFB, 0xBC, 0xBC, 0xCB, 0xCA, 0xCB, 0xBA,
+  0x99, 0x21, 0x22, 0x55, 0x43, 0x43, 0x22, 0x22, 0x31, 0x11, 0x80, 0xAB, 0xCC, 0xBC, 0xBD, 0xBC,
+  0xBA, 0xBB, 0xBB, 0x09, 0x52, 0x44, 0x33, 0x32, 0x32, 0x45, 0x33, 0x22, 0xA9, 0xBB, 0xAB, 0xA1,
+  0xDD, 0xCE, 0xAB, 0x99, 0x89, 0xA8, 0xBA, 0x1A, 0x47, 0x33, 0x02, 0x80, 0x41, 0x44, 0x02, 0xA8,
+  0x9B, 0x1B, 0x82, 0xDC, 0xBD, 0xAB, 0x0A, 0x98, 0xA9, 0x89, 0x61, 0x43, 0x23, 0x22, 0x42, 0x43,
+  0x22, 0x82, 0x08, 0x08, 0x83, 0x01, 0x1B, 0x00, 0xBC, 0xD9, 0xDB, 0xAA, 0xB9, 0xAC, 0xBA, 0x00,
+  0x48, 0x53, 0x24, 0x33, 0x32, 0x34, 0x63, 0x12, 0x03, 0x80, 0x9D, 0x00, 0x08, 0xEB, 0xBB, 0xAA,
+  0x8C, 0x80, 0x00, 0x88, 0x80, 0x72, 0x22, 0x86, 0x32, 0x18, 0x15, 0x88, 0x80, 0x18, 0xFB, 0x88,
+  0x80, 0xAD, 0x9B, 0xAC, 0x81, 0x08, 0x90, 0x0F, 0x84, 0x38, 0x83, 0x08, 0x80, 0x78, 0x82, 0x80,
+  0xD1, 0x0B, 0x08, 0x08, 0xF8, 0x0A, 0x08, 0x08, 0x08, 0x18, 0xDE, 0x33, 0x49, 0x83, 0x08, 0x80,
+  0x68, 0x84, 0x08, 0x08, 0x08, 0x08, 0x80, 0xDF, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x85,
+  0x80, 0x00, 0x39, 0x07, 0x08, 0x80, 0x80, 0x80, 0x08, 0xF1, 0x0D, 0x08, 0x08, 0xD0, 0x0B, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x59, 0xFF, 0x88, 0x0A, 0x90, 0xAF, 0x00, 0x08,
+  0xE0, 0x0B, 0x80, 0x00, 0x88, 0x00, 0x08, 0x08, 0xCF, 0xFD, 0x10, 0x00, 0x08, 0x08, 0x88, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0x9A, 0xF7, 0xDF, 0x28, 0x86, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x08,
+  0x39, 0x77, 0x08, 0x08, 0x08, 0x08, 0x39, 0x27, 0x88, 0x80, 0x80, 0x80, 0x69, 0x06, 0x08, 0x08,
+  0x08, 0x88, 0x52, 0x9A, 0x53, 0x81, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80,
+  0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3A, 0xFE, 0x0F, 0x86, 0xAD, 0x00, 0x88,
+  0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0xF2, 0xAF, 0x43, 0xA0, 0x0E, 0x88, 0x43, 0x08, 0x08, 0x08,
+  0x88, 0x00, 0x18, 0xFE, 0x38, 0x82, 0x00, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // five
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x14, 0x0D, 0x92, 0xB2, 0x31, 0x9F, 0x22, 0xB9, 0x02, 0x1C,
+  0x88, 0x00, 0xC6, 0x30, 0x8A, 0x69, 0xB0, 0x40, 0x88, 0x00, 0xAC, 0x96, 0x28, 0x08, 0x08, 0x08,
+  0x9A, 0x03, 0xA4, 0x71, 0xB0, 0x82, 0x6B, 0xA0, 0x6A, 0x1A, 0xD2, 0x03, 0x0B, 0x42, 0xC0, 0x49,
+  0x8A, 0x91, 0x14, 0xBA, 0x29, 0xB2, 0x3A, 0xC4, 0xC9, 0x20, 0x95, 0x80, 0x09, 0x08, 0x0F, 0xD1,
+  0x90, 0x91, 0x4D, 0xA3, 0xBA, 0x00, 0xDB, 0x32, 0xA2, 0x9F, 0x01, 0x21, 0x3A, 0xD0, 0x89, 0x8C,
+  0x18, 0x85, 0xAD, 0x89, 0xF0, 0x24, 0x41, 0xD9, 0x09, 0x20, 0x9B, 0x23, 0x03, 0xCF, 0x19, 0x14,
+  0x09, 0x98, 0x91, 0x00, 0x3A, 0xB0, 0x90, 0xCF, 0x50, 0x04, 0x9E, 0x32, 0x16, 0x88, 0xA0, 0x09,
+  0x20, 0x25, 0xA8, 0xBF, 0xAA, 0xA9, 0xBB, 0xB0, 0xAF, 0x11, 0x67, 0x32, 0x23, 0xA0, 0xAE, 0x20,
+  0x35, 0x81, 0xDB, 0xBC, 0x8B, 0xF9, 0x3D, 0x00, 0x09, 0x21, 0x80, 0xCC, 0xAC, 0x8A, 0x03, 0x64,
+  0x33, 0x90, 0x30, 0xA2, 0xCF, 0x71, 0x13, 0xC9, 0x9B, 0x19, 0x10, 0x22, 0xA1, 0xDD, 0x0A, 0x11,
+  0x88, 0x38, 0xB0, 0x39, 0x47, 0x88, 0x10, 0xA0, 0x8D, 0x64, 0x82, 0xCC, 0x89, 0x21, 0x01, 0x80,
+  0xB9, 0xAC, 0x18, 0x43, 0xB8, 0x0C, 0x80, 0x52, 0x15, 0xA8, 0x18, 0xA0, 0x0C, 0x47, 0xA2, 0xBD,
+  0x19, 0x22, 0x81, 0x90, 0xCB, 0x9A, 0x32, 0x03, 0xE9, 0x0B, 0x01, 0x42, 0x25, 0xA9, 0x18, 0x91,
+  0x9C, 0x57, 0x92, 0xCC, 0x0A, 0x33, 0x81, 0xA9, 0x9A, 0x9A, 0x32, 0x03, 0xCC, 0x8C, 0x12, 0x20,
+  0x45, 0xA1, 0x0A, 0x22, 0xEB, 0x71, 0x13, 0xEB, 0x8B, 0x32, 0x02, 0xA9, 0x9A, 0x8A, 0x30, 0x04,
+  0xBC, 0x9C, 0x41, 0x81, 0x20, 0x15, 0x8A, 0x22, 0xE1, 0x1B, 0x47, 0xB1, 0xAD, 0x28, 0x22, 0x98,
+  0x9A, 0x99, 0x19, 0x33, 0xE8, 0x9B, 0x08, 0x23, 0x39, 0xF2, 0x3B, 0x00, 0x08, 0x61, 0x93, 0x48,
+  0x83, 0xDE, 0x50, 0x14, 0xD9, 0x9A, 0x21, 0x82, 0x98, 0x98, 0x9A, 0x20, 0x03, 0xCC, 0x09, 0x08,
+  0x92, 0x20, 0x55, 0xA1, 0x31, 0xA2, 0xCF, 0x72, 0x03, 0xBC, 0x0A, 0x22, 0x91, 0x99, 0x98, 0x99,
+  0x30, 0x93, 0xBE, 0x28, 0x88, 0x90, 0x40, 0x36, 0x98, 0x42, 0xB1, 0xBF, 0x64, 0x83, 0xCC, 0x08,
+  0x12, 0x98, 0x88, 0x90, 0x8A, 0x22, 0xB1, 0x9D, 0x21, 0xC8, 0x08, 0x23, 0x22, 0x10, 0x37, 0xC0,
+  0xAE, 0x73, 0x02, 0xCB, 0x09, 0x11, 0x80, 0x88, 0x99, 0x89, 0x12, 0xA0, 0xAC, 0x31, 0xE8, 0x0A,
+  0x22, 0x31, 0x25, 0x21, 0x81, 0xEE, 0x48, 0x26, 0xB9, 0x9D, 0x21, 0x81, 0x98, 0x09, 0x89, 0x28,
+  0x90, 0xAB, 0x20, 0x94, 0xAF, 0x38, 0x23, 0x02, 0x38, 0x17, 0xD9, 0x1C, 0x45, 0xA1, 0xAC, 0x18,
+  0x11, 0x89, 0x88, 0x98, 0x0A, 0x12, 0xC9, 0x0A, 0x33, 0xFA, 0x8C, 0x42, 0xB5, 0xF2, 0x40, 0x00,
+  0x01, 0x10, 0x52, 0x91, 0xBD, 0x61, 0x23, 0xD9, 0x9A, 0x10, 0x81, 0x88, 0x88, 0x9A, 0x29, 0x93,
+  0x9E, 0x38, 0xA4, 0xBE, 0x38, 0x14, 0x00, 0x11, 0x24, 0xA0, 0xAE, 0x73, 0x03, 0xCB, 0x0B, 0x21,
+  0x80, 0x99, 0x98, 0x0A, 0x20, 0xC8, 0x0A, 0x32, 0xF9, 0x8E, 0x20, 0x22, 0x02, 0x28, 0x54, 0xC0,
+  0x8C, 0x64, 0x81, 0xCB, 0x19, 0x11, 0x88, 0x8A, 0x88, 0x89, 0x11, 0xC9, 0x08, 0x23, 0xED, 0x0A,
+  0x23, 0x11, 0x22, 0x10, 0x35, 0xF0, 0x0B, 0x47, 0xA0, 0xAB, 0x19, 0x11, 0x98, 0x0A, 0x98, 0x89,
+  0x02, 0xBB, 0x49, 0x06, 0xFC, 0x19, 0x12, 0x10, 0x11, 0x18, 0x34, 0xF9, 0x2A, 0x27, 0xB0, 0x9C,
+  0x28, 0x01, 0xA9, 0x19, 0x90, 0x8A, 0x22, 0xEA, 0x29, 0x15, 0xFB, 0x2A, 0x12, 0x08, 0x13, 0x88,
+  0x34, 0xE0, 0x1B, 0x46, 0xA0, 0x9C, 0x08, 0x02, 0xA8, 0x09, 0x00, 0xA9, 0x30, 0xC8, 0x2B, 0x16,
+  0x35, 0x01, 0x3B, 0x00, 0xEA, 0x0A, 0x22, 0x08, 0x42, 0x00, 0x32, 0xC2, 0x9E, 0x64, 0x81, 0xBB,
+  0x0A, 0x31, 0x90, 0xAC, 0x20, 0xA0, 0x19, 0x81, 0xBE, 0x53, 0xA0, 0xAE, 0x12, 0x00, 0x52, 0xA1,
+  0x40, 0x03, 0xBF, 0x51, 0x13, 0xCB, 0x8A, 0x01, 0x82, 0xAA, 0x08, 0xA0, 0x28, 0xA2, 0xAF, 0x43,
+  0xB1, 0xBD, 0x40, 0x80, 0x38, 0x05, 0x19, 0x53, 0xE9, 0x19, 0x35, 0xB8, 0x9C, 0x18, 0x10, 0xA0,
+  0x9A, 0x00, 0x08, 0x10, 0xDA, 0x29, 0x04, 0xE9, 0x1B, 0x82, 0x01, 0x37, 0x99, 0x53, 0xC2, 0x8E,
+  0x62, 0x91, 0xAB, 0x00, 0x00, 0x00, 0xB8, 0x0A, 0x12, 0xA8, 0x89, 0x08, 0x20, 0x98, 0xEF, 0x21,
+  0x80, 0x60, 0x83, 0x19, 0x25, 0xDC, 0x49, 0x15, 0xBA, 0x0A, 0x01, 0x08, 0x80, 0x9B, 0x20, 0x90,
+  0x8A, 0x08, 0x80, 0x08, 0xD8, 0x8F, 0x03, 0x10, 0x55, 0x98, 0x62, 0xC2, 0x9D, 0x44, 0xA1, 0xAB,
+  0x10, 0x88, 0x11, 0xC9, 0x49, 0xFB, 0x3F, 0x00, 0x1B, 0x33, 0xBA, 0x8A, 0x02, 0x29, 0x01, 0xFF,
+  0x20, 0x01, 0x39, 0x83, 0x38, 0x17, 0xCC, 0x38, 0x17, 0xBA, 0x89, 0x81, 0x10, 0x90, 0xAD, 0x31,
+  0xA1, 0x0B, 0x81, 0x0B, 0x36, 0xC9, 0x8B, 0x33, 0x01, 0x43, 0xA9, 0x72, 0xA5, 0x9E, 0x43, 0xA1,
+  0x8B, 0xA0, 0x1A, 0x15, 0xDA, 0x19, 0x00, 0x98, 0x01, 0x88, 0x39, 0x06, 0xD8, 0x19, 0x43, 0x91,
+  0x89, 0x38, 0x15, 0xDA, 0x0A, 0x34, 0xA0, 0xAA, 0xBB, 0x69, 0x13, 0xFA, 0x9A, 0x10, 0x11, 0x01,
+  0xC9, 0x78, 0x02, 0xAB, 0x51, 0x13, 0xAA, 0x9A, 0x41, 0x13, 0xCD, 0x08, 0x12, 0x18, 0xDA, 0x9B,
+  0x52, 0x91, 0xBA, 0xBC, 0x38, 0x24, 0x91, 0x99, 0x56, 0xA8, 0x1A, 0x26, 0x00, 0xB9, 0x9C, 0x52,
+  0x91, 0x9B, 0x88, 0x19, 0x15, 0xBD, 0x28, 0x81, 0x18, 0xFA, 0x8B, 0x33, 0x01, 0x18, 0x10, 0x16,
+  0xBA, 0x71, 0x03, 0x98, 0xCB, 0x19, 0x33, 0xCA, 0xE3, 0x02, 0x39, 0x00, 0x9A, 0x08, 0x20, 0xD1,
+  0x8D, 0x01, 0x20, 0xD0, 0x9E, 0x00, 0x32, 0x03, 0x8B, 0x47, 0xC0, 0x29, 0x05, 0x09, 0x91, 0xAD,
+  0x22, 0xA1, 0x89, 0xA9, 0x19, 0x04, 0xCB, 0x0A, 0x01, 0x13, 0xFA, 0x0F, 0x11, 0x22, 0xA1, 0x38,
+  0x02, 0x09, 0x25, 0x02, 0x88, 0xBF, 0x18, 0x02, 0x99, 0xC9, 0x8A, 0x00, 0x90, 0xE9, 0x3B, 0x00,
+  0xE2, 0xEB, 0x29, 0x72, 0x92, 0x00, 0x03, 0x0C, 0x33, 0x00, 0x14, 0xCD, 0x0A, 0x01, 0x00, 0xB8,
+  0x9D, 0x01, 0x08, 0x90, 0xAD, 0x28, 0x02, 0xC0, 0xDD, 0x49, 0x32, 0x02, 0x92, 0x49, 0x80, 0x40,
+  0x03, 0x12, 0xFC, 0x8C, 0x01, 0x01, 0x91, 0xAE, 0x19, 0x12, 0x80, 0xCB, 0x1A, 0x22, 0xB3, 0xCF,
+  0x08, 0x62, 0x12, 0x88, 0x01, 0x0A, 0x61, 0x01, 0x81, 0xCC, 0x1A, 0x81, 0x11, 0xE1, 0x8B, 0x00,
+  0x20, 0xC3, 0x8E, 0x80, 0x10, 0xB2, 0x9E, 0x09, 0x43, 0x24, 0x10, 0x9A, 0x5C, 0x00, 0x34, 0x00,
+  0x08, 0x44, 0x43, 0xA1, 0xBE, 0x09, 0x32, 0x01, 0xD9, 0xAC, 0x38, 0x13, 0xA8, 0xAF, 0x08, 0x12,
+  0xC1, 0x9C, 0x2C, 0x22, 0x07, 0x10, 0x8A, 0x18, 0x23, 0x34, 0xB1, 0xAF, 0x08, 0x11, 0x22, 0xBD,
+  0x8A, 0x00, 0x33, 0xF8, 0x0C, 0x98, 0x22, 0xF0, 0x0A, 0x19, 0x20, 0x07, 0x00, 0x89, 0x09, 0x32,
+  0x27, 0xB8, 0x9B, 0x99, 0x62, 0x92, 0x9C, 0x99, 0x18, 0x05, 0xA9, 0xAA, 0x0B, 0x15, 0x9B, 0xD0,
+  0x1B, 0x54, 0x20, 0xB3, 0x8B, 0x03, 0x79, 0x85, 0x89, 0xA8, 0x0C, 0x23, 0x88, 0xA1, 0x9F, 0x20,
+  0x18, 0x91, 0xBC, 0x00, 0x0A, 0x03, 0xAF, 0x20, 0x38, 0x27, 0x99, 0x01, 0x1D, 0x16, 0x88, 0x81,
+  0xAC, 0x12, 0x08, 0x83, 0x9D, 0x80, 0x0A, 0x84, 0x8B, 0x90, 0x9C, 0x09, 0xF1, 0x18, 0x28, 0x51,
+  0xA4, 0x01, 0x89, 0x70, 0x83, 0x81, 0xBA, 0x1B, 0x81, 0x43, 0xE0, 0x1A, 0xBA, 0x38, 0xD3, 0x3A,
+  0x2E, 0x01, 0x32, 0x00, 0xE8, 0x3B, 0xBC, 0x02, 0xB8, 0x45, 0x19, 0x14, 0x9B, 0x13, 0x68, 0x14,
+  0x8B, 0xC8, 0x09, 0x13, 0x10, 0xBA, 0x9E, 0x00, 0x20, 0xD0, 0x9A, 0xAB, 0xB0, 0xA8, 0xA8, 0x5F,
+  0x83, 0x53, 0xA8, 0x28, 0x02, 0x75, 0xA0, 0x80, 0xBA, 0x31, 0x00, 0x81, 0xCD, 0x80, 0x1A, 0x02,
+  0x9B, 0xF9, 0x89, 0x2B, 0x09, 0x8A, 0x85, 0x55, 0x81, 0x1A, 0xA1, 0x73, 0x03, 0x89, 0xDA, 0x18,
+  0x11, 0x03, 0xCB, 0xBA, 0x09, 0x14, 0x80, 0xFC, 0x98, 0x1D, 0x01, 0x89, 0x84, 0x49, 0x02, 0x28,
+  0x91, 0x70, 0x82, 0x11, 0xCB, 0x08, 0x19, 0x05, 0x98, 0xE9, 0x0A, 0x08, 0x12, 0xD9, 0xB8, 0x0F,
+  0x90, 0x28, 0xA3, 0x78, 0x80, 0x20, 0x98, 0x34, 0x18, 0x03, 0xCA, 0x98, 0x1B, 0x05, 0x08, 0xD9,
+  0x0C, 0xA9, 0x31, 0xDA, 0xC1, 0x0F, 0xA0, 0x20, 0xA2, 0x61, 0x88, 0x12, 0x08, 0x23, 0x59, 0x92,
+  0x99, 0xB8, 0x4B, 0xA0, 0x52, 0x04, 0x2E, 0x00, 0x04, 0xBC, 0xA9, 0x8C, 0x91, 0x0A, 0xFA, 0x1E,
+  0x9B, 0x23, 0x39, 0x07, 0x28, 0x91, 0x40, 0x81, 0x62, 0xA8, 0x91, 0x9B, 0x00, 0x29, 0xC3, 0x9B,
+  0xAD, 0x0A, 0xA0, 0x41, 0xDF, 0xB2, 0x2A, 0x02, 0x71, 0x00, 0x12, 0x89, 0x22, 0x38, 0x04, 0x00,
+  0xEA, 0x99, 0x98, 0x32, 0x99, 0xF0, 0x8B, 0xA9, 0x3A, 0xF1, 0x09, 0x9D, 0x81, 0x51, 0x13, 0x23,
+  0x98, 0x08, 0x12, 0x37, 0x10, 0xC8, 0x9C, 0x99, 0x21, 0x01, 0xB0, 0x9F, 0xAA, 0xC0, 0x12, 0x0F,
+  0xC8, 0x00, 0x29, 0x33, 0x42, 0x92, 0x11, 0x19, 0x34, 0x21, 0xA4, 0x9C, 0xBD, 0x99, 0x82, 0x48,
+  0xD8, 0x89, 0xCC, 0x91, 0x3E, 0xC8, 0x03, 0x2B, 0x20, 0x22, 0x16, 0x28, 0x80, 0x20, 0xA1, 0x22,
+  0xBF, 0xC8, 0x8C, 0x91, 0x69, 0xA0, 0x01, 0x0B, 0x9A, 0xC2, 0x41, 0x19, 0x22, 0x4B, 0xA6, 0x32,
+  0x29, 0x11, 0x88, 0xB3, 0xAE, 0xFB, 0x8A, 0x8B, 0x42, 0xF7, 0x2F, 0x00, 0x82, 0x42, 0x00, 0x84,
+  0x2A, 0x2A, 0x12, 0x17, 0x30, 0x8A, 0xA8, 0x02, 0x20, 0x13, 0x0A, 0x9D, 0xBF, 0xF3, 0x0C, 0xAC,
+  0x01, 0x20, 0x23, 0x41, 0x89, 0x01, 0x49, 0x07, 0x41, 0xA0, 0x91, 0x8A, 0x90, 0x00, 0x99, 0xA9,
+  0xDF, 0xC0, 0x1D, 0xD9, 0x02, 0x19, 0x22, 0x38, 0xA4, 0x12, 0x3A, 0x22, 0x14, 0x22, 0xB9, 0x89,
+  0x9F, 0xA0, 0x80, 0xAC, 0xE9, 0xC9, 0x8C, 0xDA, 0x10, 0x18, 0x34, 0x30, 0x13, 0x19, 0x84, 0x70,
+  0x82, 0x02, 0xA8, 0xA8, 0x9C, 0xB8, 0x99, 0xAC, 0xAB, 0xCF, 0xA8, 0x8C, 0x18, 0x40, 0x15, 0x42,
+  0x01, 0x01, 0x10, 0x22, 0x22, 0x80, 0x9A, 0xF9, 0x98, 0xAD, 0xB9, 0xAC, 0xD0, 0x1B, 0xDB, 0x81,
+  0x18, 0x36, 0x50, 0x13, 0x20, 0x81, 0x30, 0x08, 0x02, 0xBA, 0x90, 0xCE, 0x98, 0xAE, 0xC0, 0x0A,
+  0x9C, 0xC8, 0x92, 0x4A, 0x23, 0x25, 0x24, 0x38, 0x82, 0x12, 0x80, 0x20, 0xE2, 0x0A, 0x27, 0x00,
+  0xEB, 0x88, 0xBB, 0x99, 0xAE, 0xEA, 0x98, 0x0D, 0xC9, 0x92, 0x3A, 0x41, 0x23, 0x07, 0x30, 0x00,
+  0x11, 0x90, 0x10, 0xBA, 0x90, 0xBB, 0xAD, 0xBC, 0xBD, 0xB9, 0x8D, 0xBA, 0x88, 0x99, 0x47, 0x21,
+  0x34, 0x11, 0x13, 0x20, 0x82, 0x19, 0xCA, 0xA9, 0xBA, 0x8F, 0xF9, 0x89, 0xBC, 0x98, 0x9C, 0x92,
+  0x49, 0x33, 0x62, 0x13, 0x32, 0x02, 0x21, 0x90, 0x09, 0xCA, 0xB9, 0xA9, 0xAF, 0xF8, 0x8A, 0xAA,
+  0x9A, 0x98, 0x3A, 0x31, 0x47, 0x33, 0x42, 0x22, 0x31, 0x81, 0x10, 0xBA, 0xA9, 0xFB, 0x89, 0xEB,
+  0x99, 0xAC, 0xAA, 0xAA, 0x09, 0xA2, 0x73, 0x24, 0x25, 0x22, 0x31, 0x83, 0x21, 0x19, 0xAC, 0xD0,
+  0x8A, 0xAC, 0xCA, 0xBA, 0x9D, 0x9A, 0xBA, 0x20, 0x1B, 0x27, 0x22, 0x35, 0x32, 0x33, 0x13, 0x02,
+  0x98, 0x8A, 0xCD, 0xBB, 0xDC, 0xAB, 0xEA, 0x9A, 0xAA, 0x9A, 0x09, 0x28, 0x35, 0x34, 0x35, 0x32,
+  0xE6, 0x00, 0x23, 0x00, 0x24, 0x11, 0x11, 0xA8, 0xA9, 0xBD, 0xBD, 0xCA, 0xAC, 0xAA, 0xAC, 0xA8,
+  0x1A, 0x02, 0x23, 0x37, 0x42, 0x42, 0x12, 0x24, 0x80, 0x80, 0xB0, 0xA9, 0xCC, 0xBB, 0xEB, 0x99,
+  0x8C, 0x99, 0x80, 0x22, 0x48, 0x44, 0x03, 0x44, 0x21, 0x32, 0x23, 0x08, 0x90, 0x8D, 0xAB, 0xBB,
+  0xCD, 0xBA, 0x88, 0x9C, 0x00, 0x88, 0x64, 0x20, 0x04, 0x03, 0x63, 0x20, 0x01, 0x08, 0x08, 0x08,
+  0x9E, 0xAB, 0xAB, 0xEA, 0x80, 0x9C, 0x00, 0x08, 0x08, 0x29, 0x17, 0x48, 0x82, 0x28, 0x85, 0x80,
+  0x00, 0xB8, 0xD1, 0x1B, 0xBD, 0xD0, 0x1A, 0x08, 0x0B, 0xF2, 0x28, 0x4A, 0x91, 0x00, 0x08, 0x69,
+  0x83, 0x08, 0x08, 0x08, 0x08, 0x27, 0x8E, 0x80, 0x00, 0x88, 0x00, 0x88, 0xF1, 0x4C, 0xB1, 0x21,
+  0x08, 0x08, 0x90, 0x64, 0x80, 0x80, 0x80, 0x78, 0x81, 0x00, 0xB0, 0x8D, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x2B, 0x92, 0x00, 0x82, 0x00, 0x09, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0xA1,
+  0x93, 0xFF, 0x9F, 0x18, 0xFA, 0x08, 0x88, 0x00, 0x8F, 0xB3, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xF1, 0x9F, 0x80, 0x80, 0x00, 0xBE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA0, 0x77,
+  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x29, 0x97, 0x0C, 0x72, 0x83, 0x00, 0x08, 0x08,
+  0x88, 0x67, 0x08, 0x08, 0x08, 0x58, 0x84, 0x08, 0x08, 0x08, 0x08, 0x08, 0x47, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x80, 0x00, 0x7C, 0xC7, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x8F, 0xB5, 0xAF, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xF7, 0x3E, 0xC1, 0x3D, 0x03, 0x9D, 0x04, 0x80, 0x80,
+  0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // six
+  0x96, 0xFF, 0x00, 0x00, 0x70, 0xF7, 0x34, 0x8F, 0x91, 0x2A, 0x86, 0x08, 0xAC, 0xA3, 0x0A, 0x04,
+  0x19, 0x80, 0x5E, 0xA0, 0x21, 0x1C, 0x02, 0x08, 0x90, 0x29, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80,
+  0xC1, 0x77, 0xB3, 0x23, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x19, 0x97, 0x3B, 0xD4, 0x08, 0x79,
+  0xC4, 0x21, 0x8C, 0x81, 0x99, 0x00, 0xB8, 0x22, 0x0C, 0xE4, 0x1A, 0xD8, 0x19, 0x98, 0x28, 0xD9,
+  0x38, 0xAD, 0x29, 0xD1, 0x19, 0xBA, 0x28, 0x9E, 0x91, 0x88, 0x2C, 0x5B, 0xFA, 0x18, 0x18, 0xA8,
+  0x80, 0x18, 0xBC, 0x18, 0x93, 0x98, 0x18, 0x40, 0xCF, 0x05, 0x1B, 0x81, 0x01, 0xA9, 0x05, 0x10,
+  0x08, 0x80, 0x31, 0x9A, 0xC7, 0x42, 0x89, 0x25, 0x1A, 0x3A, 0xB6, 0x69, 0x00, 0x00, 0x98, 0x12,
+  0x82, 0x04, 0x49, 0xC1, 0x22, 0x59, 0x92, 0x80, 0x95, 0x8A, 0x51, 0x80, 0x08, 0x1A, 0x03, 0xB7,
+  0x38, 0x8C, 0x80, 0x20, 0x49, 0x01, 0x17, 0x00, 0x2B, 0x97, 0x39, 0x8C, 0xB0, 0x18, 0x62, 0xBC,
+  0x18, 0x19, 0xC4, 0x19, 0xD1, 0x58, 0x8A, 0x19, 0xA9, 0x92, 0x58, 0x0B, 0x1B, 0x9C, 0x87, 0x28,
+  0xAC, 0xA3, 0xA8, 0x41, 0xB0, 0x33, 0x0D, 0x4A, 0xC0, 0x22, 0x0B, 0x93, 0x1F, 0x91, 0x18, 0xD4,
+  0x20, 0x10, 0x0C, 0xB5, 0x20, 0xB1, 0x50, 0x8B, 0x03, 0x1B, 0x17, 0x08, 0x09, 0xA9, 0x94, 0x21,
+  0xD3, 0x7B, 0x90, 0x10, 0x09, 0x1A, 0x97, 0x08, 0x8A, 0x94, 0x2A, 0x80, 0x1B, 0xD2, 0xC2, 0x18,
+  0x3A, 0xAB, 0xC2, 0x3B, 0xA3, 0xAC, 0xCF, 0x23, 0x8F, 0xA1, 0x18, 0x98, 0x1A, 0xF0, 0x00, 0x98,
+  0x4B, 0xA3, 0x1D, 0xE0, 0x20, 0x89, 0x80, 0x0C, 0x83, 0x0C, 0x02, 0x1D, 0x91, 0x18, 0x2C, 0x20,
+  0xAB, 0x94, 0x2E, 0x01, 0x99, 0x30, 0x93, 0x08, 0x29, 0xD7, 0x50, 0x89, 0x10, 0xD0, 0x02, 0x48,
+  0xA9, 0x84, 0x5B, 0x91, 0x48, 0xB0, 0x41, 0x08, 0xFF, 0xFE, 0x1F, 0x00, 0x83, 0x9A, 0x87, 0x08,
+  0x22, 0xA9, 0x41, 0x10, 0xD2, 0x14, 0x29, 0x20, 0xA1, 0x4B, 0x95, 0x09, 0x79, 0x98, 0x10, 0x10,
+  0x39, 0xF3, 0x48, 0x4B, 0x99, 0x94, 0x09, 0xC2, 0x49, 0x90, 0x09, 0x80, 0x3B, 0xF0, 0x69, 0xA9,
+  0x01, 0xAA, 0x94, 0xA8, 0x42, 0x8E, 0x80, 0x80, 0xB1, 0x3B, 0x9A, 0xB9, 0xA5, 0x4F, 0xC9, 0x12,
+  0xAA, 0x12, 0x0D, 0xB1, 0x88, 0x18, 0x89, 0x3D, 0xC0, 0x10, 0x8E, 0x92, 0x3A, 0xC1, 0x80, 0x80,
+  0x0A, 0xE2, 0x30, 0x8D, 0xA3, 0xC2, 0x08, 0xB3, 0x58, 0xC0, 0x84, 0x4B, 0x00, 0x0A, 0x88, 0x83,
+  0xD5, 0x60, 0x89, 0x81, 0x09, 0x02, 0x92, 0x90, 0x84, 0x90, 0x78, 0x90, 0x42, 0x89, 0x29, 0x38,
+  0x17, 0x1A, 0xB1, 0x83, 0x42, 0xB8, 0xB4, 0x35, 0x2C, 0x22, 0x8F, 0x83, 0x3A, 0xD4, 0x29, 0x88,
+  0x20, 0xD9, 0x33, 0xEA, 0x20, 0x19, 0x00, 0x99, 0x88, 0x92, 0xB1, 0x1F, 0x9E, 0x00, 0x1E, 0x00,
+  0x28, 0xA0, 0x48, 0xC9, 0xA0, 0x02, 0xCB, 0x15, 0x3E, 0xB0, 0x1A, 0x19, 0x21, 0xF8, 0x28, 0x8D,
+  0x83, 0x99, 0x3C, 0x81, 0xC1, 0x11, 0xA9, 0x48, 0x93, 0x8E, 0xA2, 0x48, 0x86, 0xA9, 0x50, 0x89,
+  0x11, 0xD8, 0x02, 0x30, 0x8A, 0x15, 0x1F, 0x91, 0x81, 0x09, 0x05, 0x1A, 0xA0, 0x83, 0x89, 0x3D,
+  0x12, 0xB9, 0x42, 0x5B, 0x08, 0xD8, 0x96, 0x1B, 0x92, 0x4A, 0xB8, 0x08, 0xF9, 0x23, 0x0C, 0x92,
+  0x3D, 0xD2, 0x08, 0x18, 0x1B, 0x99, 0xA0, 0x95, 0x8F, 0x01, 0x88, 0x90, 0x3C, 0xC0, 0x08, 0xF2,
+  0x38, 0x99, 0x29, 0xB9, 0x82, 0xC9, 0x21, 0xCA, 0x34, 0xAF, 0x51, 0x9A, 0x82, 0x8A, 0x84, 0x1B,
+  0xB5, 0x1A, 0xA4, 0x6B, 0x91, 0x09, 0x91, 0x20, 0x99, 0x22, 0x2D, 0x08, 0xE1, 0x73, 0xC9, 0x02,
+  0x01, 0x09, 0x94, 0x18, 0x99, 0x24, 0x1C, 0x02, 0x09, 0x13, 0x09, 0x2A, 0x23, 0x0D, 0x07, 0x92,
+  0x01, 0x01, 0x1F, 0x00, 0x40, 0xC0, 0x10, 0x12, 0x8B, 0x36, 0x0E, 0xA2, 0x78, 0x9A, 0x11, 0xC1,
+  0x31, 0xAA, 0x38, 0x29, 0x91, 0x18, 0x85, 0xAD, 0x78, 0x9A, 0xA3, 0x18, 0xA0, 0x4B, 0x29, 0xE0,
+  0x93, 0x2C, 0x0A, 0xA8, 0xA1, 0x3A, 0xA4, 0x0F, 0xC2, 0x4B, 0xC0, 0x31, 0xEA, 0x21, 0x0B, 0x0A,
+  0xA5, 0x09, 0xB0, 0x49, 0x9C, 0x97, 0x0A, 0x10, 0x9B, 0x85, 0x8A, 0xA0, 0x38, 0x99, 0x21, 0xD9,
+  0x7A, 0xB1, 0x1A, 0xB3, 0x68, 0x8B, 0xA4, 0x2A, 0x91, 0x02, 0xAA, 0x06, 0x0E, 0x01, 0x29, 0xB4,
+  0x4B, 0xB1, 0x25, 0xAB, 0x43, 0xBA, 0x86, 0x3B, 0x20, 0x8E, 0x96, 0x10, 0x1B, 0x81, 0x91, 0xC3,
+  0x68, 0x0A, 0xA2, 0x20, 0x99, 0x13, 0x81, 0x91, 0xF2, 0x32, 0x8B, 0x04, 0x1E, 0xA3, 0x4A, 0xB1,
+  0x48, 0x9A, 0x86, 0x2A, 0x80, 0xD3, 0x28, 0xC9, 0x23, 0x1F, 0x92, 0x1B, 0xA1, 0x92, 0x3B, 0xF2,
+  0x20, 0x1B, 0xB2, 0x80, 0x96, 0x01, 0x21, 0x00, 0x5B, 0xF8, 0x32, 0x9C, 0x81, 0x0B, 0xA2, 0x3B,
+  0x93, 0x8D, 0xD3, 0x1A, 0x81, 0x18, 0xE7, 0x38, 0x9B, 0x94, 0x1A, 0xC3, 0x4A, 0xAB, 0x14, 0xB8,
+  0x7B, 0xA9, 0x83, 0x91, 0xC2, 0x68, 0x9B, 0x92, 0x5C, 0xC1, 0x30, 0xB9, 0x33, 0x8E, 0x80, 0x01,
+  0x91, 0x4C, 0x98, 0x02, 0x90, 0x5A, 0x09, 0xB4, 0x12, 0x8C, 0x38, 0x9B, 0x07, 0x3C, 0x98, 0x28,
+  0xF3, 0x41, 0x8B, 0xA4, 0x29, 0xB1, 0x79, 0xB8, 0x13, 0xB8, 0x70, 0x9A, 0xA5, 0x28, 0xB0, 0x48,
+  0xB9, 0x05, 0x0A, 0x00, 0x8A, 0xA4, 0x39, 0xA1, 0x79, 0xB8, 0x83, 0x0B, 0x22, 0x1F, 0xC3, 0x38,
+  0xAA, 0x31, 0x0D, 0xA5, 0x39, 0xB8, 0x31, 0x8C, 0x94, 0x1B, 0xE2, 0x39, 0xBA, 0x02, 0x9C, 0xA3,
+  0x2E, 0xB1, 0x71, 0x18, 0x05, 0x38, 0x81, 0x21, 0xB9, 0xA0, 0xAF, 0xEA, 0x99, 0xDB, 0x89, 0x8F,
+  0xC0, 0x38, 0x08, 0x37, 0x32, 0x14, 0x30, 0x88, 0xE9, 0x2A, 0x3C, 0x00, 0xB0, 0x9C, 0xBD, 0xB9,
+  0x8A, 0x09, 0x89, 0xC1, 0xA0, 0x8C, 0xDC, 0x09, 0x1A, 0x35, 0x66, 0x12, 0x22, 0x00, 0xA1, 0x0A,
+  0xAE, 0xB9, 0x9A, 0x89, 0x10, 0x18, 0xD2, 0x81, 0x0F, 0xAA, 0xC8, 0x81, 0x68, 0x40, 0x25, 0x13,
+  0x01, 0x19, 0xBA, 0xC9, 0xBB, 0xBA, 0x1B, 0x98, 0x06, 0x29, 0xB0, 0x0A, 0xFB, 0x98, 0x8F, 0x81,
+  0x20, 0x35, 0x45, 0x01, 0x92, 0x88, 0xB9, 0xB9, 0xAD, 0xA8, 0x09, 0x00, 0x11, 0x88, 0xA8, 0xD9,
+  0x8A, 0x9F, 0xE1, 0x39, 0x88, 0x26, 0x62, 0x12, 0x10, 0xA9, 0x90, 0x9B, 0xEA, 0x88, 0x0A, 0x91,
+  0x01, 0x89, 0x98, 0x0C, 0xEA, 0xC3, 0x4C, 0xCA, 0x12, 0x2A, 0x16, 0x73, 0x00, 0x81, 0x89, 0xA8,
+  0x98, 0x8C, 0xA8, 0x18, 0x88, 0x81, 0x8A, 0xA9, 0x1B, 0xCC, 0xD5, 0x4A, 0xDA, 0x03, 0x4A, 0x23,
+  0x45, 0x01, 0x81, 0x0A, 0xAA, 0xC8, 0x99, 0xAA, 0x00, 0x29, 0xD1, 0x80, 0x7A, 0xF8, 0x38, 0x00,
+  0x0C, 0xB8, 0x19, 0x8C, 0xF2, 0x83, 0x2F, 0xA1, 0x34, 0x43, 0x05, 0x28, 0xAA, 0xB1, 0x89, 0xAC,
+  0x99, 0x0A, 0xA2, 0x21, 0x9B, 0xC0, 0x1B, 0xBD, 0xA5, 0x3A, 0x8B, 0xF1, 0x30, 0x6A, 0x34, 0x44,
+  0x81, 0x91, 0x0B, 0xBA, 0xB9, 0x9E, 0x98, 0x28, 0x18, 0xB1, 0x89, 0xBA, 0x98, 0x4E, 0xA9, 0xC4,
+  0x00, 0x1F, 0x91, 0x43, 0x34, 0x06, 0x18, 0xA9, 0xA0, 0x8A, 0xBB, 0x9A, 0x89, 0x93, 0x12, 0x8B,
+  0xCB, 0xCB, 0xC8, 0x20, 0x4D, 0xB9, 0xD7, 0x48, 0x1A, 0x24, 0x42, 0x93, 0x00, 0x0C, 0xB9, 0xA0,
+  0x9C, 0x98, 0x28, 0x88, 0xA1, 0x99, 0xAB, 0x8B, 0x2C, 0xC1, 0x97, 0x7C, 0xAB, 0x97, 0x38, 0x11,
+  0x43, 0x09, 0xC1, 0x00, 0x8C, 0xB0, 0x1A, 0xA9, 0x12, 0x3B, 0xC8, 0x00, 0x9C, 0xB2, 0x48, 0x1A,
+  0xC4, 0x03, 0x1F, 0xB2, 0x34, 0x43, 0x05, 0x19, 0xB8, 0xA0, 0x8A, 0xBC, 0x89, 0x09, 0xB2, 0x11,
+  0x6F, 0xFF, 0x32, 0x00, 0x8D, 0xA9, 0x99, 0xB9, 0xA5, 0x71, 0x2B, 0xE6, 0x30, 0x8A, 0x15, 0x30,
+  0x92, 0x00, 0x9B, 0xC8, 0x89, 0xEB, 0x81, 0x2A, 0xA0, 0x01, 0xBB, 0xC3, 0x3B, 0x9B, 0x85, 0x58,
+  0x88, 0xA6, 0x6A, 0x88, 0x23, 0x31, 0x82, 0x2A, 0xAD, 0xD1, 0x89, 0x9B, 0x29, 0x9A, 0xA5, 0x08,
+  0x0B, 0x99, 0x0B, 0xF4, 0x23, 0x5C, 0xA1, 0x03, 0x4B, 0x81, 0x41, 0xA2, 0x86, 0x2A, 0xB9, 0x90,
+  0xAA, 0x98, 0x1C, 0xA0, 0x10, 0xAB, 0x99, 0xCC, 0x00, 0x3C, 0x94, 0x07, 0x51, 0x29, 0xA3, 0x22,
+  0x21, 0x62, 0x0A, 0xD1, 0x98, 0xA9, 0x9B, 0x8F, 0xB0, 0x11, 0x3C, 0x98, 0xA1, 0x01, 0x38, 0x30,
+  0xA5, 0x27, 0x39, 0x92, 0x31, 0xA9, 0xA2, 0x0F, 0xC8, 0x81, 0x1B, 0xB9, 0x00, 0x8F, 0xC2, 0x19,
+  0xB8, 0x40, 0x0B, 0xB4, 0x20, 0x4D, 0x01, 0x16, 0x13, 0x21, 0x0A, 0xB9, 0xE0, 0x89, 0x9C, 0x99,
+  0xCB, 0xC8, 0xAB, 0x89, 0xB5, 0xEF, 0x2D, 0x00, 0x1E, 0x83, 0x35, 0x63, 0x22, 0x81, 0x91, 0x0A,
+  0xAD, 0xB9, 0x8B, 0xB8, 0x22, 0x0C, 0xB2, 0x10, 0x8A, 0x43, 0x7A, 0xA2, 0x07, 0x3A, 0xA0, 0x00,
+  0x0A, 0x92, 0x5B, 0xC8, 0x04, 0x4B, 0xA8, 0x84, 0x2A, 0x80, 0x39, 0xD0, 0x23, 0x1D, 0x90, 0xC2,
+  0x40, 0x1B, 0xA3, 0x08, 0x82, 0x4C, 0xC0, 0x12, 0x1B, 0xA1, 0x38, 0x8A, 0x97, 0x39, 0x99, 0x93,
+  0x10, 0x08, 0x08, 0x88, 0x47, 0x9A, 0x94, 0x29, 0xCB, 0x80, 0x80, 0xC1, 0x3F, 0xC0, 0x22, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0xA1, 0xBF, 0x80, 0xA8, 0xC3, 0x0F, 0x90, 0x80, 0x90, 0x9F, 0x00, 0x08,
+  0x08, 0x1D, 0xF2, 0x08, 0x08, 0x08, 0x18, 0xDB, 0x08, 0x08, 0x08, 0xF9, 0x09, 0x08, 0x48, 0x84,
+  0x08, 0x08, 0x08, 0x0D, 0xC9, 0x80, 0x71, 0x80, 0x81, 0x08, 0x08, 0x80, 0x80, 0x08, 0x18, 0x7A,
+  0x07, 0x08, 0x80, 0x80, 0x80, 0x08, 0x08, 0x90, 0xD1, 0xFD, 0x14, 0x00, 0x77, 0x08, 0x08, 0x08,
+  0x18, 0x17, 0x88, 0x80, 0x80, 0x80, 0x90, 0x37, 0x08, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xF7, 0xFF,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80,
+  0x80, 0x10, 0x6B, 0xFF, 0xAF, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x7A, 0x37, 0x80, 0x80,
+  0x80, 0x80, 0x00, 0x88, 0x80, 0xF2, 0xCF, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80,
+  0x78, 0x27, 0xA2, 0x4A, 0xAE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x7A,
+  0x77, 0x1A, 0x81, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x5B, 0xFE, 0xD2, 0xFF, 0x12, 0x00,
+  0xAF, 0x8C, 0x80, 0x80, 0x80, 0x80, 0x78, 0x07, 0x00, 0x2C, 0x01, 0x1B, 0xD2, 0x18, 0xB1, 0xC0,
+  0x1B, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x88, 0x90, 0xA1, 0x74, 0x77, 0x21,
+  0x82, 0x08, 0x08, 0x08, 0x18, 0xCB, 0xAA, 0xE1, 0x89, 0x37, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x08, 0x08, 0x49, 0xFF, 0x1C, 0xD8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xA1, 0x76, 0x03, 0x81,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0xFC, 0xCF, 0x8A, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x90, 0x16, 0x8D, 0x73, 0x80, 0x42, 0x80, 0x80, 0x2B, 0x92, 0xA1, 0x5D, 0xD9, 0xA0, 0x6C,
+  0x90, 0x2A, 0x91, 0x20, 0xBA, 0x1D, 0xA1, 0x08, 0x60, 0xAA, 0x81, 0x08, 0x08, 0x08, 0xA0, 0x76,
+  0x12, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x59, 0xFD, 0x71, 0xFB, 0x37, 0x8C, 0x19, 0x97,
+  0x8E, 0x03, 0x38, 0x00, 0x0F, 0x13, 0xA8, 0x1C, 0x15, 0xBC, 0x52, 0xD0, 0x28, 0xB2, 0x3A, 0xB3,
+  0x2D, 0x93, 0x0A, 0x92, 0x0A, 0x23, 0xCB, 0x40, 0xB0, 0x39, 0xC3, 0x0F, 0x13, 0x8A, 0x88, 0x11,
+  0xB0, 0x1A, 0x83, 0x2B, 0x92, 0x3B, 0xF0, 0x2A, 0x05, 0xAA, 0x38, 0xA1, 0x9E, 0x21, 0xFB, 0x51,
+  0xB1, 0x39, 0x95, 0x8C, 0x03, 0xBB, 0x52, 0xC8, 0x28, 0x91, 0x8B, 0x15, 0xAA, 0x22, 0xB8, 0x18,
+  0x82, 0x0C, 0x04, 0xA9, 0x50, 0xB0, 0x32, 0xB9, 0x32, 0x80, 0xC8, 0x78, 0xA0, 0x20, 0x82, 0x9D,
+  0x15, 0xD8, 0x69, 0xB2, 0x18, 0x00, 0x0B, 0x80, 0x01, 0x0B, 0x17, 0xAC, 0x13, 0x9A, 0x32, 0xA1,
+  0x8A, 0x78, 0xC8, 0x42, 0xB8, 0x10, 0x39, 0xCC, 0x07, 0x89, 0x10, 0x9A, 0x02, 0x39, 0xAA, 0x49,
+  0xA3, 0x0F, 0x86, 0x0D, 0x84, 0x0B, 0x82, 0x0B, 0x02, 0xA9, 0x04, 0xBB, 0x33, 0x9F, 0x95, 0x09,
+  0x82, 0x8C, 0x84, 0x8A, 0x96, 0xFE, 0x2E, 0x00, 0x02, 0xBA, 0x23, 0x9D, 0x82, 0x88, 0x12, 0x9F,
+  0x02, 0x1C, 0x82, 0x0B, 0xA3, 0x99, 0x23, 0x9E, 0x82, 0x4B, 0x93, 0x9A, 0xB3, 0x2E, 0xA6, 0x3B,
+  0xA1, 0x2E, 0x94, 0x1A, 0x91, 0x98, 0x42, 0xD9, 0x25, 0xAA, 0x82, 0x08, 0x0A, 0xA7, 0x10, 0x08,
+  0x30, 0xAA, 0x03, 0x1F, 0x83, 0x91, 0x49, 0xE1, 0x40, 0xA0, 0x38, 0xC2, 0x38, 0xC8, 0x13, 0x39,
+  0xCA, 0x23, 0xA0, 0x4A, 0xB6, 0x68, 0xB8, 0x00, 0x30, 0x9A, 0x22, 0xCB, 0x23, 0xD0, 0x52, 0xAB,
+  0x82, 0x00, 0x09, 0xC2, 0x89, 0x15, 0x0D, 0xC1, 0x02, 0x0B, 0x83, 0xAB, 0x23, 0x9E, 0x84, 0xAC,
+  0xB3, 0x49, 0xA0, 0xD9, 0x09, 0x92, 0x79, 0xC9, 0x10, 0xAA, 0x5B, 0xC2, 0x18, 0xB8, 0x2C, 0x83,
+  0x1E, 0xA8, 0x09, 0x95, 0x1C, 0xB3, 0x0D, 0x83, 0x1C, 0xA4, 0x2C, 0x00, 0xC8, 0x02, 0x90, 0x31,
+  0xDA, 0x48, 0x9A, 0x15, 0xA0, 0x29, 0xB0, 0x7A, 0xE4, 0xFC, 0x26, 0x00, 0xA2, 0x98, 0x14, 0x8D,
+  0x32, 0x9A, 0xA3, 0x90, 0x87, 0x18, 0x39, 0xD8, 0x23, 0x2C, 0x03, 0xB8, 0x13, 0x3A, 0x20, 0x92,
+  0x71, 0xC5, 0x19, 0xA2, 0x63, 0x99, 0x82, 0x8A, 0x02, 0x40, 0xC1, 0x70, 0xB9, 0x32, 0x8A, 0x04,
+  0x0A, 0xA0, 0x4C, 0x12, 0x2B, 0xB1, 0x28, 0xE0, 0x14, 0x8D, 0x92, 0x0C, 0xA3, 0x3D, 0xA2, 0x0B,
+  0xA3, 0x90, 0x18, 0xCC, 0x40, 0x0B, 0xC9, 0x01, 0xFB, 0x02, 0x9C, 0x62, 0xDA, 0x00, 0x89, 0x18,
+  0xB1, 0x2A, 0xF2, 0x4A, 0xB1, 0x2C, 0xC3, 0x2A, 0xA2, 0x1D, 0x91, 0x09, 0xA1, 0x9A, 0x87, 0x0D,
+  0x13, 0xAB, 0x14, 0x8C, 0x00, 0xB2, 0x79, 0xA8, 0x00, 0xA0, 0x28, 0xB2, 0x61, 0xA0, 0x38, 0xBB,
+  0x84, 0x00, 0x52, 0xAC, 0x07, 0x1A, 0x01, 0x09, 0x32, 0xA0, 0x11, 0xA2, 0x68, 0x81, 0x52, 0x9A,
+  0x5A, 0x92, 0x06, 0x0A, 0x08, 0x12, 0xB2, 0x90, 0x50, 0x98, 0x26, 0x0E, 0x68, 0x01, 0x24, 0x00,
+  0x93, 0x49, 0x99, 0x93, 0x58, 0xA0, 0x88, 0x50, 0xA9, 0x92, 0x89, 0x25, 0xCC, 0x12, 0xA8, 0x32,
+  0xAD, 0x83, 0xA9, 0x5C, 0xE3, 0x28, 0xC0, 0x49, 0xB8, 0x20, 0x89, 0x9A, 0xE0, 0x50, 0xC8, 0x11,
+  0x9B, 0x92, 0x2D, 0xB3, 0x39, 0x9C, 0x29, 0xBB, 0x87, 0x9B, 0xC2, 0x5A, 0xB0, 0x00, 0xB2, 0x4A,
+  0xDA, 0x38, 0x98, 0x30, 0xB9, 0x8E, 0xB3, 0x69, 0xA1, 0x3A, 0xB1, 0x08, 0xB6, 0x4B, 0x20, 0xAB,
+  0x97, 0x3A, 0xD3, 0x28, 0x90, 0x00, 0x94, 0x29, 0x00, 0x92, 0x80, 0x3D, 0xA4, 0x09, 0x16, 0x1A,
+  0x16, 0x8B, 0x81, 0x62, 0x99, 0xB3, 0x40, 0x0A, 0x31, 0xB8, 0x16, 0x89, 0x41, 0x0A, 0x85, 0x99,
+  0x44, 0x0B, 0x12, 0xAA, 0x13, 0x22, 0xFB, 0x14, 0x0A, 0x21, 0x8C, 0xE2, 0x41, 0x90, 0xC1, 0x30,
+  0x8A, 0x10, 0xE1, 0x18, 0xAB, 0x03, 0xAA, 0xA2, 0xA1, 0x12, 0xFF, 0x08, 0x19, 0x92, 0x8D, 0xA2,
+  0x79, 0x00, 0x1E, 0x00, 0x1A, 0x8C, 0xA0, 0x91, 0x12, 0x8F, 0x89, 0x89, 0x90, 0x3A, 0xE1, 0x9A,
+  0x9F, 0x93, 0xCA, 0x81, 0x3C, 0xB3, 0x1C, 0x23, 0x9F, 0x84, 0x89, 0x3A, 0xAC, 0x83, 0x31, 0x9E,
+  0x81, 0x09, 0x04, 0x3B, 0xB5, 0xBB, 0x36, 0x8A, 0x13, 0xBB, 0x81, 0xAA, 0x57, 0x19, 0x90, 0x40,
+  0xB9, 0x53, 0xB8, 0x87, 0x1A, 0x00, 0x00, 0x31, 0xCB, 0x34, 0xBA, 0x33, 0x29, 0x06, 0xA9, 0x50,
+  0x29, 0xAA, 0x17, 0x4A, 0x00, 0x99, 0x02, 0x3B, 0x96, 0x1B, 0x96, 0x1C, 0x82, 0x00, 0x80, 0x29,
+  0xB2, 0x01, 0x48, 0x8C, 0x92, 0xB0, 0x7B, 0xB1, 0x18, 0xEB, 0x23, 0xAD, 0x12, 0x2B, 0xD0, 0x8A,
+  0xA0, 0x00, 0x08, 0x92, 0x9F, 0xA6, 0x1B, 0xA0, 0x81, 0x0A, 0x8F, 0xB3, 0x8A, 0x24, 0xEA, 0x81,
+  0x1B, 0xC0, 0x3A, 0xD8, 0x81, 0x1A, 0x0B, 0x93, 0xB8, 0x0A, 0x90, 0xCD, 0x62, 0x8A, 0xA9, 0x12,
+  0x50, 0x9C, 0x88, 0x11, 0x62, 0xFC, 0x18, 0x00, 0x91, 0x97, 0x3A, 0xDA, 0x52, 0x9B, 0x33, 0xBA,
+  0x60, 0x8A, 0x42, 0x0B, 0x02, 0x93, 0x89, 0x92, 0x27, 0x49, 0x18, 0x00, 0x14, 0x31, 0xAD, 0x27,
+  0x1B, 0x12, 0x09, 0x97, 0x8A, 0x14, 0x98, 0x50, 0xD0, 0x31, 0xA0, 0x30, 0xB1, 0x39, 0x90, 0x60,
+  0xB8, 0x22, 0xA0, 0x2B, 0x22, 0x7C, 0xC3, 0x89, 0xA1, 0x3B, 0x16, 0xCA, 0x03, 0x8D, 0x11, 0x99,
+  0x28, 0xA0, 0xA9, 0xF9, 0x38, 0x90, 0x18, 0xAF, 0x11, 0xF9, 0x01, 0x89, 0x01, 0x8C, 0x81, 0x9A,
+  0xCB, 0x83, 0x1A, 0xD0, 0xAB, 0xD0, 0x30, 0x8F, 0x93, 0x98, 0x00, 0xA9, 0x19, 0x99, 0xD9, 0xA2,
+  0x2F, 0xD9, 0x04, 0x1A, 0x99, 0x32, 0xAE, 0x94, 0x2D, 0xA2, 0x18, 0x90, 0x20, 0x81, 0x0A, 0xB1,
+  0x17, 0x3A, 0xA1, 0xA0, 0x33, 0x50, 0x90, 0x13, 0x31, 0x07, 0x2D, 0x86, 0x19, 0xA2, 0x31, 0x31,
+  0xA8, 0x06, 0x5A, 0x90, 0x92, 0x21, 0x39, 0x93, 0xBE, 0x00, 0x15, 0x00, 0x70, 0x09, 0x10, 0x96,
+  0x41, 0x1A, 0xA2, 0x90, 0x79, 0x90, 0x18, 0xC3, 0x78, 0xA0, 0x90, 0x94, 0x39, 0xC8, 0x22, 0x9E,
+  0x11, 0x89, 0x93, 0x98, 0xAA, 0x12, 0x19, 0xE5, 0x4B, 0xD1, 0x48, 0xBB, 0x84, 0x0A, 0x08, 0xC8,
+  0x80, 0xB0, 0x1B, 0x88, 0x00, 0xAC, 0xC9, 0x9C, 0x80, 0xB1, 0x3F, 0xAE, 0x00, 0x08, 0x89, 0x82,
+  0x2B, 0xF8, 0x68, 0xAC, 0x81, 0x08, 0x08, 0x18, 0xFA, 0x22, 0x9A, 0xB4, 0x48, 0xA8, 0xA0, 0x82,
+  0x2E, 0xC4, 0x29, 0x83, 0x08, 0x80, 0x80, 0x08, 0x80, 0x80, 0x79, 0xE1, 0x53, 0x80, 0x80, 0x80,
+  0x70, 0x9A, 0x05, 0x80, 0x80, 0x80, 0x60, 0x09, 0x83, 0x08, 0x08, 0x08, 0x80, 0x11, 0x47, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x5B, 0xF9, 0xFF, 0x8D, 0x80, 0x80, 0x00, 0x0A, 0x00, 0x18, 0x00,
+  0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x39, 0xFF, 0xA5, 0x3D, 0xA2, 0x3A, 0xB2, 0x11, 0x08, 0x08,
+  0x08, 0x18, 0xF9, 0x7A, 0xC8, 0x4B, 0xAA, 0x80, 0x03, 0x0C, 0x80, 0x80, 0x90, 0x47, 0x7C, 0xD0,
+  0x23, 0xBB, 0x30, 0xAA, 0x72, 0x92, 0x19, 0xCB, 0x08, 0x88, 0x23, 0xA9, 0x22, 0xEA, 0x32, 0x98,
+  0x25, 0x88, 0x51, 0x80, 0x00, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0xFF, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x99, 0xD4, 0x2E, 0xA8, 0x80, 0x80, 0x80, 0x80, 0xCF, 0x00, 0x08, 0x90, 0x9F, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x00, 0x08, 0x19, 0xF8, 0x9F, 0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00,
+  0x39, 0xFF, 0x0B, 0x60, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xB1,
+  0x77, 0x07, 0x08, 0x08, 0x08, 0x18, 0x27, 0x08, 0x08, 0x08, 0x08, 0x37, 0x08, 0x08, 0x08, 0x08,
+  0x01, 0x00, 0x17, 0x00, 0x08, 0x67, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x91, 0x79, 0xFF, 0x9F,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x90, 0xF3, 0x5E, 0xBB, 0xDC,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x7A, 0x17, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80,
+  0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // seven
+  0xA4, 0xFF, 0x00, 0x00, 0xF0, 0x77, 0xF0, 0x31, 0x9C, 0xA3, 0x11, 0x1D, 0xA1, 0x0A, 0x02, 0xB5,
+  0x6A, 0xC0, 0x03, 0x3B, 0xE0, 0x82, 0x28, 0x1C, 0xB2, 0x21, 0xD8, 0x23, 0x1D, 0xB5, 0x3A, 0xC8,
+  0x22, 0x0A, 0x02, 0x6C, 0xB1, 0x20, 0xAA, 0x43, 0x0C, 0x83, 0x88, 0x28, 0xB8, 0x11, 0x01, 0x79,
+  0xC0, 0x92, 0x00, 0x4B, 0xC3, 0x91, 0x9A, 0x13, 0xF5, 0x00, 0xB2, 0x38, 0xF8, 0x20, 0xE0, 0x30,
+  0xC9, 0x31, 0x8A, 0x00, 0xAA, 0x2E, 0xD1, 0x20, 0xBA, 0x82, 0x98, 0x38, 0x8C, 0x9A, 0xE5, 0x20,
+  0x8C, 0x01, 0xB9, 0x12, 0x2B, 0xD1, 0x98, 0x12, 0x1F, 0xA1, 0x93, 0x0A, 0x08, 0x5A, 0xC8, 0x14,
+  0x8C, 0x10, 0x1A, 0xB1, 0x20, 0x32, 0xD0, 0x84, 0x1C, 0x14, 0x0C, 0xA5, 0x60, 0xA9, 0x03, 0x10,
+  0x00, 0x12, 0x3E, 0x90, 0x31, 0x0D, 0x96, 0x00, 0x02, 0x5A, 0xB0, 0x03, 0xB0, 0x14, 0x6B, 0x99,
+  0x95, 0x10, 0x18, 0xB1, 0xE1, 0x00, 0x19, 0x00, 0xA3, 0x31, 0x20, 0xF8, 0x32, 0x2C, 0x2A, 0xC1,
+  0x51, 0xC1, 0x6B, 0x98, 0x38, 0xA8, 0x20, 0xE1, 0x28, 0x9A, 0x02, 0xE3, 0x29, 0x89, 0x18, 0xCA,
+  0x21, 0x1C, 0x0C, 0xA9, 0x23, 0x8F, 0x8C, 0xC5, 0x82, 0x09, 0x88, 0x88, 0xAB, 0x22, 0x0C, 0xA9,
+  0x01, 0x2C, 0x1B, 0xE1, 0x89, 0x8B, 0x89, 0x8C, 0xB5, 0xB9, 0x21, 0xAF, 0xA1, 0x31, 0xD2, 0x8C,
+  0x95, 0x1A, 0x99, 0x11, 0xA2, 0x6F, 0x89, 0x18, 0xC3, 0x09, 0x03, 0x0B, 0x24, 0xC9, 0x15, 0x89,
+  0x80, 0x1B, 0x25, 0x8B, 0x15, 0x2C, 0x82, 0x30, 0xB8, 0x3C, 0x07, 0x91, 0x30, 0xB9, 0x22, 0x28,
+  0x63, 0x20, 0xAB, 0x95, 0x98, 0x80, 0x17, 0x48, 0xB8, 0xA4, 0x7B, 0xA2, 0x3A, 0xC2, 0x00, 0x50,
+  0x09, 0x98, 0x00, 0xA8, 0x06, 0x99, 0x02, 0x0B, 0xD4, 0x28, 0x0B, 0x12, 0x8D, 0xB1, 0x3E, 0xA2,
+  0xB1, 0x24, 0x9F, 0x91, 0x28, 0xB9, 0xC2, 0x48, 0xAB, 0x00, 0x1D, 0x00, 0x0A, 0x08, 0x8E, 0xB1,
+  0x11, 0x3B, 0xEA, 0x82, 0x8D, 0x92, 0x39, 0xCA, 0xA1, 0x29, 0x8C, 0x28, 0x9A, 0xAA, 0x29, 0xC7,
+  0x31, 0x0D, 0xB0, 0x81, 0x29, 0x1C, 0x11, 0xFA, 0x11, 0x48, 0x8C, 0x88, 0x81, 0xA0, 0x87, 0x8B,
+  0x06, 0x08, 0xB0, 0x40, 0x88, 0x60, 0xAA, 0x11, 0x11, 0x18, 0x41, 0x1F, 0xC3, 0x84, 0x4A, 0x8A,
+  0x23, 0x19, 0xD2, 0x30, 0x99, 0x83, 0x29, 0x17, 0xB9, 0x10, 0x05, 0x08, 0x0B, 0xA5, 0x48, 0x20,
+  0xA8, 0x02, 0xD9, 0x26, 0x2C, 0xA2, 0x91, 0x8B, 0x58, 0xB2, 0x4C, 0xB8, 0x05, 0x0A, 0x19, 0x98,
+  0xD4, 0x39, 0xC2, 0x5B, 0xA8, 0x92, 0x1B, 0x09, 0x94, 0x1B, 0x09, 0x0A, 0xF2, 0x28, 0x1E, 0x08,
+  0xB0, 0x83, 0x8F, 0x82, 0x0A, 0xA1, 0x8D, 0x00, 0x99, 0x83, 0x9D, 0x80, 0xE0, 0x03, 0x9D, 0x14,
+  0x1E, 0x91, 0x09, 0x90, 0x20, 0xD9, 0x21, 0xE1, 0x20, 0x99, 0x00, 0xF0, 0x21, 0xFD, 0x23, 0x00,
+  0x20, 0x81, 0x00, 0xA1, 0x3D, 0xD0, 0x22, 0x08, 0x82, 0x89, 0x5E, 0x99, 0x82, 0xA2, 0x78, 0xC9,
+  0x15, 0x1B, 0x81, 0x18, 0x11, 0xCA, 0x33, 0xAC, 0x03, 0xA3, 0x50, 0x09, 0x00, 0x88, 0x23, 0x2A,
+  0x26, 0x1B, 0x8B, 0x07, 0x3E, 0xB4, 0x3A, 0xB8, 0x51, 0xA0, 0x40, 0xDA, 0x04, 0x2A, 0xA2, 0x8A,
+  0xC4, 0x30, 0x88, 0x1B, 0xD1, 0x32, 0xAB, 0xA4, 0x3A, 0xA1, 0x2F, 0xF2, 0x48, 0xA9, 0x81, 0x19,
+  0x59, 0xB0, 0x00, 0xB9, 0x59, 0xD0, 0x88, 0x91, 0x48, 0xB8, 0x88, 0x10, 0x3D, 0x92, 0x8E, 0xA0,
+  0x29, 0x23, 0x9F, 0xB3, 0x1A, 0x91, 0x01, 0x3F, 0xC1, 0x10, 0xAC, 0x86, 0x89, 0x51, 0x8C, 0x80,
+  0x81, 0x01, 0xBA, 0x60, 0xC8, 0x85, 0x3B, 0xC2, 0x28, 0x98, 0x12, 0x9B, 0x94, 0x49, 0xE2, 0x01,
+  0x18, 0xA9, 0x04, 0x3C, 0x94, 0x3C, 0xD4, 0x39, 0x80, 0x00, 0x29, 0x1A, 0xB4, 0x81, 0x92, 0x3D,
+  0x45, 0x00, 0x22, 0x00, 0x81, 0xE4, 0x20, 0x3B, 0xA0, 0x95, 0x3A, 0x91, 0x30, 0x2A, 0xCB, 0x60,
+  0xF1, 0x83, 0x08, 0x1B, 0xA0, 0x23, 0xA8, 0x87, 0x0E, 0x93, 0x08, 0xC2, 0x3A, 0x00, 0x4F, 0xD0,
+  0x02, 0x88, 0x39, 0x0B, 0x90, 0xB2, 0x10, 0x3D, 0xD1, 0x4A, 0xB0, 0x48, 0x19, 0xAA, 0x93, 0x8F,
+  0x95, 0x3B, 0xB2, 0x18, 0xA0, 0x4B, 0xC6, 0x20, 0xA9, 0x69, 0xE0, 0x11, 0xA9, 0x50, 0xBA, 0x04,
+  0x8A, 0x23, 0x8E, 0x93, 0x89, 0x21, 0x8D, 0x95, 0x1A, 0x02, 0x1C, 0xA3, 0x2C, 0x84, 0x1D, 0xA4,
+  0x1A, 0xB2, 0x6A, 0xB0, 0x38, 0xC1, 0x38, 0xB8, 0x50, 0xB0, 0x40, 0xB8, 0x30, 0xC0, 0x40, 0xA0,
+  0x28, 0xA9, 0x81, 0x80, 0x60, 0xB9, 0x82, 0x0B, 0x15, 0x0A, 0x92, 0x49, 0x12, 0x0C, 0x15, 0x00,
+  0x80, 0xD9, 0x09, 0x22, 0x88, 0x84, 0x0D, 0xB9, 0x0B, 0xF3, 0xA8, 0x0F, 0x80, 0x8C, 0x04, 0x48,
+  0x36, 0x12, 0x03, 0xB8, 0x05, 0x08, 0x29, 0x00, 0x80, 0x0E, 0xA0, 0xAE, 0xEB, 0x8A, 0x9B, 0xA2,
+  0xBC, 0x88, 0x78, 0x27, 0x34, 0x02, 0x89, 0xAA, 0x10, 0x80, 0x90, 0xAF, 0xBC, 0xAB, 0x9A, 0x98,
+  0xAD, 0x08, 0x20, 0x67, 0x33, 0x42, 0xA1, 0x9A, 0x0A, 0x50, 0x94, 0x98, 0xBC, 0x9D, 0x89, 0x88,
+  0x92, 0x0C, 0xC9, 0x89, 0x11, 0x77, 0x11, 0x22, 0xB9, 0xAA, 0x19, 0x35, 0x01, 0xC9, 0xBC, 0x9A,
+  0x18, 0x03, 0x19, 0xF9, 0x9A, 0x9C, 0x11, 0x64, 0x15, 0x20, 0xB8, 0xAB, 0x80, 0x64, 0x01, 0x99,
+  0xEB, 0x98, 0x18, 0x22, 0x98, 0xA8, 0x9E, 0xA8, 0x38, 0x32, 0x56, 0x81, 0x02, 0xCB, 0x89, 0x30,
+  0x17, 0x80, 0xCA, 0x9C, 0x88, 0x32, 0x81, 0xA8, 0xCC, 0x09, 0xA9, 0x16, 0x69, 0x11, 0x18, 0xA3,
+  0x8C, 0x89, 0x61, 0x02, 0xA0, 0xDC, 0x0A, 0x00, 0x33, 0x99, 0xD8, 0x8B, 0x08, 0x00, 0x13, 0x5B,
+  0x33, 0x21, 0x27, 0xCB, 0x99, 0x48, 0x16, 0x88, 0xDE, 0x23, 0x44, 0x00, 0xCB, 0x9B, 0x81, 0x62,
+  0xA1, 0x99, 0xAB, 0x88, 0x91, 0x24, 0x3C, 0x21, 0x24, 0x25, 0x88, 0xAF, 0x10, 0x52, 0x01, 0xDA,
+  0xAA, 0x1A, 0x33, 0x21, 0xD9, 0xAB, 0x89, 0x49, 0x92, 0xB1, 0x48, 0x71, 0x21, 0x85, 0xC0, 0x8C,
+  0x21, 0x43, 0x91, 0xCD, 0xA8, 0x39, 0x23, 0x80, 0xEA, 0x8A, 0x80, 0x12, 0x08, 0xCA, 0x12, 0x26,
+  0x61, 0x00, 0xD9, 0x0A, 0x31, 0x34, 0xB0, 0xBE, 0xA9, 0x21, 0x24, 0x90, 0xBC, 0xA9, 0x21, 0x03,
+  0x89, 0xF9, 0x38, 0x62, 0x21, 0x81, 0xE0, 0x0B, 0x21, 0x34, 0xB2, 0xAF, 0x9A, 0x38, 0x04, 0x81,
+  0xCB, 0x8A, 0x00, 0x13, 0x89, 0xDA, 0x28, 0x73, 0x12, 0x02, 0xB0, 0x9E, 0x10, 0x34, 0x83, 0xCD,
+  0xAA, 0x29, 0x23, 0x13, 0xEC, 0x8A, 0x18, 0x31, 0xA8, 0xC9, 0x29, 0x39, 0x47, 0x01, 0x20, 0xEA,
+  0x09, 0x31, 0x34, 0xC8, 0xAC, 0xAA, 0x41, 0x22, 0x98, 0xDC, 0x89, 0x11, 0xA0, 0xE7, 0x43, 0x00,
+  0x12, 0xC8, 0x99, 0x98, 0x73, 0x05, 0x11, 0xB0, 0x0C, 0x08, 0x44, 0x92, 0xBA, 0xBD, 0x18, 0x12,
+  0x14, 0xDA, 0xAA, 0x89, 0x43, 0x80, 0xB8, 0x8A, 0x39, 0x47, 0x12, 0x13, 0xDB, 0x0A, 0x10, 0x36,
+  0xA8, 0xBA, 0xAE, 0x28, 0x12, 0x03, 0xCC, 0x9A, 0x89, 0x33, 0x81, 0x8B, 0xD9, 0x6A, 0x24, 0x32,
+  0x03, 0xAC, 0xCA, 0x50, 0x13, 0x08, 0xFA, 0x9B, 0x00, 0x48, 0x93, 0xAA, 0xCA, 0x0B, 0x03, 0x22,
+  0xC1, 0x9A, 0x2B, 0x57, 0x22, 0x05, 0xAA, 0xA9, 0x29, 0x17, 0x08, 0xB8, 0xAD, 0x80, 0x38, 0x22,
+  0xBB, 0xD9, 0x9B, 0x11, 0x21, 0xA3, 0x9A, 0x09, 0x72, 0x57, 0x11, 0xA0, 0x8B, 0x88, 0x33, 0x13,
+  0xF9, 0xAC, 0xA9, 0x30, 0x13, 0x99, 0xE9, 0x9B, 0x00, 0x38, 0x85, 0x89, 0x81, 0x6A, 0x35, 0x12,
+  0x02, 0xCA, 0x8A, 0x12, 0x22, 0xD0, 0xAE, 0xA9, 0x0A, 0x23, 0x99, 0x98, 0xCC, 0x18, 0x08, 0x41,
+  0x74, 0xF2, 0x37, 0x00, 0x81, 0x09, 0x03, 0x74, 0x25, 0x00, 0x02, 0xBA, 0x38, 0x80, 0xAA, 0xEA,
+  0xBC, 0x19, 0xBA, 0x18, 0xC8, 0x0A, 0x10, 0xA9, 0x40, 0x01, 0x30, 0x41, 0x12, 0x53, 0x26, 0x20,
+  0x35, 0x00, 0x02, 0x98, 0x88, 0xBB, 0xCD, 0xBA, 0xCC, 0xAB, 0xCA, 0x99, 0x09, 0x9B, 0x89, 0x11,
+  0x52, 0x24, 0x32, 0x34, 0x23, 0x54, 0x24, 0x42, 0x03, 0x80, 0x11, 0x90, 0xB1, 0xFC, 0xAB, 0xAC,
+  0xBA, 0x9A, 0xBC, 0x99, 0x9C, 0x91, 0x48, 0x23, 0x12, 0x17, 0x41, 0x22, 0x44, 0x11, 0x22, 0x11,
+  0x22, 0x81, 0xA0, 0xBC, 0x9F, 0xAA, 0xAC, 0xE9, 0x99, 0xAA, 0x08, 0x8A, 0x98, 0x31, 0x38, 0x35,
+  0x16, 0x32, 0x22, 0x32, 0x35, 0x42, 0x21, 0x9A, 0xA1, 0xAA, 0xBC, 0xCB, 0xBE, 0xBA, 0xD9, 0x1B,
+  0xCA, 0x90, 0x0B, 0x39, 0x1B, 0x06, 0x88, 0x06, 0x21, 0x38, 0x24, 0x11, 0x14, 0xD9, 0x31, 0xAB,
+  0x84, 0x9D, 0xA8, 0xD0, 0x29, 0xFF, 0x25, 0x00, 0x0A, 0xAB, 0x09, 0xBE, 0xA1, 0x80, 0x80, 0x08,
+  0x40, 0x83, 0x71, 0x93, 0x42, 0x80, 0x15, 0x9A, 0x15, 0x8D, 0xA2, 0x08, 0x08, 0x90, 0x0C, 0xE2,
+  0x19, 0x11, 0x99, 0x12, 0xDC, 0x16, 0x2A, 0x30, 0x1A, 0x15, 0xAA, 0x25, 0x8C, 0x02, 0x8A, 0x8A,
+  0x20, 0xA9, 0xB2, 0xF8, 0x71, 0x98, 0x02, 0xB2, 0x68, 0x80, 0x30, 0xC1, 0x48, 0xB1, 0x20, 0xB0,
+  0x12, 0x5A, 0x0F, 0xA8, 0xA2, 0x28, 0x9C, 0x5A, 0x99, 0x80, 0x91, 0x28, 0x22, 0x19, 0x78, 0xC1,
+  0x32, 0xA0, 0x62, 0x8A, 0xA8, 0xA1, 0x59, 0xFB, 0x08, 0x99, 0xD8, 0x02, 0x9A, 0x09, 0xBA, 0x38,
+  0xD3, 0x22, 0xD8, 0x92, 0x49, 0x03, 0x69, 0xA0, 0x03, 0x18, 0x3A, 0xF2, 0x0C, 0xB8, 0x0D, 0x88,
+  0xB9, 0x0C, 0x8A, 0x9C, 0x32, 0x13, 0x4C, 0x06, 0x28, 0x32, 0x03, 0x37, 0x2C, 0x19, 0xC0, 0x81,
+  0x1C, 0xBE, 0xA0, 0x8B, 0x2F, 0xD9, 0x10, 0x18, 0xB0, 0xF9, 0x2A, 0x00, 0x28, 0x25, 0x21, 0x56,
+  0x10, 0x04, 0x90, 0x08, 0x8A, 0xB8, 0xF9, 0x9D, 0xBA, 0xAA, 0x90, 0x9C, 0xA0, 0x58, 0x45, 0x52,
+  0x34, 0x01, 0x00, 0x9A, 0x80, 0xA9, 0xB8, 0x8F, 0x90, 0x9A, 0xE1, 0xAC, 0x18, 0x8A, 0x84, 0xCA,
+  0x19, 0x9C, 0x73, 0x03, 0x64, 0x02, 0x98, 0xA0, 0x09, 0x01, 0x89, 0xBA, 0xAC, 0x99, 0x31, 0xC8,
+  0xAD, 0xAA, 0x98, 0x12, 0xBB, 0xCF, 0xD8, 0x48, 0x16, 0x40, 0x14, 0x98, 0x80, 0x8B, 0x03, 0x98,
+  0xC2, 0x9D, 0x89, 0x1A, 0x93, 0xCB, 0x89, 0x8D, 0x21, 0xB9, 0xD3, 0x8C, 0x19, 0x73, 0x04, 0x44,
+  0x81, 0x09, 0xAA, 0x20, 0x01, 0x18, 0xDD, 0x89, 0x8A, 0x31, 0xB9, 0x8A, 0xEA, 0x39, 0xB1, 0x39,
+  0xDC, 0xA0, 0x40, 0x27, 0x48, 0x15, 0x98, 0xA0, 0x1A, 0x11, 0x00, 0xD0, 0x8C, 0xB9, 0x38, 0x92,
+  0x1A, 0xD8, 0x9B, 0x81, 0x0A, 0xA5, 0x0E, 0xB1, 0x79, 0x84, 0x61, 0x02, 0x32, 0x20, 0x42, 0x00,
+  0x89, 0xB8, 0x29, 0x01, 0x20, 0xEB, 0x9A, 0xA9, 0x41, 0xA0, 0x00, 0xDA, 0x88, 0x09, 0x00, 0xB8,
+  0x2E, 0xBB, 0x64, 0x83, 0x64, 0x01, 0x98, 0xB9, 0x20, 0x20, 0x81, 0xBD, 0xC9, 0x0A, 0x22, 0x09,
+  0xA1, 0xCB, 0xA9, 0x2C, 0xB9, 0x12, 0xBF, 0x92, 0x5B, 0x07, 0x60, 0x03, 0x88, 0xB8, 0x29, 0x81,
+  0x12, 0xF9, 0x89, 0x9A, 0x20, 0xA0, 0x10, 0xDA, 0x99, 0xBB, 0x80, 0x39, 0xAF, 0xC4, 0x38, 0x25,
+  0x70, 0x03, 0x00, 0xA9, 0x2A, 0x00, 0x23, 0xF9, 0x89, 0xCB, 0x21, 0x89, 0x20, 0xBB, 0xC0, 0x8E,
+  0x90, 0x39, 0xD8, 0x01, 0x8A, 0x37, 0x40, 0x16, 0x80, 0xA0, 0x0A, 0x02, 0x20, 0xE1, 0x8A, 0xCA,
+  0x10, 0x90, 0x10, 0xBB, 0xA8, 0xBE, 0x81, 0x1A, 0xE1, 0x18, 0x8A, 0x47, 0x20, 0x26, 0x80, 0x90,
+  0x8A, 0x01, 0x28, 0xD1, 0x9A, 0xD9, 0x19, 0x90, 0x18, 0xA9, 0x9A, 0xCD, 0x88, 0x8A, 0xA1, 0x2A,
+  0x19, 0xEB, 0x2E, 0x00, 0x0C, 0x57, 0x21, 0x36, 0x10, 0x98, 0x8A, 0x80, 0x11, 0xB8, 0xAC, 0xDB,
+  0x88, 0x08, 0x89, 0x0A, 0xF9, 0xAA, 0xB8, 0x2A, 0xE8, 0x10, 0x8A, 0x47, 0x31, 0x36, 0x01, 0x80,
+  0x8B, 0x90, 0x20, 0xD8, 0xA9, 0xCB, 0x18, 0x0A, 0x80, 0x9B, 0xF0, 0x8B, 0x99, 0x1B, 0xE0, 0x18,
+  0x89, 0x57, 0x11, 0x35, 0x11, 0x81, 0x9A, 0x00, 0x09, 0xC1, 0x9D, 0xB9, 0x89, 0x90, 0x88, 0xA9,
+  0xAA, 0xDB, 0x8B, 0xD8, 0x88, 0x8C, 0x18, 0x54, 0x34, 0x45, 0x23, 0x22, 0x81, 0x11, 0x98, 0xCB,
+  0xCE, 0x9A, 0x9A, 0x80, 0x98, 0x81, 0x98, 0xAA, 0xBB, 0xCE, 0xCB, 0xAC, 0x8A, 0x30, 0x35, 0x37,
+  0x34, 0x32, 0x13, 0x22, 0x00, 0xC9, 0xDB, 0xBB, 0xBB, 0xCB, 0xAA, 0xBA, 0xAA, 0xBC, 0xBA, 0xBD,
+  0x9A, 0xBA, 0x31, 0x55, 0x56, 0x23, 0x34, 0x22, 0x22, 0x01, 0x98, 0xDA, 0xCB, 0xCA, 0xAA, 0xBA,
+  0x9B, 0xB9, 0x9B, 0xB9, 0x8F, 0xEF, 0x29, 0x00, 0x9C, 0xBA, 0x9B, 0x9A, 0x64, 0x64, 0x44, 0x33,
+  0x24, 0x22, 0x22, 0x81, 0xBA, 0xBC, 0xBC, 0xBC, 0xAB, 0xBB, 0x9A, 0xAC, 0x99, 0xBA, 0xA9, 0xBC,
+  0xBB, 0x48, 0x44, 0x57, 0x33, 0x25, 0x22, 0x33, 0x21, 0x98, 0xCB, 0xBC, 0xCB, 0xCB, 0xB9, 0x9A,
+  0xB9, 0x9B, 0xA9, 0xAA, 0xCB, 0xBA, 0x8B, 0x52, 0x75, 0x34, 0x34, 0x24, 0x32, 0x22, 0x00, 0xC9,
+  0xBB, 0xBC, 0xAD, 0xAB, 0xAB, 0xAA, 0xAC, 0x99, 0xAA, 0xAA, 0xBC, 0x0A, 0x10, 0x67, 0x43, 0x44,
+  0x22, 0x23, 0x23, 0x01, 0xB9, 0xAD, 0xCB, 0xCB, 0xBA, 0xAB, 0xAA, 0xAB, 0xA9, 0x9A, 0xC9, 0xAA,
+  0x8C, 0x21, 0x74, 0x35, 0x34, 0x25, 0x22, 0x14, 0x11, 0x98, 0xBA, 0xCB, 0xBC, 0xBB, 0xBC, 0xAA,
+  0xAB, 0xA9, 0x9A, 0xA8, 0xBA, 0x8B, 0x53, 0x73, 0x37, 0x34, 0x43, 0x32, 0x33, 0x02, 0xA0, 0xCB,
+  0xCB, 0xCC, 0xBA, 0xBB, 0xAB, 0xAC, 0x99, 0xA9, 0xFA, 0xF0, 0x2B, 0x00, 0x99, 0xAA, 0x88, 0x41,
+  0x55, 0x45, 0x43, 0x43, 0x32, 0x23, 0x02, 0xA0, 0xCA, 0xCB, 0xBD, 0xBA, 0xAC, 0xAB, 0xAB, 0xAA,
+  0x9A, 0xB9, 0x8B, 0x08, 0x72, 0x35, 0x55, 0x33, 0x42, 0x33, 0x33, 0x81, 0xA9, 0xDA, 0xBC, 0xCB,
+  0xAC, 0xBA, 0xAB, 0xAA, 0xAA, 0x99, 0xAA, 0x80, 0x18, 0x47, 0x54, 0x43, 0x33, 0x34, 0x33, 0x13,
+  0x90, 0xAA, 0xDB, 0xBD, 0xCA, 0xBB, 0xBA, 0xBB, 0x9B, 0xAB, 0x8A, 0xCA, 0x20, 0x11, 0x77, 0x23,
+  0x35, 0x22, 0x34, 0x12, 0x01, 0xB8, 0xAA, 0xCD, 0xBB, 0xDB, 0xAA, 0xAB, 0xAB, 0xAA, 0x9A, 0xBA,
+  0x18, 0x21, 0x67, 0x43, 0x34, 0x33, 0x44, 0x12, 0x01, 0xA8, 0xAA, 0xCC, 0xCB, 0xCA, 0xBA, 0xBB,
+  0xBA, 0xBA, 0x9A, 0xA9, 0x30, 0x52, 0x47, 0x42, 0x34, 0x33, 0x43, 0x22, 0x01, 0xA9, 0xCA, 0xCB,
+  0xBC, 0xAD, 0xAB, 0xBA, 0xAB, 0xAB, 0x89, 0x09, 0x32, 0x64, 0x35, 0x44, 0xAB, 0xFD, 0x33, 0x00,
+  0x24, 0x32, 0x23, 0x12, 0x81, 0xBA, 0xCB, 0xCD, 0xBA, 0xAC, 0xBB, 0xBB, 0xAA, 0x9B, 0x99, 0x39,
+  0x35, 0x64, 0x34, 0x53, 0x23, 0x33, 0x23, 0x10, 0xA8, 0xBC, 0xCC, 0xBC, 0xBA, 0xAD, 0xBA, 0xBA,
+  0x99, 0x9A, 0x80, 0x40, 0x34, 0x64, 0x24, 0x43, 0x23, 0x22, 0x22, 0x88, 0xC9, 0xDB, 0xBB, 0xCC,
+  0xBA, 0xBB, 0xBB, 0xBA, 0xAA, 0x80, 0x38, 0x36, 0x74, 0x32, 0x34, 0x33, 0x33, 0x23, 0x00, 0xA9,
+  0xBE, 0xCB, 0xBC, 0xBC, 0xBB, 0xBB, 0xAB, 0xAA, 0x09, 0x11, 0x73, 0x35, 0x63, 0x33, 0x43, 0x23,
+  0x12, 0x02, 0xA9, 0xCB, 0xBD, 0xCB, 0xCB, 0xBB, 0xCB, 0x9A, 0x9A, 0x89, 0x10, 0x52, 0x34, 0x54,
+  0x34, 0x32, 0x23, 0x12, 0x12, 0xCA, 0xA9, 0xBF, 0xBA, 0xDB, 0x9B, 0xCB, 0x9A, 0xA9, 0x88, 0x01,
+  0x42, 0x25, 0x54, 0x42, 0x22, 0x22, 0x21, 0x81, 0xA8, 0xDA, 0xBC, 0xCB, 0xAC, 0xBB, 0xBB, 0xBA,
+  0x28, 0xF4, 0x27, 0x00, 0x8B, 0x08, 0x38, 0x46, 0x43, 0x35, 0x24, 0x33, 0x13, 0x13, 0x80, 0xA8,
+  0xBD, 0xCC, 0xCB, 0xBB, 0xAC, 0xAA, 0x9B, 0x0A, 0x18, 0x34, 0x35, 0x36, 0x43, 0x43, 0x22, 0x12,
+  0x01, 0x90, 0xCA, 0xBB, 0xCE, 0xAA, 0xCB, 0xAA, 0xB9, 0x09, 0xA8, 0x41, 0x24, 0x73, 0x32, 0x43,
+  0x23, 0x22, 0x12, 0x98, 0xA9, 0xCE, 0xBA, 0xEB, 0xAA, 0xAB, 0x9A, 0xAA, 0x19, 0x11, 0x44, 0x44,
+  0x33, 0x35, 0x32, 0x22, 0x22, 0x80, 0xBA, 0xDD, 0xBB, 0xBD, 0xBB, 0xDB, 0x99, 0x99, 0x00, 0x28,
+  0x53, 0x34, 0x44, 0x32, 0x33, 0x33, 0x02, 0x08, 0xDA, 0xCB, 0xCC, 0xCB, 0xBA, 0xBA, 0x9A, 0x0A,
+  0x08, 0x44, 0x43, 0x35, 0x43, 0x33, 0x23, 0x33, 0x91, 0x9A, 0xCD, 0xDB, 0xCB, 0xBA, 0xAB, 0xBB,
+  0x89, 0x00, 0x33, 0x36, 0x35, 0x43, 0x23, 0x23, 0x22, 0x08, 0xC9, 0xBB, 0xCE, 0xAA, 0xCB, 0xAA,
+  0xAA, 0xAA, 0x80, 0x80, 0xB4, 0xFC, 0x19, 0x00, 0x16, 0x13, 0x58, 0x11, 0x84, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xBF, 0x00, 0xD0, 0x0B, 0xD0, 0x8A, 0x80, 0x8E, 0x08, 0x08, 0x08, 0x88, 0x36, 0x18,
+  0x15, 0x49, 0x83, 0x08, 0x08, 0x08, 0x08, 0x18, 0xFE, 0x08, 0x80, 0x80, 0x08, 0x90, 0x72, 0x82,
+  0x15, 0x50, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x18, 0x7B, 0x47, 0x08,
+  0x88, 0x17, 0x08, 0x80, 0x80, 0x80, 0xCD, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00,
+  0x08, 0x08, 0x08, 0x88, 0x50, 0xFF, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x19, 0xF1, 0xFF, 0x8B, 0x51, 0xAA, 0x00, 0x88, 0x37, 0x80,
+  0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // eight
+  0xE4, 0xFF, 0x00, 0x00, 0xF0, 0xC7, 0x41, 0xF9, 0x2A, 0x9A, 0x00, 0x08, 0x80, 0x08, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0xB0, 0x77, 0x85, 0x39, 0x93, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+  0xFF, 0xAF, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x98, 0x77, 0x82, 0x08, 0x42,
+  0x8F, 0x22, 0x0A, 0xA4, 0xAD, 0x49, 0xB1, 0x12, 0x81, 0x79, 0x80, 0x80, 0xB0, 0xC3, 0x7A, 0xA0,
+  0x38, 0x7D, 0x7F, 0xF0, 0x97, 0x4D, 0xA8, 0x01, 0x98, 0x03, 0x2C, 0xB1, 0x10, 0x89, 0x02, 0x09,
+  0xA2, 0x0A, 0xA1, 0x58, 0x98, 0x02, 0x99, 0x98, 0x18, 0x39, 0xA2, 0x20, 0x9C, 0x19, 0x8A, 0xB7,
+  0x51, 0x0C, 0x91, 0x08, 0x88, 0x18, 0x0C, 0x80, 0x01, 0xF4, 0x83, 0x3F, 0x9A, 0xC3, 0x63, 0x2F,
+  0xD1, 0x82, 0x19, 0x08, 0x0A, 0xFF, 0x37, 0x00, 0x19, 0xB1, 0x92, 0xA8, 0x13, 0x4F, 0xA0, 0x81,
+  0xD0, 0x60, 0x0D, 0xA4, 0x18, 0x98, 0x10, 0x9B, 0x87, 0x28, 0xB0, 0x01, 0x8C, 0x93, 0x58, 0xB1,
+  0x12, 0x0F, 0xE0, 0x12, 0x2B, 0xB2, 0x2E, 0xF3, 0x50, 0x3D, 0xA1, 0x83, 0x9A, 0x89, 0x39, 0x02,
+  0x84, 0x99, 0x9B, 0x0C, 0x18, 0x95, 0x11, 0xAA, 0xA9, 0xAA, 0x31, 0xC4, 0x37, 0x4B, 0xA2, 0x83,
+  0x9D, 0x89, 0x58, 0x10, 0xA2, 0xA8, 0x8E, 0x8A, 0x21, 0x03, 0x00, 0x9D, 0xBC, 0xB2, 0x62, 0x30,
+  0x12, 0x14, 0xA0, 0xBB, 0x8E, 0x82, 0x53, 0x88, 0xD1, 0x99, 0x0C, 0x18, 0x11, 0x81, 0xC9, 0x8B,
+  0x8F, 0xA3, 0x42, 0x02, 0x24, 0x58, 0xB8, 0xC0, 0x1A, 0x18, 0x14, 0x28, 0xDB, 0xB9, 0x8B, 0x40,
+  0x38, 0xC2, 0xD8, 0xA9, 0x3D, 0x98, 0x07, 0x30, 0x11, 0x23, 0xA9, 0xDB, 0x89, 0x28, 0x03, 0x11,
+  0xAC, 0xFA, 0x89, 0x08, 0x20, 0x80, 0xCA, 0xF1, 0x6C, 0xE9, 0x3E, 0x00, 0x39, 0x2C, 0x83, 0x34,
+  0x42, 0x04, 0x90, 0xAC, 0xB9, 0x10, 0x10, 0x81, 0x89, 0xAC, 0xCA, 0x80, 0x18, 0xB0, 0x9C, 0xF8,
+  0x38, 0x2F, 0x01, 0x23, 0x44, 0x15, 0x00, 0xAA, 0xBA, 0x99, 0x90, 0x80, 0x19, 0x0A, 0xAB, 0xF3,
+  0x08, 0x1F, 0xCA, 0xB2, 0x18, 0x10, 0x7C, 0x80, 0x85, 0x34, 0x48, 0x99, 0xA8, 0x9A, 0xB8, 0x88,
+  0x1B, 0x98, 0x01, 0x08, 0x99, 0xAC, 0xAE, 0xCB, 0x90, 0x58, 0x98, 0x07, 0x60, 0x30, 0x06, 0x01,
+  0x89, 0x9A, 0xAA, 0xAA, 0xB9, 0x88, 0x29, 0x10, 0x92, 0x80, 0xCD, 0xE8, 0x0A, 0x8B, 0x04, 0x5A,
+  0xA3, 0x27, 0x71, 0x11, 0x91, 0x90, 0x9A, 0xAB, 0xBA, 0x9A, 0x99, 0x82, 0x41, 0x29, 0xB1, 0xC9,
+  0xFB, 0xA8, 0x2A, 0x08, 0x79, 0x21, 0x16, 0x26, 0x22, 0x08, 0xB8, 0xA9, 0xAC, 0xCB, 0xA9, 0x09,
+  0x29, 0x01, 0x03, 0x10, 0x9D, 0xFA, 0xC0, 0x00, 0x1A, 0x58, 0x38, 0x16, 0x60, 0x01, 0x3A, 0x00,
+  0x17, 0x21, 0x08, 0x98, 0xA9, 0xAB, 0xBC, 0xBA, 0x89, 0x19, 0x12, 0x23, 0x20, 0xAC, 0xFB, 0xC9,
+  0x98, 0xA8, 0x51, 0x79, 0x32, 0x17, 0x12, 0x00, 0x98, 0xB9, 0xCA, 0xAC, 0x9B, 0x8A, 0x00, 0x12,
+  0x23, 0x11, 0x9A, 0xAF, 0xF9, 0xA0, 0x88, 0x20, 0x70, 0x32, 0x16, 0x23, 0x10, 0x98, 0xB9, 0xDB,
+  0xAC, 0xBB, 0x98, 0x29, 0x10, 0x04, 0x02, 0x1A, 0x9E, 0xD9, 0xA0, 0x98, 0x02, 0x73, 0x72, 0x22,
+  0x04, 0x01, 0x08, 0xAA, 0xCB, 0xAC, 0xAB, 0xAA, 0x00, 0x21, 0x32, 0x03, 0x81, 0xBB, 0xBD, 0x0E,
+  0xCA, 0xA5, 0x43, 0x70, 0x32, 0x13, 0x12, 0x09, 0xAA, 0xDC, 0xBB, 0xAC, 0x9A, 0x88, 0x11, 0x33,
+  0x32, 0x01, 0xC0, 0xBA, 0x0F, 0x8E, 0xA0, 0x04, 0x72, 0x31, 0x03, 0x03, 0x01, 0x9A, 0xCC, 0xBC,
+  0xBB, 0x9B, 0x89, 0x11, 0x33, 0x24, 0x12, 0x99, 0xFA, 0xF0, 0x09, 0x1B, 0x10, 0x26, 0x34, 0x42,
+  0x28, 0x16, 0x3B, 0x00, 0x20, 0x81, 0xA8, 0xBC, 0xAE, 0xBA, 0x9A, 0x09, 0x28, 0x22, 0x23, 0x93,
+  0x81, 0x0F, 0xAE, 0xD1, 0x81, 0x50, 0x41, 0x22, 0x04, 0x22, 0x08, 0xAA, 0xDC, 0xBA, 0xAB, 0x9B,
+  0x89, 0x21, 0x23, 0x24, 0x21, 0x99, 0xF2, 0xAA, 0x2D, 0x3B, 0x24, 0x27, 0x33, 0x32, 0x21, 0xA0,
+  0xEA, 0xAC, 0xBC, 0xAA, 0x9A, 0x08, 0x10, 0x33, 0x32, 0x93, 0x84, 0x2F, 0x8D, 0xC1, 0x03, 0x62,
+  0x40, 0x11, 0x84, 0x02, 0x0A, 0xAC, 0xCB, 0xBA, 0xAB, 0xA9, 0x91, 0x41, 0x48, 0x02, 0x12, 0x1A,
+  0xF9, 0xB2, 0x38, 0x7A, 0x22, 0x05, 0x23, 0x21, 0x19, 0xCB, 0xFA, 0xB9, 0xBA, 0xA9, 0x1A, 0x19,
+  0x11, 0x85, 0x22, 0x29, 0xF2, 0xA2, 0x4A, 0x4B, 0x83, 0x07, 0x22, 0x48, 0x08, 0xB0, 0xD8, 0x9A,
+  0x9D, 0xAA, 0x98, 0x88, 0x01, 0x31, 0x40, 0x10, 0x93, 0x48, 0x0D, 0xC3, 0x15, 0x50, 0x38, 0x02,
+  0x94, 0x81, 0x0B, 0x9E, 0xB2, 0x04, 0x33, 0x00, 0xCA, 0xB9, 0x99, 0x8A, 0x09, 0x21, 0x12, 0x15,
+  0x31, 0x68, 0x3B, 0xE3, 0x85, 0x58, 0x29, 0x81, 0x93, 0x01, 0x0A, 0xAC, 0xD9, 0xB9, 0x9A, 0x8C,
+  0x89, 0x01, 0x22, 0x31, 0x13, 0x05, 0x20, 0x28, 0xB6, 0x26, 0x59, 0x18, 0x82, 0x83, 0x10, 0x8C,
+  0xBC, 0xD9, 0xBA, 0x9C, 0x9B, 0x98, 0x81, 0x32, 0x50, 0x01, 0x13, 0x21, 0x93, 0x07, 0x42, 0x58,
+  0x10, 0x84, 0x02, 0x09, 0xAC, 0xEB, 0xCA, 0xAA, 0x9C, 0x99, 0x98, 0x01, 0x20, 0x48, 0x92, 0x85,
+  0x13, 0x78, 0x30, 0x02, 0x06, 0x22, 0x20, 0x99, 0xD8, 0xCA, 0xBC, 0xCB, 0xBA, 0xA8, 0x08, 0x40,
+  0x21, 0x33, 0x22, 0x84, 0x93, 0x51, 0x39, 0x42, 0x17, 0x33, 0x32, 0x20, 0xB8, 0xFB, 0xAC, 0xAD,
+  0xAB, 0xB9, 0x18, 0x49, 0x11, 0x05, 0x22, 0x28, 0x80, 0x80, 0x30, 0x71, 0x24, 0x25, 0x33, 0x11,
+  0x80, 0xCB, 0xCD, 0xCB, 0xBB, 0xB9, 0x18, 0x30, 0x80, 0xFD, 0x22, 0x00, 0x61, 0x31, 0xA3, 0x83,
+  0x3E, 0x9D, 0xC3, 0x02, 0x58, 0x20, 0x23, 0x22, 0x92, 0x99, 0x9F, 0xDB, 0xB9, 0x9A, 0x0B, 0x81,
+  0x24, 0x53, 0x22, 0x83, 0x90, 0xCB, 0xCC, 0xAC, 0x9B, 0xA9, 0x22, 0x70, 0x32, 0x23, 0x33, 0x12,
+  0x08, 0xAB, 0xFB, 0xCA, 0xAB, 0xAC, 0xB9, 0xA9, 0x08, 0x03, 0x73, 0x24, 0x14, 0x22, 0x28, 0xD8,
+  0xBA, 0xDC, 0x9A, 0x9B, 0x89, 0x33, 0x54, 0x53, 0x23, 0x22, 0x01, 0xAA, 0xCC, 0xBD, 0xCA, 0xAA,
+  0x89, 0x11, 0x52, 0x33, 0x34, 0x43, 0x12, 0x81, 0x90, 0x9A, 0xBB, 0xCB, 0xC9, 0x98, 0x8C, 0x80,
+  0x00, 0x50, 0x81, 0x80, 0x61, 0x31, 0x32, 0x43, 0x34, 0x82, 0x80, 0x80, 0xF0, 0xAA, 0xAC, 0xBC,
+  0xB9, 0x0C, 0x80, 0x08, 0x08, 0x28, 0x27, 0x08, 0x25, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80,
+  0xF2, 0x9F, 0x00, 0xEB, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x78, 0x85, 0x00, 0x00, 0x1B, 0x00,
+  0x08, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x90, 0xF3, 0xFF, 0x80, 0x80, 0x08,
+  0x38, 0x07, 0x08, 0x15, 0x08, 0x38, 0x84, 0x00, 0x08, 0xFB, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0xB1, 0xF6, 0xDF, 0x80, 0x80,
+  0xB0, 0x8F, 0x80, 0x80, 0x80, 0x18, 0xFA, 0x0A, 0x08, 0x88, 0x80, 0x80, 0x80, 0x00, 0x29, 0xFD,
+  0x0D, 0x08, 0x08, 0xCD, 0x00, 0x08, 0x08, 0x08, 0x88, 0x00, 0x98, 0x75, 0x02, 0x08, 0x08, 0x88,
+  0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x80, 0x7D, 0x67, 0x08, 0x08, 0x08, 0x17, 0x80, 0x80,
+  0x90, 0x45, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x18, 0x39, 0x77, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0xA0, 0xF7, 0xBF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+  0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3A, 0xF9, 0xAF, 0x9F, 0x08,
+  0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x78, 0x47, 0x08, 0x08, 0x08, 0x88, 0x00, 0x29, 0xFF, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x88, 0x64, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x28,
+  0xFF, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA0, 0x77, 0x40, 0x93,
+  0xAA, 0x31, 0xCD, 0x8A, 0x80, 0x02, 0x0B, 0x08, 0x08, 0x90, 0x74, 0x62, 0x92, 0x00, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x21, 0xFF, 0x1E, 0xC1, 0x1B, 0x08, 0x08, 0x08, 0xA0,
+  0x77, 0xA8, 0x01, 0x81, 0x8A, 0x01, 0x01, 0x9E, 0x8A, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x88,
+  0x80, 0x80, 0xC0, 0x77, 0x9B, 0xFF, 0x12, 0x00, 0x02, 0x34, 0x80, 0x80, 0x90, 0xDF, 0x32, 0x29,
+  0xBF, 0x81, 0x88, 0x13, 0x49, 0x10, 0x99, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x80, 0x80, 0x79, 0xFF, 0x0B, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x47, 0x72, 0x80,
+  0x98, 0xD3, 0x4D, 0xB8, 0x80, 0x88, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0xB0,
+  0x77, 0x82, 0x13, 0x03, 0x90, 0x0F, 0xC0, 0x1A, 0xD9, 0x80, 0x80, 0x08, 0x80, 0x80, 0x90, 0x72,
+  0x35, 0xC0, 0x95, 0x49, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x21, 0xFF, 0xB9, 0xEB, 0x08, 0x88,
+  0x80, 0x00, 0x29, 0xA7, 0x79, 0x80, 0x31, 0x89, 0x28, 0xB2, 0xBB, 0xE8, 0x11, 0x9F, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x80, 0x79, 0xD1, 0x37, 0x0C, 0xBC, 0xFF, 0x1B, 0x00, 0x92, 0x18, 0x01, 0x88,
+  0x00, 0x08, 0xDA, 0xD9, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x44, 0x27, 0x5A, 0x08, 0x08, 0x88,
+  0xC1, 0x5C, 0xA8, 0x1A, 0xC5, 0x90, 0x01, 0x30, 0x01, 0x08, 0xE0, 0x88, 0x50, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0xF9, 0xF0, 0x2A, 0x23, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x90, 0xF6, 0xC7, 0x7F, 0xFB, 0x07, 0x99, 0x82, 0x89, 0x8A, 0x51, 0xA2, 0x0A, 0x88,
+  0x38, 0x96, 0x88, 0x80, 0x09, 0xB8, 0x21, 0xB9, 0x92, 0x81, 0x49, 0x1A, 0x80, 0xA5, 0x08, 0x90,
+  0x28, 0x0D, 0x29, 0x8C, 0x91, 0xF1, 0x93, 0x2A, 0xB9, 0xA0, 0xB4, 0x08, 0x1C, 0x8B, 0x48, 0x8F,
+  0x90, 0xA3, 0xA0, 0x29, 0x8C, 0x0A, 0xC5, 0x91, 0xA9, 0x52, 0x0D, 0xD3, 0x18, 0x01, 0x39, 0x1C,
+  0xD2, 0xA4, 0x80, 0x38, 0xA9, 0xC6, 0x82, 0x08, 0x91, 0x00, 0xC3, 0x94, 0x75, 0xFE, 0x1A, 0x00,
+  0x88, 0x04, 0x6A, 0x89, 0x28, 0xB1, 0x96, 0x01, 0xB1, 0x03, 0x82, 0x6E, 0x2A, 0x08, 0x08, 0x10,
+  0x39, 0x79, 0x09, 0x91, 0xA4, 0xB2, 0x84, 0x18, 0x92, 0x81, 0x94, 0x95, 0x2A, 0xA4, 0x08, 0x92,
+  0x42, 0x2F, 0x2B, 0xC1, 0x03, 0xC1, 0x91, 0x91, 0x38, 0xF1, 0x90, 0x08, 0xA1, 0x28, 0x1D, 0x18,
+  0xF0, 0x00, 0x88, 0x89, 0x90, 0x8C, 0x1A, 0x8D, 0x9B, 0x82, 0xAB, 0x41, 0xAF, 0xC1, 0x92, 0x3B,
+  0x8D, 0x1B, 0x29, 0x8F, 0x82, 0x2D, 0xD1, 0x39, 0x8A, 0x0A, 0xE1, 0x30, 0x0B, 0xF3, 0x10, 0xC8,
+  0x02, 0x1A, 0xD2, 0x81, 0x10, 0x0C, 0x93, 0xB3, 0xB1, 0x73, 0x8B, 0x89, 0x87, 0x29, 0x4B, 0xF3,
+  0x30, 0x99, 0x31, 0xB9, 0x33, 0x9B, 0x34, 0x8F, 0x95, 0x4A, 0x98, 0x38, 0xA1, 0x78, 0x8B, 0x03,
+  0x0A, 0x82, 0x29, 0xA5, 0x08, 0x92, 0x3B, 0xB6, 0x11, 0x92, 0x30, 0xE3, 0x2A, 0x03, 0x2F, 0xB4,
+  0x31, 0x01, 0x20, 0x00, 0x39, 0x98, 0x38, 0x91, 0x1D, 0xB3, 0x5F, 0xD1, 0x11, 0xA8, 0x38, 0xD0,
+  0x31, 0xBA, 0x51, 0x9A, 0x21, 0xDA, 0x83, 0x9B, 0x95, 0x0A, 0xA3, 0x0A, 0x93, 0x8E, 0x96, 0x1B,
+  0xB3, 0x2A, 0xE2, 0x18, 0xB1, 0x49, 0xE0, 0x20, 0x0B, 0x28, 0xAB, 0xA4, 0x39, 0x8B, 0xD2, 0x81,
+  0x81, 0x5B, 0xA0, 0x9B, 0xA7, 0x3A, 0xB0, 0x81, 0x18, 0x1D, 0xB2, 0x49, 0xB0, 0x78, 0x1A, 0x68,
+  0xA9, 0x81, 0x80, 0x59, 0x4D, 0xA8, 0x22, 0x2D, 0x18, 0x99, 0x03, 0x2F, 0x80, 0x03, 0x4B, 0x4B,
+  0xD1, 0x93, 0xB2, 0x12, 0x3B, 0x39, 0x2A, 0xD2, 0x04, 0xD1, 0x21, 0xF3, 0x12, 0x8C, 0x02, 0xA0,
+  0x14, 0x2A, 0xE1, 0x28, 0xB0, 0x88, 0x91, 0x62, 0x91, 0x33, 0xA0, 0x70, 0xE9, 0x12, 0x9D, 0x82,
+  0x09, 0x92, 0x8E, 0x89, 0x4D, 0x10, 0x10, 0xA0, 0x88, 0x21, 0x04, 0x02, 0xC0, 0x8B, 0x48, 0x3F,
+  0xA8, 0x80, 0x89, 0x99, 0x27, 0x00, 0x1F, 0x00, 0x0C, 0xD2, 0x90, 0x0C, 0x7B, 0x90, 0xA1, 0x98,
+  0x1A, 0x91, 0x84, 0xA3, 0x3D, 0x2B, 0x2B, 0xD6, 0x81, 0x88, 0x29, 0x88, 0x87, 0x29, 0x99, 0x80,
+  0x18, 0x11, 0xE2, 0x90, 0xC8, 0x31, 0x09, 0x29, 0x9F, 0x92, 0x38, 0x38, 0x0A, 0xA4, 0x13, 0x01,
+  0x13, 0xAC, 0x71, 0x19, 0x60, 0xA8, 0x94, 0x5A, 0x89, 0x93, 0xB4, 0xA2, 0x21, 0xA2, 0x29, 0x10,
+  0xB5, 0x87, 0x6C, 0x89, 0x28, 0xB0, 0x40, 0x98, 0x01, 0xC3, 0x38, 0xAB, 0x93, 0x2A, 0x1A, 0xA6,
+  0x3D, 0xA8, 0x7A, 0x0A, 0x82, 0x89, 0x10, 0x2C, 0xB5, 0x11, 0x90, 0x3C, 0xA8, 0xA2, 0x69, 0x8C,
+  0xC2, 0x09, 0xA0, 0x49, 0xD8, 0x09, 0xC3, 0x00, 0x19, 0x08, 0xFB, 0x20, 0x8B, 0x10, 0xD9, 0x82,
+  0x8C, 0x08, 0xAB, 0x86, 0x9A, 0x82, 0x0D, 0xC3, 0x88, 0x13, 0x0D, 0x08, 0x88, 0xA1, 0x4D, 0xD0,
+  0x0A, 0x33, 0x9E, 0x03, 0x0C, 0x13, 0x3A, 0x91, 0x47, 0xFE, 0x16, 0x00, 0x1F, 0x82, 0x00, 0xB3,
+  0x09, 0x08, 0x59, 0x87, 0x2B, 0x92, 0x00, 0x08, 0x68, 0x83, 0x08, 0x80, 0x80, 0x08, 0x90, 0x77,
+  0xA9, 0x13, 0x09, 0x80, 0x80, 0x78, 0xB8, 0x34, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xF7, 0x2F,
+  0xAC, 0x81, 0x80, 0x80, 0x08, 0x80, 0x08, 0xC0, 0x48, 0x08, 0x88, 0xF3, 0xAF, 0x08, 0x07, 0x18,
+  0x88, 0x80, 0xC1, 0x18, 0x38, 0x08, 0x08, 0x88, 0xE2, 0x4D, 0x91, 0x00, 0x08, 0x08, 0x08, 0x88,
+  0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // nine
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xF7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x69, 0x86, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xCF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x59, 0x37,
+  0x08, 0x08, 0x88, 0x00, 0x08, 0x88, 0xF2, 0x9F, 0x88, 0x80, 0x80, 0x00, 0x88, 0x90, 0x74, 0x84,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x39, 0xFF, 0x0A, 0x08, 0x80, 0x08, 0x90, 0x57, 0x88, 0x52,
+  0x90, 0x51, 0x80, 0x80, 0x80, 0x90, 0x8F, 0x80, 0x9C, 0x80, 0x9C, 0x80, 0x90, 0x73, 0x08, 0x04,
+  0x23, 0x13, 0x52, 0x80, 0x80, 0x80, 0xAE, 0xBB, 0xBD, 0xAC, 0xDA, 0xA9, 0xAA, 0x0A, 0x33, 0x61,
+  0x33, 0x36, 0x24, 0x43, 0x32, 0x11, 0x88, 0xD8, 0xEC, 0xCB, 0xBC, 0xCB, 0xAA, 0x9A, 0x09, 0x31,
+  0x45, 0x53, 0x43, 0x33, 0x32, 0x33, 0x12, 0x80, 0xCB, 0xDD, 0xCC, 0xCB, 0xAC, 0x9B, 0x8A, 0x10,
+  0x32, 0x45, 0x32, 0x34, 0x5A, 0x00, 0x32, 0x00, 0x42, 0x22, 0x21, 0x11, 0x88, 0xA9, 0xDA, 0xCC,
+  0xBC, 0xBC, 0xCB, 0xAA, 0x8A, 0x08, 0x42, 0x53, 0x34, 0x24, 0x42, 0x22, 0x22, 0x12, 0x11, 0xA0,
+  0xCA, 0xBE, 0xCC, 0xBC, 0xCB, 0xAB, 0x9A, 0x08, 0x42, 0x44, 0x33, 0x24, 0x33, 0x33, 0x13, 0x01,
+  0x98, 0xA9, 0xC9, 0xCC, 0xCB, 0xBD, 0xDB, 0xBB, 0xBC, 0xAA, 0x89, 0x21, 0x54, 0x43, 0x24, 0x42,
+  0x22, 0x22, 0x11, 0x10, 0x08, 0xA8, 0xBB, 0xCF, 0xBC, 0xCC, 0xBB, 0xCB, 0x9A, 0x08, 0x31, 0x45,
+  0x43, 0x32, 0x23, 0x24, 0x22, 0x01, 0x88, 0x89, 0x99, 0xAC, 0xEB, 0xCB, 0xBC, 0xBD, 0xCB, 0xAA,
+  0x99, 0x20, 0x52, 0x34, 0x34, 0x43, 0x32, 0x22, 0x12, 0x00, 0x88, 0x99, 0xCA, 0xCA, 0xCD, 0xCB,
+  0xBC, 0xCC, 0xAA, 0x9A, 0x08, 0x32, 0x44, 0x25, 0x33, 0x33, 0x33, 0x22, 0x01, 0x80, 0xA9, 0xCB,
+  0xBC, 0xEB, 0xCB, 0xEB, 0xBC, 0xCB, 0x9A, 0x89, 0x50, 0xDE, 0x34, 0x00, 0x20, 0x42, 0x63, 0x33,
+  0x34, 0x22, 0x22, 0x11, 0x00, 0x88, 0x9A, 0xEB, 0x9A, 0xDB, 0xCB, 0xCD, 0xBB, 0xAC, 0x99, 0x08,
+  0x31, 0x44, 0x44, 0x23, 0x24, 0x21, 0x12, 0x10, 0x00, 0x99, 0xA9, 0xBC, 0xB9, 0xBE, 0xEB, 0xAD,
+  0xCB, 0xAA, 0x88, 0x18, 0x32, 0x54, 0x34, 0x33, 0x33, 0x23, 0x12, 0x11, 0x08, 0x9A, 0xEB, 0x9B,
+  0xDA, 0xCB, 0xEC, 0xBB, 0xAC, 0x9B, 0x88, 0x10, 0x43, 0x54, 0x33, 0x43, 0x22, 0x22, 0x01, 0x00,
+  0x90, 0xA9, 0xEB, 0x99, 0xCB, 0xCA, 0xCE, 0xBA, 0xAC, 0x8A, 0x09, 0x20, 0x43, 0x45, 0x33, 0x33,
+  0x23, 0x23, 0x01, 0x00, 0xA8, 0xAA, 0xCE, 0x89, 0xCB, 0xDA, 0xCD, 0xBA, 0xAC, 0x89, 0x88, 0x21,
+  0x34, 0x46, 0x22, 0x23, 0x32, 0x22, 0x80, 0x80, 0xA9, 0xBA, 0xBD, 0x8A, 0xEB, 0xCA, 0xCE, 0xAA,
+  0xAC, 0x88, 0x09, 0x21, 0x53, 0x35, 0x33, 0x33, 0x23, 0x22, 0x90, 0x80, 0x11, 0x18, 0x2D, 0x00,
+  0xBB, 0xBB, 0xCE, 0x88, 0xCA, 0xCA, 0xCF, 0xAA, 0xBA, 0x89, 0x89, 0x31, 0x44, 0x45, 0x32, 0x23,
+  0x12, 0x12, 0x90, 0x98, 0xAA, 0xBB, 0xCC, 0x1A, 0xD9, 0xAB, 0xEF, 0x9A, 0xAB, 0x89, 0x88, 0x20,
+  0x44, 0x35, 0x43, 0x22, 0x22, 0x01, 0x00, 0x98, 0xA9, 0xB9, 0xBA, 0x9B, 0xF9, 0xBE, 0xDC, 0xAB,
+  0xBA, 0x89, 0x00, 0x31, 0x46, 0x34, 0x33, 0x24, 0x12, 0x02, 0x88, 0x88, 0x9A, 0xAA, 0xAA, 0xEB,
+  0xBE, 0xBC, 0xAF, 0x89, 0x0A, 0x81, 0x00, 0x42, 0x41, 0x35, 0x11, 0x33, 0x14, 0x32, 0xA3, 0x3C,
+  0xD9, 0x99, 0xD2, 0x1C, 0xCF, 0x99, 0xCB, 0x51, 0x80, 0x31, 0xB9, 0x51, 0x80, 0x33, 0xB8, 0x52,
+  0x99, 0x14, 0xBA, 0x83, 0x9F, 0x02, 0x0C, 0x94, 0xBC, 0x0A, 0xAB, 0x31, 0x16, 0x21, 0xBA, 0x39,
+  0x15, 0x33, 0xA9, 0x2A, 0xA4, 0x70, 0xA9, 0x08, 0xE9, 0x58, 0xB9, 0x31, 0xFB, 0x0A, 0x88, 0x38,
+  0xC3, 0xE4, 0x40, 0x00, 0x22, 0x11, 0xB8, 0x2C, 0x26, 0x21, 0xA1, 0x0D, 0x02, 0x18, 0xA1, 0x0E,
+  0x91, 0x8C, 0x85, 0x8D, 0x93, 0xAF, 0x11, 0x88, 0x43, 0x89, 0x81, 0x8A, 0x62, 0x11, 0x91, 0x8C,
+  0x01, 0x11, 0x91, 0xAC, 0x02, 0x9C, 0x00, 0xD8, 0x2B, 0xF0, 0x0F, 0x02, 0x19, 0x14, 0x99, 0x80,
+  0x28, 0x26, 0x80, 0x9A, 0x88, 0x12, 0x19, 0xD0, 0x0B, 0x92, 0x9E, 0x11, 0xEC, 0x30, 0xFB, 0x38,
+  0x92, 0x49, 0x83, 0x0C, 0x01, 0x30, 0x15, 0xBA, 0x88, 0x28, 0xA0, 0x08, 0xD0, 0x0B, 0xB1, 0x9E,
+  0x13, 0xED, 0x21, 0xFA, 0x40, 0x91, 0x39, 0x93, 0x9B, 0x13, 0x21, 0x05, 0xCB, 0x28, 0x90, 0x09,
+  0x88, 0x88, 0xCB, 0x88, 0xB9, 0x38, 0xFB, 0x3D, 0xF8, 0x48, 0x83, 0x2A, 0x05, 0xAB, 0x32, 0x02,
+  0x22, 0xFA, 0x2A, 0x92, 0x8B, 0x04, 0x9C, 0x81, 0xAA, 0x38, 0xF8, 0x89, 0x01, 0xCC, 0x60, 0x82,
+  0x29, 0x05, 0xBA, 0x41, 0x90, 0x0E, 0x45, 0x00, 0x82, 0x21, 0xE8, 0x1A, 0x83, 0xAB, 0x13, 0xBB,
+  0x20, 0xDC, 0x20, 0xA9, 0x0C, 0x18, 0xF9, 0x3A, 0x17, 0x99, 0x43, 0xC0, 0x29, 0x13, 0x18, 0xA2,
+  0x9F, 0x31, 0xC8, 0x29, 0xA1, 0x8B, 0x91, 0x9A, 0x12, 0xAF, 0x10, 0xD0, 0x1A, 0x44, 0x90, 0x41,
+  0x91, 0x8A, 0x52, 0x11, 0x80, 0xEA, 0x18, 0x81, 0x9C, 0x13, 0xCB, 0x19, 0xB0, 0x1C, 0xC2, 0x8C,
+  0x83, 0xAF, 0x62, 0x91, 0x39, 0x04, 0xBA, 0x41, 0x83, 0x10, 0xC8, 0x8A, 0x11, 0xAA, 0x39, 0xE3,
+  0x9D, 0x12, 0xCB, 0x11, 0xAA, 0x4B, 0xF2, 0x1B, 0x27, 0x9A, 0x52, 0xA0, 0x1A, 0x23, 0x08, 0x81,
+  0xCB, 0x28, 0x91, 0x9C, 0x22, 0xEB, 0x2A, 0xB2, 0x8D, 0x02, 0xCB, 0x33, 0xBF, 0x72, 0x91, 0x2A,
+  0x05, 0xAA, 0x40, 0x92, 0x18, 0x98, 0x8A, 0x00, 0x99, 0x29, 0xC0, 0x8C, 0x92, 0xBB, 0x20, 0xCB,
+  0x5B, 0xF1, 0x2B, 0x27, 0x9A, 0x52, 0xB2, 0x0B, 0x08, 0xFE, 0x43, 0x00, 0x34, 0x90, 0x88, 0xA8,
+  0x8A, 0x92, 0x9C, 0x22, 0xCD, 0x10, 0xC0, 0x1B, 0x93, 0xAC, 0x41, 0xCD, 0x50, 0x94, 0x0A, 0x25,
+  0xB8, 0x3A, 0x14, 0x98, 0x80, 0xB9, 0x18, 0xA8, 0x89, 0x82, 0xAF, 0x21, 0xEA, 0x19, 0x92, 0x9B,
+  0x41, 0xDD, 0x50, 0x93, 0x1B, 0x36, 0xC9, 0x39, 0x13, 0x9A, 0x02, 0xCA, 0x18, 0xA8, 0x08, 0xA2,
+  0x9C, 0x01, 0xDB, 0x39, 0xA0, 0xAA, 0x00, 0xAF, 0x71, 0x93, 0x3A, 0x37, 0xC9, 0x28, 0x14, 0x99,
+  0x81, 0xB9, 0x18, 0xA9, 0x2A, 0xB2, 0xBC, 0x22, 0xDD, 0x19, 0x82, 0x9A, 0x0B, 0xAB, 0x70, 0x07,
+  0x89, 0x46, 0xB8, 0x2A, 0x15, 0x99, 0x10, 0xA9, 0x09, 0xA0, 0x09, 0x90, 0x8B, 0x91, 0xBD, 0x10,
+  0x9B, 0x33, 0xFF, 0x00, 0x80, 0x33, 0x0A, 0x75, 0xA1, 0x8B, 0x35, 0xA0, 0x19, 0xB1, 0x8C, 0x83,
+  0x9C, 0x21, 0xDA, 0x10, 0xC2, 0x8D, 0x03, 0x8A, 0x8A, 0xA0, 0x0A, 0x74, 0x73, 0xF2, 0x41, 0x00,
+  0x90, 0x60, 0x84, 0xAB, 0x52, 0x91, 0x09, 0x91, 0x9A, 0x01, 0xAB, 0x20, 0xD9, 0x49, 0xC0, 0x9B,
+  0x83, 0x8A, 0xA0, 0x9E, 0x11, 0x21, 0x14, 0x62, 0x25, 0xC9, 0x59, 0x04, 0x8A, 0x01, 0xCB, 0x20,
+  0xC0, 0x1A, 0x93, 0x9E, 0x22, 0xDA, 0x28, 0x91, 0x0B, 0xB0, 0x08, 0x44, 0x18, 0x21, 0x36, 0xA2,
+  0x8C, 0x45, 0xA1, 0x0A, 0xB0, 0x8B, 0x81, 0xBA, 0x08, 0xCA, 0x49, 0xE1, 0x8C, 0x11, 0x98, 0xB8,
+  0x39, 0x1C, 0x05, 0x04, 0x54, 0x22, 0xCC, 0x41, 0x83, 0x8A, 0x91, 0x9E, 0x20, 0xD0, 0x09, 0x81,
+  0x9B, 0x12, 0xCB, 0x18, 0x83, 0x8D, 0x8C, 0x94, 0x30, 0x14, 0x0B, 0x57, 0xB8, 0x29, 0x14, 0x98,
+  0x80, 0xCB, 0x11, 0xC8, 0x39, 0xC0, 0x8B, 0x05, 0x9C, 0x10, 0x89, 0x20, 0xF8, 0x1A, 0x13, 0x4A,
+  0x04, 0x19, 0x17, 0xBA, 0x41, 0x93, 0x89, 0xA0, 0x8E, 0x82, 0xA9, 0x08, 0xC8, 0x19, 0xA3, 0x8E,
+  0xBF, 0xE9, 0x3D, 0x00, 0x82, 0x11, 0xC9, 0x18, 0x01, 0x46, 0x90, 0x50, 0x03, 0xAA, 0x32, 0x12,
+  0x2A, 0xFB, 0x9C, 0x01, 0x8C, 0x98, 0xC9, 0x18, 0xA8, 0x08, 0x04, 0x49, 0x04, 0xCC, 0x72, 0x81,
+  0x28, 0x93, 0x2C, 0x84, 0x8C, 0x42, 0xC9, 0x18, 0xE8, 0x29, 0xA2, 0x8C, 0x81, 0x8B, 0x03, 0x8B,
+  0x25, 0x0A, 0x17, 0xA9, 0x28, 0x32, 0x93, 0x8A, 0x88, 0x39, 0xB1, 0x9D, 0x86, 0xAB, 0x89, 0x8F,
+  0x11, 0xCA, 0x90, 0x0C, 0x80, 0x20, 0x04, 0x5A, 0x16, 0x90, 0x88, 0x41, 0x02, 0x90, 0xCC, 0x30,
+  0xD0, 0x38, 0xB8, 0x0A, 0x90, 0xE9, 0x2A, 0xA2, 0x9C, 0xA1, 0x8E, 0x22, 0x03, 0x31, 0x64, 0x02,
+  0x99, 0x38, 0x25, 0xA2, 0xAD, 0x00, 0x0C, 0x92, 0x8B, 0x11, 0xBF, 0x04, 0xAC, 0x41, 0xAB, 0x03,
+  0xBD, 0x13, 0x19, 0x34, 0x1A, 0x37, 0x89, 0x18, 0x29, 0x07, 0x8A, 0x99, 0x99, 0x02, 0x8C, 0x01,
+  0x9C, 0x58, 0xB9, 0x9A, 0x9A, 0xF5, 0x37, 0x00, 0xA5, 0x29, 0x99, 0x8E, 0x90, 0x04, 0x81, 0x78,
+  0x13, 0x90, 0x98, 0x71, 0x00, 0xA0, 0xA9, 0x88, 0xA9, 0x82, 0xC9, 0x49, 0x99, 0xB8, 0xAA, 0x09,
+  0x31, 0xF9, 0x8F, 0x3C, 0xA0, 0x85, 0x40, 0x50, 0xB0, 0x00, 0x02, 0x51, 0xB8, 0x98, 0xA9, 0x30,
+  0xD9, 0x12, 0x8F, 0x82, 0x89, 0x89, 0xA9, 0x23, 0xBB, 0xFB, 0x4C, 0x3A, 0xB2, 0x33, 0x55, 0x8A,
+  0x18, 0x93, 0x44, 0x0A, 0xBA, 0xB0, 0x31, 0xBA, 0xA6, 0x0C, 0x12, 0x9C, 0xA1, 0x2C, 0x82, 0x0C,
+  0xFC, 0x01, 0x18, 0x28, 0x22, 0x87, 0x89, 0x38, 0x28, 0x87, 0x88, 0x89, 0x19, 0xA0, 0x81, 0xC8,
+  0x20, 0xE4, 0x3B, 0xAB, 0x11, 0xA1, 0x99, 0xAF, 0xB4, 0x48, 0x80, 0x72, 0xA0, 0x18, 0x99, 0x45,
+  0x89, 0x82, 0x0A, 0xC1, 0x3A, 0xB3, 0x39, 0xB9, 0xDB, 0xD8, 0x22, 0x2D, 0xB1, 0x0A, 0x1C, 0xD8,
+  0x84, 0x58, 0x81, 0x8B, 0xD1, 0x51, 0x11, 0x29, 0xE6, 0x0A, 0x3C, 0x00, 0x92, 0x99, 0xD0, 0x50,
+  0x88, 0x00, 0xDB, 0x19, 0xA8, 0x22, 0xB9, 0x10, 0xFC, 0x22, 0x0F, 0x93, 0x39, 0xC1, 0x2A, 0xC0,
+  0x44, 0x88, 0x22, 0x99, 0xA2, 0x2B, 0x12, 0x48, 0xF8, 0x8A, 0x89, 0x11, 0x09, 0xA8, 0x90, 0xA9,
+  0x1A, 0x0D, 0x02, 0x84, 0xFA, 0x92, 0x4E, 0x04, 0x48, 0xA3, 0x20, 0xAC, 0x22, 0x2A, 0xA5, 0x0D,
+  0xB9, 0x30, 0x0A, 0xB3, 0x1C, 0xF1, 0x10, 0x0B, 0x01, 0x09, 0xC5, 0x3A, 0x8C, 0x07, 0x28, 0x02,
+  0x38, 0xD9, 0x01, 0x29, 0x82, 0x9B, 0xEA, 0x18, 0x98, 0x11, 0x0D, 0xA0, 0x09, 0xB9, 0x81, 0x49,
+  0xB0, 0x09, 0xF0, 0x70, 0x28, 0x06, 0x10, 0xC1, 0x39, 0x8B, 0x06, 0x89, 0xA9, 0x1B, 0x99, 0x12,
+  0xBA, 0xA2, 0x2D, 0x9A, 0x91, 0x29, 0x90, 0xF2, 0x5C, 0x9C, 0x07, 0x38, 0x81, 0x22, 0xCA, 0x92,
+  0x59, 0x80, 0x90, 0xAC, 0x90, 0x49, 0xA9, 0x92, 0x1C, 0xB8, 0x10, 0x9B, 0xA5, 0xF2, 0x30, 0x00,
+  0x97, 0x2B, 0x8B, 0xBA, 0x37, 0x52, 0x32, 0x30, 0xDA, 0x91, 0x48, 0x11, 0xA9, 0xAD, 0xA8, 0x11,
+  0x09, 0xA8, 0x2C, 0xEA, 0xB3, 0x4A, 0x9B, 0x12, 0x0F, 0xF3, 0x31, 0x3A, 0x05, 0x40, 0xB8, 0xA3,
+  0x5B, 0x08, 0x92, 0x9B, 0xCA, 0x81, 0x29, 0xA8, 0x98, 0x8B, 0xAB, 0x99, 0xB9, 0x96, 0x2F, 0xFA,
+  0x84, 0x58, 0x01, 0x13, 0x09, 0xC1, 0x20, 0x29, 0xB2, 0x8B, 0xBE, 0x92, 0x5B, 0xBA, 0xB3, 0x39,
+  0x9C, 0xA0, 0x2C, 0xC0, 0xA2, 0xA9, 0x49, 0x71, 0x33, 0x07, 0x11, 0x9A, 0x90, 0x31, 0x00, 0xF8,
+  0xA9, 0x09, 0x98, 0x98, 0x99, 0xB8, 0x90, 0x0D, 0xE9, 0x03, 0x2E, 0xE8, 0x12, 0x6A, 0x11, 0x23,
+  0x18, 0xB0, 0x10, 0x5A, 0xA1, 0x98, 0x9E, 0xB0, 0x01, 0x1D, 0xA8, 0x81, 0x99, 0x99, 0x0A, 0x00,
+  0x39, 0xFD, 0x93, 0x70, 0x22, 0x06, 0x11, 0xA9, 0x80, 0x48, 0x88, 0xA8, 0x8D, 0xB9, 0x92, 0x1C,
+  0xC6, 0xFE, 0x35, 0x00, 0xB0, 0x81, 0x0E, 0xA8, 0x00, 0x89, 0xD6, 0x39, 0x3D, 0x93, 0x17, 0x20,
+  0x90, 0x88, 0x2A, 0x92, 0x92, 0x8D, 0xAB, 0x98, 0xA9, 0x98, 0x09, 0x9C, 0xCA, 0xB9, 0x93, 0x7D,
+  0x9C, 0xD5, 0x22, 0x59, 0x11, 0x10, 0x99, 0xB2, 0x41, 0x2B, 0xD8, 0xA0, 0x0A, 0xB8, 0x08, 0x0C,
+  0xC0, 0x81, 0x1E, 0x89, 0x20, 0xDA, 0xB4, 0x50, 0x58, 0x12, 0x02, 0x90, 0x90, 0x30, 0x29, 0xF8,
+  0xA8, 0x89, 0x99, 0x0A, 0x8C, 0xD0, 0x00, 0x0C, 0xA8, 0x69, 0xBB, 0xA7, 0x40, 0x49, 0x03, 0x12,
+  0x88, 0x80, 0x30, 0x98, 0xE0, 0x99, 0x8A, 0xC8, 0x98, 0x9A, 0x99, 0xAB, 0xD0, 0x10, 0x2F, 0xDA,
+  0x93, 0x51, 0x42, 0x42, 0x11, 0xA2, 0x20, 0x3B, 0xC2, 0xB8, 0x9D, 0x9A, 0x9A, 0xDA, 0x90, 0x0C,
+  0xAA, 0xA8, 0xA1, 0x5A, 0x8F, 0x91, 0x34, 0x73, 0x21, 0x01, 0xA1, 0x82, 0x20, 0x9A, 0xEA, 0xB9,
+  0x99, 0x0C, 0xAB, 0xC0, 0xF8, 0xF7, 0x31, 0x00, 0x99, 0x8C, 0x89, 0x91, 0x89, 0x8D, 0x48, 0x44,
+  0x27, 0x31, 0x01, 0x01, 0x80, 0x22, 0xBB, 0xCC, 0xBB, 0xA9, 0x9C, 0xBA, 0xAB, 0xB9, 0x8C, 0xA9,
+  0x9A, 0xC9, 0x8B, 0x42, 0x67, 0x43, 0x24, 0x22, 0x22, 0x22, 0x02, 0xAA, 0xCD, 0xAA, 0xBB, 0xBB,
+  0xCB, 0xCA, 0xAC, 0xAA, 0xAB, 0xBA, 0xAD, 0x31, 0x55, 0x36, 0x43, 0x23, 0x22, 0x22, 0x12, 0xB8,
+  0xBD, 0xBC, 0xBB, 0xBB, 0xBC, 0xAB, 0xAC, 0xBB, 0xBB, 0xAB, 0xDA, 0x38, 0x46, 0x45, 0x24, 0x33,
+  0x22, 0x22, 0x02, 0xA0, 0xCD, 0xBB, 0xCB, 0xAA, 0xBB, 0xAB, 0xAC, 0xBA, 0xAC, 0x99, 0xA9, 0x41,
+  0x44, 0x37, 0x34, 0x24, 0x12, 0x12, 0x11, 0x98, 0xBD, 0xBB, 0xBC, 0xBA, 0xAC, 0xAA, 0xAB, 0xAB,
+  0xAB, 0x9B, 0xBA, 0x72, 0x44, 0x46, 0x32, 0x24, 0x22, 0x21, 0x01, 0xA9, 0xBC, 0xAD, 0xBB, 0xCA,
+  0xAA, 0xAA, 0xBB, 0xBB, 0xBB, 0xA9, 0x8C, 0x45, 0x61, 0xF2, 0x2B, 0x00, 0x54, 0x44, 0x33, 0x33,
+  0x23, 0x33, 0x80, 0xDB, 0xBC, 0xAC, 0xAC, 0xBA, 0xBB, 0xCA, 0xAB, 0xBA, 0xAA, 0xA9, 0x48, 0x55,
+  0x63, 0x43, 0x33, 0x33, 0x22, 0x11, 0xB8, 0xEB, 0xAC, 0xCB, 0xBA, 0xBB, 0xBB, 0xBC, 0xAA, 0xAB,
+  0x09, 0x18, 0x75, 0x33, 0x36, 0x43, 0x32, 0x22, 0x11, 0x80, 0xCB, 0xDB, 0xBB, 0xCB, 0xAC, 0xBA,
+  0xBA, 0xAA, 0xAA, 0x98, 0x30, 0x65, 0x53, 0x53, 0x23, 0x43, 0x12, 0x02, 0x01, 0xB9, 0xCC, 0xCB,
+  0xAA, 0xCB, 0xBA, 0xAC, 0xAA, 0x9A, 0x89, 0x11, 0x73, 0x34, 0x35, 0x34, 0x32, 0x12, 0x22, 0x91,
+  0x9A, 0xCD, 0xBB, 0xDB, 0xAB, 0xCB, 0xAC, 0xAA, 0x9A, 0x99, 0x20, 0x35, 0x44, 0x44, 0x43, 0x22,
+  0x22, 0x12, 0x80, 0xB9, 0xBC, 0xBD, 0xBC, 0xCB, 0xBA, 0xBB, 0xBB, 0x9C, 0x08, 0x28, 0x54, 0x44,
+  0x34, 0x43, 0x32, 0x22, 0x01, 0x00, 0xCB, 0xCA, 0xBC, 0xAC, 0xBB, 0xCB, 0xFD, 0xF8, 0x2E, 0x00,
+  0xBA, 0xBB, 0x9A, 0x80, 0x52, 0x53, 0x35, 0x34, 0x34, 0x23, 0x32, 0x81, 0x81, 0xCB, 0xCA, 0xCC,
+  0xCA, 0xAA, 0xAC, 0xBA, 0xAA, 0xAA, 0x08, 0x41, 0x44, 0x44, 0x34, 0x33, 0x14, 0x22, 0x01, 0x90,
+  0xBB, 0xCD, 0xBB, 0xBC, 0xAC, 0xAC, 0xBA, 0xAA, 0x9A, 0x08, 0x42, 0x35, 0x45, 0x23, 0x34, 0x22,
+  0x13, 0x01, 0x99, 0xCB, 0xBC, 0xBD, 0xAC, 0xBB, 0xBC, 0xBB, 0x9A, 0xA9, 0x38, 0x45, 0x63, 0x43,
+  0x42, 0x23, 0x22, 0x12, 0x00, 0xA9, 0xBC, 0xCC, 0xCB, 0xBB, 0xBC, 0xBB, 0xBA, 0xAA, 0x80, 0x52,
+  0x54, 0x53, 0x33, 0x34, 0x42, 0x11, 0x11, 0x98, 0xA9, 0xCC, 0xBB, 0xBC, 0xBB, 0xBD, 0xAA, 0x9A,
+  0x9A, 0x02, 0x62, 0x25, 0x34, 0x34, 0x23, 0x33, 0x22, 0x80, 0x90, 0xBC, 0xDD, 0xBA, 0xBB, 0xBC,
+  0xAC, 0xBB, 0x99, 0xA9, 0x22, 0x73, 0x43, 0x34, 0x43, 0x33, 0x22, 0x02, 0x11, 0xAA, 0xCC, 0xCC,
+  0xD5, 0x04, 0x2C, 0x00, 0xBA, 0xCB, 0xAD, 0xAA, 0x9B, 0x9A, 0x89, 0x32, 0x35, 0x46, 0x32, 0x43,
+  0x22, 0x23, 0x12, 0x80, 0xA9, 0xCC, 0xCB, 0xCC, 0xBB, 0xDB, 0xAA, 0xAA, 0x98, 0x20, 0x43, 0x55,
+  0x32, 0x34, 0x22, 0x33, 0x22, 0x80, 0x90, 0xCC, 0xBC, 0xCB, 0xBD, 0xBA, 0xCB, 0x9A, 0x99, 0x10,
+  0x32, 0x55, 0x24, 0x33, 0x24, 0x33, 0x11, 0x02, 0xA9, 0xCB, 0xBD, 0xBD, 0xCB, 0xBB, 0xBC, 0xAA,
+  0x9A, 0x18, 0x22, 0x46, 0x42, 0x43, 0x32, 0x32, 0x22, 0x82, 0x8A, 0xDA, 0xDB, 0xBC, 0xCA, 0xBB,
+  0xAC, 0xAA, 0x9A, 0x80, 0x51, 0x33, 0x44, 0x34, 0x43, 0x32, 0x22, 0x01, 0x08, 0xAA, 0xEA, 0xBC,
+  0xDB, 0xAB, 0xBB, 0xAB, 0xA9, 0x08, 0x53, 0x52, 0x44, 0x33, 0x33, 0x25, 0x22, 0x11, 0xA1, 0x89,
+  0xCC, 0xCA, 0xDB, 0xAB, 0xAB, 0x9B, 0xB9, 0x32, 0x38, 0x46, 0x43, 0x34, 0x24, 0x22, 0x21, 0x01,
+  0xB8, 0xB9, 0xCC, 0xAE, 0x04, 0x02, 0x27, 0x00, 0xBB, 0xCB, 0xAA, 0xC9, 0x29, 0x80, 0x51, 0x22,
+  0x35, 0x33, 0x24, 0x22, 0x13, 0xB8, 0xBA, 0xAD, 0xCC, 0xAC, 0xAB, 0xBB, 0x8C, 0x9B, 0x80, 0x51,
+  0x31, 0x25, 0x34, 0x32, 0x52, 0x82, 0x08, 0x08, 0xC9, 0xCB, 0xCA, 0x8C, 0xC9, 0xB0, 0x0A, 0x40,
+  0x82, 0x51, 0x30, 0x03, 0x05, 0x33, 0x08, 0x08, 0x08, 0x08, 0xF1, 0x0D, 0x08, 0x9D, 0x80, 0x08,
+  0x90, 0x44, 0x08, 0x00, 0x08, 0x08, 0x08, 0x98, 0x77, 0xAA, 0x80, 0x80, 0x08, 0x18, 0xEC, 0x08,
+  0x08, 0x08, 0x08, 0x80, 0xA0, 0xCF, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF1, 0x0E, 0x08, 0x08, 0x08,
+  0x08, 0xAF, 0x80, 0x80, 0x00, 0xFB, 0x08, 0x88, 0x34, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0x91, 0xFF, 0x8B, 0x80, 0x90, 0x73, 0x83, 0x00, 0x88, 0x37, 0x08, 0x08, 0x08, 0x90, 0x75,
+  0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x90, 0x76, 0xFE, 0xFF, 0x21, 0x00, 0x80, 0x80, 0x08, 0x90,
+  0x72, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7B, 0xFF, 0x0F, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x10, 0x99, 0xF7,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x75, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08,
+  0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // ten
+  0x75, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x0A, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x90, 0xE2, 0x77,
+  0xC2, 0x28, 0xA3, 0x3A, 0x85, 0x99, 0x12, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x00,
+  0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0x1F, 0x8B, 0x00, 0x08, 0x88,
+  0x44, 0x8D, 0x18, 0xC3, 0x08, 0x27, 0xCA, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x90, 0x73,
+  0xA7, 0x79, 0x8F, 0xF7, 0x70, 0xB8, 0x12, 0x2B, 0xEB, 0x24, 0xA9, 0x11, 0xAA, 0x28, 0x23, 0xA0,
+  0x2B, 0x9B, 0x24, 0x00, 0xB9, 0x19, 0x3C, 0x91, 0xB3, 0x22, 0xA9, 0x78, 0xB9, 0x11, 0xC4, 0x38,
+  0x1D, 0xA9, 0x01, 0x89, 0x2D, 0xC0, 0x28, 0xD1, 0x30, 0x2A, 0xA0, 0x2A, 0xB6, 0x08, 0xA8, 0xA4,
+  0x3C, 0xC7, 0x20, 0x8A, 0x8F, 0xFB, 0x32, 0x00, 0x02, 0x1B, 0xE4, 0x01, 0x3B, 0xB2, 0x7C, 0xB9,
+  0x86, 0x09, 0xA1, 0x0A, 0xA3, 0x80, 0x22, 0x80, 0xE2, 0x83, 0x7B, 0xA1, 0x4A, 0xBB, 0x97, 0x29,
+  0xB1, 0x30, 0xDA, 0x84, 0x2A, 0x90, 0x49, 0xC8, 0x03, 0x2C, 0x00, 0x7B, 0x99, 0x82, 0x3B, 0xA2,
+  0x7B, 0xB8, 0x83, 0x1B, 0xA5, 0x49, 0xA9, 0x02, 0x98, 0x18, 0x7C, 0x9A, 0xA5, 0x18, 0xC1, 0x58,
+  0x99, 0x83, 0x0A, 0x92, 0x2E, 0xD3, 0x20, 0xA8, 0x40, 0xAB, 0x85, 0x1A, 0xA2, 0x2A, 0xC1, 0x38,
+  0xA0, 0x70, 0xBB, 0x86, 0x0A, 0xA4, 0x5A, 0xB8, 0x21, 0xAB, 0x86, 0x0A, 0x91, 0x29, 0xB2, 0x39,
+  0xB9, 0x22, 0x8B, 0x81, 0x18, 0xD8, 0x31, 0x8C, 0x87, 0x1C, 0x81, 0x3A, 0xB0, 0x92, 0x02, 0x9F,
+  0xA4, 0x79, 0xA0, 0x10, 0xBA, 0x11, 0x91, 0x72, 0xAA, 0xB4, 0x5A, 0x8A, 0x84, 0x29, 0xA9, 0xB2,
+  0x29, 0x5B, 0x04, 0x89, 0xF3, 0x2A, 0x12, 0x39, 0x52, 0x03, 0x33, 0x00, 0xCB, 0x88, 0x04, 0x23,
+  0x8F, 0x08, 0x80, 0x01, 0xC0, 0x63, 0x1A, 0xA1, 0x0F, 0xA2, 0x70, 0x89, 0x81, 0x0A, 0xD1, 0x21,
+  0x89, 0x32, 0x0D, 0xB1, 0x98, 0x94, 0x68, 0x99, 0x80, 0xA0, 0x02, 0xA0, 0x22, 0x3B, 0xE8, 0x28,
+  0x0A, 0x21, 0x90, 0xA5, 0x0F, 0x89, 0xB4, 0x14, 0x0A, 0x1D, 0x01, 0x18, 0xD2, 0x98, 0x0C, 0x04,
+  0x03, 0x4A, 0xDE, 0x11, 0x19, 0x96, 0x09, 0xD8, 0x20, 0x28, 0x82, 0xA9, 0xDC, 0x32, 0x6A, 0xB2,
+  0xA8, 0xA8, 0x41, 0x10, 0x10, 0x9F, 0x91, 0x40, 0xB1, 0x91, 0x1D, 0x92, 0x21, 0xA0, 0x4B, 0x9A,
+  0x83, 0xD4, 0x02, 0x2D, 0x10, 0x0D, 0xA1, 0x04, 0x0A, 0x68, 0xAB, 0xA3, 0x84, 0x88, 0x82, 0x8C,
+  0xB5, 0x79, 0xA8, 0x02, 0xB9, 0x02, 0x13, 0xAB, 0x49, 0x0D, 0x87, 0x08, 0xD8, 0x00, 0x30, 0x82,
+  0xD9, 0x88, 0x01, 0x40, 0x01, 0xDB, 0xA0, 0x62, 0x1A, 0xC3, 0x4B, 0xA9, 0x74, 0xFA, 0x3E, 0x00,
+  0x10, 0xC4, 0x31, 0x0D, 0x91, 0x3A, 0x88, 0x96, 0x1A, 0x8A, 0x58, 0x98, 0x94, 0x1A, 0x1E, 0x90,
+  0x05, 0x0A, 0xB0, 0x49, 0xA8, 0xA7, 0x10, 0x1A, 0x1C, 0xC3, 0x02, 0x99, 0x13, 0x9D, 0x93, 0x3F,
+  0xA3, 0x11, 0xCC, 0x28, 0x49, 0x92, 0x92, 0x9F, 0x82, 0x60, 0x0A, 0xE1, 0x38, 0x89, 0x03, 0xAA,
+  0x90, 0x59, 0x01, 0xB2, 0x2D, 0xB8, 0x33, 0xBA, 0x07, 0x1A, 0xCA, 0x12, 0x28, 0x94, 0x2B, 0x9F,
+  0x04, 0x18, 0xB0, 0x20, 0x1C, 0xA1, 0x10, 0x98, 0x43, 0x9C, 0xB1, 0x90, 0x43, 0x32, 0x9E, 0x08,
+  0x19, 0x97, 0x99, 0xB1, 0x79, 0x80, 0x91, 0xDA, 0x41, 0x0A, 0xA4, 0x00, 0x20, 0xAC, 0xA3, 0x58,
+  0xB2, 0x30, 0x9C, 0x92, 0x1C, 0xE2, 0x58, 0x9A, 0xB3, 0x59, 0xAA, 0x01, 0x10, 0x38, 0x91, 0x10,
+  0xC8, 0x17, 0x1A, 0x88, 0x42, 0x88, 0xCA, 0x2B, 0xB0, 0x87, 0x0F, 0xC1, 0x30, 0xCA, 0x02, 0x0B,
+  0x3D, 0xE0, 0x42, 0x00, 0x94, 0x59, 0xC8, 0x12, 0x09, 0x32, 0x91, 0x14, 0x3B, 0xD1, 0x09, 0x89,
+  0x42, 0xD0, 0xAA, 0x8D, 0x90, 0x11, 0x0D, 0xC2, 0x22, 0x2B, 0x9D, 0xA3, 0x52, 0x82, 0x21, 0x11,
+  0x44, 0x8A, 0xA8, 0x1B, 0x07, 0x10, 0xAE, 0xA8, 0x09, 0x98, 0x80, 0x08, 0x01, 0xBA, 0xAF, 0x21,
+  0x83, 0x7A, 0x28, 0x86, 0x33, 0x08, 0x89, 0x1A, 0x63, 0x92, 0xFB, 0x88, 0x8A, 0xB9, 0x21, 0x89,
+  0x90, 0xAC, 0xCA, 0x11, 0x48, 0x9D, 0x03, 0x37, 0x03, 0x32, 0x8A, 0xE9, 0x52, 0x22, 0xA9, 0xAE,
+  0x89, 0x90, 0x08, 0x00, 0xA9, 0x8C, 0xFB, 0x32, 0x8B, 0xA4, 0x0E, 0x83, 0x54, 0x08, 0x02, 0xC9,
+  0x39, 0x32, 0x83, 0xCC, 0xCA, 0x29, 0x80, 0x81, 0x8A, 0xC8, 0x99, 0x88, 0x48, 0x89, 0xF1, 0x0D,
+  0x25, 0x40, 0xA1, 0x02, 0xD9, 0x58, 0x01, 0x82, 0xDB, 0x89, 0x29, 0x92, 0x08, 0xD9, 0x00, 0x1B,
+  0xB0, 0x23, 0xDC, 0x01, 0xE0, 0xE0, 0x3F, 0x00, 0x9D, 0x63, 0x12, 0x01, 0x11, 0xA9, 0x1E, 0x06,
+  0x01, 0xC8, 0x8B, 0x08, 0x11, 0xAA, 0x10, 0x9A, 0x99, 0x9B, 0x22, 0x32, 0xFF, 0xA2, 0x3D, 0x15,
+  0x28, 0x82, 0x92, 0xBA, 0x50, 0x42, 0xA0, 0xEB, 0x89, 0x00, 0x08, 0x99, 0x80, 0xA8, 0xB8, 0x4B,
+  0x10, 0xA0, 0xAF, 0xD4, 0x7C, 0x82, 0x10, 0x80, 0x11, 0xAB, 0x14, 0x38, 0xC2, 0x9D, 0x9A, 0x02,
+  0x88, 0x88, 0x0A, 0xC0, 0x00, 0xB8, 0x70, 0x9B, 0xE3, 0x29, 0x0A, 0x47, 0x89, 0x04, 0x08, 0xB8,
+  0x40, 0x00, 0x02, 0xBE, 0x99, 0x10, 0x80, 0xB1, 0x8A, 0x01, 0x1B, 0x83, 0x1F, 0xC6, 0x18, 0xCA,
+  0x21, 0x69, 0x93, 0x39, 0x03, 0x98, 0x0B, 0x41, 0x06, 0xB9, 0xAD, 0x09, 0x03, 0xA8, 0xA9, 0x2A,
+  0x12, 0x99, 0xE1, 0x42, 0x9C, 0xC1, 0x3E, 0xC2, 0x45, 0xA9, 0x32, 0x89, 0x90, 0x29, 0x15, 0x90,
+  0xCB, 0xAC, 0x13, 0x08, 0xA8, 0x0D, 0x80, 0x21, 0x40, 0xFB, 0x3C, 0x00, 0x90, 0x2A, 0xA2, 0x8E,
+  0xF2, 0x79, 0x0A, 0x86, 0x09, 0x82, 0x08, 0x8A, 0x13, 0x22, 0xB9, 0xAE, 0x1B, 0x01, 0x80, 0xAA,
+  0x1A, 0x81, 0x29, 0xA0, 0x60, 0xF4, 0x10, 0xAD, 0x43, 0x1C, 0x97, 0x19, 0x82, 0x09, 0x99, 0x13,
+  0x03, 0xAA, 0xCD, 0x09, 0x82, 0x80, 0x0B, 0x88, 0x7A, 0xB0, 0x82, 0x20, 0x98, 0x31, 0xDF, 0x83,
+  0x38, 0x85, 0x6B, 0xA1, 0x88, 0x8A, 0x33, 0x01, 0xB9, 0xCE, 0x18, 0x18, 0x90, 0x2C, 0xA4, 0x48,
+  0xC1, 0x38, 0x0A, 0x84, 0x98, 0x9A, 0x3A, 0x69, 0xC3, 0x43, 0x98, 0x88, 0x8D, 0x12, 0x94, 0x99,
+  0xBA, 0x8E, 0x92, 0x50, 0xAA, 0x27, 0x09, 0xB2, 0x2D, 0x92, 0x31, 0x9A, 0xC0, 0x1B, 0xC1, 0x31,
+  0x30, 0xC2, 0x08, 0xF8, 0x49, 0xA2, 0x19, 0xD8, 0x9A, 0xA1, 0x70, 0x98, 0x72, 0x91, 0xA1, 0x1B,
+  0x20, 0x31, 0xB0, 0xAA, 0xAE, 0x01, 0x1A, 0x94, 0x38, 0xEA, 0x10, 0x9B, 0x36, 0xF2, 0x3A, 0x00,
+  0x16, 0x0B, 0xE1, 0x1B, 0xF2, 0x41, 0x98, 0x31, 0x00, 0xA0, 0x89, 0x32, 0x42, 0xB9, 0xDA, 0x99,
+  0x2A, 0x08, 0x98, 0xA8, 0xB8, 0x28, 0x69, 0x30, 0xE3, 0xEB, 0xA8, 0x31, 0x4F, 0xA1, 0x11, 0x84,
+  0x21, 0x0D, 0x21, 0x11, 0xB4, 0xBA, 0x89, 0x2C, 0x91, 0xA9, 0xE8, 0x39, 0x9A, 0x02, 0x60, 0xB2,
+  0xA9, 0xBD, 0x50, 0x0D, 0x86, 0x19, 0x03, 0x39, 0xC0, 0x30, 0x02, 0x17, 0x9C, 0x98, 0x09, 0x01,
+  0x99, 0xA8, 0x0E, 0xB2, 0x28, 0x01, 0x42, 0xAC, 0xC8, 0x0A, 0xA4, 0x7A, 0xC0, 0x24, 0x8A, 0x05,
+  0x1B, 0x02, 0x51, 0xC0, 0x09, 0xA9, 0x31, 0xB9, 0x98, 0xAE, 0x82, 0x29, 0x93, 0x48, 0xCA, 0xB0,
+  0x0B, 0x82, 0x79, 0xC1, 0x51, 0xA9, 0x33, 0x90, 0x72, 0x30, 0xA1, 0xAC, 0x98, 0x38, 0xA0, 0xBB,
+  0xEC, 0x00, 0x10, 0x02, 0x29, 0xC9, 0xE0, 0x19, 0x88, 0x40, 0xA8, 0x28, 0xF2, 0x42, 0x28, 0x43,
+  0x6B, 0x0F, 0x3D, 0x00, 0x30, 0xA7, 0x99, 0x99, 0x39, 0xA0, 0xB0, 0xBE, 0x01, 0x39, 0x03, 0x09,
+  0xE8, 0x90, 0x1C, 0x90, 0x48, 0xF1, 0x01, 0x98, 0x68, 0x00, 0x33, 0x12, 0x17, 0x9A, 0x99, 0x8A,
+  0xA3, 0x89, 0xFB, 0x3B, 0xA9, 0x25, 0x99, 0x11, 0x8F, 0x80, 0x89, 0x02, 0x8A, 0x92, 0x1B, 0x00,
+  0x35, 0x26, 0x53, 0x43, 0x98, 0xAA, 0xAA, 0x80, 0x89, 0xDC, 0xAB, 0xB8, 0x63, 0x88, 0x11, 0xBC,
+  0x91, 0x8C, 0x81, 0x39, 0xB0, 0x2B, 0x99, 0x27, 0x63, 0x33, 0x46, 0x81, 0x98, 0xAA, 0x08, 0xA9,
+  0xCB, 0xBE, 0x88, 0x19, 0x22, 0x09, 0xA1, 0x9B, 0xA9, 0x1C, 0xB3, 0x28, 0xEA, 0x31, 0x32, 0x35,
+  0x54, 0x54, 0x23, 0x11, 0x88, 0x99, 0xA8, 0xCC, 0xCD, 0xBB, 0x89, 0x28, 0x22, 0x30, 0x83, 0x18,
+  0xCA, 0xAA, 0xCD, 0xAB, 0x9A, 0x38, 0x27, 0x73, 0x33, 0x44, 0x22, 0x21, 0x91, 0x89, 0xEA, 0xCB,
+  0xDB, 0x9A, 0x99, 0x18, 0x56, 0xF2, 0x36, 0x00, 0x80, 0x21, 0x92, 0x19, 0xB1, 0x1C, 0xD0, 0x4A,
+  0x01, 0x73, 0x13, 0x44, 0x23, 0x43, 0x02, 0x90, 0xB9, 0xBD, 0xBD, 0xAD, 0xAA, 0x89, 0x80, 0x10,
+  0x11, 0x81, 0x88, 0xB9, 0xAB, 0xBA, 0x48, 0x36, 0x56, 0x23, 0x53, 0x23, 0x43, 0x02, 0x98, 0xEB,
+  0xAC, 0xCB, 0xBB, 0xBA, 0x09, 0x08, 0x30, 0x02, 0x31, 0xC8, 0x9A, 0xAD, 0x80, 0x49, 0x26, 0x64,
+  0x22, 0x32, 0x23, 0x34, 0x82, 0xAA, 0xEC, 0xBB, 0xBC, 0x9C, 0xA9, 0x09, 0x81, 0x30, 0x04, 0x28,
+  0xA0, 0x8A, 0xCB, 0x08, 0x21, 0x67, 0x33, 0x25, 0x23, 0x32, 0x14, 0x91, 0xAA, 0xDD, 0xCA, 0xAA,
+  0x9B, 0xAA, 0x99, 0x10, 0x31, 0x15, 0x10, 0xA1, 0x8B, 0xDA, 0x09, 0x10, 0x47, 0x44, 0x33, 0x33,
+  0x43, 0x12, 0x90, 0xDB, 0xDB, 0xCB, 0xBB, 0xBB, 0x9A, 0xAB, 0x18, 0x22, 0x35, 0x00, 0xA1, 0x9B,
+  0xAC, 0x00, 0x60, 0x46, 0x34, 0x25, 0x22, 0x32, 0xB1, 0x1C, 0x34, 0x00, 0x11, 0xA8, 0xBD, 0xBC,
+  0xBD, 0xAB, 0xBB, 0xAA, 0xAA, 0x38, 0x31, 0x35, 0x10, 0x02, 0xAA, 0x9A, 0x38, 0x56, 0x36, 0x44,
+  0x33, 0x32, 0x33, 0x01, 0xC9, 0xBD, 0xAD, 0xBC, 0xAA, 0xBB, 0x9A, 0x9A, 0x21, 0x32, 0x33, 0x01,
+  0x12, 0xB8, 0x3A, 0x17, 0x75, 0x34, 0x52, 0x13, 0x22, 0x03, 0x89, 0xEA, 0xBC, 0xCA, 0xAC, 0xA9,
+  0xAB, 0x98, 0x0A, 0x13, 0x31, 0x84, 0x28, 0x80, 0x99, 0x32, 0x62, 0x67, 0x12, 0x34, 0x21, 0x22,
+  0x80, 0xAA, 0xCE, 0xBB, 0xDB, 0xAA, 0xAA, 0x9A, 0x98, 0x10, 0x13, 0x32, 0x01, 0x28, 0xA1, 0x52,
+  0x54, 0x55, 0x43, 0x33, 0x24, 0x22, 0x01, 0xBA, 0xDC, 0xCB, 0xAC, 0xBB, 0xAA, 0xAB, 0x89, 0x28,
+  0x21, 0x33, 0x03, 0x43, 0x28, 0x73, 0x22, 0x47, 0x24, 0x33, 0x33, 0x33, 0x02, 0xB9, 0xCE, 0xBC,
+  0xDB, 0xBA, 0xBA, 0x9A, 0x9A, 0x08, 0x21, 0x21, 0x32, 0x20, 0x11, 0x53, 0x6E, 0xF6, 0x27, 0x00,
+  0x45, 0x45, 0x34, 0x43, 0x23, 0x23, 0x02, 0xC9, 0xCB, 0xBE, 0xBB, 0xBC, 0xAB, 0xBA, 0x8A, 0x99,
+  0x21, 0x02, 0x23, 0x33, 0x32, 0x56, 0x33, 0x57, 0x22, 0x33, 0x13, 0x24, 0x81, 0xA9, 0xCD, 0xCB,
+  0xCB, 0xBB, 0xAB, 0x9C, 0x99, 0x09, 0x21, 0x00, 0x24, 0x11, 0x34, 0x32, 0x47, 0x33, 0x35, 0x33,
+  0x33, 0x22, 0x80, 0xDA, 0xCD, 0xCA, 0xCB, 0xBA, 0xBA, 0x9A, 0x9A, 0x18, 0x00, 0x23, 0x32, 0x35,
+  0x41, 0x26, 0x43, 0x26, 0x31, 0x23, 0x32, 0x02, 0xA8, 0xEA, 0xAD, 0xCB, 0xBC, 0xBB, 0xAB, 0x9B,
+  0x9B, 0x19, 0x01, 0x23, 0x35, 0x42, 0x35, 0x43, 0x44, 0x33, 0x34, 0x21, 0x22, 0x90, 0xB9, 0xCF,
+  0xCA, 0xBB, 0xAC, 0xBB, 0x9A, 0xAA, 0x00, 0x08, 0x33, 0x42, 0x25, 0x42, 0x34, 0x35, 0x24, 0x33,
+  0x33, 0x32, 0x02, 0xC9, 0xEB, 0xBC, 0xCB, 0xAC, 0xBB, 0xBA, 0x9A, 0x99, 0x80, 0x22, 0x53, 0x43,
+  0x53, 0xF3, 0x2C, 0x00, 0x43, 0x44, 0x43, 0x43, 0x23, 0x33, 0x33, 0x02, 0xA8, 0xBE, 0xBC, 0xBE,
+  0xCA, 0xBA, 0xAB, 0xAA, 0x9A, 0x09, 0x28, 0x43, 0x33, 0x37, 0x43, 0x35, 0x33, 0x24, 0x22, 0x22,
+  0x80, 0xB8, 0xBE, 0xCC, 0xCB, 0xBB, 0xCB, 0xAB, 0xAA, 0x9A, 0x08, 0x31, 0x53, 0x53, 0x34, 0x34,
+  0x44, 0x22, 0x23, 0x12, 0x11, 0xA9, 0xEB, 0xCB, 0xBC, 0xCB, 0xBB, 0xAB, 0xBB, 0x8A, 0x80, 0x30,
+  0x25, 0x44, 0x34, 0x53, 0x33, 0x34, 0x22, 0x23, 0x80, 0x91, 0xCC, 0xBC, 0xCC, 0xBB, 0xBB, 0xAC,
+  0xAB, 0x9A, 0x80, 0x10, 0x34, 0x44, 0x34, 0x44, 0x43, 0x32, 0x23, 0x21, 0x81, 0xA0, 0xCC, 0xDC,
+  0xBA, 0xBC, 0xBA, 0xAC, 0xAA, 0x9A, 0x88, 0x11, 0x52, 0x43, 0x34, 0x44, 0x33, 0x24, 0x22, 0x21,
+  0x90, 0xAA, 0xDD, 0xBB, 0xCC, 0xAB, 0xAB, 0xAC, 0x99, 0x8A, 0x11, 0x31, 0x26, 0x53, 0x33, 0x35,
+  0x33, 0x33, 0x22, 0x11, 0xCB, 0x0C, 0x28, 0x00, 0x9A, 0xFB, 0xCB, 0xAC, 0xBC, 0xAB, 0xCA, 0x99,
+  0xA9, 0x28, 0x21, 0x63, 0x53, 0x33, 0x44, 0x33, 0x42, 0x12, 0x11, 0x98, 0xBA, 0xDC, 0xCB, 0xBB,
+  0xBC, 0xAA, 0xAB, 0x9A, 0x08, 0x41, 0x43, 0x44, 0x34, 0x43, 0x43, 0x22, 0x12, 0x11, 0xA8, 0xDA,
+  0xCB, 0xBC, 0xCB, 0xBB, 0xAC, 0xA9, 0x9A, 0x80, 0x30, 0x52, 0x43, 0x34, 0x43, 0x34, 0x33, 0x22,
+  0x02, 0x90, 0xDB, 0xDB, 0xCB, 0xBC, 0xBB, 0xBA, 0xAA, 0x9A, 0x8B, 0x42, 0x52, 0x23, 0x45, 0x23,
+  0x34, 0x33, 0x33, 0x81, 0x80, 0xE9, 0xBA, 0xDB, 0xAC, 0xBB, 0x9C, 0xA9, 0x80, 0x80, 0x90, 0x63,
+  0x52, 0x32, 0x24, 0x33, 0x24, 0x22, 0x04, 0x08, 0xCA, 0xBA, 0xEA, 0xBB, 0xDB, 0x9A, 0x9B, 0xAB,
+  0x00, 0x18, 0x07, 0x41, 0x22, 0x23, 0x43, 0x33, 0x39, 0x87, 0x9B, 0xA0, 0xBC, 0xBB, 0xBD, 0x9C,
+  0xAB, 0xBB, 0x81, 0xAE, 0x41, 0x81, 0x28, 0x86, 0xB5, 0xFC, 0x24, 0x00, 0x30, 0x92, 0x51, 0x81,
+  0x08, 0x08, 0x18, 0xCE, 0xA1, 0x0C, 0xBB, 0xA0, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x59, 0x05, 0x38,
+  0x84, 0x43, 0x88, 0x53, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x78, 0x86, 0x30, 0x83, 0x18, 0x17, 0x88, 0x80, 0x80, 0x71, 0xC0, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x10, 0x7F, 0xB7, 0x09, 0x08, 0x80, 0x08, 0xF1,
+  0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x7B,
+  0xFF, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x80, 0x90, 0x70, 0x07, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // eleven
+  0x09, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x98, 0x21, 0x0F, 0x08, 0x08, 0x81, 0x09, 0x08, 0x39, 0xB4,
+  0xA6, 0x4C, 0xC1, 0x12, 0xA8, 0x85, 0x19, 0x08, 0x99, 0x81, 0x80, 0x80, 0x78, 0x28, 0xD8, 0x11,
+  0x2F, 0xF3, 0x20, 0x0B, 0xC3, 0x22, 0xBB, 0x00, 0x80, 0x18, 0x49, 0xAA, 0x80, 0x71, 0xAA, 0xA5,
+  0x48, 0x1A, 0xD0, 0x41, 0x0A, 0x93, 0xE1, 0x12, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x9B,
+  0x85, 0xF0, 0x40, 0xCA, 0xA1, 0xE3, 0x93, 0x68, 0x88, 0xA0, 0x59, 0xD8, 0x40, 0x8B, 0x97, 0x69,
+  0xA9, 0x21, 0x9F, 0xF7, 0x71, 0x8B, 0x02, 0xAA, 0x13, 0x2D, 0xB3, 0x39, 0xA8, 0x4A, 0xE1, 0x21,
+  0x8A, 0x81, 0x88, 0x81, 0x18, 0x08, 0x00, 0x08, 0x13, 0x1B, 0xF7, 0x58, 0x8C, 0x01, 0x90, 0x10,
+  0x9A, 0x50, 0xBC, 0x04, 0x1B, 0xD2, 0x84, 0x3F, 0xB2, 0x32, 0x88, 0x1B, 0xDC, 0x85, 0x38, 0x88,
+  0xAA, 0xBA, 0x29, 0x28, 0xE9, 0xF1, 0x38, 0x00, 0xA7, 0x08, 0xCB, 0x49, 0x33, 0x35, 0x81, 0xB0,
+  0xAF, 0x11, 0x30, 0x85, 0x9A, 0xCB, 0x99, 0x31, 0x82, 0x90, 0xAF, 0xAA, 0x82, 0x78, 0x13, 0x02,
+  0x02, 0x3B, 0xAE, 0x03, 0x51, 0x01, 0xAC, 0xDA, 0x08, 0x28, 0x22, 0xC8, 0x9A, 0xCE, 0x20, 0x90,
+  0x45, 0x18, 0x01, 0x98, 0xB3, 0x4C, 0x00, 0x33, 0xD8, 0xB9, 0x8D, 0x80, 0x21, 0x83, 0x9A, 0xBF,
+  0xB9, 0x28, 0x03, 0x73, 0x83, 0x30, 0x91, 0x00, 0x9C, 0x25, 0x38, 0xC2, 0xAD, 0xAA, 0x09, 0x13,
+  0x32, 0xAD, 0xCC, 0xDB, 0x20, 0x48, 0x22, 0x04, 0x08, 0x33, 0x8B, 0xA1, 0x58, 0x13, 0x80, 0xFD,
+  0x9A, 0x99, 0x32, 0x11, 0x90, 0xBF, 0xD9, 0x19, 0x10, 0x24, 0x22, 0x00, 0x41, 0x92, 0x88, 0x09,
+  0x53, 0x92, 0xE9, 0xAD, 0x8A, 0x18, 0x14, 0x81, 0xDA, 0xBB, 0x8F, 0xA2, 0x61, 0x01, 0x02, 0x08,
+  0x24, 0x8A, 0x90, 0x28, 0x13, 0x98, 0xCE, 0xBA, 0x87, 0xF6, 0x3D, 0x00, 0x09, 0x30, 0x32, 0xD1,
+  0xCB, 0xEC, 0x29, 0x09, 0x15, 0x21, 0x82, 0x70, 0x91, 0x08, 0x8A, 0x22, 0x00, 0xC8, 0x9C, 0xAC,
+  0x00, 0x20, 0x03, 0x8B, 0xDE, 0xAA, 0x98, 0x51, 0x11, 0x16, 0x10, 0x24, 0x89, 0x98, 0x0A, 0x11,
+  0x00, 0xDB, 0xB9, 0x8D, 0x98, 0x10, 0x88, 0xB0, 0xAE, 0x9B, 0xA9, 0x04, 0x78, 0x23, 0x43, 0x26,
+  0x80, 0x88, 0x9A, 0x80, 0x9B, 0xC8, 0x9A, 0x98, 0x8A, 0xA2, 0x9C, 0xC0, 0x8F, 0xB9, 0x0A, 0xA0,
+  0x40, 0x34, 0x63, 0x44, 0x22, 0x21, 0x08, 0x01, 0xBA, 0xDB, 0xBC, 0xAB, 0xBB, 0xA9, 0xA9, 0x08,
+  0xBB, 0xAD, 0xE8, 0x08, 0x30, 0x73, 0x43, 0x36, 0x32, 0x32, 0x01, 0x81, 0xC9, 0xAD, 0xBC, 0xBB,
+  0xAA, 0x09, 0x08, 0x89, 0xD0, 0x9A, 0x99, 0x8D, 0x11, 0x52, 0x54, 0x54, 0x23, 0x22, 0x02, 0x80,
+  0xB9, 0xBE, 0xCB, 0xBB, 0xA9, 0x89, 0x01, 0x09, 0xB0, 0x9E, 0xB8, 0x9B, 0xF5, 0xE5, 0x2F, 0x00,
+  0x11, 0x70, 0x44, 0x36, 0x33, 0x23, 0x02, 0x90, 0xEB, 0xCB, 0xBB, 0xAB, 0xA9, 0x00, 0x02, 0x08,
+  0xB9, 0xCE, 0xBA, 0xAB, 0x29, 0x62, 0x64, 0x44, 0x22, 0x12, 0x01, 0x98, 0xCA, 0xBC, 0xAC, 0x9A,
+  0x88, 0x01, 0x10, 0xA8, 0xAA, 0xBF, 0xBB, 0xCA, 0x10, 0x41, 0x65, 0x34, 0x33, 0x12, 0x00, 0xA8,
+  0xDB, 0xBC, 0xAB, 0xAA, 0x10, 0x11, 0x21, 0xAA, 0xDB, 0xBE, 0xAA, 0x9B, 0x19, 0x53, 0x54, 0x36,
+  0x33, 0x22, 0x00, 0x98, 0xCB, 0xCC, 0xBB, 0xA9, 0x19, 0x22, 0x41, 0x81, 0xAA, 0xFB, 0xAC, 0x9A,
+  0x9A, 0x11, 0x25, 0x65, 0x33, 0x22, 0x02, 0x90, 0xB9, 0xCC, 0xCB, 0xAA, 0x89, 0x40, 0x11, 0x23,
+  0xB8, 0xDA, 0xBD, 0xAB, 0x8D, 0x99, 0x21, 0x25, 0x65, 0x22, 0x21, 0x81, 0x08, 0xAA, 0x9D, 0xBB,
+  0x9A, 0x88, 0x40, 0x20, 0x80, 0xE8, 0xBA, 0xAE, 0xAA, 0x99, 0x0A, 0x43, 0x63, 0x37, 0x12, 0x12,
+  0x06, 0x22, 0x3D, 0x00, 0x80, 0x90, 0xBA, 0xCB, 0xAC, 0x99, 0x89, 0x13, 0x08, 0x91, 0xCD, 0xCA,
+  0xBC, 0x99, 0xB9, 0x39, 0x63, 0x73, 0x26, 0x11, 0x02, 0x08, 0x88, 0xBB, 0xBB, 0xAC, 0x98, 0x19,
+  0x11, 0x00, 0xA0, 0xBF, 0xCB, 0xBB, 0xB9, 0xCA, 0x38, 0x36, 0x75, 0x23, 0x21, 0x02, 0x88, 0xA0,
+  0xAD, 0xB9, 0x9B, 0x88, 0x19, 0x13, 0x88, 0xC0, 0xCE, 0xAB, 0xCB, 0x99, 0xD9, 0x30, 0x14, 0x75,
+  0x13, 0x21, 0x82, 0x08, 0xB8, 0xBB, 0xCA, 0xAB, 0x80, 0x19, 0x12, 0x09, 0xE9, 0xBD, 0xBA, 0xBB,
+  0xAC, 0xDB, 0x40, 0x32, 0x77, 0x11, 0x20, 0x01, 0x00, 0xA9, 0x9A, 0xCB, 0x8A, 0xA9, 0x10, 0x90,
+  0x00, 0xD9, 0xAD, 0xC9, 0xAB, 0xB8, 0x9E, 0x32, 0x50, 0x47, 0x01, 0x23, 0x80, 0x00, 0xC9, 0x99,
+  0xBA, 0x8A, 0xAA, 0x38, 0xA8, 0x28, 0xFA, 0x8E, 0xB8, 0x8A, 0xCA, 0x0A, 0x33, 0x73, 0x37, 0x01,
+  0x22, 0x80, 0x01, 0xCA, 0xF8, 0x12, 0x39, 0x00, 0x98, 0xCB, 0x88, 0xAB, 0x22, 0x9A, 0x13, 0xCE,
+  0x00, 0xDC, 0x89, 0xEA, 0x10, 0x81, 0x53, 0x13, 0x32, 0x43, 0x33, 0x98, 0x88, 0xCC, 0x8A, 0xDB,
+  0x89, 0x98, 0x18, 0x84, 0x09, 0x99, 0xDE, 0xAB, 0xBA, 0x49, 0x92, 0x78, 0x83, 0x51, 0x14, 0x33,
+  0xA2, 0x18, 0xE9, 0x8A, 0xD9, 0x1A, 0x88, 0x19, 0xB3, 0x49, 0xA8, 0x9D, 0xDB, 0x19, 0x88, 0x83,
+  0x5B, 0xD8, 0x71, 0x04, 0x51, 0x91, 0x8A, 0xC0, 0x19, 0xA0, 0x39, 0xE1, 0x21, 0xCA, 0x49, 0xC9,
+  0x12, 0x89, 0x18, 0xDB, 0x82, 0x1B, 0xE2, 0x78, 0x82, 0x61, 0xA1, 0x89, 0xB9, 0x48, 0x81, 0x31,
+  0xFA, 0x80, 0xBA, 0x40, 0x88, 0x14, 0x99, 0xB9, 0xAB, 0x12, 0x51, 0xC3, 0x3A, 0xA4, 0x70, 0x84,
+  0x89, 0xA9, 0x39, 0x03, 0x20, 0xFA, 0x9A, 0x8A, 0x39, 0x04, 0x81, 0x89, 0xCE, 0x02, 0x3B, 0x84,
+  0x18, 0xC1, 0x6A, 0x12, 0x33, 0xE1, 0x8A, 0x99, 0x28, 0x00, 0x41, 0x00, 0x43, 0x91, 0x99, 0xCD,
+  0x89, 0x88, 0x33, 0x00, 0x98, 0xF8, 0x5A, 0x99, 0x52, 0xA2, 0x11, 0xAD, 0x42, 0x92, 0x32, 0xEC,
+  0x18, 0x89, 0x23, 0xC8, 0x89, 0xBC, 0x01, 0x6B, 0x92, 0x81, 0x80, 0x1C, 0x88, 0x31, 0x47, 0x88,
+  0xAB, 0x89, 0x23, 0x42, 0xB8, 0xBB, 0xAB, 0x31, 0x82, 0xA9, 0xCF, 0x4A, 0xDD, 0x25, 0x8A, 0x52,
+  0xA9, 0x91, 0x8A, 0x54, 0x80, 0xA1, 0x9C, 0x01, 0x29, 0x03, 0x8B, 0xD8, 0x0A, 0x80, 0x19, 0xA1,
+  0x3C, 0xC7, 0x4B, 0xB3, 0x69, 0x84, 0x8A, 0xB0, 0x49, 0x03, 0x10, 0xDA, 0x1A, 0x98, 0x41, 0x90,
+  0x90, 0xBA, 0x9A, 0x0B, 0xB2, 0x37, 0x19, 0x99, 0x99, 0x02, 0x77, 0x85, 0xAA, 0xA8, 0x31, 0x13,
+  0xA8, 0xBC, 0x89, 0x10, 0x23, 0xA9, 0xB1, 0xDF, 0x90, 0x2B, 0x33, 0x83, 0x11, 0xB8, 0xAF, 0x46,
+  0x14, 0x90, 0xAD, 0x09, 0x22, 0x12, 0xAA, 0xBC, 0x09, 0x21, 0x22, 0xB9, 0x58, 0xFE, 0x39, 0x00,
+  0xB0, 0xFF, 0x82, 0x1C, 0x15, 0x8A, 0x04, 0x9B, 0x10, 0x50, 0x06, 0xA9, 0xA9, 0x1B, 0x14, 0x10,
+  0xB0, 0x9D, 0x00, 0x28, 0x84, 0x0B, 0xC0, 0x8E, 0xA3, 0x5A, 0x84, 0x1A, 0x95, 0x9A, 0x01, 0x68,
+  0x83, 0x8A, 0xDA, 0x2A, 0x03, 0x20, 0xD1, 0x8B, 0x90, 0x48, 0x93, 0x1A, 0xF8, 0x2B, 0xC1, 0x50,
+  0xA3, 0x5A, 0xA2, 0x8B, 0x92, 0x70, 0x83, 0x9A, 0xE9, 0x19, 0x12, 0x20, 0xC0, 0x0B, 0xA8, 0x40,
+  0x93, 0x29, 0xFA, 0x2B, 0xC0, 0x62, 0xA1, 0x58, 0xA0, 0x1A, 0x90, 0x71, 0x81, 0x99, 0xD9, 0x18,
+  0x01, 0x31, 0xC8, 0x8A, 0xA9, 0x60, 0x81, 0x18, 0xFA, 0x18, 0x99, 0x62, 0xA0, 0x41, 0xB8, 0x2A,
+  0x90, 0x63, 0x92, 0x8A, 0xCC, 0x18, 0x01, 0x23, 0xC8, 0x99, 0xBA, 0x51, 0x82, 0x20, 0xDD, 0x88,
+  0x09, 0x73, 0x88, 0x22, 0xD8, 0x19, 0x08, 0x53, 0xA2, 0x99, 0xBC, 0x1A, 0x12, 0x33, 0xB0, 0x9C,
+  0x27, 0xFA, 0x3F, 0x00, 0xBB, 0x40, 0x13, 0x38, 0xFC, 0xB9, 0x08, 0x63, 0x10, 0x43, 0xC8, 0x0A,
+  0x80, 0x62, 0x83, 0xA9, 0xCA, 0xAB, 0x22, 0x20, 0x12, 0xC8, 0x0B, 0xB9, 0x2A, 0x16, 0xAA, 0xA2,
+  0xBF, 0x32, 0x8A, 0x67, 0x91, 0x19, 0x98, 0x28, 0x13, 0x8A, 0xA1, 0xCC, 0x88, 0x99, 0x10, 0x01,
+  0x08, 0x91, 0xBB, 0x39, 0xC4, 0x4B, 0xD0, 0x9C, 0x82, 0x1D, 0x37, 0x90, 0x20, 0x82, 0x19, 0x02,
+  0x8A, 0x01, 0xBC, 0xA9, 0xCD, 0x89, 0x88, 0x11, 0x81, 0x88, 0x02, 0x89, 0x9A, 0x97, 0xBD, 0x89,
+  0xEC, 0x29, 0x24, 0x18, 0x43, 0x82, 0x31, 0x14, 0x28, 0x84, 0xAB, 0x98, 0xCD, 0x8A, 0xBA, 0x99,
+  0x88, 0x88, 0x40, 0xA2, 0x40, 0xA1, 0x9F, 0x98, 0xAE, 0x38, 0xB2, 0x29, 0x26, 0x11, 0x45, 0x01,
+  0x32, 0x82, 0x28, 0x91, 0xBC, 0xBA, 0xBD, 0xAA, 0xA9, 0x99, 0x31, 0x18, 0x02, 0xA3, 0x8F, 0x99,
+  0xDF, 0x08, 0xA9, 0x0B, 0x6E, 0xF7, 0x28, 0x00, 0x23, 0x42, 0x45, 0x32, 0x43, 0x24, 0x21, 0x22,
+  0xA9, 0xBA, 0xDA, 0xBC, 0xA9, 0xCB, 0x88, 0x89, 0x0B, 0x91, 0xBE, 0x18, 0xED, 0x89, 0xA8, 0x8C,
+  0x20, 0x11, 0x63, 0x43, 0x43, 0x33, 0x22, 0x32, 0x80, 0x99, 0xC9, 0xBE, 0xBA, 0xBC, 0xAA, 0x9B,
+  0xBB, 0x09, 0xDA, 0x08, 0xED, 0x09, 0x99, 0x9B, 0x18, 0x21, 0x64, 0x34, 0x33, 0x34, 0x43, 0x22,
+  0x12, 0x88, 0xA0, 0xAC, 0xCD, 0xAA, 0xBB, 0xAA, 0x9D, 0x08, 0xBB, 0x18, 0xCC, 0x8B, 0xA9, 0xBB,
+  0x88, 0x45, 0x60, 0x24, 0x32, 0x26, 0x32, 0x23, 0x12, 0x01, 0x11, 0xB0, 0x9C, 0xEC, 0x89, 0x99,
+  0x9C, 0x1A, 0xE9, 0x08, 0xBA, 0xAC, 0x99, 0xCA, 0x0B, 0x08, 0x38, 0x36, 0x15, 0x63, 0x32, 0x42,
+  0x12, 0x31, 0x81, 0x21, 0xAC, 0x0C, 0xCC, 0xC4, 0x9A, 0x89, 0x8E, 0x91, 0x90, 0x1B, 0xFA, 0x8A,
+  0x0A, 0x11, 0x0C, 0x85, 0x29, 0x43, 0x21, 0x37, 0x47, 0x04, 0x30, 0x00, 0x20, 0x98, 0x04, 0x18,
+  0x90, 0x99, 0xEA, 0x10, 0x9D, 0x09, 0xB8, 0x09, 0xDA, 0xCB, 0xC8, 0x2A, 0x1B, 0xB2, 0x91, 0x72,
+  0x34, 0x12, 0x27, 0x18, 0x31, 0x80, 0x13, 0x1A, 0xD9, 0xA8, 0x0C, 0x89, 0xB8, 0x99, 0xAA, 0xDF,
+  0xC8, 0x9D, 0x08, 0xA0, 0x18, 0x10, 0x30, 0x67, 0x01, 0x21, 0x81, 0x01, 0x32, 0x8A, 0x88, 0xC8,
+  0x8C, 0xA9, 0x88, 0x01, 0xC2, 0xFF, 0x99, 0xCD, 0x08, 0x00, 0x89, 0x12, 0x10, 0x64, 0x02, 0x21,
+  0x82, 0x08, 0x21, 0x91, 0x1A, 0xB9, 0xFB, 0x21, 0x3A, 0xA8, 0x17, 0xAE, 0x9C, 0xFB, 0x8C, 0x11,
+  0x88, 0x12, 0x18, 0x52, 0x13, 0x21, 0x12, 0x80, 0x10, 0x80, 0x89, 0x08, 0xBA, 0x3A, 0x79, 0xB7,
+  0x54, 0xE9, 0x9B, 0xF8, 0x8B, 0x21, 0x88, 0x22, 0x90, 0x68, 0x02, 0x21, 0x13, 0x0A, 0x02, 0xB8,
+  0x88, 0x09, 0x84, 0x08, 0x71, 0xD1, 0x63, 0xD9, 0x8B, 0xF9, 0x8C, 0x11, 0xBD, 0xE8, 0x41, 0x00,
+  0x18, 0x12, 0x99, 0x21, 0x02, 0x53, 0x01, 0x10, 0x90, 0x09, 0xE0, 0x09, 0x02, 0x39, 0x85, 0x81,
+  0x7A, 0xC8, 0xBC, 0xD8, 0x9E, 0x20, 0x01, 0x12, 0xA8, 0x18, 0x03, 0x53, 0x12, 0x08, 0x91, 0xA9,
+  0x09, 0x9C, 0x51, 0x01, 0x22, 0x41, 0x8F, 0x95, 0xCC, 0x89, 0xBE, 0x10, 0x02, 0x41, 0xA8, 0x08,
+  0x12, 0x51, 0x12, 0x80, 0x82, 0x8C, 0x08, 0xBA, 0x53, 0x80, 0x42, 0x89, 0xC2, 0x43, 0xCE, 0x9B,
+  0xFB, 0x1B, 0x21, 0x31, 0x92, 0x89, 0x30, 0x52, 0x14, 0x82, 0x00, 0x8A, 0x9A, 0xB8, 0x18, 0x44,
+  0x29, 0xA4, 0x39, 0x99, 0xA5, 0xFF, 0x9A, 0xBC, 0x30, 0x12, 0x42, 0xA0, 0x19, 0x04, 0x42, 0x13,
+  0x88, 0xA1, 0xAB, 0x90, 0x9C, 0x14, 0x00, 0x23, 0x1B, 0xE5, 0x11, 0xFC, 0x8B, 0xFA, 0x09, 0x22,
+  0x30, 0x91, 0x99, 0x22, 0x41, 0x24, 0x81, 0x90, 0xA9, 0x8A, 0xAB, 0x00, 0x22, 0x38, 0x85, 0x69,
+  0x76, 0x0B, 0x31, 0x00, 0xA9, 0xE3, 0xCF, 0x89, 0xBD, 0x31, 0x11, 0x42, 0xA8, 0x19, 0x13, 0x63,
+  0x11, 0x80, 0x98, 0xA9, 0x88, 0x0A, 0x00, 0xC3, 0x31, 0x3A, 0xA5, 0x49, 0xFE, 0x9B, 0xF9, 0x1A,
+  0x12, 0x30, 0x82, 0x8A, 0x22, 0x31, 0x27, 0x80, 0x18, 0x9A, 0x00, 0xB0, 0x49, 0xA0, 0x28, 0xB2,
+  0x60, 0xA9, 0xC0, 0xDF, 0x98, 0xBD, 0x20, 0x01, 0x43, 0x98, 0x38, 0x13, 0x34, 0x04, 0x89, 0x01,
+  0x99, 0x12, 0xBB, 0x01, 0xDB, 0x22, 0x20, 0x90, 0xDC, 0xDD, 0x9B, 0xEB, 0xAB, 0x80, 0x38, 0x24,
+  0x20, 0x35, 0x42, 0x23, 0x01, 0x10, 0x90, 0x8A, 0xB8, 0x9B, 0xB0, 0x8A, 0x31, 0x06, 0x20, 0xFC,
+  0xBD, 0xDD, 0xBB, 0xBA, 0x89, 0x10, 0x32, 0x47, 0x23, 0x34, 0x12, 0x21, 0x80, 0x08, 0xBA, 0x99,
+  0xCB, 0x8A, 0x89, 0xA8, 0xB9, 0xFF, 0xC9, 0xBC, 0xBB, 0xAB, 0x00, 0x21, 0x64, 0x44, 0x33, 0x13,
+  0x12, 0x02, 0x88, 0x99, 0x5C, 0x10, 0x2E, 0x00, 0xCB, 0xA9, 0xBB, 0x89, 0x88, 0x89, 0xF8, 0xAE,
+  0xEB, 0xBB, 0xBB, 0x8A, 0x11, 0x51, 0x45, 0x34, 0x33, 0x22, 0x12, 0x81, 0xA8, 0xB9, 0x9D, 0xB9,
+  0x9A, 0x98, 0x20, 0x88, 0xED, 0xCB, 0xCD, 0xAB, 0xAB, 0x88, 0x01, 0x73, 0x34, 0x34, 0x23, 0x22,
+  0x02, 0x88, 0xB8, 0xBA, 0xAB, 0xAC, 0x9A, 0x80, 0x80, 0xB0, 0xFF, 0xCB, 0xBD, 0xAA, 0x9B, 0x08,
+  0x20, 0x55, 0x43, 0x34, 0x12, 0x12, 0x01, 0x88, 0x99, 0xAB, 0xBA, 0xAC, 0xA9, 0x18, 0xAB, 0xFC,
+  0xBC, 0xBE, 0xBB, 0xAB, 0x89, 0x11, 0x72, 0x44, 0x33, 0x24, 0x12, 0x12, 0x80, 0x98, 0xAA, 0xA9,
+  0xCB, 0x99, 0x8A, 0xBA, 0xE9, 0xBF, 0xDA, 0xAC, 0xAA, 0x8A, 0x11, 0x31, 0x46, 0x34, 0x24, 0x22,
+  0x11, 0x01, 0x09, 0xA9, 0xA9, 0xB9, 0xBA, 0x9A, 0xBA, 0xCC, 0xCF, 0xDB, 0xCB, 0xAA, 0x8A, 0x10,
+  0x41, 0x44, 0x44, 0x23, 0x23, 0x11, 0x02, 0x90, 0xC7, 0x14, 0x2F, 0x00, 0xA8, 0x9A, 0xCA, 0xBA,
+  0xCA, 0xAA, 0xBC, 0xDE, 0xCA, 0xBB, 0x9C, 0x99, 0x11, 0x33, 0x55, 0x34, 0x33, 0x14, 0x02, 0x01,
+  0x90, 0xA9, 0xB9, 0x9C, 0xCA, 0xAA, 0xBB, 0xBD, 0xDC, 0xCB, 0xCB, 0x9A, 0x88, 0x31, 0x44, 0x43,
+  0x35, 0x33, 0x13, 0x11, 0x10, 0x99, 0xAB, 0xCB, 0xAB, 0xDB, 0xBB, 0xDA, 0xCB, 0xCC, 0xCB, 0xBA,
+  0x89, 0x18, 0x34, 0x35, 0x54, 0x33, 0x32, 0x12, 0x11, 0x80, 0xA9, 0xBB, 0xDB, 0xAB, 0xCC, 0xAA,
+  0xBC, 0xBC, 0xBD, 0xBB, 0x9B, 0x00, 0x63, 0x34, 0x44, 0x24, 0x33, 0x32, 0x10, 0x00, 0xB8, 0xBA,
+  0xBC, 0xAD, 0xCA, 0xAB, 0xCB, 0xCB, 0xBC, 0xBB, 0xAA, 0x21, 0x62, 0x35, 0x34, 0x44, 0x23, 0x12,
+  0x01, 0x08, 0xB8, 0xAB, 0xCD, 0xBA, 0xBA, 0xBC, 0xBB, 0xEB, 0x9C, 0xAA, 0x09, 0x22, 0x54, 0x53,
+  0x33, 0x34, 0x23, 0x12, 0x90, 0x98, 0xCA, 0xBC, 0xDB, 0xAB, 0xBA, 0xBC, 0x33, 0xF8, 0x2F, 0x00,
+  0xAB, 0xBD, 0x9B, 0x9A, 0x40, 0x34, 0x45, 0x43, 0x43, 0x32, 0x02, 0x01, 0x99, 0xAA, 0xCC, 0xBB,
+  0xBC, 0xBB, 0xAC, 0xCB, 0xAC, 0xAB, 0x99, 0x30, 0x36, 0x35, 0x25, 0x33, 0x34, 0x11, 0x01, 0xA9,
+  0xA9, 0xBD, 0xBB, 0xCC, 0xAA, 0xCB, 0xAA, 0xCB, 0xAA, 0x08, 0x30, 0x37, 0x44, 0x43, 0x32, 0x24,
+  0x11, 0x00, 0xA8, 0xBA, 0xDA, 0xCB, 0xCA, 0xAB, 0xBB, 0xBC, 0xBA, 0x9A, 0x00, 0x55, 0x43, 0x44,
+  0x32, 0x42, 0x22, 0x10, 0x90, 0xBA, 0xCA, 0xBC, 0xBB, 0xBD, 0xBB, 0xCC, 0xAA, 0xA9, 0x19, 0x32,
+  0x37, 0x63, 0x32, 0x33, 0x23, 0x12, 0x80, 0xB9, 0xDB, 0xBC, 0xAC, 0xBC, 0xBB, 0xDB, 0xAB, 0xA9,
+  0x09, 0x42, 0x63, 0x34, 0x43, 0x43, 0x22, 0x11, 0x81, 0x99, 0xCA, 0xCB, 0xCB, 0xCB, 0xAB, 0xDB,
+  0x9B, 0xA9, 0x29, 0x33, 0x73, 0x34, 0x43, 0x24, 0x12, 0x11, 0x80, 0x99, 0xCA, 0xBB, 0xCC, 0xCB,
+  0x0F, 0xFF, 0x2E, 0x00, 0xBA, 0xBC, 0xAA, 0x8A, 0x10, 0x53, 0x34, 0x35, 0x34, 0x32, 0x13, 0x21,
+  0x98, 0xB9, 0xCC, 0xDB, 0xBB, 0xCC, 0xAB, 0xBB, 0x9B, 0x88, 0x31, 0x36, 0x44, 0x43, 0x33, 0x23,
+  0x12, 0x10, 0xA9, 0xBD, 0xDB, 0xBC, 0xBA, 0xBD, 0xBA, 0x9A, 0x0A, 0x11, 0x44, 0x34, 0x35, 0x33,
+  0x24, 0x12, 0x01, 0x98, 0xCA, 0xBC, 0xDB, 0xBB, 0xDB, 0xAA, 0x9A, 0x09, 0x30, 0x63, 0x43, 0x34,
+  0x43, 0x32, 0x12, 0x01, 0xA0, 0xBB, 0xCC, 0xBC, 0xAC, 0xBC, 0xAA, 0x9A, 0x08, 0x33, 0x54, 0x53,
+  0x42, 0x23, 0x33, 0x11, 0x81, 0xA9, 0xBC, 0xBD, 0xAC, 0xAD, 0xAA, 0x9B, 0x08, 0x08, 0x53, 0x42,
+  0x44, 0x22, 0x23, 0x13, 0x28, 0xB8, 0xDB, 0xEB, 0xBB, 0xCB, 0xAB, 0xAB, 0x09, 0x18, 0x34, 0x36,
+  0x33, 0x25, 0x23, 0x22, 0x80, 0x90, 0xBC, 0xDC, 0xBB, 0xBC, 0xAC, 0xA9, 0x00, 0x28, 0x33, 0x46,
+  0x33, 0x33, 0x24, 0x10, 0x9E, 0x02, 0x1E, 0x00, 0x03, 0xCA, 0xB8, 0xCC, 0xCB, 0xBB, 0xAB, 0xBB,
+  0x08, 0x18, 0x17, 0x44, 0x32, 0x42, 0x12, 0x13, 0x88, 0x80, 0x80, 0xAE, 0xBB, 0xDB, 0x9B, 0xAC,
+  0x81, 0x08, 0x90, 0x72, 0x31, 0x03, 0x06, 0x32, 0x08, 0xB0, 0x0E, 0xC8, 0x99, 0x9C, 0x9B, 0xAC,
+  0x00, 0x08, 0x08, 0x08, 0x59, 0x07, 0x88, 0x80, 0x00, 0x88, 0x10, 0xED, 0xB0, 0x0B, 0xB0, 0x8E,
+  0x80, 0x80, 0x80, 0x71, 0x81, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x80, 0x91, 0xFF, 0x09, 0x08,
+  0x88, 0x72, 0x81, 0x00, 0x29, 0x07, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x78, 0x07,
+  0x80, 0x00, 0x88, 0x27, 0x08, 0x29, 0xA5, 0x12, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x79, 0xFF,
+  0x18, 0x0E, 0x08, 0x08, 0x80, 0x08, 0x08, 0x08, 0x01, 0x00, 0x0F, 0x00, 0x08, 0x08, 0x80, 0x80,
+  0x80, 0x90, 0x50, 0xFF, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x48, 0x87, 0x28, 0x88, 0x80, 0x80, 0x00,
+  0x88, 0x00, 0xFA, 0x7C, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80,
+  0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // twelve
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0x04, 0x99,
+  0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0xF9, 0x31, 0x8F, 0xA4, 0x0A, 0x0D, 0xB4, 0x19, 0x88, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x7A, 0xC5, 0x88, 0x72, 0x82, 0x00, 0x08, 0x88, 0x00, 0xDF,
+  0x80, 0x80, 0x80, 0x80, 0x78, 0x83, 0x80, 0x80, 0x80, 0x80, 0x90, 0x9F, 0x06, 0x8A, 0xB3, 0x8E,
+  0x80, 0x80, 0x00, 0x88, 0x90, 0x47, 0x0C, 0x87, 0x2B, 0xA1, 0x92, 0x4E, 0xB2, 0x00, 0xDB, 0x60,
+  0x09, 0x80, 0x44, 0xFF, 0x87, 0x6F, 0x99, 0x91, 0xA2, 0x00, 0x18, 0x18, 0x2D, 0x88, 0x91, 0xC3,
+  0xA2, 0x60, 0x8A, 0x98, 0x80, 0x30, 0xC0, 0x81, 0x80, 0x19, 0x97, 0x88, 0xA2, 0x3C, 0x3A, 0x3B,
+  0x8A, 0xD0, 0xB3, 0x85, 0x80, 0x28, 0x0C, 0x10, 0xB8, 0xA3, 0xD1, 0x13, 0x09, 0x5E, 0x89, 0x10,
+  0x09, 0x99, 0x12, 0xC1, 0x7F, 0xFD, 0x32, 0x00, 0x22, 0xD9, 0x10, 0xD2, 0x79, 0x99, 0x28, 0xC0,
+  0x40, 0xB0, 0x39, 0xE2, 0x38, 0xA1, 0x88, 0x00, 0xA9, 0xA3, 0x93, 0x5B, 0x92, 0xCA, 0x45, 0x0D,
+  0x10, 0x9A, 0x32, 0xC9, 0x01, 0xC2, 0x10, 0xA3, 0x2A, 0x39, 0x8F, 0x42, 0x19, 0x0B, 0xB7, 0x49,
+  0x99, 0xB3, 0x60, 0x0A, 0xA9, 0x41, 0x89, 0x10, 0xB0, 0x82, 0x1A, 0x70, 0xF0, 0x58, 0x98, 0x88,
+  0xA4, 0x2B, 0x10, 0xE1, 0x39, 0x08, 0xC8, 0x14, 0x8A, 0x3A, 0xD5, 0x3A, 0x82, 0xCA, 0x52, 0x98,
+  0x0B, 0x85, 0x0B, 0x18, 0x92, 0x3B, 0x81, 0x99, 0x01, 0x4C, 0xB8, 0xA3, 0x58, 0xCB, 0x24, 0xDA,
+  0x38, 0x93, 0xAC, 0x72, 0xC8, 0x29, 0x83, 0xBA, 0x53, 0xB9, 0x1B, 0x07, 0x9A, 0x28, 0xA3, 0x8C,
+  0x42, 0x98, 0xB9, 0x58, 0x80, 0x90, 0x49, 0xC2, 0x2C, 0xB3, 0x68, 0xB8, 0x38, 0x98, 0x11, 0xBC,
+  0x26, 0xC9, 0x40, 0x98, 0x89, 0x31, 0x28, 0xEB, 0xE4, 0xFC, 0x32, 0x00, 0x31, 0xB1, 0x2B, 0x86,
+  0x88, 0x1B, 0x03, 0x90, 0x89, 0x4A, 0x93, 0x90, 0x2C, 0xA5, 0x1C, 0x92, 0x22, 0xAB, 0x5A, 0xF2,
+  0x49, 0xA0, 0x10, 0x99, 0x01, 0x81, 0x5B, 0xF3, 0x29, 0x90, 0x11, 0xC0, 0x29, 0x82, 0xA8, 0x39,
+  0xC4, 0x1D, 0x02, 0x8A, 0x92, 0x89, 0x30, 0xBE, 0x15, 0x0E, 0x91, 0x18, 0xC0, 0x40, 0xBA, 0x12,
+  0xA8, 0x80, 0x80, 0x80, 0xC8, 0xA8, 0x18, 0x59, 0x8B, 0xD3, 0x09, 0x87, 0x3B, 0x80, 0x18, 0xB4,
+  0x2C, 0x38, 0xF0, 0x40, 0x10, 0x9E, 0x21, 0x80, 0x0A, 0x91, 0x5C, 0xB8, 0x41, 0x99, 0x80, 0x00,
+  0x35, 0xAC, 0x28, 0xA4, 0x8A, 0x61, 0xD9, 0x32, 0xBB, 0x40, 0xA2, 0x89, 0x42, 0xBA, 0x52, 0xA8,
+  0x00, 0x38, 0x91, 0x36, 0x9D, 0x03, 0x2B, 0x83, 0x80, 0x63, 0xFB, 0x30, 0xB1, 0x58, 0x92, 0x9C,
+  0x22, 0x99, 0x02, 0x08, 0xDC, 0x41, 0xA2, 0x1B, 0xB9, 0x77, 0xBB, 0x13, 0x0F, 0x02, 0x2A, 0x00,
+  0x89, 0x81, 0x1D, 0x83, 0x0B, 0x81, 0x01, 0xBD, 0x72, 0x8A, 0x00, 0x91, 0x09, 0xB9, 0x2A, 0x04,
+  0x2D, 0xA4, 0xBB, 0x68, 0xA1, 0x89, 0xB9, 0x51, 0xB8, 0x20, 0xAB, 0x84, 0x0C, 0x60, 0xE0, 0x29,
+  0x80, 0x80, 0x09, 0xA2, 0x2C, 0x83, 0x28, 0xB0, 0x00, 0xBF, 0x12, 0x22, 0xAD, 0x62, 0x91, 0x8C,
+  0x80, 0x33, 0x82, 0xAF, 0x51, 0x91, 0xAC, 0x32, 0x02, 0xBB, 0x99, 0x53, 0x03, 0xD9, 0x29, 0x53,
+  0xA2, 0x88, 0x8C, 0x52, 0xA1, 0x90, 0x40, 0xB2, 0x9B, 0x41, 0x81, 0xD8, 0x09, 0x14, 0x08, 0xE8,
+  0x2B, 0x17, 0x80, 0x0A, 0x22, 0x92, 0xCD, 0x29, 0x43, 0x99, 0xCB, 0x9A, 0x18, 0xB1, 0xF9, 0x0A,
+  0x03, 0xBD, 0x9B, 0x72, 0x45, 0x33, 0x24, 0x03, 0xB9, 0x9B, 0x11, 0xEB, 0xDE, 0xBB, 0xCC, 0xBB,
+  0x99, 0x10, 0x54, 0x44, 0x35, 0x24, 0x90, 0xBA, 0x8A, 0x20, 0x11, 0xA8, 0xDA, 0xCD, 0xBD, 0xBB,
+  0xD8, 0xDC, 0x3A, 0x00, 0x38, 0x11, 0x99, 0x72, 0x36, 0x23, 0x90, 0x9A, 0x89, 0x80, 0x28, 0x43,
+  0x14, 0xE8, 0xAC, 0xAA, 0xCA, 0x8B, 0x42, 0x83, 0xCE, 0x0A, 0x54, 0x23, 0x11, 0xA8, 0xAA, 0x8A,
+  0x21, 0x32, 0x12, 0x12, 0xEA, 0xBF, 0xA9, 0x99, 0x18, 0x13, 0xD8, 0xCF, 0x19, 0x34, 0x24, 0x12,
+  0xA8, 0xBC, 0x19, 0x42, 0x01, 0x08, 0x11, 0xD9, 0xBC, 0x09, 0xA9, 0x1A, 0x26, 0xD9, 0xBD, 0x19,
+  0x53, 0x23, 0x43, 0x92, 0xCE, 0x1A, 0x42, 0x82, 0x99, 0x08, 0xA0, 0xAB, 0x40, 0xA0, 0xAD, 0x51,
+  0xA1, 0xBD, 0x19, 0x10, 0x33, 0x36, 0x03, 0xE9, 0x9C, 0x31, 0x33, 0x80, 0xBB, 0x9B, 0x09, 0x33,
+  0x14, 0xDD, 0x8C, 0x21, 0xB0, 0x9C, 0x81, 0x0A, 0x55, 0x23, 0x11, 0xC9, 0x9E, 0x40, 0x24, 0xA8,
+  0xAA, 0x89, 0x08, 0x42, 0x83, 0xCE, 0x0A, 0x21, 0xA8, 0x0A, 0xB1, 0x9D, 0x64, 0x03, 0x00, 0x80,
+  0xCD, 0x38, 0x26, 0x98, 0x53, 0x26, 0x48, 0x00, 0xAA, 0x89, 0x18, 0x22, 0x13, 0xDE, 0x8A, 0x22,
+  0x90, 0x9B, 0xA1, 0x9D, 0x72, 0x04, 0x88, 0x01, 0xDA, 0x29, 0x35, 0xA1, 0xAB, 0x9A, 0x19, 0x43,
+  0x12, 0xEA, 0xAC, 0x30, 0x02, 0xA8, 0x9D, 0xA8, 0x40, 0x26, 0x90, 0x20, 0xA0, 0x9F, 0x43, 0x83,
+  0xAA, 0xB8, 0x8B, 0x52, 0x03, 0xA9, 0xCC, 0x8A, 0x53, 0x90, 0xBA, 0x8A, 0x98, 0x73, 0x06, 0x8A,
+  0x32, 0xD0, 0x0C, 0x25, 0x90, 0x89, 0xB8, 0x8A, 0x34, 0x91, 0xB9, 0xAB, 0x2A, 0x26, 0xB9, 0xB9,
+  0x0D, 0x00, 0x44, 0x02, 0x8A, 0x27, 0xD8, 0x1B, 0x25, 0x91, 0x8A, 0xC9, 0x1A, 0x24, 0x91, 0xA9,
+  0xBC, 0x38, 0x24, 0xAA, 0xAA, 0x9E, 0x13, 0x11, 0x32, 0x98, 0x47, 0xC0, 0x8D, 0x34, 0x91, 0x8A,
+  0xB9, 0x0B, 0x35, 0xA1, 0xAA, 0xBB, 0x38, 0x25, 0xC8, 0x8B, 0xCA, 0x42, 0x98, 0x40, 0x84, 0x50,
+  0x83, 0xBF, 0x50, 0x03, 0x9A, 0xA8, 0xAB, 0x62, 0xEC, 0x0A, 0x49, 0x00, 0x82, 0x99, 0xA9, 0x0C,
+  0x43, 0xA0, 0x9A, 0xB8, 0x1C, 0x86, 0x89, 0x53, 0x98, 0x53, 0xD8, 0x0B, 0x26, 0x90, 0x89, 0xBA,
+  0x28, 0x24, 0xA8, 0xA9, 0x9B, 0x50, 0x03, 0xBB, 0x9B, 0xA0, 0x7A, 0xC3, 0x2A, 0x34, 0x18, 0x07,
+  0xEB, 0x28, 0x15, 0x98, 0x99, 0xAB, 0x51, 0x02, 0x9A, 0xA8, 0x8B, 0x63, 0x91, 0x9B, 0x8A, 0x90,
+  0x61, 0xC0, 0x2A, 0x25, 0x19, 0x23, 0xDE, 0x38, 0x24, 0xA9, 0x99, 0xAB, 0x60, 0x02, 0xA9, 0xA8,
+  0x8A, 0x62, 0x91, 0x9B, 0x88, 0x89, 0x40, 0xF2, 0x1A, 0x34, 0x88, 0x33, 0xFB, 0x2C, 0x25, 0x98,
+  0x9A, 0x9A, 0x40, 0x03, 0xAA, 0x99, 0x9A, 0x71, 0x91, 0x9A, 0x89, 0x88, 0x20, 0xC2, 0x8F, 0x35,
+  0x80, 0x30, 0xF8, 0x1B, 0x35, 0xA0, 0x9A, 0xA9, 0x39, 0x16, 0xA9, 0x89, 0xA9, 0x41, 0x83, 0xCB,
+  0x08, 0x89, 0x10, 0x82, 0xBF, 0x44, 0x83, 0x20, 0xC1, 0x9F, 0x53, 0x81, 0x89, 0x33, 0x4B, 0x00,
+  0xA9, 0xA9, 0x09, 0x25, 0xA0, 0x8B, 0x98, 0x28, 0x15, 0xCA, 0x09, 0x88, 0x18, 0x01, 0xEC, 0x50,
+  0x13, 0x08, 0x83, 0xCE, 0x58, 0x13, 0xA9, 0xAA, 0x9A, 0x62, 0x82, 0xAB, 0x08, 0x89, 0x52, 0xB1,
+  0xAC, 0x01, 0x80, 0x18, 0xE0, 0x0B, 0x47, 0x80, 0x28, 0xC8, 0x0C, 0x54, 0x90, 0x9A, 0xA8, 0x18,
+  0x24, 0xB8, 0x8A, 0x98, 0x39, 0x15, 0xCA, 0x0A, 0x80, 0x90, 0x11, 0xCD, 0x61, 0x14, 0x09, 0x81,
+  0xBD, 0x60, 0x04, 0xA9, 0x99, 0x99, 0x41, 0x83, 0xCB, 0x08, 0x88, 0x40, 0xA2, 0xAC, 0x18, 0x80,
+  0x29, 0xE1, 0x2A, 0x37, 0x80, 0x01, 0xEA, 0x2A, 0x36, 0xA0, 0xAB, 0x99, 0x18, 0x25, 0xB8, 0x9B,
+  0x01, 0x19, 0x24, 0xE8, 0x8B, 0x11, 0xA0, 0x00, 0x9B, 0x72, 0x17, 0x00, 0xA8, 0xAC, 0x63, 0x03,
+  0xAB, 0x9B, 0x99, 0x43, 0x82, 0xBB, 0x89, 0x80, 0x41, 0xA2, 0xAF, 0x18, 0x91, 0x19, 0x99, 0x51,
+  0x13, 0xF4, 0x3B, 0x00, 0x26, 0x33, 0xC0, 0xAF, 0x41, 0x23, 0xB9, 0xBB, 0x8B, 0x40, 0x03, 0xB9,
+  0x8B, 0x80, 0x20, 0x92, 0xCF, 0x28, 0x03, 0xAB, 0xAA, 0x71, 0x35, 0x32, 0xA1, 0xDF, 0x38, 0x24,
+  0xB0, 0xBA, 0x9A, 0x18, 0x14, 0xA8, 0x9A, 0x88, 0x40, 0x02, 0xBC, 0x38, 0x14, 0xAA, 0xA8, 0x1A,
+  0x77, 0x12, 0x90, 0xCB, 0x1A, 0x46, 0x91, 0xBB, 0xAA, 0x99, 0x42, 0x91, 0x99, 0x08, 0x60, 0x83,
+  0xCC, 0x40, 0x14, 0xA9, 0x9A, 0x90, 0x40, 0x35, 0xB1, 0xBB, 0x89, 0x40, 0x35, 0xC0, 0xAE, 0x8A,
+  0x11, 0x00, 0x18, 0x00, 0x18, 0x36, 0xC0, 0x8E, 0x44, 0x81, 0xAB, 0x09, 0x80, 0x31, 0x15, 0xBA,
+  0x9B, 0x80, 0x32, 0x04, 0xDC, 0xAC, 0x09, 0x20, 0x00, 0x21, 0x22, 0x61, 0x92, 0xBE, 0x72, 0x13,
+  0xB9, 0x9B, 0x88, 0x20, 0x35, 0xB8, 0xAD, 0x08, 0x01, 0x12, 0xB8, 0xBF, 0x0B, 0x00, 0x00, 0x32,
+  0x33, 0x54, 0x83, 0xCE, 0x4E, 0xF4, 0x40, 0x00, 0x48, 0x26, 0xA8, 0xAA, 0x88, 0x08, 0x42, 0x92,
+  0xEB, 0x09, 0x01, 0x80, 0x01, 0xEA, 0xAB, 0x10, 0x80, 0x40, 0x33, 0x41, 0x24, 0xFA, 0x1A, 0x45,
+  0x92, 0xBB, 0x0A, 0x08, 0x20, 0x15, 0xC9, 0x9B, 0x21, 0xA1, 0x18, 0xB0, 0xDF, 0x09, 0x01, 0x00,
+  0x42, 0x22, 0x32, 0xD0, 0x9C, 0x54, 0x04, 0xBA, 0x9A, 0x80, 0x00, 0x42, 0xA1, 0xBD, 0x18, 0x13,
+  0x9A, 0x89, 0xDC, 0xAB, 0x28, 0x21, 0x23, 0x54, 0x26, 0xB0, 0x9D, 0x52, 0x23, 0xC9, 0x9B, 0x08,
+  0x80, 0x40, 0x02, 0xEB, 0x9A, 0x32, 0x90, 0x99, 0xC9, 0xCC, 0x09, 0x30, 0x32, 0x31, 0x47, 0x92,
+  0xAD, 0x48, 0x25, 0xA0, 0xAB, 0x09, 0x08, 0x19, 0x23, 0xD0, 0x9D, 0x28, 0x01, 0xA9, 0xA8, 0xDA,
+  0xAC, 0x28, 0x53, 0x02, 0x44, 0x13, 0xCC, 0x1A, 0x46, 0x81, 0xBA, 0x0A, 0x80, 0x88, 0x21, 0x92,
+  0xCC, 0x0A, 0x23, 0xA0, 0xDB, 0x9A, 0xDB, 0x0B, 0x73, 0xE2, 0x36, 0x00, 0x62, 0x23, 0x42, 0x14,
+  0xD9, 0x0B, 0x54, 0x03, 0xC9, 0x8B, 0x00, 0x88, 0x10, 0x11, 0xBA, 0xAB, 0x30, 0x92, 0xFB, 0x9B,
+  0xAA, 0xBE, 0x30, 0x45, 0x33, 0x23, 0xC8, 0x9D, 0x62, 0x14, 0xB8, 0xAB, 0x00, 0x91, 0x09, 0x21,
+  0xC0, 0xBB, 0x28, 0x02, 0xFC, 0x9A, 0x88, 0xAC, 0x19, 0x36, 0x25, 0x02, 0xB8, 0xAB, 0x73, 0x15,
+  0xA8, 0xAB, 0x08, 0x81, 0x89, 0x10, 0x81, 0xCC, 0x0A, 0x11, 0xD9, 0xBB, 0x9A, 0xAB, 0x4A, 0x47,
+  0x25, 0x01, 0xB9, 0x0A, 0x63, 0x14, 0xB8, 0xAB, 0x09, 0x08, 0x89, 0x10, 0x91, 0xEB, 0x8A, 0x10,
+  0xD8, 0xAD, 0x99, 0x88, 0x38, 0x47, 0x34, 0x02, 0xCA, 0x1A, 0x63, 0x12, 0xB9, 0xAB, 0x09, 0x90,
+  0x89, 0x10, 0x80, 0xCD, 0x8A, 0x01, 0xD9, 0xBC, 0x9B, 0x29, 0x54, 0x36, 0x24, 0xA1, 0xBB, 0x48,
+  0x35, 0x81, 0xCB, 0x9A, 0x80, 0xA8, 0x09, 0x21, 0xA0, 0xBE, 0x0A, 0x82, 0x76, 0xFA, 0x30, 0x00,
+  0xEA, 0xAC, 0x09, 0x30, 0x54, 0x44, 0x13, 0xA8, 0x9C, 0x40, 0x34, 0xB0, 0xBC, 0x89, 0x91, 0xA9,
+  0x19, 0x21, 0xB8, 0xAF, 0x89, 0x81, 0xDA, 0xCB, 0x19, 0x44, 0x34, 0x24, 0x02, 0xBA, 0x0B, 0x55,
+  0x12, 0xCA, 0xAB, 0x08, 0x90, 0xBA, 0x29, 0x13, 0xE9, 0xAC, 0x09, 0xA0, 0xEB, 0x8B, 0x71, 0x33,
+  0x33, 0x23, 0xA1, 0xAC, 0x48, 0x26, 0xA1, 0xBC, 0x8A, 0x01, 0xA9, 0x9C, 0x21, 0x81, 0xCD, 0x9A,
+  0x80, 0xC9, 0xAD, 0x40, 0x45, 0x22, 0x12, 0x80, 0x9A, 0x28, 0x45, 0x91, 0xCB, 0x9B, 0x00, 0xA0,
+  0xBB, 0x19, 0x12, 0xDC, 0xBC, 0x88, 0xB9, 0xAF, 0x38, 0x47, 0x22, 0x12, 0x88, 0x99, 0x20, 0x53,
+  0x91, 0xBC, 0x9B, 0x00, 0xB9, 0xBC, 0x19, 0x80, 0xFB, 0x9B, 0x99, 0xCC, 0x9B, 0x72, 0x35, 0x33,
+  0x00, 0x99, 0x09, 0x43, 0x03, 0xC9, 0xBC, 0x09, 0x90, 0xCB, 0x9B, 0x09, 0xB9, 0xBD, 0xAA, 0xD9,
+  0x2F, 0xEE, 0x2F, 0x00, 0xBD, 0x2A, 0x57, 0x33, 0x12, 0x90, 0x89, 0x30, 0x33, 0xB1, 0xCE, 0x9A,
+  0x10, 0xA8, 0xBC, 0x9B, 0x88, 0xB9, 0xBC, 0xAB, 0xBD, 0x0A, 0x67, 0x34, 0x33, 0x80, 0xA9, 0x28,
+  0x33, 0x92, 0xCE, 0xAA, 0x10, 0x98, 0xBC, 0xAB, 0x88, 0x99, 0xDA, 0xBB, 0xAD, 0x48, 0x65, 0x43,
+  0x22, 0x91, 0x99, 0x28, 0x32, 0xB0, 0xAF, 0x89, 0x01, 0xB9, 0xBC, 0xAB, 0x80, 0xB9, 0xCC, 0xAB,
+  0x89, 0x64, 0x45, 0x43, 0x12, 0x98, 0x8A, 0x21, 0x02, 0xEA, 0x9B, 0x08, 0x80, 0xDB, 0xAC, 0x89,
+  0x88, 0xCA, 0xBB, 0x8A, 0x52, 0x55, 0x43, 0x33, 0x91, 0xA9, 0x28, 0x22, 0xC9, 0xAD, 0x89, 0x01,
+  0xDA, 0xBC, 0x99, 0x88, 0xCA, 0xBC, 0x8B, 0x41, 0x54, 0x43, 0x24, 0x82, 0x98, 0x18, 0x22, 0xB8,
+  0xBD, 0x0A, 0x10, 0xD9, 0xCC, 0x9A, 0x88, 0xCA, 0xDB, 0x8A, 0x42, 0x34, 0x53, 0x33, 0x02, 0x98,
+  0x10, 0x23, 0xB8, 0xBE, 0xC1, 0x05, 0x2F, 0x00, 0x0A, 0x01, 0xDA, 0xBD, 0x9A, 0xA9, 0xDB, 0xAC,
+  0x1A, 0x53, 0x34, 0x44, 0x23, 0x01, 0x89, 0x10, 0x13, 0xD9, 0xBB, 0x09, 0x00, 0xFB, 0xAC, 0x9A,
+  0xA9, 0xDB, 0xAB, 0x31, 0x36, 0x34, 0x34, 0x22, 0x81, 0x88, 0x21, 0x91, 0xDB, 0xAB, 0x99, 0xC9,
+  0xDC, 0xAB, 0xBB, 0xBC, 0xAC, 0x19, 0x63, 0x44, 0x33, 0x13, 0x01, 0x00, 0x12, 0x90, 0xCC, 0x8A,
+  0x98, 0xDA, 0xAD, 0xBB, 0xAA, 0xCC, 0xAC, 0x08, 0x52, 0x53, 0x33, 0x22, 0x02, 0x00, 0x12, 0x91,
+  0xCB, 0x9C, 0x89, 0xDA, 0xDB, 0xAB, 0xCB, 0xCB, 0xBA, 0x19, 0x53, 0x35, 0x44, 0x12, 0x01, 0x11,
+  0x11, 0x90, 0xBA, 0x9B, 0x98, 0xEB, 0xAD, 0xBB, 0xDA, 0xCB, 0xAB, 0x10, 0x44, 0x53, 0x33, 0x23,
+  0x12, 0x22, 0x12, 0xA0, 0xAC, 0x9B, 0xA8, 0xCD, 0xAC, 0xAA, 0xDB, 0xBC, 0xAB, 0x18, 0x53, 0x43,
+  0x34, 0x34, 0x22, 0x22, 0x21, 0x90, 0xA9, 0xAB, 0x4E, 0x07, 0x21, 0x00, 0xC9, 0xCC, 0xBC, 0xAC,
+  0xBC, 0xDB, 0x9B, 0x08, 0x41, 0x43, 0x34, 0x33, 0x32, 0x33, 0x33, 0xA1, 0xBB, 0xAB, 0xEA, 0xCD,
+  0xCA, 0xBB, 0xCB, 0xCB, 0x9B, 0x00, 0x42, 0x43, 0x43, 0x43, 0x23, 0x22, 0x22, 0xA8, 0x90, 0x9C,
+  0xD9, 0xBC, 0xDB, 0xBB, 0xAC, 0xCC, 0x99, 0x19, 0x22, 0x53, 0x42, 0x33, 0x42, 0x22, 0x22, 0x08,
+  0x90, 0x8B, 0xD0, 0xCE, 0xA9, 0xAC, 0xAA, 0xBB, 0x8A, 0x80, 0x33, 0x56, 0x23, 0x43, 0x21, 0x25,
+  0x11, 0x80, 0x90, 0x10, 0xBC, 0xCB, 0xBB, 0xBD, 0xBA, 0xB9, 0xBB, 0x3B, 0x73, 0x25, 0x31, 0x34,
+  0x42, 0x22, 0x12, 0x93, 0x29, 0x8C, 0xBA, 0xF9, 0xAC, 0xB9, 0x8D, 0xA9, 0x89, 0x08, 0x30, 0x15,
+  0x42, 0x32, 0x43, 0x23, 0x38, 0x94, 0x08, 0x8D, 0xB0, 0xAF, 0xB8, 0xBC, 0x98, 0xBB, 0x00, 0x0A,
+  0x24, 0x52, 0x38, 0x34, 0x24, 0x03, 0x51, 0x80, 0xC0, 0x1A, 0xD9, 0xA8, 0x53, 0x00, 0x1C, 0x00,
+  0xAC, 0xB9, 0x9E, 0x80, 0x19, 0x80, 0x34, 0x09, 0x15, 0x72, 0x81, 0x20, 0x81, 0x80, 0x38, 0xD1,
+  0x80, 0x8D, 0xC0, 0x19, 0xCB, 0x08, 0x08, 0x80, 0x78, 0x01, 0x38, 0x83, 0x60, 0x81, 0x00, 0x15,
+  0x08, 0xAD, 0x23, 0xCC, 0x88, 0x08, 0xA0, 0x8D, 0x00, 0xBC, 0x24, 0x0C, 0x83, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x18, 0xFE, 0x08, 0x08, 0x08, 0xBD, 0x00, 0xE8, 0x1A, 0x88, 0x80, 0x80, 0x00, 0x88,
+  0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0xA0, 0xD4, 0x2F, 0xFD, 0x30, 0xAA, 0x00, 0x08, 0x08, 0x79,
+  0x85, 0x80, 0x80, 0x70, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x98, 0x47, 0x0E, 0x04, 0x08,
+  0x28, 0x84, 0x08, 0x08, 0x25, 0xBB, 0x06, 0x08, 0x08, 0x80, 0x08, 0x08, 0xD0, 0x21, 0x88, 0x3D,
+  0x91, 0x00, 0xA0, 0x45, 0x8D, 0x81, 0x70, 0xAA, 0x00, 0x08, 0x08, 0x08, 0x08, 0x8F, 0x04, 0xBC,
+  0xEE, 0xFF, 0x1B, 0x00, 0x00, 0x08, 0x49, 0xB6, 0x0A, 0x82, 0x0A, 0x80, 0x08, 0x08, 0x08, 0x08,
+  0x18, 0xFC, 0x2F, 0xA8, 0x00, 0x49, 0xD1, 0x80, 0x14, 0x0C, 0x48, 0xB1, 0x2C, 0x84, 0xAB, 0x24,
+  0xBB, 0x50, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // thirteen
+  0xC9, 0xFF, 0x00, 0x00, 0xF0, 0xF7, 0x84, 0x3D, 0x99, 0x85, 0xA9, 0x94, 0x1B, 0x94, 0x9B, 0x53,
+  0x0C, 0x82, 0xB9, 0x38, 0xB5, 0x2A, 0xA4, 0x4C, 0x92, 0x00, 0x08, 0x08, 0x08, 0x39, 0xF3, 0x01,
+  0x2A, 0xA7, 0x5A, 0xA8, 0x02, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x00, 0x7A, 0xF3, 0x01,
+  0x3A, 0xC0, 0x51, 0xAA, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x01, 0xBF, 0x09, 0x80, 0x80,
+  0x28, 0xEF, 0x08, 0x08, 0x80, 0x90, 0x0B, 0x8F, 0x08, 0x08, 0x08, 0xC0, 0x58, 0xEA, 0x88, 0x80,
+  0x80, 0x00, 0xBC, 0x07, 0x99, 0x93, 0x1D, 0x91, 0x49, 0xB0, 0xB2, 0x5C, 0xC2, 0x40, 0x0A, 0x81,
+  0xC0, 0x12, 0x08, 0x08, 0x08, 0x08, 0x29, 0x04, 0x4A, 0x07, 0x08, 0x10, 0x2B, 0x17, 0x4B, 0x80,
+  0x80, 0x80, 0x71, 0x92, 0x00, 0x08, 0x88, 0x97, 0x58, 0x09, 0x01, 0x8A, 0x93, 0x00, 0x08, 0x08,
+  0x7A, 0xC6, 0x81, 0x09, 0xA1, 0x00, 0x1A, 0x00, 0x19, 0x28, 0xF3, 0x28, 0x99, 0x00, 0x08, 0xA8,
+  0x02, 0x90, 0x2F, 0x98, 0x0A, 0x68, 0x9D, 0x32, 0xCB, 0x51, 0xAA, 0x00, 0x08, 0x08, 0x90, 0xA1,
+  0x1F, 0xB4, 0x4D, 0xC0, 0x11, 0x1B, 0x08, 0xC2, 0x08, 0x90, 0x42, 0x1C, 0x02, 0xF1, 0x31, 0x08,
+  0x08, 0x08, 0x3A, 0xA0, 0x00, 0x88, 0x87, 0x80, 0x78, 0xD8, 0x23, 0x8D, 0x13, 0x1A, 0xB1, 0x30,
+  0x08, 0x3B, 0x97, 0x5D, 0x09, 0x98, 0x02, 0x0B, 0x81, 0x90, 0x48, 0xA9, 0x69, 0xD2, 0x0A, 0x82,
+  0x80, 0x3A, 0xAD, 0x90, 0x97, 0x3B, 0xAA, 0x81, 0xE0, 0x11, 0x4C, 0xBA, 0x80, 0x88, 0x81, 0x2F,
+  0xD0, 0x08, 0xA0, 0x40, 0x1F, 0x88, 0x90, 0x08, 0x08, 0x08, 0x08, 0x18, 0xAF, 0x87, 0x0B, 0x02,
+  0x1B, 0xA3, 0x02, 0x0E, 0xB3, 0x81, 0x30, 0x8C, 0x97, 0x1B, 0x82, 0x4A, 0xB1, 0x51, 0xB8, 0x82,
+  0xE2, 0x32, 0x1E, 0x82, 0x0B, 0x41, 0xA9, 0x96, 0x34, 0xFF, 0x21, 0x00, 0xA0, 0x50, 0x18, 0x29,
+  0xD0, 0x86, 0x2B, 0x59, 0xD0, 0x22, 0xA9, 0x11, 0x2A, 0xB2, 0x69, 0xA8, 0x90, 0x95, 0x3A, 0x18,
+  0xA0, 0x3A, 0x94, 0x1A, 0xA2, 0x58, 0xAB, 0x3B, 0x17, 0x1C, 0xB4, 0x9A, 0x21, 0x8D, 0x40, 0xE2,
+  0x18, 0x19, 0xA8, 0x80, 0x82, 0x0D, 0x41, 0xD3, 0x49, 0x99, 0xA0, 0x02, 0x0A, 0x04, 0xFB, 0x0D,
+  0x91, 0x8B, 0x01, 0xA0, 0x69, 0x80, 0x25, 0x02, 0x2B, 0xB4, 0x01, 0xAD, 0xDD, 0x88, 0x89, 0x99,
+  0xAA, 0xBE, 0xBA, 0x60, 0x62, 0x45, 0x13, 0x33, 0x13, 0xDB, 0xCA, 0xCC, 0x0A, 0xCA, 0x99, 0xCA,
+  0xAD, 0x22, 0x0A, 0x77, 0x03, 0x51, 0xA1, 0x9C, 0x00, 0x9A, 0x31, 0xC0, 0x1A, 0xC1, 0xAB, 0x93,
+  0x8C, 0x90, 0x91, 0x7B, 0x24, 0x02, 0x37, 0xA0, 0x9C, 0x92, 0x1B, 0x12, 0xC9, 0x00, 0xC9, 0x0B,
+  0xA8, 0x1A, 0xE8, 0x12, 0x4B, 0x34, 0x04, 0x55, 0x98, 0x9C, 0x82, 0x1A, 0x17, 0x0C, 0x41, 0x00,
+  0x12, 0xD9, 0x00, 0xAB, 0x1B, 0xA0, 0x29, 0xF1, 0x3A, 0xAA, 0x45, 0x14, 0x60, 0xA2, 0xAB, 0x00,
+  0x8A, 0x43, 0xC8, 0x29, 0xCA, 0x8B, 0x92, 0x0A, 0x83, 0x9F, 0xC3, 0x48, 0x53, 0x20, 0x06, 0xAB,
+  0x1A, 0xA8, 0x42, 0x91, 0x0B, 0xD1, 0x9C, 0x10, 0x8A, 0x12, 0xF8, 0x28, 0xAB, 0x35, 0x04, 0x71,
+  0xA0, 0x9A, 0x00, 0x1B, 0x15, 0xA9, 0x10, 0xCC, 0x08, 0x90, 0x20, 0x91, 0x9D, 0xB2, 0x4C, 0x25,
+  0x01, 0x17, 0xAB, 0x09, 0xA8, 0x41, 0x82, 0x9A, 0xB1, 0xAD, 0x10, 0x08, 0x12, 0xAA, 0x8F, 0xC1,
+  0x60, 0x13, 0x30, 0x96, 0x9C, 0x08, 0x89, 0x33, 0xB1, 0x0A, 0xE9, 0x8A, 0x01, 0x28, 0x91, 0xDA,
+  0x2A, 0xAC, 0x37, 0x03, 0x62, 0xC0, 0x9A, 0x80, 0x29, 0x05, 0xA8, 0x09, 0xCB, 0x08, 0x01, 0x11,
+  0xA0, 0xFB, 0x29, 0x0C, 0x27, 0x01, 0x42, 0xD9, 0x8A, 0x80, 0x30, 0x03, 0xC9, 0x98, 0xBB, 0x29,
+  0x4A, 0xED, 0x3D, 0x00, 0x03, 0x02, 0xAA, 0xEF, 0x81, 0x3A, 0x27, 0x00, 0x23, 0xCC, 0x0A, 0x80,
+  0x41, 0x83, 0xBB, 0xB8, 0xAB, 0x48, 0x12, 0xA2, 0xAB, 0xCF, 0x81, 0x69, 0x24, 0x00, 0x05, 0xBC,
+  0x09, 0x81, 0x42, 0x92, 0xBB, 0xA9, 0x9B, 0x50, 0x21, 0xB0, 0xC9, 0x9E, 0x92, 0x78, 0x23, 0x18,
+  0x85, 0xBC, 0x19, 0x81, 0x43, 0x91, 0xAC, 0xA9, 0x9A, 0x32, 0x32, 0xB8, 0xEB, 0x9E, 0x82, 0x68,
+  0x14, 0x00, 0x84, 0xBC, 0x19, 0x00, 0x43, 0x91, 0x9D, 0xA9, 0x99, 0x32, 0x21, 0xB1, 0xCC, 0xAD,
+  0x83, 0x78, 0x14, 0x00, 0x02, 0xBD, 0x1A, 0x01, 0x43, 0x91, 0x9D, 0xB9, 0x89, 0x41, 0x21, 0xB0,
+  0xBB, 0xAF, 0x12, 0x5A, 0x26, 0x88, 0x13, 0xBD, 0x1A, 0x81, 0x43, 0x92, 0xAC, 0xB9, 0x8A, 0x41,
+  0x12, 0xA1, 0xAC, 0xBE, 0x12, 0x39, 0x57, 0x80, 0x11, 0xDB, 0x89, 0x01, 0x42, 0x81, 0xAB, 0xBA,
+  0x8B, 0x42, 0x31, 0xA2, 0xB2, 0x04, 0x3C, 0x00, 0xAD, 0xCC, 0x38, 0x29, 0x47, 0x81, 0x30, 0xEA,
+  0x8A, 0x01, 0x41, 0x82, 0xBA, 0xBA, 0x8B, 0x30, 0x34, 0x82, 0xBC, 0xDD, 0x39, 0x88, 0x37, 0x82,
+  0x48, 0xD9, 0x8A, 0x10, 0x40, 0x03, 0xBA, 0xBA, 0x8D, 0x10, 0x22, 0x03, 0xCB, 0xDB, 0x2C, 0xA1,
+  0x46, 0x02, 0x39, 0xD1, 0x8C, 0x18, 0x38, 0x05, 0x99, 0xAA, 0xAB, 0x10, 0x31, 0x14, 0xBA, 0xEB,
+  0x0C, 0xA2, 0x65, 0x01, 0x28, 0xC1, 0xAB, 0x00, 0x48, 0x05, 0x89, 0xAA, 0xAB, 0x00, 0x21, 0x24,
+  0xBA, 0xCB, 0x8E, 0x81, 0x74, 0x01, 0x10, 0xC1, 0x9B, 0x08, 0x40, 0x04, 0x98, 0xBA, 0x9C, 0x80,
+  0x21, 0x14, 0xAA, 0xE9, 0x1B, 0x88, 0x47, 0x01, 0x30, 0xD8, 0x8B, 0x88, 0x51, 0x02, 0x89, 0xCA,
+  0x8B, 0x80, 0x40, 0x02, 0xA9, 0xF9, 0x1A, 0x19, 0x27, 0x02, 0x31, 0xEB, 0x99, 0x08, 0x52, 0x00,
+  0x98, 0xCA, 0x0A, 0x88, 0x31, 0x82, 0x89, 0xFC, 0x5E, 0xE3, 0x44, 0x00, 0x08, 0x4A, 0x25, 0x10,
+  0x13, 0xAE, 0x89, 0x88, 0x34, 0x08, 0xA8, 0xCB, 0x89, 0x1A, 0x22, 0x92, 0x99, 0xBF, 0xB0, 0x72,
+  0x24, 0x40, 0xB2, 0xBB, 0x8B, 0x38, 0x06, 0x01, 0xC9, 0x9A, 0xAA, 0x00, 0x22, 0x18, 0xF8, 0x0B,
+  0x0C, 0x36, 0x03, 0x35, 0xBA, 0xBB, 0x99, 0x62, 0x10, 0xA2, 0xBB, 0xB9, 0x8D, 0x01, 0x81, 0x11,
+  0x9F, 0xE1, 0x30, 0x43, 0x40, 0x93, 0xBA, 0xAB, 0x29, 0x14, 0x21, 0xD9, 0x99, 0xBC, 0x88, 0x18,
+  0x30, 0xF0, 0x08, 0x0D, 0x53, 0x12, 0x26, 0xA9, 0x99, 0x8B, 0x22, 0x28, 0xB3, 0x0D, 0xD9, 0x8B,
+  0x90, 0x39, 0xC3, 0x28, 0xEB, 0x42, 0x12, 0x37, 0x90, 0x90, 0x8D, 0x00, 0x18, 0x82, 0x0B, 0xD0,
+  0xAB, 0xA9, 0x1A, 0x83, 0x49, 0xF8, 0x30, 0x12, 0x65, 0x82, 0x88, 0xAA, 0x08, 0x08, 0x82, 0xAA,
+  0xA1, 0xAF, 0xBA, 0xAA, 0x11, 0x49, 0xC2, 0x48, 0x12, 0x73, 0x06, 0x00, 0xC3, 0x14, 0x3E, 0x00,
+  0x99, 0x08, 0x89, 0x80, 0xB9, 0x09, 0xAD, 0xD0, 0x9A, 0x89, 0x29, 0x83, 0x50, 0x02, 0x35, 0x34,
+  0x13, 0x88, 0xA0, 0x29, 0x8F, 0xE9, 0xA0, 0x9A, 0x09, 0x9A, 0x19, 0xE1, 0x13, 0x38, 0x31, 0x05,
+  0x15, 0x11, 0x12, 0x1A, 0xB0, 0xE8, 0x08, 0x9E, 0xC0, 0x89, 0xA0, 0x28, 0xB0, 0x40, 0xB9, 0x35,
+  0x28, 0x51, 0x08, 0x84, 0x31, 0x49, 0x90, 0x92, 0xB1, 0x3B, 0xAF, 0x29, 0xAC, 0xD2, 0xB1, 0x1B,
+  0x09, 0x11, 0x00, 0x92, 0x31, 0x33, 0x44, 0x14, 0x02, 0x80, 0x98, 0x8A, 0xC0, 0xAA, 0xDB, 0xBD,
+  0x9B, 0x10, 0x83, 0x80, 0x80, 0x52, 0x50, 0x24, 0x32, 0x02, 0x98, 0xB1, 0x9D, 0xCC, 0x89, 0xBD,
+  0xAA, 0xC9, 0x80, 0x80, 0x08, 0x16, 0x08, 0x08, 0x88, 0x35, 0x88, 0x00, 0x9F, 0x80, 0xC8, 0x89,
+  0x00, 0xF9, 0x08, 0x08, 0x08, 0x88, 0x17, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x19, 0xFA,
+  0x2C, 0xFE, 0x14, 0x00, 0x22, 0x19, 0x88, 0x80, 0x80, 0x70, 0x17, 0x32, 0x49, 0x80, 0x00, 0x08,
+  0x88, 0x10, 0xFF, 0x08, 0x08, 0x80, 0x38, 0x06, 0x28, 0x05, 0x29, 0x85, 0x80, 0x42, 0x80, 0xB0,
+  0x8D, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x7B, 0x47, 0x08, 0x08, 0x08, 0x88,
+  0xA1, 0xCF, 0x80, 0x90, 0x8F, 0x08, 0x08, 0xCB, 0x08, 0x68, 0x82, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0xF2, 0xBF, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x77, 0x02, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x90, 0xB2, 0x71, 0x77, 0x82,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x6B, 0xFF, 0x0D, 0x08, 0x80, 0x80, 0xC0, 0x8F, 0x80, 0x80, 0x00, 0xFB, 0x08, 0x08,
+  0x08, 0x88, 0xA1, 0x8F, 0x83, 0xFE, 0x19, 0x00, 0xD3, 0x08, 0x08, 0xA8, 0x70, 0xCB, 0x07, 0x1C,
+  0xA2, 0x88, 0x80, 0x82, 0x19, 0xF9, 0xC7, 0x7B, 0x98, 0x01, 0x4A, 0xFB, 0xA7, 0x58, 0x9A, 0x01,
+  0x08, 0x88, 0x58, 0x9B, 0x22, 0x89, 0xC0, 0x11, 0x11, 0x3C, 0x8A, 0x10, 0x21, 0xCB, 0x01, 0x1C,
+  0x08, 0x0D, 0x32, 0x32, 0x0E, 0x92, 0x2C, 0x02, 0x89, 0xB9, 0xB7, 0x20, 0x28, 0x19, 0x09, 0x88,
+  0x38, 0xF8, 0xC2, 0x4A, 0xC0, 0x30, 0x8B, 0x96, 0x29, 0xA0, 0x23, 0x0F, 0x01, 0xB8, 0x05, 0x3B,
+  0xF1, 0x20, 0x9A, 0x02, 0x5B, 0xBA, 0x22, 0x1B, 0xC0, 0x03, 0x89, 0x55, 0xAC, 0xA5, 0x4A, 0x90,
+  0x59, 0xBB, 0x01, 0x7B, 0x90, 0x08, 0x09, 0x21, 0x0A, 0xA0, 0x19, 0xB0, 0x41, 0x4A, 0x1A, 0x4D,
+  0x99, 0x13, 0x3D, 0x99, 0x90, 0xE3, 0x82, 0x98, 0x03, 0x1E, 0xA1, 0x28, 0xF2, 0x40, 0x0B, 0x01,
+  0x1B, 0xC7, 0x48, 0x0A, 0x91, 0x80, 0xB2, 0x82, 0x48, 0xFF, 0x2E, 0x00, 0x19, 0x3A, 0xC1, 0xB4,
+  0xA2, 0xC3, 0x7A, 0x8A, 0x94, 0x4A, 0xE0, 0x84, 0x19, 0xB1, 0x28, 0xD1, 0x12, 0x89, 0x7A, 0x8A,
+  0x92, 0x39, 0xB9, 0x85, 0x4B, 0xA9, 0x22, 0x9A, 0x93, 0x7F, 0x99, 0x11, 0xAA, 0x86, 0x2B, 0xD2,
+  0x11, 0x99, 0x93, 0x6B, 0xB9, 0x04, 0x1B, 0xD3, 0x48, 0xB9, 0x85, 0x2C, 0xC2, 0x30, 0x0B, 0x10,
+  0x2C, 0xE2, 0x02, 0x2B, 0xA1, 0x59, 0xA9, 0x02, 0x99, 0xB5, 0x7A, 0xA9, 0x03, 0x2D, 0xB1, 0x30,
+  0x1C, 0x91, 0x29, 0xC1, 0x92, 0x91, 0x7A, 0xB9, 0x85, 0x4B, 0xB8, 0x13, 0x3D, 0xC8, 0x94, 0x5A,
+  0xA9, 0x94, 0x19, 0xA0, 0x82, 0x5A, 0x9A, 0xB6, 0x30, 0x8C, 0xA4, 0x49, 0x99, 0x82, 0x2A, 0xA0,
+  0x01, 0x5C, 0xC8, 0x84, 0x3B, 0xB0, 0x12, 0x1B, 0xE3, 0x11, 0x2B, 0xE2, 0x12, 0x2C, 0xC1, 0x02,
+  0x3B, 0xE1, 0x31, 0x0C, 0xC4, 0x20, 0x1B, 0xB2, 0x68, 0x8B, 0xB4, 0x30, 0x24, 0x09, 0x3E, 0x00,
+  0x0C, 0xB2, 0x40, 0x8B, 0xA4, 0x5A, 0x8A, 0xA3, 0x28, 0xC8, 0x03, 0x3C, 0x99, 0x82, 0x4A, 0xC8,
+  0x94, 0x3A, 0xC0, 0x41, 0x0C, 0xB2, 0x92, 0x18, 0x3B, 0x99, 0x13, 0xBB, 0x97, 0x18, 0x29, 0x3F,
+  0xD0, 0x82, 0x80, 0x88, 0x40, 0x1E, 0xB1, 0x01, 0xC1, 0x22, 0x2D, 0x88, 0xA1, 0x81, 0x81, 0x5B,
+  0x19, 0x8A, 0xD4, 0x93, 0x39, 0x2C, 0x98, 0x81, 0xD5, 0x21, 0x1C, 0x90, 0x30, 0xAB, 0xA6, 0x10,
+  0x3A, 0x1A, 0xB0, 0xB3, 0x83, 0x7C, 0xA8, 0x82, 0x01, 0x4B, 0xD0, 0x31, 0x9C, 0x95, 0x09, 0x49,
+  0xBA, 0x87, 0x3A, 0xA9, 0x94, 0x39, 0x09, 0xB2, 0x31, 0x2B, 0xF4, 0x12, 0x2C, 0xB8, 0x83, 0x3D,
+  0xA9, 0xC3, 0x10, 0x1A, 0x80, 0x92, 0x49, 0x0A, 0x82, 0x23, 0x43, 0x79, 0x02, 0x11, 0xB0, 0xD9,
+  0xFA, 0x8B, 0xAC, 0xC8, 0x99, 0x0A, 0x19, 0x83, 0x37, 0x54, 0x42, 0x23, 0x32, 0x88, 0xF1, 0xA9,
+  0x6F, 0x0A, 0x33, 0x00, 0x9E, 0xCA, 0xB9, 0xA9, 0x0B, 0x99, 0x14, 0x72, 0x32, 0x16, 0x23, 0x21,
+  0x08, 0xC0, 0xA9, 0xAD, 0xCA, 0xAA, 0x9C, 0xAA, 0x09, 0x89, 0x94, 0x25, 0x72, 0x32, 0x23, 0x23,
+  0x00, 0x90, 0xBA, 0xBE, 0xBC, 0xCB, 0xBA, 0xA9, 0x1C, 0x9B, 0xC3, 0x34, 0x71, 0x42, 0x23, 0x22,
+  0x01, 0x80, 0x99, 0xAC, 0xBD, 0xDA, 0x99, 0x8B, 0x9B, 0xBA, 0x89, 0x29, 0x26, 0x27, 0x34, 0x33,
+  0x12, 0x81, 0x80, 0x9A, 0xBD, 0xCC, 0xBA, 0xBA, 0x9A, 0x9D, 0xBA, 0x98, 0x48, 0x44, 0x35, 0x53,
+  0x22, 0x11, 0x00, 0x98, 0xA9, 0xCC, 0xBB, 0xBC, 0xBA, 0xA9, 0x9E, 0xBA, 0xB0, 0x52, 0x71, 0x22,
+  0x15, 0x22, 0x20, 0x08, 0x98, 0xB9, 0xBC, 0xAD, 0xBA, 0xB9, 0xAA, 0x8E, 0xBB, 0xB0, 0x44, 0x71,
+  0x31, 0x14, 0x13, 0x20, 0x19, 0xA8, 0xD9, 0xBA, 0xAC, 0x9B, 0xBA, 0xC8, 0xAB, 0x9E, 0x98, 0x33,
+  0x74, 0x32, 0x14, 0x13, 0x1A, 0x15, 0x39, 0x00, 0x11, 0x19, 0x99, 0xDA, 0xCA, 0xAB, 0x9B, 0xAA,
+  0xC9, 0xAB, 0x8F, 0xA8, 0x14, 0x73, 0x31, 0x13, 0x05, 0x10, 0x08, 0x88, 0xC9, 0xC9, 0xAA, 0xAB,
+  0xB9, 0xA9, 0x9D, 0xAC, 0xA0, 0x34, 0x73, 0x42, 0x23, 0x13, 0x11, 0x29, 0x89, 0xEA, 0xC9, 0x9B,
+  0x9C, 0xAA, 0xB9, 0x9C, 0x9D, 0xA0, 0x33, 0x73, 0x34, 0x23, 0x14, 0x10, 0x18, 0x88, 0xBA, 0xCC,
+  0xBB, 0xBC, 0xBA, 0xCA, 0x9C, 0xAC, 0x98, 0x43, 0x73, 0x42, 0x13, 0x13, 0x11, 0x18, 0x98, 0xD9,
+  0xCA, 0x9C, 0xAB, 0xC9, 0xA9, 0xBB, 0xCB, 0x88, 0x71, 0x42, 0x24, 0x33, 0x33, 0x10, 0x08, 0x90,
+  0xDA, 0xCB, 0xBC, 0xBA, 0xBA, 0x9C, 0xCB, 0xD9, 0x80, 0x60, 0x31, 0x25, 0x14, 0x23, 0x00, 0x08,
+  0x88, 0xC9, 0xDA, 0xAB, 0xAB, 0xBA, 0xAA, 0x9E, 0xBA, 0x08, 0x61, 0x53, 0x24, 0x24, 0x22, 0x01,
+  0x80, 0x80, 0xBA, 0xDC, 0xBB, 0xBB, 0xBA, 0xAB, 0x67, 0xF3, 0x2E, 0x00, 0xAE, 0xB9, 0x1A, 0x60,
+  0x24, 0x26, 0x33, 0x32, 0x01, 0x81, 0x08, 0xCA, 0xEB, 0xBB, 0xBB, 0xCA, 0xAA, 0xBB, 0xAC, 0x0B,
+  0x32, 0x57, 0x53, 0x41, 0x21, 0x81, 0x00, 0x08, 0xB9, 0xCB, 0xAD, 0xAB, 0xB9, 0xAB, 0xAC, 0xAC,
+  0xA8, 0x32, 0x75, 0x32, 0x24, 0x23, 0x01, 0x00, 0x88, 0xA9, 0xBD, 0xBD, 0xBA, 0xAB, 0xBB, 0xAC,
+  0xAC, 0xA9, 0x61, 0x62, 0x32, 0x25, 0x22, 0x11, 0x80, 0x00, 0xA9, 0xDC, 0xCA, 0xAA, 0xAA, 0xAA,
+  0xAC, 0xBA, 0x89, 0x79, 0x42, 0x25, 0x43, 0x32, 0x10, 0x80, 0x00, 0xA9, 0xEB, 0xBB, 0x9D, 0xBA,
+  0xC8, 0x99, 0x8B, 0x8B, 0x01, 0x37, 0x45, 0x32, 0x23, 0x03, 0x01, 0x08, 0xAA, 0xCC, 0xBD, 0xBA,
+  0xBA, 0xAB, 0xAC, 0x8C, 0x8C, 0x92, 0x36, 0x72, 0x31, 0x03, 0x13, 0x00, 0x08, 0x99, 0xBC, 0xBD,
+  0xCB, 0x9A, 0x9B, 0x9C, 0xAB, 0xC9, 0x11, 0x71, 0x53, 0x23, 0x24, 0x12, 0x18, 0x14, 0x36, 0x00,
+  0x10, 0x08, 0x99, 0xFA, 0xBA, 0xAB, 0xAB, 0xBB, 0xBB, 0xDC, 0xA8, 0x49, 0x48, 0x16, 0x24, 0x42,
+  0x11, 0x01, 0x00, 0x98, 0xCA, 0xAD, 0xBA, 0xB9, 0xAA, 0xBB, 0xEA, 0x99, 0x3A, 0x30, 0x47, 0x53,
+  0x32, 0x12, 0x02, 0x18, 0x99, 0xBB, 0xBF, 0xCA, 0xA9, 0x9A, 0xAA, 0xC9, 0x0A, 0x0B, 0x06, 0x45,
+  0x42, 0x23, 0x23, 0x01, 0x00, 0x98, 0xBC, 0xCD, 0xAA, 0xAB, 0xAA, 0x9C, 0xBA, 0x8A, 0x89, 0x36,
+  0x54, 0x53, 0x23, 0x22, 0x02, 0x81, 0x98, 0xDB, 0xBC, 0xAC, 0xAB, 0xAA, 0xCB, 0xAA, 0x8B, 0x80,
+  0x72, 0x34, 0x44, 0x33, 0x23, 0x12, 0x10, 0x98, 0xBC, 0xBE, 0xBB, 0xBB, 0xAC, 0xBA, 0xAC, 0xAA,
+  0x88, 0x41, 0x44, 0x45, 0x33, 0x33, 0x32, 0x22, 0x81, 0xDA, 0xEB, 0xBB, 0xAC, 0xBA, 0xCA, 0xBA,
+  0x9C, 0x09, 0x20, 0x54, 0x53, 0x24, 0x23, 0x23, 0x22, 0x80, 0xC9, 0xDB, 0xCB, 0xBB, 0xBB, 0xBC,
+  0x8C, 0xF1, 0x31, 0x00, 0xBB, 0xBB, 0x09, 0x41, 0x55, 0x53, 0x43, 0x22, 0x23, 0x21, 0x80, 0xB9,
+  0xBD, 0xBC, 0xAC, 0xAC, 0xBA, 0xBB, 0xAB, 0x19, 0x41, 0x55, 0x43, 0x34, 0x32, 0x22, 0x22, 0x80,
+  0xCA, 0xCB, 0xBC, 0xAC, 0xAC, 0xBB, 0xAB, 0xAB, 0x18, 0x52, 0x45, 0x43, 0x43, 0x32, 0x22, 0x11,
+  0x98, 0xCA, 0xCB, 0xDB, 0xBB, 0xCB, 0xBB, 0xBB, 0x9B, 0x29, 0x44, 0x45, 0x43, 0x33, 0x33, 0x24,
+  0x01, 0xA8, 0xBA, 0xBD, 0xBC, 0xBC, 0xBC, 0xBB, 0xBB, 0x9A, 0x18, 0x54, 0x34, 0x35, 0x33, 0x34,
+  0x22, 0x01, 0xA8, 0xBB, 0xBE, 0xDB, 0xAB, 0xBC, 0xBB, 0xBB, 0x99, 0x20, 0x64, 0x34, 0x34, 0x33,
+  0x43, 0x22, 0x00, 0xA9, 0xCB, 0xBC, 0xBD, 0xBB, 0xBC, 0xCB, 0x9A, 0x09, 0x21, 0x55, 0x43, 0x43,
+  0x23, 0x32, 0x12, 0x88, 0xCA, 0xBB, 0xCD, 0xBB, 0xAC, 0xAC, 0xAA, 0x99, 0x10, 0x43, 0x55, 0x33,
+  0x43, 0x23, 0x22, 0x01, 0x54, 0x17, 0x30, 0x00, 0xA8, 0xDB, 0xBC, 0xCB, 0xAC, 0xBB, 0xBB, 0xAA,
+  0x89, 0x32, 0x46, 0x35, 0x34, 0x33, 0x22, 0x12, 0x91, 0xBA, 0xBE, 0xBC, 0xBC, 0xCB, 0xAB, 0xBA,
+  0x99, 0x18, 0x63, 0x53, 0x53, 0x23, 0x33, 0x22, 0x11, 0x98, 0xBC, 0xBD, 0xBC, 0xBC, 0xCB, 0xBA,
+  0x9A, 0x89, 0x20, 0x44, 0x35, 0x44, 0x32, 0x23, 0x11, 0x01, 0xB9, 0xBC, 0xCD, 0xCA, 0xBA, 0xBB,
+  0xBB, 0x9A, 0x88, 0x42, 0x45, 0x44, 0x33, 0x33, 0x33, 0x12, 0x88, 0xD9, 0xDB, 0xBB, 0xCC, 0xAB,
+  0xAC, 0xA9, 0x99, 0x00, 0x33, 0x46, 0x53, 0x33, 0x33, 0x23, 0x11, 0x90, 0xCA, 0xCC, 0xBC, 0xBB,
+  0xBC, 0xAC, 0xA9, 0x89, 0x10, 0x43, 0x35, 0x35, 0x24, 0x33, 0x32, 0x11, 0xA8, 0xCA, 0xCC, 0xCB,
+  0xBB, 0xBC, 0xAB, 0x9B, 0x89, 0x10, 0x54, 0x53, 0x43, 0x33, 0x24, 0x12, 0x11, 0xA8, 0xCB, 0xCC,
+  0xBB, 0xDB, 0xAB, 0xBA, 0xA9, 0x09, 0x30, 0x54, 0xF1, 0xF5, 0x2E, 0x00, 0x44, 0x33, 0x24, 0x32,
+  0x02, 0x01, 0x98, 0xCD, 0xBB, 0xBC, 0xBC, 0xCB, 0x9B, 0x98, 0x10, 0x42, 0x44, 0x53, 0x33, 0x33,
+  0x14, 0x01, 0x98, 0xB9, 0xAF, 0xCA, 0xBA, 0xBB, 0xAC, 0x99, 0x08, 0x30, 0x34, 0x55, 0x33, 0x34,
+  0x41, 0x01, 0x01, 0x98, 0xDB, 0xCB, 0xCA, 0xBB, 0xAC, 0xBA, 0x88, 0x18, 0x32, 0x45, 0x34, 0x34,
+  0x33, 0x33, 0x02, 0x91, 0xBA, 0xBF, 0xBC, 0xBC, 0xBB, 0xAC, 0xAA, 0x89, 0x11, 0x42, 0x35, 0x44,
+  0x32, 0x23, 0x33, 0x00, 0x81, 0xDB, 0xCB, 0xCB, 0xBD, 0xAA, 0xBB, 0x9A, 0x98, 0x11, 0x63, 0x33,
+  0x44, 0x43, 0x22, 0x12, 0x21, 0x80, 0xAA, 0xD9, 0xBC, 0xBB, 0xCC, 0xAB, 0xAA, 0x0B, 0x02, 0x40,
+  0x63, 0x33, 0x43, 0x23, 0x33, 0x23, 0x13, 0x9C, 0xA0, 0xAB, 0xBE, 0xAA, 0xCD, 0x98, 0x8A, 0x29,
+  0x80, 0x50, 0x61, 0x11, 0x84, 0x22, 0x80, 0x03, 0x4A, 0xD8, 0x98, 0x9A, 0xF4, 0x00, 0x1B, 0x00,
+  0x0C, 0xC9, 0x08, 0xCA, 0x32, 0x2C, 0x92, 0x34, 0xAB, 0x17, 0x28, 0x0C, 0xB2, 0x9C, 0x00, 0x8B,
+  0xB8, 0x81, 0xE0, 0x5A, 0x91, 0x41, 0x30, 0xB8, 0x25, 0x09, 0xC4, 0x39, 0xAA, 0x84, 0x9F, 0x90,
+  0xB8, 0x40, 0x0B, 0x93, 0x10, 0x90, 0x72, 0x00, 0x38, 0xF3, 0x38, 0xB1, 0x4A, 0x81, 0x80, 0x28,
+  0xF2, 0x2E, 0xA1, 0x98, 0x02, 0xB9, 0x52, 0x92, 0x3A, 0x24, 0x28, 0x10, 0xC7, 0x18, 0x09, 0x4B,
+  0xFB, 0x22, 0xBC, 0x51, 0xAA, 0x21, 0xC0, 0x30, 0xA8, 0x41, 0xB9, 0x03, 0x0B, 0x90, 0x98, 0xD8,
+  0x98, 0x78, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08,
+  0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // fourteen
+  0xA4, 0xFF, 0x00, 0x00, 0xF0, 0x77, 0x8F, 0xC4, 0x02, 0x49, 0x8C, 0x04, 0xA9, 0x04, 0x0A, 0x38,
+  0xA8, 0x28, 0xE2, 0x90, 0x13, 0x5F, 0xD0, 0x82, 0x18, 0x98, 0x11, 0xA8, 0x23, 0x2F, 0x88, 0xC4,
+  0x80, 0x12, 0x1E, 0xA2, 0x10, 0x89, 0x30, 0xDB, 0x85, 0x19, 0xC0, 0x38, 0x92, 0x8D, 0x31, 0xC9,
+  0x01, 0xA8, 0x82, 0x1C, 0xC9, 0x03, 0x8C, 0x30, 0xFB, 0x01, 0x29, 0xAA, 0x81, 0x18, 0xBD, 0x31,
+  0xD8, 0xD5, 0x40, 0xAB, 0x03, 0x8A, 0x02, 0xD8, 0x11, 0xB0, 0x92, 0x6D, 0x99, 0x82, 0x0A, 0x84,
+  0x88, 0x4A, 0xA8, 0x03, 0x48, 0xE9, 0x85, 0x19, 0x5C, 0xB0, 0x20, 0x89, 0x93, 0x3A, 0xA3, 0x2C,
+  0xA7, 0x10, 0x91, 0x20, 0x4F, 0xA0, 0xA1, 0x15, 0x0C, 0x20, 0xD2, 0x49, 0xA1, 0x49, 0xA8, 0x82,
+  0x19, 0xA3, 0x3E, 0x91, 0x49, 0x99, 0x93, 0xA0, 0x61, 0xCA, 0x22, 0xA9, 0x12, 0x90, 0x2D, 0x11,
+  0x2F, 0xF2, 0x02, 0x0B, 0xFA, 0x00, 0x29, 0x00, 0x83, 0x8B, 0x85, 0x8B, 0x24, 0x9D, 0x82, 0x18,
+  0xB9, 0x79, 0x8A, 0x01, 0xA8, 0x4A, 0xF3, 0x39, 0x88, 0x98, 0x01, 0x99, 0x92, 0xB8, 0x7A, 0x0B,
+  0xE3, 0x10, 0x2A, 0xAA, 0x84, 0x2D, 0x90, 0x09, 0xA4, 0x28, 0x2E, 0x88, 0x80, 0xC2, 0x30, 0x1C,
+  0xB2, 0xB9, 0x07, 0x2C, 0xA1, 0x4A, 0xC1, 0x81, 0x49, 0xA0, 0x69, 0xC0, 0x10, 0x10, 0x2B, 0xC4,
+  0x38, 0xC0, 0x12, 0x4D, 0x88, 0x89, 0x93, 0x12, 0x0D, 0x42, 0xC9, 0x68, 0xB0, 0x40, 0x8A, 0x92,
+  0x10, 0x91, 0x2B, 0xA7, 0x09, 0x31, 0x0D, 0xA2, 0x83, 0x19, 0x3D, 0x81, 0xD1, 0x22, 0x99, 0x80,
+  0xA2, 0x30, 0x0E, 0x03, 0x8D, 0xD2, 0x04, 0x09, 0x0C, 0xA2, 0x40, 0xB8, 0x91, 0x4A, 0x0A, 0x95,
+  0x89, 0x89, 0xC1, 0x31, 0x9B, 0xBC, 0x17, 0x1D, 0x98, 0x1A, 0x82, 0x90, 0x8C, 0x80, 0x08, 0x98,
+  0xE3, 0x6B, 0xE8, 0x28, 0x09, 0xB1, 0xB2, 0x59, 0x33, 0xFE, 0x23, 0x00, 0x3A, 0xC0, 0x08, 0x82,
+  0x59, 0x9B, 0xB0, 0x02, 0xB8, 0x9F, 0x03, 0x08, 0xAA, 0x63, 0x02, 0x88, 0x8E, 0x30, 0x11, 0x35,
+  0x82, 0x08, 0x08, 0x18, 0xEC, 0xA8, 0xDC, 0x8B, 0x19, 0xB8, 0xCA, 0xBB, 0x08, 0x77, 0x43, 0x63,
+  0x43, 0x13, 0x01, 0x98, 0xBC, 0xEC, 0xBB, 0xDB, 0x9A, 0xAB, 0xCB, 0x09, 0x76, 0x34, 0x24, 0x02,
+  0xA9, 0xAB, 0x09, 0x80, 0xEB, 0xAC, 0x08, 0x00, 0xC9, 0xBC, 0x09, 0x32, 0x45, 0x42, 0x35, 0x14,
+  0xA8, 0xBC, 0x89, 0x11, 0xB9, 0xBD, 0x19, 0x22, 0xC9, 0xCD, 0x09, 0x31, 0x32, 0x32, 0x46, 0x35,
+  0x91, 0xEB, 0x8A, 0x00, 0x91, 0xBA, 0x8A, 0x31, 0x91, 0xEC, 0xAA, 0x20, 0x22, 0x22, 0x44, 0x46,
+  0x23, 0xB8, 0xAE, 0x0A, 0x01, 0xA0, 0xAC, 0x18, 0x22, 0xB0, 0xCD, 0x0A, 0x20, 0x12, 0x22, 0x64,
+  0x35, 0x14, 0xC9, 0xBB, 0x19, 0x01, 0xB8, 0xAC, 0x28, 0x22, 0xC8, 0xAD, 0x14, 0xE1, 0x3E, 0x00,
+  0x8A, 0x32, 0x01, 0x30, 0x65, 0x35, 0x14, 0xB9, 0xBC, 0x09, 0x11, 0xB0, 0xBC, 0x18, 0x23, 0xB0,
+  0xCE, 0x89, 0x21, 0x02, 0x08, 0x62, 0x46, 0x23, 0xA0, 0xBD, 0x8A, 0x11, 0x91, 0xCB, 0x8A, 0x32,
+  0x83, 0xEC, 0xAA, 0x20, 0x13, 0xA8, 0x18, 0x57, 0x44, 0x01, 0xBA, 0xAC, 0x18, 0x11, 0xB9, 0xAC,
+  0x10, 0x24, 0xB0, 0xBD, 0x0B, 0x41, 0x01, 0xAA, 0x50, 0x46, 0x24, 0x90, 0xCA, 0x8B, 0x18, 0x81,
+  0xBA, 0x9B, 0x31, 0x15, 0xC9, 0xBC, 0x1A, 0x23, 0x91, 0xAC, 0x72, 0x36, 0x14, 0x90, 0xBB, 0x9B,
+  0x10, 0x90, 0xCB, 0x9A, 0x32, 0x04, 0xDA, 0xAC, 0x18, 0x23, 0xB0, 0x9C, 0x73, 0x36, 0x23, 0x90,
+  0xCB, 0x9B, 0x08, 0x80, 0xCA, 0x9A, 0x30, 0x22, 0xD9, 0xAC, 0x19, 0x22, 0xA1, 0xBB, 0x71, 0x57,
+  0x23, 0x01, 0xBA, 0xAC, 0x09, 0x00, 0xA9, 0xBC, 0x19, 0x42, 0x91, 0xCC, 0x9A, 0x31, 0x13, 0xBA,
+  0x41, 0xEC, 0x35, 0x00, 0x2B, 0x77, 0x25, 0x12, 0xA9, 0xBB, 0x9A, 0x01, 0x98, 0xCC, 0x8A, 0x31,
+  0x03, 0xDA, 0xAC, 0x28, 0x22, 0xA8, 0xAB, 0x74, 0x36, 0x24, 0x80, 0xCA, 0x9A, 0x09, 0x80, 0xBA,
+  0xBB, 0x28, 0x25, 0xA8, 0xAE, 0x0A, 0x22, 0x91, 0xCA, 0x48, 0x66, 0x33, 0x02, 0xA9, 0xBC, 0x8A,
+  0x00, 0xA8, 0xDB, 0x0A, 0x31, 0x02, 0xEB, 0xAB, 0x20, 0x21, 0xB8, 0x9B, 0x76, 0x44, 0x23, 0x91,
+  0xCA, 0x9B, 0x09, 0x00, 0xCA, 0xAB, 0x28, 0x24, 0xA0, 0xBE, 0x0A, 0x31, 0x81, 0xCA, 0x38, 0x77,
+  0x33, 0x02, 0xB8, 0xAC, 0x8A, 0x01, 0xA8, 0xBC, 0x0A, 0x52, 0x82, 0xDB, 0xAB, 0x28, 0x22, 0xB8,
+  0x9B, 0x66, 0x35, 0x24, 0x90, 0xBA, 0xAB, 0x19, 0x81, 0xDB, 0xAB, 0x30, 0x34, 0xC8, 0xBD, 0x0A,
+  0x21, 0x81, 0xAA, 0x59, 0x47, 0x43, 0x02, 0x98, 0xBC, 0x9A, 0x00, 0x80, 0xCB, 0x8A, 0x32, 0x13,
+  0xEC, 0xBB, 0x18, 0x11, 0x06, 0xEB, 0x37, 0x00, 0xA0, 0x9B, 0x75, 0x35, 0x23, 0x81, 0xCA, 0xBB,
+  0x0A, 0x01, 0xC9, 0xAB, 0x38, 0x24, 0xB0, 0xCE, 0x8A, 0x11, 0x80, 0xA9, 0x48, 0x57, 0x33, 0x13,
+  0xA0, 0xDC, 0x9A, 0x18, 0x81, 0xC9, 0x99, 0x32, 0x13, 0xFB, 0xAB, 0x18, 0x02, 0xA8, 0x9B, 0x74,
+  0x36, 0x12, 0x01, 0xC9, 0xCB, 0x09, 0x11, 0x90, 0xBA, 0x28, 0x24, 0xB8, 0xBF, 0x89, 0x21, 0x98,
+  0xCA, 0x41, 0x46, 0x33, 0x13, 0xA0, 0xBE, 0x9C, 0x21, 0x02, 0xBA, 0x8B, 0x43, 0x92, 0xCD, 0x9A,
+  0x01, 0x91, 0xAB, 0x2A, 0x57, 0x43, 0x22, 0x12, 0xFB, 0xBB, 0x28, 0x23, 0xB8, 0x9C, 0x30, 0x03,
+  0xCC, 0x9B, 0x10, 0x91, 0xAD, 0x08, 0x43, 0x35, 0x44, 0x24, 0xC0, 0xBD, 0x1A, 0x32, 0x90, 0x9C,
+  0x28, 0x13, 0xDA, 0x8B, 0x20, 0x90, 0xCA, 0x29, 0x10, 0x31, 0x77, 0x33, 0x91, 0xCD, 0x99, 0x11,
+  0x81, 0xA9, 0x11, 0x02, 0xDB, 0x8A, 0x22, 0xA8, 0x30, 0xF4, 0x37, 0x00, 0x8B, 0x02, 0xF1, 0x8B,
+  0x74, 0x15, 0x01, 0x98, 0xBB, 0xAA, 0x31, 0x21, 0xAA, 0x20, 0x92, 0xCF, 0x09, 0x13, 0xA9, 0x3A,
+  0x83, 0xFA, 0x3B, 0x55, 0x03, 0x11, 0x01, 0xFC, 0x9A, 0x20, 0x01, 0x01, 0x01, 0xBB, 0x9A, 0x90,
+  0x9D, 0x31, 0x04, 0xBC, 0x00, 0x70, 0x11, 0x25, 0x82, 0xAE, 0x89, 0x82, 0x2A, 0x42, 0xC0, 0x8A,
+  0x09, 0xAC, 0x10, 0x34, 0x10, 0x90, 0xA0, 0xDB, 0x8E, 0x21, 0x14, 0x10, 0x98, 0xCB, 0x0A, 0x30,
+  0x12, 0x13, 0x36, 0xDA, 0xBC, 0x99, 0x8B, 0x10, 0x87, 0x79, 0x11, 0x80, 0x42, 0xB8, 0xAC, 0x01,
+  0x8A, 0x00, 0xA2, 0x8E, 0xB8, 0xAA, 0x5A, 0x81, 0x07, 0x68, 0x98, 0x90, 0x20, 0xAD, 0x13, 0x11,
+  0x3A, 0xA5, 0x9B, 0x29, 0xE8, 0x10, 0x08, 0x89, 0x15, 0x8A, 0x00, 0xB0, 0x69, 0x81, 0x01, 0x22,
+  0x9B, 0x02, 0xC9, 0x0B, 0xC8, 0x8A, 0x09, 0xE9, 0x00, 0x4C, 0xC7, 0x60, 0x88, 0x06, 0x40, 0x00,
+  0x88, 0x01, 0x03, 0x8C, 0x90, 0xA9, 0x49, 0xC8, 0x20, 0x90, 0x89, 0x82, 0x9C, 0x01, 0x80, 0x50,
+  0x91, 0x08, 0x11, 0x80, 0x21, 0x89, 0x10, 0x92, 0x8B, 0x21, 0xBD, 0x81, 0xA9, 0xAF, 0xB0, 0x11,
+  0x0C, 0x08, 0x08, 0x88, 0x63, 0x80, 0x90, 0x25, 0x9C, 0xC0, 0xBA, 0xB9, 0x1B, 0xBD, 0xC1, 0x0B,
+  0x99, 0x03, 0x08, 0x1D, 0x92, 0x64, 0x80, 0x80, 0x80, 0x73, 0x08, 0x05, 0x08, 0x08, 0x08, 0x90,
+  0x8F, 0xA2, 0x08, 0x88, 0x80, 0x80, 0x3A, 0xCF, 0x00, 0x08, 0x29, 0x17, 0x29, 0x14, 0x04, 0x33,
+  0x14, 0x34, 0x31, 0x83, 0xC0, 0x0C, 0xCA, 0xC0, 0x8A, 0x8D, 0xAB, 0xA1, 0x0D, 0x08, 0x48, 0x02,
+  0x06, 0x31, 0x13, 0x42, 0x40, 0x81, 0x00, 0x08, 0xC0, 0xAD, 0xBB, 0xCC, 0xAA, 0x0B, 0xBC, 0x80,
+  0x08, 0x90, 0x37, 0x08, 0x59, 0x83, 0x88, 0x35, 0x88, 0x80, 0x00, 0x08, 0xFC, 0x88, 0x00, 0x9E,
+  0x30, 0xFF, 0x20, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x73, 0x85, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x18, 0x7D, 0x67, 0x08, 0x08, 0x08, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x90, 0x71, 0x9A, 0x80, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x10,
+  0x7B, 0xFF, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x80, 0xDF, 0x80, 0x00, 0x08, 0x08, 0xEC, 0x08, 0x80,
+  0x80, 0x08, 0x80, 0x80, 0xDF, 0x00, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08,
+  0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x6F, 0xA7, 0x98, 0x17, 0x21,
+  0x29, 0xE3, 0xF7, 0x67, 0x2F, 0xB1, 0x5A, 0xA8, 0x82, 0x2C, 0xB5, 0x20, 0x1C, 0x80, 0xA0, 0xA1,
+  0x33, 0x39, 0x1C, 0xAA, 0x80, 0xB1, 0xA4, 0x28, 0x4B, 0xA0, 0x23, 0x0E, 0x02, 0x4B, 0x08, 0x28,
+  0x3D, 0x3B, 0xF1, 0x03, 0xA3, 0x04, 0x33, 0x00, 0x5C, 0x0A, 0xB1, 0x12, 0x2D, 0xD0, 0x02, 0x3B,
+  0x90, 0x09, 0xC6, 0x58, 0xAA, 0xA5, 0x08, 0xB2, 0x00, 0xB1, 0xB3, 0x40, 0xDA, 0x94, 0x49, 0x0B,
+  0xC4, 0x81, 0x20, 0x3F, 0xE1, 0x21, 0x9A, 0x41, 0x8D, 0xA4, 0x49, 0x99, 0x20, 0x9A, 0x94, 0x3A,
+  0xC0, 0x12, 0x8B, 0x93, 0x09, 0xA2, 0x20, 0x4D, 0x8A, 0xA3, 0x28, 0x1A, 0xF1, 0x84, 0x2B, 0x80,
+  0x89, 0x83, 0x5F, 0xA9, 0x03, 0x1B, 0x11, 0x3D, 0xD0, 0x22, 0x1D, 0xB2, 0x21, 0x0C, 0x82, 0x4B,
+  0xD1, 0x31, 0x1E, 0xA1, 0x10, 0x98, 0x02, 0x3D, 0xE1, 0x12, 0x0A, 0x81, 0x5B, 0xD0, 0x83, 0x2A,
+  0x88, 0x90, 0xA2, 0x11, 0x3C, 0xA9, 0xA4, 0x49, 0xB8, 0x32, 0x0F, 0xC4, 0x30, 0x1C, 0x91, 0x08,
+  0xA0, 0x12, 0x2E, 0xC1, 0x02, 0x09, 0x18, 0x8A, 0xB3, 0x6A, 0x8A, 0x92, 0x88, 0x90, 0x01, 0x08,
+  0x38, 0x1F, 0xC1, 0x10, 0x1B, 0x28, 0x2F, 0xC0, 0xAC, 0xFC, 0x2E, 0x00, 0x93, 0x5C, 0x89, 0x91,
+  0x01, 0xA8, 0x94, 0x4C, 0xA8, 0x83, 0x4A, 0xAA, 0xB4, 0x48, 0x8B, 0xB2, 0x40, 0x0C, 0x01, 0x5A,
+  0xC8, 0x85, 0x4A, 0x99, 0xA3, 0x20, 0x89, 0x11, 0x09, 0xF2, 0x81, 0x2F, 0xAA, 0xA4, 0x3A, 0xA9,
+  0x14, 0x49, 0xC3, 0x06, 0x6A, 0x88, 0x92, 0x00, 0x98, 0x80, 0x1B, 0xEB, 0xB1, 0x2B, 0x0E, 0xA8,
+  0x00, 0x88, 0x21, 0x70, 0x21, 0x25, 0x24, 0x23, 0x32, 0x01, 0xB9, 0xFB, 0xBC, 0x9E, 0xDA, 0x98,
+  0x1C, 0x9A, 0x92, 0x58, 0x21, 0x34, 0x63, 0x21, 0x13, 0x21, 0x99, 0xF0, 0x8A, 0x9E, 0xB9, 0xB0,
+  0x1A, 0x8C, 0x90, 0x10, 0x39, 0x02, 0x27, 0x62, 0x21, 0x13, 0x03, 0x01, 0x99, 0xBD, 0xEB, 0xBA,
+  0xAA, 0x8B, 0xAA, 0x90, 0x18, 0x49, 0x20, 0x24, 0x36, 0x63, 0x42, 0x21, 0x03, 0x20, 0x0C, 0xAD,
+  0xDA, 0xAA, 0xAA, 0x9A, 0x0A, 0xA9, 0x92, 0x82, 0x34, 0x70, 0x42, 0x15, 0x8A, 0x03, 0x3A, 0x00,
+  0x14, 0x32, 0x38, 0xA1, 0xC0, 0xCB, 0x9D, 0x9C, 0xAA, 0x99, 0xB8, 0x81, 0x1A, 0x01, 0x72, 0x40,
+  0x23, 0x17, 0x42, 0x20, 0x01, 0x01, 0x8B, 0xCD, 0xC9, 0x9A, 0x9B, 0x9A, 0x9A, 0xB9, 0xB1, 0x6C,
+  0x39, 0x06, 0x34, 0x60, 0x10, 0x83, 0x11, 0x98, 0xC9, 0xBB, 0x9D, 0xB9, 0xA0, 0x8B, 0x9C, 0xC8,
+  0x08, 0x1C, 0xA2, 0x27, 0x71, 0x30, 0x02, 0x03, 0x10, 0xB8, 0xC9, 0x8D, 0x9C, 0xB0, 0x80, 0x0B,
+  0xBB, 0xD0, 0x89, 0x8A, 0x92, 0x36, 0x73, 0x32, 0x14, 0x12, 0x10, 0xB8, 0xD8, 0xAB, 0xAD, 0xA8,
+  0x90, 0x0A, 0x9D, 0xC9, 0xA0, 0x09, 0x20, 0x73, 0x62, 0x22, 0x14, 0x21, 0x08, 0xA0, 0xB9, 0x9E,
+  0xAB, 0xB8, 0x88, 0x0C, 0xAC, 0xE0, 0x90, 0x1A, 0x00, 0x53, 0x53, 0x24, 0x14, 0x21, 0x08, 0x90,
+  0xB9, 0x9E, 0xBB, 0xA8, 0x89, 0x9B, 0xEB, 0xB8, 0x0A, 0x0C, 0x82, 0x35, 0x64, 0x23, 0x24, 0x21,
+  0x7B, 0x25, 0x3B, 0x00, 0x00, 0x88, 0xAB, 0xBE, 0xCA, 0x89, 0x0A, 0xAA, 0xD9, 0x99, 0x8B, 0xAA,
+  0x12, 0x73, 0x44, 0x25, 0x33, 0x11, 0x81, 0x91, 0xAB, 0xBE, 0xCB, 0x8A, 0x8B, 0xAA, 0xD9, 0xB8,
+  0x9A, 0x8B, 0x20, 0x64, 0x44, 0x34, 0x24, 0x21, 0x80, 0x80, 0xAB, 0xCD, 0xBA, 0x9A, 0x9A, 0xB9,
+  0xE8, 0x89, 0x8C, 0x89, 0x28, 0x43, 0x37, 0x63, 0x31, 0x01, 0x81, 0x80, 0xAB, 0xDC, 0xB9, 0x8A,
+  0x9A, 0xA8, 0x9A, 0x9C, 0xAA, 0x1A, 0x29, 0x37, 0x46, 0x52, 0x22, 0x02, 0x00, 0x88, 0xBA, 0xDC,
+  0xB9, 0x8A, 0x8A, 0x9B, 0xBA, 0xD8, 0x8A, 0x8B, 0x93, 0x47, 0x53, 0x24, 0x14, 0x02, 0x00, 0x88,
+  0xD8, 0xB9, 0x9C, 0xAA, 0x99, 0xAA, 0xC9, 0x9A, 0xAB, 0xC8, 0x41, 0x61, 0x34, 0x35, 0x14, 0x22,
+  0x08, 0x90, 0xA9, 0xCC, 0xBB, 0xAB, 0xAA, 0xCB, 0xBA, 0xBB, 0xAC, 0xAA, 0x48, 0x35, 0x46, 0x43,
+  0x24, 0x21, 0x10, 0x80, 0x18, 0x20, 0x36, 0x00, 0xA8, 0xDB, 0xBB, 0xAC, 0xAB, 0xAC, 0xBB, 0xBA,
+  0xAC, 0x9A, 0x28, 0x45, 0x54, 0x53, 0x33, 0x22, 0x12, 0x01, 0xB8, 0xCC, 0xCB, 0xCB, 0xBA, 0xBA,
+  0xAB, 0xBA, 0xA9, 0x9A, 0x20, 0x47, 0x44, 0x34, 0x34, 0x22, 0x12, 0x10, 0xA9, 0xCC, 0xCB, 0xBA,
+  0xAC, 0xBA, 0xAA, 0xAA, 0xBA, 0x89, 0x38, 0x46, 0x45, 0x53, 0x33, 0x22, 0x12, 0x11, 0xA9, 0xDB,
+  0xAC, 0xAC, 0xBB, 0xBB, 0xCB, 0xAA, 0xAB, 0x99, 0x28, 0x55, 0x44, 0x34, 0x34, 0x23, 0x12, 0x11,
+  0xA8, 0xCB, 0xCC, 0xCA, 0xBA, 0xBB, 0xCB, 0xBA, 0xAB, 0x9A, 0x29, 0x73, 0x44, 0x34, 0x25, 0x13,
+  0x22, 0x01, 0x90, 0xCA, 0xCB, 0xCB, 0xCB, 0xBB, 0xBB, 0xBB, 0xAC, 0x99, 0x08, 0x53, 0x54, 0x44,
+  0x33, 0x33, 0x22, 0x22, 0x88, 0xCA, 0xBD, 0xCB, 0xCB, 0xBB, 0xBB, 0xAC, 0xAA, 0x9A, 0x08, 0x52,
+  0x44, 0x35, 0x34, 0x24, 0x12, 0x12, 0x00, 0xA9, 0xBC, 0x1D, 0x33, 0x00, 0xBC, 0xCC, 0xCA, 0xBA,
+  0xBB, 0xBA, 0xBB, 0x9A, 0x09, 0x42, 0x45, 0x35, 0x35, 0x33, 0x33, 0x23, 0x01, 0x98, 0xCC, 0xCB,
+  0xBC, 0xCB, 0xAB, 0xBB, 0xBB, 0x9B, 0x8A, 0x30, 0x44, 0x46, 0x43, 0x34, 0x32, 0x23, 0x12, 0x80,
+  0xA9, 0xCC, 0xBC, 0xBC, 0xAC, 0xBB, 0xBB, 0xAB, 0xAA, 0x08, 0x31, 0x55, 0x44, 0x53, 0x23, 0x43,
+  0x12, 0x11, 0x90, 0xAA, 0xEB, 0xCA, 0xBB, 0xBC, 0xBA, 0xBB, 0xAB, 0x99, 0x00, 0x52, 0x63, 0x53,
+  0x43, 0x43, 0x32, 0x12, 0x11, 0x98, 0xBA, 0xBD, 0xBC, 0xBD, 0xBB, 0xAB, 0xBB, 0xA9, 0x98, 0x20,
+  0x52, 0x44, 0x44, 0x43, 0x42, 0x22, 0x22, 0x02, 0x99, 0xD1, 0x0C, 0xCB, 0xAA, 0xBC, 0xFB, 0x09,
+  0x90, 0x8A, 0x20, 0x01, 0x42, 0x33, 0x43, 0x53, 0x12, 0x12, 0x12, 0x08, 0x89, 0xFA, 0x9A, 0xDB,
+  0xBA, 0xBA, 0xCB, 0x8A, 0xA9, 0x88, 0x21, 0x22, 0x64, 0x22, 0x24, 0x42, 0xB0, 0x00, 0x2B, 0x00,
+  0x12, 0x23, 0x80, 0x02, 0x9A, 0xAC, 0xFB, 0x9B, 0xDA, 0x8A, 0xAA, 0xAA, 0x98, 0x08, 0x39, 0x42,
+  0x33, 0x36, 0x22, 0x43, 0x33, 0x84, 0x41, 0x08, 0xC8, 0x09, 0xD8, 0x08, 0xC9, 0xA8, 0x0B, 0x8D,
+  0xC1, 0x75, 0x01, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80,
+  0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // fifteen
+  0x18, 0x00, 0x00, 0x00, 0x70, 0xC7, 0x37, 0x3F, 0xF1, 0x01, 0x0B, 0x4A, 0xCB, 0x93, 0x8A, 0x5B,
+  0xC9, 0x38, 0xC0, 0x28, 0x18, 0x0C, 0xC4, 0x38, 0xA9, 0x40, 0xAA, 0x81, 0x10, 0x0F, 0xA3, 0x3C,
+  0xA9, 0x02, 0x3B, 0xDA, 0x52, 0x9B, 0x24, 0x1D, 0x08, 0xB4, 0x60, 0x0A, 0xB2, 0x21, 0x29, 0x00,
+  0x8B, 0x84, 0x80, 0x80, 0x70, 0x99, 0x10, 0x24, 0x88, 0x80, 0x90, 0x73, 0x83, 0x00, 0x39, 0x97,
+  0x03, 0x18, 0x2F, 0xB4, 0x10, 0x93, 0x8A, 0xD5, 0x31, 0x09, 0x00, 0x8A, 0x83, 0x88, 0x87, 0x1A,
+  0x50, 0x1C, 0x83, 0x08, 0x08, 0xF0, 0x38, 0xD1, 0x30, 0xAC, 0x82, 0x89, 0x39, 0xB9, 0xD3, 0xB3,
+  0x5B, 0x2D, 0xD2, 0x08, 0x29, 0x0D, 0xA3, 0x0B, 0x95, 0x0A, 0xB8, 0x31, 0xEA, 0x09, 0xD4, 0x4A,
+  0xB8, 0x01, 0xC0, 0x39, 0xB9, 0x82, 0xF9, 0xA3, 0x28, 0x8A, 0x80, 0xD0, 0x33, 0x8D, 0xC3, 0xC0,
+  0x04, 0x3C, 0xA8, 0x30, 0xAC, 0xFC, 0x21, 0x00, 0x98, 0xB2, 0xA4, 0x6B, 0x98, 0x83, 0x80, 0x3B,
+  0x91, 0x06, 0x80, 0x68, 0x08, 0xC9, 0x87, 0x4B, 0xB1, 0x31, 0x9B, 0x14, 0x9A, 0x03, 0x39, 0xA4,
+  0x5A, 0xE1, 0x78, 0xA8, 0x83, 0x2A, 0x08, 0x80, 0x02, 0x2A, 0xD3, 0x42, 0xAB, 0x95, 0x31, 0x8A,
+  0x14, 0x9C, 0x04, 0x8B, 0x95, 0x5A, 0xA9, 0x93, 0x08, 0x99, 0x31, 0x0B, 0x7B, 0xF1, 0x30, 0x8B,
+  0x03, 0x8A, 0x1B, 0x18, 0xAE, 0xA6, 0x6D, 0x98, 0xA3, 0x38, 0x0C, 0xD1, 0x28, 0x8A, 0x30, 0xF0,
+  0x30, 0x8E, 0x82, 0x08, 0x80, 0x49, 0xA9, 0x02, 0x1C, 0x19, 0xD1, 0x22, 0x8F, 0xB4, 0x4A, 0xB1,
+  0x6B, 0xB0, 0x21, 0x1B, 0x91, 0x11, 0x29, 0x2A, 0xD3, 0x51, 0x0B, 0x91, 0xB8, 0x2C, 0xDA, 0x98,
+  0xAB, 0x0C, 0xFA, 0x81, 0x7A, 0x00, 0x16, 0x43, 0x31, 0x91, 0xA2, 0x9B, 0xBB, 0xAF, 0xBA, 0xBD,
+  0xE0, 0x1A, 0x9D, 0xD3, 0x48, 0x01, 0x45, 0x13, 0x38, 0x23, 0x43, 0x00, 0x23, 0x99, 0xB8, 0x9C,
+  0xAA, 0x8C, 0xA1, 0x58, 0x88, 0x88, 0xCC, 0xB9, 0x9C, 0x1A, 0xC9, 0x37, 0x58, 0x23, 0x23, 0x91,
+  0x99, 0xCB, 0x99, 0xAA, 0x89, 0x89, 0x81, 0x08, 0xDA, 0x0D, 0xEB, 0x90, 0x0E, 0xC0, 0x52, 0x18,
+  0x34, 0x32, 0x03, 0x8A, 0xE9, 0x09, 0xAA, 0x08, 0x8B, 0x91, 0x1A, 0xC8, 0xAA, 0xE8, 0x0B, 0xEA,
+  0x38, 0x8E, 0x86, 0x40, 0x22, 0x32, 0x90, 0x88, 0xAC, 0xA0, 0x8B, 0xA9, 0x1A, 0xAA, 0xA5, 0x1A,
+  0xCA, 0x99, 0xCC, 0xA0, 0x2D, 0x0A, 0x07, 0x62, 0x42, 0x21, 0x90, 0xA8, 0x8A, 0x9A, 0xA9, 0xB8,
+  0x2A, 0x9B, 0xA5, 0x8A, 0x9C, 0xBD, 0xC0, 0x1C, 0xB9, 0x82, 0x36, 0x72, 0x53, 0x12, 0x81, 0x89,
+  0xAB, 0xA8, 0xAA, 0x99, 0x8B, 0xB1, 0x00, 0xCA, 0x0F, 0xEA, 0x90, 0x0B, 0xB0, 0x21, 0x79, 0x04,
+  0x45, 0x32, 0x11, 0x99, 0xC8, 0x99, 0xAA, 0xB9, 0x9A, 0x1B, 0x98, 0xB0, 0x91, 0xF7, 0x32, 0x00,
+  0xD0, 0x0D, 0xFB, 0x80, 0x1B, 0xA1, 0x14, 0x71, 0x30, 0x17, 0x22, 0x08, 0x99, 0xA9, 0x9A, 0x9C,
+  0xBB, 0xA0, 0x2A, 0xA0, 0x10, 0xFA, 0x88, 0x8F, 0xA0, 0x29, 0x80, 0x23, 0x70, 0x13, 0x37, 0x22,
+  0x81, 0x99, 0xB9, 0xAA, 0xBD, 0xBA, 0x9B, 0x88, 0x10, 0x98, 0x91, 0xAF, 0xD8, 0x89, 0x18, 0x21,
+  0x82, 0x44, 0x54, 0x54, 0x23, 0x12, 0x98, 0xA9, 0xBB, 0xDB, 0xAC, 0xBA, 0x08, 0x0A, 0x83, 0x2A,
+  0xF8, 0x99, 0xBB, 0x20, 0x49, 0x96, 0x50, 0x29, 0x16, 0x43, 0x23, 0x11, 0x88, 0xAA, 0xCB, 0xAD,
+  0xCB, 0x9A, 0x99, 0x10, 0x08, 0xB1, 0x9A, 0x9F, 0x88, 0x18, 0x13, 0x62, 0x38, 0x43, 0x27, 0x61,
+  0x01, 0x02, 0x19, 0xB9, 0xAA, 0xBD, 0xAB, 0xCB, 0x99, 0x19, 0xA8, 0xB3, 0x1B, 0xBC, 0x08, 0x82,
+  0x64, 0x02, 0x52, 0x12, 0x45, 0x01, 0x24, 0x00, 0x04, 0x0A, 0xE1, 0x0A, 0xDA, 0x09, 0xCB, 0x81,
+  0x39, 0xF8, 0x39, 0x00, 0x8C, 0x90, 0x8B, 0xA2, 0x4B, 0xA0, 0x21, 0x03, 0x73, 0x10, 0x14, 0x20,
+  0x03, 0x31, 0x92, 0x22, 0x08, 0x32, 0xBA, 0xD4, 0x8D, 0xB9, 0xC8, 0x99, 0x9F, 0xC8, 0x0A, 0xD0,
+  0x39, 0xB9, 0x41, 0x8A, 0x43, 0x89, 0x07, 0x28, 0x01, 0x30, 0x28, 0x14, 0x29, 0x91, 0x28, 0x81,
+  0xA1, 0x01, 0xF2, 0x2A, 0x9C, 0x92, 0xAA, 0x00, 0xAD, 0xA8, 0x0B, 0x0F, 0xB0, 0x9A, 0x0B, 0x8F,
+  0x03, 0x3B, 0xB4, 0x68, 0xC0, 0x52, 0x9B, 0x86, 0x19, 0x18, 0x08, 0x93, 0x20, 0x1C, 0xA2, 0x80,
+  0x80, 0x19, 0x8B, 0xF1, 0x49, 0x9C, 0x08, 0xC1, 0x2A, 0xFB, 0xB2, 0x09, 0xA9, 0x3C, 0xF0, 0x11,
+  0x0A, 0x03, 0x0A, 0x12, 0x4A, 0x80, 0x38, 0x29, 0x11, 0x5B, 0xC5, 0x58, 0xA8, 0x21, 0xA9, 0x92,
+  0x1C, 0xD1, 0x68, 0x8B, 0xA1, 0xA2, 0x58, 0x9B, 0xA7, 0x28, 0x0A, 0x01, 0xA1, 0x03, 0x1C, 0x05,
+  0x4A, 0x90, 0x30, 0xC0, 0x09, 0xFF, 0x24, 0x00, 0x14, 0x1A, 0x90, 0xB0, 0x61, 0x90, 0x10, 0x5C,
+  0xC9, 0x86, 0x19, 0x28, 0xB8, 0x11, 0xC2, 0x41, 0x08, 0x5D, 0xB8, 0x33, 0xCA, 0x15, 0x0E, 0x93,
+  0x2B, 0xC4, 0x39, 0xD0, 0x11, 0x09, 0x08, 0x90, 0x49, 0xBC, 0x07, 0x1C, 0x92, 0x2A, 0xB2, 0x38,
+  0x89, 0x01, 0x8B, 0xB4, 0x89, 0xB5, 0x2D, 0x90, 0x8A, 0x91, 0x4E, 0xD0, 0x12, 0x9B, 0x83, 0x89,
+  0xA4, 0x3A, 0xB9, 0xA4, 0xA3, 0x4B, 0x18, 0xAA, 0x07, 0x8B, 0xA6, 0x4D, 0xA8, 0x00, 0xD2, 0x30,
+  0x1C, 0x81, 0x09, 0xA3, 0x4C, 0xB8, 0x38, 0xC4, 0x39, 0x88, 0x39, 0xF2, 0x40, 0x89, 0x11, 0x0C,
+  0x80, 0x94, 0x18, 0xA0, 0x20, 0x38, 0x0F, 0xB4, 0x30, 0xD0, 0x03, 0x3B, 0xC3, 0x28, 0x38, 0xC9,
+  0x24, 0x3C, 0xC9, 0x97, 0x2A, 0xC3, 0x38, 0xC8, 0x83, 0x3A, 0x3B, 0xD1, 0x50, 0xC9, 0x95, 0x29,
+  0x98, 0x38, 0xC1, 0x00, 0xC2, 0x30, 0x0A, 0x80, 0xCA, 0x02, 0x26, 0x00, 0xA9, 0xB6, 0x40, 0x1C,
+  0xE1, 0x21, 0x1D, 0x80, 0x88, 0x11, 0x8C, 0x11, 0x89, 0xA0, 0x84, 0x2E, 0x20, 0xCC, 0x97, 0x1A,
+  0x00, 0x90, 0x20, 0x0C, 0x90, 0x1A, 0x81, 0x4C, 0xA9, 0x01, 0x9B, 0x94, 0x20, 0xA0, 0x8B, 0x33,
+  0x0F, 0x11, 0xDA, 0x04, 0x0B, 0x95, 0x29, 0x9B, 0xB7, 0x30, 0x2B, 0xB8, 0x58, 0xB8, 0x11, 0x3A,
+  0x4E, 0x18, 0x89, 0xA3, 0x60, 0x9A, 0xA2, 0x01, 0x38, 0x05, 0x2E, 0x1A, 0xF3, 0x71, 0x1C, 0xB1,
+  0x11, 0x2A, 0xB1, 0x94, 0x3A, 0x19, 0xC0, 0x04, 0x4B, 0x4A, 0xAA, 0x12, 0x3D, 0x08, 0x90, 0xB2,
+  0xA2, 0x70, 0xF3, 0x01, 0x0A, 0x7B, 0x89, 0x82, 0x8A, 0xB5, 0x08, 0x21, 0x2F, 0x91, 0x1A, 0xD2,
+  0x21, 0x1B, 0x08, 0xA1, 0x00, 0x08, 0x4F, 0xC8, 0x94, 0x49, 0xBA, 0x96, 0x29, 0x99, 0xA3, 0x18,
+  0x09, 0x08, 0xA0, 0x10, 0x0A, 0x91, 0xA1, 0x10, 0x0B, 0x08, 0x80, 0x80, 0xFB, 0xFD, 0x1B, 0x00,
+  0x9F, 0x80, 0x08, 0x0C, 0xF3, 0x18, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xD3, 0x74, 0x80,
+  0x80, 0x08, 0x08, 0x08, 0x80, 0x80, 0x79, 0x05, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x7A, 0x07,
+  0x80, 0x80, 0x00, 0x08, 0x98, 0x57, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x39, 0x47, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x91, 0x79, 0xFF, 0x9F, 0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80,
+  0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1A, 0xF7, 0xAF, 0x9E, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x90, 0x79, 0xB7, 0x07, 0x3D, 0x82, 0x0C, 0xB0,
+  0x80, 0x80, 0x20, 0xB8, 0x81, 0x80, 0x68, 0xA9, 0x80, 0x80, 0x90, 0x15, 0x0D, 0x79, 0xE2, 0x00,
+  0x0E, 0xFF, 0x1E, 0x00, 0x88, 0x23, 0x91, 0x61, 0x8A, 0xA2, 0x83, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x38, 0xBF, 0xC6, 0x12, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x7A, 0xFF, 0xA3, 0x0D,
+  0x80, 0x08, 0x08, 0x80, 0x08, 0xB3, 0x78, 0x30, 0xAC, 0x86, 0x8B, 0x95, 0x39, 0x8C, 0x80, 0x10,
+  0x0A, 0x08, 0x08, 0x88, 0x80, 0xB1, 0x77, 0x39, 0x92, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x91,
+  0x7B, 0x2F, 0xF7, 0x07, 0x5A, 0x0D, 0x20, 0x8C, 0xF5, 0x04, 0x1D, 0x92, 0x6B, 0x98, 0x83, 0xAB,
+  0x84, 0x3C, 0xC1, 0x28, 0xA9, 0x23, 0x1D, 0x92, 0x19, 0xA2, 0x48, 0xA9, 0x02, 0x8C, 0x81, 0x2A,
+  0xA1, 0x23, 0x1D, 0xD4, 0x01, 0xB0, 0x03, 0x8C, 0xB5, 0x18, 0xD2, 0x30, 0xAB, 0x96, 0x09, 0xB3,
+  0x7B, 0xA9, 0x94, 0x19, 0x90, 0x28, 0xB0, 0x22, 0x9B, 0xA5, 0x98, 0xA5, 0x49, 0x0A, 0x18, 0xD1,
+  0x03, 0x2D, 0x08, 0x3A, 0xD3, 0xFD, 0x34, 0x00, 0xD0, 0x83, 0x39, 0x0A, 0x49, 0xD9, 0xA6, 0x38,
+  0x2B, 0x90, 0x28, 0xC8, 0x33, 0x2F, 0x88, 0x19, 0xC2, 0x21, 0x3C, 0x89, 0x91, 0xC3, 0x31, 0x0C,
+  0x20, 0x9A, 0x95, 0x2A, 0x21, 0x2F, 0xB1, 0x20, 0xD0, 0x94, 0x39, 0x9A, 0x21, 0xBA, 0x97, 0x5A,
+  0x0A, 0x91, 0x28, 0x8B, 0xB7, 0x58, 0x9A, 0x82, 0x4B, 0xC0, 0x02, 0x19, 0x2A, 0xB8, 0x82, 0x3B,
+  0xF3, 0x30, 0x1F, 0x91, 0x18, 0x90, 0x90, 0x82, 0x2C, 0xB9, 0x01, 0x0D, 0xC3, 0x59, 0x8A, 0xB3,
+  0x30, 0x8C, 0xE3, 0x00, 0x09, 0x09, 0x00, 0xC8, 0x04, 0x29, 0x21, 0x10, 0xA3, 0x87, 0x20, 0x3B,
+  0x1C, 0xE9, 0xC1, 0x8A, 0xBA, 0x9C, 0xBC, 0xDA, 0x9A, 0x1B, 0x73, 0x63, 0x24, 0x25, 0x32, 0x31,
+  0x92, 0xB8, 0xCD, 0xDB, 0xBB, 0xEA, 0x99, 0x0C, 0xB8, 0x80, 0x38, 0x22, 0x47, 0x53, 0x22, 0x23,
+  0x14, 0x00, 0xAA, 0xEB, 0xAB, 0xAC, 0xB9, 0x88, 0xAF, 0xF0, 0x38, 0x00, 0x2A, 0x18, 0x82, 0x21,
+  0xE9, 0xF3, 0x2A, 0x1D, 0x90, 0x16, 0x32, 0x42, 0x32, 0x12, 0xA1, 0xD9, 0xBC, 0xAC, 0xBB, 0xA9,
+  0x88, 0x30, 0x50, 0x12, 0x83, 0xC2, 0x19, 0x9F, 0xCB, 0xB2, 0x51, 0x50, 0x22, 0x43, 0x22, 0x92,
+  0xB1, 0xAC, 0xAF, 0xC9, 0xA8, 0x89, 0x18, 0x30, 0x21, 0x84, 0x83, 0x09, 0xDC, 0xB9, 0x0C, 0x0A,
+  0x15, 0x44, 0x41, 0x23, 0x23, 0x10, 0xBB, 0xDC, 0xCB, 0xAB, 0xBB, 0x90, 0x20, 0x51, 0x22, 0x04,
+  0x11, 0x9B, 0xF9, 0xAA, 0x1C, 0x0A, 0x15, 0x34, 0x53, 0x13, 0x33, 0x00, 0xBB, 0xDD, 0xBA, 0xBB,
+  0xAB, 0x89, 0x01, 0x25, 0x42, 0x12, 0x01, 0x9A, 0xFA, 0xAA, 0x1D, 0x0A, 0x04, 0x35, 0x42, 0x32,
+  0x33, 0x01, 0xD9, 0xDA, 0xBA, 0x9D, 0xAA, 0xA0, 0x11, 0x21, 0x33, 0x23, 0x20, 0xF9, 0xD0, 0x0B,
+  0x0F, 0x98, 0x83, 0x62, 0x21, 0x23, 0x33, 0x11, 0xB8, 0xEB, 0xAC, 0xBB, 0x4A, 0xFC, 0x3C, 0x00,
+  0xCA, 0x89, 0x19, 0x21, 0x33, 0x61, 0x80, 0xB1, 0x9A, 0xBF, 0xC9, 0x80, 0x5A, 0x30, 0x25, 0x33,
+  0x34, 0x12, 0x91, 0xAB, 0xAF, 0xDB, 0xB8, 0x89, 0x2A, 0x08, 0x05, 0x22, 0x20, 0x09, 0xD9, 0xC8,
+  0x0D, 0x9B, 0xA1, 0x43, 0x71, 0x12, 0x24, 0x31, 0x10, 0xA9, 0xDA, 0xAB, 0x9E, 0xB9, 0xB2, 0x30,
+  0x6A, 0x10, 0x82, 0x82, 0x88, 0x9C, 0xEA, 0xA9, 0x88, 0x29, 0x24, 0x26, 0x43, 0x23, 0x14, 0x00,
+  0xAA, 0xEB, 0xC9, 0x9A, 0x0C, 0x99, 0x92, 0x23, 0x50, 0x18, 0x81, 0xA0, 0xAB, 0xEC, 0x99, 0x0A,
+  0x39, 0x43, 0x27, 0x42, 0x32, 0x22, 0x81, 0xAA, 0xCD, 0xBB, 0xBB, 0xAB, 0x8A, 0x81, 0x24, 0x33,
+  0x41, 0x88, 0xD8, 0xBB, 0xAF, 0xC9, 0x90, 0x30, 0x72, 0x42, 0x23, 0x24, 0x12, 0x90, 0xBA, 0xAE,
+  0xAC, 0xBA, 0xA8, 0x18, 0x39, 0x12, 0x85, 0x02, 0x89, 0xCB, 0xAC, 0x8F, 0x99, 0x91, 0x24, 0x73,
+  0x53, 0xF9, 0x3E, 0x00, 0x41, 0x21, 0x13, 0x11, 0x99, 0xDB, 0xCB, 0xAB, 0xAB, 0x99, 0x00, 0x41,
+  0x21, 0x13, 0x02, 0xA9, 0xFC, 0xB9, 0x0D, 0x1B, 0x80, 0x17, 0x53, 0x41, 0x21, 0x03, 0x02, 0xA9,
+  0xCC, 0xBB, 0x9D, 0xAA, 0x98, 0x10, 0x40, 0x20, 0x12, 0x82, 0x99, 0xBD, 0xCB, 0x8C, 0x1B, 0x01,
+  0x27, 0x45, 0x41, 0x31, 0x11, 0x92, 0xB8, 0xAE, 0xCB, 0xAA, 0x9A, 0x89, 0x00, 0x42, 0x11, 0x02,
+  0x91, 0xCA, 0xBC, 0x9D, 0x9C, 0x08, 0x21, 0x27, 0x25, 0x43, 0x31, 0x11, 0xA1, 0xE8, 0xBA, 0xAC,
+  0xAB, 0xBA, 0x90, 0x21, 0x51, 0x20, 0x00, 0xA8, 0xD8, 0xC8, 0xAA, 0x8D, 0x19, 0x40, 0x44, 0x34,
+  0x25, 0x21, 0xA4, 0x01, 0x9C, 0xCB, 0xCA, 0xB9, 0x90, 0x18, 0x30, 0x24, 0x23, 0x98, 0xDC, 0xDA,
+  0x80, 0x2A, 0x0F, 0x99, 0x83, 0x35, 0x61, 0x20, 0x02, 0x92, 0x01, 0x8A, 0xBC, 0xCB, 0xA9, 0x88,
+  0x18, 0x11, 0x11, 0x98, 0xB7, 0x00, 0x2B, 0x00, 0xCB, 0xAD, 0xBC, 0xD9, 0xB0, 0x19, 0x6B, 0x31,
+  0x27, 0x24, 0x33, 0x21, 0x80, 0x90, 0xC9, 0xDC, 0xBA, 0x8A, 0x88, 0x02, 0x03, 0x82, 0xA8, 0x8E,
+  0xBC, 0xC9, 0x9A, 0xBB, 0xB8, 0x31, 0x73, 0x37, 0x53, 0x12, 0x11, 0x00, 0x80, 0xC8, 0xAD, 0x9D,
+  0x89, 0x80, 0x11, 0x38, 0x08, 0xB8, 0xD9, 0xBB, 0xCB, 0x9B, 0x0F, 0x9A, 0xA2, 0x34, 0x64, 0x32,
+  0x22, 0x02, 0x23, 0x10, 0xCA, 0xDC, 0xA9, 0x89, 0x08, 0x00, 0x10, 0x89, 0xCB, 0xCB, 0xBC, 0xDB,
+  0xA9, 0x0C, 0x9D, 0xA0, 0x14, 0x73, 0x41, 0x12, 0x12, 0x33, 0x32, 0x89, 0xBC, 0xBA, 0x89, 0x0A,
+  0x08, 0x99, 0xD1, 0xAB, 0xAD, 0xBA, 0xDB, 0xC9, 0xCB, 0xCC, 0xAA, 0x08, 0x21, 0x45, 0x42, 0x43,
+  0x44, 0x23, 0x12, 0x08, 0x88, 0x99, 0xAB, 0xBB, 0x9C, 0xAA, 0x9A, 0x8A, 0xB9, 0xA1, 0xDB, 0xEF,
+  0xCC, 0xAB, 0xAB, 0x8A, 0x10, 0x43, 0x54, 0x44, 0x89, 0xFE, 0x39, 0x00, 0x33, 0x22, 0x12, 0x00,
+  0xA8, 0xBA, 0xAA, 0xAB, 0x9B, 0xBB, 0xA1, 0x0B, 0xE9, 0xBC, 0xDF, 0xBC, 0xBC, 0xBA, 0x9A, 0x80,
+  0x32, 0x65, 0x53, 0x23, 0x23, 0x12, 0x01, 0x98, 0xA9, 0xB9, 0xCA, 0xCA, 0x9A, 0xAA, 0xA9, 0xCB,
+  0xEB, 0xCC, 0xBC, 0xBA, 0x9A, 0x08, 0x30, 0x54, 0x54, 0x43, 0x33, 0x22, 0x12, 0x01, 0x98, 0x99,
+  0xBA, 0xBC, 0xCB, 0xBA, 0xBA, 0xBB, 0xAC, 0xCD, 0xCB, 0xBC, 0x9A, 0xBA, 0x99, 0x28, 0x73, 0x35,
+  0x44, 0x24, 0x23, 0x23, 0x23, 0x80, 0x88, 0xB9, 0xCB, 0xCC, 0xAB, 0xCB, 0xAB, 0xAB, 0xB9, 0xDB,
+  0xBB, 0xBB, 0xCB, 0xAE, 0x9A, 0x00, 0x43, 0x45, 0x44, 0x43, 0x33, 0x33, 0x02, 0x80, 0xA8, 0xBB,
+  0xBD, 0xCA, 0xBA, 0xBB, 0xBB, 0x9A, 0xCB, 0xAB, 0xBF, 0xDB, 0xCB, 0xAA, 0x89, 0x20, 0x44, 0x54,
+  0x43, 0x34, 0x32, 0x11, 0x81, 0x88, 0xA9, 0xAA, 0xBA, 0xDB, 0xA9, 0xAA, 0x2F, 0x04, 0x26, 0x00,
+  0x98, 0xAC, 0xDA, 0xBD, 0xCC, 0xBC, 0xBA, 0x9B, 0x18, 0x52, 0x25, 0x44, 0x34, 0x23, 0x13, 0x11,
+  0x91, 0x99, 0xA8, 0x9A, 0xCA, 0x9B, 0xDB, 0xBA, 0xDB, 0xBC, 0xBD, 0xCC, 0xCA, 0xAA, 0x8A, 0x18,
+  0x32, 0x45, 0x44, 0x43, 0x22, 0x12, 0x11, 0x90, 0x98, 0xA9, 0x89, 0xBA, 0x9B, 0xBC, 0xCA, 0xEB,
+  0xCA, 0xCC, 0xCB, 0xCB, 0xBB, 0xAA, 0x18, 0x22, 0x45, 0x45, 0x33, 0x33, 0x32, 0x12, 0x00, 0x08,
+  0x8A, 0x98, 0x9B, 0xB8, 0xBD, 0xB9, 0xDC, 0xBB, 0xDF, 0xAA, 0xCB, 0xAB, 0x9B, 0x00, 0x20, 0x46,
+  0x34, 0x34, 0x33, 0x23, 0x12, 0x01, 0x80, 0x90, 0xAA, 0xA8, 0xBA, 0xBB, 0xCD, 0xCA, 0xCC, 0xCC,
+  0xBC, 0xCB, 0xAB, 0x9A, 0x08, 0x21, 0x55, 0x24, 0x34, 0x22, 0x32, 0x11, 0x10, 0x81, 0x80, 0x8A,
+  0x80, 0xAB, 0x8C, 0xEB, 0xDB, 0xCC, 0xBC, 0xBC, 0xBB, 0xCB, 0x89, 0x08, 0x41, 0x44, 0x43, 0x33,
+  0x9B, 0xFE, 0x2F, 0x00, 0x42, 0x13, 0x21, 0x12, 0x21, 0x81, 0x80, 0x81, 0xBA, 0xC9, 0xCF, 0xCA,
+  0xBD, 0xCB, 0xAC, 0xAB, 0x9B, 0x98, 0x21, 0x53, 0x54, 0x23, 0x24, 0x23, 0x22, 0x13, 0x12, 0x21,
+  0x08, 0xB8, 0x99, 0xBC, 0xEB, 0xBD, 0xCC, 0xCB, 0xCB, 0xBA, 0xAB, 0x9A, 0x18, 0x32, 0x36, 0x44,
+  0x43, 0x33, 0x33, 0x22, 0x31, 0x81, 0x31, 0xC9, 0x9A, 0xEC, 0xAB, 0xFB, 0xAB, 0xCB, 0xAB, 0xBB,
+  0xAA, 0x89, 0x28, 0x33, 0x46, 0x43, 0x24, 0x32, 0x25, 0x21, 0x21, 0x00, 0x88, 0xAA, 0xCA, 0xAC,
+  0xBC, 0xBC, 0xCA, 0xAB, 0xCB, 0xAB, 0xA9, 0x08, 0x08, 0x35, 0x45, 0x33, 0x35, 0x33, 0x43, 0x22,
+  0x21, 0x82, 0x00, 0xCA, 0xB8, 0xBF, 0xAA, 0xAC, 0xAA, 0xBB, 0x8D, 0xAA, 0x00, 0x08, 0x38, 0x35,
+  0x36, 0x43, 0x24, 0x33, 0x14, 0x22, 0x88, 0x80, 0x00, 0xDB, 0xBB, 0xEA, 0x9A, 0xDA, 0x0A, 0xB9,
+  0xCB, 0x00, 0x08, 0x08, 0x00, 0xFE, 0x1C, 0x00, 0x08, 0x88, 0x37, 0x68, 0x01, 0x13, 0x42, 0x88,
+  0x34, 0x9D, 0x80, 0x00, 0xBC, 0xC1, 0x1B, 0xDB, 0x08, 0x18, 0xEB, 0x01, 0x0A, 0x40, 0xAA, 0x16,
+  0x08, 0x08, 0x88, 0x35, 0x88, 0x80, 0x80, 0x71, 0x82, 0x08, 0x08, 0x80, 0xC0, 0x8F, 0x80, 0x08,
+  0x08, 0x08, 0x80, 0x08, 0x80, 0x80, 0x90, 0x71, 0x27, 0x80, 0x80, 0x74, 0x80, 0x08, 0x08, 0x80,
+  0x18, 0xBF, 0x84, 0x0B, 0x08, 0x08, 0x08, 0xC0, 0x8F, 0x80, 0x08, 0x08, 0x08, 0x18, 0xFA, 0x68,
+  0xC9, 0x48, 0xB8, 0x80, 0x80, 0x80, 0xC1, 0x0D, 0x08, 0xD8, 0x02, 0x8D, 0x80, 0x80, 0x00, 0x88,
+  0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0xF3, 0x4B, 0x4A, 0x88, 0x00, 0x08, 0x08, 0x08, 0x88,
+  0x80, 0x80, 0x80, 0x80, 0x38, 0x7F, 0x77, 0x00, 0x80, 0x08, 0x08, 0x37, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0x67, 0x08, 0x88, 0x00, 0x08, 0x49, 0x06, 0x11, 0x01, 0x21, 0x00, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x91, 0x79, 0xFF, 0x9F, 0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x08, 0x19, 0xF8,
+  0xAF, 0x88, 0x00, 0x39, 0x27, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80,
+  0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // point
+  0xC1, 0xFF, 0x00, 0x00, 0xF0, 0xF4, 0x29, 0x17, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80,
+  0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 0x9F, 0x08,
+  0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x10,
+  0x7B, 0x55, 0x37, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x19, 0xF0, 0xFF,
+  0x8C, 0x80, 0x80, 0x00, 0x69, 0xA7, 0x38, 0x08, 0x08, 0x08, 0x08, 0x39, 0xE7, 0x7A, 0xA9, 0x28,
+  0x32, 0xE9, 0x16, 0x8B, 0x21, 0x98, 0x98, 0xD9, 0xBA, 0x8A, 0x12, 0x30, 0x81, 0x88, 0x53, 0x90,
+  0x74, 0x83, 0x8A, 0x08, 0x44, 0x02, 0x9A, 0x08, 0x23, 0xB0, 0x5C, 0xA1, 0xBC, 0x09, 0x24, 0xEA,
+  0x08, 0x90, 0x4B, 0x92, 0x00, 0x9D, 0xF8, 0x89, 0xC0, 0x0D, 0x20, 0xB8, 0x0B, 0xA8, 0x89, 0x72,
+  0x38, 0xE1, 0x8A, 0x43, 0xA4, 0xFD, 0x27, 0x00, 0x00, 0xF8, 0x09, 0x28, 0x33, 0xB1, 0x8C, 0x99,
+  0x12, 0x82, 0x50, 0xCA, 0x90, 0x42, 0x38, 0x01, 0x81, 0xC4, 0xB8, 0x31, 0x58, 0x14, 0x99, 0xAF,
+  0x60, 0xB0, 0x1B, 0x13, 0x22, 0xFB, 0x00, 0x10, 0x92, 0x2A, 0x47, 0x80, 0x8D, 0x0A, 0x01, 0x00,
+  0x78, 0x90, 0x8A, 0x03, 0x91, 0x98, 0x9A, 0x55, 0x02, 0x2B, 0x0B, 0xDF, 0x28, 0x35, 0x91, 0xDB,
+  0x09, 0x28, 0x21, 0x00, 0xE0, 0x9B, 0x32, 0x32, 0x98, 0xEB, 0x1B, 0x36, 0xA8, 0xBC, 0x90, 0x40,
+  0x25, 0xB8, 0xBC, 0x08, 0x30, 0x64, 0x88, 0xDA, 0x89, 0x22, 0x22, 0xB0, 0xCC, 0x18, 0x10, 0xA2,
+  0x08, 0x92, 0xBD, 0x49, 0x35, 0x98, 0x8C, 0x99, 0x12, 0x82, 0x12, 0xD1, 0x8C, 0x99, 0x2A, 0x47,
+  0xA8, 0xAA, 0x9B, 0x71, 0x22, 0xCA, 0x99, 0x12, 0x10, 0x31, 0x90, 0x9C, 0xBA, 0x71, 0x16, 0xA8,
+  0xBA, 0x09, 0x53, 0x01, 0xAB, 0xBA, 0x63, 0x03, 0x48, 0x00, 0x28, 0x00, 0x9A, 0x2B, 0x18, 0x00,
+  0x13, 0x23, 0x97, 0xA9, 0x88, 0x0A, 0x78, 0x34, 0x03, 0xF9, 0xAC, 0x38, 0x26, 0x91, 0xAB, 0x88,
+  0x00, 0x83, 0xA1, 0x38, 0x87, 0xCB, 0x1A, 0x51, 0x01, 0xB8, 0x8C, 0x89, 0x22, 0x24, 0xE3, 0xBD,
+  0x1A, 0x53, 0x12, 0xB8, 0x9A, 0x99, 0x48, 0x53, 0x12, 0xC8, 0xAC, 0x1A, 0x20, 0x92, 0x92, 0xDA,
+  0x8A, 0x0E, 0x19, 0x08, 0xA8, 0x82, 0x85, 0x09, 0xDA, 0x58, 0x11, 0x18, 0xB8, 0xE9, 0x8A, 0x32,
+  0x20, 0xFC, 0xAA, 0x21, 0x14, 0xAB, 0xAD, 0x43, 0x35, 0x82, 0xAA, 0x8A, 0x45, 0x23, 0x99, 0xBD,
+  0xAB, 0x80, 0x80, 0xFB, 0xBC, 0xB9, 0x09, 0x30, 0x73, 0x34, 0x24, 0x63, 0x44, 0x22, 0xA8, 0xCC,
+  0xAB, 0x09, 0x00, 0xDA, 0xBE, 0x9C, 0x19, 0x23, 0x23, 0x10, 0x53, 0x45, 0x33, 0x23, 0x00, 0xCA,
+  0xBC, 0x99, 0x09, 0x90, 0xFB, 0xCC, 0xBB, 0xAB, 0x0A, 0x53, 0x34, 0x22, 0x21, 0xF9, 0x38, 0x00,
+  0x80, 0x51, 0x47, 0x12, 0xA8, 0x9A, 0x09, 0xA0, 0xEB, 0x0A, 0x41, 0x01, 0xFB, 0xAD, 0x89, 0x30,
+  0x22, 0x81, 0x80, 0x10, 0x65, 0x24, 0x90, 0xAA, 0x09, 0x12, 0xEA, 0xAC, 0x28, 0x34, 0x91, 0xCE,
+  0x9B, 0x18, 0x22, 0x01, 0x89, 0x21, 0x33, 0x55, 0x14, 0xA0, 0xAA, 0x10, 0x82, 0xDE, 0x9B, 0x42,
+  0x14, 0xC8, 0xAC, 0x8A, 0x11, 0x01, 0x88, 0x28, 0x43, 0x11, 0x73, 0x33, 0xA0, 0xAC, 0x28, 0x82,
+  0xDD, 0x9B, 0x53, 0x13, 0xDA, 0xAC, 0x09, 0x11, 0x88, 0x08, 0x31, 0x13, 0x88, 0x76, 0x23, 0xB8,
+  0xAB, 0x41, 0x02, 0xCE, 0x8A, 0x52, 0x02, 0xCA, 0x9C, 0x00, 0x01, 0x9A, 0x18, 0x33, 0x92, 0x8A,
+  0x77, 0x13, 0xBA, 0x8B, 0x52, 0x81, 0xBD, 0x1A, 0x53, 0x91, 0xBC, 0x09, 0x11, 0xA9, 0x8C, 0x42,
+  0x81, 0xA8, 0x41, 0x46, 0x82, 0xCB, 0x19, 0x33, 0xC8, 0xBC, 0x30, 0x14, 0xBA, 0x8B, 0x02, 0xD8,
+  0x16, 0xEA, 0x42, 0x00, 0x9B, 0x10, 0x03, 0xBC, 0x58, 0x25, 0x33, 0x23, 0xEA, 0x0B, 0x32, 0xA1,
+  0xBD, 0x28, 0x04, 0xCB, 0x19, 0x92, 0xBC, 0x1A, 0xA1, 0xAC, 0x09, 0x72, 0x11, 0x73, 0x15, 0xB9,
+  0x1B, 0x33, 0xB8, 0x9B, 0x12, 0xB0, 0x9B, 0x02, 0xFA, 0x1A, 0x91, 0xCD, 0x2A, 0xA0, 0x9C, 0x35,
+  0x43, 0x45, 0x90, 0x8C, 0x21, 0x90, 0x89, 0x88, 0x8A, 0x00, 0xC9, 0x0B, 0x12, 0xDB, 0x29, 0xAC,
+  0xC9, 0x9B, 0x42, 0x40, 0x77, 0x82, 0x8B, 0x20, 0x98, 0x10, 0xB8, 0x8C, 0x03, 0xCB, 0x20, 0xA0,
+  0x1A, 0x22, 0xCE, 0x12, 0xEB, 0x1A, 0x90, 0x64, 0x14, 0x8A, 0x00, 0x98, 0x31, 0xD8, 0x1B, 0xB3,
+  0x8D, 0x13, 0xAC, 0x32, 0xB9, 0x30, 0x93, 0x9F, 0x89, 0xFB, 0x50, 0x13, 0x08, 0x81, 0x9A, 0x43,
+  0xB9, 0x19, 0xD0, 0x1A, 0x81, 0x8C, 0x14, 0x8B, 0x14, 0x2A, 0xB0, 0x9F, 0xE8, 0x1A, 0x34, 0x00,
+  0x84, 0x99, 0x32, 0x89, 0xAC, 0x0A, 0x3A, 0x00, 0xA2, 0x8B, 0x9A, 0x98, 0xA3, 0x68, 0x88, 0x23,
+  0x7C, 0xD2, 0x8A, 0xFA, 0x1B, 0x81, 0x42, 0x82, 0x18, 0x81, 0x23, 0x91, 0x28, 0xEC, 0x02, 0x2A,
+  0x20, 0xB0, 0x25, 0x2F, 0xC2, 0x9A, 0xE9, 0x8C, 0x90, 0x32, 0x12, 0x18, 0x01, 0x06, 0x12, 0x29,
+  0xCA, 0x82, 0x39, 0x10, 0x98, 0x22, 0x1F, 0xC6, 0x89, 0xDB, 0x9C, 0xA8, 0x22, 0x30, 0x81, 0x22,
+  0x26, 0x31, 0x80, 0x98, 0x88, 0x5A, 0xA2, 0x83, 0x28, 0x3F, 0xF2, 0x88, 0x9E, 0xAB, 0x99, 0x01,
+  0x32, 0x10, 0x41, 0x53, 0x23, 0x81, 0x88, 0x09, 0x10, 0x83, 0x82, 0x96, 0x6F, 0xBA, 0xB3, 0x8E,
+  0xBB, 0x98, 0x10, 0x22, 0x00, 0x14, 0x73, 0x12, 0x81, 0x98, 0x00, 0x28, 0x91, 0x22, 0xC0, 0x06,
+  0x1D, 0xEB, 0xC8, 0x8C, 0x99, 0x11, 0x21, 0x18, 0x03, 0x37, 0x30, 0x90, 0x90, 0x08, 0x80, 0x11,
+  0x28, 0xC3, 0x97, 0x2A, 0xBF, 0xF9, 0x89, 0x09, 0x84, 0xD9, 0x42, 0x00, 0x81, 0x02, 0x38, 0x30,
+  0x17, 0x12, 0x1A, 0xA9, 0xA3, 0x20, 0x1A, 0x02, 0x70, 0x89, 0xF1, 0xAA, 0x8F, 0x9A, 0x00, 0x38,
+  0x09, 0x83, 0x55, 0x20, 0x91, 0x80, 0x19, 0x88, 0x00, 0x29, 0x91, 0x07, 0x19, 0xAF, 0xEA, 0x99,
+  0x1A, 0x08, 0x92, 0x21, 0x70, 0x22, 0x84, 0x80, 0x1A, 0x88, 0x92, 0x80, 0x20, 0x79, 0x88, 0xF1,
+  0xAA, 0x8E, 0x9A, 0x81, 0x10, 0x08, 0x22, 0x26, 0x24, 0x08, 0x98, 0x80, 0x28, 0x0A, 0x18, 0x50,
+  0xA3, 0xD3, 0x9E, 0xBD, 0xA9, 0x89, 0x01, 0x20, 0x28, 0x37, 0x63, 0x00, 0xA0, 0x00, 0x1A, 0xA0,
+  0x92, 0x28, 0x43, 0x3A, 0xFB, 0xEB, 0x9C, 0xA9, 0x01, 0x28, 0x00, 0x53, 0x34, 0x15, 0x80, 0x99,
+  0x98, 0x88, 0x90, 0x19, 0x69, 0xA2, 0xA2, 0x8F, 0xBD, 0xB8, 0x09, 0x28, 0x20, 0x13, 0x37, 0x43,
+  0x02, 0xA0, 0xAA, 0x9B, 0x99, 0x90, 0x28, 0x7B, 0xB4, 0x92, 0x9F, 0xCA, 0xD5, 0xF2, 0x3A, 0x00,
+  0x99, 0x8A, 0x21, 0x30, 0x43, 0x45, 0x23, 0x11, 0xA9, 0xB9, 0xAB, 0xC9, 0x99, 0x89, 0x01, 0x92,
+  0x89, 0xBF, 0xCA, 0x9D, 0x89, 0x31, 0x43, 0x22, 0x34, 0x45, 0x23, 0x02, 0xBA, 0xDA, 0x8B, 0xCA,
+  0xCB, 0x9A, 0x19, 0x22, 0x32, 0x88, 0x32, 0x51, 0x27, 0x11, 0x00, 0x41, 0x01, 0xFA, 0xBD, 0xAA,
+  0x8A, 0x20, 0x42, 0x12, 0x43, 0x24, 0x13, 0x91, 0x18, 0x02, 0xBA, 0xBB, 0x29, 0x81, 0xFB, 0xBF,
+  0xAB, 0xAB, 0xBB, 0xAD, 0x89, 0x61, 0x53, 0x34, 0x24, 0x22, 0x01, 0x89, 0x99, 0xCC, 0xBB, 0xA9,
+  0xAA, 0xDA, 0xBC, 0xCA, 0x8A, 0x10, 0x32, 0x53, 0x45, 0x34, 0x23, 0x13, 0x01, 0x98, 0xDB, 0xCB,
+  0xBC, 0xBB, 0xBB, 0xAB, 0x08, 0x30, 0x34, 0x12, 0x21, 0x30, 0x92, 0xCE, 0xAA, 0x09, 0x63, 0x33,
+  0x34, 0x14, 0x12, 0xB8, 0xDC, 0xCC, 0x9B, 0x99, 0x10, 0x43, 0x54, 0x33, 0x43, 0x02, 0xDA, 0xCD,
+  0xE3, 0xFD, 0x32, 0x00, 0xBA, 0xAB, 0x89, 0x08, 0x32, 0x46, 0x33, 0x23, 0x02, 0x80, 0x90, 0xAA,
+  0xCC, 0xAB, 0x8A, 0x28, 0x21, 0x44, 0x53, 0x12, 0x21, 0xBA, 0xDD, 0xAB, 0xAA, 0x89, 0x00, 0x43,
+  0x34, 0x32, 0x23, 0x02, 0x0C, 0xCA, 0xBA, 0xCB, 0x9A, 0x8D, 0x28, 0x13, 0x35, 0x33, 0x32, 0x85,
+  0x08, 0x80, 0x9F, 0xC0, 0xA8, 0x0A, 0x88, 0x00, 0xEA, 0x30, 0x81, 0xDB, 0x80, 0x80, 0x80, 0x00,
+  0x39, 0x37, 0x88, 0x35, 0x80, 0x18, 0xFA, 0x09, 0xAC, 0x18, 0xDB, 0x08, 0x08, 0x70, 0x80, 0x32,
+  0x40, 0x92, 0x24, 0x80, 0x9D, 0x90, 0x8D, 0xC0, 0x09, 0x08, 0x48, 0x83, 0x68, 0x81, 0x80, 0x51,
+  0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x10, 0xFF, 0x80, 0x80, 0x00, 0x88, 0x00, 0xAF, 0x00, 0x08,
+  0x88, 0x00, 0x88, 0x80, 0x80, 0x00, 0x08, 0xF8, 0xAF, 0x08, 0xC0, 0x0E, 0x08, 0x08, 0x08, 0x88,
+  0x80, 0xE1, 0x0E, 0x08, 0xDD, 0xFD, 0x1C, 0x00, 0x08, 0x08, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0x80, 0x28, 0xAF, 0x86, 0x80, 0x08, 0x80, 0x80, 0x10, 0xBF, 0xFB, 0x0C, 0x27, 0x88, 0x80,
+  0x62, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x79, 0x05, 0x08, 0x88, 0x51, 0x29, 0x82, 0x80, 0x80,
+  0x38, 0x79, 0x85, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD0, 0x30, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xF7, 0xDF, 0x80, 0x08, 0x08,
+  0x80, 0xA0, 0xF7, 0x27, 0x7F, 0xF9, 0x21, 0x99, 0x02, 0x19, 0xB1, 0x1D, 0x83, 0x28, 0xB2, 0x2A,
+  0x98, 0x98, 0xF3, 0x10, 0xA9, 0x21, 0xD8, 0x23, 0x4B, 0x28, 0xC1, 0x10, 0xC0, 0x4A, 0xF1, 0x30,
+  0x9A, 0x03, 0x0C, 0x03, 0x5A, 0xC2, 0x18, 0x88, 0x81, 0x99, 0xB4, 0x3A, 0xDA, 0x12, 0x88, 0x13,
+  0x9A, 0xA3, 0xF3, 0x81, 0x29, 0x1B, 0xA9, 0xD3, 0x2B, 0xFF, 0x25, 0x00, 0x32, 0x1C, 0x31, 0x0D,
+  0xA2, 0x3F, 0xA0, 0x49, 0xC0, 0x28, 0x99, 0x79, 0x0B, 0x81, 0x91, 0x18, 0xA8, 0x59, 0xFB, 0x83,
+  0x1A, 0x92, 0x4C, 0x9A, 0x95, 0x4B, 0xD1, 0x58, 0xAA, 0x23, 0x0E, 0xB3, 0x18, 0xC4, 0x48, 0xAA,
+  0x03, 0x8A, 0x84, 0x3D, 0xC1, 0x30, 0xB9, 0x05, 0x0B, 0xA5, 0x3A, 0xA0, 0x59, 0xA9, 0x84, 0x1A,
+  0x92, 0x99, 0xA6, 0x28, 0x89, 0x91, 0xB3, 0x31, 0x2F, 0xA1, 0x10, 0xB2, 0x79, 0x0B, 0x81, 0x90,
+  0x30, 0x8C, 0x41, 0xD9, 0x04, 0x1C, 0x92, 0x39, 0xE2, 0x01, 0x1A, 0x90, 0x82, 0x11, 0xC0, 0x11,
+  0x9E, 0x04, 0xA9, 0xA4, 0x4B, 0xA8, 0x13, 0x0E, 0x90, 0x10, 0x90, 0x22, 0xEA, 0x41, 0xEA, 0x21,
+  0x0A, 0x02, 0x0C, 0xB4, 0x3C, 0xB2, 0x2C, 0xE3, 0x39, 0xA0, 0x80, 0xA0, 0x38, 0x9A, 0x05, 0x1B,
+  0x89, 0x19, 0x87, 0x49, 0x8B, 0x88, 0xA0, 0x22, 0xAA, 0x9C, 0xC0, 0x78, 0x7B, 0xFD, 0x27, 0x00,
+  0xA0, 0x00, 0xA9, 0x28, 0x83, 0x08, 0x88, 0x71, 0x81, 0x48, 0x82, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x88, 0x00, 0x08, 0x08, 0x08, 0x09, 0x77, 0x07, 0x80, 0x80, 0x71, 0x81, 0x80, 0x80, 0x90,
+  0x36, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x90, 0x70, 0x17, 0x18, 0xEB, 0x38, 0x83, 0x18, 0xBD,
+  0x80, 0x80, 0x80, 0x80, 0x0F, 0x94, 0x80, 0x0D, 0x99, 0x10, 0x98, 0x80, 0x80, 0x80, 0x00, 0x88,
+  0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x10, 0x7B, 0xFF, 0x0A, 0x7D, 0xA8,
+  0x38, 0xC0, 0x08, 0x08, 0x88, 0x17, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // megahertz
+  0xAF, 0xFF, 0x00, 0x00, 0x70, 0x77, 0xB7, 0x88, 0x80, 0x00, 0xF8, 0x0A, 0x00, 0x09, 0x08, 0x78,
+  0x93, 0x00, 0x08, 0x08, 0x18, 0xDF, 0x30, 0xB3, 0x8C, 0x00, 0x02, 0x0C, 0x39, 0x07, 0x41, 0x88,
+  0x42, 0x80, 0x80, 0x80, 0x80, 0xF0, 0x1B, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x4A, 0x57, 0x08,
+  0x08, 0xB0, 0x8F, 0x08, 0xE8, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0xFC, 0x88, 0x80, 0x80, 0x80,
+  0x00, 0x88, 0x00, 0x08, 0xF8, 0x8F, 0x90, 0xB0, 0x0E, 0xAC, 0x81, 0x08, 0x08, 0x08, 0x90, 0x47,
+  0x88, 0x15, 0x08, 0x88, 0x04, 0x0C, 0x90, 0x8D, 0xAB, 0xE8, 0x08, 0xC8, 0x88, 0xB0, 0x59, 0x40,
+  0x30, 0x35, 0x42, 0x43, 0x43, 0x42, 0x12, 0x80, 0x90, 0xDD, 0xCB, 0xCC, 0xAD, 0xBA, 0xBB, 0x88,
+  0x20, 0x64, 0x34, 0x53, 0x34, 0x33, 0x32, 0x13, 0x90, 0xC9, 0xCD, 0xBC, 0xBD, 0xBC, 0xBB, 0xAA,
+  0x89, 0x31, 0x64, 0x33, 0x83, 0xF2, 0x38, 0x00, 0x34, 0x34, 0x32, 0x33, 0x12, 0x00, 0xA8, 0xDB,
+  0xEB, 0xBC, 0xAD, 0xBC, 0xAB, 0xAA, 0x89, 0x21, 0x63, 0x34, 0x34, 0x33, 0x33, 0x33, 0x12, 0x80,
+  0x99, 0xB9, 0xCC, 0xCD, 0xBC, 0xCC, 0xBB, 0xBB, 0xAB, 0x19, 0x21, 0x64, 0x34, 0x33, 0x25, 0x22,
+  0x22, 0x11, 0x88, 0x99, 0x99, 0xBA, 0xDD, 0xBC, 0xBC, 0xBD, 0xAB, 0xAB, 0x0A, 0x21, 0x62, 0x35,
+  0x33, 0x34, 0x23, 0x23, 0x13, 0x89, 0x98, 0xAA, 0xAB, 0xEC, 0xCC, 0xBB, 0xBE, 0xBB, 0xBB, 0x8A,
+  0x10, 0x41, 0x46, 0x33, 0x43, 0x33, 0x22, 0x13, 0x90, 0x99, 0xBA, 0xCB, 0xCA, 0xDC, 0xBB, 0xDC,
+  0xBB, 0xBA, 0xAB, 0x10, 0x11, 0x74, 0x43, 0x32, 0x34, 0x12, 0x22, 0x81, 0x99, 0xA9, 0xBB, 0xAB,
+  0xEC, 0xAC, 0xCA, 0xBD, 0xAB, 0xBA, 0x89, 0x11, 0x41, 0x47, 0x32, 0x33, 0x24, 0x21, 0x21, 0xA8,
+  0x99, 0xC9, 0x9A, 0xA8, 0xCD, 0xBA, 0xDC, 0xBC, 0x43, 0xE6, 0x3B, 0x00, 0xAA, 0xAA, 0x18, 0x10,
+  0x72, 0x35, 0x32, 0x34, 0x22, 0x11, 0x01, 0xBA, 0x88, 0xAD, 0x09, 0xB9, 0xBC, 0xCB, 0xCF, 0xBA,
+  0xAA, 0x8B, 0x10, 0x10, 0x65, 0x33, 0x53, 0x32, 0x11, 0x11, 0x90, 0x9A, 0xB8, 0xAC, 0x90, 0xAA,
+  0xAF, 0xC9, 0xBE, 0xAB, 0xBA, 0x8A, 0x10, 0x30, 0x57, 0x23, 0x34, 0x23, 0x12, 0x00, 0xB0, 0x9C,
+  0xB9, 0x8C, 0x88, 0x18, 0xDD, 0xAA, 0xDE, 0x9A, 0x90, 0x8A, 0x02, 0x20, 0x47, 0x22, 0x32, 0x03,
+  0x09, 0x01, 0xAB, 0x34, 0xA9, 0x11, 0xCD, 0x92, 0xFF, 0x89, 0xBC, 0x30, 0x80, 0x32, 0xB0, 0x6A,
+  0x83, 0x60, 0x02, 0x09, 0x82, 0x0D, 0xA1, 0x19, 0x02, 0x1B, 0xA7, 0x4A, 0xF8, 0x09, 0xB8, 0x2C,
+  0x03, 0x28, 0xA1, 0x0E, 0x11, 0x42, 0x13, 0x09, 0xB8, 0x19, 0xA8, 0x49, 0xA5, 0x5A, 0xB1, 0x2C,
+  0xB5, 0x0D, 0xA0, 0x9C, 0x12, 0x30, 0xB3, 0x8E, 0x90, 0x62, 0x02, 0x10, 0x3D, 0x1C, 0x43, 0x00,
+  0xA8, 0x1A, 0xA0, 0x28, 0x20, 0x08, 0x94, 0x80, 0x3F, 0xE6, 0x09, 0xB8, 0x0C, 0x02, 0x32, 0xD9,
+  0x0A, 0x08, 0x45, 0x81, 0x10, 0x9B, 0x93, 0x1A, 0x03, 0x3B, 0xD3, 0x4A, 0xC1, 0x79, 0xF2, 0x19,
+  0xB9, 0x19, 0x01, 0x33, 0xBD, 0x09, 0x28, 0x27, 0x80, 0x10, 0x9B, 0x94, 0x2A, 0x93, 0x39, 0xF1,
+  0x38, 0xD0, 0x78, 0xE0, 0x10, 0xAA, 0x10, 0x08, 0x05, 0x8C, 0x90, 0x28, 0x04, 0x10, 0xA0, 0x19,
+  0xB1, 0x50, 0x99, 0x22, 0x9C, 0x02, 0x0B, 0x24, 0xF2, 0x0A, 0xCB, 0x99, 0x23, 0x25, 0xAC, 0xA9,
+  0x38, 0x17, 0x11, 0xA0, 0x29, 0xAA, 0x14, 0x89, 0x13, 0x9C, 0x92, 0x1B, 0x53, 0xD5, 0x1B, 0xBC,
+  0x99, 0x21, 0x17, 0x9A, 0xB9, 0x29, 0x26, 0x21, 0xA0, 0x18, 0xD8, 0x31, 0x8A, 0x14, 0x9B, 0xC3,
+  0x5B, 0x90, 0x07, 0x8D, 0xA8, 0xA9, 0x11, 0x43, 0xA9, 0xBA, 0x0A, 0x36, 0x13, 0x82, 0x99, 0x90,
+  0x80, 0x08, 0x3C, 0x00, 0x2C, 0x82, 0x51, 0xB0, 0xA0, 0x2F, 0x90, 0x44, 0xDB, 0x90, 0xAD, 0x10,
+  0x30, 0x94, 0x8B, 0xBA, 0x71, 0x12, 0x12, 0x90, 0x1A, 0xC8, 0x30, 0x90, 0x14, 0x9A, 0x8C, 0x90,
+  0x72, 0xD3, 0x09, 0xAE, 0x88, 0x18, 0x24, 0x99, 0xB8, 0x2C, 0x24, 0x33, 0x83, 0x8A, 0xD8, 0x3B,
+  0xA2, 0x73, 0x98, 0xB8, 0x2B, 0x82, 0x46, 0xD9, 0xA8, 0x9D, 0x80, 0x30, 0x94, 0x2A, 0xDB, 0x30,
+  0x22, 0x25, 0x19, 0xC0, 0x90, 0x19, 0x38, 0x82, 0x03, 0xAF, 0xA2, 0x58, 0x92, 0x9A, 0xDD, 0xA9,
+  0x99, 0x53, 0x18, 0xB1, 0x9B, 0x21, 0x65, 0x11, 0x92, 0x89, 0x9A, 0x00, 0x21, 0x11, 0xB9, 0xCB,
+  0x11, 0x31, 0x97, 0x9F, 0xF8, 0x89, 0x89, 0x12, 0x10, 0x91, 0x8A, 0x23, 0x73, 0x04, 0x01, 0xA8,
+  0x88, 0x0B, 0x02, 0x93, 0x20, 0xAF, 0xA2, 0x22, 0x98, 0x9E, 0xEC, 0xA9, 0x89, 0x28, 0x21, 0x13,
+  0x28, 0x51, 0x42, 0x15, 0xDF, 0x0D, 0x3C, 0x00, 0x12, 0x98, 0x98, 0x8B, 0x11, 0x92, 0x88, 0xBD,
+  0x29, 0x99, 0xA1, 0xFB, 0xBD, 0x9E, 0xAB, 0x89, 0x12, 0x61, 0x12, 0x22, 0x42, 0x32, 0x43, 0x11,
+  0xA2, 0x19, 0xB9, 0x20, 0xEB, 0xA8, 0x9D, 0x9A, 0x9C, 0xB8, 0xBB, 0xDB, 0x9D, 0xB9, 0x09, 0x10,
+  0x44, 0x33, 0x26, 0x32, 0x33, 0x14, 0x22, 0x88, 0xA1, 0x8A, 0xDA, 0xAA, 0xCD, 0xAA, 0xAC, 0xAA,
+  0x9B, 0x9A, 0x99, 0x89, 0x0A, 0x03, 0x34, 0x52, 0x33, 0x14, 0x35, 0x42, 0x33, 0x14, 0x31, 0x11,
+  0x99, 0xCC, 0xAC, 0xBA, 0x89, 0xBC, 0xB9, 0xCB, 0xBB, 0x0B, 0xD8, 0x89, 0x04, 0x5A, 0x03, 0x50,
+  0x80, 0x13, 0x32, 0x34, 0x51, 0x32, 0x04, 0x80, 0x18, 0xAD, 0x80, 0x08, 0x16, 0x08, 0x08, 0x08,
+  0xF8, 0x49, 0xB8, 0x80, 0xB0, 0x2D, 0x84, 0x40, 0x81, 0x90, 0x2D, 0x82, 0x08, 0x38, 0xB8, 0x00,
+  0xF0, 0x28, 0x8F, 0x00, 0x08, 0x88, 0x05, 0x4A, 0xD1, 0x00, 0x20, 0x00, 0x80, 0x24, 0x88, 0xC0,
+  0x58, 0x88, 0x80, 0x80, 0xAD, 0x80, 0x9D, 0x90, 0x8D, 0x08, 0xF3, 0x39, 0xA9, 0x13, 0x18, 0xB4,
+  0x1A, 0x08, 0x29, 0xB7, 0x09, 0x85, 0x01, 0x42, 0x80, 0x80, 0x80, 0xF0, 0x1F, 0xF9, 0x84, 0x3D,
+  0xE3, 0x40, 0xB9, 0x13, 0x8B, 0x95, 0x29, 0x09, 0xB9, 0x87, 0x4D, 0xD2, 0x59, 0xB8, 0x22, 0x8B,
+  0x94, 0x1A, 0xA0, 0x18, 0x82, 0x0C, 0x05, 0x8D, 0x84, 0x1A, 0xA1, 0x38, 0xA8, 0x10, 0xAA, 0x04,
+  0x0A, 0x10, 0x99, 0x3A, 0xC6, 0x6A, 0xC0, 0x20, 0xC8, 0x31, 0xAB, 0x04, 0x98, 0x18, 0xAA, 0x41,
+  0xC8, 0x40, 0xB8, 0x78, 0xE8, 0x13, 0x8C, 0x83, 0x2B, 0xD3, 0x48, 0xB9, 0x32, 0x8C, 0x82, 0x2B,
+  0xB2, 0x21, 0x8C, 0x03, 0xBC, 0x05, 0x2A, 0x92, 0x09, 0x18, 0x18, 0xC3, 0x00, 0x81, 0x81, 0x64,
+  0xBC, 0x03, 0x9C, 0x17, 0x0B, 0xC2, 0x4A, 0xA2, 0x4A, 0xB0, 0x40, 0xC9, 0x60, 0xFD, 0x31, 0x00,
+  0x32, 0xBB, 0x05, 0x1B, 0x84, 0x3A, 0x82, 0x53, 0x9A, 0x82, 0x0B, 0xB2, 0x79, 0x98, 0x90, 0xFC,
+  0x9B, 0xAD, 0xB0, 0x50, 0x11, 0x63, 0x82, 0x22, 0x89, 0x22, 0x03, 0x73, 0x81, 0x80, 0x9D, 0xFB,
+  0xCA, 0xAB, 0xBA, 0x8B, 0x33, 0x54, 0x13, 0x20, 0xD2, 0x63, 0x88, 0x14, 0xA9, 0x01, 0x1B, 0x23,
+  0x30, 0xA4, 0xB8, 0xCF, 0xCA, 0xBC, 0xAA, 0x28, 0x14, 0x22, 0x88, 0x99, 0x34, 0x72, 0x14, 0x10,
+  0xB9, 0xB8, 0xAA, 0x72, 0x12, 0x02, 0x01, 0x0D, 0xA0, 0xFC, 0xA8, 0x9C, 0x08, 0x28, 0x05, 0x08,
+  0x99, 0x89, 0x27, 0x21, 0x23, 0xB8, 0xAB, 0xDC, 0x40, 0x22, 0x23, 0xC8, 0x1A, 0xAA, 0x34, 0xDA,
+  0xB9, 0xAF, 0x89, 0x18, 0x23, 0x88, 0x91, 0x88, 0x64, 0x23, 0x51, 0x91, 0xAC, 0xB0, 0x3C, 0x53,
+  0x11, 0x91, 0xBC, 0x21, 0x3C, 0xA4, 0xDB, 0xBA, 0x8D, 0x88, 0x40, 0x02, 0x08, 0x99, 0x20, 0x27,
+  0x26, 0x04, 0x3F, 0x00, 0x23, 0x28, 0xD0, 0x9B, 0x80, 0x39, 0x35, 0x92, 0xA8, 0x9E, 0x00, 0x31,
+  0xB2, 0xDF, 0x9B, 0xBA, 0x31, 0x41, 0x83, 0x99, 0x9B, 0x51, 0x26, 0x22, 0x29, 0xF8, 0x88, 0x08,
+  0x28, 0x04, 0x00, 0x98, 0x99, 0x19, 0x00, 0xC4, 0xBE, 0xBC, 0xBA, 0x39, 0x16, 0x38, 0xB3, 0x8E,
+  0x32, 0x28, 0x27, 0x89, 0x08, 0xAB, 0x21, 0x01, 0x28, 0x87, 0x1A, 0x82, 0xAB, 0x83, 0x8D, 0x8C,
+  0xFB, 0xA8, 0x1A, 0x3A, 0x07, 0x08, 0x88, 0x0B, 0x25, 0x21, 0x03, 0x90, 0xAE, 0x03, 0x28, 0x63,
+  0xB0, 0x00, 0xB9, 0x68, 0x80, 0xB8, 0x98, 0xAF, 0xC9, 0x00, 0x0A, 0x22, 0x94, 0x88, 0x1B, 0x1C,
+  0x17, 0x14, 0x39, 0xB9, 0x8A, 0x43, 0x21, 0x13, 0xAB, 0xB9, 0xAA, 0x58, 0xA4, 0x8D, 0xF8, 0x8E,
+  0x11, 0x99, 0x82, 0xBB, 0x79, 0xB2, 0x32, 0x99, 0x1B, 0x07, 0x10, 0x01, 0xA8, 0x29, 0x11, 0x18,
+  0x13, 0x9F, 0xA2, 0x1C, 0xDF, 0x05, 0x39, 0x00, 0xB8, 0x8C, 0x83, 0x1C, 0xCA, 0xAC, 0xB5, 0x62,
+  0x09, 0x8A, 0x96, 0x0A, 0x33, 0xAA, 0x25, 0xA8, 0x38, 0xA8, 0x83, 0x34, 0xAF, 0x01, 0x29, 0x05,
+  0xEA, 0x8B, 0x20, 0x80, 0x17, 0xAB, 0x09, 0xAB, 0x33, 0x15, 0x19, 0xB8, 0xD9, 0x30, 0x70, 0x83,
+  0xAA, 0x80, 0x4B, 0x15, 0xC8, 0x2A, 0x08, 0x12, 0xD1, 0x8A, 0x99, 0x48, 0xA3, 0x09, 0xF9, 0x10,
+  0x92, 0x0F, 0x12, 0xA8, 0x11, 0x09, 0x80, 0x9A, 0x64, 0x12, 0xA8, 0xEA, 0x3A, 0x16, 0x81, 0xA9,
+  0x9E, 0x41, 0x91, 0x08, 0xD9, 0x3A, 0x00, 0x05, 0xC9, 0x0B, 0x18, 0x35, 0xB9, 0x8B, 0x8A, 0x36,
+  0x81, 0x9C, 0x10, 0x02, 0x28, 0xB0, 0x0D, 0x36, 0xA8, 0x8A, 0x9C, 0x34, 0xA2, 0x9A, 0x9C, 0x82,
+  0x5A, 0xA5, 0x9C, 0x80, 0x40, 0x82, 0xDB, 0x82, 0x9B, 0x73, 0xA3, 0xA8, 0x8C, 0x21, 0x34, 0xA3,
+  0xBF, 0x38, 0x33, 0xB1, 0xCA, 0x0A, 0x52, 0x84, 0x4D, 0x16, 0x41, 0x00, 0xCB, 0x1A, 0x28, 0x15,
+  0xCA, 0x1A, 0x82, 0x10, 0xB8, 0x2A, 0x19, 0x17, 0x9A, 0x89, 0x14, 0x89, 0x2B, 0x13, 0x53, 0x94,
+  0xCF, 0x38, 0x31, 0x85, 0xBC, 0x08, 0x30, 0x03, 0xEA, 0x99, 0x28, 0x17, 0xB9, 0x9A, 0xA1, 0x73,
+  0x90, 0x99, 0x98, 0x38, 0x23, 0x9B, 0x8C, 0x85, 0x41, 0xB0, 0x9B, 0x91, 0x73, 0xA5, 0x0B, 0xD1,
+  0x3A, 0x25, 0xBA, 0x81, 0xAD, 0x32, 0x02, 0x80, 0xEC, 0x18, 0x91, 0x34, 0xDA, 0x0A, 0x11, 0x22,
+  0xD2, 0x8B, 0x0A, 0x56, 0xA1, 0x0B, 0x9A, 0x32, 0x15, 0xAB, 0xA8, 0x29, 0x26, 0xCA, 0x00, 0x88,
+  0x22, 0xBC, 0x42, 0xAA, 0x12, 0xCC, 0x52, 0x90, 0x2A, 0xB1, 0x0B, 0x04, 0x4C, 0x86, 0x8B, 0xA1,
+  0x3A, 0x53, 0x88, 0xD9, 0x90, 0x28, 0x41, 0xB1, 0xF0, 0x2A, 0x20, 0x92, 0x91, 0x8D, 0x18, 0x81,
+  0x02, 0x18, 0xA1, 0x9A, 0xB0, 0x70, 0xB0, 0x47, 0xD9, 0x19, 0x80, 0x02, 0x7B, 0x07, 0x3D, 0x00,
+  0xB1, 0x1D, 0xA1, 0x92, 0x18, 0x1B, 0x8D, 0x37, 0x98, 0x89, 0xCA, 0x42, 0x13, 0x81, 0xFC, 0x09,
+  0x21, 0x12, 0xB2, 0xAE, 0x88, 0x11, 0x06, 0x1A, 0xBC, 0x88, 0x15, 0x08, 0x08, 0xCC, 0x30, 0x05,
+  0x08, 0xA0, 0x8C, 0x15, 0x28, 0x88, 0xCB, 0x12, 0x10, 0x8A, 0xF8, 0x00, 0x41, 0x9B, 0xD8, 0x01,
+  0x28, 0x08, 0xE8, 0x11, 0x4A, 0x22, 0xF9, 0x18, 0x10, 0x34, 0xB8, 0x9B, 0x18, 0x44, 0x11, 0xEB,
+  0x8A, 0x01, 0x22, 0xD8, 0x8B, 0x19, 0xB9, 0x16, 0x8D, 0x20, 0xA3, 0x29, 0xB1, 0x78, 0x93, 0x0A,
+  0x01, 0x28, 0x26, 0xA9, 0x80, 0xD9, 0x58, 0x90, 0x90, 0xE0, 0x0A, 0xAA, 0x19, 0x85, 0x3A, 0x00,
+  0xB8, 0x12, 0x2A, 0x54, 0x84, 0x9A, 0xA2, 0x2B, 0x16, 0x82, 0x52, 0xB0, 0x8B, 0x98, 0x8B, 0x35,
+  0xF8, 0x19, 0xBF, 0xA9, 0x03, 0x68, 0x10, 0xC8, 0x88, 0x29, 0x63, 0x82, 0x99, 0x8B, 0x38, 0x21,
+  0x54, 0x06, 0x38, 0x00, 0x92, 0x8C, 0x25, 0x08, 0x01, 0xCE, 0x11, 0xA1, 0x59, 0xC8, 0x9C, 0xD0,
+  0x0B, 0x34, 0x21, 0xA0, 0xCC, 0x29, 0x64, 0x01, 0xA8, 0x9B, 0x20, 0x12, 0x03, 0xAD, 0x28, 0x10,
+  0x23, 0xE1, 0x0B, 0xB0, 0x5B, 0x86, 0xCB, 0x89, 0x9D, 0x42, 0x13, 0x80, 0xDB, 0x0A, 0x44, 0x22,
+  0x98, 0xBC, 0x19, 0x14, 0x12, 0xBA, 0x9A, 0x22, 0x23, 0x03, 0xCF, 0x88, 0x00, 0x63, 0xBA, 0xBC,
+  0x9B, 0x20, 0x65, 0x02, 0xAA, 0xAC, 0x30, 0x35, 0x02, 0xD9, 0xAA, 0x20, 0x50, 0x92, 0xAA, 0x88,
+  0x1A, 0x15, 0x80, 0x00, 0xAD, 0x21, 0xC3, 0x3A, 0xF9, 0xAB, 0x81, 0x2B, 0x57, 0x90, 0x9A, 0x9A,
+  0x61, 0x13, 0x80, 0xCA, 0x9B, 0x32, 0x23, 0x01, 0xDC, 0x88, 0x00, 0x41, 0x91, 0x90, 0x9B, 0x39,
+  0xA2, 0x40, 0xCD, 0xAD, 0x98, 0x2A, 0x67, 0x81, 0xBA, 0x8B, 0x51, 0x24, 0x90, 0xBA, 0x9C, 0x41,
+  0x22, 0x08, 0xC9, 0x8B, 0x2A, 0xF2, 0x3F, 0x00, 0x22, 0x28, 0x16, 0xBB, 0x08, 0x1B, 0x25, 0xA0,
+  0xD8, 0xBC, 0x18, 0x90, 0x72, 0x05, 0xB9, 0xAA, 0x39, 0x37, 0x92, 0xA9, 0xAC, 0x29, 0x15, 0x02,
+  0x99, 0xBC, 0x21, 0x00, 0x72, 0xA9, 0x09, 0xA8, 0x50, 0x90, 0xA1, 0xCB, 0x0D, 0x82, 0x10, 0x37,
+  0xA9, 0xAB, 0x0A, 0x55, 0x03, 0xA9, 0xCB, 0x09, 0x52, 0x02, 0xB0, 0xAA, 0x1B, 0x22, 0x33, 0xA1,
+  0x9F, 0xB8, 0x21, 0x24, 0xB8, 0x9F, 0xBC, 0x32, 0x01, 0x73, 0xC3, 0xBB, 0x08, 0x70, 0x14, 0xA8,
+  0xAA, 0x8B, 0x42, 0x23, 0x89, 0xDA, 0x99, 0x41, 0x00, 0x02, 0xCA, 0x2A, 0x9A, 0x25, 0xA1, 0xB9,
+  0xBF, 0x38, 0x83, 0x71, 0x83, 0xAD, 0x98, 0x30, 0x36, 0x90, 0xBB, 0xBB, 0x50, 0x24, 0x80, 0xB9,
+  0x9C, 0x11, 0x22, 0x23, 0xBC, 0xAA, 0x98, 0x74, 0x80, 0x98, 0xCD, 0x18, 0x02, 0x50, 0x13, 0xDB,
+  0x9A, 0x28, 0x55, 0x81, 0xAA, 0xAB, 0x29, 0x16, 0xD5, 0x0C, 0x44, 0x00, 0x81, 0x98, 0xAB, 0x18,
+  0x12, 0x33, 0xAA, 0xCA, 0x90, 0x51, 0x21, 0xD9, 0xAE, 0x89, 0x21, 0x44, 0x14, 0xEA, 0xAA, 0x20,
+  0x54, 0x81, 0xBA, 0xAB, 0x39, 0x44, 0x01, 0xA9, 0x9C, 0x19, 0x23, 0x11, 0x98, 0xAD, 0x11, 0x10,
+  0x24, 0xAD, 0xBE, 0x01, 0x11, 0x61, 0x03, 0xCB, 0xAB, 0x29, 0x57, 0x81, 0xA9, 0xAC, 0x29, 0x24,
+  0x11, 0x99, 0xAD, 0x00, 0x21, 0x22, 0xA1, 0x9C, 0x98, 0x20, 0x16, 0x9B, 0xFA, 0x1A, 0x11, 0x50,
+  0x05, 0xBA, 0x9A, 0x0A, 0x47, 0x81, 0x99, 0xCB, 0x19, 0x24, 0x12, 0xA0, 0xAD, 0x08, 0x20, 0x14,
+  0x90, 0x9A, 0xAB, 0x42, 0x21, 0xB0, 0xFC, 0x0B, 0x23, 0x20, 0x27, 0xB9, 0x9C, 0x99, 0x64, 0x02,
+  0xA8, 0xCA, 0x8A, 0x42, 0x22, 0x81, 0xDB, 0x8A, 0x10, 0x33, 0xA2, 0x9A, 0xEB, 0x19, 0x04, 0x68,
+  0xB8, 0xAC, 0x01, 0x39, 0x46, 0x90, 0xBA, 0xAC, 0x41, 0x24, 0x00, 0xCA, 0xAA, 0x00, 0x41, 0x00,
+  0x9B, 0x18, 0x33, 0x14, 0xA0, 0xDB, 0x0A, 0x40, 0x03, 0x88, 0xF9, 0x8A, 0x10, 0x00, 0x17, 0xCA,
+  0x0B, 0x80, 0x73, 0x12, 0x9A, 0xCB, 0x09, 0x44, 0x11, 0xA0, 0xAC, 0x99, 0x21, 0x34, 0x80, 0xB8,
+  0x9C, 0x21, 0x31, 0xC2, 0x0C, 0xCC, 0x19, 0x83, 0x78, 0x83, 0xCD, 0x00, 0x10, 0x35, 0xA0, 0x9A,
+  0xBB, 0x30, 0x26, 0x11, 0xB8, 0xBB, 0x8C, 0x20, 0x34, 0x12, 0xAA, 0xB8, 0x28, 0x48, 0x91, 0x0A,
+  0xFE, 0x8B, 0x88, 0x78, 0x85, 0xB9, 0x98, 0x28, 0x36, 0x91, 0x88, 0xBC, 0x18, 0x12, 0x53, 0x90,
+  0xAB, 0xCA, 0x29, 0x22, 0x22, 0xA0, 0x9C, 0x99, 0x11, 0x22, 0xFA, 0x9A, 0xCF, 0x10, 0xA0, 0x56,
+  0x90, 0x8B, 0xA8, 0x60, 0x04, 0x08, 0xA8, 0x9C, 0x10, 0x10, 0x14, 0x89, 0x99, 0xAB, 0x18, 0x20,
+  0x14, 0x92, 0x8A, 0xAF, 0x80, 0x99, 0x22, 0xD0, 0x0E, 0xCA, 0x40, 0x13, 0x62, 0xA2, 0x8C, 0x88,
+  0xA9, 0xF9, 0x3A, 0x00, 0x30, 0x16, 0x88, 0xC8, 0xAB, 0x11, 0x31, 0x15, 0x99, 0x9A, 0x9C, 0x20,
+  0x11, 0x11, 0xDA, 0xAA, 0x80, 0x62, 0xF8, 0x82, 0x8F, 0x11, 0x90, 0x36, 0x98, 0x8A, 0xB9, 0x62,
+  0x12, 0x80, 0xD8, 0x8A, 0x09, 0x21, 0x04, 0x08, 0xBA, 0xAB, 0x90, 0x60, 0x11, 0x90, 0xD9, 0x8A,
+  0x18, 0x32, 0x13, 0xAA, 0x99, 0x09, 0x56, 0x98, 0x90, 0xB8, 0x58, 0x00, 0x82, 0xA9, 0x0E, 0x09,
+  0x22, 0x25, 0x8A, 0xCA, 0xB9, 0x39, 0x15, 0x48, 0xA1, 0x9F, 0x98, 0x1A, 0x15, 0x88, 0xA0, 0xCF,
+  0x00, 0x09, 0x35, 0x8A, 0xA2, 0x9D, 0x11, 0x49, 0x26, 0x88, 0x90, 0xAB, 0x11, 0x08, 0x34, 0xD9,
+  0x89, 0xED, 0x19, 0x80, 0x51, 0x92, 0x08, 0xA8, 0x2A, 0x13, 0x52, 0x92, 0x9A, 0xC9, 0x1A, 0x01,
+  0x22, 0x98, 0x91, 0xA9, 0x08, 0x2B, 0x06, 0xA3, 0x48, 0xAD, 0x92, 0x04, 0x6A, 0xA8, 0x80, 0x83,
+  0x6C, 0xA0, 0x83, 0x00, 0x8F, 0x02, 0x26, 0x00, 0x5A, 0xAC, 0x96, 0x2A, 0x21, 0x99, 0x83, 0x8E,
+  0x15, 0x1C, 0xC4, 0x8C, 0x90, 0x8D, 0x14, 0x28, 0x12, 0x9B, 0x02, 0x0A, 0x42, 0x8A, 0x15, 0x9A,
+  0x90, 0xAE, 0x08, 0x89, 0x32, 0x88, 0x01, 0xBD, 0x88, 0x9B, 0x23, 0x30, 0x05, 0x9A, 0xB9, 0xAB,
+  0x43, 0x08, 0x94, 0x0B, 0xA0, 0x0F, 0x08, 0x08, 0x08, 0x9B, 0x85, 0x80, 0x00, 0xEC, 0x08, 0x08,
+  0x48, 0x84, 0x80, 0x18, 0xFB, 0x08, 0x08, 0x88, 0x35, 0x48, 0xAA, 0x81, 0xC0, 0x6A, 0x90, 0x52,
+  0x08, 0x08, 0x08, 0x08, 0x78, 0x92, 0x42, 0x80, 0x80, 0x08, 0x08, 0x08, 0x80, 0x08, 0xA0, 0x77,
+  0x00, 0x08, 0xF8, 0x30, 0x0C, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x98, 0x57, 0x08, 0xA0, 0x0E,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x81, 0xFF, 0x8A, 0x00, 0x08, 0x88, 0x00,
+  0x88, 0x00, 0x88, 0x80, 0x80, 0x00, 0x6A, 0xFF, 0x89, 0xFF, 0x1C, 0x00, 0x8B, 0x80, 0x71, 0x82,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0xE1, 0xBF, 0x80, 0x80, 0x80, 0x80, 0x78, 0x98, 0x09,
+  0xA5, 0x7B, 0x83, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x08, 0x8C, 0x00, 0x08, 0x08, 0x88, 0x80, 0x80,
+  0x80, 0x80, 0xC1, 0x77, 0x83, 0x08, 0x08, 0x80, 0x08, 0x08, 0x08, 0xF8, 0x6B, 0x00, 0x89, 0x82,
+  0x8F, 0xB4, 0x12, 0x08, 0x08, 0x08, 0xF1, 0x0D, 0x08, 0x08, 0x15, 0x2A, 0x81, 0xBD, 0x13, 0x8C,
+  0x28, 0x32, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x29, 0xFB, 0xFF, 0x08, 0x89, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x88, 0xB1, 0x77, 0x69, 0x95, 0x31, 0xB8,
+  0x6B, 0xE1, 0x3B, 0x84, 0x80, 0x80, 0x98, 0x02, 0xD8, 0x31, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x91, 0xFF, 0xDF, 0x05, 0x8C, 0x00, 0x08, 0x08, 0x34, 0xFF, 0x1B, 0x00,
+  0x88, 0x12, 0x20, 0x62, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFA, 0xAF, 0x06, 0x99, 0x31, 0x1A,
+  0x8D, 0x80, 0xB1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x7B, 0x47, 0x09,
+  0x33, 0x2E, 0x82, 0x00, 0xF8, 0x89, 0x01, 0xD1, 0x19, 0x72, 0x89, 0x91, 0x01, 0x80, 0x80, 0x08,
+  0x08, 0x08, 0xE8, 0x22, 0xFD, 0x11, 0x09, 0x88, 0xE1, 0x49, 0x80, 0x92, 0x22, 0xBC, 0x41, 0x98,
+  0x21, 0x8B, 0xA4, 0x21, 0x09, 0x80, 0x80, 0x80, 0x08, 0xA0, 0xF5, 0xBF, 0x88, 0x80, 0x08, 0x08,
+  0x80, 0x08, 0xA0, 0x37, 0x7D, 0xA9, 0x95, 0x91, 0x8B, 0x12, 0x2C, 0xC4, 0x19, 0x88, 0x72, 0x80,
+  0x08, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x28, 0x5E, 0xF7, 0x7B, 0xDA, 0x33, 0xA9, 0x42,
+  0x83, 0xAB, 0x8C, 0x43, 0x90, 0xBA, 0x08, 0x99, 0x38, 0xB8, 0x32, 0x40, 0x81, 0x24, 0xAC, 0x33,
+  0xCC, 0x01, 0x1E, 0x00, 0xBB, 0x91, 0x09, 0x08, 0x88, 0xF1, 0x00, 0x8E, 0x88, 0x80, 0x80, 0x80,
+  0xBF, 0x80, 0x00, 0x08, 0x08, 0x08, 0xF9, 0x0E, 0x08, 0x08, 0xC8, 0xA8, 0x98, 0x80, 0x80, 0x80,
+  0x00, 0x9F, 0xF2, 0x31, 0xF8, 0x00, 0x39, 0x98, 0x04, 0x8B, 0x22, 0x08, 0x08, 0x08, 0x18, 0xAD,
+  0x86, 0x80, 0x80, 0x80, 0x90, 0x77, 0x88, 0x00, 0x08, 0x18, 0x03, 0x68, 0x9A, 0x85, 0x08, 0x18,
+  0x02, 0x28, 0x01, 0x99, 0x27, 0x2C, 0x61, 0x8A, 0x83, 0x21, 0x48, 0xB9, 0x61, 0x0A, 0x38, 0xBC,
+  0x11, 0xA9, 0x87, 0xC2, 0x20, 0x39, 0x2C, 0xB8, 0x41, 0x8E, 0x91, 0xD0, 0x11, 0x9A, 0x11, 0xE2,
+  0x48, 0xA9, 0x21, 0x29, 0x9C, 0x4A, 0xC8, 0x11, 0x8A, 0x09, 0x29, 0x59, 0xC1, 0x1C, 0xC4, 0x38,
+  0x09, 0x2B, 0xC4, 0x08, 0x82, 0xF8, 0x40, 0x1A, 0x9A, 0x04, 0x98, 0x53, 0x9C, 0x23, 0xD8, 0x33,
+  0xAE, 0x04, 0x89, 0x01, 0x46, 0x00, 0x20, 0x00, 0x89, 0xA3, 0x5A, 0x94, 0x39, 0xF8, 0x11, 0x00,
+  0x38, 0xE9, 0x11, 0x91, 0x38, 0x19, 0xC4, 0x39, 0x9D, 0x02, 0xA8, 0x21, 0x89, 0x8E, 0x15, 0x8D,
+  0x95, 0x2B, 0x80, 0xB0, 0x38, 0xAB, 0x18, 0x8A, 0x48, 0xAC, 0xA1, 0x3D, 0xC2, 0x1D, 0x89, 0xA3,
+  0x09, 0x0B, 0xA6, 0x8F, 0x04, 0x8B, 0x94, 0xAB, 0x33, 0x8C, 0x02, 0xB8, 0xB1, 0x10, 0x2F, 0xB3,
+  0x5A, 0xA0, 0x8A, 0x05, 0x2C, 0x12, 0x9A, 0x88, 0xE3, 0x68, 0xB1, 0x08, 0x01, 0x19, 0x13, 0xA0,
+  0x31, 0x19, 0x97, 0x1C, 0x25, 0x0B, 0xB4, 0x12, 0x08, 0x30, 0x0F, 0x14, 0xA9, 0x52, 0xA8, 0x22,
+  0xB0, 0x7B, 0xC2, 0x30, 0x98, 0xB3, 0x5C, 0x10, 0x81, 0x89, 0x18, 0xC2, 0x68, 0x91, 0x18, 0xAC,
+  0x20, 0x13, 0x0D, 0x84, 0x0D, 0x94, 0x19, 0x90, 0x9B, 0x97, 0x0A, 0x18, 0x81, 0x0D, 0x00, 0x90,
+  0x96, 0x8D, 0x81, 0x1A, 0x92, 0x8A, 0x3A, 0xCD, 0x3D, 0xFF, 0x21, 0x00, 0x51, 0x99, 0x88, 0x98,
+  0xB1, 0x01, 0x9F, 0x85, 0x8B, 0x08, 0x91, 0x81, 0xBC, 0x15, 0xA9, 0x2C, 0xA9, 0x21, 0xC2, 0x0E,
+  0x03, 0x2D, 0x91, 0x89, 0x02, 0x0E, 0x40, 0xC8, 0x11, 0xB0, 0x22, 0x9A, 0x05, 0x8A, 0x10, 0x12,
+  0xC0, 0x31, 0xD1, 0x16, 0x98, 0x30, 0xBB, 0x07, 0x5C, 0x91, 0x18, 0x1A, 0x01, 0x93, 0x40, 0x99,
+  0xB2, 0x35, 0x4A, 0x9B, 0x97, 0x00, 0x11, 0x00, 0x28, 0x2C, 0x38, 0x29, 0xCB, 0x37, 0x0B, 0xC3,
+  0x20, 0x80, 0x99, 0x48, 0xBA, 0x37, 0x1B, 0xD1, 0x6B, 0xC1, 0x28, 0xB3, 0x0A, 0x28, 0x1A, 0x84,
+  0xAD, 0x40, 0xC1, 0x2A, 0xB9, 0x0A, 0x97, 0x1B, 0xA2, 0xB9, 0x21, 0xB0, 0x6D, 0xC8, 0x39, 0xD0,
+  0x19, 0x94, 0x1C, 0x18, 0x9A, 0xA1, 0xB1, 0x39, 0xB7, 0x2A, 0xAA, 0x71, 0x9A, 0x09, 0xC1, 0x10,
+  0x80, 0x3B, 0xBA, 0x48, 0xC5, 0x3A, 0xA0, 0x02, 0x0E, 0xB8, 0x55, 0xCA, 0x54, 0xFC, 0x26, 0x00,
+  0x12, 0x19, 0x98, 0x30, 0x1C, 0xE3, 0x21, 0xA2, 0x29, 0x81, 0x1D, 0x86, 0x2A, 0x92, 0x5C, 0xC1,
+  0x20, 0x90, 0x82, 0x01, 0x9A, 0x27, 0x8C, 0x01, 0x10, 0x19, 0xA3, 0x18, 0x40, 0x82, 0x87, 0x1E,
+  0x03, 0x9B, 0x84, 0x8A, 0x85, 0x98, 0x82, 0x2B, 0x91, 0x42, 0xB2, 0x19, 0xC0, 0x7A, 0xB9, 0x14,
+  0xAA, 0x92, 0x19, 0x1A, 0x90, 0xF2, 0x4C, 0xB1, 0x03, 0x2B, 0x8C, 0xB0, 0x1D, 0x04, 0xCB, 0xA3,
+  0x2D, 0x80, 0xA9, 0xB1, 0x0B, 0xA6, 0x82, 0x8D, 0xB8, 0x30, 0xC8, 0x2B, 0xC3, 0x3B, 0xC9, 0x83,
+  0xEC, 0x82, 0x4B, 0x09, 0x19, 0x8C, 0xC4, 0x1A, 0x93, 0x18, 0xF4, 0x8A, 0x03, 0xC8, 0x25, 0x9C,
+  0x30, 0xB0, 0x19, 0xC6, 0x11, 0x91, 0x19, 0x58, 0x1A, 0x08, 0xEA, 0x13, 0x90, 0x33, 0xAD, 0x86,
+  0x19, 0x83, 0x4A, 0x98, 0x00, 0x80, 0x53, 0xE0, 0x38, 0xC1, 0x51, 0xA0, 0x4B, 0x91, 0x7A, 0x88,
+  0x25, 0x01, 0x29, 0x00, 0x88, 0xA2, 0x28, 0x92, 0x82, 0x1D, 0x95, 0x0A, 0x84, 0x9A, 0x34, 0xAC,
+  0x12, 0x08, 0xD1, 0x83, 0x0D, 0x92, 0x20, 0x0A, 0xD1, 0x09, 0x00, 0xB8, 0x85, 0x5C, 0xB8, 0x83,
+  0xAC, 0x13, 0x8B, 0x6B, 0xB9, 0xB4, 0x91, 0xF1, 0x28, 0x18, 0x89, 0xB9, 0x19, 0x1A, 0xD2, 0x80,
+  0xB9, 0x06, 0x9B, 0xCA, 0x84, 0x99, 0xB9, 0x70, 0xB1, 0x89, 0xD3, 0x18, 0x92, 0x1B, 0xA8, 0xB2,
+  0x60, 0x19, 0x1D, 0xD3, 0x18, 0x91, 0x92, 0x8C, 0x13, 0x97, 0x80, 0xB0, 0x13, 0x09, 0x31, 0x5D,
+  0x48, 0xD0, 0x40, 0xB0, 0x32, 0x9A, 0x23, 0xD3, 0x19, 0x31, 0xCB, 0x44, 0x9B, 0x36, 0x99, 0x02,
+  0x09, 0x25, 0x9D, 0x23, 0x19, 0xA1, 0x02, 0xB9, 0x75, 0x98, 0x91, 0x88, 0x69, 0xB1, 0x32, 0x9A,
+  0x39, 0x98, 0x68, 0x0C, 0x90, 0x22, 0xAB, 0xA7, 0x1A, 0x20, 0x9B, 0x28, 0xD9, 0x62, 0xC1, 0x2B,
+  0x92, 0xCC, 0x33, 0x8C, 0x07, 0x01, 0x1F, 0x00, 0x99, 0xB8, 0x03, 0x18, 0x9C, 0x0A, 0x82, 0x89,
+  0x9F, 0x00, 0xF8, 0x09, 0xA0, 0xA2, 0xD0, 0xB9, 0x59, 0x80, 0x9A, 0xE1, 0x18, 0xD2, 0x00, 0xBC,
+  0x10, 0x91, 0x8A, 0x83, 0xBB, 0x13, 0xF0, 0x4E, 0x08, 0x80, 0x01, 0x89, 0x02, 0xB8, 0xA6, 0x21,
+  0x01, 0x59, 0x3A, 0x2C, 0x08, 0x58, 0x20, 0x81, 0x84, 0x22, 0xCA, 0x47, 0x98, 0x49, 0x81, 0x20,
+  0x92, 0xB2, 0x29, 0x17, 0x38, 0x58, 0x9A, 0x12, 0x18, 0x86, 0x38, 0xA5, 0x39, 0x88, 0xD3, 0x42,
+  0x2A, 0x6A, 0x98, 0x81, 0xB0, 0x30, 0x48, 0x09, 0xAB, 0xA5, 0x88, 0x14, 0x0F, 0x15, 0xAC, 0x22,
+  0xCA, 0x41, 0x9B, 0x01, 0xA8, 0x19, 0x8A, 0xB7, 0x49, 0x8A, 0x9C, 0x02, 0x9B, 0xA4, 0x00, 0xE9,
+  0xA8, 0x1B, 0x99, 0x99, 0x30, 0xB1, 0x8A, 0xFB, 0x2F, 0x9A, 0x20, 0xBA, 0xE0, 0x99, 0x90, 0x73,
+  0x9B, 0x80, 0x80, 0x0B, 0x83, 0x3D, 0xA2, 0x1F, 0x28, 0xFD, 0x1D, 0x00, 0xD2, 0x58, 0xB8, 0x31,
+  0x9C, 0x04, 0x08, 0x8A, 0x03, 0xAA, 0x07, 0x0A, 0x21, 0x9B, 0xC9, 0x14, 0x88, 0x27, 0x09, 0xA4,
+  0x8E, 0x80, 0x80, 0x38, 0x43, 0x81, 0x00, 0x90, 0x36, 0x89, 0x44, 0xB3, 0x70, 0xA1, 0x09, 0x08,
+  0x8C, 0x84, 0x80, 0x00, 0xDA, 0x38, 0x83, 0x18, 0x87, 0x8B, 0x30, 0xB3, 0x8D, 0x80, 0x80, 0x53,
+  0x9C, 0x80, 0x80, 0x1F, 0x82, 0x00, 0x88, 0xE1, 0x30, 0xA8, 0x5A, 0x80, 0x08, 0x80, 0x9F, 0x80,
+  0x80, 0x00, 0x08, 0xFB, 0x08, 0x88, 0x80, 0x00, 0xF8, 0x1B, 0x88, 0x80, 0x80, 0x00, 0xFA, 0x0C,
+  0x80, 0x80, 0x80, 0x80, 0xB0, 0xCF, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x20, 0xFF, 0x8A,
+  0x80, 0x80, 0x90, 0x72, 0x84, 0x80, 0x08, 0x08, 0x80, 0x08, 0x08, 0x90, 0x75, 0x84, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x78, 0x87, 0x00, 0x08, 0x08, 0x88, 0x36, 0x08, 0x08, 0x03, 0x00, 0x19, 0x00,
+  0x08, 0x08, 0x08, 0x48, 0x37, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00,
+  0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4B, 0xF9, 0xFF, 0x0D, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // lsb
+  0xF3, 0xFE, 0x00, 0x00, 0xF0, 0xF1, 0x07, 0x7A, 0x52, 0x9F, 0x23, 0xDB, 0x40, 0xB8, 0x01, 0x00,
+  0x89, 0xC1, 0x33, 0x3F, 0x92, 0x2D, 0xC0, 0x91, 0x93, 0x0D, 0x92, 0x78, 0x88, 0x1A, 0x02, 0x2B,
+  0x0A, 0xC6, 0x0A, 0x08, 0x80, 0x08, 0x08, 0x08, 0x85, 0x61, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80,
+  0x20, 0xFF, 0x95, 0x4B, 0x80, 0xA8, 0x03, 0xD0, 0x38, 0x9C, 0x10, 0xC2, 0x08, 0x25, 0x19, 0x05,
+  0x08, 0x08, 0x08, 0x08, 0xE1, 0x5A, 0xC8, 0x09, 0xC1, 0x0A, 0x08, 0x9E, 0x00, 0x90, 0x34, 0x04,
+  0x73, 0x21, 0x41, 0xB1, 0x08, 0xF8, 0x89, 0xDB, 0x9A, 0xE9, 0x89, 0x98, 0x09, 0x02, 0x63, 0x34,
+  0x63, 0x13, 0x21, 0x81, 0xB9, 0xDB, 0xCD, 0xAA, 0xAA, 0x8B, 0x90, 0x29, 0x80, 0x20, 0x21, 0x32,
+  0x77, 0x22, 0x44, 0x22, 0x21, 0x81, 0xAA, 0xDB, 0xAE, 0xAA, 0x9C, 0x89, 0xA9, 0x18, 0xAA, 0x28,
+  0x81, 0x65, 0x24, 0x63, 0xF7, 0x06, 0x3D, 0x00, 0x22, 0x22, 0x02, 0x88, 0xDB, 0xAC, 0xAC, 0xBA,
+  0xA9, 0x89, 0x8A, 0x28, 0x99, 0x42, 0x52, 0x45, 0x42, 0x34, 0x21, 0x04, 0x89, 0xA8, 0xCD, 0xAA,
+  0xBA, 0xAA, 0x88, 0xBA, 0x29, 0xC9, 0x30, 0x92, 0x47, 0x33, 0x36, 0x23, 0x43, 0x80, 0x88, 0xEB,
+  0xBB, 0xAB, 0xAC, 0x8A, 0xBA, 0x8A, 0xC9, 0x1A, 0x31, 0x73, 0x25, 0x35, 0x22, 0x33, 0x81, 0x09,
+  0xFB, 0xAC, 0xB9, 0xAA, 0x8A, 0xBA, 0x98, 0x9B, 0x11, 0x2A, 0x67, 0x21, 0x35, 0x13, 0x33, 0x92,
+  0x8A, 0xFB, 0xAB, 0xDA, 0x99, 0x9A, 0x09, 0xCB, 0x80, 0xC0, 0x60, 0x03, 0x50, 0x25, 0x11, 0x23,
+  0x88, 0x88, 0xBD, 0xAB, 0xCB, 0x8B, 0xB9, 0x89, 0xCA, 0x1A, 0x91, 0x64, 0x22, 0x73, 0x24, 0x11,
+  0x12, 0xA8, 0xA0, 0xDC, 0x8A, 0xBB, 0x89, 0xBA, 0x90, 0xBC, 0x08, 0x21, 0x73, 0x43, 0x45, 0x12,
+  0x33, 0x00, 0x99, 0xEB, 0xAA, 0xDA, 0x09, 0xA9, 0x81, 0xF9, 0x34, 0x00, 0x8B, 0xB9, 0x8C, 0x80,
+  0x32, 0x36, 0x36, 0x33, 0x53, 0x01, 0x88, 0xC9, 0xAC, 0xAA, 0x9C, 0x99, 0xA9, 0xBB, 0xC9, 0x9A,
+  0x25, 0x12, 0x56, 0x23, 0x52, 0x01, 0x80, 0xB8, 0xCB, 0xAA, 0xCB, 0x9A, 0xAA, 0xCB, 0x9B, 0x8B,
+  0x34, 0x33, 0x77, 0x12, 0x22, 0x03, 0x89, 0xB0, 0xAE, 0x99, 0xBB, 0x8B, 0xD1, 0x8C, 0xA9, 0x1B,
+  0x25, 0x00, 0x47, 0x11, 0x23, 0x92, 0x10, 0xDA, 0xAA, 0xC9, 0x8A, 0xA8, 0x9C, 0xB9, 0x9C, 0x31,
+  0x12, 0x73, 0x36, 0x20, 0x33, 0x90, 0xA1, 0xDA, 0x8C, 0x9A, 0xBB, 0xB0, 0xBA, 0x8E, 0x89, 0x13,
+  0x24, 0x46, 0x22, 0x33, 0x14, 0x09, 0x99, 0xAF, 0x89, 0xBB, 0x89, 0xD9, 0x8A, 0xC0, 0x48, 0x22,
+  0x60, 0x23, 0x13, 0x63, 0x98, 0x80, 0xEA, 0x99, 0x89, 0xBC, 0x38, 0xFB, 0x28, 0x0B, 0x22, 0x32,
+  0x54, 0x03, 0x10, 0x03, 0xCA, 0xA8, 0xBF, 0x01, 0xCA, 0xAB, 0xB9, 0x9D, 0x8F, 0xDE, 0x38, 0x00,
+  0x35, 0x20, 0x36, 0x84, 0x89, 0x80, 0xAB, 0x03, 0xBA, 0x4A, 0xDB, 0xCA, 0xB9, 0x1B, 0x11, 0x47,
+  0x13, 0x42, 0x80, 0xDA, 0x80, 0x19, 0x40, 0xB8, 0xA9, 0xFB, 0x0D, 0x1A, 0x88, 0x27, 0x01, 0x41,
+  0x90, 0xAC, 0x91, 0x10, 0x24, 0x89, 0xCC, 0xC8, 0x8A, 0x29, 0x28, 0x27, 0x02, 0x31, 0xBA, 0x8E,
+  0x00, 0x41, 0x04, 0xAA, 0xAD, 0xAB, 0x81, 0x22, 0x68, 0x12, 0x10, 0x94, 0xCB, 0x39, 0x10, 0x26,
+  0xB0, 0xBC, 0xAC, 0x0A, 0x23, 0x12, 0x3C, 0x05, 0x10, 0x85, 0xAB, 0x39, 0x21, 0x31, 0xF1, 0xDD,
+  0x88, 0x08, 0x21, 0xA1, 0x30, 0x12, 0x79, 0x92, 0xCA, 0x01, 0x82, 0x50, 0xAB, 0xAF, 0x98, 0x02,
+  0x40, 0x8A, 0x14, 0x81, 0x43, 0xC9, 0x0B, 0x23, 0x09, 0x13, 0xFF, 0x1A, 0x98, 0x30, 0xB3, 0x5A,
+  0x11, 0x09, 0x07, 0xBA, 0x30, 0xA8, 0x30, 0xB1, 0xBF, 0x98, 0x08, 0x44, 0x1B, 0x23, 0xD1, 0x42,
+  0x9F, 0x19, 0x44, 0x00, 0xC1, 0x1D, 0x82, 0x88, 0x31, 0xEC, 0x0A, 0x92, 0x20, 0x80, 0x03, 0x01,
+  0x60, 0x91, 0x9F, 0x12, 0x88, 0x40, 0xE9, 0x8A, 0x00, 0x28, 0x92, 0x11, 0x21, 0x48, 0x93, 0xBF,
+  0x31, 0x80, 0x40, 0xF8, 0x9C, 0x01, 0x08, 0x03, 0x00, 0x30, 0x22, 0x92, 0xCF, 0x20, 0x81, 0x23,
+  0xF8, 0x9D, 0x80, 0x18, 0x84, 0x08, 0x21, 0x20, 0x82, 0xDD, 0x10, 0x11, 0x30, 0xF0, 0xAC, 0x80,
+  0x10, 0x02, 0x01, 0x30, 0x41, 0xA1, 0xAF, 0x12, 0x80, 0x42, 0xF8, 0x8C, 0x08, 0x29, 0x11, 0x82,
+  0x02, 0x32, 0x90, 0xCF, 0x12, 0x00, 0x40, 0xE9, 0x9C, 0x81, 0x29, 0x30, 0x84, 0x00, 0x41, 0xA0,
+  0x8F, 0x11, 0x98, 0x42, 0xE9, 0x9B, 0x81, 0x00, 0x41, 0x02, 0x01, 0x22, 0xEA, 0x1B, 0x02, 0x01,
+  0x02, 0xCF, 0x9B, 0x80, 0x02, 0x73, 0x01, 0x18, 0x83, 0xDB, 0x3A, 0x82, 0x39, 0xA4, 0xCF, 0x89,
+  0x00, 0x20, 0x24, 0x81, 0xB2, 0x0D, 0x41, 0x00, 0x12, 0xA2, 0xAF, 0x10, 0x81, 0x22, 0xD9, 0xAF,
+  0x80, 0x81, 0x40, 0x22, 0x81, 0x12, 0xD9, 0x0C, 0x11, 0x10, 0x81, 0xFB, 0x9D, 0x18, 0x81, 0x33,
+  0x14, 0x08, 0x21, 0xFB, 0x0A, 0x22, 0x09, 0x80, 0xFC, 0x8B, 0x20, 0x10, 0x34, 0x83, 0x00, 0xA2,
+  0xBE, 0x29, 0x13, 0x98, 0xB0, 0xFF, 0x09, 0x01, 0x21, 0x42, 0x10, 0x00, 0xC9, 0xAB, 0x41, 0x81,
+  0x98, 0xF9, 0x9C, 0x19, 0x12, 0x42, 0x23, 0x02, 0x01, 0xDC, 0x9A, 0x21, 0x02, 0xAA, 0xDE, 0xAA,
+  0x11, 0x42, 0x33, 0x23, 0x13, 0xC9, 0xAD, 0x1A, 0x22, 0xC1, 0xBA, 0xBE, 0x8C, 0x12, 0x24, 0x53,
+  0x32, 0x81, 0xDA, 0x9A, 0x19, 0x21, 0xC8, 0xDB, 0xAB, 0x1C, 0x31, 0x16, 0x24, 0x22, 0x90, 0xBC,
+  0x9A, 0x10, 0x01, 0xCA, 0xBD, 0xBB, 0x18, 0x62, 0x43, 0x24, 0x14, 0x98, 0xAD, 0x89, 0x01, 0x80,
+  0xCA, 0xCB, 0xAA, 0x01, 0x51, 0x44, 0x23, 0x04, 0xE5, 0x22, 0x3F, 0x00, 0xB1, 0xBC, 0x0B, 0x01,
+  0xB0, 0xCB, 0xBB, 0xBC, 0x18, 0x64, 0x33, 0x34, 0x14, 0xA0, 0xAE, 0x89, 0x80, 0x98, 0xA8, 0xCA,
+  0xAC, 0x10, 0x42, 0x34, 0x25, 0x14, 0x91, 0xAC, 0x9B, 0x08, 0x90, 0xCA, 0xAA, 0xBB, 0x1A, 0x31,
+  0x67, 0x33, 0x24, 0x01, 0xCB, 0xAB, 0x88, 0x80, 0xCB, 0x8C, 0x88, 0xBA, 0x08, 0x45, 0x35, 0x34,
+  0x13, 0xB8, 0xCC, 0x89, 0x09, 0x9A, 0xB9, 0xC9, 0x99, 0x1A, 0x60, 0x34, 0x35, 0x34, 0x81, 0xCB,
+  0xAB, 0x88, 0xB1, 0xBC, 0x1A, 0xA9, 0xEB, 0x00, 0x42, 0x73, 0x43, 0x12, 0xA0, 0xBB, 0x0B, 0x89,
+  0xEA, 0xAA, 0x88, 0x9A, 0xAB, 0x08, 0x63, 0x47, 0x43, 0x12, 0xA8, 0xAB, 0x88, 0xC9, 0xBD, 0x9A,
+  0x98, 0xAA, 0x0A, 0x18, 0x74, 0x34, 0x35, 0x11, 0x99, 0x99, 0x98, 0xCB, 0xAC, 0xAB, 0xB8, 0xC9,
+  0x0A, 0x08, 0x62, 0x36, 0x24, 0x22, 0x81, 0xAA, 0x8B, 0xA9, 0xCD, 0xBA, 0xF0, 0xF2, 0x37, 0x00,
+  0xAA, 0xA0, 0xC9, 0x8A, 0x52, 0x54, 0x53, 0x24, 0x91, 0xAA, 0x19, 0x98, 0xEB, 0x9A, 0x88, 0x99,
+  0xBA, 0x8A, 0x99, 0x45, 0x47, 0x32, 0x21, 0x98, 0xAA, 0x9A, 0x89, 0x9C, 0xAB, 0xA9, 0xD9, 0xAE,
+  0x8B, 0x20, 0x44, 0x55, 0x33, 0x01, 0xAA, 0x8B, 0x88, 0xC9, 0x89, 0x88, 0xBB, 0xCE, 0xBA, 0x9C,
+  0x28, 0x55, 0x43, 0x32, 0x02, 0xB9, 0x9A, 0x80, 0xB8, 0x8C, 0x89, 0xEB, 0xEB, 0xAB, 0x8A, 0x0A,
+  0x55, 0x34, 0x33, 0x12, 0xB8, 0xA9, 0x80, 0xAA, 0x8B, 0xD9, 0xFB, 0xAB, 0xEB, 0x9B, 0x18, 0x52,
+  0x44, 0x33, 0x23, 0x91, 0xAB, 0x0A, 0xA9, 0xAA, 0xBA, 0xCD, 0xCC, 0xAB, 0xDB, 0x8A, 0x41, 0x35,
+  0x35, 0x24, 0x11, 0xAA, 0x9A, 0x89, 0xAA, 0x99, 0xC8, 0xCB, 0xBB, 0xCD, 0x9B, 0x21, 0x51, 0x46,
+  0x23, 0x23, 0x81, 0xDB, 0xAA, 0x00, 0x89, 0x09, 0xB1, 0xDD, 0x9A, 0xBA, 0x8B, 0x53, 0x22, 0x65,
+  0xA1, 0x03, 0x44, 0x00, 0x22, 0x01, 0x12, 0xD9, 0x8B, 0x00, 0x99, 0x00, 0xC0, 0x9E, 0x9A, 0xCA,
+  0x18, 0x20, 0x38, 0x33, 0x37, 0x43, 0x31, 0x82, 0xDB, 0x08, 0x90, 0x9B, 0x9A, 0xDD, 0x8A, 0xA8,
+  0xBC, 0x10, 0xB8, 0x6A, 0x15, 0x31, 0x44, 0x22, 0x01, 0xD9, 0x89, 0x88, 0x99, 0xA0, 0xDC, 0x8B,
+  0x88, 0xCB, 0x19, 0xB1, 0x0D, 0x36, 0x80, 0x63, 0x14, 0x31, 0x91, 0xAC, 0x09, 0xCA, 0x18, 0xB9,
+  0x8E, 0x80, 0xBA, 0x18, 0xBB, 0x19, 0x16, 0x12, 0x72, 0x34, 0x32, 0x24, 0xD9, 0x8C, 0x98, 0x89,
+  0x82, 0xAC, 0x09, 0xD8, 0x0A, 0xB3, 0x2E, 0x02, 0x98, 0x25, 0x20, 0x54, 0x12, 0x12, 0xD9, 0x8C,
+  0x98, 0x09, 0x81, 0xAA, 0x9B, 0xB9, 0xA9, 0x01, 0x0E, 0x21, 0x91, 0x54, 0x60, 0x24, 0x42, 0x23,
+  0xDB, 0x8A, 0xBA, 0x29, 0xA2, 0x9D, 0xA8, 0xAD, 0x01, 0x98, 0x39, 0xA0, 0x10, 0x54, 0x18, 0x57,
+  0x02, 0x32, 0xA1, 0xAE, 0x04, 0x16, 0x43, 0x00, 0xA0, 0x89, 0x10, 0xBA, 0xBA, 0xDA, 0x09, 0x09,
+  0x81, 0x98, 0x31, 0x09, 0x47, 0x70, 0x14, 0x12, 0x23, 0xDB, 0x8A, 0xC9, 0x08, 0xA1, 0x9C, 0xB9,
+  0x9A, 0x08, 0x89, 0x81, 0x29, 0x00, 0x72, 0x96, 0x74, 0x12, 0x20, 0x83, 0xBC, 0x99, 0x9B, 0x11,
+  0xDA, 0xA9, 0xBB, 0x08, 0x9A, 0x12, 0xBB, 0x71, 0x90, 0x73, 0x00, 0x27, 0x12, 0x43, 0xA8, 0x8B,
+  0xE9, 0x88, 0x80, 0x8B, 0xD9, 0xA8, 0x88, 0x08, 0x09, 0x88, 0x04, 0x10, 0x35, 0x7A, 0x34, 0x23,
+  0x15, 0x8A, 0xAA, 0xEA, 0x18, 0x99, 0x9A, 0xCA, 0x99, 0x98, 0x88, 0x09, 0x08, 0x32, 0x01, 0x27,
+  0x79, 0x27, 0x20, 0x14, 0x99, 0x99, 0xCA, 0x88, 0xB9, 0x9A, 0xAC, 0x99, 0x89, 0xAA, 0x80, 0x30,
+  0x10, 0x44, 0x04, 0x71, 0x27, 0x30, 0x05, 0x89, 0x90, 0x9C, 0x98, 0x9B, 0xAB, 0xE9, 0x08, 0x8A,
+  0x09, 0x1A, 0xB1, 0x27, 0x19, 0x52, 0x08, 0x26, 0x06, 0x0B, 0x3F, 0x00, 0x11, 0x42, 0x90, 0x90,
+  0xD9, 0x89, 0xAB, 0xDB, 0xA9, 0x99, 0x19, 0x9A, 0x82, 0x29, 0x54, 0x10, 0x34, 0x02, 0x72, 0x13,
+  0x31, 0x05, 0x08, 0x98, 0xB9, 0xCC, 0x9C, 0xBC, 0x99, 0x99, 0x09, 0x89, 0x28, 0x15, 0x21, 0x42,
+  0x84, 0x73, 0x81, 0x32, 0x20, 0x32, 0xA2, 0x41, 0xFB, 0x18, 0xBF, 0xA0, 0xA8, 0x99, 0x2A, 0xBA,
+  0x22, 0x92, 0x73, 0x19, 0x11, 0x07, 0x30, 0x09, 0x39, 0xC3, 0x4A, 0x92, 0x4B, 0xC1, 0xA9, 0x02,
+  0xAE, 0x08, 0xAA, 0x89, 0xB3, 0x3A, 0xBA, 0x00, 0x62, 0x04, 0x10, 0xAB, 0x17, 0xB8, 0x85, 0x09,
+  0x81, 0x19, 0x60, 0xAA, 0x82, 0x82, 0x00, 0x9F, 0xA6, 0x2A, 0xB8, 0xA3, 0x2B, 0xC1, 0x18, 0x99,
+  0x8F, 0x94, 0x5B, 0x88, 0x08, 0xA3, 0x58, 0xD1, 0x31, 0x09, 0x13, 0x5A, 0xB0, 0x21, 0x08, 0x9B,
+  0xB5, 0x8C, 0xC1, 0x4A, 0xD9, 0x93, 0x20, 0xA8, 0x20, 0xA0, 0x32, 0x41, 0xB7, 0xFF, 0x27, 0x00,
+  0xF9, 0x32, 0x08, 0xB3, 0x12, 0x0B, 0x07, 0x8A, 0x9A, 0x94, 0xA5, 0xAB, 0x22, 0xA0, 0xC5, 0x7C,
+  0xA0, 0x82, 0x1A, 0x81, 0x19, 0x92, 0x39, 0xF8, 0x32, 0x0E, 0x80, 0x18, 0x91, 0x5B, 0xD9, 0x21,
+  0x8A, 0xA1, 0x92, 0x30, 0xBB, 0x94, 0x2C, 0x12, 0xC1, 0x80, 0xAA, 0x62, 0xF1, 0x38, 0xCA, 0x52,
+  0xCB, 0x82, 0x18, 0xA0, 0x88, 0x50, 0xF1, 0x18, 0x08, 0x10, 0x1B, 0x19, 0xB1, 0x82, 0xA1, 0x18,
+  0x6C, 0xCB, 0x87, 0x2B, 0x00, 0x09, 0x08, 0xA9, 0x23, 0x8E, 0x13, 0xD9, 0x14, 0x1A, 0xB9, 0x14,
+  0x5A, 0x9A, 0x00, 0x83, 0x18, 0x1C, 0xB3, 0x48, 0xB0, 0x25, 0xC9, 0x94, 0x82, 0x0C, 0xA2, 0x17,
+  0xBA, 0x24, 0x3C, 0xB8, 0x79, 0x89, 0x91, 0x18, 0xB4, 0x08, 0x38, 0x91, 0xE2, 0x92, 0x28, 0x92,
+  0x91, 0x3E, 0x80, 0xE2, 0x01, 0x92, 0x8A, 0xA4, 0x40, 0x0F, 0xA2, 0x91, 0x19, 0x83, 0x1E, 0xB1,
+  0x6B, 0x00, 0x28, 0x00, 0x82, 0x83, 0x8A, 0x09, 0xCB, 0x87, 0x1B, 0x01, 0x0C, 0x83, 0x8F, 0x93,
+  0x1A, 0x00, 0xF8, 0x21, 0x1D, 0x80, 0x19, 0x1B, 0x12, 0x8F, 0xA3, 0x38, 0xD8, 0x28, 0x98, 0xC0,
+  0x12, 0x28, 0x0F, 0xA5, 0x1C, 0x94, 0x18, 0x8B, 0x00, 0xB6, 0x5A, 0x99, 0x81, 0x81, 0x89, 0x03,
+  0x1E, 0xA4, 0x29, 0xC0, 0x41, 0x9B, 0x13, 0x2C, 0x00, 0x80, 0x08, 0x5B, 0xE0, 0x41, 0x8A, 0x30,
+  0xC8, 0x93, 0x59, 0x99, 0x92, 0x31, 0x99, 0x96, 0x2D, 0xA5, 0x09, 0x12, 0x9A, 0x81, 0xB3, 0x50,
+  0x1C, 0xB5, 0x18, 0xA0, 0x33, 0x8D, 0x82, 0xB9, 0x05, 0x09, 0x91, 0xC0, 0x31, 0x29, 0xC8, 0x4A,
+  0xC3, 0x39, 0x0F, 0x03, 0xB9, 0xA6, 0x29, 0x3A, 0x0C, 0xB7, 0x39, 0xE0, 0x10, 0x08, 0xA8, 0x01,
+  0x39, 0xB9, 0x89, 0x7C, 0xB0, 0x1A, 0xB5, 0x01, 0x2A, 0x99, 0x01, 0xBB, 0x07, 0x2D, 0x99, 0xA1,
+  0x5A, 0xB1, 0x39, 0xA9, 0x0B, 0xFC, 0x24, 0x00, 0x85, 0x29, 0xE0, 0x30, 0x0C, 0x00, 0x29, 0x2B,
+  0x9A, 0x87, 0x8A, 0xA5, 0x39, 0xA8, 0x48, 0xB8, 0x30, 0x38, 0xF1, 0x30, 0xDB, 0x15, 0x0C, 0x20,
+  0x28, 0xB8, 0x50, 0x89, 0xA2, 0x4C, 0xA2, 0x08, 0x30, 0xAA, 0x32, 0x84, 0xC1, 0x59, 0x82, 0x0E,
+  0xA5, 0x10, 0x3B, 0xC1, 0x21, 0x18, 0xA0, 0x90, 0x07, 0x1A, 0x98, 0xA4, 0xF0, 0x15, 0x8B, 0x00,
+  0xA1, 0x50, 0xAA, 0x01, 0x98, 0xB6, 0x6A, 0xA8, 0x00, 0x4B, 0xC5, 0x18, 0x90, 0x08, 0x19, 0xD3,
+  0x88, 0x69, 0x99, 0x28, 0xA0, 0xF1, 0x38, 0x90, 0x89, 0x12, 0x9D, 0x04, 0x0B, 0x08, 0x29, 0xAC,
+  0x87, 0x08, 0x2B, 0xC0, 0x12, 0x8C, 0x32, 0x8F, 0x95, 0x89, 0x39, 0xB1, 0x99, 0x33, 0x9D, 0x22,
+  0xBB, 0x64, 0x0D, 0xA2, 0x90, 0x02, 0x91, 0x1F, 0x94, 0x3B, 0x09, 0xB1, 0x7A, 0xC0, 0x53, 0x9A,
+  0x28, 0xE9, 0x18, 0x84, 0x3A, 0x99, 0x31, 0x2C, 0x8C, 0xFF, 0x32, 0x00, 0xB9, 0x41, 0xB1, 0x63,
+  0xC9, 0x30, 0xA8, 0x9B, 0x32, 0xE9, 0x31, 0x88, 0x20, 0x92, 0x0A, 0xA7, 0x3D, 0xA1, 0x29, 0x86,
+  0x88, 0x19, 0x0B, 0x98, 0x91, 0x18, 0x94, 0x10, 0xD1, 0x0F, 0x93, 0x3A, 0x03, 0xA8, 0x50, 0x9C,
+  0x03, 0xBA, 0x45, 0xAA, 0x98, 0x38, 0xBA, 0x87, 0x8D, 0x20, 0x8A, 0xA3, 0xC0, 0x50, 0x8B, 0x00,
+  0x94, 0x0B, 0x51, 0xBB, 0x05, 0xC1, 0x30, 0x0B, 0x28, 0xF5, 0x38, 0x08, 0x2E, 0x92, 0xFA, 0x10,
+  0x8B, 0x9A, 0x80, 0xB2, 0x74, 0x22, 0x40, 0x14, 0xB9, 0x00, 0x89, 0x0B, 0xF0, 0x9D, 0xA9, 0x9A,
+  0x0A, 0x99, 0x38, 0x77, 0x12, 0x42, 0x92, 0x9B, 0x21, 0x90, 0x00, 0xF9, 0x9F, 0x00, 0x9A, 0x88,
+  0x9A, 0x10, 0x52, 0x53, 0x11, 0x24, 0xB1, 0x0C, 0x42, 0x98, 0x98, 0xFA, 0x9B, 0x10, 0xB9, 0x8A,
+  0xB9, 0x90, 0x67, 0x11, 0x30, 0x13, 0xC8, 0x08, 0x22, 0x18, 0xBB, 0xDF, 0xA1, 0xFB, 0x44, 0x00,
+  0x99, 0x18, 0x90, 0xBC, 0x89, 0x05, 0x41, 0x23, 0x21, 0x33, 0xD2, 0x9A, 0x34, 0x91, 0xBD, 0xCC,
+  0xA9, 0x10, 0xB0, 0xBC, 0x0A, 0x17, 0x20, 0x42, 0x11, 0x31, 0xA3, 0xAA, 0x52, 0x90, 0xBE, 0xBA,
+  0xB9, 0x99, 0x21, 0xEF, 0x28, 0x82, 0x29, 0x35, 0x88, 0x62, 0x92, 0x9B, 0x32, 0xB3, 0x9E, 0x8A,
+  0xC9, 0x09, 0x91, 0x9E, 0x00, 0x91, 0x39, 0x37, 0x80, 0x51, 0x04, 0xAC, 0x31, 0x93, 0xAC, 0x09,
+  0xBA, 0x0A, 0xA0, 0x9C, 0x89, 0x11, 0x99, 0x76, 0x12, 0x10, 0x34, 0xC8, 0x1A, 0x33, 0xC8, 0xBC,
+  0x98, 0xB9, 0x89, 0x9A, 0xD8, 0x09, 0x05, 0x5A, 0x53, 0x21, 0x31, 0xB1, 0x0C, 0x63, 0xA0, 0xAC,
+  0xA9, 0x99, 0xA8, 0x9B, 0x0A, 0xB8, 0x39, 0xA5, 0x75, 0x04, 0x01, 0x33, 0xBA, 0x1A, 0x25, 0xC8,
+  0x9E, 0x88, 0xA9, 0x99, 0x80, 0x9A, 0x09, 0x83, 0x79, 0x36, 0x00, 0x51, 0x92, 0x9C, 0x32, 0xA2,
+  0x11, 0x24, 0x3E, 0x00, 0xBD, 0x89, 0xB9, 0xAA, 0x90, 0x8F, 0x82, 0x89, 0x28, 0x37, 0x11, 0x42,
+  0x13, 0xDA, 0x20, 0x12, 0xCB, 0xAB, 0xBA, 0xAB, 0x8C, 0xCB, 0x30, 0xEA, 0x30, 0x42, 0x62, 0x32,
+  0x31, 0x92, 0x9C, 0x52, 0x80, 0xDB, 0xCA, 0x99, 0x00, 0xCC, 0x29, 0xA1, 0x89, 0x32, 0x54, 0x24,
+  0x21, 0x23, 0xC9, 0x28, 0x14, 0xBA, 0xCD, 0x9B, 0x88, 0xCB, 0x8B, 0x22, 0xEB, 0x30, 0x33, 0x73,
+  0x23, 0x21, 0x92, 0xAA, 0x52, 0x92, 0xDD, 0xA9, 0xAA, 0x19, 0xEA, 0x19, 0xA2, 0x1C, 0x23, 0x22,
+  0x37, 0x21, 0x32, 0xD9, 0x09, 0x24, 0xB9, 0xAD, 0xAB, 0xA8, 0xB9, 0xB9, 0x1A, 0xC0, 0x60, 0x40,
+  0x72, 0x12, 0x11, 0xA3, 0xAB, 0x54, 0xA1, 0x9D, 0xB8, 0x8B, 0x89, 0xAA, 0x8B, 0xA2, 0x0B, 0x27,
+  0x58, 0x35, 0x10, 0x22, 0xD1, 0x19, 0x13, 0xB9, 0xCA, 0xAF, 0x08, 0x99, 0xBA, 0x12, 0x9D, 0x60,
+  0x98, 0x44, 0x93, 0x40, 0xCB, 0x1B, 0x44, 0x00, 0x03, 0xAD, 0x42, 0xA0, 0x09, 0xCA, 0x0D, 0x81,
+  0x9A, 0x89, 0x88, 0x08, 0x12, 0x7A, 0x25, 0x80, 0x34, 0xB0, 0x2B, 0x04, 0x89, 0xB8, 0xDE, 0x08,
+  0xA8, 0x18, 0xBB, 0x08, 0x81, 0x03, 0x37, 0x33, 0x52, 0x04, 0xBA, 0x40, 0x91, 0x18, 0xDD, 0x9B,
+  0x91, 0xAA, 0x81, 0x9F, 0x92, 0x28, 0x12, 0x52, 0x05, 0x21, 0x14, 0xAC, 0x21, 0x90, 0x88, 0xFB,
+  0x9B, 0x98, 0x08, 0xCA, 0x08, 0x9A, 0x72, 0x90, 0x17, 0x01, 0x32, 0xB1, 0x2B, 0x81, 0x28, 0xF0,
+  0xBC, 0x99, 0x29, 0x9B, 0xA9, 0xD8, 0x28, 0x16, 0x5B, 0x14, 0x08, 0x16, 0xA8, 0x00, 0x88, 0x02,
+  0xAB, 0xCC, 0xAB, 0x92, 0x0B, 0xA8, 0x8D, 0x91, 0x25, 0x50, 0x23, 0x41, 0x15, 0x88, 0x8A, 0x18,
+  0x91, 0x9A, 0xFE, 0x09, 0xA9, 0x20, 0xAB, 0x90, 0x1A, 0x25, 0x60, 0x03, 0x41, 0x13, 0x08, 0x99,
+  0x09, 0xB1, 0x90, 0xFF, 0x99, 0x89, 0x08, 0x99, 0x7D, 0xDD, 0x3E, 0x00, 0xC0, 0x39, 0x22, 0x68,
+  0x15, 0x20, 0x05, 0x10, 0xAA, 0x80, 0x08, 0xA0, 0xBD, 0xBD, 0x0A, 0x99, 0x90, 0x9A, 0x3B, 0x69,
+  0x84, 0x27, 0x30, 0x33, 0x12, 0xAB, 0xC0, 0x19, 0xD0, 0xA8, 0xBF, 0xB8, 0x1A, 0xB8, 0x02, 0x0F,
+  0xA2, 0x33, 0x78, 0x03, 0x42, 0x11, 0xA2, 0x1B, 0x9C, 0x98, 0xD0, 0xC9, 0x9B, 0x0B, 0x9D, 0xA7,
+  0x4A, 0xA9, 0x23, 0x19, 0x06, 0x30, 0x03, 0x12, 0xAA, 0xA8, 0x0C, 0x9A, 0xD8, 0x9C, 0xD9, 0x08,
+  0x8A, 0x80, 0x08, 0x83, 0x72, 0x40, 0x23, 0x44, 0x12, 0xA2, 0x89, 0x9D, 0xA9, 0x0A, 0xFB, 0x98,
+  0x8B, 0xA9, 0x10, 0x9B, 0x03, 0x60, 0x83, 0x46, 0x40, 0x33, 0x13, 0xA0, 0xA9, 0x8F, 0xB9, 0xB0,
+  0x8C, 0xBA, 0x1B, 0xDA, 0xB4, 0x5A, 0x0A, 0x84, 0x11, 0x33, 0x73, 0x32, 0x02, 0x91, 0xAA, 0xAC,
+  0xAC, 0xD9, 0xA9, 0xA9, 0x89, 0x8B, 0xC2, 0x19, 0x10, 0x22, 0x16, 0x74, 0xB9, 0xFE, 0x42, 0x00,
+  0x21, 0x15, 0x12, 0x80, 0xA8, 0xBB, 0xFA, 0x8A, 0x9C, 0xB8, 0x08, 0x99, 0x10, 0x1A, 0xC3, 0x14,
+  0x50, 0x40, 0x15, 0x23, 0x23, 0x13, 0x1B, 0xFA, 0xB9, 0x9D, 0xBB, 0x9A, 0xA9, 0x91, 0x39, 0x89,
+  0x13, 0x30, 0x17, 0x73, 0x48, 0x83, 0x24, 0x20, 0x01, 0x88, 0xE9, 0xA9, 0x9E, 0xBA, 0xA8, 0x09,
+  0x0A, 0x00, 0x11, 0x21, 0x34, 0x41, 0x24, 0x51, 0x20, 0x04, 0x31, 0x01, 0x01, 0x8B, 0xFA, 0xAA,
+  0xAE, 0xB8, 0x8B, 0xA9, 0x98, 0x20, 0x02, 0x52, 0x32, 0x04, 0x02, 0x31, 0x13, 0x41, 0x80, 0x18,
+  0x15, 0x49, 0x82, 0x00, 0xDB, 0xB8, 0xAD, 0xAC, 0xBB, 0x9D, 0xAA, 0xAB, 0x81, 0xAD, 0x00, 0x24,
+  0x40, 0x42, 0x40, 0x21, 0x22, 0x84, 0x43, 0x08, 0x08, 0x08, 0x08, 0xFC, 0x80, 0x8D, 0xA9, 0xCA,
+  0xAA, 0x8C, 0xAB, 0x00, 0x08, 0x88, 0x27, 0x41, 0x40, 0x20, 0x83, 0x80, 0x80, 0x80, 0x71, 0x82,
+  0xE5, 0xFF, 0x26, 0x00, 0x00, 0x29, 0x17, 0xBB, 0x00, 0xF8, 0x89, 0x0C, 0xBA, 0x00, 0x08, 0x08,
+  0x69, 0x83, 0x61, 0x80, 0x33, 0x08, 0x78, 0x81, 0x80, 0x80, 0x80, 0x18, 0xFA, 0x89, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xF1, 0x6C, 0x08, 0x08, 0x08, 0x48, 0x84, 0x08, 0x08, 0x08, 0xC0, 0x8F, 0x00,
+  0x08, 0xBC, 0x80, 0x80, 0x80, 0x80, 0x70, 0x84, 0x80, 0x00, 0x08, 0x29, 0x17, 0x1E, 0xA0, 0x80,
+  0x00, 0xBD, 0x00, 0x08, 0xA0, 0x5C, 0x80, 0x80, 0x90, 0x73, 0x4F, 0xF2, 0x84, 0x3B, 0xD3, 0x29,
+  0x0C, 0x94, 0xA8, 0x40, 0x89, 0x00, 0x90, 0xC3, 0x38, 0xA1, 0xA8, 0x68, 0xA9, 0xA0, 0x12, 0xB3,
+  0x49, 0xA8, 0x21, 0xA4, 0x89, 0xF7, 0x31, 0x8C, 0x11, 0x9A, 0x32, 0x1F, 0xA2, 0x3A, 0xE1, 0x02,
+  0x89, 0x01, 0x1A, 0x88, 0x10, 0x2A, 0x2A, 0x28, 0x9F, 0xF4, 0x29, 0xA1, 0xA2, 0x08, 0xE3, 0x13,
+  0x09, 0x41, 0x9B, 0x07, 0x3A, 0x05, 0x38, 0x00, 0x0D, 0xB2, 0x48, 0x9B, 0x02, 0xBA, 0x84, 0x2B,
+  0x88, 0x82, 0x09, 0xB6, 0x12, 0x29, 0x3A, 0xF0, 0x82, 0x1A, 0x84, 0x09, 0xB3, 0x29, 0x01, 0x2F,
+  0xC8, 0x80, 0xA8, 0x09, 0x80, 0x18, 0x96, 0x49, 0x03, 0x38, 0x83, 0x18, 0xA7, 0x49, 0x00, 0x09,
+  0x81, 0x08, 0x08, 0x08, 0x08, 0x18, 0xEF, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x08, 0x77, 0x84, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08,
+  0x7A, 0xFF, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x90, 0x92, 0xFF,
+  0x9F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x18, 0xFD, 0xAD, 0x80, 0x08, 0x80, 0x80,
+  0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x90, 0xF7, 0x77, 0x87,
+  0x2C, 0x82, 0x80, 0x80, 0x08, 0x80, 0x08, 0x08, 0xDE, 0xFD, 0x1B, 0x00, 0x80, 0x08, 0x80, 0x08,
+  0x18, 0x1A, 0x77, 0x17, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x7D, 0xFF, 0x8D, 0xA9, 0x00, 0x4C, 0x17, 0x08, 0x08, 0x08, 0x80, 0x8B, 0x22,
+  0xBF, 0x00, 0x1C, 0x11, 0x9B, 0x04, 0xA1, 0x11, 0xB7, 0x09, 0xDA, 0x08, 0x08, 0x08, 0x88, 0x80,
+  0x78, 0x07, 0x91, 0x38, 0x00, 0x88, 0xA1, 0x4A, 0x80, 0x80, 0xD1, 0x4E, 0xC1, 0x30, 0xD8, 0x92,
+  0x3E, 0xB0, 0xC3, 0x93, 0x2C, 0x1A, 0xB0, 0x10, 0xB1, 0x00, 0x38, 0x18, 0x7D, 0xA7, 0x3A, 0x92,
+  0xA1, 0x4D, 0x8A, 0xA4, 0x38, 0x99, 0x02, 0xF8, 0x38, 0x9B, 0x80, 0x86, 0x3C, 0xFF, 0x2A, 0x00,
+  0x0B, 0x83, 0x0C, 0x05, 0x8C, 0x41, 0xC8, 0x18, 0xA3, 0x0B, 0x24, 0x88, 0x2E, 0x92, 0x00, 0x08,
+  0x08, 0xBA, 0x17, 0x1F, 0xA3, 0x08, 0x08, 0x08, 0xD9, 0xA8, 0x0A, 0x2C, 0x04, 0x1B, 0xA7, 0x7E,
+  0xC2, 0x18, 0x22, 0x9C, 0x22, 0xF8, 0x19, 0x12, 0x80, 0x82, 0x98, 0x8A, 0xB0, 0x09, 0x99, 0x18,
+  0xA0, 0x80, 0xB0, 0xFF, 0x01, 0xA8, 0x28, 0x80, 0x05, 0x73, 0x14, 0x22, 0x04, 0xAC, 0x9B, 0xFA,
+  0x09, 0x80, 0xAB, 0x80, 0xD9, 0x38, 0xC8, 0x39, 0x06, 0x28, 0xA1, 0x32, 0x72, 0x27, 0x00, 0x11,
+  0xDA, 0x9A, 0x98, 0x1A, 0xA1, 0xCD, 0x89, 0xA1, 0x19, 0x25, 0xB9, 0x10, 0x98, 0x01, 0x73, 0x8C,
+  0x06, 0x02, 0x79, 0x82, 0x10, 0x12, 0xBE, 0x88, 0x99, 0x21, 0xD9, 0x8B, 0xB9, 0x23, 0x28, 0x28,
+  0xF0, 0x29, 0x12, 0x08, 0xA0, 0x59, 0x14, 0x50, 0x02, 0x22, 0x53, 0x00, 0xC1, 0xCD, 0x8A, 0x00,
+  0x20, 0x07, 0x3D, 0x00, 0x80, 0xFB, 0xAA, 0x20, 0x00, 0x05, 0x9A, 0x89, 0x87, 0x08, 0x00, 0x99,
+  0x41, 0x12, 0x20, 0xC0, 0x56, 0x88, 0x22, 0xD9, 0x8C, 0x80, 0x19, 0xA2, 0xAF, 0x89, 0x20, 0x13,
+  0x9A, 0xA8, 0x10, 0x07, 0x0A, 0xA2, 0x4D, 0x95, 0x09, 0x20, 0xA9, 0x47, 0x99, 0x10, 0xB1, 0x0C,
+  0x98, 0x00, 0xB0, 0x9E, 0x88, 0x10, 0x14, 0x9E, 0x13, 0xA9, 0x63, 0xB9, 0x18, 0x92, 0x40, 0x98,
+  0x09, 0x06, 0x69, 0x92, 0x8A, 0x23, 0xBD, 0x08, 0x90, 0x29, 0xF9, 0x0B, 0x01, 0x11, 0x90, 0x8A,
+  0x78, 0xA2, 0x00, 0xC9, 0x70, 0x80, 0x88, 0x81, 0x59, 0xA3, 0x21, 0x10, 0x19, 0xC3, 0xBE, 0x10,
+  0x88, 0x90, 0xDF, 0x28, 0x01, 0x98, 0x01, 0x1C, 0x85, 0x88, 0x2B, 0x91, 0x23, 0x8B, 0x01, 0x42,
+  0x40, 0x81, 0x26, 0x11, 0x11, 0xFC, 0x0B, 0x81, 0x09, 0xF8, 0xAB, 0x30, 0x81, 0x9A, 0x04, 0x1C,
+  0x31, 0xA3, 0x9D, 0x31, 0xCA, 0xF6, 0x3A, 0x00, 0x00, 0xA4, 0x29, 0x21, 0x44, 0x9B, 0x47, 0x91,
+  0x3A, 0xD3, 0x9D, 0x00, 0x88, 0xA0, 0xAF, 0x01, 0x00, 0x09, 0xA0, 0x13, 0x03, 0x8E, 0x33, 0x9D,
+  0x17, 0x0C, 0x11, 0x98, 0x40, 0xA8, 0x71, 0xB1, 0x29, 0x93, 0x9D, 0x00, 0x88, 0x80, 0xFB, 0x18,
+  0x08, 0x28, 0xB8, 0x38, 0x06, 0x9B, 0x22, 0x99, 0x44, 0xBA, 0x31, 0x92, 0x49, 0xD3, 0x60, 0x82,
+  0x19, 0xA2, 0xAD, 0x21, 0xC9, 0x80, 0xEB, 0x09, 0x00, 0x19, 0xC1, 0x5A, 0xA4, 0x3A, 0xB2, 0x39,
+  0x14, 0xBC, 0x71, 0xA1, 0x18, 0x11, 0x0B, 0x37, 0xB9, 0x31, 0xC0, 0x8C, 0x01, 0x9A, 0xA0, 0x9E,
+  0x89, 0x01, 0xA0, 0x2B, 0x06, 0x99, 0x33, 0xD8, 0x58, 0x91, 0x1B, 0x06, 0x89, 0x02, 0x90, 0x78,
+  0x83, 0x08, 0x92, 0xBB, 0x2C, 0xB8, 0xA8, 0xF9, 0x9D, 0x28, 0x90, 0x98, 0x38, 0x85, 0x19, 0x98,
+  0x04, 0x78, 0xD8, 0x40, 0xB1, 0x30, 0xA8, 0x30, 0xDB, 0x04, 0x3A, 0x00, 0x63, 0x90, 0x88, 0x40,
+  0xD2, 0x8C, 0x80, 0x89, 0xB8, 0xCB, 0x1A, 0x20, 0xC0, 0x59, 0x84, 0x9A, 0x33, 0x98, 0x31, 0xE5,
+  0x4A, 0x12, 0x9A, 0x03, 0x91, 0x72, 0x95, 0x0A, 0x13, 0xC9, 0x0C, 0x91, 0x9B, 0xA0, 0xAD, 0x08,
+  0x90, 0x01, 0x60, 0x89, 0x12, 0x98, 0x12, 0x07, 0x8E, 0x13, 0x09, 0x02, 0x9A, 0x34, 0x61, 0x02,
+  0x9C, 0x43, 0xD8, 0x8A, 0xA8, 0x19, 0xBA, 0xAE, 0x08, 0x01, 0xB1, 0x6B, 0x03, 0x19, 0x81, 0x3D,
+  0x96, 0x8B, 0x33, 0x0D, 0x85, 0x9A, 0x42, 0x18, 0x24, 0xD9, 0x38, 0xA2, 0xAB, 0xB8, 0x09, 0xCA,
+  0xBC, 0xA8, 0x18, 0x23, 0x0F, 0x14, 0x91, 0x29, 0x04, 0x0C, 0x03, 0xB8, 0x28, 0x17, 0x0C, 0x22,
+  0x01, 0x72, 0x93, 0x8D, 0x33, 0xE9, 0x8A, 0x80, 0x8B, 0xA1, 0xBD, 0x48, 0x81, 0x0A, 0x02, 0x42,
+  0xB2, 0x19, 0x61, 0x8A, 0xA3, 0x0B, 0x23, 0x52, 0x99, 0x24, 0x07, 0x40, 0x08, 0x1C, 0x3C, 0x00,
+  0x08, 0x08, 0xB8, 0xCD, 0x00, 0xBA, 0x89, 0xAE, 0x0A, 0x84, 0x99, 0x42, 0x81, 0x29, 0x24, 0xBA,
+  0x70, 0xB0, 0x4B, 0x94, 0x1B, 0x34, 0x9B, 0x53, 0x92, 0x40, 0xA1, 0x18, 0xCA, 0x9F, 0x80, 0xA8,
+  0xD9, 0x8A, 0x08, 0x81, 0x28, 0xC1, 0x26, 0x08, 0x2A, 0x01, 0x80, 0xB0, 0x84, 0x9A, 0x26, 0x82,
+  0x20, 0x74, 0x19, 0x04, 0x88, 0xB1, 0xEC, 0x18, 0x8A, 0x9A, 0xFA, 0x89, 0x02, 0x99, 0x30, 0x21,
+  0x80, 0x31, 0xB7, 0x58, 0x90, 0x88, 0x30, 0xF0, 0x51, 0x91, 0x1A, 0x07, 0x09, 0x12, 0x9A, 0x10,
+  0xCC, 0x18, 0xA9, 0xA9, 0xBB, 0x0B, 0x03, 0x29, 0x94, 0x7A, 0x02, 0x01, 0x21, 0xA8, 0x02, 0x90,
+  0x79, 0x92, 0x33, 0x05, 0x32, 0x78, 0x14, 0x09, 0xD2, 0xCB, 0x18, 0xA9, 0xAC, 0xCB, 0xAA, 0x11,
+  0x01, 0xB9, 0x72, 0xA3, 0x70, 0x88, 0x09, 0x83, 0x89, 0x01, 0x08, 0x23, 0x43, 0x48, 0x07, 0x40,
+  0x10, 0x15, 0x38, 0x00, 0x85, 0x9B, 0x21, 0xFB, 0x0A, 0xA0, 0x8C, 0xA9, 0x9D, 0x11, 0x01, 0x80,
+  0x18, 0x22, 0x22, 0x05, 0xAC, 0x84, 0x18, 0x12, 0x9B, 0x73, 0x81, 0x40, 0x04, 0x34, 0x90, 0x1B,
+  0xD8, 0x9C, 0x91, 0xBE, 0x89, 0xCA, 0x8A, 0x20, 0x81, 0x49, 0x05, 0x09, 0x43, 0xA0, 0x28, 0x90,
+  0x40, 0xB0, 0x43, 0x0C, 0x27, 0x00, 0x34, 0x28, 0x94, 0x9B, 0x42, 0xFB, 0x8C, 0xA0, 0x9A, 0xA8,
+  0xAC, 0x18, 0x23, 0x11, 0x01, 0x78, 0xA4, 0x21, 0xB2, 0x9A, 0x26, 0xCC, 0x41, 0xA0, 0x31, 0x02,
+  0x20, 0x24, 0x12, 0xC8, 0x28, 0xFA, 0xAC, 0x98, 0xAB, 0x99, 0xFB, 0x09, 0x32, 0x90, 0x32, 0x00,
+  0x42, 0x12, 0xB8, 0x5B, 0xB1, 0x2A, 0x09, 0xA6, 0x7A, 0x84, 0x38, 0x14, 0x19, 0x03, 0xDA, 0x20,
+  0xFA, 0x8B, 0xBA, 0x9A, 0x99, 0xCB, 0x29, 0x10, 0x34, 0x11, 0x43, 0x23, 0x00, 0x18, 0xA2, 0xBC,
+  0x80, 0x43, 0x38, 0x36, 0x1B, 0x00, 0x2B, 0x00, 0x23, 0x64, 0x13, 0x48, 0x02, 0xA9, 0x88, 0xFE,
+  0x8A, 0xB9, 0xAB, 0x9B, 0xCB, 0x28, 0x92, 0x53, 0x32, 0x32, 0x23, 0x04, 0x41, 0x08, 0x9C, 0x00,
+  0x08, 0x06, 0x30, 0x51, 0x42, 0x04, 0x51, 0x82, 0x20, 0x80, 0xDB, 0xAA, 0xCF, 0xA9, 0xCB, 0x9A,
+  0x8A, 0x08, 0x18, 0x33, 0x34, 0x35, 0x22, 0x43, 0x01, 0x10, 0x8A, 0x41, 0x81, 0x38, 0x95, 0x42,
+  0x58, 0x04, 0x18, 0x24, 0xEB, 0x99, 0xDC, 0xAB, 0xCA, 0xAC, 0x98, 0x99, 0x11, 0x12, 0x63, 0x22,
+  0x42, 0x12, 0x11, 0x03, 0x8B, 0x80, 0x80, 0x18, 0x87, 0x69, 0x81, 0x12, 0x38, 0x42, 0xB9, 0xBD,
+  0xFA, 0xCB, 0x9B, 0xBC, 0xAA, 0x89, 0x80, 0x40, 0x43, 0x33, 0x44, 0x12, 0x43, 0x01, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x58, 0x84, 0x60, 0x03, 0x48, 0x04, 0xBA, 0x9A, 0xDF, 0x9A, 0xCB, 0x9B, 0x99,
+  0x9B, 0x22, 0x12, 0x65, 0x12, 0x42, 0x12, 0x22, 0x11, 0x06, 0x2F, 0x00, 0x80, 0x00, 0x08, 0xCA,
+  0x32, 0xAC, 0x33, 0x08, 0x55, 0x11, 0x34, 0xB8, 0x9C, 0xFA, 0xAC, 0xBA, 0xBD, 0x99, 0xA9, 0x80,
+  0x21, 0x53, 0x43, 0x33, 0x24, 0x43, 0x81, 0x80, 0x08, 0xBA, 0x84, 0x0B, 0x08, 0x08, 0x78, 0x06,
+  0x28, 0x83, 0x9C, 0xC0, 0xBE, 0xAA, 0xCC, 0x9A, 0x99, 0x8A, 0x21, 0x20, 0x47, 0x11, 0x32, 0x23,
+  0x22, 0x82, 0x08, 0x08, 0x9D, 0x85, 0x8B, 0x23, 0x08, 0x15, 0x50, 0x20, 0xC0, 0xAA, 0xFB, 0xAD,
+  0xBA, 0xBB, 0x9A, 0x9A, 0x08, 0x24, 0x63, 0x34, 0x31, 0x24, 0x11, 0x12, 0x88, 0x00, 0xBC, 0x00,
+  0x08, 0x08, 0x88, 0x74, 0x05, 0x18, 0x03, 0xCB, 0xAB, 0xDF, 0x9A, 0xCB, 0xAB, 0x99, 0x0A, 0x81,
+  0x50, 0x34, 0x32, 0x34, 0x33, 0x12, 0x80, 0x08, 0x08, 0x80, 0xAF, 0x00, 0x18, 0x06, 0x48, 0x81,
+  0x14, 0x08, 0xD0, 0xBA, 0xBF, 0xAB, 0xAE, 0x9A, 0x8A, 0x19, 0x10, 0x53, 0x2D, 0xF1, 0x2E, 0x00,
+  0x24, 0x33, 0x34, 0x12, 0x33, 0x91, 0x00, 0x1E, 0xC1, 0x28, 0xC1, 0x41, 0x08, 0x33, 0x84, 0x42,
+  0x08, 0xFA, 0xA9, 0xCD, 0xAA, 0xBB, 0xAB, 0x88, 0x8B, 0x25, 0x32, 0x36, 0x23, 0x43, 0x12, 0x13,
+  0x08, 0xDA, 0x80, 0x80, 0x80, 0x80, 0x68, 0x83, 0x34, 0x59, 0x82, 0xB0, 0xBD, 0xEC, 0xBA, 0xAD,
+  0xAB, 0xB9, 0x09, 0x18, 0x23, 0x55, 0x32, 0x33, 0x33, 0x42, 0x80, 0x80, 0xB1, 0x0E, 0x08, 0x08,
+  0x68, 0x81, 0x42, 0x18, 0x85, 0x00, 0xC9, 0xC9, 0xAE, 0xCA, 0xAB, 0xAA, 0xAA, 0x80, 0x40, 0x42,
+  0x34, 0x43, 0x33, 0x13, 0x13, 0x08, 0x08, 0x80, 0x08, 0x80, 0xA0, 0x77, 0x80, 0x51, 0x08, 0x08,
+  0x08, 0xAD, 0xDC, 0xBA, 0xAD, 0xAB, 0x9A, 0x08, 0x80, 0x50, 0x33, 0x25, 0x33, 0x23, 0x03, 0x80,
+  0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x18, 0x7B, 0x47, 0x08, 0x08, 0xFB, 0xC8, 0xAC, 0xCB, 0xBB,
+  0xE7, 0xF5, 0x2B, 0x00, 0xAB, 0xC9, 0x19, 0x49, 0x32, 0x34, 0x24, 0x43, 0x13, 0x14, 0x08, 0x08,
+  0x08, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x88, 0xF7, 0xEF, 0x8B, 0x8C,
+  0xC9, 0x08, 0x08, 0x48, 0x03, 0x25, 0x33, 0x13, 0x16, 0x39, 0x03, 0x08, 0x88, 0x90, 0x08, 0xBF,
+  0x80, 0x80, 0x80, 0x08, 0x08, 0xF0, 0x8F, 0x80, 0x80, 0xF0, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x58, 0x87, 0x80, 0x80, 0x80, 0x80, 0x03, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0x50, 0xFF, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x08, 0x08, 0xC5, 0x74, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x90, 0xD3, 0x0F, 0xE6, 0xB2, 0x12, 0xF5,
+  0x78, 0xAA, 0x21, 0x19, 0x88, 0x23, 0xB0, 0xC0, 0x59, 0x88, 0x88, 0x09, 0x0A, 0x80, 0xA0, 0x89,
+  0x4C, 0xB5, 0x7B, 0x0C, 0x35, 0xFE, 0x2F, 0x00, 0xB6, 0x08, 0x10, 0xA8, 0x3A, 0xA3, 0xC9, 0x11,
+  0x91, 0x08, 0x88, 0x17, 0x7B, 0xC0, 0x98, 0x99, 0xAD, 0x25, 0x98, 0x08, 0x31, 0x18, 0xA9, 0x82,
+  0xB8, 0x35, 0x8E, 0x91, 0x88, 0x91, 0x89, 0x22, 0xAB, 0x84, 0xA4, 0x3C, 0x98, 0x49, 0x9B, 0x07,
+  0x2A, 0x18, 0x88, 0x93, 0x51, 0x2D, 0xA0, 0x28, 0xA7, 0x79, 0x99, 0x80, 0x93, 0x4A, 0x0A, 0xC3,
+  0x92, 0x39, 0x3B, 0x80, 0xA5, 0x1A, 0x69, 0xC0, 0x14, 0xB8, 0x5A, 0xB1, 0x18, 0xC3, 0x5B, 0x88,
+  0x01, 0xA8, 0x62, 0x8C, 0xA2, 0x92, 0x11, 0x9B, 0x92, 0xD4, 0x48, 0xA8, 0x59, 0xE9, 0x03, 0x3B,
+  0x2D, 0xC0, 0x94, 0x19, 0x18, 0x0A, 0xA1, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // usb
+  0x5D, 0xFF, 0x00, 0x00, 0xF0, 0xCF, 0xF2, 0x32, 0x8D, 0xC4, 0x7A, 0xB1, 0x30, 0xA9, 0x98, 0xB9,
+  0x89, 0x07, 0xD3, 0x13, 0x2F, 0x00, 0x80, 0xB0, 0x10, 0x1A, 0xA7, 0x1B, 0xA9, 0x73, 0x0C, 0x82,
+  0x99, 0x11, 0x04, 0xCB, 0x04, 0x3A, 0x0C, 0x98, 0x95, 0x91, 0xCA, 0x16, 0x1D, 0x00, 0xB2, 0x99,
+  0x60, 0xB9, 0x40, 0x91, 0xC1, 0x48, 0xC0, 0x08, 0x40, 0x09, 0xA1, 0x0D, 0x84, 0xA8, 0x58, 0xC0,
+  0x20, 0x00, 0x08, 0x08, 0x1B, 0x5D, 0xB8, 0x03, 0xD8, 0x22, 0x08, 0xBB, 0x47, 0x0B, 0x01, 0xB1,
+  0x79, 0xC1, 0x2F, 0xC7, 0x88, 0x33, 0x9B, 0x59, 0xD3, 0xAD, 0x52, 0x92, 0xAB, 0x31, 0xA8, 0x38,
+  0x86, 0xAB, 0x38, 0x93, 0x9B, 0x03, 0xFB, 0x29, 0x35, 0xDA, 0x89, 0x81, 0xA8, 0x6C, 0x14, 0x0A,
+  0x43, 0xE1, 0x8D, 0x41, 0x91, 0xAA, 0x98, 0x00, 0x30, 0xE0, 0x1C, 0x22, 0x8A, 0x43, 0x91, 0x08,
+  0x82, 0xAD, 0x61, 0x91, 0x19, 0x1B, 0x47, 0x00, 0xBA, 0x89, 0x18, 0x38, 0xF9, 0x0A, 0x04, 0x38,
+  0x32, 0x9A, 0x53, 0xF2, 0x8B, 0x53, 0xA0, 0xBA, 0x88, 0x80, 0x01, 0xBA, 0x2B, 0x63, 0x15, 0xB0,
+  0x30, 0x23, 0xAE, 0x30, 0x93, 0xDB, 0x99, 0x9A, 0x48, 0xE0, 0x1A, 0x50, 0x14, 0x99, 0x38, 0x95,
+  0x9C, 0x51, 0xA1, 0x9B, 0x90, 0xAA, 0x21, 0xC8, 0x8A, 0x65, 0x01, 0x8A, 0x31, 0xB2, 0x8A, 0x24,
+  0xAA, 0x8C, 0xD9, 0x89, 0x91, 0x8D, 0x10, 0x27, 0x91, 0x09, 0x34, 0xBB, 0x5B, 0x04, 0xD9, 0x88,
+  0x98, 0x0C, 0x82, 0xBB, 0x78, 0x05, 0x98, 0x10, 0x92, 0x8A, 0x41, 0x90, 0x9C, 0xA0, 0x9A, 0xA8,
+  0x9C, 0x31, 0x27, 0x82, 0x08, 0x31, 0xD8, 0x28, 0x05, 0xD8, 0x88, 0xAB, 0x1A, 0xC2, 0x8D, 0x70,
+  0x03, 0x99, 0x21, 0x92, 0x0D, 0x32, 0xB9, 0x21, 0xDE, 0x19, 0x81, 0xAB, 0x20, 0x26, 0x80, 0x29,
+  0x13, 0xAB, 0x23, 0xA8, 0x31, 0xF4, 0xAF, 0x08, 0xB2, 0xE5, 0x45, 0x00, 0x01, 0xB9, 0x53, 0x03,
+  0x8A, 0x32, 0xA8, 0x18, 0x14, 0x9A, 0xC1, 0xCF, 0x19, 0x80, 0xCA, 0x53, 0x03, 0x18, 0x18, 0x9A,
+  0x24, 0xA0, 0x02, 0xFA, 0x9C, 0x88, 0x8B, 0xB2, 0x32, 0x47, 0x80, 0x08, 0x88, 0x01, 0x11, 0x24,
+  0xDE, 0xAA, 0x18, 0x98, 0xC9, 0x43, 0x33, 0x50, 0xA8, 0xAB, 0x34, 0x02, 0x30, 0xFD, 0x9B, 0x11,
+  0x99, 0x0A, 0x04, 0x23, 0x25, 0xAA, 0x0C, 0x23, 0x21, 0x02, 0xFF, 0x89, 0x80, 0x18, 0x88, 0x10,
+  0x24, 0x03, 0x99, 0x0C, 0x31, 0x24, 0xB0, 0xCF, 0x9A, 0x11, 0x01, 0x8B, 0x32, 0x32, 0x25, 0x92,
+  0x9F, 0x20, 0x04, 0xA8, 0xAD, 0x8A, 0x11, 0x92, 0xA9, 0x20, 0x34, 0x32, 0x02, 0x8E, 0x20, 0x82,
+  0x89, 0xA3, 0xCF, 0x20, 0x92, 0xBA, 0x9A, 0x10, 0x34, 0xA9, 0x18, 0x88, 0x51, 0x34, 0x81, 0x11,
+  0x8B, 0x01, 0xBD, 0x8B, 0x9C, 0xBB, 0x81, 0x08, 0xF9, 0x19, 0x34, 0x12, 0x64, 0x00, 0x27, 0x00,
+  0x14, 0x08, 0x08, 0x08, 0xF9, 0x0A, 0xC0, 0x0B, 0x25, 0xAC, 0x00, 0x9A, 0x04, 0x40, 0x81, 0x9D,
+  0x80, 0x80, 0x80, 0xF0, 0x0A, 0x92, 0x09, 0x08, 0x08, 0x37, 0x88, 0x80, 0x80, 0x80, 0xF1, 0x0D,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x78, 0x24, 0x91, 0x00, 0x18, 0xEF, 0x32, 0xC9, 0x59,
+  0x81, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x47, 0x08, 0x88, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x7F, 0xFF, 0x8F, 0x86, 0x8B, 0x80, 0x40, 0x08, 0xBA, 0x81, 0x80, 0x48,
+  0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0xE8, 0xAB, 0x80, 0x80, 0x80, 0x80, 0x90, 0x76, 0x83, 0x80,
+  0x02, 0x00, 0x22, 0x00, 0x08, 0x80, 0x08, 0x08, 0xF1, 0x9F, 0x80, 0x80, 0x80, 0x80, 0x74, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0xF2, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x90, 0x65, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x90, 0xCF, 0x00, 0x88, 0x80, 0x80, 0x80, 0x72, 0x84, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0xB1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x75, 0x83, 0x80, 0x08, 0x80,
+  0xB0, 0xC1, 0x2A, 0xB8, 0xFA, 0x5A, 0x60, 0xD8, 0x22, 0x88, 0x80, 0x80, 0x80, 0x80, 0x1A, 0x92,
+  0xB1, 0xCF, 0x8A, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x72, 0x07, 0x79, 0x80, 0x00, 0x88,
+  0x00, 0x88, 0x80, 0x80, 0x90, 0xFD, 0x1B, 0x89, 0x80, 0x08, 0x08, 0x08, 0x67, 0x02, 0x8A, 0x82,
+  0x00, 0x0F, 0xB4, 0x99, 0x19, 0x89, 0x0A, 0x80, 0x78, 0xD0, 0x63, 0xAA, 0x04, 0x18, 0x08, 0xCB,
+  0x05, 0x9C, 0x12, 0x9A, 0xCF, 0xFD, 0x27, 0x00, 0x01, 0x99, 0x61, 0xAA, 0x16, 0xB9, 0x32, 0x8A,
+  0x83, 0x80, 0x80, 0x08, 0x18, 0xFA, 0x22, 0x88, 0x80, 0x80, 0x00, 0xFF, 0x88, 0x11, 0x99, 0x97,
+  0x5F, 0xE3, 0x29, 0x10, 0x09, 0x92, 0x39, 0xFC, 0x48, 0xA1, 0x09, 0x22, 0x1D, 0x02, 0x90, 0xA8,
+  0x3C, 0x14, 0xA8, 0x80, 0xAA, 0x60, 0x92, 0x9E, 0x8A, 0x04, 0x8A, 0x33, 0x8E, 0x93, 0x39, 0xE1,
+  0x0A, 0x11, 0x88, 0xA1, 0xF2, 0x70, 0x99, 0x01, 0xA8, 0x14, 0x8A, 0x1B, 0x01, 0xB1, 0x40, 0xC9,
+  0x40, 0x80, 0xB0, 0x1B, 0x07, 0x8C, 0x28, 0xA0, 0x09, 0x52, 0xAD, 0x51, 0xC0, 0x10, 0x10, 0x9E,
+  0x14, 0x9B, 0x22, 0xA8, 0x3A, 0x92, 0x0B, 0x34, 0xDB, 0x43, 0x8C, 0x03, 0xAA, 0x40, 0x00, 0xA8,
+  0x91, 0x4B, 0xA7, 0x1C, 0x83, 0xDB, 0x62, 0xB0, 0x29, 0x00, 0xAB, 0x05, 0x88, 0x38, 0xB8, 0x25,
+  0xA0, 0x74, 0xA0, 0x0B, 0x86, 0x9C, 0x10, 0xA1, 0x86, 0x01, 0x39, 0x00, 0x1A, 0xA8, 0xAB, 0x19,
+  0x87, 0xBA, 0x68, 0x81, 0x51, 0x13, 0x30, 0x81, 0xEB, 0x20, 0xA9, 0x28, 0xF8, 0x9E, 0x81, 0x1A,
+  0xB9, 0x98, 0x48, 0x10, 0x39, 0x27, 0x22, 0x46, 0xA0, 0x9A, 0xA0, 0x2A, 0x12, 0xFC, 0x19, 0xA9,
+  0x0A, 0x92, 0xAD, 0x20, 0x02, 0x80, 0x27, 0x19, 0x72, 0x02, 0x98, 0x90, 0x8C, 0x20, 0xA8, 0xDB,
+  0xA2, 0x8A, 0x4A, 0xFA, 0x99, 0x85, 0x19, 0x12, 0x0D, 0x14, 0x01, 0x44, 0xA8, 0x0B, 0xA0, 0x29,
+  0x03, 0xAF, 0x00, 0xA8, 0x08, 0x88, 0xCB, 0x3A, 0xA4, 0x10, 0x81, 0x3D, 0x57, 0x11, 0x02, 0xBA,
+  0x0A, 0xA8, 0x48, 0xB2, 0x8B, 0xBB, 0x0F, 0x83, 0xAC, 0x83, 0x8F, 0x13, 0xBA, 0x11, 0x49, 0x45,
+  0x13, 0x93, 0x99, 0x9C, 0x99, 0x31, 0xA2, 0xAD, 0xA8, 0xAD, 0x18, 0x81, 0x8D, 0x00, 0xD0, 0x28,
+  0xAA, 0x18, 0x77, 0x12, 0x30, 0x91, 0xAC, 0x08, 0x8A, 0x32, 0xC8, 0xAC, 0xF7, 0xFB, 0x3C, 0x00,
+  0xA9, 0x90, 0x18, 0x83, 0xBF, 0x82, 0xD0, 0x00, 0x19, 0x7A, 0x17, 0x80, 0x31, 0xB0, 0x0B, 0xC1,
+  0x2A, 0x83, 0xAA, 0xCA, 0x8A, 0xA8, 0x69, 0xD1, 0x89, 0x91, 0x2C, 0xB2, 0x3C, 0x21, 0x57, 0x81,
+  0x50, 0xA1, 0x8C, 0x91, 0x1A, 0x84, 0x9A, 0x98, 0x9B, 0x03, 0x9D, 0x03, 0xBC, 0x32, 0xCB, 0x41,
+  0xBA, 0x14, 0x26, 0x32, 0x41, 0xA1, 0xBB, 0x98, 0x1B, 0x04, 0xAB, 0xD9, 0x99, 0xD8, 0x6A, 0xA0,
+  0x8A, 0x83, 0x8D, 0x20, 0xC9, 0x31, 0x60, 0x23, 0x15, 0x13, 0xAB, 0x89, 0xBC, 0x02, 0xA0, 0xA8,
+  0x0E, 0xAC, 0xA1, 0x91, 0x1A, 0x00, 0x8F, 0x84, 0xAB, 0x11, 0x28, 0x70, 0x17, 0x11, 0x03, 0xAA,
+  0xA9, 0x9A, 0x01, 0x9B, 0xD9, 0xBA, 0x19, 0x8E, 0x90, 0xA0, 0x84, 0x3B, 0x80, 0xDB, 0x10, 0x85,
+  0x70, 0x07, 0x18, 0x04, 0xA9, 0x00, 0xAB, 0x08, 0xE1, 0x00, 0x0C, 0x09, 0xB0, 0x80, 0x00, 0x4A,
+  0x75, 0xF2, 0x36, 0x00, 0x80, 0xA1, 0xA2, 0x1B, 0x71, 0x18, 0x47, 0x80, 0x62, 0x90, 0x09, 0xC0,
+  0x19, 0x89, 0xAA, 0xC2, 0x1A, 0x02, 0x8E, 0x90, 0x88, 0x40, 0x09, 0x90, 0x91, 0x29, 0x43, 0x82,
+  0x67, 0x08, 0x33, 0x91, 0x08, 0xB9, 0x0C, 0xD0, 0x8A, 0x1C, 0xAA, 0xA3, 0xDB, 0x03, 0x0F, 0x91,
+  0xA0, 0x13, 0x2B, 0x12, 0x00, 0x27, 0x20, 0x19, 0x41, 0x85, 0x31, 0xBC, 0x01, 0xDA, 0x38, 0xF9,
+  0x08, 0xA8, 0x8C, 0xA3, 0x9D, 0x82, 0x0A, 0x01, 0x92, 0x62, 0x1C, 0x95, 0x38, 0x81, 0x4A, 0x98,
+  0xB2, 0x41, 0xA8, 0x29, 0xE4, 0x38, 0x99, 0x0A, 0x08, 0x09, 0xB9, 0x8F, 0xC5, 0x28, 0x99, 0xA0,
+  0x92, 0x83, 0x6B, 0x89, 0x11, 0xD2, 0x41, 0x2B, 0x00, 0x28, 0x34, 0x88, 0x22, 0xE9, 0x41, 0x0A,
+  0xA8, 0x95, 0x48, 0x0E, 0x89, 0xA0, 0xB2, 0x68, 0x0D, 0x92, 0x00, 0x98, 0x20, 0x0A, 0xB3, 0x72,
+  0x1B, 0x96, 0x00, 0x19, 0x32, 0x02, 0x2F, 0x00, 0x81, 0x0B, 0x87, 0x3B, 0xA8, 0x51, 0xC1, 0x0B,
+  0x02, 0x2D, 0xF2, 0x38, 0x98, 0x91, 0x2A, 0xC2, 0x20, 0x0B, 0x94, 0x9B, 0x15, 0x8B, 0x13, 0x3E,
+  0xB0, 0x60, 0xAA, 0x23, 0x8B, 0x88, 0x98, 0x23, 0xBD, 0x90, 0x48, 0xF2, 0x00, 0x89, 0xB0, 0x78,
+  0xD8, 0x03, 0x9B, 0x05, 0x1B, 0xB0, 0x24, 0xBA, 0x83, 0x59, 0xC8, 0x20, 0x90, 0x00, 0x3B, 0x3D,
+  0xBA, 0x85, 0xAA, 0x38, 0x31, 0xBF, 0x97, 0x18, 0x29, 0x88, 0x11, 0x8A, 0x31, 0x2D, 0x12, 0xAC,
+  0x24, 0x99, 0xBA, 0x07, 0x19, 0x88, 0x0A, 0x21, 0x1A, 0x3F, 0x89, 0x51, 0x9A, 0x85, 0x09, 0x91,
+  0x10, 0xA0, 0xA2, 0x17, 0xE8, 0x94, 0x18, 0xB0, 0x50, 0x2C, 0x98, 0x38, 0xB2, 0xC0, 0x51, 0x8A,
+  0x80, 0xE1, 0x21, 0x88, 0xE3, 0x20, 0x29, 0xBA, 0x22, 0xD2, 0x29, 0x88, 0x91, 0x3F, 0xA0, 0x81,
+  0x4B, 0xC1, 0x59, 0xB9, 0x81, 0x83, 0x1C, 0xA8, 0xE6, 0xFE, 0x26, 0x00, 0x41, 0xD8, 0x39, 0xA1,
+  0x4D, 0xB0, 0x3B, 0xB1, 0x92, 0x59, 0xAD, 0x07, 0x0B, 0x91, 0x80, 0x09, 0x84, 0x1F, 0x91, 0x20,
+  0xBA, 0x41, 0xA0, 0xA9, 0x93, 0x23, 0x8F, 0xA6, 0x4B, 0xA1, 0x08, 0x18, 0x2A, 0xF5, 0x20, 0x98,
+  0x28, 0x88, 0x99, 0x85, 0x19, 0xC2, 0x11, 0x99, 0x23, 0x9C, 0x95, 0x39, 0x19, 0x89, 0x04, 0x3F,
+  0xA8, 0x14, 0x2C, 0x29, 0xAA, 0x97, 0x18, 0x09, 0x08, 0x11, 0x89, 0xB4, 0x5F, 0xB1, 0x18, 0xA2,
+  0x18, 0x89, 0x93, 0x30, 0x1C, 0xF2, 0x10, 0x08, 0x04, 0x0F, 0x81, 0x29, 0x90, 0x4B, 0x88, 0xA1,
+  0x19, 0x12, 0xF9, 0x28, 0xC2, 0x18, 0x3C, 0xA2, 0x8C, 0xB5, 0x10, 0x8A, 0x50, 0xEA, 0x13, 0x9A,
+  0x80, 0x11, 0x9D, 0xA4, 0x48, 0x9B, 0x92, 0x48, 0x9B, 0x1A, 0xA7, 0xB1, 0x11, 0x8A, 0xB2, 0x6B,
+  0xB4, 0x2C, 0x90, 0xE3, 0x59, 0xB0, 0x20, 0x0B, 0x94, 0x88, 0x88, 0x84, 0xF3, 0xFC, 0x29, 0x00,
+  0x2B, 0x80, 0xE1, 0x12, 0x3D, 0xB0, 0x21, 0x80, 0xC2, 0xB8, 0x06, 0x81, 0x39, 0xA8, 0xA4, 0x48,
+  0x0F, 0x84, 0x09, 0x01, 0xA8, 0x93, 0x6A, 0x89, 0xB5, 0x7B, 0xA0, 0x10, 0x18, 0x99, 0x21, 0xB9,
+  0x05, 0x2A, 0xB3, 0x2F, 0xA2, 0xB4, 0x4A, 0xC1, 0x12, 0x08, 0xB8, 0x91, 0x03, 0x48, 0xDB, 0x04,
+  0x1D, 0xA5, 0x88, 0x2A, 0xA2, 0x40, 0x0F, 0x18, 0xA1, 0xB1, 0x79, 0xA9, 0xA4, 0x39, 0xD2, 0x29,
+  0x98, 0x81, 0x49, 0xD9, 0xA3, 0x30, 0x1E, 0x18, 0x89, 0xC0, 0x13, 0x89, 0xC9, 0x86, 0x8A, 0x93,
+  0x2A, 0x98, 0xA0, 0x3D, 0xC6, 0x92, 0x39, 0x9B, 0xA6, 0x98, 0x94, 0x3B, 0xC2, 0x91, 0x21, 0x09,
+  0xDA, 0x04, 0x2C, 0x95, 0x9C, 0x06, 0x1C, 0x81, 0x88, 0x01, 0x90, 0x1A, 0xC5, 0x30, 0x2C, 0xF2,
+  0x61, 0xAB, 0x05, 0x0A, 0x18, 0xA9, 0x38, 0xB6, 0x28, 0xA9, 0x13, 0x5A, 0x8D, 0x21, 0xA9, 0x24,
+  0x59, 0x07, 0x38, 0x00, 0xAC, 0x42, 0xAA, 0x08, 0x02, 0xAA, 0x52, 0x8A, 0x02, 0x08, 0x0A, 0xC7,
+  0x49, 0x89, 0x39, 0xB2, 0x92, 0x2B, 0xA1, 0x2C, 0x08, 0x0B, 0xB5, 0x23, 0xFA, 0x28, 0x80, 0x3A,
+  0x03, 0x9B, 0x15, 0x8C, 0xC1, 0x2B, 0xA7, 0x90, 0x3B, 0x90, 0x4B, 0xB7, 0x3A, 0x09, 0xA9, 0x04,
+  0xAA, 0x04, 0x1C, 0x18, 0xC2, 0x02, 0x28, 0x0F, 0x93, 0xD0, 0x41, 0x0C, 0x90, 0x91, 0x20, 0xAA,
+  0x1F, 0x93, 0xAE, 0x83, 0x9B, 0xB2, 0x71, 0x18, 0x44, 0x01, 0x43, 0x82, 0x9E, 0x81, 0xA9, 0x2A,
+  0xDC, 0xAA, 0x98, 0xAA, 0x21, 0xAF, 0x31, 0x10, 0x77, 0x01, 0x21, 0x93, 0xAD, 0x20, 0x81, 0x8A,
+  0xB9, 0xAF, 0x88, 0x91, 0x8A, 0x80, 0x0C, 0x00, 0x95, 0x53, 0x53, 0x21, 0x23, 0xF8, 0x1A, 0x01,
+  0x18, 0xB8, 0xFC, 0x88, 0x00, 0x89, 0xA1, 0xBA, 0x01, 0x20, 0x10, 0x73, 0x25, 0x23, 0x13, 0xDD,
+  0x08, 0x22, 0x88, 0xC8, 0x0B, 0x12, 0x3F, 0x00, 0xDC, 0x09, 0x11, 0x88, 0xB8, 0x9D, 0x12, 0x91,
+  0x01, 0x61, 0x33, 0x34, 0x93, 0xCC, 0x19, 0x43, 0xA0, 0xCA, 0xCC, 0x0A, 0x22, 0xB8, 0xC9, 0x9A,
+  0x11, 0x82, 0x14, 0x1F, 0x74, 0x01, 0x88, 0x90, 0x1A, 0x31, 0xA1, 0xDA, 0xCB, 0x19, 0x21, 0xAA,
+  0xA9, 0x8D, 0x83, 0x0A, 0x72, 0xBB, 0x47, 0x82, 0x28, 0x12, 0xAF, 0x20, 0x85, 0xAA, 0x19, 0xA9,
+  0x2A, 0x84, 0xDB, 0x38, 0x91, 0x9A, 0x10, 0xA0, 0x73, 0x25, 0x88, 0x10, 0x90, 0x1B, 0x43, 0xB8,
+  0xBC, 0x8B, 0x8A, 0x1A, 0xD2, 0x9C, 0x20, 0x00, 0xBC, 0x90, 0x04, 0x67, 0x12, 0x88, 0x11, 0xB8,
+  0x28, 0x25, 0xCB, 0xAB, 0xA9, 0xA9, 0x29, 0xD8, 0x9B, 0x22, 0x2A, 0xBF, 0x11, 0x85, 0x78, 0x33,
+  0x89, 0x41, 0xB2, 0x9C, 0x62, 0xA1, 0xAD, 0x08, 0x98, 0x09, 0xA8, 0x89, 0x00, 0xA2, 0x9E, 0x02,
+  0x82, 0x71, 0x25, 0x08, 0x42, 0xB0, 0x8B, 0x54, 0x38, 0x28, 0x43, 0x00, 0xA0, 0x9E, 0x08, 0x98,
+  0x09, 0x8A, 0x99, 0x11, 0xA1, 0x8D, 0x10, 0x02, 0x7A, 0x36, 0x90, 0x48, 0x04, 0xBC, 0x40, 0x84,
+  0xBB, 0x1A, 0x98, 0x99, 0x90, 0x9B, 0x2A, 0x06, 0xDB, 0x11, 0x28, 0x98, 0x47, 0x02, 0x19, 0x34,
+  0xFA, 0x39, 0x13, 0xCB, 0x89, 0x90, 0x9A, 0x80, 0xBA, 0x39, 0x84, 0x9D, 0x90, 0x21, 0xA3, 0x72,
+  0x35, 0x00, 0x40, 0xB0, 0x0C, 0x25, 0xB0, 0xAD, 0x88, 0x80, 0xCA, 0x08, 0x88, 0x08, 0x88, 0xAB,
+  0x06, 0x1A, 0x58, 0x36, 0x81, 0x31, 0x85, 0xAC, 0x50, 0x82, 0xDB, 0x89, 0x88, 0x89, 0xA9, 0x8A,
+  0x02, 0xB8, 0x8A, 0x80, 0x7B, 0xA5, 0x42, 0x25, 0x10, 0x12, 0xD9, 0x38, 0x05, 0xD9, 0x8A, 0x89,
+  0x88, 0xAB, 0x98, 0xC0, 0x22, 0xBB, 0x3A, 0x01, 0x7B, 0x68, 0x24, 0x01, 0x34, 0xA0, 0x0E, 0x33,
+  0xA0, 0x9D, 0xAB, 0x18, 0xB0, 0x9C, 0x09, 0x3B, 0xA3, 0x9E, 0x83, 0xA8, 0x77, 0xDF, 0x37, 0x00,
+  0x07, 0x42, 0x51, 0x20, 0x02, 0xC9, 0x30, 0x04, 0xAA, 0xDC, 0x0B, 0x01, 0xCB, 0x08, 0xC0, 0x48,
+  0xA8, 0x29, 0x90, 0x6A, 0x82, 0x14, 0x07, 0x11, 0x81, 0x9B, 0x42, 0xA2, 0xAB, 0xCE, 0x19, 0x91,
+  0x8C, 0x90, 0x99, 0x21, 0xA9, 0x3B, 0xF3, 0x42, 0x29, 0x35, 0x82, 0x63, 0xB2, 0x0E, 0x23, 0xB9,
+  0x98, 0xCD, 0x28, 0xA0, 0x89, 0xA9, 0x18, 0x92, 0x4B, 0xE8, 0x28, 0x86, 0x39, 0x25, 0x09, 0x25,
+  0xC9, 0x49, 0x91, 0x09, 0xD8, 0x8B, 0x00, 0x89, 0x98, 0x9A, 0x00, 0x10, 0x1B, 0xF3, 0x2A, 0x87,
+  0x7A, 0x03, 0x0A, 0x16, 0xAA, 0x30, 0x89, 0x38, 0xFA, 0x89, 0x98, 0x38, 0xD8, 0x08, 0x90, 0x39,
+  0x01, 0x9D, 0x82, 0x83, 0x78, 0x04, 0x28, 0x04, 0x99, 0x28, 0x89, 0x02, 0xCD, 0xBA, 0x8A, 0x12,
+  0x8E, 0x92, 0xBB, 0x72, 0x9A, 0x02, 0xB9, 0x61, 0x49, 0x22, 0x81, 0x16, 0x89, 0x19, 0x98, 0x83,
+  0x7F, 0x26, 0x3C, 0x00, 0xCA, 0xAD, 0x8C, 0x91, 0x81, 0x1B, 0xAC, 0x38, 0xF4, 0x31, 0x8C, 0x10,
+  0xA2, 0x55, 0x08, 0x11, 0x93, 0x98, 0x19, 0x1B, 0xB3, 0xBE, 0xFA, 0x08, 0x18, 0x89, 0xC1, 0x09,
+  0x80, 0x30, 0x8B, 0xF3, 0x70, 0x19, 0x05, 0x28, 0x01, 0x08, 0xB8, 0x11, 0x89, 0xB8, 0xEE, 0x09,
+  0x09, 0x80, 0xB1, 0x88, 0x2C, 0x80, 0x02, 0x8A, 0x2B, 0x17, 0x72, 0x85, 0x30, 0x91, 0x80, 0x8A,
+  0x08, 0x19, 0xFB, 0xDA, 0x80, 0x3C, 0xA8, 0x82, 0x9A, 0x30, 0x8C, 0xA4, 0x39, 0x29, 0x87, 0x44,
+  0x28, 0x04, 0x29, 0xD8, 0x00, 0x99, 0x01, 0x9E, 0xC8, 0x09, 0x09, 0x00, 0xA1, 0x88, 0x29, 0x1A,
+  0xD8, 0x94, 0x79, 0x81, 0x27, 0x39, 0x83, 0x38, 0xBC, 0x91, 0x0B, 0xE2, 0x89, 0x8D, 0x99, 0x00,
+  0x2A, 0xB1, 0x11, 0x1B, 0xC1, 0x18, 0xF2, 0x53, 0x5A, 0x03, 0x62, 0x80, 0x92, 0x1C, 0xB9, 0xA1,
+  0x09, 0xAC, 0x0B, 0x9C, 0x5C, 0xE6, 0x3C, 0x00, 0xC2, 0x21, 0x1B, 0x18, 0xA8, 0x93, 0x1B, 0x1B,
+  0x17, 0x74, 0x22, 0x06, 0x21, 0xA8, 0x88, 0x9D, 0xB0, 0x09, 0x9C, 0xA8, 0x9A, 0xC4, 0x20, 0x0C,
+  0x81, 0x88, 0xB6, 0x59, 0x0A, 0xB3, 0x55, 0x28, 0x03, 0x32, 0xA9, 0xA1, 0x8F, 0xC8, 0x08, 0x0D,
+  0x98, 0x80, 0x90, 0x01, 0x1B, 0x89, 0xA3, 0x38, 0xA9, 0x72, 0x18, 0x37, 0x71, 0x10, 0x02, 0x08,
+  0xA9, 0x9A, 0xBD, 0xB9, 0x0B, 0x8B, 0xA2, 0x10, 0x89, 0x09, 0x1E, 0xD1, 0x82, 0x39, 0x68, 0x12,
+  0x37, 0x40, 0x12, 0x22, 0xA8, 0xA8, 0x8F, 0xCB, 0xAA, 0x9B, 0x89, 0x88, 0x91, 0x31, 0x2A, 0x84,
+  0x28, 0xC2, 0x72, 0x19, 0x87, 0x38, 0x81, 0x42, 0x18, 0x83, 0x08, 0xA9, 0xCB, 0xBE, 0xDA, 0x9A,
+  0x99, 0x99, 0x80, 0x28, 0x05, 0x31, 0x83, 0x34, 0x38, 0x82, 0x31, 0xA0, 0x4C, 0x81, 0x23, 0x14,
+  0x78, 0x02, 0x83, 0x00, 0xCA, 0xCB, 0xAE, 0xAA, 0x16, 0xFC, 0x2F, 0x00, 0xAC, 0xB9, 0xA9, 0x09,
+  0x08, 0x44, 0x21, 0x27, 0x20, 0x03, 0x23, 0x89, 0x94, 0xB2, 0x58, 0x88, 0x20, 0x20, 0x31, 0x87,
+  0x80, 0xA0, 0x0D, 0xAC, 0xBC, 0xAB, 0x8C, 0xBA, 0x88, 0x34, 0x42, 0x40, 0x82, 0x80, 0x78, 0xB1,
+  0x01, 0x98, 0xA1, 0x48, 0x4C, 0x81, 0x60, 0x80, 0x00, 0x08, 0x88, 0xC1, 0x0D, 0xAC, 0xC8, 0x19,
+  0xDA, 0x08, 0x80, 0x80, 0x08, 0x08, 0x80, 0x80, 0x08, 0x08, 0x77, 0x00, 0x48, 0x83, 0x08, 0x80,
+  0x80, 0xBF, 0x00, 0x08, 0x08, 0xFC, 0x80, 0x80, 0x80, 0x08, 0xF0, 0x0A, 0x28, 0x05, 0x08, 0x08,
+  0x88, 0x80, 0x71, 0x82, 0x00, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08,
+  0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x79, 0x7F, 0x77, 0x80, 0x38, 0x00, 0xC6, 0x89, 0xB1, 0x71,
+  0x3F, 0xD6, 0x48, 0xB8, 0x82, 0x3B, 0x93, 0x9C, 0x15, 0x8A, 0x91, 0x49, 0x30, 0x06, 0x39, 0x00,
+  0xF8, 0x30, 0x89, 0x98, 0x82, 0x18, 0xAA, 0x24, 0xA9, 0x03, 0x0B, 0x05, 0x09, 0x2C, 0x8E, 0xA6,
+  0x88, 0x92, 0x08, 0xB5, 0x49, 0x99, 0x10, 0x9A, 0x94, 0x8B, 0xE6, 0x11, 0x0A, 0x81, 0x91, 0x01,
+  0x09, 0x88, 0x1A, 0x6A, 0x88, 0x99, 0x7A, 0x89, 0xA3, 0xA1, 0x97, 0x2A, 0xD3, 0x49, 0x9A, 0x83,
+  0x2C, 0x18, 0x0D, 0xB3, 0x18, 0x29, 0xB1, 0x7A, 0x80, 0x81, 0x08, 0x90, 0x29, 0x29, 0x03, 0x81,
+  0x48, 0xEA, 0x01, 0xD1, 0x91, 0xB9, 0xA2, 0xB9, 0x01, 0x18, 0x7B, 0x85, 0x48, 0x10, 0x30, 0x8A,
+  0x23, 0x80, 0x48, 0xC0, 0x80, 0x61, 0x0B, 0x87, 0x3A, 0x08, 0x08, 0xAD, 0x00, 0x90, 0x9E, 0x00,
+  0x08, 0xE9, 0x31, 0x8A, 0x83, 0x80, 0x90, 0x37, 0xD8, 0x30, 0x90, 0x2A, 0x9D, 0x52, 0xA9, 0xA0,
+  0x08, 0x01, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0xAF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0xE6, 0xFD, 0x19, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0xE2, 0x2F, 0xFF, 0x93, 0x1A, 0x88, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x88, 0xF4, 0x77,
+  0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xD2, 0x77, 0x86,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08,
+  0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAA, 0xF7, 0xFF, 0x8F, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x70, 0x11, 0x05, 0x98, 0x20, 0x09, 0x80, 0x80, 0xA0, 0x5D, 0xF9, 0x22, 0x88, 0x80,
+  0x80, 0xD1, 0x5B, 0xA9, 0x80, 0x9D, 0x82, 0x5A, 0xD1, 0x01, 0x50, 0x8A, 0x11, 0xAB, 0x22, 0x8F,
+  0x80, 0x80, 0x80, 0x38, 0x53, 0xFE, 0x1F, 0x00, 0x01, 0x16, 0x18, 0x81, 0x80, 0x80, 0x80, 0x00,
+  0xFB, 0x2E, 0x5A, 0xD0, 0x00, 0x80, 0xA0, 0x78, 0x09, 0xA8, 0x00, 0x7B, 0x90, 0x92, 0x89, 0x80,
+  0x3B, 0xC0, 0x59, 0xC0, 0x02, 0x3B, 0x98, 0x70, 0xA0, 0x69, 0x08, 0xAA, 0x32, 0x8F, 0xB2, 0x91,
+  0x83, 0x1D, 0xA4, 0x3A, 0x5A, 0xC1, 0x13, 0x0B, 0x81, 0x81, 0xA1, 0x3F, 0xE2, 0x49, 0x80, 0x9A,
+  0x95, 0x0B, 0x08, 0x88, 0x62, 0x80, 0x80, 0x80, 0x08, 0x90, 0x74, 0x80, 0x14, 0xBA, 0x18, 0xFD,
+  0x88, 0x88, 0x7B, 0xD0, 0x33, 0xDB, 0x29, 0x94, 0x0A, 0x43, 0xBB, 0x34, 0x91, 0x8A, 0x02, 0x88,
+  0x52, 0xA9, 0x89, 0xBA, 0x28, 0xB1, 0x5B, 0xA1, 0x0C, 0xA0, 0xAC, 0xBB, 0xBC, 0x0C, 0xD8, 0xBD,
+  0x91, 0xAB, 0x71, 0x83, 0x77, 0x04, 0x31, 0xB2, 0x9E, 0x98, 0xA9, 0x12, 0xC9, 0x0B, 0xC0, 0x0A,
+  0x38, 0xD0, 0x32, 0xB8, 0x3A, 0xB2, 0x1E, 0x37, 0xCF, 0xFA, 0x3E, 0x00, 0x43, 0x33, 0x21, 0xA1,
+  0xAF, 0x98, 0x08, 0x10, 0xFB, 0xAA, 0x99, 0x08, 0x22, 0x01, 0xFA, 0x18, 0x88, 0x10, 0xB0, 0x49,
+  0x03, 0x47, 0x48, 0x04, 0x11, 0x42, 0xF9, 0x0A, 0x08, 0x08, 0xB0, 0xAD, 0x0A, 0x81, 0x84, 0x38,
+  0x9D, 0x08, 0x03, 0x8B, 0x53, 0xCD, 0x14, 0x18, 0x28, 0x05, 0x20, 0x31, 0xA1, 0xDB, 0x0A, 0x88,
+  0x80, 0xFB, 0x9D, 0x18, 0x81, 0x28, 0xB0, 0x9B, 0x17, 0x99, 0x00, 0x88, 0x81, 0x33, 0x3C, 0xA7,
+  0x72, 0x92, 0x10, 0x04, 0xAE, 0x00, 0x90, 0x10, 0xF9, 0x8A, 0x00, 0x20, 0x98, 0x99, 0x82, 0x5A,
+  0xB2, 0xA9, 0x33, 0x2C, 0x05, 0x9B, 0x17, 0x48, 0x83, 0x00, 0x03, 0xAF, 0x08, 0x91, 0x18, 0xFA,
+  0x8D, 0x02, 0x00, 0x89, 0xB0, 0x60, 0x88, 0xB0, 0x31, 0x99, 0x41, 0xA8, 0x88, 0x57, 0x89, 0x23,
+  0x80, 0x30, 0xE8, 0x9B, 0x22, 0xA8, 0xD9, 0x9E, 0x18, 0x83, 0x88, 0x0C, 0x12, 0xE4, 0x41, 0x00,
+  0x92, 0x22, 0x1A, 0xD9, 0x30, 0x02, 0x2A, 0xB0, 0x71, 0x07, 0x38, 0x92, 0x30, 0xA4, 0xAF, 0x11,
+  0x90, 0x8A, 0xFB, 0x2A, 0x83, 0x8B, 0x91, 0x3A, 0x22, 0xF8, 0x20, 0xB8, 0x42, 0x1A, 0xAA, 0x17,
+  0x39, 0x08, 0x17, 0x88, 0x31, 0xC9, 0x8A, 0x01, 0xA9, 0xA8, 0xEF, 0x00, 0x11, 0xAB, 0x01, 0xA3,
+  0x58, 0xA9, 0x80, 0x21, 0x80, 0x98, 0x4A, 0x14, 0x11, 0x79, 0x07, 0x90, 0x31, 0xB9, 0x9A, 0x92,
+  0x89, 0xFA, 0x8D, 0x80, 0x80, 0xA8, 0x28, 0x03, 0x9C, 0x85, 0xB9, 0x45, 0xAA, 0x40, 0xB0, 0x40,
+  0x11, 0x29, 0x27, 0x90, 0x41, 0xC8, 0x8B, 0x12, 0xA8, 0xDC, 0x8B, 0x00, 0x80, 0xA9, 0x80, 0x71,
+  0x91, 0x0C, 0x07, 0x0B, 0x81, 0x19, 0x85, 0x9A, 0x22, 0x19, 0x57, 0xB8, 0x38, 0x93, 0x9C, 0x01,
+  0x9A, 0x08, 0xBE, 0x08, 0x88, 0x09, 0x10, 0x80, 0x80, 0x10, 0xB4, 0x52, 0x1F, 0x10, 0xB0, 0x33,
+  0x70, 0xFF, 0x39, 0x00, 0xAA, 0x72, 0x33, 0x03, 0xB9, 0x73, 0xD4, 0x0B, 0x92, 0x99, 0xA9, 0xAE,
+  0x01, 0x88, 0x80, 0x09, 0x40, 0xB0, 0x93, 0x40, 0xA0, 0x48, 0xBA, 0x41, 0x85, 0x1A, 0x63, 0x15,
+  0x91, 0x40, 0xA2, 0xCA, 0x08, 0xAA, 0x98, 0xFD, 0x0A, 0x00, 0x98, 0x1C, 0x15, 0xA9, 0x31, 0xA8,
+  0x48, 0xC3, 0x2C, 0x83, 0x08, 0x92, 0x68, 0x38, 0x36, 0xC0, 0x48, 0x93, 0x9E, 0x10, 0xA9, 0x08,
+  0xDA, 0x8B, 0x12, 0xC0, 0x28, 0x21, 0x09, 0x94, 0x88, 0x11, 0x84, 0x8E, 0x11, 0x02, 0x19, 0x79,
+  0x12, 0x15, 0x92, 0x11, 0x92, 0xAF, 0x18, 0xA9, 0xCB, 0xAC, 0x0A, 0x91, 0x8A, 0x24, 0x39, 0x80,
+  0x1A, 0x17, 0x1E, 0x03, 0x8F, 0x14, 0x8B, 0x20, 0x01, 0x31, 0x32, 0x81, 0x9A, 0x67, 0xDB, 0x18,
+  0xB0, 0x89, 0xB8, 0x9B, 0x31, 0xBB, 0x53, 0xA0, 0x30, 0x85, 0x9C, 0x06, 0xA8, 0x48, 0xB8, 0x30,
+  0x93, 0x19, 0x25, 0x24, 0x43, 0x1A, 0x3C, 0x00, 0x80, 0x31, 0xA8, 0x9E, 0xA0, 0xAD, 0x91, 0xBE,
+  0x0A, 0x18, 0x08, 0xB1, 0x53, 0xA2, 0x79, 0x98, 0x28, 0x95, 0x8D, 0x03, 0x19, 0x82, 0x98, 0x27,
+  0x20, 0x01, 0x10, 0x82, 0xBF, 0x20, 0xC9, 0x1B, 0xFA, 0x8A, 0x83, 0x9A, 0x32, 0x19, 0x00, 0x32,
+  0xC9, 0x71, 0xA2, 0x0E, 0x83, 0x0A, 0x15, 0x9A, 0x34, 0x20, 0x41, 0x88, 0x92, 0xBC, 0x09, 0xB8,
+  0xAD, 0xFA, 0x0C, 0x82, 0x9A, 0x21, 0xD1, 0x43, 0x99, 0x39, 0x83, 0xA9, 0x80, 0x11, 0x48, 0x19,
+  0x61, 0x33, 0x5A, 0x37, 0x9A, 0x33, 0xEC, 0x29, 0xA0, 0x8C, 0xA0, 0xAE, 0x12, 0x99, 0x10, 0x09,
+  0x52, 0xA9, 0x21, 0xB3, 0x7B, 0xB1, 0x2A, 0x83, 0x99, 0x34, 0x21, 0x5A, 0x27, 0x88, 0x21, 0xFA,
+  0x29, 0xA1, 0xBB, 0x88, 0xCD, 0x18, 0x80, 0x8A, 0x24, 0x99, 0x22, 0x81, 0x49, 0x82, 0xC1, 0x89,
+  0x48, 0x23, 0x09, 0x61, 0x84, 0x56, 0x91, 0x29, 0x55, 0x20, 0x3D, 0x00, 0x03, 0xBE, 0x20, 0xC9,
+  0x0A, 0xCA, 0x9C, 0x02, 0x98, 0x18, 0x12, 0x10, 0x03, 0x98, 0x70, 0xA1, 0x4B, 0xD2, 0x28, 0x12,
+  0x99, 0x47, 0x48, 0x22, 0x99, 0x31, 0xD1, 0x8B, 0xC8, 0x8C, 0xB8, 0xBD, 0x88, 0x09, 0x81, 0x28,
+  0x24, 0xA8, 0x32, 0x88, 0x27, 0xAD, 0x94, 0x2B, 0x33, 0xAC, 0x54, 0x91, 0x72, 0x92, 0x1A, 0x13,
+  0xCA, 0x9A, 0x88, 0xAC, 0xAA, 0xCD, 0x88, 0x12, 0x99, 0x60, 0x88, 0x22, 0x90, 0x08, 0x85, 0x9C,
+  0x23, 0xAC, 0x42, 0xA8, 0x62, 0x13, 0x31, 0x93, 0x48, 0x82, 0xBD, 0xA8, 0xAC, 0x9A, 0xED, 0x8A,
+  0x10, 0x80, 0x08, 0x11, 0x02, 0x72, 0xA0, 0x39, 0xB1, 0x89, 0x40, 0xF0, 0x6A, 0x92, 0x38, 0x14,
+  0x10, 0x32, 0x98, 0x23, 0xFB, 0x8B, 0xCA, 0x9A, 0xBA, 0xCC, 0x88, 0x30, 0x83, 0x29, 0x48, 0x14,
+  0x10, 0xB2, 0xA9, 0x02, 0x8F, 0x04, 0x9A, 0x36, 0x18, 0x73, 0x11, 0x11, 0x82, 0x1E, 0x39, 0x00,
+  0x10, 0x92, 0xBC, 0xAB, 0xBD, 0xA9, 0xCD, 0xAC, 0x00, 0x00, 0x11, 0x08, 0x41, 0x30, 0x02, 0x01,
+  0x00, 0xC9, 0x8A, 0x80, 0x31, 0x73, 0x33, 0x47, 0x11, 0x15, 0x08, 0x23, 0xE8, 0xAB, 0xAA, 0xAD,
+  0xB8, 0xCC, 0x8A, 0x80, 0x18, 0x03, 0x30, 0x43, 0x02, 0x30, 0x93, 0x82, 0x1D, 0xB5, 0x59, 0x91,
+  0x58, 0x23, 0x32, 0x52, 0x04, 0x20, 0x15, 0xB8, 0xAA, 0xFB, 0xAC, 0xA9, 0xBD, 0x99, 0x98, 0x19,
+  0x22, 0x21, 0x35, 0x03, 0x52, 0x03, 0x8A, 0xA2, 0x28, 0x88, 0x17, 0x29, 0x25, 0x02, 0x55, 0x81,
+  0x33, 0x92, 0x9B, 0xD8, 0xAF, 0xAA, 0xCC, 0x9A, 0xA9, 0x1A, 0x80, 0x31, 0x44, 0x11, 0x44, 0x10,
+  0x11, 0x98, 0x29, 0x98, 0x80, 0x81, 0x79, 0x05, 0x40, 0x11, 0x24, 0x12, 0x99, 0xB8, 0xDF, 0xB9,
+  0xBC, 0xAB, 0xBA, 0x9A, 0x09, 0x21, 0x25, 0x43, 0x24, 0x22, 0x32, 0x08, 0x08, 0xA0, 0x9B, 0x13,
+  0xF1, 0xFE, 0x25, 0x00, 0x7B, 0x86, 0x51, 0x12, 0x33, 0x14, 0x99, 0x98, 0xCF, 0xAA, 0xBD, 0xAB,
+  0xBA, 0x9B, 0x00, 0x28, 0x45, 0x03, 0x63, 0x12, 0x10, 0x03, 0x8A, 0x80, 0xA0, 0x20, 0x18, 0x24,
+  0x74, 0x03, 0x54, 0x82, 0x80, 0x80, 0xBE, 0xA9, 0xCD, 0xAB, 0xB9, 0x9B, 0x08, 0x18, 0x35, 0x12,
+  0x45, 0x12, 0x31, 0x00, 0x08, 0xA2, 0x1A, 0x80, 0x3B, 0x07, 0x41, 0x34, 0x34, 0x13, 0x80, 0xA0,
+  0xCF, 0xAB, 0xBE, 0xBB, 0xBA, 0xAB, 0x89, 0x00, 0x34, 0x53, 0x43, 0x33, 0x22, 0x13, 0x0B, 0xA4,
+  0x2B, 0xC3, 0x1A, 0x14, 0x38, 0x67, 0x11, 0x42, 0x90, 0x09, 0xF9, 0xAB, 0xCA, 0xBC, 0x9A, 0xCB,
+  0x88, 0x80, 0x41, 0x13, 0x52, 0x23, 0x31, 0x12, 0x80, 0x80, 0x80, 0x80, 0x9D, 0x35, 0x00, 0x37,
+  0x21, 0x44, 0x01, 0x8A, 0xC8, 0xAE, 0xCA, 0xBC, 0xAA, 0xBA, 0x8A, 0x10, 0x21, 0x36, 0x31, 0x35,
+  0x22, 0x11, 0x82, 0x08, 0x3A, 0x02, 0x2B, 0x00, 0xB0, 0x1B, 0xB2, 0x69, 0x94, 0x73, 0x14, 0x31,
+  0x24, 0x98, 0x80, 0xFC, 0xA9, 0xDA, 0xAB, 0xA9, 0xAB, 0x80, 0x80, 0x54, 0x11, 0x52, 0x12, 0x11,
+  0x02, 0x89, 0x82, 0xAA, 0x00, 0x0A, 0x63, 0x00, 0x65, 0x12, 0x33, 0x03, 0xA9, 0xD8, 0xBE, 0xAC,
+  0xCC, 0x9B, 0xA9, 0x0B, 0x08, 0x38, 0x44, 0x22, 0x53, 0x23, 0x18, 0x82, 0x80, 0xB8, 0x09, 0x08,
+  0x28, 0x37, 0x41, 0x27, 0x31, 0x43, 0x98, 0x08, 0xCD, 0xBB, 0xCD, 0xAB, 0xBA, 0x9B, 0x90, 0x28,
+  0x62, 0x23, 0x52, 0x13, 0x31, 0x02, 0x0A, 0x08, 0xCA, 0x41, 0x08, 0x48, 0x06, 0x51, 0x22, 0x33,
+  0x12, 0xB8, 0xCA, 0xBF, 0xCC, 0xBB, 0xAC, 0xAA, 0x0A, 0x89, 0x22, 0x44, 0x32, 0x34, 0x22, 0x22,
+  0x91, 0x9B, 0x00, 0xCB, 0xA5, 0x4A, 0x14, 0x41, 0x24, 0x33, 0x34, 0x00, 0xCA, 0xCD, 0xDA, 0xCB,
+  0xAB, 0xBB, 0x8A, 0xA9, 0x21, 0x35, 0x42, 0x43, 0x29, 0xF7, 0x31, 0x00, 0x22, 0x13, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x37, 0x63, 0x33, 0x44, 0x22, 0x02, 0x0A, 0xFB, 0xBC, 0xBC, 0xBD, 0xAA,
+  0x9A, 0x89, 0x28, 0x43, 0x43, 0x43, 0x23, 0x23, 0x12, 0x88, 0x80, 0x80, 0x80, 0x90, 0x65, 0x20,
+  0x34, 0x24, 0x63, 0x80, 0x00, 0xCA, 0xDB, 0xCC, 0xAB, 0xAC, 0xAA, 0xA9, 0x29, 0x21, 0x43, 0x43,
+  0x24, 0x24, 0x38, 0x81, 0x80, 0x80, 0x08, 0x80, 0x80, 0x78, 0x84, 0x08, 0x25, 0x09, 0x80, 0x18,
+  0xDC, 0xB0, 0xAF, 0xBA, 0xAB, 0xCA, 0x0B, 0x08, 0x18, 0x06, 0x41, 0x13, 0x32, 0x51, 0x80, 0x42,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x47, 0x1B, 0x82, 0x08, 0x08, 0xF0, 0x0B, 0xE8, 0x09, 0xBB, 0x00,
+  0x9E, 0x80, 0x80, 0x38, 0x06, 0x88, 0x51, 0x81, 0x28, 0x85, 0x80, 0x80, 0x00, 0x88, 0x80, 0xF1,
+  0x0D, 0x08, 0x08, 0x80, 0x80, 0x08, 0x18, 0xEF, 0x00, 0x08, 0xDA, 0x08, 0xCF, 0xFB, 0x28, 0x00,
+  0x08, 0x08, 0x08, 0x27, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x18, 0xFF, 0x80, 0x18, 0xF4, 0x25,
+  0x8D, 0x93, 0x0A, 0xAA, 0x33, 0x9A, 0x81, 0x25, 0xAE, 0x95, 0x89, 0x20, 0xA2, 0x29, 0x24, 0xC0,
+  0x1B, 0x01, 0x81, 0x29, 0x99, 0x41, 0x9A, 0xA9, 0xB0, 0x73, 0x99, 0xA6, 0x6B, 0x1A, 0xB0, 0x32,
+  0x8A, 0x52, 0xA9, 0x08, 0x6D, 0xAA, 0x87, 0x39, 0xA1, 0x31, 0xA9, 0x99, 0xFA, 0x3B, 0x85, 0x98,
+  0x80, 0x22, 0x82, 0x1D, 0xB2, 0x49, 0xA2, 0x4C, 0xA8, 0x19, 0xA1, 0x2A, 0x91, 0x89, 0x09, 0xC7,
+  0x20, 0xAA, 0x10, 0x18, 0x9A, 0xE3, 0x18, 0x90, 0x6C, 0xC0, 0x12, 0x1C, 0x3A, 0xD8, 0x85, 0x09,
+  0x4A, 0xC8, 0x92, 0x28, 0x0A, 0xB8, 0xB5, 0x30, 0x7C, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80,
+  // cwl
+  0xD2, 0xFE, 0x00, 0x00, 0xF0, 0xFF, 0xA9, 0xA8, 0x57, 0x0C, 0x91, 0x79, 0xB1, 0x82, 0x3D, 0xA5,
+  0x4B, 0xC1, 0x11, 0x01, 0x7B, 0xC9, 0x33, 0x9C, 0x03, 0x1A, 0x90, 0x91, 0x12, 0xAB, 0x87, 0x5B,
+  0x98, 0x4A, 0xA8, 0x92, 0x01, 0x88, 0xA0, 0x6C, 0xC4, 0x28, 0x99, 0xB2, 0x79, 0xA9, 0x30, 0x0B,
+  0xB4, 0x4A, 0xD1, 0x02, 0x0D, 0x02, 0x9A, 0x02, 0x2C, 0xC0, 0x22, 0xC9, 0x01, 0x0B, 0xA5, 0x19,
+  0xD0, 0x50, 0xAB, 0x05, 0x0C, 0xA3, 0x1A, 0x80, 0x39, 0xF8, 0x11, 0x0A, 0x81, 0x3D, 0xB1, 0x39,
+  0xA2, 0x1A, 0x2F, 0xA2, 0x08, 0x10, 0xC3, 0x1F, 0xA3, 0x91, 0x30, 0x0B, 0x29, 0x50, 0xE8, 0xA1,
+  0x93, 0x32, 0x0D, 0x08, 0x88, 0x97, 0x09, 0x29, 0x01, 0x81, 0x0C, 0x07, 0x3B, 0xF4, 0x30, 0xAA,
+  0x94, 0x48, 0xD0, 0x11, 0x98, 0x82, 0x3B, 0xC3, 0xA0, 0x24, 0x2F, 0x80, 0x28, 0xCB, 0x87, 0x19,
+  0xC1, 0x30, 0xAA, 0x85, 0x58, 0x02, 0x32, 0x00, 0x1A, 0xB2, 0x38, 0x8C, 0x94, 0xC1, 0x31, 0x9B,
+  0xA6, 0x3A, 0xC1, 0x6A, 0xB0, 0x11, 0x8A, 0x93, 0xAA, 0x14, 0x9C, 0x05, 0x9C, 0x86, 0x3B, 0x98,
+  0x3A, 0xC1, 0x21, 0xBB, 0x87, 0x2B, 0x28, 0xCB, 0x25, 0x0E, 0x83, 0x1B, 0x18, 0x8C, 0x00, 0xC2,
+  0x84, 0x0E, 0xA6, 0x5A, 0xA8, 0x30, 0xC8, 0x22, 0x8C, 0x83, 0x1D, 0xB2, 0x38, 0xC8, 0x21, 0x8A,
+  0x03, 0x2A, 0x98, 0xB6, 0x48, 0x9A, 0x48, 0xB8, 0x23, 0xDB, 0x16, 0x1D, 0xA1, 0x39, 0xB8, 0x02,
+  0x99, 0x82, 0x2A, 0x01, 0x33, 0x1B, 0xA5, 0x31, 0x09, 0x2E, 0xF5, 0x21, 0x8C, 0x11, 0x0C, 0xB4,
+  0x28, 0x80, 0x4A, 0xD0, 0x12, 0x99, 0x02, 0x3B, 0xB0, 0x12, 0xA9, 0x12, 0x4A, 0xAA, 0x87, 0x4C,
+  0x8A, 0x90, 0xC2, 0x81, 0x4C, 0x98, 0x29, 0xF3, 0x12, 0x08, 0x51, 0x2D, 0xC2, 0x11, 0xB9, 0x48,
+  0x8F, 0xC1, 0x80, 0x0A, 0x08, 0x81, 0x33, 0x17, 0xFE, 0x03, 0x38, 0x00, 0x71, 0x08, 0x02, 0x8A,
+  0xE1, 0x1B, 0xCE, 0xA1, 0x0A, 0x98, 0x33, 0x50, 0x25, 0x32, 0x01, 0x83, 0x0D, 0xFA, 0xA9, 0xAA,
+  0xB9, 0x19, 0x3A, 0x14, 0x46, 0x21, 0x04, 0x30, 0x99, 0xC8, 0xAB, 0xCC, 0xA9, 0x9B, 0x90, 0x58,
+  0x11, 0x17, 0x32, 0x03, 0x22, 0x8A, 0xE9, 0xAA, 0xBD, 0xB8, 0x9A, 0x88, 0x40, 0x32, 0x27, 0x33,
+  0x23, 0x21, 0x9A, 0xFA, 0xAB, 0xCC, 0x99, 0x9B, 0x80, 0x50, 0x21, 0x35, 0x42, 0x03, 0x12, 0x0B,
+  0xFA, 0xA9, 0x9D, 0xA9, 0x99, 0x88, 0x31, 0x61, 0x33, 0x34, 0x13, 0x02, 0x8A, 0xDC, 0xCA, 0x9C,
+  0xAB, 0xB8, 0x81, 0x41, 0x52, 0x43, 0x33, 0x13, 0x83, 0x0A, 0xBF, 0xD9, 0xAA, 0x8C, 0x9A, 0xA1,
+  0x33, 0x71, 0x32, 0x43, 0x11, 0x92, 0x98, 0x8E, 0xEB, 0xA8, 0x8B, 0x8A, 0xA1, 0x24, 0x51, 0x32,
+  0x34, 0x21, 0x90, 0xB0, 0xAD, 0xDC, 0xA9, 0x9A, 0x1B, 0x09, 0x15, 0x53, 0xB7, 0xF4, 0x43, 0x00,
+  0x42, 0x22, 0x21, 0x90, 0xD8, 0xBA, 0xAD, 0xCA, 0x99, 0x1A, 0x29, 0x05, 0x25, 0x42, 0x12, 0x12,
+  0x88, 0xCA, 0xEA, 0xAA, 0xBB, 0xB9, 0x80, 0x50, 0x31, 0x26, 0x24, 0x12, 0x02, 0x98, 0xCB, 0xDB,
+  0xAC, 0x9B, 0xAA, 0x91, 0x42, 0x71, 0x22, 0x14, 0x12, 0x01, 0xA8, 0xBB, 0xCE, 0xAA, 0x9B, 0x0B,
+  0x98, 0x06, 0x43, 0x52, 0x21, 0x12, 0x80, 0x99, 0xCC, 0xCB, 0xBA, 0xAA, 0x0B, 0x39, 0x14, 0x27,
+  0x24, 0x22, 0x21, 0x89, 0xD9, 0xBA, 0xAE, 0xAA, 0xB9, 0x91, 0x40, 0x51, 0x33, 0x25, 0x12, 0x82,
+  0xA8, 0xCB, 0xAD, 0x9D, 0xAA, 0x89, 0x88, 0x04, 0x44, 0x42, 0x22, 0x12, 0x91, 0xB9, 0xCC, 0xDB,
+  0xBA, 0xAA, 0x09, 0x59, 0x31, 0x34, 0x26, 0x12, 0x21, 0x89, 0xCA, 0xDB, 0xBB, 0x9C, 0xAA, 0xA1,
+  0x24, 0x71, 0x31, 0x33, 0x22, 0x01, 0xAA, 0xDC, 0xCB, 0xBB, 0xBA, 0x09, 0x5B, 0x31, 0x26, 0x43,
+  0xF2, 0x12, 0x41, 0x00, 0x32, 0x11, 0x90, 0xBA, 0xAF, 0xCB, 0xAA, 0x9B, 0xA0, 0x23, 0x73, 0x52,
+  0x13, 0x13, 0x01, 0x99, 0xEA, 0xCA, 0xAB, 0x9C, 0x8A, 0x18, 0x12, 0x36, 0x43, 0x33, 0x31, 0x90,
+  0xC9, 0xDB, 0xBC, 0xBB, 0xBB, 0xB0, 0x23, 0x72, 0x53, 0x23, 0x23, 0x02, 0x98, 0xDB, 0xCC, 0xBB,
+  0xAB, 0x8B, 0x3A, 0x32, 0x37, 0x35, 0x32, 0x22, 0x08, 0xAB, 0xCE, 0xCA, 0xBA, 0x9A, 0x99, 0x13,
+  0x73, 0x42, 0x33, 0x22, 0x83, 0xA8, 0xBC, 0xBE, 0xCB, 0xAA, 0xA9, 0x10, 0x51, 0x53, 0x33, 0x24,
+  0x12, 0x91, 0x9A, 0xCE, 0xBA, 0xAB, 0xAB, 0x99, 0x03, 0x46, 0x52, 0x32, 0x22, 0x01, 0xA0, 0xEB,
+  0xBA, 0x9E, 0xBA, 0xA8, 0x10, 0x51, 0x32, 0x26, 0x22, 0x12, 0x08, 0xAA, 0xCD, 0xDA, 0xA9, 0x0B,
+  0x1B, 0x01, 0x34, 0x35, 0x24, 0x32, 0x10, 0xC0, 0xB9, 0xAF, 0xBA, 0xAA, 0x9A, 0x00, 0x42, 0x54,
+  0x42, 0x22, 0x12, 0x80, 0x5A, 0x2E, 0x3C, 0x00, 0xAA, 0xCD, 0xBB, 0xAC, 0xAA, 0x1A, 0x28, 0x35,
+  0x35, 0x24, 0x32, 0x81, 0xA0, 0xAC, 0xAF, 0xBA, 0x9A, 0xBA, 0x02, 0x51, 0x43, 0x34, 0x42, 0x11,
+  0x91, 0xB8, 0xDC, 0xBA, 0xAB, 0x9C, 0x98, 0x11, 0x33, 0x45, 0x33, 0x24, 0x21, 0x98, 0xB9, 0xBD,
+  0xE9, 0x89, 0xAA, 0x88, 0x09, 0x10, 0x42, 0x33, 0x35, 0x43, 0x11, 0x80, 0x98, 0xBB, 0xC9, 0xAC,
+  0xCB, 0xBB, 0xAA, 0x80, 0x21, 0x45, 0x34, 0x34, 0x32, 0x12, 0x21, 0x99, 0xBB, 0xCD, 0xEB, 0xAA,
+  0xAB, 0x89, 0x08, 0x40, 0x22, 0x36, 0x32, 0x33, 0x12, 0x08, 0xD8, 0xC9, 0xBB, 0xAD, 0xAA, 0xB9,
+  0x09, 0x28, 0x15, 0x34, 0x33, 0x24, 0x14, 0x18, 0xCB, 0xC9, 0xC9, 0x9C, 0x9B, 0x2B, 0xAA, 0x10,
+  0x07, 0x13, 0x33, 0x48, 0x83, 0x00, 0xFB, 0xB0, 0x8B, 0x8D, 0xB0, 0x0C, 0x80, 0x48, 0x94, 0x51,
+  0x80, 0x80, 0x80, 0x80, 0xA1, 0x9F, 0x80, 0xA0, 0xDE, 0xFB, 0x23, 0x00, 0x82, 0x2E, 0x81, 0x00,
+  0x88, 0x64, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x90,
+  0xF3, 0x77, 0x03, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80,
+  0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1,
+  0xF7, 0xFF, 0x0E, 0x08, 0x08, 0x08, 0x88, 0x80, 0x72, 0x85, 0x80, 0x00, 0x88, 0x00, 0x08, 0xF8,
+  0x0E, 0x88, 0x00, 0x08, 0x88, 0x80, 0x70, 0x03, 0x81, 0x08, 0x08, 0xA0, 0xDF, 0x11, 0x0B, 0x08,
+  0x42, 0x2D, 0x94, 0xA2, 0x39, 0x00, 0x2B, 0xAF, 0x97, 0x8A, 0x80, 0x80, 0x80, 0x60, 0xA2, 0x4A,
+  0x80, 0x80, 0x80, 0x08, 0xF0, 0x58, 0xBB, 0x22, 0x8C, 0xA4, 0x41, 0x88, 0xDB, 0xFF, 0x26, 0x00,
+  0x80, 0x20, 0x9A, 0x97, 0x69, 0x9A, 0x40, 0x8C, 0x95, 0x49, 0xC0, 0x12, 0x9A, 0x18, 0x9C, 0xC9,
+  0x08, 0xB7, 0x52, 0xBA, 0x17, 0x2F, 0x98, 0x21, 0xB9, 0x33, 0xDA, 0x30, 0xA8, 0x94, 0x2E, 0x92,
+  0x0B, 0x93, 0x1A, 0x90, 0x6A, 0xB1, 0x10, 0xD2, 0x59, 0xB9, 0x01, 0xA9, 0x63, 0x8C, 0x48, 0x99,
+  0x04, 0x8A, 0x03, 0x8D, 0x92, 0x0A, 0x92, 0x6A, 0x2A, 0x88, 0xA0, 0x94, 0x20, 0x2D, 0xB0, 0xA0,
+  0xA4, 0x5B, 0x29, 0x9A, 0xA7, 0x11, 0x19, 0x4A, 0xAA, 0xB3, 0xC1, 0x68, 0x8B, 0x12, 0x98, 0x16,
+  0x4A, 0x00, 0x81, 0xB1, 0x8B, 0xD0, 0x0F, 0xD9, 0x00, 0x89, 0x21, 0x33, 0x43, 0x26, 0x31, 0x92,
+  0x80, 0xAE, 0xF8, 0x8A, 0xBB, 0x8B, 0xA9, 0x60, 0x23, 0x45, 0x14, 0x20, 0x08, 0xB9, 0xA0, 0x9F,
+  0xB8, 0x0C, 0xC9, 0x88, 0x88, 0x71, 0x21, 0x43, 0x03, 0x80, 0x98, 0xAB, 0xBA, 0xC9, 0xBB, 0xDA,
+  0x12, 0xEA, 0x3B, 0x00, 0x8D, 0xB9, 0x81, 0x54, 0x53, 0x32, 0x84, 0x88, 0xA9, 0xAB, 0x88, 0xAA,
+  0xE1, 0xAB, 0x9E, 0xA9, 0x11, 0x71, 0x24, 0x32, 0x02, 0xB9, 0xB9, 0x9D, 0x11, 0x09, 0xB0, 0xBF,
+  0xC9, 0x8B, 0x32, 0x69, 0x16, 0x11, 0x83, 0xA9, 0x8A, 0xAB, 0x32, 0x13, 0xDB, 0xFA, 0x9C, 0x89,
+  0x10, 0x94, 0x35, 0x12, 0x30, 0xD1, 0x8B, 0x90, 0x21, 0x24, 0xBA, 0xCD, 0xBC, 0x88, 0x18, 0x34,
+  0x29, 0x17, 0x88, 0x14, 0xA9, 0x18, 0x90, 0x12, 0xB2, 0xCF, 0xA9, 0x8C, 0x01, 0x18, 0x94, 0x7A,
+  0x02, 0x28, 0x04, 0xAA, 0x20, 0xA9, 0x41, 0xE8, 0xAB, 0xA9, 0x8A, 0x02, 0x19, 0xB4, 0x73, 0x14,
+  0x20, 0x93, 0xCB, 0x10, 0x10, 0x18, 0xF9, 0x9E, 0xA8, 0x10, 0x00, 0x1B, 0xB2, 0x65, 0x02, 0x20,
+  0x92, 0xCC, 0x22, 0x08, 0x29, 0xFA, 0x9C, 0x80, 0x18, 0x08, 0x9A, 0x82, 0x56, 0x02, 0x29, 0x83,
+  0xCC, 0x21, 0x81, 0x89, 0xCB, 0x11, 0x3E, 0x00, 0xF8, 0xAB, 0x18, 0x00, 0x08, 0xCB, 0x83, 0x74,
+  0x13, 0x89, 0x14, 0xE8, 0x29, 0x82, 0x8A, 0xA0, 0xCC, 0x19, 0x00, 0x89, 0xB8, 0x21, 0x78, 0x17,
+  0x88, 0x41, 0xB0, 0x0D, 0x13, 0xA9, 0x81, 0xCC, 0x1A, 0x81, 0x88, 0xA8, 0x19, 0x24, 0x36, 0x01,
+  0x38, 0x94, 0xBD, 0x41, 0x91, 0x8B, 0xD8, 0xBC, 0x32, 0xA8, 0x8B, 0xA1, 0x30, 0x57, 0x01, 0x00,
+  0x14, 0xC9, 0x2B, 0x23, 0xAB, 0xA0, 0xDF, 0x29, 0x81, 0x9A, 0x88, 0x18, 0x33, 0x35, 0x22, 0x51,
+  0x81, 0xBD, 0x20, 0x02, 0xAB, 0xDB, 0xAE, 0x18, 0x11, 0xEB, 0x18, 0x02, 0x30, 0x35, 0x01, 0x24,
+  0xD1, 0xAB, 0x42, 0x91, 0xBB, 0xBB, 0xAE, 0x20, 0xC2, 0x9B, 0x38, 0x23, 0x35, 0x34, 0x41, 0x13,
+  0xFA, 0x0A, 0x32, 0xAA, 0xAA, 0xCD, 0x99, 0x20, 0xC0, 0x9A, 0x51, 0x01, 0x43, 0x14, 0x41, 0x03,
+  0xDA, 0x0B, 0x11, 0xA0, 0xBB, 0xAE, 0x9C, 0x11, 0x46, 0xE9, 0x3D, 0x00, 0xB0, 0x0B, 0x43, 0x39,
+  0x57, 0x02, 0x31, 0x81, 0xBE, 0x28, 0x13, 0xCB, 0xAB, 0xBB, 0x1A, 0x03, 0xEB, 0x1B, 0x33, 0x62,
+  0x34, 0x13, 0x32, 0xB1, 0xCF, 0x10, 0x03, 0xBB, 0xBC, 0xBA, 0x09, 0x11, 0xDB, 0x89, 0x24, 0x54,
+  0x42, 0x22, 0x02, 0xC8, 0x9C, 0x18, 0x02, 0xF9, 0xBB, 0x89, 0x09, 0x10, 0xD8, 0x99, 0x52, 0x52,
+  0x32, 0x13, 0x22, 0xB0, 0xAF, 0x09, 0x02, 0xD9, 0xBB, 0x9A, 0x88, 0x88, 0x90, 0x09, 0x52, 0x73,
+  0x43, 0x13, 0x23, 0x92, 0xBD, 0x8B, 0x01, 0xCA, 0xAE, 0x89, 0x99, 0x88, 0x80, 0x10, 0x40, 0x34,
+  0x13, 0x33, 0x31, 0x35, 0x83, 0x80, 0x80, 0xC8, 0xBD, 0xDA, 0xBB, 0xAA, 0xAC, 0x9B, 0x00, 0x38,
+  0x14, 0x32, 0x45, 0x22, 0x43, 0x33, 0x33, 0x02, 0x32, 0x13, 0xDB, 0xC9, 0xFB, 0xBB, 0xBD, 0xAB,
+  0xAB, 0xA9, 0x00, 0x18, 0x26, 0x23, 0x53, 0x43, 0x34, 0x13, 0x21, 0x80, 0xE1, 0x0A, 0x28, 0x00,
+  0x80, 0xB0, 0xCD, 0xDB, 0xCC, 0xAA, 0xAA, 0x0A, 0x90, 0x8B, 0x05, 0x38, 0x42, 0x44, 0x32, 0x82,
+  0x32, 0x38, 0x84, 0x08, 0xEA, 0xC8, 0xBA, 0xBB, 0xCB, 0xCB, 0xB9, 0x0B, 0x80, 0x90, 0x27, 0x50,
+  0x30, 0x32, 0x32, 0x84, 0x15, 0x08, 0x08, 0xE8, 0x09, 0xBB, 0xE8, 0x98, 0x8B, 0x80, 0x80, 0x08,
+  0x90, 0x72, 0x83, 0x16, 0x28, 0x04, 0x88, 0x62, 0x08, 0x08, 0x08, 0xE9, 0x88, 0x80, 0x90, 0x8E,
+  0x80, 0x08, 0x08, 0x08, 0x08, 0x28, 0x47, 0x88, 0x16, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x18,
+  0xEF, 0x80, 0x80, 0xCB, 0x80, 0x80, 0x80, 0x80, 0x70, 0x84, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80,
+  0x80, 0x08, 0x90, 0x81, 0xFF, 0x8C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0x17, 0x80, 0x80,
+  0x80, 0x08, 0x08, 0x80, 0x80, 0xA0, 0xFF, 0x89, 0x80, 0x80, 0x78, 0xB2, 0x04, 0x08, 0x08, 0x80,
+  0x02, 0x00, 0x1F, 0x00, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+  0xF7, 0xFF, 0x80, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0x18, 0x5B, 0xF7, 0x7A, 0xC8,
+  0x41, 0xB9, 0x08, 0x28, 0xF1, 0x3B, 0x92, 0x09, 0x29, 0x82, 0x28, 0x85, 0x80, 0x8D, 0x08, 0x1A,
+  0x07, 0x80, 0x80, 0x08, 0xD0, 0x89, 0x3A, 0xEA, 0x83, 0x5A, 0x0A, 0x02, 0x04, 0x80, 0x64, 0x12,
+  0x2B, 0xA4, 0x82, 0x0E, 0x0A, 0xF1, 0x88, 0xB0, 0x18, 0xA9, 0xB8, 0x08, 0x48, 0x32, 0x82, 0x74,
+  0x15, 0x30, 0x43, 0x21, 0x00, 0x98, 0xEB, 0xAB, 0x9F, 0xC9, 0x8A, 0xAB, 0x99, 0x8A, 0xA9, 0x07,
+  0x72, 0x33, 0x45, 0x32, 0x91, 0x89, 0x99, 0xEB, 0xBB, 0xAB, 0xBA, 0x8B, 0xA9, 0xFB, 0x88, 0x98,
+  0x38, 0x26, 0x53, 0x35, 0x00, 0x09, 0x3C, 0x00, 0x44, 0x12, 0x90, 0xA9, 0x9A, 0xCC, 0x9C, 0x9A,
+  0xA9, 0x88, 0x89, 0xA8, 0x9A, 0x81, 0x09, 0x55, 0x46, 0x42, 0x43, 0x14, 0x90, 0x9A, 0xAA, 0xCC,
+  0xAB, 0x9A, 0xA9, 0x80, 0x00, 0x99, 0x1A, 0xA8, 0x99, 0x67, 0x41, 0x34, 0x34, 0x24, 0x01, 0xAA,
+  0xCA, 0xCA, 0xBC, 0x9A, 0x8A, 0x0A, 0x90, 0x02, 0x8B, 0x02, 0x9C, 0x72, 0x84, 0x54, 0x23, 0x43,
+  0x24, 0xA0, 0x9A, 0xC9, 0xBD, 0xAA, 0xC9, 0x8A, 0x10, 0x8A, 0x20, 0xA1, 0x1B, 0x33, 0x15, 0x75,
+  0x33, 0x31, 0x45, 0x91, 0x89, 0xA9, 0xBE, 0xA9, 0xCA, 0x8A, 0x80, 0x89, 0x20, 0xB1, 0x09, 0x31,
+  0x3A, 0x27, 0x27, 0x43, 0x42, 0x23, 0xA8, 0x90, 0xCC, 0x9D, 0xBA, 0xBB, 0x98, 0x98, 0x20, 0x90,
+  0x10, 0x80, 0x10, 0x64, 0x59, 0x26, 0x22, 0x54, 0x01, 0x08, 0xA8, 0xCB, 0xBA, 0xBE, 0x99, 0x99,
+  0x09, 0x00, 0x18, 0x01, 0x80, 0x23, 0x53, 0x78, 0x98, 0xF4, 0x39, 0x00, 0x25, 0x32, 0x35, 0x01,
+  0x18, 0xC8, 0xBB, 0xFB, 0xBB, 0xA9, 0xA9, 0x08, 0x08, 0x10, 0x10, 0x02, 0x15, 0x43, 0x70, 0x24,
+  0x31, 0x27, 0x08, 0x10, 0xC8, 0x9A, 0xCB, 0x9D, 0xA9, 0xA9, 0x00, 0x88, 0x11, 0x00, 0x13, 0x31,
+  0x13, 0x76, 0x13, 0x43, 0x24, 0x01, 0x11, 0xDA, 0xB9, 0xAF, 0xAA, 0xAA, 0x89, 0x89, 0x10, 0x10,
+  0x02, 0x14, 0x49, 0x32, 0x42, 0x27, 0x32, 0x53, 0x01, 0x01, 0xA9, 0xAD, 0xDC, 0xBA, 0xAA, 0x9B,
+  0x99, 0x01, 0x28, 0x31, 0x02, 0x04, 0x44, 0x21, 0x36, 0x43, 0x32, 0x26, 0x00, 0x00, 0xCA, 0xCB,
+  0xCC, 0xBB, 0xAA, 0xBA, 0x80, 0x28, 0x38, 0x03, 0x42, 0x51, 0x22, 0x07, 0x53, 0x21, 0x33, 0x04,
+  0x20, 0x89, 0xDB, 0xEB, 0xBB, 0xBB, 0xAB, 0xAA, 0x09, 0x10, 0x21, 0x51, 0x03, 0x71, 0x42, 0x21,
+  0x35, 0x12, 0x44, 0x82, 0x81, 0x09, 0xEB, 0xBA, 0xAF, 0xA9, 0x8A, 0xAA, 0xF0, 0xE7, 0x36, 0x00,
+  0x84, 0x1C, 0x96, 0x5B, 0xA0, 0x23, 0x88, 0x32, 0x20, 0x26, 0x11, 0x22, 0x8A, 0xD1, 0xAB, 0xCD,
+  0xAA, 0xBB, 0x99, 0x89, 0x11, 0x30, 0x03, 0x41, 0x20, 0x21, 0x07, 0x55, 0x31, 0x14, 0x33, 0x81,
+  0x90, 0xDB, 0xCD, 0xCA, 0x9B, 0xAB, 0x89, 0x98, 0x02, 0x41, 0x10, 0x94, 0x12, 0x33, 0x79, 0x07,
+  0x32, 0x31, 0x12, 0x10, 0xC8, 0xD9, 0x9D, 0xBC, 0xAA, 0xAA, 0x98, 0x3A, 0x90, 0x06, 0x20, 0x11,
+  0x41, 0x81, 0x37, 0x58, 0x02, 0x24, 0x00, 0x92, 0x8A, 0xCD, 0xCA, 0xAB, 0x9C, 0x9A, 0x89, 0x81,
+  0x50, 0x10, 0x85, 0x31, 0x39, 0x02, 0x17, 0x21, 0x23, 0x43, 0x08, 0xC4, 0x89, 0xAD, 0xDB, 0xB9,
+  0xBA, 0x89, 0x1A, 0x80, 0x14, 0x41, 0x02, 0x23, 0x60, 0x30, 0x04, 0x34, 0x51, 0x12, 0x11, 0x99,
+  0xF8, 0xAB, 0xBD, 0xBA, 0xAB, 0xAA, 0x88, 0x30, 0x32, 0x25, 0x33, 0x41, 0x31, 0x03, 0x27, 0x43,
+  0x6B, 0x10, 0x36, 0x00, 0x52, 0x21, 0x01, 0xA2, 0xCB, 0xAE, 0xCC, 0xAA, 0xBB, 0xB9, 0x88, 0x28,
+  0x21, 0x16, 0x32, 0x58, 0x01, 0x83, 0x34, 0x51, 0x31, 0x24, 0x21, 0x91, 0x99, 0xAF, 0xDC, 0xBA,
+  0xAB, 0xAB, 0x89, 0x1A, 0x02, 0x26, 0x41, 0x10, 0x85, 0x40, 0x28, 0x83, 0x43, 0x51, 0x02, 0x12,
+  0x99, 0xF9, 0xAA, 0xAD, 0xCB, 0xA9, 0x9A, 0x98, 0x12, 0x40, 0x32, 0x33, 0x71, 0x80, 0x86, 0x40,
+  0x18, 0x13, 0x42, 0x80, 0x93, 0x8A, 0xBE, 0xDA, 0xAB, 0xBC, 0xA9, 0x0A, 0x09, 0x11, 0x43, 0x42,
+  0x23, 0x42, 0x68, 0x00, 0x06, 0x21, 0x21, 0x13, 0x38, 0xB9, 0xFA, 0xCB, 0xCB, 0xAC, 0x9B, 0xAA,
+  0x90, 0x10, 0x50, 0x12, 0x23, 0x43, 0x02, 0x07, 0x41, 0x20, 0x23, 0x23, 0x93, 0xA3, 0x9D, 0xAF,
+  0xEB, 0xB9, 0x9B, 0x9B, 0x89, 0x09, 0x03, 0x63, 0x21, 0x23, 0x42, 0x40, 0x01, 0x07, 0x41, 0x10,
+  0x22, 0x19, 0xC8, 0xD8, 0x5E, 0x13, 0x39, 0x00, 0xAC, 0xDB, 0xAA, 0x9B, 0x9A, 0x80, 0x38, 0x13,
+  0x27, 0x30, 0x13, 0x23, 0x03, 0x73, 0x31, 0x14, 0x23, 0x83, 0x18, 0xAF, 0xEA, 0xBB, 0xAC, 0xAB,
+  0x9A, 0x99, 0x21, 0x41, 0x24, 0x24, 0x31, 0x12, 0x53, 0x38, 0x87, 0x42, 0x20, 0x02, 0x18, 0xDA,
+  0xD8, 0x9C, 0xBC, 0xAA, 0x9B, 0xA8, 0x20, 0x30, 0x24, 0x24, 0x23, 0x52, 0x20, 0x83, 0x17, 0x41,
+  0x21, 0x22, 0x88, 0xD1, 0xAB, 0xBF, 0xDA, 0xAA, 0xAA, 0x88, 0x0A, 0x02, 0x53, 0x31, 0x14, 0x40,
+  0x81, 0x95, 0x52, 0x28, 0x03, 0x24, 0x88, 0x91, 0x8E, 0xDC, 0xA9, 0x9C, 0xB9, 0x09, 0x0A, 0x02,
+  0x42, 0x21, 0x15, 0x58, 0x80, 0x94, 0x60, 0x18, 0x03, 0x31, 0x80, 0x00, 0xAD, 0xFA, 0xAA, 0x9C,
+  0xAA, 0x89, 0x88, 0x30, 0x21, 0x06, 0x32, 0x28, 0x84, 0x12, 0x53, 0x31, 0x25, 0x32, 0x81, 0x00,
+  0xBE, 0xFA, 0xAB, 0xAC, 0xAA, 0x8A, 0x08, 0x40, 0xE3, 0xDE, 0x39, 0x00, 0x20, 0x06, 0x40, 0x80,
+  0x12, 0x81, 0x63, 0x38, 0x04, 0x33, 0x18, 0x90, 0xEB, 0xEA, 0xAB, 0xBC, 0xA9, 0x8B, 0x18, 0x20,
+  0x42, 0x14, 0x13, 0x31, 0x10, 0x97, 0x62, 0x18, 0x05, 0x21, 0x00, 0x80, 0xDB, 0xC9, 0xAD, 0xBA,
+  0x9B, 0xA9, 0x10, 0x38, 0x05, 0x32, 0x84, 0x51, 0x89, 0x95, 0x60, 0x80, 0x14, 0x20, 0x81, 0x88,
+  0xD8, 0xAB, 0xBE, 0xB9, 0x9B, 0xA9, 0x10, 0x11, 0x52, 0x02, 0x24, 0x28, 0x92, 0x23, 0x72, 0x23,
+  0x17, 0x31, 0x00, 0x98, 0xCA, 0xBD, 0xCC, 0xAA, 0x9B, 0x8A, 0x00, 0x22, 0x32, 0x16, 0x21, 0x01,
+  0x01, 0x84, 0x71, 0x13, 0x35, 0x31, 0x11, 0xA8, 0xDA, 0xBD, 0xCC, 0xAB, 0xBA, 0x88, 0x18, 0x22,
+  0x24, 0x14, 0x31, 0x81, 0x11, 0x02, 0x72, 0x15, 0x34, 0x32, 0x02, 0xA0, 0xCB, 0xBF, 0xBC, 0xCB,
+  0x9A, 0x99, 0x10, 0x21, 0x32, 0x24, 0x22, 0x11, 0x10, 0x84, 0x73, 0x24, 0xEE, 0x11, 0x39, 0x00,
+  0x34, 0x23, 0x11, 0xD1, 0x9A, 0xBF, 0xCB, 0xBB, 0x9B, 0x99, 0x10, 0x22, 0x42, 0x14, 0x21, 0x01,
+  0x18, 0x86, 0x70, 0x03, 0x43, 0x13, 0x10, 0xB1, 0xAC, 0xDD, 0xAC, 0xBA, 0x8B, 0x99, 0x10, 0x22,
+  0x41, 0x14, 0x20, 0x01, 0x18, 0x04, 0x71, 0x14, 0x42, 0x14, 0x18, 0x90, 0xCB, 0xBC, 0xBD, 0xAB,
+  0x9C, 0x88, 0x80, 0x32, 0x22, 0x24, 0x01, 0x12, 0x00, 0x24, 0x72, 0x25, 0x32, 0x34, 0x80, 0x91,
+  0xBD, 0xBC, 0xBE, 0xBA, 0xAA, 0x09, 0x10, 0x31, 0x33, 0x42, 0x02, 0x11, 0x22, 0x14, 0x74, 0x15,
+  0x42, 0x22, 0x08, 0xA1, 0xBD, 0xCB, 0xCD, 0x9A, 0x9A, 0x88, 0x10, 0x30, 0x22, 0x22, 0x22, 0x80,
+  0x32, 0x23, 0x77, 0x23, 0x34, 0x23, 0x08, 0xA0, 0xCE, 0xBB, 0xCD, 0xAA, 0x99, 0x89, 0x20, 0x20,
+  0x32, 0x03, 0x31, 0x92, 0x51, 0x13, 0x57, 0x22, 0x43, 0x04, 0x80, 0xA0, 0xFB, 0xAB, 0xBC, 0xBB,
+  0x44, 0xE3, 0x3B, 0x00, 0xA9, 0x89, 0x21, 0x22, 0x53, 0x01, 0x12, 0x28, 0x22, 0x73, 0x44, 0x33,
+  0x44, 0x02, 0x81, 0xB8, 0xBE, 0xEB, 0xAB, 0xBB, 0x99, 0x09, 0x21, 0x12, 0x25, 0x10, 0x03, 0x10,
+  0x33, 0x72, 0x26, 0x32, 0x34, 0x02, 0x00, 0xC9, 0xCD, 0xBB, 0xBD, 0xAA, 0x89, 0x89, 0x22, 0x03,
+  0x43, 0x82, 0x11, 0x22, 0x21, 0x57, 0x33, 0x44, 0x33, 0x00, 0x00, 0xDC, 0xCA, 0xBC, 0xBB, 0xBA,
+  0x8A, 0x08, 0x23, 0x50, 0x03, 0x11, 0x02, 0x18, 0x25, 0x54, 0x34, 0x53, 0x13, 0x01, 0x98, 0xBC,
+  0xDD, 0xCA, 0xAA, 0xAA, 0x98, 0x10, 0x20, 0x22, 0x12, 0x02, 0x11, 0x68, 0x03, 0x57, 0x21, 0x24,
+  0x13, 0x08, 0xA0, 0xBD, 0xBD, 0xBC, 0xAB, 0x9B, 0x98, 0x38, 0x12, 0x32, 0x14, 0x10, 0x21, 0x52,
+  0x62, 0x25, 0x33, 0x44, 0x82, 0x10, 0xC9, 0xCA, 0xBC, 0xAD, 0xAA, 0xAA, 0x80, 0x29, 0x83, 0x79,
+  0xA3, 0x32, 0x10, 0x33, 0x44, 0xFE, 0x30, 0x00, 0x15, 0x38, 0x05, 0x50, 0xA1, 0x32, 0x9A, 0xC0,
+  0x99, 0xBE, 0xA8, 0xAD, 0xA9, 0xA0, 0x9A, 0x09, 0x02, 0x20, 0x53, 0x61, 0x13, 0x63, 0x22, 0x43,
+  0x22, 0x11, 0x12, 0xA9, 0xDC, 0xCB, 0xAD, 0xCA, 0xB9, 0x89, 0x8A, 0x89, 0x02, 0x18, 0x82, 0x73,
+  0x31, 0x71, 0x22, 0x24, 0x24, 0x31, 0x21, 0xB1, 0xB9, 0xBF, 0xCC, 0xBA, 0xAB, 0xAB, 0xAA, 0x10,
+  0x19, 0x23, 0x08, 0x27, 0x70, 0x18, 0x05, 0x32, 0x51, 0x11, 0x12, 0x81, 0x99, 0xCC, 0xAD, 0xCB,
+  0xBA, 0x8A, 0xAB, 0x80, 0x00, 0x23, 0x20, 0x71, 0x30, 0x04, 0x26, 0x41, 0x32, 0x23, 0x33, 0x82,
+  0x0A, 0xCF, 0xDB, 0xB9, 0xAC, 0x99, 0xAA, 0x01, 0x19, 0x41, 0x91, 0x35, 0x38, 0x41, 0x15, 0x32,
+  0x72, 0x12, 0x11, 0x81, 0xA0, 0xDC, 0xBB, 0xBC, 0xAC, 0x9A, 0xA8, 0x80, 0x11, 0x48, 0x11, 0x32,
+  0x25, 0x61, 0x33, 0x53, 0x24, 0x21, 0x12, 0xC0, 0x1A, 0x1B, 0x33, 0x00, 0xA9, 0xBE, 0xAD, 0xBB,
+  0xBA, 0x99, 0x0A, 0x20, 0x01, 0x35, 0x38, 0x22, 0x87, 0x43, 0x31, 0x63, 0x22, 0x21, 0x02, 0xBA,
+  0xEB, 0xAE, 0xCB, 0xBA, 0x8A, 0x8B, 0x88, 0x02, 0x51, 0x11, 0x04, 0x33, 0x78, 0x12, 0x23, 0x25,
+  0x12, 0x21, 0xB0, 0xBA, 0xDF, 0xBB, 0xDA, 0x8A, 0xAA, 0x08, 0x81, 0x30, 0x05, 0x40, 0x31, 0x20,
+  0x17, 0x12, 0x43, 0x12, 0x31, 0x98, 0xAA, 0xFD, 0xBA, 0xBA, 0xAC, 0xA9, 0x89, 0x10, 0x10, 0x15,
+  0x31, 0x63, 0x00, 0x26, 0x10, 0x53, 0x82, 0x21, 0x92, 0xAB, 0xFA, 0xBC, 0xB9, 0xAC, 0x99, 0x8A,
+  0x10, 0x10, 0x33, 0x42, 0x53, 0x41, 0x24, 0x32, 0x26, 0x02, 0x22, 0x90, 0x9C, 0xFB, 0xAC, 0xBA,
+  0xAB, 0xAA, 0xA8, 0x02, 0x38, 0x34, 0x21, 0x45, 0x48, 0x33, 0x34, 0x35, 0x12, 0x12, 0xB0, 0xCB,
+  0xCE, 0xAC, 0xBA, 0xAB, 0x99, 0x99, 0x22, 0x18, 0x33, 0x05, 0x05, 0x53, 0x8C, 0xFB, 0x36, 0x00,
+  0x42, 0x42, 0x24, 0x11, 0x02, 0xBA, 0xCA, 0xDE, 0xAA, 0xB9, 0x9A, 0x89, 0x88, 0x21, 0x12, 0x51,
+  0x31, 0x30, 0x37, 0x33, 0x27, 0x12, 0x21, 0x90, 0xBA, 0xDD, 0xAC, 0xBA, 0xAB, 0x89, 0x98, 0x30,
+  0x11, 0x42, 0x12, 0x25, 0x35, 0x33, 0x55, 0x23, 0x20, 0x01, 0xCA, 0xDB, 0xCC, 0xAB, 0xAB, 0x89,
+  0x09, 0x81, 0x43, 0x19, 0x25, 0x00, 0x45, 0x02, 0x54, 0x13, 0x10, 0x82, 0xDA, 0xAC, 0xFA, 0x0B,
+  0xA8, 0x00, 0x00, 0x8A, 0x90, 0x99, 0x34, 0x72, 0x27, 0x01, 0x22, 0x90, 0x0B, 0xEA, 0x9A, 0x98,
+  0x9A, 0x90, 0xCA, 0x88, 0xAC, 0x10, 0x98, 0x34, 0x17, 0x70, 0x02, 0x00, 0x24, 0xBA, 0x88, 0xD9,
+  0x19, 0xB0, 0xAB, 0xA9, 0xAD, 0x08, 0x8B, 0x02, 0x91, 0x74, 0x11, 0x37, 0x82, 0x42, 0xA1, 0x9F,
+  0x80, 0x98, 0x11, 0xCA, 0x9A, 0xA8, 0x0A, 0x00, 0x09, 0x21, 0x49, 0x87, 0x35, 0x43, 0x28, 0x94,
+  0x65, 0x2A, 0x3F, 0x00, 0xCC, 0x00, 0x09, 0x00, 0xE0, 0xAB, 0x89, 0x0A, 0x12, 0x99, 0x80, 0x89,
+  0x57, 0x48, 0x24, 0x81, 0x32, 0xF9, 0x0B, 0x81, 0x08, 0x92, 0xBF, 0x09, 0x99, 0x21, 0xA2, 0x1E,
+  0x91, 0x30, 0x52, 0x23, 0x23, 0x02, 0xB0, 0xBE, 0x19, 0x00, 0x90, 0xDE, 0x9C, 0x08, 0x08, 0x21,
+  0xD9, 0x29, 0x51, 0x91, 0x36, 0x01, 0x38, 0xA4, 0xBD, 0x10, 0x98, 0x11, 0xF8, 0x8D, 0x80, 0x19,
+  0x82, 0xA9, 0x28, 0x20, 0x05, 0x53, 0x21, 0x30, 0xC3, 0xCC, 0x18, 0x18, 0x08, 0xFA, 0x9C, 0x18,
+  0x08, 0x01, 0xC9, 0x29, 0x53, 0x00, 0x24, 0x33, 0x41, 0xD8, 0xBA, 0x00, 0x28, 0x10, 0xEF, 0x89,
+  0x08, 0x38, 0xB1, 0xAA, 0x31, 0x14, 0x78, 0x11, 0x23, 0x13, 0xBD, 0x0B, 0x91, 0x10, 0xB3, 0xFF,
+  0x09, 0x90, 0x21, 0x98, 0x8B, 0x32, 0x93, 0x64, 0x12, 0x30, 0x94, 0xCC, 0x2A, 0x10, 0x88, 0xF1,
+  0x9C, 0x29, 0x18, 0x80, 0xE6, 0xED, 0x3F, 0x00, 0xA0, 0x0B, 0x55, 0x88, 0x43, 0x02, 0x20, 0xB0,
+  0xAF, 0x21, 0x88, 0x1A, 0xFB, 0x9B, 0x13, 0x89, 0x29, 0xF0, 0x38, 0x13, 0x31, 0x14, 0x80, 0x24,
+  0xFB, 0x1A, 0x81, 0x99, 0x90, 0xCE, 0x18, 0x90, 0x28, 0x90, 0x8D, 0x16, 0x28, 0x43, 0x88, 0x22,
+  0xF8, 0x0B, 0x13, 0xA9, 0x89, 0xEB, 0x0B, 0x12, 0x98, 0x88, 0xB8, 0x53, 0x72, 0x22, 0x00, 0x32,
+  0xE0, 0x9C, 0x22, 0xA8, 0x09, 0xFA, 0x9B, 0x22, 0x99, 0x00, 0xA8, 0x49, 0x44, 0x23, 0x14, 0x31,
+  0xB0, 0xCE, 0x11, 0x01, 0x8B, 0xF9, 0xAB, 0x20, 0x91, 0x2A, 0xD8, 0x29, 0x16, 0x30, 0x34, 0xA0,
+  0x53, 0xD0, 0x8D, 0x12, 0xB0, 0x08, 0xC9, 0x8E, 0x12, 0xA0, 0x19, 0xA1, 0x29, 0x44, 0x13, 0x11,
+  0x52, 0xB0, 0xAE, 0x11, 0x91, 0x89, 0xCA, 0xAE, 0x11, 0xA1, 0x19, 0x90, 0x8C, 0x27, 0x20, 0x41,
+  0x80, 0x13, 0xD9, 0x0C, 0x01, 0x98, 0x88, 0xDC, 0x09, 0xF0, 0x42, 0x00, 0x8B, 0x21, 0xA9, 0x01,
+  0xC9, 0x68, 0x32, 0x32, 0x14, 0x30, 0x02, 0xEE, 0x08, 0x01, 0x98, 0xB9, 0xCC, 0x88, 0x12, 0x8A,
+  0x89, 0x98, 0x74, 0x21, 0x31, 0x23, 0x23, 0xD0, 0x9E, 0x18, 0x80, 0x98, 0xCB, 0xAD, 0x19, 0x01,
+  0x89, 0x09, 0x09, 0x56, 0x22, 0x42, 0x13, 0x03, 0xC8, 0xAE, 0x08, 0x01, 0x98, 0xBD, 0x9D, 0x08,
+  0x00, 0x01, 0x8C, 0x11, 0x25, 0x41, 0x25, 0x01, 0x22, 0xC0, 0xAF, 0x10, 0x91, 0x99, 0xB8, 0xAE,
+  0x08, 0x11, 0x89, 0x18, 0x98, 0x64, 0x32, 0x33, 0x23, 0x23, 0xE9, 0xAD, 0x19, 0x88, 0x99, 0xFA,
+  0xAB, 0x18, 0x80, 0x90, 0x02, 0x89, 0x72, 0x15, 0x41, 0x14, 0x28, 0x11, 0xDD, 0x8A, 0x11, 0x8A,
+  0x8A, 0xFA, 0x99, 0x11, 0x88, 0x10, 0x90, 0x38, 0x27, 0x21, 0x43, 0x13, 0x02, 0xE8, 0xAD, 0x09,
+  0x81, 0xA9, 0xAA, 0xAD, 0x0A, 0x13, 0xC8, 0x31, 0x81, 0x58, 0x27, 0x11, 0x22, 0x0A, 0x3D, 0x00,
+  0x53, 0x01, 0x81, 0xC9, 0xAD, 0x09, 0xA0, 0x99, 0xB8, 0xBC, 0x2A, 0x02, 0x08, 0x43, 0x80, 0x53,
+  0x27, 0x40, 0x33, 0x03, 0x02, 0xF9, 0x9E, 0x08, 0x98, 0x99, 0x89, 0xBA, 0x1A, 0x23, 0xAA, 0x59,
+  0x14, 0x21, 0x44, 0x30, 0x36, 0x23, 0x11, 0xC9, 0xCF, 0x09, 0x00, 0xB9, 0x89, 0x9A, 0x8A, 0x02,
+  0x98, 0x89, 0x72, 0x13, 0x02, 0x24, 0x64, 0x42, 0x11, 0x81, 0xFA, 0x9B, 0x0A, 0xA8, 0xA8, 0xAA,
+  0x0A, 0x89, 0x88, 0x93, 0x89, 0x74, 0x14, 0x81, 0x22, 0x64, 0x43, 0x12, 0x81, 0xE9, 0xAD, 0x0A,
+  0x90, 0x99, 0x9B, 0x08, 0x98, 0x80, 0x10, 0x80, 0x52, 0x26, 0x02, 0x10, 0x62, 0x36, 0x22, 0x20,
+  0xA8, 0xBF, 0x9C, 0x89, 0x98, 0xAA, 0x09, 0x01, 0x98, 0x00, 0x21, 0x19, 0x52, 0x37, 0x02, 0x00,
+  0x52, 0x37, 0x02, 0x11, 0x90, 0xCF, 0xAB, 0x08, 0x98, 0xBA, 0x09, 0x33, 0x81, 0xAA, 0x28, 0x32,
+  0x32, 0xF3, 0x2D, 0x00, 0x53, 0x25, 0x01, 0x10, 0x44, 0x47, 0x12, 0x11, 0x88, 0xFB, 0xCB, 0x99,
+  0x88, 0xAA, 0x9A, 0x30, 0x23, 0x98, 0x19, 0x22, 0x03, 0x73, 0x33, 0x91, 0x0A, 0x75, 0x34, 0x13,
+  0x11, 0x98, 0xED, 0xBB, 0xAA, 0x89, 0xBA, 0xAA, 0x20, 0x43, 0x11, 0x08, 0x31, 0x53, 0x22, 0x81,
+  0x31, 0x30, 0x75, 0x63, 0x33, 0x11, 0x89, 0xD9, 0xBE, 0xAC, 0x8A, 0x89, 0xAA, 0x09, 0x32, 0x33,
+  0x81, 0x30, 0x45, 0x32, 0xA2, 0x89, 0x20, 0x33, 0x57, 0x43, 0x33, 0x11, 0x82, 0xFA, 0xBD, 0xBC,
+  0x8A, 0x98, 0xA9, 0x8A, 0x42, 0x23, 0x02, 0x0A, 0x42, 0x34, 0x23, 0x88, 0x90, 0x4B, 0x35, 0x55,
+  0x34, 0x13, 0x81, 0x99, 0xF8, 0xCD, 0xAA, 0x89, 0x98, 0xA8, 0x09, 0x41, 0x23, 0x98, 0x80, 0x43,
+  0x52, 0x11, 0x00, 0x9A, 0x18, 0x56, 0x33, 0x25, 0x24, 0x80, 0xA9, 0xDB, 0xDD, 0xBB, 0x8A, 0x80,
+  0x90, 0x98, 0x20, 0x33, 0x48, 0xF3, 0x2E, 0x00, 0x23, 0x12, 0x32, 0x72, 0x12, 0xA2, 0x98, 0x8B,
+  0x61, 0x46, 0x32, 0x63, 0x02, 0xA8, 0xCA, 0xEC, 0xCB, 0x8A, 0x10, 0x90, 0xA9, 0x28, 0x34, 0x02,
+  0x8A, 0x43, 0x33, 0x21, 0x80, 0xBA, 0xCC, 0x0A, 0x57, 0x23, 0x02, 0x32, 0x25, 0xA0, 0xDE, 0xCA,
+  0x9A, 0x00, 0x01, 0xB9, 0x8C, 0x30, 0x24, 0xA8, 0x20, 0x34, 0x81, 0x89, 0x20, 0xC0, 0xBC, 0x78,
+  0x27, 0x01, 0x80, 0x41, 0x22, 0xB9, 0xBC, 0xCC, 0xAB, 0x28, 0x83, 0xFC, 0x8A, 0x31, 0x03, 0x99,
+  0x20, 0x33, 0xBA, 0x18, 0x17, 0xB8, 0x0C, 0x73, 0x03, 0x80, 0x41, 0x31, 0x80, 0xA8, 0xEA, 0xCD,
+  0x9B, 0x30, 0xA2, 0xCD, 0x1A, 0x32, 0xA0, 0x19, 0x34, 0xA0, 0x9A, 0x35, 0x92, 0x9D, 0x20, 0x24,
+  0x80, 0x41, 0x52, 0x90, 0x21, 0x15, 0xCA, 0xBD, 0xBC, 0x08, 0x12, 0xB9, 0xAF, 0x18, 0x22, 0x01,
+  0x18, 0x82, 0xA1, 0x50, 0x81, 0xB8, 0x28, 0x53, 0x1B, 0xFD, 0x30, 0x00, 0x32, 0x53, 0x05, 0x92,
+  0x78, 0x23, 0xD8, 0xAC, 0xAA, 0x99, 0x10, 0xA1, 0xDD, 0x0A, 0x32, 0x92, 0x10, 0x31, 0xA9, 0x21,
+  0x06, 0x98, 0x2C, 0x81, 0x24, 0x35, 0x01, 0x0B, 0x27, 0x15, 0x80, 0x9B, 0xC9, 0xEC, 0x09, 0x22,
+  0xCA, 0x9B, 0x10, 0x00, 0x20, 0x14, 0xA0, 0x89, 0x34, 0x91, 0x9C, 0x50, 0x01, 0x14, 0x30, 0xBA,
+  0x31, 0x77, 0x12, 0x98, 0xAC, 0x90, 0xC9, 0x9C, 0x10, 0xC0, 0x9A, 0x00, 0x8A, 0x18, 0x27, 0x80,
+  0x19, 0x80, 0xA8, 0x22, 0x33, 0x8E, 0x34, 0x02, 0x0A, 0x42, 0x27, 0x52, 0x90, 0xBC, 0x00, 0xE8,
+  0x9E, 0x20, 0xA1, 0xAA, 0x08, 0x9A, 0x31, 0x16, 0x88, 0x28, 0xA0, 0x2A, 0x06, 0xB9, 0x78, 0x81,
+  0x18, 0x82, 0x8A, 0x72, 0x05, 0x00, 0x88, 0xBB, 0x89, 0xC9, 0xAB, 0x20, 0xBC, 0xBC, 0x91, 0x21,
+  0x73, 0x84, 0xA9, 0x11, 0x00, 0x48, 0xB4, 0x9B, 0x71, 0x82, 0x99, 0x86, 0x23, 0x05, 0x39, 0x00,
+  0x19, 0x62, 0x81, 0x81, 0x90, 0x8E, 0x81, 0xEA, 0x0A, 0x12, 0xCA, 0x8A, 0x01, 0x28, 0x43, 0xB8,
+  0x10, 0x12, 0x8D, 0x35, 0xE8, 0x19, 0x13, 0x0A, 0x21, 0xA2, 0x48, 0x54, 0x08, 0x08, 0xB2, 0x9C,
+  0xAD, 0xAB, 0x11, 0xB8, 0xAF, 0x08, 0x98, 0x38, 0x27, 0x9A, 0x28, 0x83, 0xC0, 0x49, 0x38, 0xBB,
+  0x27, 0x99, 0x2A, 0x23, 0x83, 0x25, 0x28, 0x12, 0xE2, 0x9E, 0x00, 0xDC, 0x1A, 0x02, 0xBB, 0x1A,
+  0xB8, 0x50, 0x16, 0x99, 0x10, 0x81, 0x1A, 0x31, 0xC1, 0x0B, 0x44, 0x08, 0x01, 0x11, 0x23, 0x73,
+  0x11, 0x13, 0xA4, 0x8F, 0xBB, 0xBC, 0x31, 0xA8, 0xAF, 0x90, 0x90, 0x40, 0x84, 0x29, 0x20, 0xC8,
+  0x23, 0xA8, 0x4D, 0x14, 0xAA, 0x20, 0x22, 0x00, 0x63, 0x11, 0x80, 0x23, 0x94, 0xAF, 0x89, 0xFB,
+  0x89, 0x00, 0xBA, 0x88, 0xD9, 0x30, 0x26, 0x9A, 0x00, 0x03, 0x00, 0x3D, 0x10, 0xF2, 0x11, 0x18,
+  0x30, 0x02, 0x34, 0x00, 0x1A, 0x33, 0xA4, 0x5A, 0x01, 0x02, 0x33, 0xDF, 0x08, 0xC0, 0x9D, 0x31,
+  0xC9, 0x99, 0x00, 0x1A, 0x43, 0xD1, 0x10, 0x21, 0x8A, 0x11, 0xA1, 0x0D, 0x17, 0xA8, 0x28, 0x02,
+  0x29, 0x24, 0xE3, 0x38, 0x21, 0xBA, 0xEA, 0xBB, 0x59, 0xA0, 0xBD, 0x01, 0x8A, 0x49, 0x84, 0x1B,
+  0x43, 0xD8, 0x23, 0x09, 0x1C, 0x05, 0xA8, 0x28, 0x11, 0x10, 0x04, 0x90, 0x32, 0x5B, 0x01, 0xB4,
+  0xAC, 0xAC, 0x0C, 0xA0, 0xD9, 0x1B, 0xA9, 0x9A, 0x57, 0x98, 0x19, 0x13, 0x09, 0x04, 0xC9, 0x50,
+  0x92, 0x88, 0x20, 0x88, 0x52, 0x83, 0x3A, 0x09, 0x54, 0x93, 0xCD, 0x8A, 0x9B, 0x81, 0xF8, 0x8C,
+  0x08, 0x99, 0x21, 0x96, 0x0B, 0x51, 0xA2, 0x88, 0x21, 0x0B, 0x21, 0xA5, 0x1A, 0x73, 0xC9, 0x23,
+  0x81, 0x0C, 0x24, 0xB1, 0x8C, 0x11, 0xDC, 0x09, 0xA1, 0x9F, 0x10, 0xC1, 0x09, 0x10, 0x18, 0x02,
+  0xA8, 0x72, 0x92, 0x9A, 0x64, 0xF8, 0x32, 0x00, 0x33, 0xA0, 0x40, 0x93, 0x0C, 0x26, 0x98, 0x80,
+  0x23, 0x40, 0xB8, 0xF9, 0xAA, 0x2B, 0x90, 0xAF, 0x90, 0xC8, 0x49, 0x10, 0xA9, 0x23, 0x24, 0x18,
+  0x00, 0xB9, 0x65, 0x04, 0x9C, 0x21, 0x91, 0x30, 0x02, 0x0B, 0x64, 0xA0, 0xA9, 0x28, 0x10, 0xCC,
+  0xCD, 0x28, 0xB8, 0x9B, 0x92, 0xAC, 0x65, 0xA8, 0x0A, 0x26, 0x90, 0x28, 0xA0, 0x2A, 0x16, 0xAA,
+  0x62, 0xB0, 0x0B, 0x24, 0x98, 0x18, 0x82, 0x8B, 0x28, 0xF0, 0xAD, 0x20, 0xC9, 0x89, 0x90, 0x9D,
+  0x52, 0xA1, 0x09, 0x23, 0x9A, 0x26, 0xA2, 0x8A, 0x41, 0xB1, 0x88, 0x23, 0x0E, 0x24, 0xD1, 0x89,
+  0x42, 0x00, 0xFB, 0x19, 0x81, 0x9D, 0x00, 0xC8, 0x09, 0x81, 0x89, 0x20, 0xA3, 0x89, 0x74, 0x92,
+  0x0A, 0x17, 0xA9, 0x31, 0x98, 0x00, 0x82, 0x11, 0x2A, 0x52, 0xEA, 0x18, 0x13, 0xB9, 0x8E, 0xB9,
+  0x18, 0xD2, 0xAD, 0x38, 0x98, 0x18, 0x85, 0x8C, 0x84, 0xF6, 0x30, 0x00, 0x51, 0x81, 0x52, 0xA0,
+  0x2B, 0x16, 0xA9, 0x50, 0x91, 0x0A, 0x82, 0x29, 0x21, 0xFC, 0x30, 0xA2, 0x8C, 0x90, 0xCA, 0x32,
+  0x8A, 0x8E, 0xB0, 0x10, 0x41, 0x9C, 0x01, 0x04, 0x20, 0x10, 0x0C, 0x73, 0xB2, 0x18, 0x12, 0x9C,
+  0x38, 0xC3, 0x19, 0x2A, 0xAE, 0x91, 0x91, 0x9D, 0x4A, 0xD1, 0x9A, 0x22, 0x8B, 0x09, 0x95, 0x9B,
+  0x72, 0xA0, 0x0A, 0x26, 0xC8, 0x28, 0x04, 0x09, 0x01, 0xA9, 0x42, 0xA1, 0x8F, 0x22, 0xDA, 0x28,
+  0xB1, 0x8C, 0x02, 0xBA, 0x51, 0xCA, 0x29, 0x93, 0x8C, 0x24, 0xB8, 0x11, 0x22, 0x28, 0x03, 0xA5,
+  0x30, 0x60, 0x0A, 0xB0, 0x84, 0x39, 0x2C, 0xA9, 0xC3, 0x02, 0x79, 0xAA, 0xB8, 0x04, 0x88, 0x8F,
+  0x91, 0x80, 0x10, 0xB0, 0x9F, 0x44, 0x00, 0x08, 0xB8, 0x42, 0x82, 0x08, 0x50, 0x00, 0xB3, 0xA9,
+  0x5C, 0x23, 0xF9, 0x0A, 0x80, 0x38, 0xB1, 0xFB, 0x30, 0x8A, 0x00, 0xC8, 0xD3, 0xFE, 0x29, 0x00,
+  0x0A, 0x85, 0x3B, 0x82, 0xAF, 0x33, 0xA0, 0x2B, 0x17, 0xAA, 0x33, 0x9C, 0x50, 0xB2, 0xBB, 0x43,
+  0x9B, 0x39, 0xD2, 0x8B, 0x23, 0xBC, 0x79, 0xC0, 0x09, 0x93, 0xAB, 0x22, 0xD0, 0x17, 0x00, 0x08,
+  0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // cwu
+  0x2B, 0xFF, 0x00, 0x00, 0x30, 0xFF, 0x0F, 0x28, 0x19, 0x06, 0x50, 0xBC, 0x37, 0x1D, 0xF3, 0x21,
+  0xA8, 0x78, 0x9A, 0x82, 0xC2, 0x32, 0x0F, 0x82, 0x1A, 0x81, 0x00, 0x99, 0x01, 0x81, 0x4D, 0xB8,
+  0x85, 0x8A, 0x11, 0x3D, 0x90, 0xA1, 0x10, 0xB8, 0x71, 0x8C, 0x94, 0x3A, 0xC9, 0x23, 0x0D, 0xC2,
+  0x48, 0xA9, 0x21, 0x1B, 0xE2, 0x28, 0x91, 0xA9, 0xD3, 0x41, 0xAB, 0x83, 0x2B, 0xE3, 0x6B, 0xA8,
+  0x03, 0x0D, 0xA3, 0x09, 0xB1, 0x49, 0xC1, 0x38, 0xD0, 0x21, 0xBA, 0x95, 0x4A, 0xE8, 0x13, 0x9B,
+  0x12, 0x2A, 0xC0, 0x31, 0x0C, 0x81, 0x00, 0xF0, 0x30, 0x19, 0xB9, 0x23, 0x3A, 0xD2, 0x12, 0x2F,
+  0x98, 0x93, 0x02, 0x98, 0x7B, 0x4B, 0x90, 0x19, 0x92, 0x81, 0x03, 0x0C, 0x96, 0x5A, 0xCA, 0x87,
+  0x3A, 0xB9, 0x44, 0x9C, 0x84, 0x1A, 0xB2, 0x48, 0x98, 0x2A, 0xD5, 0x10, 0x91, 0x28, 0x2F, 0xA1,
+  0x20, 0x9A, 0x94, 0x3C, 0x85, 0x01, 0x2F, 0x00, 0xC2, 0x48, 0xB9, 0x83, 0x5B, 0x08, 0x9A, 0x84,
+  0x2B, 0xC2, 0x59, 0xC9, 0x23, 0x8D, 0x93, 0x29, 0xA0, 0x2C, 0xB4, 0x4B, 0xC2, 0x39, 0xF3, 0x10,
+  0xB8, 0x60, 0x8B, 0x94, 0x4B, 0xB8, 0xA3, 0x12, 0x8E, 0xA6, 0x29, 0xB2, 0x00, 0xA0, 0x0B, 0x79,
+  0x0A, 0xD4, 0x69, 0xB8, 0x03, 0x9A, 0x33, 0x8E, 0xA4, 0x4A, 0xB0, 0x20, 0xB9, 0x23, 0x9D, 0x84,
+  0x1A, 0xB3, 0x40, 0x2A, 0xB8, 0x03, 0x8C, 0x22, 0x1D, 0xA4, 0x3A, 0xD5, 0x10, 0xA8, 0x10, 0x8A,
+  0x10, 0xBA, 0x87, 0x2A, 0x81, 0x83, 0x38, 0xB0, 0x42, 0xBB, 0x32, 0x9D, 0x83, 0x9E, 0x94, 0x6B,
+  0xB8, 0x31, 0xB9, 0x14, 0x2D, 0x80, 0x29, 0xC1, 0x12, 0x2B, 0xA8, 0xA6, 0x2A, 0x10, 0x1C, 0xC5,
+  0x58, 0xAA, 0x22, 0x8D, 0xA2, 0x19, 0xB0, 0x48, 0x1A, 0x93, 0x40, 0xC3, 0x64, 0x1A, 0x83, 0x9B,
+  0xD5, 0x2B, 0xAE, 0xD1, 0x88, 0x09, 0x29, 0x22, 0x05, 0xF4, 0x34, 0x00, 0x15, 0x27, 0x30, 0x11,
+  0x10, 0xF9, 0xA0, 0x9F, 0xC8, 0x98, 0x89, 0x38, 0x38, 0x26, 0x42, 0x12, 0x22, 0x98, 0xD8, 0xAB,
+  0xBD, 0xBA, 0xBB, 0x88, 0x5A, 0x12, 0x27, 0x32, 0x14, 0x31, 0x98, 0xA0, 0xBD, 0xDB, 0xAA, 0x9C,
+  0x99, 0x08, 0x23, 0x73, 0x33, 0x34, 0x12, 0x83, 0x98, 0xDC, 0xCA, 0x9C, 0xBA, 0x99, 0x88, 0x40,
+  0x42, 0x44, 0x42, 0x02, 0x03, 0x09, 0xDA, 0xAA, 0x9F, 0xB9, 0x89, 0x0A, 0x10, 0x33, 0x35, 0x35,
+  0x23, 0x31, 0x98, 0xD0, 0x9C, 0xBD, 0xB9, 0x9B, 0x8A, 0x08, 0x43, 0x73, 0x33, 0x43, 0x21, 0xA2,
+  0x90, 0x9F, 0xDA, 0x99, 0xAB, 0xA8, 0x80, 0x31, 0x53, 0x35, 0x33, 0x13, 0x84, 0x88, 0xBD, 0xDA,
+  0xAB, 0xBB, 0xB9, 0x88, 0x41, 0x72, 0x32, 0x34, 0x22, 0x02, 0x09, 0xCC, 0xCA, 0xAC, 0xBB, 0xA9,
+  0x09, 0x48, 0x61, 0x23, 0x25, 0x13, 0x12, 0x08, 0xAC, 0xEB, 0xAB, 0xBB, 0x89, 0xDA, 0x3F, 0x00,
+  0xBA, 0x98, 0x41, 0x70, 0x32, 0x24, 0x23, 0x12, 0x08, 0xBC, 0xDB, 0xAC, 0xAC, 0xB9, 0x90, 0x58,
+  0x30, 0x34, 0x34, 0x23, 0x03, 0x00, 0xBC, 0xEB, 0xAC, 0xBA, 0xBA, 0x88, 0x58, 0x30, 0x16, 0x24,
+  0x22, 0x12, 0x08, 0xBB, 0xFB, 0xAB, 0xAC, 0xAA, 0x98, 0x40, 0x58, 0x23, 0x16, 0x13, 0x11, 0x08,
+  0xBA, 0xEB, 0xBB, 0xAC, 0xCA, 0xA0, 0x31, 0x78, 0x21, 0x24, 0x22, 0x11, 0x08, 0xCA, 0xDA, 0xBB,
+  0xAC, 0xBA, 0xB1, 0x31, 0x78, 0x33, 0x25, 0x22, 0x12, 0x88, 0xC9, 0xDB, 0xAC, 0xAB, 0xBB, 0xC0,
+  0x22, 0x70, 0x31, 0x24, 0x22, 0x12, 0x88, 0xC9, 0xDB, 0xBB, 0x9D, 0x9B, 0xA8, 0x22, 0x70, 0x32,
+  0x24, 0x23, 0x11, 0x90, 0xCA, 0xCC, 0xCA, 0x9B, 0x8C, 0xA8, 0x03, 0x62, 0x32, 0x34, 0x32, 0x11,
+  0x90, 0xCB, 0xDC, 0xBA, 0x9C, 0x9B, 0xA8, 0x04, 0x62, 0x41, 0x23, 0x22, 0x02, 0x98, 0xDA, 0xDB,
+  0x78, 0x09, 0x41, 0x00, 0xBB, 0xAB, 0x8C, 0x99, 0x04, 0x34, 0x63, 0x22, 0x13, 0x01, 0x88, 0xAD,
+  0xDB, 0xBA, 0x9C, 0x8B, 0x09, 0x03, 0x26, 0x53, 0x32, 0x22, 0x01, 0x98, 0xBC, 0xCD, 0xCA, 0xA9,
+  0x0B, 0x1A, 0x11, 0x26, 0x34, 0x33, 0x32, 0x11, 0xB9, 0xEB, 0xAD, 0xCB, 0xB9, 0x8A, 0x2A, 0x31,
+  0x35, 0x26, 0x33, 0x22, 0x81, 0xB8, 0xCC, 0xBC, 0xBC, 0xCA, 0x98, 0x28, 0x30, 0x36, 0x53, 0x22,
+  0x12, 0x81, 0x9A, 0xCD, 0xCA, 0xAB, 0xBB, 0xB0, 0x21, 0x71, 0x42, 0x24, 0x22, 0x12, 0x90, 0xB9,
+  0xBD, 0xCC, 0xAB, 0x9B, 0xA9, 0x13, 0x72, 0x33, 0x16, 0x22, 0x11, 0x90, 0xAA, 0xAE, 0xCB, 0xBA,
+  0x8B, 0x0A, 0x02, 0x36, 0x63, 0x22, 0x23, 0x10, 0x98, 0xBB, 0xBF, 0xCB, 0xC9, 0x89, 0x19, 0x20,
+  0x34, 0x35, 0x33, 0x33, 0x20, 0xBA, 0xFB, 0xAC, 0xAC, 0xBA, 0x99, 0x18, 0x41, 0x44, 0x43, 0x32,
+  0x03, 0x02, 0xAB, 0xDD, 0x37, 0x11, 0x41, 0x00, 0xBA, 0xAC, 0xAA, 0x9A, 0x01, 0x43, 0x45, 0x42,
+  0x31, 0x83, 0x82, 0x8C, 0xCC, 0xBA, 0xAC, 0x9A, 0x0B, 0x81, 0x44, 0x43, 0x24, 0x42, 0x10, 0xA1,
+  0x99, 0xBE, 0xC9, 0xAA, 0xAA, 0x18, 0x28, 0x53, 0x43, 0x14, 0x23, 0x21, 0x88, 0xC9, 0xAC, 0xCB,
+  0x9A, 0xBB, 0x09, 0x1B, 0x04, 0x43, 0x23, 0x45, 0x20, 0x13, 0x01, 0x88, 0x9C, 0xCA, 0xAA, 0xBB,
+  0xAC, 0xBA, 0x89, 0x10, 0x33, 0x36, 0x45, 0x32, 0x13, 0x23, 0x80, 0xA9, 0xCA, 0xEB, 0xBB, 0xCC,
+  0xA9, 0x9A, 0x29, 0x81, 0x34, 0x63, 0x43, 0x12, 0x03, 0x12, 0xA8, 0xBB, 0xCD, 0xD9, 0xAA, 0xAB,
+  0x8A, 0x80, 0x40, 0x21, 0x27, 0x22, 0x32, 0x82, 0x80, 0x90, 0x9D, 0xCD, 0xAA, 0xBB, 0xB9, 0x09,
+  0x80, 0x58, 0x33, 0x27, 0x12, 0x32, 0x08, 0x08, 0xF9, 0xB8, 0x99, 0xBD, 0x09, 0xCB, 0x42, 0x80,
+  0x50, 0x00, 0x04, 0x08, 0x91, 0x08, 0x08, 0xC0, 0xC5, 0xFD, 0x21, 0x00, 0x0D, 0x89, 0x00, 0x08,
+  0x08, 0x88, 0x80, 0x13, 0x77, 0x08, 0x80, 0x80, 0x08, 0x80, 0x69, 0xC0, 0x22, 0x4D, 0xE2, 0x02,
+  0x1B, 0xA0, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x08, 0x08,
+  0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7B, 0xFF, 0x3C, 0x9B, 0x4F, 0xC4,
+  0x8A, 0x09, 0x08, 0x80, 0x80, 0x80, 0x08, 0xA0, 0x75, 0x85, 0x00, 0x88, 0x00, 0x08, 0x88, 0xF1,
+  0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x58, 0x98, 0x07, 0x80, 0x89, 0xA3, 0x98, 0x28, 0x9F, 0xA4,
+  0x29, 0x92, 0x11, 0x83, 0x80, 0x80, 0x00, 0x49, 0xEF, 0xB4, 0x30, 0xE8, 0x30, 0x80, 0x5B, 0xAA,
+  0x04, 0x80, 0x10, 0x99, 0x22, 0x1D, 0xC2, 0x00, 0x98, 0xF8, 0xB7, 0x20, 0x3B, 0x00, 0x2B, 0x00,
+  0x88, 0x3D, 0x11, 0x7A, 0xCA, 0x87, 0x1A, 0x82, 0x2F, 0xB2, 0x39, 0xF1, 0x13, 0x8D, 0x82, 0xBA,
+  0x21, 0x10, 0xA0, 0x91, 0x04, 0xB0, 0x87, 0x2C, 0x93, 0x0B, 0xA2, 0x2A, 0xB5, 0x59, 0xA9, 0x13,
+  0xB9, 0x1A, 0xF2, 0x39, 0xC9, 0x13, 0x8B, 0x24, 0xDB, 0x05, 0x0C, 0x83, 0x0C, 0xB4, 0x18, 0x92,
+  0x4B, 0xA1, 0x20, 0xA2, 0x4B, 0xE2, 0x5A, 0xC8, 0x02, 0x88, 0x39, 0x0A, 0x83, 0x28, 0x01, 0x3B,
+  0x0D, 0xF3, 0x18, 0x89, 0x6A, 0xA8, 0x02, 0x98, 0x80, 0x1E, 0xA8, 0x80, 0x84, 0x71, 0x21, 0x22,
+  0x94, 0x10, 0xFA, 0x2A, 0xCF, 0x81, 0x9B, 0x01, 0x39, 0x14, 0x34, 0x24, 0x11, 0x81, 0x9A, 0xDB,
+  0xBB, 0xBD, 0xCB, 0x9B, 0xB8, 0x71, 0x14, 0x62, 0x02, 0x11, 0x88, 0x99, 0xCA, 0x89, 0xBD, 0xB8,
+  0xAB, 0x89, 0x3B, 0x47, 0x42, 0x34, 0x00, 0x80, 0xBA, 0xB8, 0x8B, 0xDA, 0x8B, 0xCD, 0xA9, 0xA0,
+  0xD0, 0xCB, 0x3C, 0x00, 0x71, 0x23, 0x53, 0x03, 0x88, 0xA8, 0x9C, 0x80, 0x99, 0xB0, 0x9F, 0xCA,
+  0x0B, 0x10, 0x73, 0x23, 0x24, 0x00, 0x9A, 0xB9, 0x0A, 0x11, 0x88, 0xAE, 0xFC, 0x99, 0x08, 0x20,
+  0x35, 0x22, 0x14, 0x99, 0x89, 0xAB, 0x31, 0x01, 0x91, 0xFF, 0xAA, 0x9A, 0x30, 0x30, 0x27, 0x11,
+  0x12, 0xAA, 0x89, 0x88, 0x60, 0x92, 0xB8, 0xCF, 0x9A, 0x99, 0x42, 0x10, 0x25, 0x00, 0x12, 0xA9,
+  0x19, 0x90, 0x71, 0xA2, 0xAC, 0xBD, 0x9B, 0x00, 0x41, 0x21, 0x14, 0x21, 0x12, 0x99, 0x18, 0x80,
+  0x62, 0xC1, 0xCD, 0xBB, 0x9D, 0x21, 0x48, 0x88, 0x05, 0x02, 0x43, 0x99, 0x2B, 0xA1, 0x21, 0x83,
+  0xEF, 0xAA, 0x9A, 0x02, 0x28, 0xB2, 0x72, 0x32, 0x20, 0x92, 0xEB, 0x22, 0x80, 0x38, 0xFC, 0xBA,
+  0x90, 0x19, 0x00, 0xB2, 0x79, 0x06, 0x80, 0x23, 0xCB, 0x49, 0x81, 0x18, 0xC0, 0x9E, 0x98, 0x80,
+  0x00, 0x19, 0x39, 0x27, 0xF8, 0x05, 0x44, 0x00, 0x81, 0x40, 0xB1, 0x0C, 0x23, 0x9A, 0x11, 0xDE,
+  0x8A, 0x80, 0x88, 0x08, 0xB0, 0x66, 0x11, 0x19, 0x02, 0xEB, 0x31, 0x91, 0x2A, 0xF0, 0xAA, 0x01,
+  0x89, 0x88, 0x80, 0x59, 0x26, 0x88, 0x30, 0xC3, 0x0D, 0x22, 0x99, 0x00, 0xFB, 0x8A, 0x81, 0x98,
+  0x19, 0xA0, 0x65, 0x02, 0x09, 0x14, 0xEB, 0x30, 0x01, 0x8B, 0x90, 0xBD, 0x29, 0x91, 0xAB, 0x21,
+  0x29, 0x67, 0x91, 0x28, 0x82, 0x9D, 0x31, 0xA1, 0x0A, 0xC8, 0xAE, 0x10, 0xA0, 0x8A, 0x04, 0x5A,
+  0x24, 0xA0, 0x52, 0xC0, 0x1C, 0x13, 0xA8, 0x88, 0xDA, 0x0C, 0x11, 0xB9, 0x2A, 0x82, 0x63, 0x33,
+  0x08, 0x14, 0xEB, 0x29, 0x13, 0x99, 0xB9, 0xAF, 0x1A, 0x01, 0xDA, 0x28, 0x30, 0x34, 0x23, 0x12,
+  0xA1, 0xAF, 0x32, 0x83, 0xAB, 0xCC, 0xBC, 0x09, 0x83, 0xAD, 0x38, 0x62, 0x22, 0x22, 0x13, 0xA9,
+  0x8B, 0x4A, 0x23, 0xF8, 0xCC, 0xAA, 0x18, 0xA8, 0x3C, 0xE5, 0x3B, 0x00, 0xA9, 0x01, 0x72, 0x26,
+  0x01, 0x22, 0xC0, 0x9C, 0x32, 0x82, 0xCB, 0xCB, 0xB9, 0x2B, 0x81, 0xAE, 0x30, 0x44, 0x31, 0x23,
+  0x14, 0xCA, 0x8B, 0x42, 0x91, 0xD9, 0xCA, 0xBB, 0x19, 0xB1, 0xAC, 0x32, 0x37, 0x42, 0x22, 0x82,
+  0xD9, 0x0A, 0x41, 0x80, 0xCB, 0xBC, 0xAB, 0x18, 0xA0, 0x9D, 0x22, 0x45, 0x43, 0x22, 0x02, 0xDA,
+  0x0A, 0x30, 0x80, 0xDB, 0xBC, 0xAB, 0x09, 0x98, 0xA9, 0x22, 0x75, 0x34, 0x22, 0x13, 0xC9, 0x9C,
+  0x20, 0x91, 0xE9, 0xAA, 0x99, 0x8A, 0xA8, 0x99, 0x28, 0x72, 0x36, 0x22, 0x22, 0x91, 0xAB, 0x19,
+  0x83, 0xEC, 0xBB, 0x9A, 0x99, 0x9A, 0x88, 0x80, 0x31, 0x54, 0x43, 0x12, 0x23, 0x13, 0x42, 0x33,
+  0x83, 0x9A, 0xBF, 0xAC, 0xBA, 0xDB, 0x9A, 0xAA, 0xBB, 0x0A, 0x33, 0x73, 0x32, 0x32, 0x53, 0x24,
+  0x15, 0x11, 0x08, 0x99, 0xBA, 0xBC, 0xAD, 0xBC, 0xBB, 0xAA, 0x8B, 0xC8, 0x9B, 0xF2, 0x2A, 0x00,
+  0x22, 0x29, 0x45, 0x34, 0x23, 0x34, 0x33, 0x23, 0x13, 0xBB, 0xFB, 0xCB, 0xCA, 0xBB, 0xBC, 0xBB,
+  0xAA, 0x1A, 0x04, 0x32, 0x63, 0x43, 0x43, 0x33, 0x32, 0x83, 0x80, 0x00, 0xEA, 0xEB, 0xBB, 0xAB,
+  0xBB, 0x9C, 0xC8, 0x19, 0x05, 0x31, 0x33, 0x43, 0x53, 0x23, 0x14, 0x40, 0x80, 0xB0, 0x8B, 0x9D,
+  0xBB, 0xCB, 0x9C, 0x08, 0xE8, 0x19, 0x04, 0x08, 0x14, 0x32, 0x38, 0x85, 0x58, 0x81, 0x80, 0x80,
+  0x18, 0xFA, 0x19, 0xD8, 0x09, 0x9C, 0x00, 0x88, 0x00, 0x88, 0x80, 0x00, 0x69, 0x06, 0x88, 0x53,
+  0x08, 0x08, 0x08, 0x80, 0x18, 0xFA, 0x0B, 0xF9, 0x88, 0x80, 0x9C, 0x80, 0x08, 0x38, 0x07, 0x08,
+  0x14, 0x08, 0x80, 0x71, 0x80, 0x00, 0xAC, 0x80, 0x80, 0x80, 0xAF, 0x81, 0x08, 0x08, 0x08, 0x80,
+  0x80, 0x79, 0x86, 0x00, 0x08, 0x06, 0x80, 0x80, 0x80, 0x80, 0xE0, 0x0B, 0x88, 0x00, 0x88, 0x00,
+  0x0C, 0x00, 0x1B, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0xA1, 0x71, 0x77, 0x01, 0xE8, 0x0A,
+  0x80, 0x80, 0x80, 0xF1, 0x0B, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x08, 0x08, 0x08,
+  0x08, 0x88, 0x90, 0xA3, 0xFF, 0xFF, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x7A, 0xF8, 0x27,
+  0x8C, 0x85, 0x8B, 0x80, 0x21, 0xEA, 0x20, 0x08, 0x90, 0x39, 0x93, 0x7B, 0xA2, 0xB8, 0x59, 0xA9,
+  0x60, 0x81, 0x20, 0x8A, 0x80, 0xC0, 0x0B, 0x23, 0xBF, 0x01, 0x93, 0x8B, 0x73, 0x82, 0x08, 0x27,
+  0x91, 0x49, 0x08, 0xE2, 0x08, 0x18, 0xAC, 0x99, 0x99, 0x94, 0x0C, 0x9B, 0xA1, 0x01, 0x42, 0x1C,
+  0x26, 0x23, 0x43, 0x34, 0x22, 0x01, 0xC0, 0x8C, 0xFB, 0x9B, 0xE9, 0xA8, 0x8B, 0xAB, 0xB9, 0x98,
+  0x00, 0x72, 0x57, 0x32, 0x34, 0x82, 0x88, 0x89, 0xDA, 0xDB, 0xAA, 0x9A, 0xAA, 0x98, 0xA9, 0xCB,
+  0x1B, 0x91, 0x41, 0x75, 0x3F, 0xEF, 0x3B, 0x00, 0x24, 0x34, 0x34, 0x01, 0xA9, 0x8A, 0xDA, 0xBC,
+  0xAA, 0x99, 0x9A, 0x09, 0x98, 0xAC, 0x98, 0x8A, 0x4A, 0x27, 0x26, 0x44, 0x43, 0x02, 0x98, 0xA9,
+  0xC9, 0xDB, 0xAA, 0x99, 0x99, 0x00, 0x88, 0x89, 0xA9, 0x88, 0x99, 0x73, 0x45, 0x44, 0x34, 0x33,
+  0x01, 0xB9, 0xAB, 0xDC, 0xCB, 0x9A, 0x9A, 0x09, 0x90, 0x80, 0x88, 0x1C, 0x99, 0x10, 0x27, 0x70,
+  0x34, 0x33, 0x44, 0x81, 0xAA, 0x99, 0xDC, 0x9B, 0xB9, 0x9B, 0x10, 0x98, 0x29, 0x90, 0xBB, 0x23,
+  0x1B, 0x37, 0x55, 0x44, 0x32, 0x43, 0x91, 0x99, 0xC9, 0xBD, 0x9A, 0xBC, 0x89, 0x90, 0x88, 0x21,
+  0xAA, 0x18, 0xD1, 0x10, 0x43, 0x70, 0x35, 0x32, 0x35, 0x82, 0x89, 0xC8, 0xAD, 0xAA, 0xBC, 0x8A,
+  0x99, 0x08, 0x01, 0x88, 0x01, 0xA8, 0x22, 0x69, 0x41, 0x47, 0x23, 0x73, 0x11, 0x08, 0xA0, 0xBB,
+  0xAC, 0xCC, 0xAA, 0x98, 0x09, 0x81, 0x01, 0x10, 0x60, 0xE9, 0x33, 0x00, 0x29, 0x98, 0x01, 0x44,
+  0x73, 0x26, 0x32, 0x25, 0x01, 0x00, 0xC9, 0xBB, 0xCC, 0xAC, 0x9A, 0x99, 0x08, 0x20, 0x80, 0x32,
+  0xA0, 0x31, 0x29, 0x06, 0x75, 0x22, 0x41, 0x15, 0x01, 0x18, 0xCA, 0xAA, 0xDC, 0xAA, 0x9A, 0x8A,
+  0x80, 0x10, 0x01, 0x12, 0x12, 0x2A, 0x04, 0x03, 0x77, 0x12, 0x43, 0x03, 0x21, 0x90, 0xBB, 0xDD,
+  0xDB, 0x9A, 0x8C, 0x98, 0x88, 0x01, 0x10, 0x22, 0x88, 0x12, 0x21, 0x35, 0x71, 0x14, 0x41, 0x24,
+  0x18, 0x81, 0xB9, 0xCB, 0xAF, 0xCA, 0x9A, 0x99, 0x89, 0x82, 0x10, 0x32, 0x10, 0x12, 0x42, 0x61,
+  0x21, 0x17, 0x31, 0x24, 0x02, 0x03, 0x99, 0xDB, 0xCD, 0xBB, 0xCB, 0xA9, 0x99, 0x81, 0x20, 0x21,
+  0x14, 0x02, 0x42, 0x49, 0x85, 0x70, 0x02, 0x42, 0x12, 0x21, 0x80, 0xB9, 0xFB, 0xAC, 0xAC, 0xB9,
+  0x8A, 0x89, 0x10, 0x10, 0x33, 0x13, 0x70, 0x90, 0x23, 0x12, 0x54, 0x24, 0xC2, 0x0C, 0x35, 0x00,
+  0x72, 0x93, 0x40, 0xB8, 0x81, 0xAF, 0xB0, 0x9D, 0xA8, 0x1A, 0xA0, 0x20, 0x91, 0x43, 0x89, 0x03,
+  0x89, 0x25, 0x5A, 0x06, 0x41, 0x22, 0x22, 0x91, 0x91, 0x9F, 0xDB, 0xBA, 0xCA, 0x89, 0x8A, 0x00,
+  0x21, 0x02, 0x43, 0x09, 0x13, 0x2C, 0xA7, 0x71, 0x00, 0x14, 0x40, 0x00, 0x10, 0xAA, 0xD8, 0x9C,
+  0xBC, 0xA9, 0x8A, 0x98, 0x20, 0x10, 0x23, 0x41, 0x08, 0x95, 0x32, 0x78, 0x03, 0x26, 0x31, 0x21,
+  0x01, 0xC8, 0xD8, 0xAC, 0xBC, 0xBA, 0x9A, 0x8B, 0x81, 0x31, 0x13, 0x34, 0x10, 0x04, 0x58, 0x80,
+  0x37, 0x50, 0x22, 0x43, 0x10, 0x91, 0x99, 0xBE, 0xDB, 0xAB, 0xBC, 0xA8, 0x09, 0x18, 0x22, 0x41,
+  0x03, 0x13, 0x40, 0x49, 0xA2, 0x37, 0x68, 0x11, 0x23, 0x20, 0xA1, 0x8A, 0xBF, 0xEA, 0xAA, 0x9B,
+  0xAA, 0x19, 0x09, 0x04, 0x42, 0x20, 0x03, 0x30, 0x29, 0x04, 0x26, 0x51, 0x22, 0x24, 0x30, 0x90,
+  0xBC, 0x1E, 0x32, 0x00, 0xD9, 0xEA, 0xBB, 0xBC, 0xDA, 0xA8, 0x09, 0x08, 0x31, 0x31, 0x04, 0x32,
+  0x20, 0x01, 0x84, 0x73, 0x40, 0x22, 0x34, 0x12, 0x83, 0x8A, 0xBF, 0xEA, 0xAB, 0xCB, 0xA9, 0x8A,
+  0x08, 0x02, 0x33, 0x43, 0x12, 0x23, 0x48, 0x20, 0x02, 0x47, 0x62, 0x30, 0x04, 0x21, 0x98, 0xB8,
+  0xCC, 0xAD, 0xCB, 0xBA, 0x9A, 0x89, 0x48, 0x18, 0x86, 0x22, 0x38, 0x88, 0x94, 0x40, 0x29, 0x05,
+  0x62, 0x20, 0x84, 0x21, 0x89, 0xC8, 0xBB, 0xBE, 0xCA, 0xB9, 0x8A, 0x99, 0x10, 0x31, 0x23, 0x34,
+  0x30, 0x01, 0x03, 0x70, 0x68, 0x12, 0x24, 0x43, 0x13, 0x21, 0x89, 0xDC, 0xDA, 0xBC, 0xBA, 0x9C,
+  0x9A, 0x98, 0x11, 0x20, 0x14, 0x32, 0x20, 0x83, 0x31, 0x79, 0x11, 0x17, 0x33, 0x24, 0x23, 0x40,
+  0x99, 0xEA, 0xBB, 0xBE, 0xCA, 0x99, 0x8B, 0x89, 0x10, 0x21, 0x14, 0x61, 0x18, 0x81, 0x11, 0x38,
+  0x93, 0x37, 0x62, 0x21, 0xD6, 0x10, 0x36, 0x00, 0x23, 0x21, 0x99, 0xF8, 0xCA, 0xCB, 0xBB, 0xBB,
+  0x9A, 0x89, 0x01, 0x63, 0x31, 0x22, 0x03, 0x32, 0x18, 0x00, 0x07, 0x35, 0x61, 0x32, 0x42, 0x20,
+  0xA0, 0xC9, 0xBC, 0xAF, 0xBB, 0xBA, 0x8B, 0x99, 0x21, 0x42, 0x24, 0x33, 0x13, 0x40, 0x98, 0x93,
+  0x83, 0x74, 0x50, 0x13, 0x15, 0x11, 0x91, 0xB9, 0xBD, 0xBD, 0xAD, 0xCA, 0x99, 0x09, 0x08, 0x22,
+  0x43, 0x13, 0x33, 0x10, 0xA1, 0xA3, 0x02, 0x71, 0x24, 0x27, 0x32, 0x82, 0x03, 0x8D, 0xFB, 0xBA,
+  0xAC, 0xBB, 0xAA, 0x89, 0x10, 0x43, 0x53, 0x21, 0x13, 0x01, 0x19, 0xC0, 0x04, 0x7C, 0x81, 0x15,
+  0x31, 0x82, 0x12, 0x8C, 0xEA, 0xBA, 0xAD, 0xCA, 0x98, 0x09, 0x18, 0x22, 0x42, 0x04, 0x41, 0x09,
+  0xB2, 0x10, 0x2A, 0x48, 0x15, 0x44, 0x33, 0x04, 0x10, 0xA9, 0xCC, 0xCC, 0xCB, 0xBA, 0xAA, 0x88,
+  0x10, 0x33, 0x44, 0x22, 0x22, 0x00, 0x98, 0x98, 0xDA, 0xFB, 0x2D, 0x00, 0x6B, 0x29, 0x27, 0x63,
+  0x21, 0x14, 0x10, 0xA9, 0xCA, 0xBD, 0xEB, 0x9A, 0x9A, 0x98, 0x10, 0x21, 0x14, 0x43, 0x18, 0xA2,
+  0x08, 0x99, 0x08, 0x93, 0x77, 0x50, 0x21, 0x22, 0x00, 0x90, 0xAC, 0xCD, 0xCA, 0x9B, 0xAB, 0x98,
+  0x11, 0x31, 0x24, 0x43, 0x01, 0xB3, 0x4C, 0xCB, 0xA4, 0x48, 0x18, 0x07, 0x41, 0x11, 0x02, 0x19,
+  0xCA, 0xC9, 0xAD, 0xBB, 0xB9, 0x0A, 0x19, 0x13, 0x34, 0x53, 0x20, 0x80, 0xA2, 0x0B, 0xB8, 0x50,
+  0x10, 0x47, 0x51, 0x13, 0x32, 0x88, 0xB0, 0xAE, 0xDC, 0xAA, 0xAB, 0xA9, 0x18, 0x38, 0x24, 0x62,
+  0x81, 0x03, 0x2A, 0xD8, 0x80, 0x1A, 0x20, 0x04, 0x47, 0x30, 0x13, 0x23, 0xA9, 0xD8, 0x9E, 0xDB,
+  0xA9, 0x9B, 0xA8, 0x20, 0x30, 0x24, 0x51, 0x81, 0x82, 0x0A, 0xC8, 0x09, 0x88, 0x44, 0x78, 0x13,
+  0x53, 0x11, 0x01, 0x8A, 0xEB, 0xBB, 0xBD, 0xBA, 0x8A, 0x0B, 0x83, 0x44, 0x57, 0xEB, 0x3A, 0x00,
+  0x30, 0x84, 0x02, 0x09, 0xA9, 0x8A, 0xB9, 0x43, 0x63, 0x35, 0x53, 0x23, 0x13, 0x80, 0xBB, 0xDE,
+  0xCA, 0xBB, 0xBB, 0xA9, 0x28, 0x21, 0x34, 0x33, 0x33, 0x18, 0xBA, 0xE0, 0x0A, 0x98, 0x54, 0x24,
+  0x55, 0x22, 0x14, 0x10, 0x98, 0xCB, 0xEB, 0xAB, 0xBC, 0x99, 0x89, 0x30, 0x11, 0x35, 0x20, 0x93,
+  0x29, 0xDB, 0x90, 0x9B, 0x23, 0x72, 0x63, 0x33, 0x34, 0x13, 0x81, 0xB9, 0xBD, 0xBE, 0xCB, 0xAB,
+  0x8A, 0x88, 0x12, 0x43, 0x13, 0x23, 0x18, 0xC8, 0x99, 0xAB, 0x38, 0x00, 0x77, 0x32, 0x25, 0x22,
+  0x33, 0x90, 0xA0, 0xBF, 0xCB, 0xAD, 0xAA, 0x9B, 0x90, 0x38, 0x33, 0x42, 0x04, 0x28, 0x90, 0x9B,
+  0xA1, 0x0F, 0x93, 0x60, 0x23, 0x35, 0x23, 0x43, 0x81, 0x89, 0xDC, 0xAD, 0xCA, 0xAB, 0xA9, 0x08,
+  0x01, 0x42, 0x04, 0x21, 0x92, 0x98, 0x98, 0x0F, 0xB1, 0x48, 0x31, 0x32, 0x57, 0x20, 0x12, 0x92,
+  0x4E, 0x1E, 0x37, 0x00, 0x09, 0xEA, 0xCB, 0xBA, 0xAC, 0x9A, 0x90, 0x21, 0x32, 0x24, 0x13, 0x19,
+  0xB1, 0xAC, 0x99, 0x99, 0x53, 0x41, 0x46, 0x52, 0x22, 0x23, 0x12, 0xA8, 0xCB, 0xEC, 0xBB, 0xBA,
+  0xAC, 0x08, 0x08, 0x42, 0x22, 0x31, 0x80, 0xA0, 0xA9, 0xBC, 0x9A, 0x24, 0x41, 0x56, 0x22, 0x26,
+  0x22, 0x21, 0x82, 0xBB, 0xBC, 0xDD, 0x9C, 0xAA, 0x9A, 0x18, 0x10, 0x22, 0x24, 0x08, 0x01, 0xBA,
+  0x9B, 0x9B, 0x1B, 0x46, 0x33, 0x37, 0x44, 0x32, 0x32, 0x12, 0xA9, 0xAE, 0xEB, 0xCB, 0xAB, 0xAA,
+  0x8A, 0x11, 0x22, 0x33, 0x15, 0x80, 0x80, 0x9A, 0xCB, 0x08, 0x08, 0x73, 0x16, 0x52, 0x33, 0x24,
+  0x22, 0x91, 0xBC, 0xBC, 0xBD, 0xBD, 0xAA, 0x89, 0x19, 0x23, 0x33, 0x42, 0x03, 0xA8, 0x80, 0xAC,
+  0xAA, 0x80, 0x72, 0x44, 0x44, 0x43, 0x33, 0x03, 0x90, 0xBC, 0xDC, 0xCB, 0xAC, 0x99, 0x89, 0x11,
+  0x22, 0x33, 0x32, 0x01, 0x6D, 0xFE, 0x2C, 0x00, 0xA8, 0xBB, 0xCB, 0x9C, 0x2B, 0x37, 0x73, 0x34,
+  0x24, 0x23, 0x91, 0xBA, 0xBC, 0xCE, 0xAB, 0x9B, 0x88, 0x00, 0x42, 0x23, 0x21, 0x01, 0x99, 0xCB,
+  0xCB, 0xBB, 0x2A, 0x53, 0x47, 0x42, 0x24, 0x13, 0x90, 0x9A, 0xDB, 0xCC, 0xBB, 0x9A, 0x88, 0x18,
+  0x23, 0x14, 0x21, 0x80, 0xC0, 0xAB, 0x8A, 0xB8, 0x18, 0x67, 0x31, 0x53, 0x34, 0x22, 0x98, 0xBC,
+  0xBB, 0xCC, 0xAD, 0x9A, 0x00, 0x10, 0x22, 0x22, 0x80, 0x21, 0x80, 0xBA, 0x38, 0x84, 0x41, 0x64,
+  0x22, 0x11, 0x12, 0x03, 0xBD, 0xAB, 0xC8, 0xBD, 0x89, 0x82, 0x08, 0x28, 0x05, 0xC9, 0xBB, 0x00,
+  0xDB, 0xBB, 0x15, 0x48, 0x44, 0x46, 0x32, 0x12, 0x01, 0xCA, 0xBD, 0xBC, 0xBA, 0x89, 0x18, 0x52,
+  0x24, 0x14, 0x10, 0x89, 0x08, 0xCA, 0x9A, 0x20, 0x01, 0xBB, 0x51, 0x31, 0xDB, 0x89, 0x00, 0xBC,
+  0x81, 0x60, 0x30, 0x52, 0x34, 0x08, 0xCA, 0xCB, 0x66, 0x01, 0x2B, 0x00, 0xDD, 0xAB, 0x0A, 0x48,
+  0x33, 0x27, 0x14, 0xA0, 0xBB, 0x19, 0x12, 0x9A, 0x20, 0x85, 0xCD, 0x9A, 0x90, 0xA9, 0x41, 0x14,
+  0x90, 0xA9, 0x89, 0xAB, 0x5B, 0x34, 0x03, 0x38, 0x02, 0xFB, 0x89, 0x28, 0x83, 0x08, 0x08, 0xE8,
+  0x9D, 0x80, 0x18, 0x14, 0x13, 0x08, 0x94, 0x1B, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x88, 0x80, 0x90, 0xF3, 0x74, 0x55, 0x09, 0x87, 0x08, 0x08, 0x90, 0x43, 0x3B,
+  0x6B, 0x9A, 0x01, 0x7A, 0x82, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x7B, 0xFF, 0x3F, 0x02, 0xFB, 0x48, 0xB0, 0x09, 0x80, 0x80, 0x80, 0x08,
+  0x08, 0x80, 0x08, 0xF1, 0x9F, 0x80, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x08, 0x5A, 0xF9, 0xFF, 0x0E, 0x88, 0x00, 0x08, 0xB3, 0xFC, 0x1E, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0xF0, 0x77, 0x07, 0x08, 0x08,
+  0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0xC1, 0x77, 0xC9, 0x16, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x3B, 0xF7, 0xFF, 0x7A, 0x08, 0x1C, 0xA0, 0xA5, 0xA0, 0x32, 0x4B,
+  0x8C, 0x81, 0xD4, 0x80, 0x31, 0x1B, 0x1B, 0xB4, 0xC4, 0x5A, 0x08, 0xD0, 0x01, 0x81, 0x1C, 0x49,
+  0xA0, 0xC2, 0x02, 0x28, 0x0E, 0x10, 0xC0, 0x18, 0x92, 0x58, 0x88, 0x1C, 0xD3, 0x90, 0x83, 0x40,
+  0x08, 0x88, 0xC1, 0x8E, 0x21, 0x09, 0x1B, 0xC4, 0x08, 0x94, 0x50, 0x08, 0x08, 0xC8, 0x9A, 0x08,
+  0x4E, 0xFE, 0x20, 0x00, 0x28, 0xA7, 0x0A, 0x08, 0x08, 0x48, 0x07, 0x98, 0x01, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0xC8, 0x77, 0x1D,
+  0x88, 0x70, 0xE6, 0x40, 0x81, 0x08, 0x08, 0x08, 0x08, 0xE0, 0xF0, 0x0B, 0xF0, 0xBF, 0xB6, 0x2A,
+  0x74, 0x90, 0x20, 0xB3, 0xAF, 0x61, 0x92, 0xCA, 0x18, 0x00, 0x89, 0x00, 0xB8, 0x19, 0x34, 0x98,
+  0x80, 0x90, 0x2B, 0x45, 0xA1, 0xAA, 0x31, 0xAC, 0x4B, 0x82, 0x83, 0x50, 0x26, 0xDA, 0x8A, 0x22,
+  0xA1, 0xAA, 0xBC, 0x0C, 0x82, 0xB9, 0x28, 0x89, 0x44, 0xA5, 0x9A, 0x73, 0x11, 0x35, 0xB3, 0x09,
+  0x10, 0xCF, 0x10, 0x84, 0xCB, 0x8A, 0x80, 0x90, 0x13, 0x9A, 0x8C, 0x24, 0x13, 0x9C, 0x78, 0x02,
+  0x22, 0x23, 0x99, 0x18, 0xFB, 0x0B, 0x33, 0xDA, 0xBD, 0x99, 0x11, 0x00, 0xBA, 0x91, 0x32, 0x04,
+  0x0C, 0x37, 0x33, 0x24, 0xBF, 0x1D, 0x3B, 0x00, 0x81, 0x9A, 0xBB, 0x08, 0x17, 0xCA, 0xAE, 0x8B,
+  0x22, 0xD0, 0x89, 0x00, 0x28, 0xA3, 0xAC, 0x73, 0x31, 0x33, 0x92, 0x38, 0x03, 0xCF, 0x48, 0x92,
+  0xCD, 0x89, 0x00, 0x89, 0x91, 0xCB, 0x28, 0x16, 0xBA, 0x49, 0x23, 0x22, 0x15, 0x00, 0x21, 0xEB,
+  0x1A, 0x16, 0xD9, 0x9B, 0x00, 0x88, 0x08, 0xB9, 0x1A, 0x14, 0x98, 0xA9, 0x22, 0x77, 0x03, 0x99,
+  0x52, 0xA1, 0x8D, 0x31, 0xB0, 0xAC, 0x00, 0xBA, 0x88, 0x11, 0xAC, 0x40, 0xA0, 0x9A, 0x63, 0x41,
+  0x34, 0x82, 0x88, 0x22, 0x9A, 0x1C, 0x83, 0xFC, 0x9B, 0x90, 0xBA, 0x08, 0x94, 0x8F, 0x13, 0xC8,
+  0x3A, 0x06, 0x21, 0x13, 0x08, 0x32, 0xC2, 0x9D, 0x21, 0xC8, 0x9A, 0xD9, 0xAB, 0x10, 0x99, 0x08,
+  0x81, 0xAD, 0x3A, 0x17, 0x44, 0x12, 0x08, 0x32, 0xA2, 0xAA, 0x20, 0xBB, 0xBF, 0xB9, 0xFB, 0x89,
+  0x2B, 0x10, 0xFA, 0x01, 0x08, 0x48, 0x29, 0x47, 0x8C, 0x0B, 0x43, 0x00, 0xA1, 0x38, 0x15, 0xBB,
+  0x29, 0x04, 0xD9, 0x9A, 0x19, 0x89, 0xDA, 0x88, 0x02, 0x89, 0x89, 0xA2, 0x83, 0x77, 0x22, 0x08,
+  0x11, 0xB1, 0x19, 0x31, 0xD8, 0xCD, 0x88, 0x90, 0x9C, 0x09, 0xA8, 0x01, 0x81, 0x1B, 0x59, 0x51,
+  0x44, 0x23, 0x23, 0x80, 0x9B, 0x01, 0x85, 0xA8, 0xEF, 0x9A, 0x11, 0xB9, 0x9B, 0x20, 0x01, 0xB2,
+  0xBC, 0x74, 0x10, 0x41, 0x14, 0x01, 0x00, 0x9B, 0x38, 0x95, 0xC9, 0xAE, 0x89, 0xA1, 0xA9, 0x89,
+  0x09, 0x32, 0xD1, 0x8A, 0x53, 0x41, 0x35, 0x13, 0x11, 0x81, 0x9A, 0x29, 0x94, 0xFB, 0x9E, 0x9A,
+  0xA8, 0x90, 0xA8, 0x0D, 0x22, 0xA2, 0x88, 0x42, 0x64, 0x12, 0x21, 0x25, 0xB0, 0x8C, 0x10, 0x92,
+  0xDA, 0x9D, 0x8A, 0x99, 0x09, 0xBA, 0x19, 0x11, 0x23, 0x28, 0x70, 0x07, 0x12, 0x24, 0x11, 0x01,
+  0xA8, 0x9C, 0x88, 0xBA, 0xBE, 0xAD, 0x89, 0x81, 0x8A, 0x08, 0x14, 0x42, 0xEE, 0xF6, 0x33, 0x00,
+  0x03, 0x51, 0x82, 0x88, 0x33, 0xA0, 0x89, 0x38, 0x86, 0x10, 0xEB, 0x08, 0xA8, 0x28, 0xB8, 0xCC,
+  0x8A, 0x80, 0xB0, 0xCB, 0x49, 0x41, 0x11, 0x83, 0x51, 0x40, 0x81, 0x23, 0x08, 0x28, 0x94, 0x13,
+  0xE0, 0x0C, 0x80, 0x2C, 0xA2, 0x8D, 0xD8, 0x09, 0x80, 0x80, 0xA0, 0x8F, 0x14, 0x88, 0x80, 0x00,
+  0x88, 0x17, 0x08, 0xA0, 0x8D, 0x80, 0x80, 0x8E, 0x08, 0xA0, 0x8D, 0x00, 0x88, 0x00, 0x59, 0xA1,
+  0x06, 0x88, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x00, 0x88, 0x80, 0xF3, 0xCF, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x18, 0x7D, 0x47, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x00, 0x7F, 0x67, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7E, 0xFF, 0x8F, 0x08, 0x08, 0x80, 0x80, 0x08,
+  0x80, 0x90, 0x75, 0x83, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x98, 0xF5, 0xAF, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xA0, 0x77, 0x83, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x90, 0xFF,
+  0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7A, 0x27, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x88, 0xF3, 0xBF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x90, 0x77, 0x86, 0x80, 0x80,
+  0x80, 0x80, 0x00, 0x08, 0x88, 0x00, 0x88, 0xF3, 0xCF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x38, 0xF3, 0x57, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x90, 0xF5,
+  0x3F, 0xE9, 0x18, 0x23, 0x19, 0x00, 0x23, 0x00, 0x89, 0xE9, 0x08, 0x88, 0x80, 0x80, 0x00, 0x88,
+  0x32, 0x87, 0x69, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF0, 0x5C, 0xCC, 0x83, 0x3B,
+  0xA9, 0x80, 0x80, 0x80, 0x80, 0x80, 0x18, 0x2A, 0x47, 0x0F, 0x18, 0xA2, 0x13, 0x2E, 0xB5, 0x32,
+  0x9D, 0x84, 0x2A, 0x81, 0x90, 0x29, 0x80, 0x00, 0x0C, 0xD4, 0x8F, 0x04, 0x0C, 0x28, 0xB0, 0x31,
+  0xC0, 0x59, 0xA2, 0x3C, 0x92, 0xA1, 0x5B, 0x90, 0x10, 0x88, 0xB0, 0x58, 0x0D, 0x83, 0x80, 0x80,
+  0x18, 0x9F, 0x85, 0x68, 0xB8, 0x17, 0xBA, 0x20, 0xFD, 0x28, 0x00, 0x1A, 0x93, 0x51, 0x81, 0x9A,
+  0x42, 0xB9, 0x41, 0xBA, 0x99, 0x44, 0x9C, 0x10, 0xC1, 0x40, 0x01, 0xBC, 0x88, 0x80, 0x44, 0x9A,
+  0x20, 0xCA, 0x58, 0xB0, 0xBC, 0x1A, 0x23, 0x9A, 0x34, 0x22, 0xBD, 0x71, 0xA0, 0xAA, 0x06, 0x1C,
+  0x02, 0xE9, 0x31, 0x09, 0x8A, 0xA4, 0x00, 0x39, 0x23, 0xFF, 0x2D, 0x00, 0x98, 0xA0, 0x1B, 0x41,
+  0x87, 0x9E, 0x30, 0xA8, 0x78, 0xA2, 0x8D, 0x20, 0x91, 0x80, 0x28, 0x9C, 0x32, 0x98, 0x90, 0x8A,
+  0x6B, 0x97, 0x0A, 0x01, 0xA9, 0x11, 0x19, 0x20, 0x01, 0xDC, 0x94, 0x4C, 0x81, 0x90, 0x92, 0x4C,
+  0x82, 0xC8, 0x31, 0xAB, 0x84, 0x85, 0x0C, 0x09, 0xA3, 0x05, 0x8C, 0xA1, 0x02, 0x99, 0x71, 0xB8,
+  0x29, 0x91, 0x83, 0x5A, 0xCA, 0xA4, 0x3C, 0x92, 0x10, 0xA2, 0xBE, 0x54, 0x88, 0x80, 0xD0, 0x1C,
+  0x12, 0xA8, 0x19, 0xD9, 0x81, 0x30, 0xC9, 0x19, 0x27, 0x89, 0x0D, 0x84, 0xA8, 0x71, 0x90, 0x19,
+  0xB4, 0x1D, 0x14, 0xCB, 0x20, 0xA1, 0x09, 0xBB, 0x19, 0x15, 0x9C, 0x89, 0x11, 0x00, 0x81, 0x19,
+  0x06, 0x62, 0xAB, 0x20, 0x35, 0x21, 0x00, 0x9A, 0x82, 0x02, 0x0C, 0xFB, 0xAD, 0x83, 0x9F, 0x89,
+  0xB8, 0x4A, 0x04, 0xA9, 0x19, 0x22, 0x31, 0x55, 0xA1, 0x2A, 0x43, 0x01, 0xCA, 0x0B, 0x34, 0x00,
+  0x21, 0x12, 0x06, 0x09, 0xBF, 0x02, 0x8B, 0x8D, 0xC8, 0x8B, 0x30, 0xBE, 0x08, 0x13, 0x29, 0xA8,
+  0x31, 0x57, 0x01, 0xA8, 0x40, 0x10, 0x23, 0x85, 0x2B, 0x14, 0xEC, 0x00, 0x98, 0x1B, 0xE1, 0xAA,
+  0x21, 0x9C, 0x10, 0xF1, 0x28, 0x01, 0x0C, 0x05, 0x98, 0x38, 0x01, 0x82, 0x00, 0x4A, 0x35, 0xA3,
+  0x1A, 0x84, 0xCF, 0x18, 0x80, 0x8A, 0xB8, 0x9D, 0x28, 0xB1, 0x4A, 0x94, 0x9D, 0x43, 0xA8, 0x19,
+  0x02, 0x39, 0x15, 0xA9, 0x10, 0x54, 0x32, 0x81, 0xA8, 0xA9, 0x0A, 0xDA, 0xE9, 0x8A, 0xBB, 0x9A,
+  0x02, 0xAA, 0x72, 0xD8, 0x51, 0x90, 0x8A, 0x93, 0x4A, 0x04, 0x99, 0x19, 0x33, 0x27, 0x23, 0x10,
+  0x13, 0xB3, 0xEF, 0x18, 0xA0, 0xA9, 0xB9, 0xBC, 0x39, 0x03, 0xA8, 0x41, 0xCB, 0x53, 0x00, 0x08,
+  0x9A, 0x29, 0x15, 0x13, 0xAA, 0x70, 0x87, 0x43, 0x81, 0x1B, 0x83, 0xBE, 0x28, 0xC8, 0xAA, 0x90,
+  0x10, 0xFB, 0x38, 0x00, 0x9C, 0x09, 0x81, 0x20, 0x11, 0x8F, 0x04, 0xA1, 0x4B, 0x90, 0x88, 0x05,
+  0x21, 0x8C, 0x42, 0x84, 0x71, 0x82, 0x9A, 0x15, 0xEA, 0x1A, 0x81, 0xA9, 0x98, 0xBB, 0x19, 0x32,
+  0xB8, 0x18, 0x10, 0x30, 0x07, 0xDB, 0x59, 0x91, 0x20, 0x81, 0x9B, 0x54, 0x04, 0x39, 0x63, 0x91,
+  0x01, 0xFA, 0x0B, 0x02, 0xBA, 0x89, 0xFB, 0x09, 0x12, 0x9A, 0x03, 0xA9, 0x70, 0xA3, 0x89, 0x10,
+  0x89, 0x43, 0xA3, 0x1A, 0x21, 0x22, 0x57, 0x19, 0x43, 0x02, 0x01, 0xFD, 0x0A, 0x82, 0xAA, 0x80,
+  0xCD, 0x1A, 0x13, 0xA8, 0x11, 0x0A, 0x62, 0xB2, 0x0A, 0x32, 0xAC, 0x46, 0xC8, 0x29, 0x12, 0x89,
+  0x16, 0x08, 0x58, 0x93, 0xA8, 0x8B, 0x8B, 0xA0, 0xBA, 0xEA, 0x9F, 0x00, 0x91, 0x20, 0x88, 0xAA,
+  0x37, 0x99, 0x39, 0xA0, 0xA0, 0x62, 0x09, 0x1B, 0x87, 0x19, 0x52, 0xAA, 0x27, 0x90, 0x3B, 0x92,
+  0xBE, 0x11, 0x88, 0xAB, 0xFC, 0xF9, 0x38, 0x00, 0xB9, 0xAA, 0x51, 0x81, 0x9C, 0x33, 0x99, 0x61,
+  0xA3, 0x9D, 0x12, 0x00, 0x38, 0xE9, 0x21, 0x22, 0x2A, 0xA6, 0x32, 0x63, 0x80, 0xA8, 0xBC, 0x20,
+  0xA9, 0xCA, 0xCA, 0x9F, 0x11, 0x92, 0x0A, 0x18, 0xB2, 0x74, 0x90, 0x9B, 0x15, 0x0A, 0x20, 0xA0,
+  0x89, 0x32, 0x31, 0xA3, 0x25, 0x70, 0x02, 0x00, 0x84, 0xCC, 0x0A, 0xA1, 0xAB, 0xB8, 0xDF, 0x20,
+  0x90, 0x89, 0x14, 0x9C, 0x32, 0x82, 0x89, 0x1A, 0x22, 0xC3, 0x5B, 0x01, 0x0B, 0x27, 0xA0, 0x79,
+  0x91, 0x12, 0x23, 0x0B, 0xA9, 0xDD, 0x81, 0x9A, 0x8B, 0xFB, 0x8A, 0x02, 0x3B, 0x92, 0xBB, 0x75,
+  0x90, 0x08, 0x80, 0x0A, 0x24, 0xC9, 0x38, 0x93, 0x29, 0x07, 0x0B, 0x22, 0x87, 0x10, 0x00, 0xBA,
+  0x88, 0xB2, 0xAF, 0x00, 0xEB, 0x88, 0xA1, 0x1B, 0x13, 0xCB, 0x25, 0x08, 0x3A, 0xC3, 0x1A, 0x52,
+  0xA0, 0x19, 0x92, 0x33, 0x74, 0xB8, 0x23, 0xB2, 0x4C, 0x04, 0x2E, 0x00, 0x7C, 0x83, 0xBA, 0x44,
+  0xB8, 0x8B, 0xA1, 0xAA, 0x11, 0xCF, 0x19, 0x80, 0xA0, 0x29, 0x30, 0x81, 0x63, 0xB1, 0x1D, 0x22,
+  0x82, 0x90, 0x2A, 0x32, 0x51, 0x93, 0x2B, 0x71, 0x83, 0x33, 0x80, 0x70, 0xB1, 0xAE, 0x81, 0xAB,
+  0xAB, 0xBC, 0xAD, 0x98, 0x91, 0x30, 0x0F, 0x04, 0x92, 0x59, 0x81, 0x8A, 0x13, 0x11, 0xA9, 0x02,
+  0x1F, 0x73, 0xA1, 0x08, 0x11, 0x0B, 0x45, 0xA1, 0x8D, 0x43, 0xEA, 0x09, 0x90, 0x9B, 0x91, 0xAE,
+  0x20, 0xA1, 0x29, 0xB1, 0x58, 0x15, 0x8A, 0x23, 0xC9, 0x48, 0x93, 0x8A, 0x80, 0x30, 0x14, 0x00,
+  0x0B, 0x38, 0x37, 0x02, 0x09, 0x89, 0xB5, 0xEA, 0x0C, 0x9B, 0xA0, 0xFB, 0x1A, 0x98, 0x0A, 0x07,
+  0x1C, 0x33, 0xD1, 0x31, 0x99, 0x28, 0x07, 0xAA, 0x30, 0x99, 0x43, 0xB2, 0x4A, 0x13, 0x99, 0x04,
+  0x19, 0x1A, 0xD1, 0xA2, 0x9F, 0x0A, 0xA9, 0xA1, 0xF0, 0x0C, 0x12, 0xC8, 0x85, 0xF7, 0x33, 0x00,
+  0x21, 0x89, 0x32, 0x84, 0x1C, 0x81, 0x08, 0x15, 0x90, 0x1A, 0x22, 0x32, 0x87, 0x1A, 0x33, 0xE9,
+  0x28, 0x80, 0x9B, 0x80, 0xEB, 0x09, 0xD9, 0x9C, 0x83, 0xDB, 0x0D, 0x92, 0x99, 0x10, 0xD9, 0x61,
+  0x82, 0x8C, 0x13, 0x08, 0x24, 0xA0, 0x1B, 0x24, 0x82, 0x11, 0x1F, 0x03, 0xD9, 0x23, 0x89, 0x28,
+  0xE8, 0xAA, 0x38, 0xDA, 0xA9, 0x8A, 0xAC, 0x90, 0x05, 0x8D, 0x11, 0xA3, 0x71, 0xA0, 0x18, 0x43,
+  0x18, 0xB1, 0x01, 0x69, 0x11, 0x90, 0x92, 0x49, 0x32, 0x9B, 0xF1, 0x28, 0x08, 0x8C, 0xC0, 0x20,
+  0xC0, 0x9C, 0x00, 0xB2, 0xB0, 0xCF, 0x19, 0x06, 0x18, 0x9B, 0x10, 0x17, 0x80, 0x28, 0x28, 0x91,
+  0x15, 0x89, 0x0A, 0x28, 0x81, 0x80, 0x90, 0x8F, 0x18, 0xB9, 0x04, 0xAD, 0x4B, 0xFA, 0x10, 0xD1,
+  0x2A, 0x92, 0xAB, 0x15, 0x8A, 0x30, 0x80, 0xAB, 0x63, 0xB1, 0x80, 0x51, 0xB9, 0x48, 0x05, 0x0B,
+  0x43, 0x00, 0x2A, 0x00, 0x03, 0xDC, 0x41, 0x90, 0x0C, 0x13, 0xBD, 0x41, 0x98, 0x0B, 0x92, 0x9C,
+  0x14, 0xCC, 0x21, 0xB0, 0x1C, 0x04, 0x8B, 0x12, 0xB9, 0x54, 0x90, 0x00, 0x88, 0x14, 0x39, 0x81,
+  0xBA, 0x34, 0x1B, 0x3C, 0xE4, 0x20, 0x41, 0xAA, 0x80, 0x80, 0x80, 0x9E, 0x92, 0x89, 0x60, 0xD9,
+  0x8C, 0x33, 0x90, 0x31, 0xBD, 0x40, 0x03, 0x80, 0x80, 0x80, 0x26, 0x88, 0x48, 0x03, 0x8D, 0xA4,
+  0x0B, 0x50, 0x80, 0xBA, 0x22, 0x8C, 0x60, 0xF0, 0x28, 0x98, 0x29, 0xB1, 0x9C, 0x03, 0xB8, 0x5B,
+  0x82, 0xD8, 0x42, 0x8A, 0x41, 0xC0, 0x88, 0x32, 0xC0, 0x4A, 0xC1, 0x09, 0x23, 0xCC, 0x28, 0x91,
+  0x1D, 0x93, 0x9C, 0x42, 0xBA, 0x00, 0xE9, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // step10
+  0xAA, 0xFF, 0x00, 0x00, 0xF0, 0xD7, 0x8C, 0x28, 0x4D, 0xF2, 0x20, 0x98, 0x04, 0xBA, 0x21, 0x2D,
+  0xB1, 0x21, 0x0E, 0x82, 0xA3, 0xC1, 0x84, 0xCB, 0x03, 0x79, 0xCB, 0x04, 0x2C, 0xD3, 0x40, 0x9A,
+  0xA4, 0x28, 0x8A, 0x13, 0x0A, 0x0C, 0x94, 0x9C, 0x94, 0x1B, 0x03, 0x01, 0x18, 0x20, 0xF1, 0x3B,
+  0xD8, 0x51, 0x1C, 0x98, 0xB3, 0x49, 0xC0, 0x05, 0x9A, 0x84, 0x3B, 0x89, 0x83, 0x11, 0xBC, 0xA5,
+  0x12, 0xC8, 0x22, 0x09, 0xB0, 0x7B, 0x89, 0x82, 0x28, 0xE0, 0x03, 0x1C, 0x61, 0x0C, 0xF3, 0x83,
+  0xC8, 0x71, 0x1E, 0xB3, 0x10, 0xD0, 0x85, 0x1B, 0x80, 0xD0, 0x38, 0x20, 0x99, 0x12, 0x5F, 0xF1,
+  0x82, 0x1A, 0x80, 0x19, 0x93, 0x8B, 0x14, 0x10, 0x9D, 0x88, 0xB0, 0x31, 0xF3, 0x18, 0x00, 0x83,
+  0x1C, 0xA0, 0x91, 0x80, 0x92, 0x1C, 0x81, 0x86, 0x8D, 0x03, 0x0F, 0x93, 0x2A, 0x92, 0x08, 0x98,
+  0x43, 0xAA, 0xC4, 0xA9, 0x77, 0xFA, 0x30, 0x00, 0x95, 0x2C, 0x10, 0x08, 0x96, 0x3B, 0xA8, 0x29,
+  0xA9, 0xA5, 0x7A, 0x99, 0x93, 0xA3, 0x48, 0x3E, 0xB8, 0x02, 0x88, 0x20, 0x2D, 0x39, 0xA9, 0xC6,
+  0x48, 0x0B, 0x84, 0x2C, 0xA2, 0xA8, 0x94, 0x49, 0x9A, 0x11, 0xAA, 0x97, 0x18, 0x98, 0x03, 0xC9,
+  0x43, 0xAC, 0x03, 0x2B, 0xD2, 0xA4, 0x18, 0x4D, 0xA8, 0x92, 0x11, 0x99, 0x78, 0x8D, 0xA4, 0x88,
+  0xA5, 0x6C, 0x99, 0x02, 0x89, 0x80, 0x18, 0x19, 0x08, 0xD5, 0x39, 0xD0, 0x30, 0x99, 0x11, 0x0B,
+  0x10, 0xA1, 0x7A, 0xCA, 0x05, 0x1A, 0x88, 0x08, 0x09, 0x11, 0x3A, 0xD9, 0xA3, 0x0A, 0x15, 0x8C,
+  0x83, 0x1D, 0xA8, 0x16, 0x2B, 0x9A, 0xA2, 0x97, 0x3C, 0xA2, 0x3B, 0xB2, 0x49, 0xE3, 0x39, 0xCA,
+  0x85, 0x81, 0x2A, 0xAA, 0x41, 0x8B, 0x97, 0x4C, 0x09, 0xB0, 0x04, 0x2A, 0xA8, 0x58, 0xC0, 0x02,
+  0x89, 0x98, 0x01, 0x97, 0x3A, 0xBB, 0x13, 0x4A, 0xF0, 0x01, 0x37, 0x00, 0xE7, 0x49, 0x88, 0x18,
+  0x98, 0xC2, 0x58, 0xA0, 0x11, 0x8D, 0xA3, 0x20, 0x18, 0x8C, 0x00, 0x91, 0x82, 0x9A, 0x82, 0x21,
+  0x39, 0xF9, 0x79, 0x8C, 0x86, 0x1B, 0x88, 0x81, 0x94, 0x1E, 0xA2, 0x49, 0xA0, 0x82, 0x0E, 0x93,
+  0x00, 0x4A, 0xC9, 0x93, 0x38, 0x3B, 0xC8, 0xD2, 0x31, 0x1B, 0x81, 0xC0, 0x95, 0x3B, 0xE1, 0x48,
+  0x08, 0x80, 0xAB, 0x23, 0x98, 0x41, 0x8F, 0x95, 0x19, 0x99, 0x33, 0x8A, 0xF2, 0x20, 0x2E, 0x91,
+  0xA0, 0x88, 0x29, 0x10, 0xBA, 0xB5, 0x78, 0x09, 0xA4, 0x01, 0x49, 0x88, 0x29, 0xF3, 0x10, 0x1F,
+  0xA2, 0x1B, 0xC2, 0x00, 0x18, 0x19, 0x81, 0x04, 0x48, 0x91, 0x92, 0x00, 0x3B, 0xF4, 0x0B, 0x90,
+  0xAA, 0x1A, 0xF3, 0x4C, 0x90, 0x13, 0x30, 0x23, 0x0E, 0xA3, 0x13, 0x2E, 0xC0, 0x08, 0xBC, 0x93,
+  0x2C, 0xB9, 0x21, 0xA2, 0x36, 0x38, 0xA3, 0x18, 0x01, 0x22, 0xBB, 0xCC, 0xF2, 0x0A, 0x39, 0x00,
+  0xAE, 0xA1, 0x8E, 0x1A, 0xF2, 0x22, 0x28, 0x38, 0x33, 0xF2, 0x18, 0x38, 0xA1, 0x29, 0xFE, 0x10,
+  0x9A, 0x91, 0x89, 0x10, 0x14, 0x19, 0x15, 0x11, 0xA9, 0x20, 0x19, 0xA7, 0x1C, 0xEB, 0x00, 0x9A,
+  0x81, 0x4A, 0x85, 0x29, 0x21, 0x93, 0x8A, 0x40, 0x29, 0xD5, 0xA8, 0x9C, 0x19, 0x9A, 0xA2, 0x6C,
+  0x83, 0x10, 0x31, 0xB3, 0x5B, 0xA1, 0x31, 0xAB, 0xF8, 0x9C, 0x99, 0x88, 0xA2, 0x7A, 0x94, 0x01,
+  0x62, 0xB0, 0x39, 0x89, 0x84, 0x09, 0xCC, 0x8B, 0x90, 0x00, 0xAA, 0x57, 0x09, 0x12, 0x11, 0xBB,
+  0x24, 0x19, 0xC2, 0xAA, 0xCD, 0x29, 0xB9, 0x82, 0x7A, 0x82, 0x22, 0x20, 0xC2, 0x29, 0x03, 0x00,
+  0x8D, 0xFA, 0x1D, 0x99, 0x10, 0x1B, 0x87, 0x28, 0x02, 0x01, 0x1D, 0x01, 0x83, 0xB8, 0xAD, 0xBB,
+  0x01, 0x9B, 0xD2, 0x78, 0x82, 0x23, 0x80, 0xB1, 0x69, 0x11, 0x98, 0xD9, 0x9D, 0x09, 0xA8, 0x01,
+  0xEC, 0xDC, 0x40, 0x00, 0x3D, 0x05, 0x20, 0x11, 0xA2, 0x1C, 0x23, 0x00, 0xC9, 0xBF, 0x8A, 0x80,
+  0x4A, 0x8D, 0x87, 0x10, 0x01, 0x10, 0x9B, 0x04, 0x21, 0xB9, 0xBB, 0xBF, 0x83, 0x2C, 0xE0, 0x42,
+  0x08, 0x11, 0x10, 0xB8, 0x40, 0x81, 0xA2, 0xCA, 0xBD, 0x19, 0xA9, 0xC3, 0x7A, 0x82, 0x31, 0x11,
+  0xC0, 0x29, 0x04, 0x30, 0xCC, 0xBB, 0x8C, 0xB2, 0x30, 0x0F, 0x85, 0x20, 0x82, 0x02, 0x8D, 0x13,
+  0x38, 0xC8, 0xCB, 0xAC, 0x81, 0x19, 0xC8, 0x25, 0x18, 0x14, 0x20, 0xBA, 0x42, 0x10, 0xB3, 0xBD,
+  0xBE, 0x19, 0xA9, 0xA4, 0x7A, 0x00, 0x31, 0x10, 0xB1, 0x29, 0x13, 0x22, 0xBC, 0xDF, 0x8A, 0x90,
+  0x28, 0x0B, 0x07, 0x38, 0x83, 0x11, 0x0C, 0x12, 0x12, 0xD0, 0xEA, 0xAB, 0x98, 0x18, 0xB0, 0x34,
+  0x30, 0x26, 0x20, 0xB8, 0x51, 0x00, 0xA4, 0x9B, 0xCF, 0x98, 0x09, 0x01, 0x2A, 0x13, 0x73, 0x82,
+  0x81, 0x1A, 0x14, 0x39, 0x79, 0x2B, 0x3E, 0x00, 0xE8, 0xAB, 0xCD, 0x00, 0x19, 0xA0, 0x52, 0x10,
+  0x15, 0x10, 0xA8, 0x21, 0x20, 0xA0, 0xFB, 0xAD, 0x8A, 0x09, 0x91, 0x48, 0x12, 0x73, 0x02, 0xA1,
+  0x19, 0x22, 0x10, 0xBA, 0xFF, 0x99, 0x19, 0x09, 0x88, 0x32, 0x41, 0x25, 0x18, 0x98, 0x20, 0x01,
+  0x91, 0xED, 0x9C, 0x9A, 0x88, 0x08, 0x29, 0x25, 0x52, 0x03, 0x01, 0x09, 0x20, 0x81, 0xC9, 0xEE,
+  0x99, 0x9A, 0x90, 0x88, 0x51, 0x21, 0x53, 0x12, 0x80, 0x01, 0x38, 0xA9, 0xDA, 0xCD, 0xA9, 0x8A,
+  0xA9, 0x18, 0x48, 0x33, 0x34, 0x35, 0x11, 0x23, 0x11, 0x80, 0xCA, 0xCD, 0xCB, 0xAC, 0xCA, 0x89,
+  0x89, 0x41, 0x31, 0x45, 0x33, 0x42, 0x13, 0x20, 0xB0, 0xBC, 0xCD, 0xBB, 0xBC, 0xBB, 0xA9, 0x10,
+  0x33, 0x57, 0x33, 0x43, 0x23, 0x12, 0x90, 0xBC, 0xBD, 0xBC, 0xCB, 0xAB, 0xA9, 0x19, 0x33, 0x65,
+  0x33, 0x43, 0x23, 0x21, 0x90, 0xCB, 0xBC, 0xBD, 0xF2, 0xFE, 0x40, 0x00, 0xBB, 0xBC, 0x9A, 0x09,
+  0x23, 0x73, 0x25, 0x32, 0x33, 0x12, 0x81, 0xBB, 0xDC, 0xBC, 0xCA, 0xBB, 0xAA, 0x99, 0x32, 0x53,
+  0x45, 0x33, 0x43, 0x21, 0x01, 0xB9, 0xCB, 0xDC, 0xAA, 0xAC, 0x9B, 0x99, 0x20, 0x32, 0x46, 0x43,
+  0x32, 0x22, 0x11, 0x90, 0xBC, 0xCC, 0xCB, 0xCA, 0xAB, 0x99, 0x09, 0x33, 0x54, 0x34, 0x33, 0x24,
+  0x12, 0x00, 0xCA, 0xBB, 0xCD, 0xAB, 0xDB, 0x9A, 0x98, 0x21, 0x32, 0x46, 0x24, 0x31, 0x13, 0x10,
+  0xA0, 0xBC, 0xDB, 0xBC, 0xBA, 0xBC, 0x98, 0x09, 0x43, 0x42, 0x36, 0x32, 0x33, 0x02, 0x01, 0xE9,
+  0xAA, 0xCC, 0xAB, 0xCB, 0x9A, 0x99, 0x38, 0x33, 0x65, 0x33, 0x33, 0x33, 0x10, 0xA2, 0xBD, 0xCB,
+  0xBE, 0xB9, 0xCB, 0x99, 0x98, 0x41, 0x22, 0x55, 0x32, 0x32, 0x12, 0x10, 0xB0, 0xBD, 0xEA, 0xBB,
+  0xBA, 0xBC, 0x89, 0x89, 0x43, 0x52, 0x44, 0x23, 0x23, 0x12, 0x01, 0xC8, 0xED, 0x28, 0x3A, 0x00,
+  0xBC, 0xDB, 0xAC, 0xBA, 0xAC, 0x89, 0x08, 0x43, 0x43, 0x35, 0x33, 0x43, 0x02, 0x00, 0xC9, 0xAC,
+  0xDB, 0xBB, 0xCA, 0x9C, 0x88, 0x18, 0x33, 0x63, 0x44, 0x12, 0x23, 0x11, 0x18, 0xDA, 0xAB, 0xEB,
+  0xAB, 0xCA, 0xAA, 0x90, 0x28, 0x24, 0x44, 0x34, 0x23, 0x24, 0x01, 0x80, 0xCA, 0xCB, 0xDB, 0xBB,
+  0xBA, 0x9C, 0x98, 0x10, 0x25, 0x53, 0x34, 0x32, 0x33, 0x11, 0x08, 0xEA, 0xBB, 0xCC, 0xBB, 0xCB,
+  0x9B, 0x89, 0x28, 0x34, 0x44, 0x25, 0x33, 0x23, 0x12, 0x00, 0xBA, 0xBE, 0xCC, 0xBB, 0xBB, 0xAC,
+  0x8A, 0x18, 0x52, 0x33, 0x45, 0x33, 0x24, 0x12, 0x01, 0xA8, 0xBC, 0xBD, 0xBC, 0xCB, 0xBA, 0x9A,
+  0x88, 0x21, 0x44, 0x44, 0x33, 0x34, 0x32, 0x02, 0x18, 0xCA, 0xDB, 0xCB, 0xAD, 0xBB, 0x9B, 0xB0,
+  0x3A, 0x24, 0x44, 0x34, 0x25, 0x12, 0x11, 0x01, 0x08, 0xFB, 0xAB, 0xAC, 0xBB, 0xAA, 0x8B, 0x81,
+  0x49, 0xD9, 0x35, 0x00, 0x41, 0x44, 0x34, 0x33, 0x34, 0x12, 0x01, 0x98, 0xC9, 0xBC, 0xBD, 0xCB,
+  0xAA, 0x9C, 0x98, 0x80, 0x33, 0x62, 0x43, 0x42, 0x25, 0x10, 0x00, 0x09, 0xA0, 0xAC, 0xBC, 0xAE,
+  0xA0, 0x8C, 0xB0, 0x19, 0x13, 0x52, 0x33, 0x31, 0x37, 0x00, 0x03, 0xAA, 0x30, 0xBF, 0x88, 0xFC,
+  0x00, 0x8B, 0x08, 0x9A, 0x22, 0x01, 0x44, 0x11, 0x62, 0x10, 0xA3, 0x80, 0x00, 0x9A, 0xBC, 0x9F,
+  0xD0, 0x0A, 0xD0, 0x39, 0x98, 0x21, 0x10, 0x04, 0x14, 0x24, 0x38, 0xB0, 0x68, 0xD8, 0x81, 0x9A,
+  0xAC, 0x08, 0xD9, 0x99, 0x32, 0x0C, 0x31, 0x08, 0x17, 0x21, 0x10, 0x40, 0xA1, 0xA1, 0x08, 0x8F,
+  0x91, 0xAF, 0x94, 0xAB, 0x14, 0x8D, 0x12, 0x89, 0x12, 0x4A, 0xB6, 0x48, 0x92, 0x1A, 0x02, 0xB9,
+  0x18, 0x2A, 0xF9, 0x1A, 0xF1, 0x2A, 0xA3, 0x2B, 0xB4, 0x28, 0x01, 0x78, 0xA1, 0x42, 0xB8, 0x3A,
+  0x93, 0x8C, 0x05, 0xAD, 0x66, 0xFC, 0x41, 0x00, 0x00, 0x0A, 0xA1, 0x8B, 0x12, 0x0B, 0x87, 0x29,
+  0x2A, 0x33, 0xA5, 0x5A, 0x91, 0x01, 0x8E, 0x86, 0x0C, 0x80, 0x88, 0x9B, 0x04, 0xAB, 0x22, 0x0B,
+  0x21, 0x03, 0xB9, 0x65, 0xA1, 0x5B, 0xA3, 0x09, 0x88, 0x08, 0xCA, 0x79, 0xC0, 0x8A, 0x92, 0x0B,
+  0x53, 0xAC, 0x21, 0xB4, 0x28, 0x30, 0x88, 0x51, 0xC3, 0x1B, 0x40, 0xE8, 0x28, 0xE8, 0x20, 0x89,
+  0xC2, 0x1D, 0x94, 0x88, 0x21, 0x99, 0x2A, 0x53, 0xC0, 0x10, 0x7A, 0xA0, 0x88, 0x81, 0x19, 0x81,
+  0xBC, 0x30, 0x1C, 0x92, 0xA8, 0x6A, 0x8A, 0x05, 0x0B, 0x85, 0x08, 0x3B, 0x13, 0xA0, 0xB1, 0x5C,
+  0xD3, 0x18, 0x1A, 0xEA, 0x12, 0x00, 0xBC, 0x04, 0x1D, 0x12, 0xD8, 0x40, 0x90, 0x09, 0x32, 0xB9,
+  0x81, 0x04, 0xAD, 0x72, 0xB9, 0x01, 0x19, 0xE8, 0x21, 0x0B, 0xD3, 0x18, 0xB3, 0x5B, 0x91, 0x20,
+  0xB8, 0x93, 0x58, 0x89, 0xB3, 0x3C, 0xBA, 0x34, 0x01, 0x04, 0x33, 0x00, 0xF9, 0x49, 0xC9, 0x11,
+  0xB1, 0x49, 0x8A, 0x91, 0x95, 0x1A, 0x43, 0xB9, 0x61, 0xA0, 0x1D, 0x12, 0x0C, 0x11, 0xF9, 0x30,
+  0xD8, 0x28, 0xA1, 0x18, 0xB0, 0x71, 0xA0, 0x1E, 0x85, 0x0B, 0x13, 0x9A, 0x82, 0x88, 0x92, 0x1D,
+  0x23, 0x9E, 0x81, 0x91, 0x1B, 0x11, 0x0B, 0x49, 0xC4, 0x19, 0x02, 0x5B, 0x03, 0xB9, 0x15, 0x8D,
+  0x11, 0x08, 0x99, 0xC4, 0x2D, 0xA1, 0x1A, 0x83, 0xCB, 0x61, 0xB0, 0x3A, 0x33, 0xE1, 0x81, 0x48,
+  0x39, 0xD2, 0x08, 0x0B, 0x01, 0x0C, 0xE3, 0x80, 0xA8, 0x19, 0x30, 0xB6, 0x3B, 0xF0, 0x14, 0x3B,
+  0x80, 0x88, 0x33, 0xBC, 0x42, 0xCA, 0x84, 0xB9, 0x2B, 0x50, 0x9E, 0x92, 0xB2, 0x0A, 0x17, 0xCA,
+  0x31, 0x91, 0x30, 0x9A, 0x02, 0xC8, 0x46, 0xBA, 0x5A, 0xC2, 0x3C, 0x92, 0x9C, 0x02, 0xB8, 0x11,
+  0x1B, 0x90, 0x93, 0x42, 0x09, 0x52, 0xA8, 0x07, 0x1A, 0x93, 0x08, 0x88, 0xA9, 0x08, 0x34, 0x00,
+  0x8F, 0x40, 0xF0, 0x19, 0x90, 0x99, 0x00, 0x08, 0x03, 0x0F, 0x14, 0xB8, 0x34, 0xB8, 0x70, 0x92,
+  0x88, 0x09, 0x1B, 0xA0, 0xC8, 0x94, 0x9F, 0x11, 0xAA, 0x82, 0x1A, 0x22, 0x52, 0xAA, 0x16, 0x48,
+  0x08, 0x02, 0xA2, 0x30, 0xBF, 0x0A, 0x86, 0x9C, 0x19, 0xBB, 0x11, 0xA2, 0x38, 0x3D, 0x22, 0xA1,
+  0x47, 0x90, 0x39, 0x85, 0x09, 0xA0, 0x0F, 0x93, 0xCA, 0x10, 0xAC, 0x81, 0x99, 0x20, 0x98, 0x14,
+  0x91, 0x52, 0x32, 0x38, 0x15, 0x15, 0x9A, 0x0B, 0xD8, 0x09, 0xB1, 0xDF, 0x00, 0xA9, 0x08, 0x82,
+  0x19, 0x41, 0x82, 0x82, 0x54, 0x21, 0x73, 0x81, 0xAA, 0x88, 0x9C, 0x03, 0xDB, 0xAB, 0xCA, 0x5B,
+  0xA2, 0x9A, 0x42, 0x80, 0x38, 0x16, 0x01, 0x70, 0x04, 0x90, 0x89, 0xAB, 0x80, 0x82, 0xF9, 0xAC,
+  0x39, 0xD8, 0x20, 0xA1, 0x5A, 0x90, 0x10, 0x23, 0x30, 0x37, 0x08, 0x43, 0xFA, 0x89, 0x10, 0x18,
+  0xA0, 0x1A, 0x41, 0x00, 0xBC, 0xA9, 0xA8, 0x49, 0x91, 0x9C, 0x24, 0xA0, 0x40, 0x80, 0x60, 0x15,
+  0x11, 0x90, 0xAC, 0x00, 0x80, 0xA9, 0xAA, 0xED, 0x19, 0x91, 0x09, 0x93, 0x0C, 0x43, 0x90, 0x89,
+  0x25, 0x72, 0x33, 0xC0, 0x8B, 0x01, 0xAA, 0x51, 0xE8, 0x9C, 0x08, 0x1A, 0x12, 0xBB, 0x20, 0x83,
+  0x4A, 0x14, 0xAE, 0x44, 0x04, 0x20, 0xA1, 0xAD, 0x11, 0xA1, 0x28, 0xFA, 0xAB, 0x10, 0x90, 0x38,
+  0xC8, 0x1B, 0x27, 0x99, 0x28, 0x08, 0x55, 0x02, 0x18, 0xA0, 0x8D, 0x02, 0x99, 0x00, 0xBD, 0xAD,
+  0x10, 0x11, 0x9A, 0x09, 0x13, 0x39, 0x87, 0xA9, 0x7B, 0x26, 0x90, 0x30, 0xB0, 0x9E, 0x13, 0xB0,
+  0x19, 0xD9, 0xBB, 0x22, 0x02, 0xDB, 0x29, 0x04, 0x80, 0x01, 0x99, 0x4B, 0x77, 0x80, 0x18, 0xA0,
+  0x9A, 0x32, 0xA8, 0x99, 0xEC, 0x89, 0x01, 0x88, 0xA1, 0xAC, 0x36, 0x90, 0x08, 0xB8, 0x20, 0x74,
+  0x02, 0x00, 0x01, 0xBC, 0x38, 0x0C, 0x3F, 0x00, 0x2A, 0x84, 0x80, 0xCB, 0xAF, 0x10, 0x92, 0x89,
+  0x89, 0x19, 0x25, 0xA1, 0x2A, 0xBB, 0x64, 0x10, 0x25, 0x90, 0x49, 0xA4, 0x9F, 0x12, 0x90, 0x98,
+  0xCA, 0x9A, 0x12, 0x11, 0x9C, 0x89, 0x84, 0x31, 0x51, 0xBC, 0x00, 0x84, 0x70, 0x84, 0xA9, 0x32,
+  0x98, 0x1B, 0xB0, 0x98, 0x99, 0x9F, 0x9B, 0x11, 0xA8, 0x30, 0xA8, 0x1A, 0x77, 0x89, 0x88, 0xA0,
+  0x35, 0x28, 0x23, 0xC0, 0x61, 0x90, 0xBB, 0x88, 0x08, 0xA0, 0xBD, 0x9E, 0x18, 0x04, 0x8A, 0x80,
+  0x11, 0x11, 0x24, 0xBC, 0x10, 0x43, 0x81, 0x56, 0x81, 0x08, 0x03, 0xCD, 0x09, 0x80, 0x88, 0xEB,
+  0xAB, 0x88, 0x52, 0xB1, 0x99, 0x32, 0x80, 0x35, 0x9A, 0xA0, 0x38, 0x53, 0xA0, 0x75, 0x83, 0x89,
+  0x23, 0xEC, 0x89, 0x80, 0x81, 0xCB, 0x9D, 0x89, 0x53, 0xA0, 0x0A, 0x82, 0x31, 0x31, 0xBC, 0x04,
+  0x09, 0x22, 0x10, 0x7B, 0x37, 0xA0, 0x38, 0xD0, 0xBF, 0x13, 0x3F, 0x00, 0x9D, 0x02, 0x98, 0x98,
+  0xDC, 0x09, 0x22, 0x92, 0x0B, 0x29, 0x85, 0x30, 0xD2, 0x1A, 0x02, 0x01, 0x03, 0x11, 0x78, 0x17,
+  0x80, 0x00, 0xCB, 0x9B, 0x90, 0x10, 0xEA, 0xAD, 0x08, 0x22, 0x03, 0x9B, 0x08, 0x73, 0xA3, 0x0B,
+  0x21, 0x8B, 0x27, 0x98, 0x32, 0x51, 0x22, 0x82, 0xC8, 0xBF, 0x09, 0x00, 0xA9, 0xE9, 0x9D, 0x20,
+  0x21, 0x82, 0xCB, 0x41, 0x01, 0x11, 0xBA, 0x5A, 0x13, 0x8A, 0x23, 0x13, 0x78, 0x17, 0x88, 0x90,
+  0xBD, 0x1A, 0x91, 0x9A, 0xC1, 0xBF, 0x20, 0x12, 0x18, 0xA1, 0x89, 0x71, 0x91, 0x80, 0x18, 0x80,
+  0x22, 0x00, 0x43, 0x92, 0x77, 0x81, 0x99, 0xA8, 0xCC, 0x28, 0x98, 0x89, 0xFA, 0x0C, 0x22, 0x80,
+  0x82, 0x0A, 0x28, 0x41, 0xB3, 0xA2, 0x4C, 0x20, 0x85, 0x0A, 0x73, 0x19, 0x16, 0xA8, 0x29, 0xEA,
+  0x8A, 0x82, 0x8A, 0xA1, 0xBF, 0x11, 0x01, 0x30, 0xB0, 0x2C, 0x05, 0x01, 0x21, 0xFF, 0x3A, 0x00,
+  0x01, 0x8E, 0x22, 0x80, 0x30, 0xA0, 0x5A, 0x24, 0x82, 0x10, 0xBA, 0xAF, 0xA9, 0x90, 0x19, 0xFA,
+  0x9C, 0x10, 0x20, 0x01, 0xA1, 0x99, 0x71, 0x05, 0x8B, 0x92, 0x1A, 0x27, 0xA9, 0x18, 0x11, 0x20,
+  0x16, 0x91, 0x0A, 0xEA, 0xAB, 0x01, 0x8A, 0x89, 0xEE, 0x88, 0x12, 0x00, 0x19, 0xA2, 0x50, 0x11,
+  0x9B, 0x33, 0xEA, 0x72, 0xA1, 0x09, 0x01, 0x20, 0x62, 0x91, 0x90, 0xA1, 0xBD, 0x8B, 0xA0, 0x80,
+  0xBA, 0xCF, 0x88, 0x03, 0x41, 0x80, 0xBA, 0x27, 0x80, 0x38, 0xD8, 0x12, 0x10, 0x12, 0xBB, 0x62,
+  0x92, 0x73, 0xA4, 0x0C, 0x03, 0xBD, 0x18, 0xC9, 0x11, 0xB8, 0x9C, 0x80, 0x31, 0x23, 0x2C, 0xC2,
+  0x00, 0x17, 0x1A, 0xA2, 0xB8, 0x34, 0x28, 0x99, 0xA9, 0x17, 0x73, 0x91, 0x9C, 0x13, 0xDB, 0x19,
+  0xA9, 0x08, 0xD1, 0x8C, 0x00, 0x01, 0x13, 0x89, 0x01, 0x82, 0x55, 0xB0, 0x1B, 0x05, 0x2A, 0x92,
+  0xD3, 0x04, 0x33, 0x00, 0x8D, 0x01, 0x04, 0x72, 0x00, 0x99, 0x91, 0xCB, 0x1A, 0x9B, 0xA0, 0xF8,
+  0x9C, 0x09, 0x30, 0x93, 0x13, 0x1C, 0x5A, 0x86, 0x80, 0x08, 0x00, 0x18, 0xA3, 0x0A, 0x8B, 0x72,
+  0x53, 0x02, 0x80, 0x21, 0xCC, 0xAD, 0xA8, 0x28, 0xA8, 0xBF, 0xA9, 0x28, 0x53, 0x92, 0x8A, 0x21,
+  0x15, 0x03, 0x8A, 0x18, 0x5C, 0xB6, 0x39, 0xA9, 0x2A, 0x17, 0x20, 0x20, 0x98, 0xA1, 0xBD, 0x89,
+  0x8C, 0x91, 0xF8, 0x9B, 0x88, 0x31, 0x13, 0x10, 0x3B, 0x26, 0x01, 0x02, 0x9A, 0x31, 0x5B, 0x97,
+  0xBA, 0x18, 0x28, 0x78, 0x05, 0x88, 0x22, 0xCB, 0x9B, 0xA8, 0x82, 0x9A, 0xCF, 0x8B, 0x81, 0x12,
+  0x30, 0xB9, 0x53, 0x81, 0x71, 0xA1, 0x39, 0x92, 0x20, 0x90, 0xDB, 0x30, 0xA1, 0x3B, 0x87, 0x29,
+  0x93, 0x48, 0xB9, 0xED, 0x88, 0x0D, 0x82, 0xC9, 0x89, 0x0A, 0x41, 0x84, 0x88, 0x21, 0x9A, 0x63,
+  0xA8, 0x11, 0x81, 0x4B, 0xBC, 0xFE, 0x2C, 0x00, 0xB3, 0x4B, 0x97, 0x4C, 0x12, 0x0A, 0x17, 0xCB,
+  0x0A, 0xBA, 0x43, 0xA0, 0x8A, 0xA8, 0x28, 0x03, 0x5B, 0x03, 0x28, 0x06, 0x0B, 0x81, 0x80, 0x37,
+  0x1A, 0xA2, 0xC9, 0x00, 0xA9, 0x2B, 0xF8, 0x09, 0xA1, 0x2E, 0xD2, 0x20, 0x12, 0x29, 0x01, 0xCB,
+  0x14, 0x1C, 0x02, 0xA9, 0x83, 0x08, 0x2C, 0xB0, 0x14, 0x03, 0x50, 0x01, 0xAA, 0xC2, 0x08, 0x08,
+  0x38, 0xB8, 0xFA, 0xFF, 0x10, 0x1E, 0x04, 0x88, 0x24, 0xBB, 0x9A, 0xA8, 0x43, 0x80, 0x8A, 0xC0,
+  0x28, 0x8A, 0x28, 0x05, 0x08, 0x93, 0x8E, 0xB8, 0x0A, 0x30, 0x30, 0x36, 0x11, 0x82, 0x14, 0x48,
+  0x81, 0x90, 0x9C, 0xCD, 0xAA, 0xBC, 0x1A, 0xBA, 0x80, 0x80, 0x58, 0x93, 0x34, 0x33, 0x68, 0x15,
+  0xA8, 0x23, 0x8B, 0x1A, 0xF0, 0x08, 0x08, 0x9C, 0x80, 0x08, 0x08, 0x08, 0x69, 0x92, 0x84, 0x58,
+  0x83, 0x38, 0xE1, 0x42, 0xA0, 0x3C, 0xC8, 0x00, 0x0A, 0x00, 0x25, 0x00, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7D, 0xFF,
+  0x9F, 0x80, 0x80, 0x80, 0x80, 0x00, 0x19, 0xB3, 0x77, 0x00, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7D, 0xFF, 0x9F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x88, 0x80, 0x30, 0xFF, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x19, 0xF1, 0x77, 0x48, 0xFD, 0x18, 0x00,
+  0x47, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x00, 0x7E, 0x57, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xF7, 0xFF, 0x8A, 0x0A, 0x93, 0x0A,
+  0x71, 0xA7, 0x20, 0x88, 0x80, 0x09, 0x10, 0x80, 0xB1, 0x4D, 0x81, 0x08, 0x18, 0xBE, 0x95, 0x1A,
+  0x4B, 0xF3, 0x29, 0x9A, 0x00, 0x08, 0x08, 0x08, 0x88, 0x23, 0x34, 0x87, 0x39, 0x80, 0x80, 0x80,
+  0x00, 0xF0, 0x19, 0xBF, 0x97, 0x4A, 0xA0, 0xB2, 0x50, 0x98, 0x99, 0x89, 0x08, 0x08, 0x08, 0x80,
+  0x78, 0xB2, 0x99, 0x52, 0x04, 0x08, 0x80, 0x08, 0x80, 0x80, 0xD0, 0xCF, 0x80, 0x80, 0x80, 0x80,
+  0x6E, 0xFE, 0x1B, 0x00, 0x00, 0x88, 0x87, 0x34, 0x29, 0x88, 0x80, 0x80, 0x80, 0x80, 0xFB, 0xAF,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x7A, 0x97, 0x31, 0xA8, 0x11, 0x88, 0x80, 0x80, 0x10, 0xCD,
+  0x05, 0xA8, 0xF2, 0x4B, 0x82, 0x2C, 0x81, 0x28, 0xC0, 0x49, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0xD1, 0x37, 0xAF, 0x94, 0x80, 0x93, 0x76, 0x1F, 0xD4, 0x38,
+  0xB8, 0x33, 0x8D, 0x20, 0xE9, 0x39, 0x01, 0x1A, 0xE4, 0x79, 0xB0, 0x01, 0x90, 0x09, 0x80, 0x19,
+  0xB8, 0x50, 0x05, 0xAC, 0x11, 0x89, 0x80, 0x98, 0x08, 0x19, 0x05, 0xA8, 0x00, 0x0A, 0x12, 0x1A,
+  0xD9, 0x18, 0xA2, 0x0B, 0x59, 0xC0, 0x3A, 0x20, 0x99, 0xA9, 0x36, 0x1E, 0xA2, 0x39, 0x89, 0xC2,
+  0x81, 0x3A, 0xE1, 0x18, 0x53, 0xAA, 0x70, 0x99, 0x11, 0x9A, 0x14, 0x2A, 0x09, 0xC6, 0x39, 0xA0,
+  0x61, 0x0A, 0xA2, 0x38, 0x81, 0xFF, 0x20, 0x00, 0x09, 0x93, 0x7C, 0xA0, 0x02, 0x09, 0x29, 0x92,
+  0x5B, 0xC9, 0x86, 0x39, 0x9A, 0x51, 0xB8, 0x81, 0x18, 0x83, 0x19, 0xD5, 0x41, 0x9B, 0x01, 0xBA,
+  0x72, 0xA9, 0x02, 0x2A, 0xD1, 0x05, 0x1C, 0xD2, 0x49, 0xB0, 0x28, 0x1A, 0x90, 0x9A, 0xC3, 0x15,
+  0x8F, 0x83, 0x0A, 0x88, 0x98, 0x83, 0x2B, 0x18, 0xFB, 0x83, 0x80, 0x4D, 0xD8, 0x01, 0xC2, 0x19,
+  0xA1, 0x6B, 0xA8, 0x20, 0xA8, 0x49, 0xA0, 0x98, 0x19, 0xB3, 0xC3, 0x0B, 0xE2, 0x87, 0x88, 0x90,
+  0x99, 0xC3, 0x78, 0xB0, 0x48, 0x09, 0x09, 0x08, 0x7A, 0xA2, 0x4B, 0x8A, 0x84, 0x0C, 0x95, 0x88,
+  0x98, 0x53, 0x9A, 0x18, 0xA3, 0x00, 0x59, 0x0D, 0x03, 0x39, 0x8C, 0xA3, 0x93, 0x1A, 0x72, 0xF8,
+  0x12, 0x2A, 0xD8, 0x85, 0x89, 0xA2, 0x21, 0x89, 0x81, 0x2A, 0x5A, 0xB0, 0x20, 0xBA, 0x70, 0xD0,
+  0x11, 0xB0, 0x33, 0xAD, 0x33, 0x8D, 0x91, 0xB3, 0xC0, 0x00, 0x23, 0x00, 0x7B, 0xC1, 0x00, 0x19,
+  0xA0, 0x20, 0xF4, 0x10, 0x90, 0x00, 0x0C, 0x92, 0x80, 0x0C, 0x68, 0xBA, 0x73, 0xBB, 0x33, 0xAA,
+  0xC1, 0x18, 0x32, 0x9F, 0x95, 0x1A, 0x90, 0x81, 0x2A, 0xA8, 0x41, 0x8D, 0x93, 0x09, 0xA4, 0x3E,
+  0xB0, 0x03, 0x89, 0x08, 0xA1, 0xB4, 0x2F, 0xC4, 0x11, 0xB0, 0x7A, 0x89, 0x81, 0xA0, 0x11, 0x98,
+  0x21, 0xDB, 0x34, 0xBB, 0x43, 0xA8, 0x19, 0x01, 0x4E, 0xA0, 0x13, 0x1E, 0xD1, 0x42, 0xC9, 0x31,
+  0xB9, 0x03, 0x90, 0x48, 0xA8, 0x10, 0x18, 0x00, 0xAC, 0x34, 0x2C, 0xF3, 0x20, 0xC1, 0x58, 0x1B,
+  0x01, 0xE0, 0x32, 0x1F, 0xA2, 0x2A, 0x81, 0xA0, 0x49, 0x99, 0x02, 0x2B, 0x8C, 0x87, 0x8A, 0x12,
+  0x9A, 0x39, 0x89, 0x81, 0xE9, 0x44, 0x9C, 0x91, 0x10, 0x9C, 0x07, 0x9A, 0x93, 0x2B, 0x81, 0x09,
+  0x08, 0xD9, 0x04, 0x19, 0x9B, 0xF2, 0x22, 0x8B, 0x12, 0x0B, 0x8B, 0x00, 0x88, 0xFD, 0x1F, 0x00,
+  0x31, 0xE8, 0x40, 0xA8, 0x5E, 0xF1, 0x38, 0x98, 0x00, 0x90, 0x01, 0x19, 0xB8, 0x42, 0xBE, 0x16,
+  0x9A, 0x02, 0x88, 0xB0, 0x33, 0x0E, 0x92, 0x11, 0xE8, 0x12, 0x3A, 0xE0, 0x21, 0x8A, 0x03, 0x80,
+  0x3C, 0x88, 0x28, 0xC4, 0x28, 0xA1, 0x7F, 0xB0, 0x28, 0x81, 0x2A, 0xC3, 0x29, 0xA1, 0x30, 0x1D,
+  0xA5, 0x59, 0x8C, 0x13, 0x8C, 0x12, 0x8B, 0x02, 0x00, 0x3A, 0x9B, 0xC7, 0x21, 0xA9, 0x23, 0x0F,
+  0x82, 0x8B, 0x41, 0xE9, 0x41, 0x9B, 0x22, 0xBA, 0x12, 0x98, 0x49, 0xC9, 0x85, 0x1C, 0x92, 0x29,
+  0xF9, 0x31, 0x8A, 0x19, 0x21, 0x8F, 0xB3, 0x18, 0x92, 0x8C, 0x20, 0xC1, 0x20, 0x2B, 0xB0, 0x52,
+  0x9F, 0x14, 0x8D, 0xA3, 0x01, 0x2E, 0xE3, 0x10, 0x90, 0x88, 0x93, 0x1C, 0x22, 0x0D, 0x92, 0x3C,
+  0xC2, 0x00, 0x91, 0x18, 0x08, 0xC3, 0x6A, 0x89, 0x92, 0x4B, 0xB3, 0x2C, 0xB2, 0x31, 0xA8, 0x6A,
+  0xF0, 0xFE, 0x28, 0x00, 0x59, 0xCB, 0x87, 0x0A, 0x01, 0x08, 0x91, 0x1A, 0xA5, 0x19, 0x11, 0x9C,
+  0x15, 0x0C, 0x00, 0x01, 0x8B, 0x42, 0xC8, 0x48, 0xA0, 0x20, 0xF1, 0x49, 0x91, 0x2A, 0xC1, 0x20,
+  0x91, 0x0E, 0x12, 0xBA, 0x73, 0x9A, 0x31, 0xCB, 0x22, 0xE8, 0x22, 0x8A, 0x88, 0x80, 0x29, 0xC1,
+  0x21, 0x2D, 0xA2, 0x2F, 0x91, 0x09, 0xC5, 0x09, 0x11, 0x8C, 0x32, 0x9C, 0x03, 0x9C, 0x05, 0x8C,
+  0x20, 0xD9, 0x42, 0x9A, 0x00, 0x81, 0x3C, 0xC9, 0x31, 0xD0, 0x20, 0x40, 0x8F, 0x82, 0x09, 0x10,
+  0xB0, 0x3C, 0xA4, 0x4B, 0xB1, 0x19, 0x93, 0x2D, 0x92, 0xD0, 0x52, 0xBA, 0x24, 0xCB, 0x42, 0x99,
+  0x08, 0x01, 0x1A, 0x23, 0x0F, 0xA2, 0x80, 0x49, 0xC9, 0x32, 0xC1, 0x59, 0xB2, 0x99, 0x23, 0x8D,
+  0x06, 0xAA, 0x15, 0xBB, 0x52, 0x98, 0x2A, 0x82, 0x99, 0x82, 0x90, 0x70, 0xBA, 0x95, 0x01, 0x1B,
+  0xF3, 0x39, 0x93, 0x8B, 0x7B, 0x00, 0x29, 0x00, 0x03, 0xE8, 0x30, 0xC8, 0x21, 0x98, 0x51, 0xE1,
+  0x2A, 0xA0, 0x18, 0x83, 0x9B, 0x83, 0x2D, 0xB2, 0x1A, 0x80, 0xB0, 0x7C, 0xB3, 0x1D, 0x91, 0x80,
+  0x09, 0xA5, 0x3C, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // step100
+  0x8B, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x59, 0xE8, 0x00, 0x31, 0x9B, 0x4A, 0xB0, 0x37, 0xE8, 0x08,
+  0x89, 0x08, 0x00, 0x2B, 0x85, 0x59, 0x9B, 0x82, 0x5A, 0x85, 0x0C, 0xC2, 0x80, 0x02, 0x1E, 0x08,
+  0x90, 0x62, 0x9C, 0x03, 0xA8, 0xB0, 0x24, 0x1F, 0x80, 0x80, 0xA8, 0x2A, 0x03, 0xA4, 0x18, 0x69,
+  0x81, 0x80, 0xF0, 0x5A, 0xA0, 0x11, 0x80, 0x80, 0xF0, 0x0B, 0x08, 0x80, 0x08, 0x08, 0x69, 0x07,
+  0x88, 0x80, 0x00, 0x88, 0x00, 0x08, 0x88, 0xF1, 0x0F, 0x04, 0x08, 0x08, 0xDA, 0x80, 0x9C, 0xAB,
+  0x70, 0x27, 0x22, 0x01, 0x08, 0x9A, 0xAA, 0xDB, 0xCB, 0xAC, 0xA9, 0xA8, 0x89, 0x8C, 0x80, 0x28,
+  0x66, 0x46, 0x33, 0x24, 0x02, 0xA9, 0xBB, 0xBB, 0xEC, 0xAC, 0xBA, 0x99, 0x98, 0x11, 0x88, 0x80,
+  0x30, 0x46, 0x44, 0x43, 0x32, 0x23, 0x02, 0xAA, 0xAC, 0xDB, 0xBC, 0xBC, 0xAA, 0x9A, 0x89, 0x28,
+  0x00, 0x18, 0x34, 0x45, 0x5C, 0xF3, 0x34, 0x00, 0x43, 0x34, 0x43, 0x33, 0x22, 0xB0, 0xEB, 0xCB,
+  0xCB, 0xAC, 0x9B, 0x9A, 0x89, 0x18, 0x90, 0x33, 0x31, 0x57, 0x43, 0x32, 0x53, 0x23, 0x13, 0x90,
+  0xDB, 0xBD, 0xCA, 0xAA, 0xBB, 0xAA, 0x8A, 0x18, 0x11, 0x22, 0x36, 0x44, 0x63, 0x32, 0x33, 0x33,
+  0x03, 0xBA, 0xBD, 0xBD, 0xBC, 0xAB, 0xBB, 0xAA, 0x9A, 0x9A, 0x40, 0x32, 0x34, 0x35, 0x45, 0x33,
+  0x44, 0x33, 0x03, 0xAA, 0xCB, 0xCD, 0xCA, 0x9A, 0xA9, 0x9A, 0x8B, 0xA8, 0x08, 0x42, 0x34, 0x12,
+  0x45, 0x45, 0x23, 0x23, 0x91, 0xA9, 0xCB, 0xBC, 0xDC, 0x9A, 0xAA, 0x9A, 0x89, 0xA0, 0x28, 0x42,
+  0x82, 0x64, 0x34, 0x33, 0x44, 0x12, 0x80, 0xA8, 0xDB, 0xBC, 0xBB, 0xBA, 0xBC, 0x29, 0xE9, 0x18,
+  0x80, 0x11, 0x21, 0x45, 0x34, 0x45, 0x22, 0x01, 0x98, 0xBA, 0xCA, 0xDB, 0xBB, 0xAB, 0x19, 0xB8,
+  0x0C, 0x18, 0x92, 0x30, 0x66, 0x24, 0x42, 0x43, 0xF6, 0x13, 0x39, 0x00, 0x12, 0x98, 0x98, 0xBB,
+  0xDC, 0xBB, 0xAA, 0x9A, 0xA8, 0xA8, 0x99, 0x0B, 0x60, 0x53, 0x36, 0x34, 0x53, 0x12, 0xA0, 0xA9,
+  0xAA, 0xCA, 0xBD, 0xAB, 0xAA, 0x08, 0xC8, 0x9B, 0x80, 0x20, 0x73, 0x46, 0x42, 0x23, 0x03, 0xAA,
+  0xCA, 0x9A, 0xC0, 0xAC, 0xCB, 0x8A, 0x82, 0xAA, 0xEA, 0x09, 0x41, 0x53, 0x44, 0x22, 0x12, 0x80,
+  0xAA, 0xBC, 0x8B, 0xA9, 0xCC, 0xCB, 0x89, 0x08, 0xC9, 0xAD, 0x30, 0x47, 0x23, 0x23, 0x01, 0xA1,
+  0xCA, 0xBA, 0x8A, 0x98, 0xDD, 0xBA, 0x08, 0x81, 0xBA, 0xBE, 0x40, 0x57, 0x22, 0x00, 0x80, 0x98,
+  0xAA, 0x89, 0x98, 0x98, 0xDC, 0xAB, 0x08, 0x11, 0xE9, 0x9C, 0x61, 0x36, 0x13, 0x90, 0xA9, 0xA9,
+  0x89, 0x08, 0x88, 0xD9, 0xBC, 0x8A, 0x21, 0xA0, 0xBE, 0x4A, 0x67, 0x22, 0x90, 0x99, 0xAA, 0x88,
+  0x01, 0x01, 0xBA, 0xAE, 0x98, 0x20, 0xB0, 0xAD, 0x39, 0x77, 0x22, 0x80, 0x73, 0x26, 0x43, 0x00,
+  0xAA, 0xAA, 0x08, 0x20, 0x02, 0xC8, 0xCD, 0x8A, 0x21, 0x82, 0xAC, 0x4A, 0x47, 0x12, 0x98, 0xBA,
+  0x9B, 0x20, 0x25, 0x90, 0xCD, 0xAA, 0x20, 0x12, 0xBA, 0x9A, 0x66, 0x33, 0x80, 0xAA, 0xAC, 0x10,
+  0x33, 0x81, 0xCC, 0xAD, 0x8A, 0x22, 0x00, 0xAA, 0x68, 0x36, 0x02, 0xA8, 0xBA, 0x0A, 0x42, 0x23,
+  0xEA, 0xCC, 0x8A, 0x20, 0x03, 0xAA, 0x39, 0x67, 0x11, 0x99, 0x89, 0x99, 0x31, 0x33, 0xE8, 0xBD,
+  0x8B, 0x32, 0x01, 0xCB, 0x39, 0x47, 0x02, 0xA8, 0x99, 0x89, 0x52, 0x22, 0xEA, 0xAC, 0x09, 0x23,
+  0xA0, 0x9D, 0x48, 0x26, 0x90, 0x98, 0x08, 0x98, 0x31, 0x15, 0xEA, 0xBB, 0x29, 0x14, 0xB9, 0x9B,
+  0x73, 0x23, 0x99, 0x19, 0x91, 0x9B, 0x73, 0x03, 0xDC, 0xAB, 0x31, 0x82, 0xCB, 0x19, 0x36, 0x92,
+  0x8A, 0x22, 0xD9, 0x1A, 0x45, 0xB1, 0xAE, 0x1A, 0x22, 0xB0, 0x9B, 0x71, 0x13, 0xAA, 0x38, 0x83,
+  0x16, 0x15, 0x40, 0x00, 0xBD, 0x41, 0x14, 0xEB, 0x9A, 0x21, 0x90, 0x8A, 0x30, 0x16, 0xB0, 0x18,
+  0x24, 0xDB, 0x29, 0x35, 0xD9, 0xAA, 0x10, 0x90, 0x09, 0x01, 0x33, 0x93, 0x09, 0x45, 0xEA, 0x29,
+  0x35, 0xC9, 0x9C, 0x00, 0xA0, 0x08, 0x82, 0x41, 0x13, 0xAA, 0x62, 0xC1, 0x1B, 0x54, 0xB0, 0xAC,
+  0x19, 0x99, 0x18, 0xA3, 0x40, 0x26, 0xA9, 0x40, 0xB0, 0x1C, 0x26, 0xC0, 0xAA, 0x09, 0x89, 0x01,
+  0xC1, 0x58, 0x15, 0xA9, 0x30, 0xB0, 0x0C, 0x27, 0xB0, 0xAB, 0x89, 0x89, 0x21, 0xD1, 0x40, 0x14,
+  0xA9, 0x31, 0xE0, 0x2A, 0x26, 0xA9, 0xAB, 0xA9, 0x89, 0x53, 0xB9, 0x43, 0x83, 0x2B, 0x14, 0xFC,
+  0x40, 0x03, 0xBB, 0x9A, 0xC8, 0x18, 0x14, 0x0C, 0x42, 0xA0, 0x28, 0x93, 0x8E, 0x52, 0xA2, 0xAC,
+  0x80, 0x9C, 0x30, 0xC3, 0x38, 0x04, 0x8B, 0x53, 0xD8, 0x39, 0x14, 0xB9, 0x9B, 0xC0, 0x8C, 0x34,
+  0x0A, 0x21, 0x80, 0x30, 0x5F, 0x0B, 0x3D, 0x00, 0xB2, 0x1E, 0x34, 0x88, 0xDB, 0xAA, 0xAC, 0x70,
+  0x80, 0x01, 0x81, 0x28, 0x13, 0xAF, 0x43, 0x80, 0xA8, 0xAC, 0xBA, 0x78, 0x91, 0x10, 0x92, 0x29,
+  0x24, 0xAE, 0x41, 0x82, 0x99, 0xCA, 0xBA, 0x38, 0x96, 0x28, 0x00, 0x29, 0x15, 0xEB, 0x40, 0x81,
+  0x00, 0xDA, 0x9B, 0x18, 0x83, 0x41, 0x88, 0x2A, 0x25, 0xE9, 0x28, 0x03, 0x10, 0xCC, 0xCB, 0x19,
+  0x84, 0x48, 0x80, 0x1A, 0x43, 0xE8, 0x18, 0x83, 0x20, 0xD9, 0xDB, 0x09, 0x04, 0x49, 0x08, 0x0A,
+  0x14, 0xC8, 0x39, 0x82, 0x22, 0xCA, 0xCD, 0x89, 0x13, 0x38, 0x81, 0x8B, 0x27, 0xC2, 0x1B, 0x03,
+  0x20, 0x99, 0xED, 0x99, 0x11, 0x30, 0x91, 0x08, 0x24, 0xA0, 0x2A, 0x05, 0x11, 0xA9, 0xCF, 0x98,
+  0x18, 0x00, 0x20, 0x88, 0x25, 0x82, 0x0B, 0x17, 0x10, 0xB0, 0xAD, 0xAA, 0x18, 0xC0, 0x10, 0xA1,
+  0x70, 0x02, 0x39, 0x15, 0x81, 0x91, 0xCB, 0x9B, 0x41, 0x02, 0x37, 0x00, 0xBC, 0xA9, 0x8C, 0x03,
+  0x20, 0x47, 0x81, 0x42, 0x02, 0x90, 0xC8, 0xAD, 0xA9, 0x8B, 0xAC, 0x82, 0x40, 0x35, 0x10, 0x41,
+  0x04, 0x80, 0xC8, 0xBB, 0x9D, 0xB9, 0xAA, 0x80, 0x31, 0x47, 0x01, 0x42, 0x92, 0x11, 0xB8, 0xCD,
+  0xA9, 0xBA, 0x9C, 0x81, 0x30, 0x27, 0x01, 0x42, 0x82, 0x21, 0xE9, 0x99, 0xBB, 0xAA, 0xAD, 0x00,
+  0x11, 0x55, 0x01, 0x41, 0x82, 0x20, 0xD0, 0x9A, 0xBA, 0xAC, 0xBA, 0x80, 0x40, 0x26, 0x21, 0x42,
+  0x02, 0x30, 0xC8, 0xBB, 0xAC, 0xBD, 0xAA, 0x00, 0x3A, 0x47, 0x01, 0x32, 0x83, 0x30, 0xD1, 0xAB,
+  0xD9, 0xBB, 0xAB, 0xA8, 0x79, 0x23, 0x13, 0x72, 0x81, 0x21, 0xB8, 0xAA, 0xEB, 0x9A, 0xBB, 0x09,
+  0x00, 0x46, 0x12, 0x31, 0x05, 0x18, 0x92, 0x9F, 0xA8, 0xAB, 0xBA, 0x98, 0x28, 0x25, 0x34, 0x31,
+  0x16, 0x08, 0x81, 0xDB, 0xB9, 0xAC, 0xCB, 0x18, 0x98, 0x61, 0x14, 0x20, 0x5F, 0x02, 0x37, 0x00,
+  0x14, 0x00, 0x91, 0xC9, 0x9C, 0xCB, 0xAB, 0x08, 0x98, 0x69, 0x15, 0x21, 0x15, 0x08, 0x00, 0xA8,
+  0xAD, 0xB9, 0x9D, 0x09, 0x90, 0x49, 0x24, 0x32, 0x53, 0x82, 0x20, 0xC8, 0xCB, 0xBB, 0xAC, 0x8A,
+  0xB8, 0x58, 0x34, 0x23, 0x44, 0x03, 0x11, 0xA1, 0xAF, 0xA9, 0xBC, 0xA0, 0x0B, 0x81, 0x52, 0x25,
+  0x22, 0x35, 0x88, 0x11, 0xDC, 0x88, 0xBC, 0xA8, 0x89, 0x09, 0x22, 0x53, 0x43, 0x25, 0x20, 0x81,
+  0xC0, 0x8C, 0xFA, 0x89, 0xA9, 0x09, 0x01, 0x28, 0x26, 0x21, 0x43, 0x00, 0x93, 0xBB, 0xF9, 0x1C,
+  0xFB, 0x48, 0x8B, 0x01, 0x02, 0x13, 0x08, 0x00, 0x04, 0xA6, 0x9C, 0xB8, 0x19, 0x9A, 0x0D, 0x03,
+  0x09, 0x37, 0x90, 0x38, 0xB1, 0x6A, 0xA1, 0x9C, 0xA9, 0xAA, 0x83, 0x5B, 0xA3, 0x5A, 0x05, 0x08,
+  0x38, 0xB1, 0x6A, 0xF2, 0x1A, 0xB8, 0x2A, 0xB3, 0x39, 0x85, 0x0C, 0x35, 0x8A, 0x04, 0x8A, 0x08,
+  0x24, 0x04, 0x38, 0x00, 0x80, 0xBC, 0xC9, 0x12, 0xB9, 0x17, 0x8C, 0x33, 0x00, 0x20, 0x81, 0x4E,
+  0xB0, 0x82, 0x9D, 0x90, 0x98, 0x00, 0x4B, 0x02, 0x3B, 0x07, 0x20, 0x19, 0xC7, 0x28, 0x90, 0x8B,
+  0x19, 0xDA, 0x02, 0x99, 0x7B, 0xB4, 0x5B, 0xA3, 0x49, 0xD1, 0x20, 0xC1, 0x39, 0xA9, 0x89, 0x11,
+  0xC9, 0x85, 0x8C, 0x43, 0xA9, 0x24, 0x0E, 0x84, 0x0C, 0x21, 0xBA, 0x40, 0xB8, 0x8A, 0x21, 0x02,
+  0xBB, 0x10, 0x16, 0x08, 0xD2, 0x18, 0x92, 0x00, 0x0D, 0xC2, 0x7C, 0xC9, 0x40, 0xA0, 0x09, 0x12,
+  0xB8, 0x21, 0x12, 0x8F, 0x14, 0x9D, 0x22, 0xA8, 0x1C, 0x94, 0x8B, 0x23, 0x9B, 0x92, 0x20, 0xA8,
+  0x40, 0x17, 0x8D, 0x18, 0xB2, 0x3A, 0xB7, 0x09, 0x00, 0xC9, 0x42, 0xB0, 0x3A, 0x86, 0x8C, 0x03,
+  0x90, 0x2B, 0x85, 0x0E, 0x02, 0x8A, 0xB2, 0x38, 0xA0, 0x99, 0x35, 0xF8, 0x39, 0x94, 0x8B, 0x82,
+  0x13, 0x9C, 0x38, 0xB8, 0x55, 0xFE, 0x3A, 0x00, 0x41, 0xB9, 0xB1, 0xB1, 0x68, 0xA4, 0x0A, 0x91,
+  0x31, 0xAB, 0x68, 0x58, 0xF9, 0x30, 0x88, 0x8A, 0x01, 0x2B, 0x21, 0xEB, 0x82, 0x4D, 0x92, 0x38,
+  0x0F, 0xB2, 0x38, 0x94, 0x9D, 0x23, 0xCA, 0x30, 0xB2, 0x0C, 0x31, 0xAA, 0x2A, 0x07, 0x1C, 0x90,
+  0x60, 0x9A, 0x81, 0x10, 0x9C, 0x52, 0xE9, 0x21, 0xA8, 0x01, 0x1A, 0x08, 0x93, 0x1B, 0xA2, 0xA0,
+  0x79, 0xB3, 0x9B, 0x87, 0x1D, 0x22, 0xBC, 0x33, 0xB9, 0x69, 0x90, 0x1A, 0x83, 0xCA, 0x07, 0xC8,
+  0x48, 0xB1, 0x4A, 0xA1, 0x0A, 0x13, 0x9D, 0x42, 0x99, 0x80, 0x89, 0x07, 0xD9, 0x68, 0x98, 0x08,
+  0x81, 0x08, 0x0A, 0x30, 0xD0, 0x19, 0x95, 0x0A, 0x11, 0xA8, 0x29, 0xB2, 0x20, 0x88, 0xB8, 0x05,
+  0xAC, 0x73, 0xA0, 0x2A, 0xA8, 0x2B, 0x83, 0x10, 0x79, 0xFB, 0x50, 0xA8, 0x48, 0x90, 0x8B, 0x04,
+  0xD8, 0x30, 0x39, 0xBA, 0x99, 0x34, 0x09, 0x8C, 0xCF, 0xF9, 0x3A, 0x00, 0x82, 0x2A, 0xD3, 0x59,
+  0x1A, 0x12, 0xBD, 0x02, 0x43, 0xDA, 0x20, 0x1D, 0xE3, 0x10, 0x80, 0x1A, 0x30, 0x8D, 0x40, 0x99,
+  0x22, 0xFB, 0x12, 0xB3, 0x0C, 0x23, 0xBA, 0x3A, 0x96, 0xCB, 0x23, 0x92, 0xBA, 0x78, 0xB1, 0x1B,
+  0x07, 0xBA, 0x15, 0xC8, 0x30, 0xA1, 0x1C, 0x21, 0xAB, 0x82, 0x18, 0x99, 0x32, 0xF1, 0x18, 0x04,
+  0x0C, 0x30, 0x88, 0x8B, 0x07, 0xC9, 0x01, 0x20, 0xB9, 0xAA, 0x78, 0xB0, 0x0B, 0x27, 0xD9, 0x58,
+  0x80, 0x09, 0x21, 0xAA, 0x31, 0x91, 0xDA, 0x18, 0x09, 0x9C, 0x40, 0xF2, 0x09, 0x12, 0x90, 0x29,
+  0x78, 0x00, 0xA2, 0x0B, 0x01, 0x11, 0xCD, 0x38, 0xA1, 0x9F, 0x29, 0x1B, 0x05, 0xBA, 0x41, 0x13,
+  0x00, 0x92, 0xCA, 0x26, 0xB1, 0x1B, 0xE8, 0x2A, 0xB9, 0x1A, 0x86, 0xBE, 0x43, 0x91, 0x1A, 0x15,
+  0x18, 0x88, 0x2A, 0x82, 0xAC, 0x14, 0xFB, 0x2A, 0x90, 0x0A, 0x88, 0x91, 0x56, 0xE6, 0x3B, 0x00,
+  0x19, 0x56, 0x80, 0x28, 0x05, 0xBA, 0x21, 0x83, 0x8C, 0xD9, 0x89, 0x89, 0x89, 0xA8, 0x2C, 0x08,
+  0x57, 0x91, 0x38, 0x16, 0xAC, 0x30, 0x93, 0xA9, 0xA9, 0x8E, 0x88, 0x82, 0xDB, 0x28, 0x84, 0x00,
+  0x13, 0x51, 0x23, 0xDA, 0x3B, 0x33, 0xCA, 0x91, 0xDE, 0x08, 0x83, 0xAD, 0x21, 0xA0, 0x6A, 0x13,
+  0x99, 0x25, 0xC0, 0x1A, 0x32, 0xA8, 0x8A, 0xFA, 0x2B, 0x81, 0xAA, 0x88, 0x80, 0x69, 0x53, 0x88,
+  0x51, 0xA2, 0x9E, 0x23, 0xA2, 0x8B, 0xB8, 0x0E, 0x08, 0x91, 0xAB, 0x29, 0x94, 0x63, 0x03, 0x1B,
+  0x26, 0xCA, 0x28, 0x13, 0xBB, 0x90, 0xFA, 0x2B, 0x18, 0xD8, 0x8A, 0x23, 0x3B, 0x57, 0xA8, 0x40,
+  0xA2, 0x8D, 0x32, 0xA0, 0x99, 0x99, 0x8E, 0x10, 0xA1, 0xAA, 0x39, 0x20, 0x37, 0x81, 0x28, 0x03,
+  0xAD, 0x51, 0x01, 0xB9, 0xCB, 0x9A, 0x99, 0x42, 0xF0, 0x9C, 0x14, 0x38, 0x23, 0x89, 0x32, 0xE8,
+  0x42, 0x0C, 0x41, 0x00, 0x19, 0x14, 0x88, 0xB9, 0xCE, 0x18, 0x80, 0x00, 0xE9, 0x1A, 0x13, 0x44,
+  0x91, 0x28, 0x11, 0xAC, 0x30, 0x84, 0x18, 0xDD, 0x9C, 0x30, 0xC1, 0x28, 0xE9, 0x29, 0x32, 0x13,
+  0x90, 0x20, 0x83, 0x9F, 0x31, 0x81, 0x99, 0xFC, 0x8A, 0x00, 0x02, 0xB9, 0x8E, 0x31, 0x48, 0x24,
+  0xA8, 0x30, 0x95, 0x8D, 0x21, 0x80, 0x99, 0xDA, 0xAB, 0x30, 0x92, 0xAA, 0xAE, 0x42, 0x02, 0x27,
+  0xA8, 0x40, 0x93, 0x9D, 0x20, 0x81, 0x98, 0xDA, 0xAA, 0x09, 0x15, 0xAB, 0x1A, 0x10, 0x84, 0x27,
+  0x91, 0x40, 0x11, 0xCB, 0x08, 0x02, 0x80, 0xAC, 0xBC, 0x9A, 0x04, 0xAA, 0x88, 0x09, 0x34, 0x78,
+  0x24, 0x08, 0x25, 0xB0, 0x8A, 0x80, 0x00, 0xB9, 0x9E, 0xA9, 0x8A, 0x82, 0xCC, 0x08, 0x99, 0x32,
+  0x72, 0x13, 0x58, 0x16, 0x90, 0x20, 0xA0, 0x0A, 0xB1, 0xAE, 0x99, 0x9B, 0xB9, 0xCB, 0xAB, 0x0A,
+  0x84, 0x72, 0x16, 0x30, 0xA5, 0x06, 0x3C, 0x00, 0x24, 0x10, 0x11, 0xB9, 0x98, 0xDB, 0xBC, 0xAA,
+  0xBA, 0xAB, 0xAB, 0xA9, 0x8A, 0x16, 0x70, 0x07, 0x21, 0x14, 0x00, 0x01, 0x99, 0x89, 0xEB, 0xAA,
+  0xA9, 0x9C, 0x99, 0xAB, 0x01, 0x99, 0x32, 0x70, 0x27, 0x41, 0x23, 0x01, 0x10, 0xB8, 0x99, 0xFA,
+  0x9C, 0xB8, 0x9A, 0x99, 0xBB, 0x22, 0xAB, 0x71, 0x08, 0x37, 0x31, 0x34, 0x12, 0x11, 0xA8, 0x9B,
+  0xE8, 0x9F, 0xA0, 0x8A, 0x98, 0x9B, 0x00, 0x88, 0x38, 0xA3, 0x73, 0x17, 0x32, 0x14, 0x11, 0x80,
+  0x9B, 0xA8, 0xBF, 0x89, 0xBB, 0x89, 0xDA, 0x18, 0x89, 0x91, 0x40, 0x08, 0x47, 0x31, 0x34, 0x12,
+  0x02, 0xA9, 0xA9, 0xFB, 0x9C, 0xAA, 0x9A, 0xA9, 0x9B, 0x88, 0x80, 0x80, 0x31, 0x70, 0x37, 0x42,
+  0x25, 0x10, 0x01, 0xB9, 0x88, 0xCE, 0x99, 0xBA, 0x89, 0xC9, 0x09, 0x98, 0x10, 0xA8, 0x33, 0x70,
+  0x17, 0x42, 0x22, 0x12, 0x80, 0xA9, 0xB8, 0xBF, 0xE6, 0x03, 0x39, 0x00, 0xAA, 0xAB, 0x99, 0xCB,
+  0x08, 0x0A, 0x82, 0xA9, 0x17, 0x60, 0x33, 0x63, 0x23, 0x12, 0x81, 0x8B, 0xD8, 0xBD, 0xAA, 0xBA,
+  0x98, 0xCB, 0x08, 0x88, 0x13, 0x9B, 0x25, 0x70, 0x25, 0x51, 0x23, 0x21, 0x81, 0xAB, 0xB0, 0xCF,
+  0xA9, 0x9A, 0x98, 0xAA, 0x19, 0x89, 0x12, 0x99, 0x44, 0x30, 0x47, 0x42, 0x24, 0x12, 0x01, 0xB9,
+  0xA8, 0xCF, 0xA9, 0xAA, 0x98, 0xAA, 0x09, 0x88, 0x32, 0x9A, 0x32, 0x01, 0x77, 0x23, 0x35, 0x23,
+  0x02, 0xA9, 0xA8, 0xBF, 0xCB, 0xBA, 0x99, 0xB9, 0x89, 0x0A, 0x22, 0x01, 0x08, 0x14, 0x72, 0x17,
+  0x43, 0x32, 0x23, 0x80, 0xA9, 0xDB, 0xCD, 0xAA, 0xAA, 0x99, 0xAA, 0x09, 0x18, 0x14, 0x80, 0x30,
+  0x81, 0x77, 0x21, 0x43, 0x32, 0x23, 0x98, 0x98, 0xDD, 0xBB, 0xAC, 0x8A, 0xAA, 0x99, 0x09, 0x41,
+  0x81, 0x13, 0x08, 0x34, 0x73, 0x33, 0x36, 0x24, 0x13, 0x81, 0x98, 0xEB, 0xA5, 0x10, 0x35, 0x00,
+  0xCB, 0xAC, 0xAA, 0x99, 0xAA, 0x08, 0x28, 0x14, 0x28, 0x32, 0x21, 0x17, 0x42, 0x22, 0x36, 0x42,
+  0x11, 0x01, 0xB9, 0xEA, 0xBC, 0xBB, 0xAA, 0xBA, 0xCB, 0x89, 0x18, 0x34, 0x10, 0x84, 0x41, 0x23,
+  0x43, 0x22, 0x25, 0x30, 0x15, 0x08, 0x90, 0xCC, 0x99, 0xDB, 0xCB, 0xDA, 0x29, 0x9A, 0x08, 0xAA,
+  0x14, 0x19, 0x14, 0x08, 0x05, 0x30, 0x24, 0x1C, 0xA4, 0x3A, 0x81, 0x08, 0x18, 0x8E, 0xC4, 0x09,
+  0x80, 0x80, 0xC0, 0x0C, 0xD0, 0x09, 0x88, 0x3A, 0xE0, 0x0A, 0x24, 0x48, 0x81, 0x40, 0xA5, 0x30,
+  0x91, 0x58, 0xA8, 0x18, 0xD4, 0x3B, 0x91, 0x0F, 0xD2, 0xA7, 0x6F, 0xE1, 0x40, 0x8B, 0x83, 0x0B,
+  0x04, 0x9D, 0x14, 0x8B, 0x03, 0x0D, 0x83, 0x8A, 0x93, 0x89, 0x03, 0x0D, 0x94, 0x3B, 0x80, 0x89,
+  0x11, 0x8A, 0x93, 0x0A, 0x18, 0xD3, 0x6A, 0x99, 0x10, 0x88, 0x98, 0x94, 0x89, 0xB6, 0x7A, 0x89,
+  0x41, 0xFF, 0x40, 0x00, 0x18, 0xC1, 0x40, 0xB9, 0x12, 0x88, 0x3C, 0xF3, 0x30, 0x0B, 0x08, 0xB2,
+  0x4A, 0xA0, 0xB2, 0x32, 0x8F, 0xB4, 0x11, 0x4D, 0xB9, 0x95, 0x80, 0x39, 0x0A, 0x7C, 0xC8, 0x02,
+  0xD1, 0x21, 0x89, 0x4A, 0x98, 0x28, 0x09, 0xF1, 0x84, 0x1A, 0x90, 0x20, 0x3C, 0x9A, 0x95, 0x09,
+  0xC2, 0x01, 0x28, 0x1F, 0x81, 0x89, 0x41, 0xCB, 0x15, 0x9B, 0x84, 0x98, 0x40, 0x99, 0x38, 0x98,
+  0x91, 0x81, 0xD8, 0x03, 0xAB, 0x40, 0xCA, 0x32, 0xBC, 0x04, 0x1B, 0x92, 0x01, 0x78, 0xB8, 0x34,
+  0x8B, 0x06, 0x00, 0x19, 0xC2, 0x1A, 0xB9, 0xBA, 0x82, 0xDA, 0x22, 0x0D, 0x80, 0x0A, 0xC2, 0x21,
+  0x1A, 0x86, 0x11, 0x69, 0x83, 0x71, 0x82, 0xA8, 0x08, 0xFA, 0x18, 0xBB, 0x91, 0x29, 0x1A, 0xC3,
+  0x5A, 0xF8, 0x20, 0xA9, 0x12, 0x2A, 0x91, 0x79, 0x84, 0x58, 0x83, 0x9A, 0x91, 0xAC, 0x91, 0xCA,
+  0x1A, 0xA8, 0x41, 0x88, 0x6D, 0xF6, 0x35, 0x00, 0xA1, 0x1A, 0x9F, 0x83, 0x1A, 0x91, 0x53, 0x4B,
+  0x27, 0x49, 0x04, 0x99, 0x88, 0xCB, 0x00, 0x9B, 0xBA, 0x10, 0x00, 0x23, 0xB9, 0xAA, 0xCF, 0x05,
+  0x0C, 0x94, 0x5A, 0xA1, 0x72, 0x00, 0x23, 0xB0, 0x8A, 0xE0, 0x1A, 0xB0, 0x99, 0x18, 0x08, 0x83,
+  0x90, 0xCB, 0x99, 0xA1, 0x5E, 0xC2, 0x48, 0xD3, 0x61, 0x81, 0x42, 0x90, 0x8A, 0xB8, 0x1D, 0xB1,
+  0x0A, 0x98, 0x18, 0x83, 0x89, 0xC9, 0xAB, 0x4A, 0xB9, 0x27, 0x0E, 0x95, 0x4B, 0x05, 0x29, 0x05,
+  0x9A, 0x88, 0xAA, 0x28, 0xCB, 0x01, 0x0B, 0x13, 0xA8, 0x18, 0xFC, 0x00, 0x1A, 0xA3, 0x21, 0x2D,
+  0xF3, 0x73, 0x88, 0x03, 0x11, 0x9D, 0xA1, 0x1A, 0xA9, 0xA0, 0x80, 0x28, 0xB4, 0x29, 0x9B, 0xFA,
+  0x31, 0x0D, 0x95, 0x89, 0x21, 0x9B, 0x67, 0x19, 0x02, 0x80, 0x8B, 0xB9, 0x88, 0x9A, 0x91, 0x98,
+  0x31, 0xA0, 0x09, 0xEA, 0x1D, 0x90, 0x51, 0xA9, 0x32, 0xEF, 0x37, 0x00, 0x01, 0xA1, 0x7A, 0x27,
+  0x40, 0x02, 0x99, 0xCA, 0x99, 0x98, 0x88, 0x9A, 0x10, 0x11, 0x88, 0xBB, 0xB9, 0x8E, 0x93, 0x43,
+  0x8C, 0xB0, 0x33, 0x7F, 0x07, 0x49, 0x92, 0x88, 0xAA, 0x99, 0x99, 0x08, 0xB9, 0x30, 0x91, 0x58,
+  0xDB, 0x80, 0x8A, 0x31, 0x0A, 0xB2, 0x3B, 0xF6, 0x61, 0x03, 0x68, 0x82, 0x8A, 0xB9, 0x0C, 0xB0,
+  0x3A, 0xCA, 0x22, 0x29, 0x19, 0xD8, 0x89, 0x09, 0x82, 0x20, 0xE8, 0x11, 0xF8, 0x74, 0x88, 0x43,
+  0x88, 0x88, 0xBB, 0x88, 0xAB, 0x81, 0xAB, 0x16, 0x09, 0x93, 0x0D, 0xB0, 0x4B, 0xC3, 0x40, 0xA9,
+  0x59, 0xF0, 0x24, 0x09, 0x33, 0xA1, 0x28, 0xAE, 0x08, 0xAB, 0x10, 0x9C, 0x14, 0x89, 0x84, 0x8B,
+  0xA1, 0x0A, 0x94, 0x59, 0xA8, 0x00, 0xC5, 0x70, 0x80, 0x22, 0x82, 0x29, 0xAC, 0xB0, 0xD8, 0x19,
+  0xAB, 0x21, 0x81, 0x03, 0x0A, 0xCA, 0x3D, 0xC1, 0x30, 0xB8, 0x93, 0x87, 0x95, 0xFC, 0x37, 0x00,
+  0x79, 0x80, 0x02, 0x32, 0x38, 0x9C, 0xB0, 0x0C, 0xAB, 0xFA, 0x92, 0x4C, 0x09, 0x98, 0x91, 0x20,
+  0x2B, 0xC4, 0xB4, 0xA3, 0x11, 0x6C, 0x3B, 0x09, 0x81, 0x92, 0xA4, 0x93, 0xA1, 0x93, 0x1D, 0x8B,
+  0x2B, 0x0F, 0x8A, 0x98, 0xA8, 0x93, 0x19, 0xB4, 0x18, 0x92, 0xA4, 0x23, 0x19, 0x06, 0x40, 0x21,
+  0x80, 0x84, 0x81, 0x05, 0x28, 0xD1, 0x90, 0x80, 0x0D, 0xB0, 0x0C, 0x88, 0x9E, 0xA1, 0x0C, 0x28,
+  0xA0, 0x85, 0x01, 0x32, 0x10, 0x72, 0x18, 0x80, 0x16, 0x08, 0x80, 0x08, 0x94, 0x59, 0x2B, 0xAA,
+  0x81, 0x80, 0xF1, 0x1B, 0x8A, 0x80, 0x80, 0x00, 0x08, 0x7A, 0x93, 0x95, 0x03, 0x08, 0x99, 0xF8,
+  0x90, 0x9A, 0x41, 0x06, 0x08, 0x08, 0x08, 0x08, 0x80, 0xC1, 0xAF, 0x98, 0x80, 0x00, 0xF8, 0xB2,
+  0x1B, 0xB0, 0xC3, 0x7C, 0x0A, 0x7F, 0x8B, 0x02, 0x0A, 0x83, 0x3B, 0x9B, 0x87, 0x7B, 0x8A, 0x91,
+  0x91, 0xFC, 0x37, 0x00, 0x82, 0x1C, 0x90, 0x93, 0x08, 0x3C, 0x99, 0x80, 0x28, 0x3D, 0x48, 0x1F,
+  0xA1, 0x20, 0x1B, 0x89, 0x22, 0x2C, 0xB3, 0xB5, 0x59, 0x89, 0x10, 0x3D, 0xD5, 0x30, 0x2E, 0x90,
+  0x91, 0x39, 0x99, 0x12, 0x0C, 0xB6, 0x6B, 0xD1, 0x21, 0xAA, 0x05, 0x0A, 0xB4, 0x80, 0x09, 0x9D,
+  0x17, 0x8A, 0x82, 0x3B, 0x10, 0x9B, 0x84, 0x3D, 0x92, 0x1B, 0xB4, 0x4A, 0xB0, 0x20, 0xB8, 0x32,
+  0xF9, 0x22, 0x8C, 0x02, 0x9A, 0x12, 0xA9, 0x23, 0x8F, 0x21, 0x8C, 0xA5, 0x5A, 0x89, 0x39, 0xD0,
+  0x50, 0x8A, 0x18, 0xC1, 0x30, 0x9A, 0x12, 0x8B, 0x93, 0x3C, 0x0A, 0x93, 0x9A, 0x78, 0xBA, 0x87,
+  0x99, 0x59, 0xA9, 0x02, 0xA1, 0x4A, 0x8B, 0x03, 0xF9, 0x05, 0x0C, 0x11, 0x9A, 0x94, 0x2B, 0x91,
+  0x89, 0xA5, 0x2A, 0x04, 0x0D, 0x02, 0x09, 0x29, 0xC9, 0x05, 0x89, 0x83, 0x1F, 0xA0, 0x84, 0x18,
+  0x09, 0xA8, 0x22, 0x1B, 0xD6, 0xFD, 0x2C, 0x00, 0x0A, 0xB4, 0x7C, 0x80, 0x98, 0x93, 0x5D, 0x89,
+  0x01, 0x90, 0xB3, 0x78, 0x9A, 0x48, 0xB9, 0x86, 0x29, 0xA0, 0x20, 0x8F, 0xA4, 0x39, 0x80, 0x0B,
+  0x82, 0x0C, 0x87, 0x3B, 0xC2, 0x99, 0x85, 0x29, 0xC1, 0x69, 0xA8, 0x10, 0xA2, 0x1C, 0x11, 0x98,
+  0xB5, 0x3C, 0x98, 0x2B, 0xA7, 0x4B, 0xA0, 0x98, 0x41, 0x98, 0xD2, 0x28, 0x29, 0xC0, 0x51, 0xCA,
+  0x31, 0x98, 0x30, 0xD8, 0x10, 0x2E, 0x82, 0xB9, 0x83, 0xAB, 0x05, 0x69, 0xD9, 0x10, 0x91, 0x3B,
+  0xA4, 0x90, 0x0A, 0x42, 0x1E, 0x92, 0xB0, 0x4A, 0x41, 0xC8, 0x92, 0x0C, 0x01, 0x14, 0x8F, 0x12,
+  0xBA, 0x84, 0x18, 0x9B, 0x24, 0x88, 0xBA, 0x70, 0xAA, 0x24, 0xF0, 0x10, 0x80, 0x10, 0x99, 0x28,
+  0x00, 0x28, 0xF3, 0x3D, 0xB3, 0x6A, 0xC0, 0x08, 0x01, 0x49, 0xF0, 0x30, 0xA9, 0x11, 0x80, 0xB9,
+  0x41, 0x08, 0xA8, 0x84, 0x2D, 0x19, 0xD3, 0x12, 0x80, 0x09, 0x3D, 0x00, 0x0B, 0x1A, 0xB2, 0x13,
+  0x4B, 0x8B, 0xA1, 0xB4, 0x3F, 0x91, 0x03, 0xE9, 0x4B, 0xA2, 0x10, 0xD1, 0x39, 0xA5, 0x8D, 0x04,
+  0x8A, 0x03, 0x9D, 0x84, 0x09, 0x31, 0xBD, 0x32, 0xB8, 0x33, 0xAF, 0x12, 0x91, 0x20, 0x9D, 0x20,
+  0x93, 0x8D, 0x95, 0x4B, 0xB0, 0x00, 0xA1, 0x30, 0x1B, 0x08, 0xF0, 0x13, 0x0B, 0x00, 0xA1, 0x78,
+  0xB8, 0xD8, 0x26, 0xC9, 0x30, 0xA8, 0x88, 0x06, 0x0D, 0x81, 0x18, 0x91, 0x0C, 0x84, 0xB8, 0x71,
+  0xAA, 0x11, 0x80, 0x20, 0xBB, 0x78, 0xB2, 0x0A, 0x32, 0x8D, 0x82, 0x83, 0xAD, 0x69, 0xA2, 0x3A,
+  0x88, 0x9A, 0x41, 0x99, 0xF3, 0x50, 0xA8, 0x09, 0x12, 0x19, 0xA9, 0x22, 0xAA, 0x13, 0xF1, 0x5C,
+  0xB2, 0x4B, 0x80, 0x0B, 0x84, 0x9B, 0x41, 0x00, 0xF9, 0x82, 0x38, 0x8A, 0x84, 0xBA, 0x70, 0x91,
+  0x8E, 0x13, 0x1A, 0xA8, 0x09, 0x10, 0x01, 0x90, 0xDC, 0x60, 0x91, 0x8B, 0xAE, 0xF5, 0x3C, 0x00,
+  0x94, 0x38, 0x9A, 0x92, 0x50, 0xD8, 0x42, 0xAC, 0x84, 0x18, 0x0C, 0xA2, 0x01, 0x9B, 0x83, 0x3C,
+  0xB5, 0x0C, 0x93, 0x50, 0x8A, 0x90, 0x84, 0x1F, 0x86, 0x9A, 0x21, 0xC0, 0x30, 0x9A, 0x81, 0x8B,
+  0x07, 0x99, 0x4A, 0xF1, 0x20, 0x91, 0x0B, 0x11, 0x90, 0x02, 0x2C, 0x11, 0x91, 0x01, 0xAA, 0x60,
+  0xA8, 0x89, 0x0B, 0xF9, 0x24, 0x9E, 0x20, 0x89, 0x82, 0x13, 0x8F, 0x10, 0x05, 0x19, 0x90, 0x39,
+  0x95, 0x1A, 0x88, 0xBE, 0x15, 0xA9, 0x89, 0x8B, 0x10, 0xC2, 0x69, 0xB1, 0x4B, 0x84, 0x00, 0x18,
+  0x7B, 0x02, 0xB3, 0x8D, 0x00, 0x10, 0x9C, 0xC1, 0x88, 0x91, 0x9F, 0x20, 0xA4, 0x2A, 0x09, 0x20,
+  0x05, 0xA2, 0x49, 0x25, 0xA8, 0x1C, 0xE2, 0x28, 0x00, 0x9F, 0x81, 0xA8, 0x38, 0xA8, 0x5B, 0xC2,
+  0x10, 0x21, 0x49, 0x12, 0x88, 0x17, 0xAA, 0x3A, 0xB9, 0x01, 0xE2, 0x8D, 0x80, 0x8A, 0x94, 0x89,
+  0x3A, 0xE2, 0x3F, 0x00, 0x5B, 0x81, 0x98, 0x45, 0x82, 0x4A, 0x04, 0xCA, 0x20, 0xA8, 0x29, 0xD2,
+  0x8D, 0x90, 0x98, 0x30, 0xDB, 0x30, 0xA1, 0x02, 0x40, 0x71, 0x13, 0x01, 0xB8, 0x1C, 0x18, 0xB8,
+  0xA6, 0x9E, 0x0A, 0x01, 0xB8, 0x99, 0x29, 0x24, 0x80, 0x2A, 0x37, 0x45, 0x82, 0xCA, 0x98, 0x80,
+  0x41, 0xC8, 0xAC, 0x9A, 0x04, 0x1E, 0x92, 0xAB, 0x42, 0x92, 0x3A, 0x06, 0x21, 0x12, 0xB8, 0xDB,
+  0x08, 0x40, 0x90, 0xED, 0x0A, 0x02, 0x09, 0x80, 0xBB, 0x61, 0x93, 0x49, 0x42, 0x18, 0x06, 0xD9,
+  0x19, 0x00, 0x88, 0xA2, 0xBE, 0x18, 0x80, 0x11, 0x9B, 0x98, 0x10, 0x27, 0x2A, 0x25, 0xA1, 0x73,
+  0xC1, 0x8C, 0x01, 0x18, 0x91, 0xAD, 0x98, 0x08, 0x33, 0xCB, 0x2A, 0xA2, 0x41, 0x73, 0x81, 0x10,
+  0x25, 0xCA, 0x0B, 0x08, 0x12, 0xE1, 0xAB, 0x9A, 0x60, 0xB1, 0x09, 0x80, 0x0B, 0x27, 0x19, 0x24,
+  0x08, 0x32, 0xC0, 0xAC, 0xC0, 0x0B, 0x42, 0x00, 0x80, 0x11, 0x90, 0xFB, 0x8E, 0x11, 0x88, 0x81,
+  0xD8, 0x28, 0x13, 0x1B, 0x27, 0x91, 0x42, 0xC0, 0x9C, 0x12, 0x88, 0x11, 0xCE, 0x09, 0x20, 0x98,
+  0x91, 0x8D, 0x40, 0x81, 0xA8, 0x43, 0x43, 0x32, 0xB9, 0xBE, 0x11, 0x22, 0x0B, 0xFB, 0x9C, 0x11,
+  0x02, 0x8B, 0x9C, 0x02, 0x12, 0x51, 0x9C, 0x63, 0x85, 0x01, 0xB9, 0x0D, 0x03, 0x08, 0x80, 0xBF,
+  0x29, 0x82, 0x80, 0x90, 0x8E, 0x12, 0x01, 0x91, 0x1D, 0x46, 0x80, 0x18, 0xC8, 0x0B, 0x24, 0x99,
+  0x98, 0xCC, 0x39, 0x01, 0x80, 0xA8, 0x9C, 0x34, 0x90, 0x00, 0x1A, 0x77, 0x81, 0x08, 0xA9, 0x1B,
+  0x23, 0xB8, 0x89, 0xBF, 0x3A, 0x92, 0x80, 0x12, 0xAE, 0x30, 0x83, 0xAA, 0x85, 0x72, 0x33, 0x98,
+  0x9A, 0xAA, 0x28, 0x00, 0xA1, 0xEE, 0x8B, 0x08, 0x21, 0xB4, 0x9B, 0x41, 0xA8, 0x14, 0x8B, 0x3B,
+  0x77, 0x93, 0x09, 0x00, 0xBB, 0x20, 0x90, 0x1A, 0xD9, 0x0A, 0x3A, 0x00, 0xFA, 0xCB, 0x20, 0x11,
+  0x09, 0x99, 0x80, 0x24, 0x90, 0x0F, 0x81, 0x67, 0x00, 0x8A, 0x82, 0xB9, 0x28, 0x98, 0x08, 0xE8,
+  0xAB, 0x19, 0x22, 0xC0, 0x11, 0x9B, 0x71, 0xC3, 0x89, 0x11, 0x29, 0x77, 0x90, 0x09, 0x22, 0xDA,
+  0x09, 0x81, 0x08, 0xB0, 0xBD, 0x18, 0x33, 0x9A, 0x90, 0x88, 0x72, 0xA2, 0x99, 0xA0, 0x54, 0x61,
+  0x82, 0xA8, 0x31, 0xB8, 0x0F, 0x90, 0x00, 0xB0, 0x9D, 0xAB, 0x43, 0x02, 0xAB, 0x93, 0x2B, 0x37,
+  0xB8, 0x0A, 0x02, 0x72, 0x11, 0x12, 0x91, 0x51, 0xC8, 0xBD, 0x00, 0x22, 0xC8, 0xAF, 0x98, 0x12,
+  0x33, 0xAD, 0x89, 0x14, 0x11, 0xA8, 0x8D, 0x23, 0x31, 0x92, 0x41, 0x13, 0x20, 0xC3, 0xEF, 0x18,
+  0x01, 0xA8, 0xAD, 0x99, 0x30, 0x23, 0xCA, 0x99, 0x48, 0x24, 0x90, 0xAB, 0x3A, 0x27, 0x89, 0x03,
+  0x51, 0x14, 0x89, 0x82, 0xDF, 0x10, 0x90, 0x09, 0xD8, 0x9C, 0x23, 0x00, 0xDD, 0xF0, 0x40, 0x00,
+  0x08, 0xD8, 0x59, 0x83, 0x99, 0x10, 0xB0, 0x70, 0x91, 0x19, 0x41, 0x01, 0x82, 0x81, 0xAE, 0x0A,
+  0x90, 0x89, 0xC0, 0xAE, 0x08, 0x11, 0x24, 0xAA, 0x0A, 0x84, 0x35, 0xC9, 0x28, 0xB8, 0x60, 0x93,
+  0x19, 0x23, 0x33, 0x15, 0x89, 0xCC, 0xBC, 0x31, 0x89, 0xAA, 0xEF, 0x19, 0x22, 0x00, 0x8A, 0x09,
+  0x90, 0x46, 0xA8, 0x1B, 0x82, 0x48, 0x94, 0x9B, 0x54, 0x20, 0x21, 0xA8, 0x9A, 0xBC, 0x0B, 0x81,
+  0xB8, 0xEF, 0x0A, 0x10, 0x82, 0x12, 0xAE, 0x13, 0x00, 0x58, 0xC0, 0x09, 0x13, 0x29, 0x84, 0xBB,
+  0x56, 0x18, 0x21, 0xC0, 0x08, 0xB9, 0x0E, 0x90, 0x90, 0xA8, 0xAF, 0x01, 0x00, 0x12, 0x89, 0x2B,
+  0x83, 0x73, 0xA1, 0x3D, 0xB0, 0x43, 0xA4, 0x1B, 0x23, 0x9C, 0x67, 0x99, 0x28, 0xB1, 0x8C, 0x80,
+  0x0A, 0x01, 0xEB, 0x89, 0x18, 0x33, 0xE0, 0x10, 0x29, 0x31, 0x91, 0x8A, 0x81, 0x79, 0x95, 0x88,
+  0x25, 0x05, 0x3C, 0x00, 0x09, 0x49, 0x22, 0x15, 0x99, 0x0B, 0xA3, 0xCC, 0x89, 0x9A, 0x91, 0xCC,
+  0x9C, 0x29, 0x16, 0x89, 0x10, 0x89, 0x33, 0x06, 0x8D, 0x01, 0x11, 0x91, 0x41, 0xAF, 0x33, 0xA1,
+  0x60, 0x92, 0x8B, 0x13, 0xAC, 0xAA, 0x8C, 0x93, 0xDB, 0x8A, 0xAA, 0x32, 0x96, 0x3A, 0x08, 0x28,
+  0x27, 0xA9, 0x18, 0x4B, 0x83, 0x91, 0xB9, 0x1C, 0x45, 0x90, 0x37, 0xB8, 0x4B, 0xA3, 0x9D, 0x90,
+  0x0D, 0x12, 0xCC, 0x08, 0x8A, 0x52, 0x90, 0x08, 0x91, 0x58, 0x82, 0x1B, 0xA4, 0x29, 0x12, 0xC9,
+  0xA0, 0x42, 0x38, 0x95, 0x24, 0x08, 0x3A, 0xB2, 0xFB, 0x9B, 0x8C, 0x12, 0xF9, 0x9A, 0x0A, 0x42,
+  0x94, 0x89, 0x18, 0x51, 0x80, 0x03, 0xFB, 0x41, 0x90, 0x01, 0xA8, 0x0A, 0x52, 0xA2, 0x53, 0x80,
+  0x20, 0xD0, 0xBA, 0x88, 0x8C, 0x89, 0xE9, 0xBA, 0x9A, 0x34, 0x29, 0x87, 0xAA, 0x62, 0x08, 0x10,
+  0x90, 0x08, 0x11, 0x08, 0xD4, 0x04, 0x31, 0x00, 0xAB, 0xB3, 0x79, 0x18, 0xC8, 0x27, 0x89, 0x51,
+  0xB0, 0xBB, 0xA9, 0x39, 0x81, 0xED, 0xBA, 0x38, 0x11, 0x12, 0xE1, 0x31, 0x1A, 0x53, 0xC2, 0x29,
+  0x80, 0x2B, 0x02, 0xC1, 0x80, 0x09, 0x53, 0x80, 0x25, 0xA8, 0x39, 0xD0, 0xAD, 0xD8, 0x2A, 0x88,
+  0xAA, 0xC1, 0x8A, 0x73, 0x01, 0x01, 0xC1, 0x33, 0xB0, 0x72, 0xC9, 0x40, 0xB1, 0x49, 0xC0, 0x49,
+  0xA0, 0x25, 0x98, 0x50, 0xA8, 0x9C, 0x81, 0x2A, 0x83, 0x9F, 0x88, 0x88, 0x22, 0xA9, 0x41, 0xA9,
+  0x44, 0x98, 0x82, 0x99, 0x32, 0x04, 0x30, 0xDB, 0x18, 0x93, 0x2C, 0xB8, 0xBC, 0xB9, 0xA0, 0x3D,
+  0xA8, 0x14, 0x13, 0x68, 0x81, 0x08, 0x17, 0x29, 0x0A, 0xBA, 0xB2, 0xD9, 0x08, 0x9E, 0xB1, 0xA9,
+  0x81, 0x0C, 0x38, 0xA9, 0x17, 0x88, 0x70, 0x91, 0x02, 0xB0, 0x72, 0x0F, 0x86, 0x89, 0x32, 0xCB,
+  0xA9, 0x98, 0x30, 0xA1, 0x8C, 0xB9, 0x28, 0x84, 0x4F, 0xF4, 0x31, 0x00, 0x40, 0x02, 0x10, 0x12,
+  0x88, 0x42, 0xCA, 0x35, 0x90, 0x18, 0xAC, 0xB0, 0x08, 0x48, 0x99, 0xDA, 0x14, 0xD8, 0x61, 0x0B,
+  0x10, 0xD1, 0x01, 0x88, 0x39, 0x98, 0x00, 0xB2, 0x61, 0x2B, 0x98, 0xB5, 0x12, 0x08, 0x38, 0xD1,
+  0x08, 0x87, 0x4B, 0x81, 0x89, 0xB2, 0x30, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x7A, 0xFF, 0xC3, 0x21, 0x2E, 0x82, 0xA0, 0x1C, 0x89, 0x08, 0xA5, 0x09, 0x08, 0x08, 0x88,
+  0x80, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x17, 0x1D, 0x93, 0x8C, 0x00, 0x08, 0x08, 0x08,
+  0x08, 0xF9, 0x28, 0x8D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0x08, 0x18, 0x7F, 0xC7, 0x08, 0x80, 0x90, 0x67, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x18, 0x4A, 0x77, 0x04, 0x08, 0x88, 0x00, 0x12, 0x00, 0x1F, 0x00,
+  0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xF7, 0xFF, 0xAA, 0x80, 0x80, 0x80, 0x80, 0x79, 0x23,
+  0x05, 0x08, 0x80, 0x80, 0x80, 0x08, 0x18, 0xF9, 0x93, 0x8F, 0xF1, 0x80, 0x29, 0xC2, 0x08, 0x88,
+  0x80, 0x80, 0x90, 0x74, 0x84, 0xA0, 0x49, 0x88, 0x80, 0x80, 0x2A, 0x81, 0xC8, 0xB3, 0xBF, 0x3A,
+  0x9A, 0x80, 0x48, 0xB8, 0x00, 0x37, 0x96, 0x3A, 0xA0, 0x4C, 0xA8, 0x91, 0xB0, 0x10, 0xA3, 0x0D,
+  0x6A, 0x1A, 0x2B, 0xB1, 0x87, 0xA2, 0x23, 0x3A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0xCD, 0xF4,
+  0xCB, 0x91, 0x5A, 0xB0, 0x80, 0x80, 0x70, 0x91, 0x41, 0xB1, 0x1E, 0x81, 0x08, 0x1C, 0xA2, 0x21,
+  0x36, 0xFF, 0x20, 0x00, 0x14, 0xEA, 0x31, 0x80, 0x08, 0x1D, 0xE1, 0x3B, 0x93, 0xC3, 0x0D, 0xA3,
+  0x1A, 0xA1, 0x16, 0x9B, 0x94, 0x4A, 0x80, 0xA2, 0x20, 0x20, 0x8D, 0xB4, 0x2C, 0x10, 0x29, 0xC4,
+  0x3B, 0xB0, 0x08, 0xA8, 0xA0, 0x84, 0x0F, 0x95, 0x29, 0xBA, 0x68, 0xA3, 0x98, 0x10, 0xD8, 0x12,
+  0x2B, 0xA7, 0x18, 0xB2, 0x32, 0x08, 0x18, 0xBC, 0x84, 0xD9, 0x96, 0x28, 0x1E, 0xB2, 0x10, 0x19,
+  0xAC, 0xA1, 0x80, 0x50, 0x10, 0x08, 0x18, 0x11, 0xA7, 0x49, 0x08, 0x08, 0xA8, 0xE1, 0x4A, 0xE1,
+  0x01, 0x19, 0x89, 0xA3, 0x80, 0x99, 0xE1, 0x81, 0x3D, 0x29, 0xA1, 0x53, 0xD0, 0x00, 0x00, 0xA4,
+  0x23, 0x1E, 0x09, 0x94, 0xAB, 0xC8, 0x4A, 0x83, 0x2D, 0x94, 0x29, 0xA0, 0x14, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x90, 0xF3, 0x8F, 0xA8, 0x0A, 0x08, 0x08, 0x08, 0x29, 0xD4, 0x96, 0x48, 0x38, 0xA3,
+  0x28, 0x90, 0x2F, 0x92, 0xE9, 0xFF, 0x21, 0x00, 0x3A, 0x8A, 0xF4, 0x5B, 0x98, 0x93, 0x39, 0xF9,
+  0x02, 0x00, 0x1B, 0x93, 0x0C, 0x6B, 0xD0, 0x82, 0x1A, 0x99, 0x06, 0x4B, 0x90, 0xA8, 0x95, 0x39,
+  0xA0, 0x49, 0x08, 0x08, 0x08, 0x18, 0xDA, 0xC5, 0x50, 0xAB, 0x46, 0x1F, 0xB4, 0x1A, 0x81, 0xAA,
+  0x31, 0x12, 0x8A, 0x18, 0x34, 0xAA, 0xB8, 0xB3, 0x10, 0x9F, 0x12, 0x99, 0x01, 0x08, 0x10, 0xF8,
+  0x21, 0x88, 0x30, 0xAB, 0x80, 0x80, 0x80, 0x00, 0x8C, 0xF3, 0x58, 0x8A, 0x2A, 0xF2, 0x18, 0xCA,
+  0x13, 0x9B, 0x81, 0x88, 0x00, 0x8F, 0xA0, 0x97, 0x3A, 0x8A, 0x82, 0xD9, 0x48, 0x9B, 0x20, 0xB8,
+  0x02, 0x50, 0x2C, 0xC1, 0x90, 0x91, 0xA2, 0x25, 0x9D, 0x12, 0xC8, 0xA3, 0x4C, 0x03, 0x99, 0x81,
+  0xC1, 0x25, 0x0C, 0x68, 0xA8, 0x93, 0x1A, 0x82, 0x01, 0x30, 0xF1, 0x4A, 0x81, 0x5A, 0xC1, 0x51,
+  0xA9, 0x23, 0x1B, 0x06, 0x8C, 0x91, 0xA1, 0x33, 0x17, 0x01, 0x23, 0x00, 0x0A, 0x68, 0xB8, 0x79,
+  0xC0, 0x12, 0xB8, 0x23, 0xAB, 0xA3, 0x53, 0xDB, 0x82, 0x38, 0xD2, 0x5A, 0xA8, 0x01, 0x3A, 0x8A,
+  0xC4, 0x01, 0x8A, 0xA4, 0x4B, 0x9B, 0xA7, 0x4A, 0x98, 0x09, 0x28, 0xAB, 0x32, 0x0F, 0x91, 0x99,
+  0xA4, 0x2A, 0x8A, 0x91, 0x33, 0xBF, 0x81, 0x7B, 0x9A, 0x08, 0xC0, 0x68, 0xB8, 0x02, 0x0C, 0xA4,
+  0x08, 0x8A, 0xA2, 0x01, 0xC8, 0x97, 0x2A, 0xE0, 0x50, 0x8A, 0x90, 0x29, 0x04, 0xAA, 0x38, 0x91,
+  0x88, 0xB6, 0x18, 0x93, 0xB4, 0x3E, 0x3A, 0xF3, 0x10, 0x00, 0x2A, 0xC3, 0x10, 0x2A, 0xA2, 0x20,
+  0x3C, 0xB4, 0x43, 0x8F, 0x83, 0x10, 0xB1, 0x81, 0x2D, 0x86, 0x2D, 0x92, 0x3A, 0x82, 0x0E, 0xA4,
+  0x10, 0x2A, 0xC8, 0x25, 0x0D, 0x00, 0x00, 0x0A, 0x41, 0x8D, 0x93, 0x29, 0xB0, 0x5A, 0x80, 0xE1,
+  0x01, 0x80, 0x2A, 0x95, 0x1F, 0x91, 0x80, 0x98, 0x92, 0xB6, 0x6B, 0x99, 0x0A, 0xFF, 0x32, 0x00,
+  0x01, 0x90, 0x88, 0x91, 0x29, 0xE4, 0x29, 0xC1, 0x21, 0xCA, 0x13, 0x8C, 0x03, 0x9B, 0x84, 0x2C,
+  0xC8, 0x41, 0x8A, 0x28, 0xF8, 0x83, 0x3B, 0xB1, 0x99, 0x41, 0xB9, 0x94, 0x2F, 0xA5, 0x0A, 0x12,
+  0x9B, 0x03, 0xC8, 0x03, 0x2C, 0xE3, 0x30, 0x9B, 0x15, 0x0C, 0x81, 0x2A, 0x93, 0x0B, 0x96, 0x09,
+  0x82, 0x3B, 0x01, 0x0F, 0x95, 0x19, 0x19, 0x01, 0xB0, 0x96, 0x19, 0x38, 0x4B, 0xC1, 0x69, 0xD0,
+  0x12, 0xA0, 0x88, 0x83, 0x3A, 0xC8, 0x84, 0x79, 0xA9, 0x10, 0x90, 0xB2, 0x50, 0xA8, 0x93, 0x0E,
+  0x97, 0x09, 0x08, 0xB1, 0x69, 0xB0, 0x48, 0xB9, 0x95, 0x90, 0x81, 0x29, 0x0A, 0x80, 0x98, 0x7B,
+  0x1C, 0xB4, 0x29, 0xC1, 0x92, 0x09, 0x08, 0x01, 0xDB, 0x24, 0x9A, 0x08, 0xEB, 0x24, 0x9B, 0x48,
+  0x98, 0x88, 0x82, 0x0F, 0xB5, 0x4B, 0xA1, 0x29, 0xA0, 0x18, 0x88, 0xC4, 0x18, 0x00, 0x21, 0x8F,
+  0x9C, 0xFB, 0x2B, 0x00, 0xA4, 0x00, 0x1E, 0xA2, 0x08, 0x21, 0xD0, 0x81, 0x11, 0x09, 0xE1, 0x01,
+  0xE1, 0x33, 0x8C, 0x11, 0xA8, 0x61, 0xAA, 0x31, 0xB9, 0x94, 0x7B, 0xA0, 0xA2, 0x49, 0xD4, 0x28,
+  0x88, 0x00, 0x29, 0xC2, 0x11, 0x09, 0x18, 0x29, 0xB3, 0xF4, 0x21, 0xA0, 0x89, 0x07, 0x0C, 0x83,
+  0x8B, 0x05, 0x0B, 0x01, 0x98, 0x04, 0x1F, 0x90, 0x12, 0x0B, 0x00, 0x9C, 0x87, 0x89, 0x49, 0xB1,
+  0x4A, 0x89, 0x10, 0xA8, 0x0A, 0x32, 0x0F, 0xB0, 0x81, 0xA4, 0x91, 0x3D, 0xE1, 0x49, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // step1000
+  0x8D, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x3C, 0x1D, 0xA4, 0x32, 0x3C, 0x4B, 0x88, 0xF9, 0x01, 0x0A,
+  0x92, 0x4C, 0xE9, 0x11, 0x00, 0x95, 0x0A, 0x38, 0xA8, 0x87, 0x29, 0xC0, 0x2A, 0x28, 0xB9, 0x18,
+  0xFB, 0x33, 0xBC, 0x87, 0x29, 0xAA, 0x23, 0xC0, 0x81, 0x2B, 0x81, 0x48, 0xA1, 0x78, 0xB0, 0x40,
+  0x99, 0xA1, 0x59, 0x88, 0xBD, 0x03, 0x1C, 0x9A, 0x80, 0x80, 0x80, 0x00, 0x09, 0x77, 0x83, 0x00,
+  0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0xF3, 0xDF, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x70, 0x87,
+  0x30, 0x27, 0x12, 0x80, 0x00, 0xBB, 0xBC, 0xBC, 0xBE, 0xBC, 0xBA, 0x9A, 0x9B, 0x00, 0x60, 0x56,
+  0x44, 0x43, 0x23, 0x81, 0xA9, 0xAA, 0xDB, 0xCC, 0xBB, 0xBB, 0xAB, 0x09, 0x18, 0x22, 0x21, 0x53,
+  0x55, 0x25, 0x33, 0x24, 0x01, 0x99, 0xAA, 0xCA, 0xCC, 0xBB, 0xBB, 0xBB, 0xAB, 0x19, 0x12, 0x33,
+  0x25, 0x43, 0x34, 0x36, 0xFF, 0xFF, 0x35, 0x00, 0x24, 0x34, 0x22, 0x91, 0xBA, 0xDB, 0xBB, 0xCD,
+  0xBB, 0xAA, 0xAB, 0xBA, 0x21, 0x31, 0x32, 0x47, 0x22, 0x44, 0x43, 0x24, 0x24, 0x81, 0x98, 0xCA,
+  0xCB, 0xCB, 0xAB, 0xBA, 0xAC, 0xAA, 0x80, 0x30, 0x43, 0x53, 0x43, 0x43, 0x53, 0x43, 0x13, 0x81,
+  0x98, 0xDB, 0xBC, 0xBB, 0xBB, 0xBA, 0xCB, 0x9C, 0x88, 0x28, 0x32, 0x34, 0x24, 0x44, 0x34, 0x35,
+  0x33, 0x12, 0xA8, 0xDA, 0xDB, 0xCB, 0xAA, 0xAA, 0xBA, 0xBA, 0xAA, 0x22, 0x42, 0x32, 0x45, 0x53,
+  0x34, 0x44, 0x13, 0x11, 0x99, 0xAB, 0xCC, 0xBC, 0xBA, 0xAB, 0xAC, 0x99, 0x08, 0x08, 0x42, 0x43,
+  0x31, 0x55, 0x34, 0x24, 0x22, 0x12, 0xAA, 0xAC, 0xCC, 0xAB, 0xBB, 0xBA, 0xAD, 0x18, 0xC9, 0x31,
+  0x08, 0x43, 0x52, 0x23, 0x65, 0x43, 0x81, 0x80, 0xA0, 0xCA, 0xCB, 0xA9, 0x9D, 0xA9, 0x09, 0x99,
+  0x8A, 0x21, 0x12, 0x29, 0x77, 0x23, 0x23, 0x24, 0x81, 0x16, 0x37, 0x00, 0x80, 0x99, 0xA9, 0xCC,
+  0xBC, 0xAA, 0xAB, 0x0A, 0xD9, 0x8A, 0x80, 0x20, 0x30, 0x47, 0x25, 0x43, 0x23, 0x00, 0x99, 0xAA,
+  0xBB, 0xBF, 0xBA, 0xA9, 0x9A, 0xA8, 0xAC, 0x9B, 0x50, 0x12, 0x47, 0x43, 0x33, 0x24, 0x98, 0x9A,
+  0xB8, 0x0B, 0xFC, 0x8A, 0xAA, 0x88, 0x90, 0xAD, 0x89, 0x32, 0x55, 0x33, 0x35, 0x11, 0x00, 0x98,
+  0xAB, 0xB9, 0xAD, 0xBB, 0xBC, 0x99, 0xBB, 0xCA, 0xBA, 0x71, 0x45, 0x25, 0x22, 0x11, 0x88, 0xBB,
+  0x9B, 0x99, 0xC8, 0xCD, 0x9C, 0x08, 0x80, 0xBA, 0x9C, 0x72, 0x45, 0x22, 0x00, 0x80, 0xA9, 0xAA,
+  0x9A, 0x00, 0xEA, 0xBC, 0x9A, 0x08, 0xA8, 0xAC, 0x30, 0x77, 0x24, 0x01, 0x90, 0xA9, 0xA9, 0x89,
+  0x80, 0xA8, 0xBE, 0x9B, 0x09, 0x88, 0xB9, 0x19, 0x77, 0x26, 0x01, 0x98, 0xA9, 0x8A, 0x08, 0x80,
+  0xA0, 0xDB, 0xAA, 0x1A, 0x80, 0xCA, 0x29, 0x77, 0x15, 0x81, 0xA8, 0xB9, 0x45, 0x00, 0x40, 0x00,
+  0x98, 0x11, 0x11, 0xA8, 0xDC, 0x9A, 0x08, 0x00, 0x89, 0x58, 0x57, 0x13, 0x90, 0xBA, 0x9D, 0x28,
+  0x22, 0x81, 0xEB, 0xAC, 0x28, 0x01, 0x90, 0x99, 0x75, 0x33, 0x81, 0xCA, 0xBB, 0x10, 0x42, 0x01,
+  0xDA, 0xBC, 0x09, 0x12, 0x81, 0x9A, 0x71, 0x45, 0x81, 0xA9, 0xAA, 0x19, 0x42, 0x01, 0xDA, 0xCB,
+  0x8A, 0x21, 0x10, 0x88, 0x50, 0x36, 0x02, 0xB8, 0xDA, 0x0A, 0x42, 0x22, 0xEA, 0xBC, 0x0A, 0x31,
+  0x82, 0xB9, 0x68, 0x35, 0x01, 0xAA, 0xAA, 0x28, 0x34, 0x81, 0xCE, 0xAB, 0x09, 0x12, 0x90, 0xB9,
+  0x74, 0x25, 0x88, 0xA9, 0x99, 0x21, 0x16, 0xA0, 0xAE, 0x9A, 0x21, 0x01, 0xCB, 0x19, 0x37, 0x02,
+  0x99, 0x19, 0x98, 0x20, 0x15, 0xD1, 0xBC, 0x8B, 0x31, 0x91, 0xBA, 0x7A, 0x25, 0x81, 0x98, 0x81,
+  0x9B, 0x60, 0x22, 0xEA, 0xCB, 0x08, 0x23, 0xB8, 0xAB, 0x65, 0x12, 0x99, 0x19, 0x91, 0x89, 0x43,
+  0xF4, 0x1A, 0x3F, 0x00, 0x92, 0xCF, 0x9A, 0x31, 0x81, 0xAC, 0x48, 0x26, 0x98, 0x0A, 0x23, 0xB9,
+  0x0B, 0x45, 0xA0, 0xBE, 0x1A, 0x22, 0xA8, 0x9B, 0x46, 0x82, 0xA9, 0x31, 0xA0, 0x8C, 0x73, 0x91,
+  0xBD, 0x0A, 0x13, 0xA8, 0x9B, 0x72, 0x04, 0xA9, 0x38, 0x83, 0xAC, 0x40, 0x13, 0xEC, 0x99, 0x01,
+  0x80, 0x0A, 0x28, 0x16, 0x90, 0x18, 0x03, 0xBC, 0x40, 0x24, 0xDB, 0xAB, 0x10, 0x98, 0x0A, 0x01,
+  0x36, 0x83, 0x89, 0x33, 0xFA, 0x2A, 0x36, 0xD0, 0xBB, 0x08, 0x81, 0x89, 0xA2, 0x61, 0x33, 0x98,
+  0x18, 0xD1, 0x09, 0x55, 0xA0, 0xBC, 0x8A, 0x01, 0x99, 0x01, 0x58, 0x34, 0x90, 0x29, 0xA4, 0x8D,
+  0x63, 0x91, 0xCC, 0x08, 0xA8, 0x18, 0x01, 0x3B, 0x46, 0x98, 0x18, 0xA3, 0x8C, 0x63, 0xB2, 0xAC,
+  0x09, 0xAA, 0x80, 0x84, 0x2C, 0x45, 0xA8, 0x18, 0x05, 0xAC, 0x51, 0xA2, 0xAB, 0x08, 0xBA, 0x2A,
+  0x86, 0x0A, 0x44, 0xA0, 0xA1, 0x04, 0x44, 0x00, 0x29, 0x83, 0x8E, 0x52, 0xA0, 0xAA, 0x88, 0x9C,
+  0x20, 0xA1, 0x5B, 0x25, 0xB9, 0x41, 0xA2, 0x8E, 0x43, 0xB0, 0x8B, 0xA0, 0xAC, 0x32, 0xE2, 0x49,
+  0x22, 0xAA, 0x43, 0xD0, 0x2A, 0x24, 0xB9, 0x0A, 0xC9, 0x8C, 0x22, 0xD1, 0x40, 0x12, 0x9B, 0x44,
+  0xD8, 0x29, 0x14, 0xAA, 0x08, 0xF9, 0x19, 0x01, 0xB8, 0x52, 0x91, 0x1A, 0x25, 0xDA, 0x48, 0x92,
+  0x99, 0x81, 0xDB, 0x2A, 0x02, 0xB9, 0x35, 0xA1, 0x4A, 0x04, 0xBC, 0x52, 0x91, 0x0A, 0xB1, 0xAE,
+  0x11, 0x08, 0x89, 0x25, 0xA8, 0x40, 0x83, 0x9E, 0x42, 0x98, 0x18, 0xC8, 0x9D, 0x20, 0x88, 0x08,
+  0x14, 0xA8, 0x62, 0x91, 0x0D, 0x22, 0x98, 0x11, 0xFB, 0x0B, 0x08, 0x10, 0x89, 0x23, 0x81, 0x62,
+  0xA3, 0x8F, 0x22, 0x88, 0x01, 0xFA, 0x8B, 0x80, 0x10, 0x90, 0x13, 0x81, 0x44, 0x83, 0x9E, 0x41,
+  0x88, 0x00, 0xF8, 0x8C, 0x00, 0x08, 0x91, 0x02, 0x5D, 0xF1, 0x3F, 0x00, 0x82, 0x72, 0x81, 0x9B,
+  0x31, 0xA1, 0x20, 0xF9, 0x8F, 0x80, 0x00, 0x90, 0x21, 0x81, 0x68, 0x12, 0xBA, 0x30, 0x80, 0x10,
+  0xE9, 0xAD, 0x80, 0x09, 0x11, 0x19, 0x22, 0x92, 0x36, 0x92, 0x29, 0x23, 0xA0, 0x1A, 0xFF, 0x8A,
+  0x88, 0x19, 0x90, 0x19, 0x84, 0x48, 0x23, 0x32, 0x32, 0x16, 0x9A, 0xB8, 0xCE, 0xA9, 0x9B, 0x99,
+  0xCA, 0x38, 0x13, 0x71, 0x27, 0x01, 0x12, 0x90, 0x99, 0xBA, 0xCD, 0x8B, 0xBA, 0xA9, 0x9B, 0x25,
+  0x31, 0x57, 0x02, 0x20, 0x01, 0x89, 0xAA, 0xEB, 0x9C, 0xA9, 0x9B, 0xB9, 0x48, 0x32, 0x55, 0x23,
+  0x02, 0x33, 0x98, 0xA9, 0xFB, 0xBB, 0xBA, 0xAD, 0xAA, 0x98, 0x43, 0x43, 0x45, 0x22, 0x21, 0x82,
+  0x88, 0xC9, 0xBC, 0xDB, 0xAB, 0xBA, 0xBA, 0x40, 0x23, 0x56, 0x23, 0x21, 0x23, 0x88, 0x91, 0x9F,
+  0xD9, 0x9A, 0xBA, 0xAA, 0x1A, 0x32, 0x53, 0x45, 0x13, 0x32, 0x83, 0x08, 0x30, 0x1D, 0x35, 0x00,
+  0xA9, 0xCE, 0xAA, 0xBC, 0xAA, 0x9B, 0x18, 0x24, 0x73, 0x24, 0x12, 0x32, 0x91, 0x80, 0xDB, 0xCB,
+  0xAC, 0xBA, 0xBB, 0xAA, 0x42, 0x41, 0x54, 0x24, 0x11, 0x13, 0x08, 0xA8, 0xAE, 0xBB, 0xBB, 0xBC,
+  0xBB, 0x0A, 0x25, 0x51, 0x34, 0x24, 0x21, 0x83, 0x18, 0xEB, 0xAA, 0xCC, 0xA9, 0xCA, 0x89, 0x29,
+  0x22, 0x54, 0x33, 0x05, 0x31, 0x80, 0x80, 0xBD, 0xC9, 0xAC, 0xB8, 0xAB, 0xB9, 0x61, 0x11, 0x35,
+  0x33, 0x04, 0x22, 0x90, 0xA8, 0xCD, 0xBA, 0xBB, 0xBB, 0x9D, 0x9A, 0x44, 0x31, 0x45, 0x32, 0x01,
+  0x22, 0x90, 0xD9, 0xAC, 0xCB, 0xA9, 0xBB, 0xBA, 0x2B, 0x27, 0x43, 0x43, 0x23, 0x12, 0x12, 0x98,
+  0xDC, 0x9C, 0xBA, 0x9C, 0xBA, 0xA9, 0x49, 0x25, 0x52, 0x23, 0x23, 0x11, 0x02, 0xC8, 0xCC, 0xBB,
+  0xCA, 0xBB, 0xBA, 0xAB, 0x72, 0x23, 0x35, 0x33, 0x13, 0x12, 0x11, 0xEB, 0xBC, 0xBB, 0xAC, 0xCB,
+  0xF0, 0xEB, 0x38, 0x00, 0xAA, 0x99, 0x62, 0x43, 0x43, 0x22, 0x13, 0x01, 0x92, 0xCC, 0xBC, 0xBB,
+  0xAC, 0xCA, 0x9A, 0x89, 0x44, 0x43, 0x24, 0x33, 0x21, 0x10, 0x91, 0xCD, 0xAC, 0xBA, 0xBB, 0xBB,
+  0xAB, 0x09, 0x47, 0x33, 0x34, 0x33, 0x13, 0x11, 0xA1, 0xBF, 0xBB, 0xAC, 0xAC, 0xBB, 0x99, 0x3B,
+  0x27, 0x42, 0x24, 0x33, 0x12, 0x01, 0xB0, 0xCC, 0xBC, 0xD8, 0x8C, 0xB8, 0x99, 0x10, 0x33, 0x35,
+  0x45, 0x22, 0x10, 0x21, 0xA8, 0xAD, 0xC9, 0xCB, 0x9B, 0xAA, 0xAA, 0x3B, 0x27, 0x33, 0x35, 0x24,
+  0x81, 0x10, 0x88, 0xFB, 0x89, 0xCB, 0xA9, 0x9C, 0x88, 0x09, 0x23, 0x63, 0x44, 0x12, 0x12, 0x08,
+  0x10, 0xFB, 0x89, 0xAC, 0xBA, 0x9B, 0x98, 0x9B, 0x24, 0x34, 0x64, 0x22, 0x22, 0x01, 0x89, 0xC8,
+  0xAC, 0xDB, 0x9B, 0xA9, 0xAD, 0x89, 0x33, 0x42, 0x44, 0x33, 0x13, 0x12, 0x81, 0xBB, 0xCF, 0x99,
+  0xBB, 0xBA, 0xCB, 0xAB, 0x22, 0xE2, 0x32, 0x00, 0x41, 0x53, 0x42, 0x43, 0x33, 0x12, 0x01, 0xA9,
+  0xEA, 0xAC, 0xBA, 0xBB, 0xCA, 0x9B, 0x0A, 0x52, 0x53, 0x34, 0x24, 0x32, 0x11, 0x11, 0xBB, 0xAD,
+  0xAC, 0xBC, 0xAB, 0xDA, 0x99, 0x10, 0x42, 0x43, 0x34, 0x43, 0x33, 0x21, 0xA0, 0xA0, 0xCD, 0xBB,
+  0xBD, 0xAB, 0xAA, 0x99, 0x80, 0x43, 0x34, 0x44, 0x44, 0x22, 0x21, 0x08, 0xA8, 0xAC, 0xCC, 0xAB,
+  0xBA, 0xBB, 0xB9, 0x0A, 0x42, 0x61, 0x43, 0x33, 0x25, 0x22, 0x01, 0x90, 0xAC, 0xDB, 0xCB, 0xBA,
+  0xAA, 0x0A, 0x08, 0x90, 0x63, 0x42, 0x22, 0x34, 0x14, 0x31, 0x80, 0xD0, 0x89, 0xCC, 0x99, 0x8B,
+  0x9C, 0x80, 0x80, 0x80, 0x38, 0x07, 0x48, 0x83, 0x49, 0x87, 0x4D, 0xD2, 0x38, 0xA9, 0x01, 0x08,
+  0xA8, 0xA8, 0x68, 0x91, 0xFB, 0x38, 0x01, 0xA0, 0x28, 0x03, 0x9B, 0x40, 0x81, 0xC0, 0x0A, 0x82,
+  0x0A, 0x08, 0xF8, 0x0A, 0x08, 0x80, 0x80, 0x08, 0xB7, 0xFD, 0x20, 0x00, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0x80, 0x90, 0x01, 0xFF, 0xAF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x49, 0x1E, 0x77, 0x57, 0x80, 0x08, 0x08, 0xA8, 0x12,
+  0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x10, 0x7F, 0x37, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0x08, 0x08, 0x08, 0x88, 0xC2, 0x72, 0xD7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF7, 0xFF, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7A,
+  0x07, 0x80, 0x80, 0x80, 0x80, 0xA0, 0xAF, 0x80, 0x80, 0x78, 0x82, 0xD1, 0x49, 0x0B, 0xA4, 0x10,
+  0x3C, 0xC8, 0x84, 0x39, 0xD8, 0x01, 0x5B, 0xB8, 0x12, 0x8A, 0x83, 0x2C, 0x04, 0xFF, 0x27, 0x00,
+  0x2C, 0xD3, 0x22, 0x0D, 0xB2, 0x32, 0x0E, 0x83, 0xA8, 0x12, 0xF0, 0x51, 0x8C, 0x12, 0x1C, 0xF4,
+  0x12, 0x2C, 0xA0, 0x11, 0x8A, 0x92, 0x28, 0x8B, 0xD7, 0x12, 0x4D, 0xF1, 0x52, 0x1F, 0xB1, 0x02,
+  0x4B, 0xA8, 0x92, 0x90, 0x21, 0x2B, 0xBA, 0xA7, 0x20, 0x2B, 0x90, 0xD2, 0x30, 0x89, 0xA8, 0x02,
+  0x0A, 0x94, 0xB1, 0x69, 0x3D, 0xA9, 0xA4, 0x81, 0x38, 0x9A, 0xA4, 0xD1, 0x91, 0x40, 0x5A, 0x2E,
+  0xA8, 0xA4, 0x01, 0x98, 0x80, 0x92, 0x80, 0x09, 0x3C, 0x80, 0x09, 0xF3, 0x03, 0x5D, 0x0A, 0x91,
+  0x00, 0x89, 0x82, 0x2A, 0xA2, 0xA0, 0xB2, 0x97, 0x5C, 0xA8, 0x80, 0x21, 0xC8, 0x21, 0x29, 0x4B,
+  0x1A, 0xE9, 0x83, 0x80, 0x28, 0x1A, 0x6A, 0x2B, 0x10, 0xB0, 0xC3, 0x91, 0x96, 0x10, 0x2E, 0xB1,
+  0x01, 0x38, 0xA9, 0x49, 0x3B, 0x1D, 0xF5, 0xA2, 0x82, 0x39, 0xC9, 0x96, 0x08, 0x80, 0x29, 0x3F,
+  0xD1, 0x03, 0x3D, 0x00, 0x88, 0x98, 0x84, 0x8A, 0x92, 0x80, 0x08, 0xA9, 0x84, 0xE8, 0x12, 0x89,
+  0x12, 0x0F, 0x92, 0xA1, 0x01, 0x88, 0x1C, 0xA2, 0x42, 0x1F, 0xA0, 0xA3, 0x13, 0x8F, 0x92, 0x93,
+  0x4F, 0x99, 0x91, 0x38, 0x2B, 0x98, 0x03, 0x8A, 0x2B, 0xE4, 0x10, 0xA8, 0xC6, 0x11, 0x39, 0x9C,
+  0xA5, 0x28, 0xB1, 0x11, 0x1C, 0xE2, 0x31, 0x2C, 0xB0, 0x02, 0x89, 0x02, 0x81, 0x3F, 0xD1, 0xA4,
+  0x10, 0xB8, 0x33, 0x2F, 0x09, 0xA1, 0xB2, 0x41, 0xC9, 0x84, 0x3A, 0x2C, 0x09, 0xC3, 0xA3, 0x81,
+  0xD1, 0x42, 0xBA, 0x12, 0x6B, 0x4B, 0xA8, 0x39, 0x00, 0xC9, 0x95, 0x2A, 0xB1, 0x50, 0x0B, 0xA0,
+  0xA3, 0xD2, 0xA2, 0x04, 0x2E, 0x29, 0xA0, 0xB3, 0x6D, 0x8A, 0xA3, 0xB1, 0x61, 0x2E, 0x89, 0xA3,
+  0x1A, 0x01, 0xA8, 0xA3, 0x81, 0x5D, 0x09, 0x29, 0xA9, 0xE4, 0x92, 0x81, 0x3C, 0x91, 0x2A, 0xD5,
+  0x01, 0x3B, 0xC9, 0xA3, 0x00, 0xF9, 0x35, 0x00, 0x03, 0x08, 0x18, 0x2D, 0x89, 0x11, 0x1B, 0x93,
+  0x0D, 0xA4, 0x4C, 0xD0, 0x93, 0x30, 0x3D, 0xD8, 0x03, 0x9A, 0x03, 0x5C, 0xC8, 0x04, 0x3C, 0x8A,
+  0xB4, 0x30, 0x2C, 0xA0, 0x92, 0x18, 0x0A, 0xC4, 0x82, 0x79, 0x2B, 0x98, 0x92, 0x88, 0xC4, 0x02,
+  0x5B, 0x2C, 0x90, 0x08, 0xD4, 0x82, 0x18, 0x09, 0x28, 0xA0, 0x4A, 0x3C, 0xF2, 0xB5, 0x20, 0x2C,
+  0x09, 0xA1, 0x81, 0x80, 0x80, 0x80, 0x01, 0x18, 0xAC, 0x87, 0x28, 0x7B, 0x3C, 0xC8, 0xB5, 0x81,
+  0x4A, 0x1C, 0xA0, 0xB2, 0x11, 0x1B, 0xB0, 0x96, 0x20, 0x5A, 0x09, 0x82, 0x92, 0x20, 0xA9, 0x9A,
+  0x2C, 0xCF, 0x91, 0xB9, 0x1A, 0x2C, 0x2C, 0x80, 0x07, 0x43, 0x40, 0x11, 0x81, 0x81, 0x8B, 0xAF,
+  0xF8, 0x88, 0x1C, 0xA9, 0xA1, 0x01, 0x50, 0x11, 0x24, 0x43, 0x21, 0x20, 0xA0, 0xC8, 0xCB, 0xAE,
+  0x9A, 0x8C, 0xA9, 0xA1, 0x21, 0x7A, 0x22, 0x04, 0x97, 0xFD, 0x3C, 0x00, 0x16, 0x21, 0x28, 0x88,
+  0xC8, 0xBA, 0xCC, 0xA9, 0x8B, 0x8B, 0xC1, 0x12, 0x79, 0x22, 0x05, 0x15, 0x11, 0x28, 0x89, 0xD9,
+  0xC8, 0xAA, 0xAA, 0x9A, 0x89, 0xB8, 0x95, 0x71, 0x30, 0x13, 0x15, 0x12, 0x11, 0x0A, 0x9D, 0xEA,
+  0xC8, 0xA8, 0x1A, 0x1C, 0xB0, 0xA4, 0x71, 0x39, 0x11, 0x04, 0x02, 0x00, 0x89, 0xAB, 0xCC, 0xAB,
+  0xBB, 0xA9, 0x1A, 0x8A, 0xB5, 0x74, 0x48, 0x02, 0x05, 0x01, 0x10, 0x9A, 0xC9, 0xAA, 0x9D, 0xBA,
+  0x88, 0x3B, 0xAB, 0xB7, 0x34, 0x79, 0x10, 0x83, 0x12, 0x39, 0xAA, 0xF0, 0xA8, 0x8C, 0xA9, 0xA0,
+  0x19, 0x8A, 0xC5, 0x24, 0x68, 0x10, 0x83, 0x02, 0x10, 0x8A, 0xEA, 0xB8, 0x8C, 0xAA, 0xB0, 0x38,
+  0x1D, 0xC2, 0x15, 0x68, 0x10, 0x83, 0x12, 0x28, 0x9A, 0xE8, 0xB8, 0x8D, 0x9A, 0x98, 0x19, 0x8A,
+  0x82, 0x73, 0x40, 0x13, 0x06, 0x11, 0x18, 0x99, 0xD8, 0xB9, 0xBB, 0xAB, 0x0C, 0xEB, 0x3A, 0x00,
+  0x0B, 0xAB, 0xC5, 0x12, 0x7B, 0x11, 0x86, 0x23, 0x38, 0x18, 0xB0, 0xB8, 0xAD, 0xCC, 0xA8, 0x1B,
+  0xB9, 0xA3, 0x69, 0x3A, 0x95, 0x06, 0x41, 0x18, 0x81, 0x81, 0x9A, 0xBB, 0xCC, 0xAA, 0xBA, 0xA1,
+  0x4A, 0x1C, 0xB3, 0x27, 0x58, 0x21, 0x12, 0x11, 0x91, 0xA9, 0xFA, 0x9A, 0x0F, 0xA9, 0x91, 0x09,
+  0x90, 0x11, 0x70, 0x38, 0x22, 0x05, 0x12, 0x00, 0x98, 0xDA, 0xBA, 0xBC, 0xAA, 0xAA, 0x91, 0x4A,
+  0x3A, 0x91, 0x47, 0x51, 0x31, 0x22, 0x30, 0x98, 0xE0, 0xA9, 0x9F, 0xA9, 0xA8, 0x29, 0x1C, 0xD2,
+  0x03, 0x79, 0x80, 0x04, 0x31, 0x08, 0xA3, 0x18, 0xAD, 0xD8, 0x99, 0x9B, 0xC0, 0x10, 0x1A, 0xA1,
+  0x04, 0x43, 0x42, 0x34, 0x22, 0x02, 0xB1, 0xA8, 0xBF, 0xCC, 0xA9, 0x8A, 0x99, 0x01, 0x2A, 0x19,
+  0x33, 0x27, 0x45, 0x32, 0x22, 0x10, 0xD0, 0xB8, 0x9E, 0xCB, 0x99, 0x9A, 0x80, 0x18, 0x98, 0x42,
+  0xEA, 0xE4, 0x38, 0x00, 0x7A, 0x02, 0x35, 0x22, 0x04, 0x39, 0xCB, 0xE1, 0x8A, 0xAC, 0xA0, 0x1A,
+  0x98, 0x92, 0x08, 0x31, 0x7A, 0x05, 0x34, 0x30, 0x93, 0x38, 0xAD, 0xD8, 0x9B, 0xBB, 0xA8, 0x3A,
+  0x99, 0xA4, 0x18, 0x58, 0x39, 0x27, 0x72, 0x10, 0x83, 0x08, 0xC8, 0xA9, 0xAC, 0xBA, 0x8A, 0x99,
+  0x01, 0x09, 0x81, 0x22, 0x27, 0x63, 0x42, 0x11, 0x15, 0x09, 0x91, 0x99, 0xFA, 0x0B, 0xAC, 0x80,
+  0x89, 0x98, 0x0B, 0xA0, 0x21, 0x15, 0x61, 0x13, 0x43, 0x42, 0x11, 0x02, 0x08, 0xBC, 0xEB, 0xBB,
+  0xBB, 0x9C, 0xA8, 0x89, 0xA0, 0x5B, 0x00, 0x05, 0x25, 0x41, 0x52, 0x22, 0x22, 0x81, 0x99, 0xAF,
+  0xDA, 0x9A, 0x8B, 0x9A, 0xA8, 0x19, 0x8A, 0x81, 0x61, 0x50, 0x24, 0x53, 0x24, 0x21, 0x11, 0xA0,
+  0xDA, 0xCB, 0x9E, 0xB9, 0x98, 0x99, 0x88, 0x80, 0x18, 0x84, 0x14, 0x73, 0x31, 0x43, 0x23, 0x13,
+  0x83, 0x8B, 0xCE, 0xEA, 0x94, 0x05, 0x42, 0x00, 0x9A, 0x9B, 0x9A, 0x98, 0x90, 0x83, 0x69, 0x01,
+  0x03, 0x36, 0x42, 0x42, 0x14, 0x10, 0x81, 0x9B, 0xFB, 0xBB, 0xBB, 0x9D, 0x98, 0x90, 0x10, 0x00,
+  0x22, 0x83, 0x17, 0x34, 0x52, 0x42, 0x13, 0x01, 0x80, 0xCC, 0xD9, 0xBB, 0xAC, 0x9A, 0x99, 0x00,
+  0x20, 0x28, 0x22, 0x14, 0x43, 0x71, 0x33, 0x53, 0x24, 0x01, 0x08, 0xDB, 0xCA, 0xDB, 0xAB, 0xAA,
+  0x89, 0x00, 0x10, 0x13, 0x31, 0x22, 0x22, 0x17, 0x26, 0x43, 0x52, 0x02, 0x91, 0x88, 0xAE, 0xDA,
+  0xCA, 0x9A, 0x99, 0x19, 0x81, 0x22, 0x02, 0x60, 0x00, 0x10, 0x85, 0x33, 0x35, 0x52, 0x02, 0x80,
+  0xB0, 0xAF, 0xD9, 0xBA, 0x9A, 0x8A, 0x00, 0x21, 0x22, 0x12, 0x21, 0x00, 0x51, 0x83, 0x77, 0x11,
+  0x41, 0x02, 0x08, 0xA0, 0xAE, 0xC9, 0xBB, 0x8B, 0xAA, 0x20, 0x11, 0x32, 0x02, 0x7A, 0xA3, 0x59,
+  0x95, 0x48, 0x03, 0x40, 0x06, 0x88, 0x00, 0xBC, 0xEF, 0x15, 0x3F, 0x00, 0xA9, 0xBC, 0x9A, 0xA0,
+  0x10, 0x81, 0x11, 0xAB, 0x10, 0x98, 0x43, 0x43, 0x37, 0x72, 0x16, 0x20, 0x03, 0xBC, 0x99, 0xBD,
+  0x00, 0xA9, 0x80, 0xAB, 0x89, 0xAB, 0x22, 0xB8, 0x65, 0x11, 0x38, 0xA1, 0x79, 0x09, 0x47, 0x01,
+  0x43, 0xC8, 0xAB, 0xC9, 0x19, 0x81, 0x89, 0xC9, 0x9B, 0x88, 0x29, 0x14, 0x28, 0x05, 0x0A, 0x83,
+  0xAC, 0x17, 0x70, 0x13, 0x10, 0x94, 0xBD, 0x89, 0x8A, 0x33, 0xB8, 0xBB, 0xCD, 0x09, 0x02, 0x42,
+  0x08, 0xB0, 0x02, 0x2B, 0x31, 0x9A, 0x57, 0x70, 0x02, 0x10, 0x93, 0xAD, 0x9A, 0x09, 0x83, 0xC1,
+  0xAD, 0x8D, 0x80, 0x03, 0x21, 0x8B, 0x20, 0xB8, 0x71, 0xA8, 0x02, 0x72, 0x29, 0x87, 0x01, 0x21,
+  0xBB, 0xBA, 0xB8, 0x50, 0xA0, 0xDB, 0xBA, 0x0A, 0x24, 0x39, 0xB1, 0x99, 0x42, 0x82, 0x2B, 0xF2,
+  0x10, 0x37, 0x4A, 0x84, 0x00, 0x12, 0xCC, 0x99, 0xA9, 0x22, 0xA8, 0xAF, 0x22, 0xEE, 0x41, 0x00,
+  0xD9, 0x10, 0x30, 0x88, 0xB2, 0x28, 0x49, 0x81, 0x80, 0x8A, 0x52, 0x25, 0x49, 0x06, 0x18, 0x23,
+  0xEC, 0x89, 0x98, 0x20, 0xA8, 0xBD, 0x9A, 0x39, 0x12, 0x11, 0x98, 0xAB, 0x47, 0x09, 0x28, 0xB8,
+  0x42, 0x78, 0xA0, 0x17, 0x00, 0x40, 0xB8, 0xBB, 0x88, 0x1A, 0x84, 0xDB, 0xBB, 0x2B, 0x12, 0x84,
+  0x12, 0x8E, 0x11, 0x92, 0x84, 0x2A, 0x1C, 0x85, 0x03, 0x7B, 0x05, 0x08, 0x13, 0xBD, 0x89, 0xA0,
+  0x39, 0xB1, 0xAD, 0xB9, 0x1A, 0x85, 0x30, 0x81, 0x9C, 0x25, 0xB9, 0x32, 0x9B, 0x41, 0x92, 0x84,
+  0x78, 0x07, 0x80, 0x11, 0xBC, 0x0A, 0xA8, 0x21, 0xB0, 0xAF, 0x99, 0x00, 0x31, 0x00, 0x91, 0xA9,
+  0x51, 0x80, 0x08, 0xA3, 0x7A, 0x81, 0x02, 0x74, 0x14, 0x88, 0x13, 0xBE, 0x8A, 0xA8, 0x30, 0xB0,
+  0xAF, 0x99, 0x09, 0x22, 0x12, 0x90, 0xA8, 0x11, 0x50, 0x29, 0xE4, 0x50, 0x09, 0x82, 0x55, 0x01,
+  0x73, 0x21, 0x41, 0x00, 0x08, 0x02, 0xEB, 0x8A, 0xB8, 0x28, 0xB2, 0xBD, 0xA8, 0x99, 0x51, 0x11,
+  0x80, 0x98, 0x22, 0x89, 0x23, 0xA1, 0x79, 0x05, 0x20, 0x72, 0x16, 0x88, 0x22, 0xF8, 0x9A, 0x88,
+  0x0A, 0x02, 0xEB, 0x89, 0x98, 0x10, 0x12, 0x10, 0x89, 0x12, 0x91, 0x69, 0xA0, 0x42, 0x91, 0x72,
+  0x12, 0x27, 0x01, 0x29, 0xE1, 0xAC, 0x80, 0x9A, 0x11, 0xF9, 0x0A, 0x90, 0x89, 0x24, 0x0A, 0x93,
+  0x90, 0x70, 0xB8, 0x10, 0x11, 0x19, 0x52, 0x91, 0x56, 0x11, 0x19, 0x91, 0xCE, 0x08, 0xA9, 0x18,
+  0xA0, 0x9D, 0x98, 0x88, 0x31, 0x20, 0x90, 0x81, 0x05, 0x29, 0xB8, 0x31, 0x33, 0x71, 0x15, 0x50,
+  0x26, 0x98, 0x41, 0xD9, 0x8C, 0x90, 0xA9, 0x00, 0xB8, 0x9C, 0x08, 0x91, 0x40, 0x01, 0x08, 0x15,
+  0x09, 0x11, 0x9C, 0x07, 0x20, 0x58, 0x91, 0x45, 0x10, 0x09, 0x93, 0xCD, 0x8A, 0xA8, 0x9A, 0x00,
+  0xDA, 0x0A, 0x91, 0x80, 0x0E, 0xE7, 0x36, 0x00, 0x53, 0x99, 0x22, 0x16, 0x9A, 0x11, 0x98, 0x41,
+  0x44, 0x11, 0x52, 0x33, 0x01, 0x21, 0xFC, 0xAC, 0x98, 0xB9, 0x18, 0xCA, 0x9C, 0x18, 0x80, 0x30,
+  0x01, 0x08, 0x64, 0x81, 0x19, 0x98, 0x38, 0x37, 0x10, 0x33, 0x43, 0x44, 0x03, 0xA9, 0xDD, 0xBB,
+  0x8A, 0xC9, 0x99, 0xBA, 0x9C, 0x10, 0x02, 0x0C, 0x05, 0x12, 0x51, 0xA1, 0x89, 0x40, 0x24, 0x21,
+  0x11, 0x25, 0x72, 0x13, 0x90, 0xBA, 0xCC, 0xAA, 0xBA, 0xAB, 0xCB, 0xBC, 0x89, 0x08, 0x12, 0x2A,
+  0x44, 0x23, 0x35, 0xA0, 0x30, 0x43, 0x47, 0x98, 0x41, 0x12, 0x31, 0x07, 0x89, 0x80, 0xFA, 0xAA,
+  0x09, 0xB9, 0x8A, 0xB0, 0xAF, 0x20, 0x81, 0x09, 0x23, 0x48, 0x21, 0x96, 0x30, 0x28, 0x04, 0x14,
+  0x31, 0x41, 0x03, 0x93, 0x31, 0xCD, 0xBC, 0xDB, 0x9B, 0x8A, 0xCA, 0xC9, 0x8A, 0x29, 0xB0, 0x21,
+  0x35, 0x39, 0x25, 0x00, 0x38, 0x34, 0x55, 0x81, 0x67, 0x0C, 0x36, 0x00, 0x01, 0x11, 0x23, 0x44,
+  0xB0, 0xBD, 0xA9, 0x9E, 0x9A, 0xDA, 0x0A, 0xB8, 0x9E, 0x13, 0xCA, 0x20, 0x42, 0xA1, 0x01, 0x31,
+  0x49, 0x37, 0x91, 0x1C, 0x42, 0x81, 0x88, 0x10, 0x89, 0x83, 0xFA, 0x0B, 0xF0, 0x8A, 0x28, 0xBC,
+  0x08, 0xB9, 0x30, 0x99, 0x0A, 0x17, 0x39, 0x22, 0x03, 0x60, 0x06, 0x1A, 0x43, 0xD1, 0x28, 0x82,
+  0x8C, 0x24, 0xB9, 0x29, 0xC8, 0x9D, 0x12, 0xCB, 0x1A, 0xD1, 0x9C, 0x42, 0xC0, 0x30, 0xA0, 0x1D,
+  0x17, 0x99, 0x40, 0xA1, 0x09, 0x04, 0x98, 0x28, 0x81, 0x98, 0x11, 0x29, 0xDC, 0x81, 0x80, 0x9F,
+  0x01, 0xD9, 0x19, 0x93, 0xAD, 0x22, 0x9A, 0x42, 0x90, 0x91, 0x79, 0x02, 0xB1, 0x69, 0xA1, 0x38,
+  0x95, 0x9C, 0x22, 0xA0, 0x28, 0x98, 0xBD, 0x21, 0x01, 0xDF, 0x10, 0x98, 0x28, 0xD0, 0x8A, 0x33,
+  0x8C, 0x13, 0xC0, 0x58, 0x81, 0x28, 0x04, 0xA0, 0x5B, 0xA2, 0x10, 0x30, 0x2D, 0x0C, 0x34, 0x00,
+  0xDA, 0x2D, 0x04, 0xA9, 0x8A, 0x09, 0x80, 0xCB, 0x23, 0xCF, 0x39, 0xA5, 0x0D, 0x21, 0xA0, 0x31,
+  0xAA, 0x40, 0x06, 0x98, 0x10, 0x80, 0x01, 0x81, 0x80, 0x81, 0x70, 0xFB, 0x30, 0xB2, 0x8B, 0x82,
+  0xAE, 0x42, 0xBA, 0x9A, 0x83, 0x6B, 0xC2, 0x09, 0x29, 0x05, 0x10, 0x10, 0xCA, 0x63, 0x91, 0x39,
+  0xC0, 0x10, 0x00, 0x1A, 0x87, 0x9C, 0x13, 0xCD, 0x41, 0xC0, 0x9A, 0x41, 0xB8, 0x09, 0x80, 0x08,
+  0x01, 0x12, 0x9A, 0x48, 0x17, 0x2B, 0xA4, 0x3B, 0x14, 0xC9, 0x21, 0x90, 0x1C, 0x84, 0xC8, 0x2A,
+  0xD8, 0x21, 0xC0, 0xAC, 0x18, 0xA0, 0x30, 0xEB, 0x00, 0x09, 0x26, 0x99, 0x60, 0xA1, 0x18, 0x04,
+  0x88, 0x31, 0xF0, 0x29, 0x23, 0x9B, 0xF1, 0x38, 0x91, 0xBC, 0x33, 0xCE, 0x50, 0xD0, 0x19, 0x01,
+  0x0A, 0x81, 0x98, 0x72, 0x90, 0x08, 0x80, 0x58, 0x82, 0xA9, 0x31, 0xCA, 0x32, 0xC0, 0x40, 0x9B,
+  0xA8, 0x07, 0x3A, 0x00, 0x90, 0xC5, 0x1E, 0x01, 0xB8, 0x5A, 0xC0, 0x9A, 0x34, 0xAA, 0x22, 0xB0,
+  0x68, 0x02, 0x1C, 0x03, 0x99, 0x43, 0x0A, 0xA9, 0x81, 0x52, 0xD0, 0x3B, 0xF3, 0x8A, 0x52, 0xEB,
+  0x10, 0x98, 0x19, 0xB3, 0x2A, 0x8A, 0x26, 0x91, 0x1D, 0x13, 0x09, 0x86, 0x9A, 0x30, 0xA0, 0x14,
+  0xBB, 0x39, 0xA5, 0x9B, 0xB6, 0x0E, 0x12, 0xBB, 0x02, 0x9B, 0x3A, 0xE5, 0x20, 0x00, 0x29, 0xB4,
+  0x2A, 0x34, 0xA1, 0x29, 0xA8, 0x50, 0x28, 0xC5, 0x09, 0x09, 0xA8, 0x81, 0xC8, 0x8F, 0xA0, 0x08,
+  0x2B, 0xA2, 0xBC, 0x73, 0xA1, 0x38, 0x20, 0x17, 0x1B, 0x48, 0xA0, 0x20, 0x13, 0x9D, 0x21, 0x04,
+  0xCC, 0x88, 0xB8, 0x29, 0xF2, 0x2B, 0xC8, 0x1A, 0x04, 0x89, 0xA2, 0x5B, 0x35, 0xA8, 0x38, 0xA1,
+  0x32, 0x85, 0x0F, 0x03, 0x81, 0x08, 0xDA, 0x19, 0xB3, 0x9D, 0x08, 0x9C, 0xA0, 0x18, 0x0B, 0x85,
+  0x30, 0x2B, 0xB3, 0x37, 0x40, 0x02, 0x3C, 0x00, 0x28, 0xC4, 0x39, 0x12, 0xB1, 0x41, 0x19, 0x53,
+  0xE1, 0xBA, 0x8A, 0x89, 0xB8, 0xFA, 0x19, 0xAA, 0x80, 0x17, 0x9C, 0x50, 0x93, 0x28, 0xB9, 0x41,
+  0x22, 0x99, 0x04, 0x1B, 0x36, 0xA9, 0x11, 0xF9, 0x2C, 0xB0, 0x8B, 0x95, 0x9E, 0x20, 0xA0, 0x20,
+  0xA8, 0x20, 0x42, 0x09, 0xA6, 0x39, 0x03, 0x9C, 0x34, 0x9A, 0x44, 0x90, 0x21, 0xFA, 0x8A, 0xB0,
+  0x40, 0xB0, 0xBF, 0x12, 0x09, 0x30, 0xF1, 0x18, 0x30, 0x91, 0x82, 0x9A, 0x42, 0x12, 0x0B, 0x86,
+  0x29, 0x44, 0xB9, 0x11, 0xFB, 0x0A, 0x91, 0x9B, 0x03, 0xAE, 0x2A, 0xA3, 0x40, 0x00, 0xCB, 0x14,
+  0x58, 0x92, 0xBB, 0x53, 0x00, 0x28, 0x11, 0x32, 0x26, 0x90, 0xCE, 0x09, 0xA0, 0x19, 0xC1, 0xBF,
+  0x11, 0x00, 0x80, 0x81, 0x08, 0x2A, 0x16, 0xA8, 0x29, 0x38, 0x04, 0xB1, 0x30, 0x70, 0x37, 0xA9,
+  0x30, 0xF9, 0x8B, 0x82, 0x8A, 0xA2, 0xAF, 0x18, 0x53, 0xDF, 0x42, 0x00, 0x10, 0x11, 0xB3, 0x0F,
+  0x21, 0x08, 0x20, 0xF3, 0x3B, 0x83, 0x08, 0x33, 0x40, 0x12, 0xC0, 0x10, 0xAE, 0x88, 0xD8, 0x0A,
+  0x90, 0xAC, 0x38, 0x9A, 0x53, 0xA3, 0x2B, 0x05, 0x8B, 0x43, 0x90, 0x29, 0x83, 0x88, 0x37, 0x72,
+  0x03, 0xB9, 0x50, 0xE8, 0x9B, 0x00, 0x80, 0xA9, 0xBD, 0x1A, 0x63, 0x80, 0x89, 0x92, 0x39, 0x33,
+  0xB0, 0xA1, 0x2D, 0x34, 0x88, 0x40, 0x40, 0x47, 0x80, 0x8A, 0xB9, 0x8C, 0x80, 0x0A, 0xE9, 0xAC,
+  0x09, 0x10, 0x34, 0xC9, 0x81, 0x10, 0x79, 0xB3, 0x09, 0x19, 0x01, 0x23, 0xD9, 0x71, 0x10, 0x25,
+  0x90, 0xAB, 0x98, 0xAD, 0x10, 0x90, 0xAC, 0xFB, 0x1A, 0x32, 0x01, 0x91, 0x9D, 0x32, 0x01, 0x12,
+  0xAB, 0xAA, 0x66, 0x81, 0x89, 0x52, 0x0A, 0x47, 0xA9, 0x29, 0xC1, 0x9C, 0x11, 0xA9, 0x00, 0xEA,
+  0x1A, 0x11, 0x11, 0x91, 0x98, 0x78, 0x81, 0x88, 0x11, 0x0C, 0x32, 0xA2, 0x63, 0x02, 0x37, 0x00,
+  0x31, 0x1A, 0x25, 0x27, 0x02, 0xBB, 0x88, 0xDE, 0x09, 0x81, 0x99, 0xE9, 0x8C, 0x31, 0x81, 0x12,
+  0xB9, 0x6A, 0x14, 0x9A, 0x22, 0xAD, 0x73, 0x98, 0x29, 0x91, 0x38, 0x22, 0x00, 0x02, 0xB9, 0xEF,
+  0x89, 0x01, 0x88, 0xBA, 0xBE, 0x41, 0x81, 0x00, 0x92, 0x2D, 0x84, 0x80, 0x30, 0xAC, 0x31, 0x84,
+  0x1A, 0x81, 0x2B, 0x57, 0x89, 0x31, 0xB0, 0xAA, 0xEC, 0x2A, 0x02, 0xCB, 0xB9, 0x9B, 0x70, 0x81,
+  0x82, 0x9A, 0x50, 0x11, 0x98, 0x83, 0x8D, 0x44, 0xA8, 0x10, 0xA1, 0x78, 0x93, 0x29, 0x12, 0xAA,
+  0xCA, 0xBE, 0x30, 0x98, 0xCA, 0xE9, 0x29, 0x11, 0x08, 0x84, 0x1A, 0x22, 0x98, 0x35, 0xD8, 0x48,
+  0xA2, 0x38, 0xB4, 0x2B, 0x45, 0xC9, 0x45, 0xB8, 0x19, 0xB3, 0x9F, 0x11, 0x9A, 0x00, 0xD8, 0x0A,
+  0x12, 0x08, 0x03, 0xA9, 0x30, 0x23, 0x83, 0xF3, 0x3E, 0x22, 0xC0, 0x23, 0x9C, 0x40, 0xB4, 0x52,
+  0xB4, 0x22, 0x41, 0x00, 0x90, 0x0E, 0x92, 0xAB, 0x20, 0xD9, 0x08, 0xB1, 0x0B, 0x11, 0xA0, 0x44,
+  0x88, 0x1B, 0x85, 0x28, 0x80, 0x98, 0x11, 0x24, 0x10, 0xBA, 0x53, 0x83, 0x78, 0x87, 0xB9, 0x21,
+  0xDB, 0x8C, 0xA2, 0x89, 0x00, 0x9F, 0x08, 0x82, 0x20, 0x10, 0x11, 0xB0, 0x87, 0x19, 0x48, 0x99,
+  0x06, 0x98, 0x3A, 0x88, 0x15, 0x92, 0x79, 0x91, 0x9A, 0x01, 0xAF, 0x80, 0xB8, 0x28, 0xA8, 0xAC,
+  0x08, 0x25, 0x20, 0x10, 0xE1, 0x48, 0x01, 0x18, 0xC2, 0x38, 0x1A, 0x52, 0xD1, 0x40, 0x80, 0x10,
+  0x25, 0xA0, 0xBC, 0x20, 0xF9, 0x1C, 0xA0, 0x1A, 0xB2, 0x9D, 0x22, 0x10, 0x23, 0xC8, 0x58, 0xA2,
+  0x28, 0x84, 0xBC, 0x73, 0xA9, 0x31, 0xC0, 0x39, 0x13, 0x10, 0x01, 0x80, 0x00, 0xFA, 0xAE, 0x8A,
+  0x80, 0x09, 0xC9, 0x8D, 0x00, 0x21, 0x25, 0xA8, 0x29, 0x04, 0x59, 0xA1, 0x9B, 0x32, 0xB1, 0x70,
+  0xD3, 0x2B, 0x14, 0x39, 0xF4, 0x0C, 0x38, 0x00, 0x01, 0xA2, 0x09, 0xAC, 0xDC, 0xAA, 0x89, 0x09,
+  0xA8, 0xDD, 0x00, 0x51, 0x28, 0x94, 0x90, 0x69, 0x80, 0x01, 0x90, 0x8B, 0x43, 0x08, 0xB4, 0x89,
+  0x60, 0x22, 0x21, 0x02, 0xD9, 0x09, 0xBF, 0x9B, 0x00, 0x89, 0x9C, 0xB9, 0x88, 0x61, 0x35, 0x0A,
+  0x94, 0x88, 0x53, 0x08, 0x98, 0xA0, 0x48, 0x82, 0xA9, 0x08, 0x02, 0x71, 0x07, 0x20, 0xB0, 0x2A,
+  0xF8, 0xAC, 0x00, 0x88, 0x90, 0xBC, 0x08, 0x01, 0x45, 0x88, 0x10, 0xC2, 0x43, 0x2B, 0x82, 0xA8,
+  0x70, 0xC0, 0x28, 0xA0, 0x21, 0x08, 0x99, 0x02, 0x19, 0x14, 0xCC, 0x08, 0xFA, 0xAF, 0x08, 0x00,
+  0x32, 0xBA, 0xAA, 0x05, 0x51, 0x11, 0x88, 0xB0, 0x28, 0x19, 0x12, 0x9E, 0x14, 0x9A, 0x24, 0xD9,
+  0x28, 0xA8, 0x12, 0x80, 0x9B, 0xFA, 0x89, 0x30, 0x1B, 0x83, 0xCB, 0x40, 0x9A, 0x38, 0xF3, 0x30,
+  0xA1, 0x3C, 0xD1, 0x34, 0x28, 0x02, 0xB4, 0x62, 0x0B, 0x04, 0x30, 0x00, 0x00, 0x1C, 0xC2, 0xBB,
+  0x31, 0x9F, 0x02, 0xBA, 0x50, 0xAA, 0x43, 0x92, 0x61, 0x98, 0x00, 0x92, 0x28, 0x90, 0x9B, 0xBB,
+  0xD8, 0xB3, 0x3F, 0xC2, 0x28, 0x92, 0x28, 0x08, 0x08, 0x07, 0x08, 0x00, 0x42, 0x98, 0x3F, 0xC7,
+  0x60, 0x90, 0x29, 0xB2, 0x9E, 0x98, 0x09, 0x02, 0x99, 0x90, 0x8A, 0x23, 0x02, 0x63, 0x02, 0x20,
+  0xA1, 0x0B, 0xC8, 0x2A, 0x85, 0x00, 0xCA, 0xBB, 0x90, 0x3C, 0x92, 0x00, 0x88, 0xD1, 0x0F, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0xA1, 0x75, 0x87, 0x8C, 0x85, 0x9B, 0x23, 0x8D,
+  0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x70, 0x84, 0x08, 0x08, 0x08, 0x88, 0x53, 0x8D, 0x00, 0xA1,
+  0x08, 0x80, 0x79, 0xC3, 0x05, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFB, 0x08, 0x90,
+  0x23, 0x4E, 0x83, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x90, 0xD2, 0x9F, 0x87, 0xAB, 0x15, 0x1A,
+  0x81, 0x08, 0x08, 0x08, 0xA0, 0xF0, 0x39, 0x8E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x79, 0x07,
+  0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0xC1, 0xDF, 0x80, 0x08, 0x80, 0x80, 0x08, 0x80,
+  0x08, 0x08, 0xA0, 0x77, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x9D, 0xF7, 0x8B, 0x02,
+  0x8A, 0x80, 0x90, 0x43, 0x3C, 0x43, 0xB1, 0x5C, 0xA1, 0x1B, 0x8A, 0xB8, 0x93, 0xF0, 0x23, 0x0C,
+  0x4A, 0xE4, 0x28, 0x80, 0x12, 0xBB, 0x07, 0x19, 0x00, 0x08, 0x08, 0x08, 0x08, 0x1B, 0xF3, 0x00,
+  0x9C, 0x8C, 0x20, 0xD1, 0x00, 0x08, 0x69, 0xA5, 0x81, 0x20, 0x0F, 0x82, 0x0A, 0xB8, 0x14, 0x48,
+  0x2C, 0x00, 0x27, 0x00, 0xA9, 0x13, 0xBA, 0x04, 0x90, 0x2E, 0xE3, 0x3B, 0xB4, 0x80, 0x8B, 0x80,
+  0x80, 0x80, 0x72, 0xE2, 0x82, 0x18, 0x11, 0x98, 0x09, 0x21, 0x8C, 0xD1, 0x1B, 0x17, 0x0B, 0xA3,
+  0x1D, 0x91, 0x88, 0x39, 0xE9, 0x12, 0x1C, 0xA3, 0x4B, 0x9A, 0x48, 0x87, 0x1A, 0x90, 0x90, 0x84,
+  0x1A, 0x92, 0x21, 0x1C, 0xA0, 0xB4, 0x31, 0x9F, 0x90, 0x10, 0xD4, 0x21, 0x1F, 0x92, 0x2B, 0x80,
+  0x88, 0x28, 0xDB, 0x30, 0x89, 0x82, 0x87, 0x21, 0x88, 0x80, 0x80, 0x00, 0xBD, 0x80, 0x3B, 0xF4,
+  0x00, 0x38, 0x0C, 0xB3, 0x80, 0x0F, 0xA4, 0x0B, 0x80, 0x18, 0x97, 0x69, 0x99, 0x10, 0x18, 0x83,
+  0x08, 0x08, 0x08, 0xE0, 0x8D, 0xA2, 0x0B, 0x90, 0x05, 0x1C, 0x24, 0x3B, 0x83, 0x00, 0x08, 0x08,
+  0x88, 0x00, 0x88, 0xF2, 0xBF, 0xC8, 0x32, 0x8D, 0x80, 0x00, 0x08, 0x88, 0x03, 0x24, 0x37, 0x0C,
+  0x83, 0x0A, 0x82, 0xC0, 0x90, 0xFF, 0x1E, 0x00, 0x50, 0x9E, 0x85, 0xB0, 0x49, 0x08, 0xC0, 0x11,
+  0x29, 0x1C, 0x21, 0xAC, 0xA2, 0x1C, 0x92, 0xA8, 0xA7, 0x48, 0xA2, 0x3F, 0x90, 0xB0, 0xA6, 0x49,
+  0x90, 0x3A, 0x91, 0x00, 0x08, 0x08, 0xA8, 0xF3, 0x59, 0xD0, 0x54, 0x1F, 0xB3, 0x0A, 0x02, 0x9D,
+  0x21, 0x02, 0x89, 0x18, 0x33, 0x9B, 0xB9, 0xB3, 0x22, 0xBF, 0x13, 0x89, 0x80, 0x80, 0x43, 0xC9,
+  0x80, 0x11, 0x5A, 0xCC, 0x12, 0x88, 0x80, 0x00, 0x8A, 0xD2, 0x30, 0xA0, 0x2E, 0xE1, 0x91, 0x0B,
+  0xA1, 0x09, 0x80, 0xA1, 0x5B, 0x90, 0xC9, 0xD2, 0x20, 0x3C, 0x02, 0xBE, 0x80, 0x49, 0x0C, 0x91,
+  0x89, 0x20, 0x42, 0xF9, 0x09, 0x41, 0xA2, 0x39, 0xAE, 0x42, 0xC9, 0x02, 0x8C, 0x85, 0x88, 0x10,
+  0x80, 0x23, 0x0A, 0x40, 0xC0, 0x00, 0x03, 0x89, 0x02, 0x7A, 0x91, 0x3A, 0xA3, 0x7F, 0xB0, 0x43,
+  0x9A, 0x20, 0x91, 0x12, 0x8C, 0x83, 0xBB, 0x26, 0xAB, 0x00, 0x22, 0x00, 0x28, 0x2D, 0x81, 0x79,
+  0xD0, 0x22, 0xD9, 0x53, 0xAB, 0x92, 0x01, 0x90, 0x19, 0x20, 0xCA, 0x50, 0xC1, 0x01, 0x4B, 0x8A,
+  0xC3, 0x38, 0xE1, 0x10, 0x10, 0x8D, 0x92, 0x29, 0x3B, 0xF0, 0x48, 0xAA, 0x21, 0x0B, 0x11, 0xFA,
+  0x12, 0xCA, 0x21, 0x99, 0x38, 0xD9, 0x29, 0x18, 0xC0, 0x2C, 0x98, 0x5A, 0xC9, 0x83, 0x89, 0x94,
+  0xBB, 0x91, 0x29, 0x07, 0xEA, 0x03, 0x5B, 0xC8, 0x58, 0xA9, 0x81, 0x38, 0xC3, 0x99, 0x48, 0x98,
+  0xB3, 0xC3, 0x68, 0xB1, 0x30, 0x1E, 0x20, 0xF0, 0x02, 0x81, 0x2B, 0xC2, 0x21, 0x2C, 0xA1, 0x21,
+  0x2C, 0x92, 0x28, 0xBA, 0x24, 0x15, 0xAB, 0xB7, 0x39, 0x93, 0x3F, 0x90, 0x48, 0x80, 0x9A, 0x84,
+  0x09, 0x21, 0xAD, 0x17, 0x0B, 0x18, 0x00, 0x5B, 0x00, 0x1D, 0xA2, 0x38, 0xD1, 0x39, 0xA8, 0x91,
+  0x19, 0x23, 0xAF, 0x87, 0x1D, 0x82, 0x98, 0x98, 0x10, 0xD6, 0x49, 0x99, 0xD2, 0xFE, 0x33, 0x00,
+  0x01, 0x08, 0xA8, 0x02, 0x2B, 0xF3, 0x39, 0xD1, 0x20, 0xC9, 0x12, 0x0B, 0x31, 0xBB, 0x03, 0x3B,
+  0xF9, 0x22, 0x0C, 0x12, 0x9F, 0x84, 0x2A, 0x98, 0x89, 0x83, 0x88, 0xB4, 0x1F, 0xA5, 0x2A, 0x02,
+  0x0C, 0x81, 0xA0, 0x20, 0x3C, 0xE3, 0x38, 0x9B, 0x16, 0x0C, 0x01, 0x1B, 0x83, 0x9A, 0x03, 0x2B,
+  0x85, 0x0A, 0x93, 0x0D, 0x86, 0x09, 0x3A, 0x82, 0x1C, 0xB6, 0x30, 0xA0, 0x58, 0xF2, 0x38, 0xC8,
+  0x21, 0x91, 0x0A, 0x83, 0x6B, 0xD0, 0x82, 0x6A, 0x98, 0x18, 0x88, 0xA0, 0x22, 0xAA, 0x97, 0x2B,
+  0x96, 0x1A, 0x09, 0xC1, 0x58, 0xC1, 0x38, 0xB9, 0x84, 0x88, 0x91, 0x00, 0x1D, 0x81, 0x90, 0x19,
+  0x1F, 0xA4, 0x4B, 0xB1, 0x19, 0xB1, 0x28, 0xA2, 0x9C, 0x23, 0xCA, 0x33, 0xCF, 0x14, 0x8B, 0x18,
+  0x08, 0x98, 0x31, 0x9F, 0x95, 0x3D, 0xA1, 0x29, 0xB1, 0x00, 0x09, 0xC1, 0x30, 0xB9, 0x07, 0x0F,
+  0x8D, 0xFA, 0x32, 0x00, 0xA3, 0x81, 0x1A, 0xB2, 0x18, 0x31, 0xFB, 0x03, 0xA8, 0x20, 0xB2, 0x28,
+  0xF2, 0x33, 0x8D, 0x20, 0xA8, 0x42, 0xBA, 0x52, 0xAB, 0x94, 0x20, 0x89, 0xB5, 0x69, 0xE4, 0x10,
+  0x90, 0x80, 0x20, 0x98, 0x00, 0x00, 0x39, 0xB1, 0x30, 0xF7, 0x30, 0xA8, 0x00, 0x02, 0x0D, 0x94,
+  0x89, 0x83, 0x3E, 0x88, 0x00, 0x02, 0x1F, 0xB1, 0x03, 0x99, 0x00, 0x9C, 0x07, 0x8A, 0x48, 0xD0,
+  0x38, 0x89, 0x18, 0x80, 0x8B, 0x01, 0x6B, 0x9A, 0x90, 0xA3, 0xD4, 0x4D, 0xB2, 0x4B, 0x08, 0xD0,
+  0x31, 0x3D, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr struct
+{
+  uint32_t offset;
+  uint32_t bytes;
+  uint32_t samples;
+}
+clip_index[NUM_CLIPS] =
+{
+  {0ul,2640ul,5098ul}, // zero
+  {2656ul,2244ul,4149ul}, // one
+  {4928ul,1980ul,3666ul}, // two
+  {6912ul,2112ul,4045ul}, // three
+  {9024ul,1980ul,3764ul}, // four
+  {11008ul,1848ul,3563ul}, // five
+  {12864ul,2772ul,5220ul}, // six
+  {15648ul,2376ul,4556ul}, // seven
+  {18048ul,1980ul,3742ul}, // eight
+  {20032ul,2508ul,4729ul}, // nine
+  {22560ul,1980ul,3780ul}, // ten
+  {24544ul,2508ul,4655ul}, // eleven
+  {27072ul,2244ul,4156ul}, // twelve
+  {29344ul,2640ul,5027ul}, // thirteen
+  {32000ul,2112ul,3907ul}, // fourteen
+  {34112ul,2508ul,4702ul}, // fifteen
+  {36640ul,1584ul,2986ul}, // point
+  {38240ul,3696ul,7019ul}, // megahertz
+  {41952ul,4488ul,8638ul}, // lsb
+  {46464ul,4224ul,8145ul}, // usb
+  {50688ul,4752ul,9018ul}, // cwl
+  {55456ul,4884ul,9414ul}, // cwu
+  {60352ul,3432ul,6455ul}, // step10
+  {63808ul,4884ul,9364ul}, // step100
+  {68704ul,4884ul,9371ul}  // step1000
+};
+
+#endif
@@ -0,0 +1,268 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Scanner with signal detect squelch
+//
+// The radio side tunes each channel (memories or steps through the
+// band) and says when the Si5351 writes have gone. Core 0 then lets
+// the I/Q settle for 5ms and measures 10ms of it: decimated by 8
+// (boxcar, about +/-2kHz either side of the LO), the power is the
+// variance of the decimated samples so the ADC offset and LO leakage
+// don't count. Nothing waits for the AGC or the audio filters, an
+// empty channel takes about 16ms.
+//
+// The noise floor follows the quietest channels (down at once, up
+// slowly). A channel squelch_db over the floor stops the scan, it
+// carries on once the channel has been quiet for hang_ms. The rate in
+// channels a second, not counting time stopped, is kept for reporting.
+
+#ifndef SCAN_H
+#define SCAN_H
+
+#include "hardware/sync.h"
+
+#define SCAN_DECIMATE 8u
+#define SCAN_SETTLE   (SAMPLERATE/200u)  // 5ms
+#define SCAN_BLOCKS   40u                // 10ms of decimated samples
+#define SCAN_K_FLOOR  0.05f
+#define SCAN_RATE_MS  1000ul
+
+namespace SCAN
+{
+  struct radio_t
+  {
+    bool (*next)(void);   // tune the next channel, false if there isn't one
+    bool (*ready)(void);  // the tuning has been sent
+    void (*found)(void);  // stopped on a signal
+  };
+
+  // core 1 asks for a measurement by moving request on,
+  // core 0 sets done to the same when the power is ready
+  volatile static uint32_t request = 0;
+  volatile static uint32_t done = 0;
+  volatile static float power = 0.0f;
+
+  // core 0 detector state
+  static uint32_t current = 0;
+  static uint32_t n = 0;
+  static uint32_t count = 0;
+  static uint32_t blocks = 0;
+  static float acc_i = 0.0f;
+  static float acc_q = 0.0f;
+  static float sum_i = 0.0f;
+  static float sum_q = 0.0f;
+  static float sum_p = 0.0f;
+
+  // core 1 scanner state
+  static enum
+  {
+    STATE_IDLE,
+    STATE_TUNE,
+    STATE_READY,
+    STATE_MEASURE,
+    STATE_HOLD
+  } state = STATE_IDLE;
+  static const radio_t *radio = NULL;
+  static float squelch = 10.0f;
+  static uint32_t hang_ms = 0;
+  static float floor_power = 0.0f;
+  static uint32_t heard = 0;
+  static uint32_t channels = 0;
+  static uint32_t scan_ms = 0;
+  static uint32_t last_ms = 0;
+  static uint32_t channels_per_second = 0;
+
+  static void __not_in_flash_func(detect)(const float in_i,const float in_q)
+  {
+    // core 0, once per sample, nothing to do unless asked
+    const uint32_t r = request;
+    if (r==done)
+    {
+      return;
+    }
+    if (r!=current)
+    {
+      current = r;
+      n = 0;
+      count = 0;
+      blocks = 0;
+      acc_i = acc_q = 0.0f;
+      sum_i = sum_q = sum_p = 0.0f;
+    }
+    if (n<SCAN_SETTLE)
+    {
+      n++;
+      return;
+    }
+    acc_i += in_i;
+    acc_q += in_q;
+    if (++count<SCAN_DECIMATE)
+    {
+      return;
+    }
+    count = 0;
+    sum_i += acc_i;
+    sum_q += acc_q;
+    sum_p += acc_i * acc_i + acc_q * acc_q;
+    acc_i = acc_q = 0.0f;
+    if (++blocks<SCAN_BLOCKS)
+    {
+      return;
+    }
+    const float mean_i = sum_i / (float)SCAN_BLOCKS;
+    const float mean_q = sum_q / (float)SCAN_BLOCKS;
+    power = sum_p / (float)SCAN_BLOCKS - mean_i * mean_i - mean_q * mean_q;
+    __dmb();
+    done = current;
+  }
+
+  static void measure(void)
+  {
+    request = request + 1u;
+  }
+
+  static const bool measured(void)
+  {
+    return done==request;
+  }
+
+  static void init(const radio_t &r,const float squelch_db,const uint32_t hang)
+  {
+    // core 1
+    radio = &r;
+    squelch = powf(10.0f,squelch_db/10.0f);
+    hang_ms = hang;
+  }
+
+  static const bool active(void)
+  {
+    return state!=STATE_IDLE;
+  }
+
+  static void start(void)
+  {
+    // core 1, from the channel after the current one
+    channels = 0;
+    scan_ms = 0;
+    last_ms = millis();
+    state = STATE_TUNE;
+  }
+
+  static void stop(void)
+  {
+    // core 1, stays where it is
+    state = STATE_IDLE;
+  }
+
+  static const uint32_t rate(void)
+  {
+    // channels a second over the last second or so of scanning
+    return channels_per_second;
+  }
+
+  static void process(void)
+  {
+    // core 1 task, every millisecond
+    if (state==STATE_IDLE)
+    {
+      return;
+    }
+    const uint32_t now = millis();
+    if (state!=STATE_HOLD)
+    {
+      scan_ms += now - last_ms;
+      if (scan_ms>=SCAN_RATE_MS)
+      {
+        channels_per_second = (uint32_t)(((uint64_t)channels * 1000ul + scan_ms / 2u) / scan_ms);
+        channels = 0;
+        scan_ms = 0;
+      }
+    }
+    last_ms = now;
+    switch (state)
+    {
+      case STATE_IDLE:
+      {
+        break;
+      }
+      case STATE_TUNE:
+      {
+        if (!radio->next())
+        {
+          state = STATE_IDLE;
+          break;
+        }
+        channels++;
+        state = STATE_READY;
+        break;
+      }
+      case STATE_READY:
+      {
+        // measure once the Si5351 has the new frequency
+        if (radio->ready())
+        {
+          measure();
+          state = STATE_MEASURE;
+        }
+        break;
+      }
+      case STATE_MEASURE:
+      {
+        if (!measured())
+        {
+          break;
+        }
+        const float p = power;
+        if (floor_power>0.0f && p>floor_power*squelch)
+        {
+          // something there, stay and keep listening
+          heard = now;
+          measure();
+          state = STATE_HOLD;
+          radio->found();
+          break;
+        }
+        // the floor drops straight to a quieter channel, rises slowly
+        floor_power = (floor_power<=0.0f || p<floor_power)?p:floor_power + (p - floor_power) * SCAN_K_FLOOR;
+        state = STATE_TUNE;
+        break;
+      }
+      case STATE_HOLD:
+      {
+        if (!measured())
+        {
+          break;
+        }
+        if (power>floor_power*squelch)
+        {
+          heard = now;
+        }
+        if (now - heard>=hang_ms)
+        {
+          state = STATE_TUNE;
+          break;
+        }
+        measure();
+        break;
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,286 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Core 1 cooperative scheduler
+//
+// Tasks are periodic (every period_ms), events (run once when
+// triggered, now or after a delay) or polled (every pass). Timed tasks
+// sit on a wheel of 64 one millisecond slots, in the slot for their due
+// time, so each pass only looks at the slots for the milliseconds that
+// have gone by. Periodic tasks keep their rate, unless they fall a
+// whole period behind.
+//
+// Each task says whether it may run in RX, TX or both. The TX loops
+// call run(SCHED_TX) so the TX tasks carry on while transmitting; RX
+// only tasks that come due then wait until back in RX.
+//
+// Tasks due together run in the order they were added. run() may be
+// called again from inside a task (the TX loops do), so everything
+// due goes back on the wheel before any of it runs: the inner run
+// picks up whatever the outer one hasn't got to yet, and the outer one
+// skips anything the inner one has already run.
+//
+// Every run is timed: count, total and longest run and how many ran
+// more than a millisecond late. A task's time includes anything it
+// runs itself (the PTT task includes the whole transmission).
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#define SCHED_MAX_TASKS 16u // 12 with DEBUG_SCHED, room for more
+#define SCHED_SLOTS     64u
+#define SCHED_NONE      0xffu
+#define SCHED_RX        1u
+#define SCHED_TX        2u
+#define SCHED_POLL      4u  // every pass, not on the wheel
+
+namespace SCHED
+{
+  struct task_t
+  {
+    const char *name;
+    void (*run)(void);
+    uint32_t period_ms;   // 0 for an event
+    uint32_t flags;
+    uint32_t due;
+    uint8_t next;
+    bool queued;
+    uint32_t runs;
+    uint32_t late;
+    uint64_t total_us;
+    uint32_t max_us;
+  };
+
+  static task_t tasks[SCHED_MAX_TASKS];
+  static uint32_t num_tasks = 0;
+  static uint8_t slots[SCHED_SLOTS];
+  static uint32_t tick = 0;
+
+  static void link(const uint32_t id)
+  {
+    task_t &t = tasks[id];
+    uint8_t &head = slots[t.due & (SCHED_SLOTS - 1u)];
+    t.next = head;
+    head = (uint8_t)id;
+    t.queued = true;
+  }
+
+  static void unlink(const uint32_t id)
+  {
+    task_t &t = tasks[id];
+    if (!t.queued)
+    {
+      return;
+    }
+    uint8_t *p = &slots[t.due & (SCHED_SLOTS - 1u)];
+    while (*p!=SCHED_NONE && *p!=id)
+    {
+      p = &tasks[*p].next;
+    }
+    if (*p==id)
+    {
+      *p = t.next;
+    }
+    t.queued = false;
+  }
+
+  static void init(void)
+  {
+    num_tasks = 0;
+    memset(slots,SCHED_NONE,sizeof(slots));
+    tick = millis();
+  }
+
+  static const uint32_t add(const char *name,void (*run)(void),const uint32_t period_ms,const uint32_t flags)
+  {
+    // returns the task id, periodic tasks first run one period from now
+    if (num_tasks>=SCHED_MAX_TASKS)
+    {
+      return SCHED_NONE;
+    }
+    const uint32_t id = num_tasks++;
+    task_t &t = tasks[id];
+    memset(&t,0,sizeof(t));
+    t.name = name;
+    t.run = run;
+    t.period_ms = period_ms;
+    t.flags = flags;
+    t.next = SCHED_NONE;
+    if (period_ms>0 && !(flags & SCHED_POLL))
+    {
+      t.due = millis() + period_ms;
+      link(id);
+    }
+    return id;
+  }
+
+  static void trigger_after(const uint32_t id,const uint32_t ms)
+  {
+    // (re)schedule a task, replaces any earlier time
+    if (id>=num_tasks || (tasks[id].flags & SCHED_POLL))
+    {
+      return;
+    }
+    unlink(id);
+    tasks[id].due = millis() + ms;
+    link(id);
+  }
+
+  static void trigger(const uint32_t id)
+  {
+    trigger_after(id,0);
+  }
+
+  static void cancel(const uint32_t id)
+  {
+    if (id<num_tasks)
+    {
+      unlink(id);
+    }
+  }
+
+  static const bool pending(const uint32_t id)
+  {
+    return id<num_tasks && tasks[id].queued;
+  }
+
+  static void execute(const uint32_t id)
+  {
+    task_t &t = tasks[id];
+    const uint32_t start = time_us_32();
+    t.run();
+    const uint32_t us = time_us_32() - start;
+    t.runs++;
+    t.total_us += us;
+    t.max_us = max(t.max_us,us);
+  }
+
+  static void run(const uint32_t mask)
+  {
+    // core 1, as often as possible, mask is SCHED_RX or SCHED_TX
+    for (uint32_t id=0;id<num_tasks;id++)
+    {
+      if ((tasks[id].flags & SCHED_POLL) && (tasks[id].flags & mask))
+      {
+        execute(id);
+      }
+    }
+    // take everything due from the slots passed since last time,
+    // the current slot is looked at again for anything just triggered
+    const uint32_t now = millis();
+    const uint32_t passed = min(now - tick,SCHED_SLOTS - 1u);
+    tick = now;
+    uint8_t ready[SCHED_MAX_TASKS];
+    uint32_t num_ready = 0;
+    for (uint32_t n=0;n<=passed;n++)
+    {
+      uint8_t *p = &slots[(now - n) & (SCHED_SLOTS - 1u)];
+      while (*p!=SCHED_NONE)
+      {
+        task_t &t = tasks[*p];
+        if ((int32_t)(now - t.due)<0)
+        {
+          // a later turn of the wheel
+          p = &t.next;
+          continue;
+        }
+        ready[num_ready++] = *p;
+        t.queued = false;
+        *p = t.next;
+      }
+    }
+    // everything goes back on the wheel before any of them runs, a task
+    // may call run() itself (the TX loops) and that run has to find the
+    // rest; events go back as due now and come off again as they run
+    uint32_t due[SCHED_MAX_TASKS];
+    uint32_t num_run = 0;
+    for (uint32_t i=0;i<num_ready;i++)
+    {
+      const uint32_t id = ready[i];
+      task_t &t = tasks[id];
+      if (!(t.flags & mask))
+      {
+        // not now, look again next millisecond
+        t.due = now + 1u;
+        link(id);
+        continue;
+      }
+      if (now - t.due>1u)
+      {
+        t.late++;
+      }
+      if (t.period_ms>0)
+      {
+        // next time before running, the task may reschedule itself
+        t.due += t.period_ms;
+        if ((int32_t)(now - t.due)>=0)
+        {
+          t.due = now + t.period_ms;
+        }
+      }
+      else
+      {
+        t.due = now;
+      }
+      link(id);
+      // in the order they were added
+      uint32_t j = num_run++;
+      for (;j>0 && ready[j-1u]>id;j--)
+      {
+        ready[j] = ready[j-1u];
+        due[j] = due[j-1u];
+      }
+      ready[j] = (uint8_t)id;
+      due[j] = t.due;
+    }
+    for (uint32_t i=0;i<num_run;i++)
+    {
+      const uint32_t id = ready[i];
+      task_t &t = tasks[id];
+      if (!t.queued || t.due!=due[i])
+      {
+        // already run by a nested run(), cancelled or moved
+        continue;
+      }
+      if (t.period_ms==0)
+      {
+        unlink(id);
+      }
+      execute(id);
+    }
+  }
+
+  static const task_t &stats(const uint32_t id)
+  {
+    return tasks[min(id,num_tasks - 1u)];
+  }
+
+  static void clear_stats(void)
+  {
+    for (uint32_t id=0;id<num_tasks;id++)
+    {
+      tasks[id].runs = 0;
+      tasks[id].late = 0;
+      tasks[id].total_us = 0;
+      tasks[id].max_us = 0;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,325 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Persistent settings
+//
+// A log of 32 byte records in the last few sectors of flash (below the
+// EEPROM sector). Each record has a type and index (the key), a CRC
+// and a sequence number; the newest valid record for each key wins.
+// Records are appended round robin through the sectors so the wear is
+// spread evenly. The sector after the one being written is always kept
+// erased: before it is erased any live records in it are copied to the
+// current sector, so a power failure never loses a setting.
+//
+// Flash can't be read (XIP) while it is being written. Writes are
+// done on core 1, which asks core 0 to park in its SRAM loop (still
+// running the DSP) and disables its own interrupts for the duration.
+// Core 1 must not write while core 0 could touch flash (TX/RX change
+// or voice announce playing).
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#define SETTINGS_SECTORS            4u
+#define SETTINGS_RECORD_SIZE        32u
+#define SETTINGS_DATA_SIZE          24u
+#define SETTINGS_RECORDS_PER_SECTOR (FLASH_SECTOR_SIZE/SETTINGS_RECORD_SIZE)
+#define SETTINGS_RECORDS            (SETTINGS_SECTORS*SETTINGS_RECORDS_PER_SECTOR)
+#define SETTINGS_OFFSET             (PICO_FLASH_SIZE_BYTES-(SETTINGS_SECTORS+1u)*FLASH_SECTOR_SIZE)
+#define SETTINGS_MAX_KEYS           32u
+#define SETTINGS_ERASED             0xffu
+
+#define SETTINGS_TYPE_STATE         1u
+#define SETTINGS_TYPE_TCXO          2u
+#define SETTINGS_TYPE_MEMORY        3u
+
+namespace SETTINGS
+{
+  struct record_t
+  {
+    uint8_t type;
+    uint8_t index;
+    uint16_t crc;
+    uint32_t sequence;
+    uint8_t data[SETTINGS_DATA_SIZE];
+  };
+
+  static_assert(sizeof(record_t)==SETTINGS_RECORD_SIZE,"settings record size");
+  static_assert(FLASH_PAGE_SIZE%SETTINGS_RECORD_SIZE==0,"settings record alignment");
+
+  // newest record for each key
+  static struct
+  {
+    uint8_t type;
+    uint8_t index;
+    uint16_t slot;
+  }
+  live[SETTINGS_MAX_KEYS];
+  static uint32_t num_live = 0;
+  static uint32_t next_slot = 0;
+  static uint32_t next_sequence = 0;
+  static bool spare_blank = false;
+
+  // core 0/core 1 flash lockout handshake
+  volatile static bool flash_request = false;
+  volatile static bool flash_parked = false;
+
+  static const record_t *record(const uint32_t slot)
+  {
+    return (const record_t *)(XIP_BASE + SETTINGS_OFFSET + slot * SETTINGS_RECORD_SIZE);
+  }
+
+  static uint16_t crc16(const record_t *r)
+  {
+    // CRC-16/CCITT of everything except the CRC itself
+    const uint8_t *p = (const uint8_t *)r;
+    uint16_t crc = 0xffffu;
+    for (uint32_t i=0;i<SETTINGS_RECORD_SIZE;i++)
+    {
+      if (i==2u || i==3u)
+      {
+        continue;
+      }
+      crc ^= (uint16_t)p[i] << 8;
+      for (uint32_t b=0;b<8;b++)
+      {
+        crc = (crc & 0x8000u) ? (crc << 1) ^ 0x1021u : crc << 1;
+      }
+    }
+    return crc;
+  }
+
+  static bool valid(const record_t *r)
+  {
+    return r->type!=SETTINGS_ERASED && r->crc==crc16(r);
+  }
+
+  static uint32_t sector_of(const uint32_t slot)
+  {
+    return slot / SETTINGS_RECORDS_PER_SECTOR;
+  }
+
+  static uint32_t spare_sector(void)
+  {
+    return (sector_of(next_slot) + 1u) % SETTINGS_SECTORS;
+  }
+
+  static bool sector_blank(const uint32_t sector)
+  {
+    const uint32_t *p = (const uint32_t *)(XIP_BASE + SETTINGS_OFFSET + sector * FLASH_SECTOR_SIZE);
+    for (uint32_t i=0;i<FLASH_SECTOR_SIZE/4u;i++)
+    {
+      if (p[i]!=0xfffffffful)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static int32_t find(const uint8_t type,const uint8_t index)
+  {
+    for (uint32_t i=0;i<num_live;i++)
+    {
+      if (live[i].type==type && live[i].index==index)
+      {
+        return (int32_t)i;
+      }
+    }
+    return -1;
+  }
+
+  static void init(void)
+  {
+    // scan the log, a few ms
+    uint32_t newest = 0;
+    bool found = false;
+    num_live = 0;
+    next_sequence = 0;
+    for (uint32_t slot=0;slot<SETTINGS_RECORDS;slot++)
+    {
+      const record_t *r = record(slot);
+      if (!valid(r))
+      {
+        continue;
+      }
+      const int32_t n = find(r->type,r->index);
+      if (n<0)
+      {
+        if (num_live<SETTINGS_MAX_KEYS)
+        {
+          live[num_live].type = r->type;
+          live[num_live].index = r->index;
+          live[num_live].slot = slot;
+          num_live++;
+        }
+      }
+      else if ((int32_t)(r->sequence - record(live[n].slot)->sequence)>0)
+      {
+        live[n].slot = slot;
+      }
+      if (!found || (int32_t)(r->sequence - next_sequence)>=0)
+      {
+        newest = slot;
+        next_sequence = r->sequence + 1ul;
+        found = true;
+      }
+    }
+    next_slot = found ? (newest + 1u) % SETTINGS_RECORDS : 0;
+    spare_blank = sector_blank(spare_sector());
+  }
+
+  static bool read(const uint8_t type,const uint8_t index,void *data,const uint32_t size)
+  {
+    const int32_t n = find(type,index);
+    if (n<0)
+    {
+      return false;
+    }
+    memcpy(data,record(live[n].slot)->data,min(size,SETTINGS_DATA_SIZE));
+    return true;
+  }
+
+  static void __not_in_flash_func(park)(void (*process)(void))
+  {
+    // core 0, keep running the DSP from SRAM while core 1 writes flash
+    if (!flash_request)
+    {
+      return;
+    }
+    flash_parked = true;
+    while (flash_request)
+    {
+      process();
+    }
+    flash_parked = false;
+  }
+
+  static void __not_in_flash_func(lock)(uint32_t &ints)
+  {
+    // core 1
+    flash_request = true;
+    while (!flash_parked)
+    {
+      tight_loop_contents();
+    }
+    ints = save_and_disable_interrupts();
+  }
+
+  static void __not_in_flash_func(unlock)(const uint32_t ints)
+  {
+    restore_interrupts(ints);
+    flash_request = false;
+    while (flash_parked)
+    {
+      tight_loop_contents();
+    }
+  }
+
+  static void program(const uint32_t slot,const record_t &r)
+  {
+    // program one record, the rest of the page is left as is
+    static uint8_t page[FLASH_PAGE_SIZE];
+    const uint32_t offset = SETTINGS_OFFSET + slot * SETTINGS_RECORD_SIZE;
+    const uint32_t page_offset = offset & ~(FLASH_PAGE_SIZE - 1u);
+    memset(page,SETTINGS_ERASED,sizeof(page));
+    memcpy(page + (offset - page_offset),&r,sizeof(r));
+    uint32_t ints = 0;
+    lock(ints);
+    flash_range_program(page_offset,page,FLASH_PAGE_SIZE);
+    unlock(ints);
+  }
+
+  static void erase(const uint32_t sector)
+  {
+    uint32_t ints = 0;
+    lock(ints);
+    flash_range_erase(SETTINGS_OFFSET + sector * FLASH_SECTOR_SIZE,FLASH_SECTOR_SIZE);
+    unlock(ints);
+  }
+
+  static void append(const record_t &source)
+  {
+    record_t r = source;
+    r.sequence = next_sequence++;
+    r.crc = crc16(&r);
+    const uint32_t slot = next_slot;
+    program(slot,r);
+    const int32_t n = find(r.type,r.index);
+    if (n>=0)
+    {
+      live[n].slot = slot;
+    }
+    else if (num_live<SETTINGS_MAX_KEYS)
+    {
+      live[num_live].type = r.type;
+      live[num_live].index = r.index;
+      live[num_live].slot = slot;
+      num_live++;
+    }
+    next_slot = (next_slot + 1u) % SETTINGS_RECORDS;
+    if (next_slot % SETTINGS_RECORDS_PER_SECTOR==0)
+    {
+      // moved into the spare, the next sector has to be made blank
+      spare_blank = false;
+    }
+  }
+
+  static void prepare_spare(void)
+  {
+    // copy any live records out of the spare then erase it
+    if (spare_blank)
+    {
+      return;
+    }
+    const uint32_t spare = spare_sector();
+    for (uint32_t i=0;i<num_live;i++)
+    {
+      if (sector_of(live[i].slot)==spare && sector_of(next_slot)!=spare)
+      {
+        const record_t r = *record(live[i].slot);
+        append(r);
+      }
+    }
+    erase(spare);
+    spare_blank = true;
+  }
+
+  static bool write(const uint8_t type,const uint8_t index,const void *data,const uint32_t size)
+  {
+    // core 1, ~1ms per page program, ~50ms when a sector is erased
+    if (size>SETTINGS_DATA_SIZE || (num_live>=SETTINGS_MAX_KEYS && find(type,index)<0))
+    {
+      return false;
+    }
+    prepare_spare();
+    record_t r;
+    memset(&r,0,sizeof(r));
+    r.type = type;
+    r.index = index;
+    memcpy(r.data,data,size);
+    append(r);
+    return true;
+  }
+}
+
+#endif
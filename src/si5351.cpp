@@ -45,6 +45,17 @@ Si5351::Si5351(uint8_t i2c_addr):
 	plla_ref_osc = SI5351_PLL_INPUT_XO;
 	pllb_ref_osc = SI5351_PLL_INPUT_XO;
 	clkin_div = SI5351_CLKIN_DIV_1;
+	shadow_valid = false;
+	transport = NULL;
+	xfer_callback = NULL;
+	queue_head = 0;
+	queue_count = 0;
+	xfer_active = false;
+	for(uint8_t i = 0; i < SI5351_PLAN_CACHE_SIZE; i++)
+	{
+		plan[i].kind = SI5351_PLAN_EMPTY;
+	}
+	plan_clock = 0;
 }
 
 /*
@@ -82,6 +93,9 @@ bool Si5351::init(uint8_t xtal_load_c, uint32_t xo_freq, int32_t corr)
 			status_reg = si5351_read(SI5351_DEVICE_STATUS);
 		} while (status_reg >> 7 == 1);
 
+		// Copy the register map so read-modify-writes stay off the bus
+		shadow_load();
+
 		// Set crystal load capacitance
 		si5351_write(SI5351_CRYSTAL_LOAD, (xtal_load_c & SI5351_CRYSTAL_LOAD_MASK) | 0b00010010);
 
@@ -179,7 +193,9 @@ void Si5351::reset(void)
 		clk_freq[i] = 0;
 		output_enable((enum si5351_clock)i, 0);
 		clk_first_set[i] = false;
+		ms_int_div[i] = 0;
 	}
+	quadrature_valid = false;
 }
 
 /*
@@ -200,6 +216,15 @@ uint8_t Si5351::set_freq(uint64_t freq, enum si5351_clock clk)
 	uint8_t div_by_4 = 0;
 	uint8_t r_div = 0;
 
+	// Automatic tuning may move the PLL and the other clocks on it
+	for(uint8_t i = 0; i < 8; i++)
+	{
+		if(pll_assignment[i] == pll_assignment[clk])
+		{
+			ms_int_div[i] = 0;
+		}
+	}
+
 	// Check which Multisynth is being set
 	if((uint8_t)clk <= (uint8_t)SI5351_CLK5)
 	{
@@ -476,8 +501,6 @@ uint8_t Si5351::set_freq_manual(uint64_t freq, uint64_t pll_freq, enum si5351_cl
 
 	clk_freq[(uint8_t)clk] = freq;
 
-	set_pll(pll_freq, pll_assignment[clk]);
-
 	// Enable the output
 	output_enable(clk, 1);
 
@@ -487,6 +510,14 @@ uint8_t Si5351::set_freq_manual(uint64_t freq, uint64_t pll_freq, enum si5351_cl
 	// Calculate the synth parameters
 	multisynth_calc(freq, pll_freq, &ms_reg);
 
+	// Note a whole divider for set_freq_fast()
+	ms_int_div[(uint8_t)clk] = 0;
+	if(r_div == SI5351_OUTPUT_CLK_DIV_1 && freq > 0 && pll_freq % freq == 0 &&
+		pll_freq / freq <= SI5351_MULTISYNTH_A_MAX)
+	{
+		ms_int_div[(uint8_t)clk] = pll_freq / freq;
+	}
+
 	// If freq > 150 MHz, we need to use DIVBY4 and integer mode
 	if(freq >= SI5351_MULTISYNTH_DIVBY4_FREQ * SI5351_FREQ_MULT)
 	{
@@ -497,9 +528,131 @@ uint8_t Si5351::set_freq_manual(uint64_t freq, uint64_t pll_freq, enum si5351_cl
 	// Set multisynth registers (MS must be set before PLL)
 	set_ms(clk, ms_reg, int_mode, r_div, div_by_4);
 
+	// PLL last, only the bytes that changed
+	set_pll(pll_freq, pll_assignment[clk]);
+
     return 0;
 }
 
+/*
+ * set_freq_fast(uint64_t freq, uint16_t ms_div, enum si5351_pll target_pll)
+ *
+ * Retune every clock on a PLL by moving the PLL alone. The clocks
+ * must have been set by set_freq_manual() with the PLL a whole
+ * multiple (ms_div) of the output, which stays fixed. Only the PLL
+ * feedback registers are written (one short burst) and the PLL is
+ * not reset, so the phase offsets between the clocks are kept.
+ *
+ * freq - Output frequency in Hz * 100
+ * ms_div - The fixed multisynth divider
+ * target_pll - Which PLL to move
+ *     (use the si5351_pll enum)
+ *
+ * Returns 1 if the VCO would leave its range or a clock on the PLL
+ * is not on ms_div, use set_freq_manual() and pll_reset() then.
+ */
+uint8_t Si5351::set_freq_fast(uint64_t freq, uint16_t ms_div, enum si5351_pll target_pll)
+{
+	const uint64_t pll_freq = freq * ms_div;
+
+	if(pll_freq < SI5351_PLL_VCO_MIN * SI5351_FREQ_MULT || pll_freq > SI5351_PLL_VCO_MAX * SI5351_FREQ_MULT)
+	{
+		return 1;
+	}
+
+	uint8_t clocks = 0;
+	for(uint8_t i = 0; i < 8; i++)
+	{
+		if(pll_assignment[i] == target_pll && clk_freq[i] != 0)
+		{
+			if(ms_int_div[i] != ms_div)
+			{
+				return 1;
+			}
+			clocks++;
+		}
+	}
+	if(clocks == 0)
+	{
+		return 1;
+	}
+
+	set_pll(pll_freq, target_pll);
+
+	for(uint8_t i = 0; i < 8; i++)
+	{
+		if(pll_assignment[i] == target_pll && clk_freq[i] != 0)
+		{
+			clk_freq[i] = freq;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * set_freq_quadrature(uint64_t freq, uint16_t ms_div, enum si5351_clock clk_i, enum si5351_clock clk_q)
+ *
+ * Tune a quadrature pair: both clocks from one PLL at freq * ms_div,
+ * clk_q a quarter cycle behind clk_i. The offset only holds while
+ * both multisynths keep counting the same VCO edges, so:
+ *
+ *  - if only the PLL has to move, set_freq_fast(), no reset
+ *  - otherwise the multisynths are rewritten and the registers that
+ *    set their phase (parameters, control, offset) are compared with
+ *    before. Only if one changed is the PLL reset to realign them.
+ *
+ * What happened is counted in phase_stats.
+ *
+ * freq - Output frequency in Hz * 100
+ * ms_div - Multisynth divider, also the phase offset (max 127)
+ * clk_i, clk_q - The pair, on the same PLL, CLK0 to CLK5
+ *
+ * Returns 1 if the pair can't be set, otherwise 0.
+ */
+uint8_t Si5351::set_freq_quadrature(uint64_t freq, uint16_t ms_div, enum si5351_clock clk_i, enum si5351_clock clk_q)
+{
+	const enum si5351_pll pll = pll_assignment[clk_i];
+
+	if(pll != pll_assignment[clk_q] || clk_i > SI5351_CLK5 || clk_q > SI5351_CLK5 || ms_div > 127)
+	{
+		return 1;
+	}
+
+	if(quadrature_valid && set_freq_fast(freq, ms_div, pll) == 0)
+	{
+		phase_stats.fast++;
+		return 0;
+	}
+
+	uint8_t before[2 * SI5351_PHASE_REGS];
+	uint8_t after[2 * SI5351_PHASE_REGS];
+	phase_regs(clk_i, &before[0]);
+	phase_regs(clk_q, &before[SI5351_PHASE_REGS]);
+
+	const uint64_t pll_freq = freq * ms_div;
+	set_freq_manual(freq, pll_freq, clk_i);
+	set_freq_manual(freq, pll_freq, clk_q);
+	set_phase(clk_i, 0);
+	set_phase(clk_q, ms_div);
+
+	phase_regs(clk_i, &after[0]);
+	phase_regs(clk_q, &after[SI5351_PHASE_REGS]);
+
+	if(!quadrature_valid || memcmp(before, after, sizeof(before)) != 0)
+	{
+		pll_reset(pll);
+		quadrature_valid = true;
+		phase_stats.resets++;
+	}
+	else
+	{
+		phase_stats.full++;
+	}
+
+	return 0;
+}
+
 /*
  * set_pll(uint64_t pll_freq, enum si5351_pll target_pll)
  *
@@ -562,12 +715,12 @@ void Si5351::set_pll(uint64_t pll_freq, enum si5351_pll target_pll)
   // Write the parameters
   if(target_pll == SI5351_PLLA)
   {
-    si5351_write_bulk(SI5351_PLLA_PARAMETERS, i, params);
+    si5351_write_diff(SI5351_PLLA_PARAMETERS, i, params);
 		plla_freq = pll_freq;
   }
   else if(target_pll == SI5351_PLLB)
   {
-    si5351_write_bulk(SI5351_PLLB_PARAMETERS, i, params);
+    si5351_write_diff(SI5351_PLLB_PARAMETERS, i, params);
 		pllb_freq = pll_freq;
   }
 }
@@ -637,32 +790,32 @@ void Si5351::set_ms(enum si5351_clock clk, struct Si5351RegSet ms_reg, uint8_t i
 	switch(clk)
 	{
 		case SI5351_CLK0:
-			si5351_write_bulk(SI5351_CLK0_PARAMETERS, i, params);
+			si5351_write_diff(SI5351_CLK0_PARAMETERS, i, params);
 			set_int(clk, int_mode);
 			ms_div(clk, r_div, div_by_4);
 			break;
 		case SI5351_CLK1:
-			si5351_write_bulk(SI5351_CLK1_PARAMETERS, i, params);
+			si5351_write_diff(SI5351_CLK1_PARAMETERS, i, params);
 			set_int(clk, int_mode);
 			ms_div(clk, r_div, div_by_4);
 			break;
 		case SI5351_CLK2:
-			si5351_write_bulk(SI5351_CLK2_PARAMETERS, i, params);
+			si5351_write_diff(SI5351_CLK2_PARAMETERS, i, params);
 			set_int(clk, int_mode);
 			ms_div(clk, r_div, div_by_4);
 			break;
 		case SI5351_CLK3:
-			si5351_write_bulk(SI5351_CLK3_PARAMETERS, i, params);
+			si5351_write_diff(SI5351_CLK3_PARAMETERS, i, params);
 			set_int(clk, int_mode);
 			ms_div(clk, r_div, div_by_4);
 			break;
 		case SI5351_CLK4:
-			si5351_write_bulk(SI5351_CLK4_PARAMETERS, i, params);
+			si5351_write_diff(SI5351_CLK4_PARAMETERS, i, params);
 			set_int(clk, int_mode);
 			ms_div(clk, r_div, div_by_4);
 			break;
 		case SI5351_CLK5:
-			si5351_write_bulk(SI5351_CLK5_PARAMETERS, i, params);
+			si5351_write_diff(SI5351_CLK5_PARAMETERS, i, params);
 			set_int(clk, int_mode);
 			ms_div(clk, r_div, div_by_4);
 			break;
@@ -701,7 +854,7 @@ void Si5351::output_enable(enum si5351_clock clk, uint8_t enable)
     reg_val |= (1<<(uint8_t)clk);
   }
 
-  si5351_write(SI5351_OUTPUT_ENABLE_CTRL, reg_val);
+  si5351_write_diff(SI5351_OUTPUT_ENABLE_CTRL, 1, &reg_val);
 }
 
 /*
@@ -902,7 +1055,7 @@ void Si5351::set_int(enum si5351_clock clk, uint8_t enable)
 		reg_val &= ~(SI5351_CLK_INTEGER_MODE);
 	}
 
-	si5351_write(SI5351_CLK0_CTRL + (uint8_t)clk, reg_val);
+	si5351_write_diff(SI5351_CLK0_CTRL + (uint8_t)clk, 1, &reg_val);
 
 	// Integer mode indication
 	/*
@@ -1310,6 +1463,16 @@ void Si5351::set_ref_freq(uint32_t ref_freq, enum si5351_pll_input ref_osc)
 
 uint8_t Si5351::si5351_write_bulk(uint8_t addr, uint8_t bytes, uint8_t *data)
 {
+	for(int i = 0; i < bytes && addr + i < SI5351_SHADOW_SIZE; i++)
+	{
+		shadow[addr + i] = data[i];
+	}
+
+	if(transport != NULL && shadow_valid && addr + bytes <= SI5351_SHADOW_SIZE)
+	{
+		return queue_write(addr, bytes);
+	}
+
 	Wire.beginTransmission(i2c_bus_addr);
 	Wire.write(addr);
 	for(int i = 0; i < bytes; i++)
@@ -1322,16 +1485,169 @@ uint8_t Si5351::si5351_write_bulk(uint8_t addr, uint8_t bytes, uint8_t *data)
 
 uint8_t Si5351::si5351_write(uint8_t addr, uint8_t data)
 {
+	if(addr < SI5351_SHADOW_SIZE)
+	{
+		shadow[addr] = data;
+	}
+
+	if(transport != NULL && shadow_valid && addr < SI5351_SHADOW_SIZE)
+	{
+		return queue_write(addr, 1);
+	}
+
 	Wire.beginTransmission(i2c_bus_addr);
 	Wire.write(addr);
 	Wire.write(data);
 	return Wire.endTransmission();
 }
 
+/*
+ * set_transport(const struct Si5351Transport *t, void (*callback)(uint8_t, uint8_t))
+ *
+ * Send register writes through an asynchronous transport instead of
+ * Wire, after init(). Writes are queued and sent by poll(), which must
+ * be called often. Reads still use Wire, after the queue has emptied.
+ *
+ * t - The transport, NULL to go back to Wire
+ * callback - Called from poll() as each write finishes with the first
+ *   register and the status (0 ok), or NULL
+ */
+void Si5351::set_transport(const struct Si5351Transport *t, void (*callback)(uint8_t, uint8_t))
+{
+	flush();
+	transport = t;
+	xfer_callback = callback;
+}
+
+/*
+ * poll(void)
+ *
+ * Finish the write in progress and start the next one. Never waits.
+ */
+void Si5351::poll(void)
+{
+	if(transport == NULL)
+	{
+		return;
+	}
+
+	if(xfer_active)
+	{
+		const uint8_t status = transport->done();
+		if(status == SI5351_XFER_BUSY)
+		{
+			return;
+		}
+		const uint8_t reg = queue[queue_head].reg;
+		queue_head = (queue_head + 1) % SI5351_QUEUE_SIZE;
+		queue_count--;
+		xfer_active = false;
+		if(xfer_callback != NULL)
+		{
+			xfer_callback(reg, status);
+		}
+	}
+
+	if(queue_count > 0)
+	{
+		// The data comes from the shadow, so it is the latest
+		const struct Si5351Xfer *x = &queue[queue_head];
+		transport->start(i2c_bus_addr, x->reg, &shadow[x->reg], x->bytes);
+		xfer_active = true;
+	}
+}
+
+/*
+ * busy(void)
+ *
+ * Returns true while there are writes queued or in progress.
+ */
+bool Si5351::busy(void)
+{
+	return queue_count > 0;
+}
+
+/*
+ * flush(void)
+ *
+ * Wait for every queued write to finish.
+ */
+void Si5351::flush(void)
+{
+	while(transport != NULL && queue_count > 0)
+	{
+		poll();
+	}
+}
+
+/*
+ * si5351_write_diff(uint8_t addr, uint8_t bytes, uint8_t *data)
+ *
+ * Write a block of registers, sending only the bytes that differ
+ * from the shadow. Changed bytes separated by a short unchanged gap
+ * go in one transfer as a new transfer costs more than the gap. The
+ * runs go out in address order, so the last bytes of a block (the
+ * fractional part of a PLL or multisynth) land last.
+ *
+ */
+uint8_t Si5351::si5351_write_diff(uint8_t addr, uint8_t bytes, uint8_t *data)
+{
+	if(!shadow_valid || addr + bytes > SI5351_SHADOW_SIZE)
+	{
+		return si5351_write_bulk(addr, bytes, data);
+	}
+
+	uint8_t status = 0;
+	uint8_t i = 0;
+	while(i < bytes)
+	{
+		if(data[i] == shadow[addr + i])
+		{
+			i++;
+			continue;
+		}
+
+		// Extend the run over changes and short gaps
+		uint8_t last = i;
+		for(uint8_t end = i + 1; end < bytes && end - last <= SI5351_DIFF_GAP; end++)
+		{
+			if(data[end] != shadow[addr + end])
+			{
+				last = end;
+			}
+		}
+
+		status |= si5351_write_bulk(addr + i, last - i + 1, &data[i]);
+		i = last + 1;
+	}
+
+	return status;
+}
+
+/*
+ * si5351_read(uint8_t addr)
+ *
+ * Read a register from the shadow copy made at init(). The status
+ * registers change on their own so they always come from the device.
+ *
+ */
 uint8_t Si5351::si5351_read(uint8_t addr)
+{
+	if(shadow_valid && addr > SI5351_INTERRUPT_STATUS && addr < SI5351_SHADOW_SIZE)
+	{
+		return shadow[addr];
+	}
+
+	return si5351_read_bus(addr);
+}
+
+uint8_t Si5351::si5351_read_bus(uint8_t addr)
 {
 	uint8_t reg_val = 0;
 
+	// Queued writes go first
+	flush();
+
 	Wire.beginTransmission(i2c_bus_addr);
 	Wire.write(addr);
 	Wire.endTransmission();
@@ -1350,7 +1666,73 @@ uint8_t Si5351::si5351_read(uint8_t addr)
 /* Private functions */
 /*********************/
 
+/*
+ * pll_calc() and multisynth_calc() are pure functions of their
+ * arguments (and the reference frequency) but cost several software
+ * 64 bit divides each. The last few results are kept, keyed by all of
+ * the inputs, so repeated frequencies and memory recalls skip the
+ * arithmetic and a change of correction simply misses.
+ */
+struct Si5351Plan *Si5351::plan_find(enum si5351_plan_kind kind, uint64_t freq, uint64_t ref, int32_t correction)
+{
+	for(uint8_t i = 0; i < SI5351_PLAN_CACHE_SIZE; i++)
+	{
+		struct Si5351Plan *p = &plan[i];
+		if(p->kind == kind && p->freq == freq && p->ref == ref && p->correction == correction)
+		{
+			p->used = ++plan_clock;
+			return p;
+		}
+	}
+	return NULL;
+}
+
+struct Si5351Plan *Si5351::plan_store(enum si5351_plan_kind kind, uint64_t freq, uint64_t ref, int32_t correction)
+{
+	// Replace the least recently used
+	struct Si5351Plan *p = &plan[0];
+	for(uint8_t i = 1; i < SI5351_PLAN_CACHE_SIZE && p->kind != SI5351_PLAN_EMPTY; i++)
+	{
+		if(plan[i].kind == SI5351_PLAN_EMPTY || plan[i].used < p->used)
+		{
+			p = &plan[i];
+		}
+	}
+	p->kind = kind;
+	p->freq = freq;
+	p->ref = ref;
+	p->correction = correction;
+	p->used = ++plan_clock;
+	return p;
+}
+
 uint64_t Si5351::pll_calc(enum si5351_pll pll, uint64_t freq, struct Si5351RegSet *reg, int32_t correction, uint8_t vcxo)
+{
+	const enum si5351_plan_kind kind = vcxo ? SI5351_PLAN_PLL_VCXO : SI5351_PLAN_PLL;
+	const uint64_t ref = xtal_freq[(uint8_t)(pll == SI5351_PLLA ? plla_ref_osc : pllb_ref_osc)];
+	struct Si5351Plan *p = plan_find(kind, freq, ref, correction);
+	if(p == NULL)
+	{
+		p = plan_store(kind, freq, ref, correction);
+		p->result = pll_calc_uncached(pll, freq, &p->reg, correction, vcxo);
+	}
+	*reg = p->reg;
+	return p->result;
+}
+
+uint64_t Si5351::multisynth_calc(uint64_t freq, uint64_t pll_freq, struct Si5351RegSet *reg)
+{
+	struct Si5351Plan *p = plan_find(SI5351_PLAN_MS, freq, pll_freq, 0);
+	if(p == NULL)
+	{
+		p = plan_store(SI5351_PLAN_MS, freq, pll_freq, 0);
+		p->result = multisynth_calc_uncached(freq, pll_freq, &p->reg);
+	}
+	*reg = p->reg;
+	return p->result;
+}
+
+uint64_t Si5351::pll_calc_uncached(enum si5351_pll pll, uint64_t freq, struct Si5351RegSet *reg, int32_t correction, uint8_t vcxo)
 {
 	uint64_t ref_freq;
 	if(pll == SI5351_PLLA)
@@ -1436,7 +1818,7 @@ uint64_t Si5351::pll_calc(enum si5351_pll pll, uint64_t freq, struct Si5351RegSe
 	}
 }
 
-uint64_t Si5351::multisynth_calc(uint64_t freq, uint64_t pll_freq, struct Si5351RegSet *reg)
+uint64_t Si5351::multisynth_calc_uncached(uint64_t freq, uint64_t pll_freq, struct Si5351RegSet *reg)
 {
 	uint64_t lltmp;
 	uint32_t a, b, c, p1, p2, p3;
@@ -1716,7 +2098,99 @@ void Si5351::ms_div(enum si5351_clock clk, uint8_t r_div, uint8_t div_by_4)
 		reg_val |= (r_div << SI5351_OUTPUT_CLK_DIV_SHIFT);
 	}
 
-	si5351_write(reg_addr, reg_val);
+	si5351_write_diff(reg_addr, 1, &reg_val);
+}
+
+/*
+ * queue_write(uint8_t addr, uint8_t bytes)
+ *
+ * Queue a write of registers already in the shadow. If the newest
+ * queued write hasn't started and touches the same or the next
+ * registers it is widened instead, so a burst of tuning updates
+ * turns into one write of the final values. Only the newest write
+ * is merged so the order of writes on the bus is kept.
+ */
+uint8_t Si5351::queue_write(uint8_t addr, uint8_t bytes)
+{
+	while(bytes > SI5351_XFER_MAX)
+	{
+		queue_write(addr, SI5351_XFER_MAX);
+		addr += SI5351_XFER_MAX;
+		bytes -= SI5351_XFER_MAX;
+	}
+
+	if(queue_count > (xfer_active ? 1 : 0))
+	{
+		struct Si5351Xfer *last = &queue[(queue_head + queue_count - 1) % SI5351_QUEUE_SIZE];
+		const uint8_t lo = min(last->reg, addr);
+		const uint8_t hi = max(last->reg + last->bytes, addr + bytes);
+		if(addr <= last->reg + last->bytes && last->reg <= addr + bytes && hi - lo <= SI5351_XFER_MAX)
+		{
+			last->reg = lo;
+			last->bytes = hi - lo;
+			poll();
+			return 0;
+		}
+	}
+
+	// Full, wait for room
+	while(queue_count == SI5351_QUEUE_SIZE)
+	{
+		poll();
+	}
+
+	struct Si5351Xfer *x = &queue[(queue_head + queue_count) % SI5351_QUEUE_SIZE];
+	x->reg = addr;
+	x->bytes = bytes;
+	queue_count++;
+	poll();
+
+	return 0;
+}
+
+/*
+ * phase_regs(enum si5351_clock clk, uint8_t *regs)
+ *
+ * Copy the registers that decide a clock's phase from the shadow:
+ * the multisynth parameters, the control and the phase offset.
+ */
+void Si5351::phase_regs(enum si5351_clock clk, uint8_t *regs)
+{
+	memcpy(regs, &shadow[SI5351_CLK0_PARAMETERS + (clk * SI5351_PARAMETERS_LENGTH)], SI5351_PARAMETERS_LENGTH);
+	regs[SI5351_PARAMETERS_LENGTH] = shadow[SI5351_CLK0_CTRL + (uint8_t)clk];
+	regs[SI5351_PARAMETERS_LENGTH + 1] = shadow[SI5351_CLK0_PHASE_OFFSET + (uint8_t)clk];
+}
+
+/*
+ * shadow_load(void)
+ *
+ * Read the whole register map into the shadow, a chunk at a time
+ * with the address auto-incrementing.
+ *
+ */
+void Si5351::shadow_load(void)
+{
+	for(uint8_t addr = 0; addr < SI5351_SHADOW_SIZE; addr += SI5351_READ_CHUNK)
+	{
+		uint8_t bytes = SI5351_SHADOW_SIZE - addr;
+		if(bytes > SI5351_READ_CHUNK)
+		{
+			bytes = SI5351_READ_CHUNK;
+		}
+
+		Wire.beginTransmission(i2c_bus_addr);
+		Wire.write(addr);
+		Wire.endTransmission();
+
+		Wire.requestFrom(i2c_bus_addr, bytes);
+
+		for(uint8_t i = 0; i < bytes && Wire.available(); i++)
+		{
+			shadow[addr + i] = Wire.read();
+		}
+	}
+
+	shadow_valid = true;
 }
 
 uint8_t Si5351::select_r_div(uint64_t *freq)
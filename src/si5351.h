@@ -187,6 +187,15 @@
 #define SI5351_XTAL_ENABLE              (1<<6)
 #define SI5351_MULTISYNTH_ENABLE        (1<<4)
 
+#define SI5351_SHADOW_SIZE              (SI5351_FANOUT_ENABLE+1)
+#define SI5351_READ_CHUNK               32
+#define SI5351_DIFF_GAP                 2
+#define SI5351_QUEUE_SIZE               8
+#define SI5351_XFER_MAX                 SI5351_PARAMETERS_LENGTH
+#define SI5351_XFER_BUSY                0xff
+#define SI5351_PLAN_CACHE_SIZE          8
+#define SI5351_PHASE_REGS               10
+
 
 /* Macro definitions */
 
@@ -268,6 +277,49 @@ struct Si5351Status
 	uint8_t REVID;
 };
 
+/*
+ * Asynchronous register writes. start() begins a write of bytes
+ * registers from reg (copying data), done() returns SI5351_XFER_BUSY
+ * until it finishes then 0 or an error.
+ */
+struct Si5351Transport
+{
+	void (*start)(uint8_t, uint8_t, const uint8_t *, uint8_t);
+	uint8_t (*done)(void);
+};
+
+/*
+ * What set_freq_quadrature() had to do, for telemetry
+ */
+struct Si5351PhaseStats
+{
+	uint32_t fast;
+	uint32_t full;
+	uint32_t resets;
+};
+
+/*
+ * One remembered pll_calc() or multisynth_calc() result
+ */
+enum si5351_plan_kind {SI5351_PLAN_EMPTY, SI5351_PLAN_PLL, SI5351_PLAN_PLL_VCXO, SI5351_PLAN_MS};
+
+struct Si5351Plan
+{
+	enum si5351_plan_kind kind;
+	uint64_t freq;
+	uint64_t ref;
+	int32_t correction;
+	uint32_t used;
+	struct Si5351RegSet reg;
+	uint64_t result;
+};
+
+struct Si5351Xfer
+{
+	uint8_t reg;
+	uint8_t bytes;
+};
+
 struct Si5351IntStatus
 {
 	uint8_t SYS_INIT_STKY;
@@ -284,6 +336,8 @@ public:
 	void reset(void);
 	uint8_t set_freq(uint64_t, enum si5351_clock);
 	uint8_t set_freq_manual(uint64_t, uint64_t, enum si5351_clock);
+	uint8_t set_freq_fast(uint64_t, uint16_t, enum si5351_pll);
+	uint8_t set_freq_quadrature(uint64_t, uint16_t, enum si5351_clock, enum si5351_clock);
 	void set_pll(uint64_t, enum si5351_pll);
 	void set_ms(enum si5351_clock, struct Si5351RegSet, uint8_t, uint8_t, uint8_t);
 	void output_enable(enum si5351_clock, uint8_t);
@@ -303,13 +357,20 @@ public:
 	void set_pll_input(enum si5351_pll, enum si5351_pll_input);
 	void set_vcxo(uint64_t, uint8_t);
   void set_ref_freq(uint32_t, enum si5351_pll_input);
+	void set_transport(const struct Si5351Transport *, void (*)(uint8_t, uint8_t));
+	void poll(void);
+	bool busy(void);
+	void flush(void);
 	uint8_t si5351_write_bulk(uint8_t, uint8_t, uint8_t *);
 	uint8_t si5351_write(uint8_t, uint8_t);
+	uint8_t si5351_write_diff(uint8_t, uint8_t, uint8_t *);
 	uint8_t si5351_read(uint8_t);
+	uint8_t si5351_read_bus(uint8_t);
 	struct Si5351Status dev_status = {.SYS_INIT = 0, .LOL_B = 0, .LOL_A = 0,
     .LOS = 0, .REVID = 0};
 	struct Si5351IntStatus dev_int_status = {.SYS_INIT_STKY = 0, .LOL_B_STKY = 0,
     .LOL_A_STKY = 0, .LOS_STKY = 0};
+	struct Si5351PhaseStats phase_stats = {.fast = 0, .full = 0, .resets = 0};
 	enum si5351_pll pll_assignment[8];
 	uint64_t clk_freq[8];
 	uint64_t plla_freq;
@@ -321,15 +382,34 @@ private:
 	uint64_t pll_calc(enum si5351_pll, uint64_t, struct Si5351RegSet *, int32_t, uint8_t);
 	uint64_t multisynth_calc(uint64_t, uint64_t, struct Si5351RegSet *);
 	uint64_t multisynth67_calc(uint64_t, uint64_t, struct Si5351RegSet *);
+	uint64_t pll_calc_uncached(enum si5351_pll, uint64_t, struct Si5351RegSet *, int32_t, uint8_t);
+	uint64_t multisynth_calc_uncached(uint64_t, uint64_t, struct Si5351RegSet *);
+	struct Si5351Plan *plan_find(enum si5351_plan_kind, uint64_t, uint64_t, int32_t);
+	struct Si5351Plan *plan_store(enum si5351_plan_kind, uint64_t, uint64_t, int32_t);
 	void update_sys_status(struct Si5351Status *);
 	void update_int_status(struct Si5351IntStatus *);
 	void ms_div(enum si5351_clock, uint8_t, uint8_t);
 	uint8_t select_r_div(uint64_t *);
 	uint8_t select_r_div_ms67(uint64_t *);
+	void shadow_load(void);
+	uint8_t queue_write(uint8_t, uint8_t);
+	void phase_regs(enum si5351_clock, uint8_t *);
 	int32_t ref_correction[2];
   uint8_t clkin_div;
   uint8_t i2c_bus_addr;
   bool clk_first_set[8];
+	uint8_t shadow[SI5351_SHADOW_SIZE];
+	bool shadow_valid;
+	uint16_t ms_int_div[8];
+	const struct Si5351Transport *transport;
+	void (*xfer_callback)(uint8_t, uint8_t);
+	struct Si5351Xfer queue[SI5351_QUEUE_SIZE];
+	uint8_t queue_head;
+	uint8_t queue_count;
+	bool xfer_active;
+	struct Si5351Plan plan[SI5351_PLAN_CACHE_SIZE];
+	uint32_t plan_clock;
+	bool quadrature_valid;
 };
 
 #endif /* SI5351_H_ */
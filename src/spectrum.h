@@ -0,0 +1,290 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Spectrum of the received I/Q, sent as binary frames on a PIO UART
+//
+// Core 0 writes every I/Q sample (31250Hz, after the I/Q balance) into
+// a ring twice the FFT size and moves a write count on, it never waits.
+// Core 1 copies the newest SPECTRUM_POINTS samples every frame and
+// checks the count afterwards, if core 0 got round the ring first the
+// frame is skipped. The block mean (ADC offset) is taken out, then a
+// Hann window and a complex FFT. Bin powers are averaged (exponential,
+// average_ms time constant) and sent as log magnitude, one byte a bin
+// in half dB steps above the quietest bin. Frames are only built when
+// the last one has gone, the averaging carries on regardless.
+//
+// Frame, little endian:
+//   0   0xa5 0x5a   sync
+//   2   uint8       sequence
+//   3   uint8       log2 of the number of bins
+//   4   uint32      LO frequency, Hz
+//   8   uint32      sample rate, Hz
+//   12  int16       level of a zero bin, half dB re one ADC count
+//   14  uint8[n]    bins, -fs/2 to +fs/2 of I+jQ
+//   14+n uint16     CRC-16/CCITT of bytes 2 to 13+n
+// Which side of the LO is up depends on the I/Q wiring, the viewer
+// (tools/spectrum.py) can flip it.
+
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#include "hardware/sync.h"
+
+#define SPECTRUM_BITS   9u
+#define SPECTRUM_POINTS (1u<<SPECTRUM_BITS)
+#define SPECTRUM_RING   (2u*SPECTRUM_POINTS)
+#define SPECTRUM_HEADER 14u
+#define SPECTRUM_FRAME  (SPECTRUM_HEADER+SPECTRUM_POINTS+2u)
+#define SPECTRUM_SYNC0  0xa5u
+#define SPECTRUM_SYNC1  0x5au
+
+static_assert(SPECTRUM_BITS>=8u && SPECTRUM_BITS<=10u,"spectrum is 256 to 1024 points");
+
+namespace SPECTRUM
+{
+  struct timing_t
+  {
+    uint32_t frame_ms;    // the task period
+    uint32_t average_ms;  // time constant, 0 for none
+  };
+
+  // core 0 writes, core 1 reads
+  static float ring_i[SPECTRUM_RING];
+  static float ring_q[SPECTRUM_RING];
+  volatile static uint32_t written = 0;
+
+  // core 1
+  static SerialPIO *uart = NULL;
+  static float window[SPECTRUM_POINTS];
+  static float cos_tab[SPECTRUM_POINTS/2u];
+  static float sin_tab[SPECTRUM_POINTS/2u];
+  static float re[SPECTRUM_POINTS];
+  static float im[SPECTRUM_POINTS];
+  static float average[SPECTRUM_POINTS];
+  static float k_average = 1.0f;
+  static float scale = 1.0f;
+  static bool averaged = false;
+  static uint32_t centre = 0;
+  static uint8_t frame[SPECTRUM_FRAME];
+  static uint32_t tx_length = 0;
+  static uint32_t tx_sent = 0;
+  static uint8_t sequence = 0;
+
+  static void __not_in_flash_func(capture)(const float in_i,const float in_q)
+  {
+    // core 0, once per sample
+    const uint32_t w = written;
+    ring_i[w & (SPECTRUM_RING - 1u)] = in_i;
+    ring_q[w & (SPECTRUM_RING - 1u)] = in_q;
+    __dmb();
+    written = w + 1u;
+  }
+
+  static void set_centre(const uint32_t frequency)
+  {
+    // core 1, the LO
+    centre = frequency;
+  }
+
+  static void init(const timing_t &timing,const uint32_t pin_tx,const uint32_t baud)
+  {
+    // core 1, tables and a transmit only PIO UART
+    float sum = 0.0f;
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      window[n] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * (float)n / (float)SPECTRUM_POINTS);
+      sum += window[n];
+    }
+    // a tone of amplitude A reads A^2
+    scale = 1.0f / (sum * sum);
+    for (uint32_t n=0;n<SPECTRUM_POINTS/2u;n++)
+    {
+      cos_tab[n] = cosf(2.0f * (float)M_PI * (float)n / (float)SPECTRUM_POINTS);
+      sin_tab[n] = sinf(2.0f * (float)M_PI * (float)n / (float)SPECTRUM_POINTS);
+    }
+    k_average = timing.average_ms>timing.frame_ms?1.0f - expf(-(float)timing.frame_ms / (float)timing.average_ms):1.0f;
+    averaged = false;
+    static SerialPIO port(pin_tx,SerialPIO::NOPIN);
+    port.begin(baud);
+    uart = &port;
+  }
+
+  static const bool copy(void)
+  {
+    // core 1, the newest block, false if core 0 overwrote it meanwhile
+    const uint32_t end = written;
+    if (end<SPECTRUM_POINTS)
+    {
+      return false;
+    }
+    __dmb();
+    const uint32_t start = end - SPECTRUM_POINTS;
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      re[n] = ring_i[(start + n) & (SPECTRUM_RING - 1u)];
+      im[n] = ring_q[(start + n) & (SPECTRUM_RING - 1u)];
+    }
+    __dmb();
+    return written - start<=SPECTRUM_RING;
+  }
+
+  static void fft(void)
+  {
+    // radix 2 decimation in time, in place
+    for (uint32_t i=1,j=0;i<SPECTRUM_POINTS;i++)
+    {
+      uint32_t bit = SPECTRUM_POINTS >> 1;
+      for (;j & bit;bit>>=1)
+      {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i<j)
+      {
+        const float tr = re[i];
+        const float ti = im[i];
+        re[i] = re[j];
+        im[i] = im[j];
+        re[j] = tr;
+        im[j] = ti;
+      }
+    }
+    for (uint32_t half=1;half<SPECTRUM_POINTS;half<<=1)
+    {
+      const uint32_t step = SPECTRUM_POINTS / (half * 2u);
+      for (uint32_t i=0;i<SPECTRUM_POINTS;i+=half*2u)
+      {
+        for (uint32_t k=0;k<half;k++)
+        {
+          // exp(-j.2.pi.k/len)
+          const float wr = cos_tab[k * step];
+          const float wi = -sin_tab[k * step];
+          const uint32_t a = i + k;
+          const uint32_t b = a + half;
+          const float tr = re[b] * wr - im[b] * wi;
+          const float ti = re[b] * wi + im[b] * wr;
+          re[b] = re[a] - tr;
+          im[b] = im[a] - ti;
+          re[a] += tr;
+          im[a] += ti;
+        }
+      }
+    }
+  }
+
+  static uint16_t crc16(const uint8_t *p,const uint32_t length)
+  {
+    // CRC-16/CCITT, as the settings records
+    uint16_t crc = 0xffffu;
+    for (uint32_t i=0;i<length;i++)
+    {
+      crc ^= (uint16_t)p[i] << 8;
+      for (uint32_t b=0;b<8;b++)
+      {
+        crc = (crc & 0x8000u) ? (crc << 1) ^ 0x1021u : crc << 1;
+      }
+    }
+    return crc;
+  }
+
+  static void build(void)
+  {
+    // core 1, log magnitude of the average, lowest frequency first
+    static float db[SPECTRUM_POINTS];
+    float lowest = 1.0e9f;
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      const uint32_t k = (n + SPECTRUM_POINTS / 2u) & (SPECTRUM_POINTS - 1u);
+      db[n] = 10.0f * log10f(average[k] + 1.0e-20f);
+      lowest = min(lowest,db[n]);
+    }
+    const int32_t reference = (int32_t)floorf(lowest * 2.0f);
+    uint8_t *p = frame;
+    *p++ = SPECTRUM_SYNC0;
+    *p++ = SPECTRUM_SYNC1;
+    *p++ = sequence++;
+    *p++ = SPECTRUM_BITS;
+    for (uint32_t i=0;i<4;i++)
+    {
+      *p++ = (uint8_t)(centre >> (8u * i));
+    }
+    for (uint32_t i=0;i<4;i++)
+    {
+      *p++ = (uint8_t)(SAMPLERATE >> (8u * i));
+    }
+    *p++ = (uint8_t)reference;
+    *p++ = (uint8_t)(reference >> 8);
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      const int32_t level = (int32_t)lroundf(db[n] * 2.0f) - reference;
+      *p++ = (uint8_t)constrain(level,0l,255l);
+    }
+    const uint16_t crc = crc16(frame + 2u,SPECTRUM_HEADER - 2u + SPECTRUM_POINTS);
+    *p++ = (uint8_t)crc;
+    *p++ = (uint8_t)(crc >> 8);
+    tx_length = SPECTRUM_FRAME;
+    tx_sent = 0;
+  }
+
+  static void process(void)
+  {
+    // core 1 task, one FFT a frame period
+    if (!copy())
+    {
+      return;
+    }
+    float mean_i = 0.0f;
+    float mean_q = 0.0f;
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      mean_i += re[n];
+      mean_q += im[n];
+    }
+    mean_i /= (float)SPECTRUM_POINTS;
+    mean_q /= (float)SPECTRUM_POINTS;
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      re[n] = (re[n] - mean_i) * window[n];
+      im[n] = (im[n] - mean_q) * window[n];
+    }
+    fft();
+    const float k = averaged?k_average:1.0f;
+    for (uint32_t n=0;n<SPECTRUM_POINTS;n++)
+    {
+      const float power = (re[n] * re[n] + im[n] * im[n]) * scale;
+      average[n] += (power - average[n]) * k;
+    }
+    averaged = true;
+    if (tx_sent>=tx_length)
+    {
+      build();
+    }
+  }
+
+  static void send(void)
+  {
+    // core 1, every pass, as much as the PIO FIFO takes
+    while (tx_sent<tx_length && uart->availableForWrite()>0)
+    {
+      uart->write(frame[tx_sent++]);
+    }
+  }
+}
+
+#endif
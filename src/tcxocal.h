@@ -0,0 +1,180 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// TCXO calibration against a received carrier
+//
+// Tuned to a carrier in CW mode the carrier should sit at the sidetone
+// offset in the I/Q stream. Its actual frequency is measured with a
+// phase difference estimator: the I/Q is mixed down by the offset,
+// decimated by 32 (boxcar) and the autocorrelations
+//   R1 = sum(z[n].conj(z[n-1])), R8 = sum(z[n].conj(z[n-8]))
+// accumulated for 4 seconds. arg(R1).fs/2pi is the residual to within
+// +/-488Hz, arg(R8) is 8 times finer but only unique to +/-61Hz so the
+// first picks which 61Hz. Good to a few mHz on a strong carrier and
+// about half a Hz rms at 0dB SNR (in 500Hz). Which side of zero the carrier is on
+// depends on the I/Q wiring so both are mixed down and the stronger
+// one wins. Costs about a dozen multiplies a sample while measuring.
+
+#ifndef TCXOCAL_H
+#define TCXOCAL_H
+
+#include "CW.h"
+
+#define TCXOCAL_DECIMATE  32u
+#define TCXOCAL_SAMPLES   (4ul*SAMPLERATE)
+#define TCXOCAL_DOMINANCE 10.0f // winner 10dB over the other side (|R|)
+#define TCXOCAL_K_DC      0.001f
+#define TCXOCAL_LAG       8u
+
+namespace TCXOCAL
+{
+  volatile static bool measuring = false;  // core 1 sets, core 0 clears
+  static uint32_t phase_step = 0;
+
+  // core 0 estimator state, [0] mixed by -offset, [1] by +offset
+  static uint32_t dds = 0;
+  static uint32_t n = 0;
+  static uint32_t count = 0;
+  static float dc_i = 0.0f;
+  static float dc_q = 0.0f;
+  static float acc_re[2] = {0.0f,0.0f};
+  static float acc_im[2] = {0.0f,0.0f};
+  static float last_re[2][TCXOCAL_LAG];
+  static float last_im[2][TCXOCAL_LAG];
+  static uint32_t last = 0;
+  static float r_re[2] = {0.0f,0.0f};
+  static float r_im[2] = {0.0f,0.0f};
+  static float rl_re[2] = {0.0f,0.0f};
+  static float rl_im[2] = {0.0f,0.0f};
+
+  static void start(const uint32_t offset)
+  {
+    // core 1, offset in Hz
+    phase_step = (uint32_t)(((uint64_t)offset << 32) / SAMPLERATE);
+    dds = 0;
+    n = 0;
+    count = 0;
+    dc_i = dc_q = 0.0f;
+    last = 0;
+    memset(last_re,0,sizeof(last_re));
+    memset(last_im,0,sizeof(last_im));
+    for (uint32_t k=0;k<2;k++)
+    {
+      acc_re[k] = acc_im[k] = 0.0f;
+      r_re[k] = r_im[k] = 0.0f;
+      rl_re[k] = rl_im[k] = 0.0f;
+    }
+    measuring = true;
+  }
+
+  static const bool busy(void)
+  {
+    return measuring;
+  }
+
+  static void __not_in_flash_func(process)(const float in_i,const float in_q)
+  {
+    // core 0, once per sample while measuring
+    if (!measuring)
+    {
+      return;
+    }
+    // the ADC offset would alias into the band
+    dc_i += (in_i - dc_i) * TCXOCAL_K_DC;
+    dc_q += (in_q - dc_q) * TCXOCAL_K_DC;
+    const float ii = in_i - dc_i;
+    const float qq = in_q - dc_q;
+    // the table is a cosine
+    const float c = CW::dds_sin_tab[dds >> 22];
+    const float s = CW::dds_sin_tab[((dds >> 22) - 256u) & 1023u];
+    dds += phase_step;
+    // z.exp(-jwt) and z.exp(+jwt)
+    const float ic = ii * c;
+    const float qs = qq * s;
+    const float qc = qq * c;
+    const float is = ii * s;
+    acc_re[0] += ic + qs;
+    acc_im[0] += qc - is;
+    acc_re[1] += ic - qs;
+    acc_im[1] += qc + is;
+    if (++count<TCXOCAL_DECIMATE)
+    {
+      return;
+    }
+    count = 0;
+    // last[] is a ring, newest at last, oldest (lag 8) at last+1
+    const uint32_t newest = last;
+    last = (last + 1u) & (TCXOCAL_LAG - 1u);
+    for (uint32_t k=0;k<2;k++)
+    {
+      const float re = acc_re[k];
+      const float im = acc_im[k];
+      const float re1 = last_re[k][newest];
+      const float im1 = last_im[k][newest];
+      const float rel = last_re[k][last];
+      const float iml = last_im[k][last];
+      r_re[k] += re * re1 + im * im1;
+      r_im[k] += im * re1 - re * im1;
+      rl_re[k] += re * rel + im * iml;
+      rl_im[k] += im * rel - re * iml;
+      last_re[k][last] = re;
+      last_im[k][last] = im;
+      acc_re[k] = acc_im[k] = 0.0f;
+    }
+    n += TCXOCAL_DECIMATE;
+    if (n>=TCXOCAL_SAMPLES)
+    {
+      measuring = false;
+    }
+  }
+
+  static const bool result(float &offset)
+  {
+    // core 1 once !busy(), carrier frequency relative to the
+    // expected offset in Hz, false if there was no clear carrier.
+    // Noise is uncorrelated from one decimated sample to the next so
+    // |R| is mostly carrier even when the carrier is below the noise.
+    float power[2];
+    for (uint32_t k=0;k<2;k++)
+    {
+      power[k] = r_re[k] * r_re[k] + r_im[k] * r_im[k];
+    }
+    const uint32_t k = power[1]>power[0]?1u:0u;
+    if (power[k]<=0.0f || power[k]<power[k^1u]*powf(10.0f,TCXOCAL_DOMINANCE/5.0f))
+    {
+      return false;
+    }
+    const float fs = (float)SAMPLERATE / (float)TCXOCAL_DECIMATE;
+    const float coarse = atan2f(r_im[k],r_re[k]) * fs / (2.0f * (float)M_PI);
+    // R8 gives the residual modulo fs/8, take the one nearest R1's
+    const float span = fs / (float)TCXOCAL_LAG;
+    const float fine = atan2f(rl_im[k],rl_re[k]) * span / (2.0f * (float)M_PI);
+    const float residual = fine + span * roundf((coarse - fine) / span);
+    if (fabsf(residual - coarse)>span/4.0f)
+    {
+      // too noisy to say which
+      return false;
+    }
+    // mixed by -offset means the carrier is on the positive side
+    offset = k==0?residual:-residual;
+    return true;
+  }
+}
+
+#endif
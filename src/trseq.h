@@ -0,0 +1,234 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// T/R sequencer
+//
+// Runs on core 0 and is stepped once per audio sample (32us) so the
+// T/R transitions are timed by the sample clock rather than delay()
+// on core 1. Core 1 only requests TX or RX and (optionally) waits
+// for the sequence to complete.
+//
+// RX -> TX: mute, RX mixer off, TX mixer on, TX bias on
+// TX -> RX: TX bias off, TX mixer off, RX mixer on, unmute
+//
+// When going to RX the sequencer waits for the CW envelope to finish
+// plus a hang time, so with full QSK the key can request RX straight
+// after every element and the receiver is heard between elements.
+
+#ifndef TRSEQ_H
+#define TRSEQ_H
+
+#define TR_SAMPLE_US 32ul
+#define QSK_SEMI     0u
+#define QSK_FULL     1u
+
+namespace TR
+{
+  struct timing_t
+  {
+    uint32_t mute_us;     // receiver muted before RX mixer off
+    uint32_t rx_off_us;   // RX mixer off before TX mixer on
+    uint32_t tx_on_us;    // TX mixer on before TX bias on
+    uint32_t bias_on_us;  // TX bias on before TX ready
+    uint32_t bias_off_us; // TX bias off before TX mixer off
+    uint32_t tx_off_us;   // TX mixer off before RX mixer on
+    uint32_t rx_on_us;    // RX mixer on before unmute
+    uint32_t hang_us;     // key up to start of TX -> RX
+  };
+
+  enum tr_state_t
+  {
+    TR_RX,
+    TR_MUTE,
+    TR_RX_OFF,
+    TR_TX_ON,
+    TR_BIAS_ON,
+    TR_TX,
+    TR_HANG,
+    TR_BIAS_OFF,
+    TR_TX_OFF,
+    TR_RX_ON
+  };
+
+  volatile static tr_state_t state = TR_RX;
+  volatile static bool tx_request = false;
+  volatile static bool muted = false;
+  static uint32_t pin_rxn = 0;
+  static uint32_t pin_txn = 0;
+  static uint32_t pin_bias = 0;
+  static uint32_t samples[TR_RX_ON+1] = { 0 };
+  static uint32_t hang_samples = 0;
+
+  static uint32_t to_samples(const uint32_t us)
+  {
+    // at least one sample per step
+    return max((us + TR_SAMPLE_US - 1ul) / TR_SAMPLE_US,1ul);
+  }
+
+  static void init(const uint32_t rxn,const uint32_t txn,const uint32_t bias,const timing_t &timing)
+  {
+    pin_rxn = rxn;
+    pin_txn = txn;
+    pin_bias = bias;
+    samples[TR_MUTE] = to_samples(timing.mute_us);
+    samples[TR_RX_OFF] = to_samples(timing.rx_off_us);
+    samples[TR_TX_ON] = to_samples(timing.tx_on_us);
+    samples[TR_BIAS_ON] = to_samples(timing.bias_on_us);
+    samples[TR_BIAS_OFF] = to_samples(timing.bias_off_us);
+    samples[TR_TX_OFF] = to_samples(timing.tx_off_us);
+    samples[TR_RX_ON] = to_samples(timing.rx_on_us);
+    hang_samples = timing.hang_us / TR_SAMPLE_US;
+    state = TR_RX;
+    tx_request = false;
+    muted = false;
+  }
+
+  static void request(const bool tx)
+  {
+    // core 1
+    tx_request = tx;
+  }
+
+  static const bool is_tx(void)
+  {
+    return state==TR_TX || state==TR_HANG;
+  }
+
+  static const bool __not_in_flash_func(is_rx)(void)
+  {
+    return state==TR_RX;
+  }
+
+  static void wait_tx(void)
+  {
+    // core 1, sub-millisecond with the default timing
+    while (!is_tx())
+    {
+      tight_loop_contents();
+    }
+  }
+
+  static void wait_rx(void)
+  {
+    // core 1
+    while (!is_rx())
+    {
+      tight_loop_contents();
+    }
+  }
+
+  static const bool __not_in_flash_func(process)(const bool keyup,volatile bool &tx_enable)
+  {
+    // core 0, once per sample
+    // keyup is true when the CW envelope has finished
+    // returns true if the receiver audio should be muted
+    static uint32_t count = 0;
+    if (count>0)
+    {
+      count--;
+      return muted;
+    }
+    switch (state)
+    {
+      case TR_RX:
+      {
+        if (tx_request)
+        {
+          muted = true;
+          count = samples[TR_MUTE];
+          state = TR_MUTE;
+        }
+        break;
+      }
+      case TR_MUTE:
+      {
+        gpio_put(pin_rxn,HIGH);
+        count = samples[TR_RX_OFF];
+        state = TR_RX_OFF;
+        break;
+      }
+      case TR_RX_OFF:
+      {
+        tx_enable = true;
+        gpio_put(pin_txn,LOW);
+        count = samples[TR_TX_ON];
+        state = TR_TX_ON;
+        break;
+      }
+      case TR_TX_ON:
+      {
+        gpio_put(pin_bias,HIGH);
+        count = samples[TR_BIAS_ON];
+        state = TR_BIAS_ON;
+        break;
+      }
+      case TR_BIAS_ON:
+      {
+        state = TR_TX;
+        break;
+      }
+      case TR_TX:
+      {
+        if (!tx_request && keyup)
+        {
+          count = hang_samples;
+          state = TR_HANG;
+        }
+        break;
+      }
+      case TR_HANG:
+      {
+        if (tx_request || !keyup)
+        {
+          // keyed again during the hang
+          state = TR_TX;
+          break;
+        }
+        gpio_put(pin_bias,LOW);
+        count = samples[TR_BIAS_OFF];
+        state = TR_BIAS_OFF;
+        break;
+      }
+      case TR_BIAS_OFF:
+      {
+        gpio_put(pin_txn,HIGH);
+        tx_enable = false;
+        count = samples[TR_TX_OFF];
+        state = TR_TX_OFF;
+        break;
+      }
+      case TR_TX_OFF:
+      {
+        gpio_put(pin_rxn,LOW);
+        count = samples[TR_RX_ON];
+        state = TR_RX_ON;
+        break;
+      }
+      case TR_RX_ON:
+      {
+        muted = false;
+        state = TR_RX;
+        break;
+      }
+    }
+    return muted;
+  }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// TX I/Q balance calibration
+//
+// The correction for each frequency segment is read from a table in
+// flash (txcaldata.h, made by tools/txcal.py) and linearly interpolated
+// on core 1 when the radio is tuned. Core 0 applies it to every TX
+// sample, SSB and CW alike:
+//   I' = I + dc_i
+//   Q' = (gain.Q + phase.I) + dc_q
+// gain and phase are Q14, DC offsets are in DAC steps (+/-512 full scale)
+
+#ifndef TXCAL_H
+#define TXCAL_H
+
+#define TXCAL_SHIFT 14
+
+namespace TXCAL
+{
+  #include "txcaldata.h"
+
+  static const uint32_t table_size = sizeof(table)/sizeof(table[0]);
+
+  // double buffered so core 0 never sees half an update
+  static struct
+  {
+    int32_t gain;
+    int32_t phase;
+    int32_t dc_i;
+    int32_t dc_q;
+  }
+  correction[2] =
+  {
+    {1l<<TXCAL_SHIFT,0,0,0},
+    {1l<<TXCAL_SHIFT,0,0,0}
+  };
+  volatile static uint32_t active = 0;
+
+  static int32_t interpolate(const int32_t a,const int32_t b,const uint32_t x,const uint32_t step)
+  {
+    return a + (int32_t)(((int64_t)(b - a) * (int64_t)x) / (int64_t)step);
+  }
+
+  static void set_frequency(const uint32_t frequency)
+  {
+    // core 1
+    uint32_t n = 0;
+    uint32_t x = 0;
+    if (frequency>TXCAL_START)
+    {
+      n = (frequency - TXCAL_START) / TXCAL_STEP;
+      x = (frequency - TXCAL_START) % TXCAL_STEP;
+    }
+    if (n>=table_size-1u)
+    {
+      n = table_size - 2u;
+      x = TXCAL_STEP;
+    }
+    const uint32_t next = active ^ 1u;
+    correction[next].gain = interpolate(table[n].gain,table[n+1].gain,x,TXCAL_STEP);
+    correction[next].phase = interpolate(table[n].phase,table[n+1].phase,x,TXCAL_STEP);
+    correction[next].dc_i = interpolate(table[n].dc_i,table[n+1].dc_i,x,TXCAL_STEP);
+    correction[next].dc_q = interpolate(table[n].dc_q,table[n+1].dc_q,x,TXCAL_STEP);
+    active = next;
+  }
+
+  static void __not_in_flash_func(correct)(int16_t &tx_i,int16_t &tx_q)
+  {
+    // core 0
+    const uint32_t c = active;
+    const int32_t i = tx_i;
+    const int32_t q = tx_q;
+    tx_i = (int16_t)(i + correction[c].dc_i);
+    tx_q = (int16_t)(((q * correction[c].gain + i * correction[c].phase) >> TXCAL_SHIFT) + correction[c].dc_q);
+  }
+}
+
+#endif
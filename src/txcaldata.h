@@ -0,0 +1,28 @@
+// generated by tools/txcal.py, do not edit
+// uncalibrated (no correction)
+
+#ifndef TXCALDATA_H
+#define TXCALDATA_H
+
+#define TXCAL_START 7000000ul
+#define TXCAL_STEP  50000ul
+
+static const struct
+{
+  int16_t gain;
+  int16_t phase;
+  int16_t dc_i;
+  int16_t dc_q;
+}
+table[] =
+{
+  {16384,0,0,0}, // 7.000
+  {16384,0,0,0}, // 7.050
+  {16384,0,0,0}, // 7.100
+  {16384,0,0,0}, // 7.150
+  {16384,0,0,0}, // 7.200
+  {16384,0,0,0}, // 7.250
+  {16384,0,0,0}  // 7.300
+};
+
+#endif
@@ -40,6 +40,31 @@
  * Version 1.3 2025-05-25 adjust mic gain
  * Version 1.4 2025-05-27 direct CW (no phase errors)
  * Version 1.5 2025-11-23 increase bandwidth improved
+ * Version 1.6 2026-10-19 selectable CW filter bandwidth
+ * Version 1.6 2026-10-19 sample clocked T/R sequencer, full QSK
+ * Version 1.6 2026-10-19 adaptive RX I/Q balance
+ * Version 1.6 2026-10-19 TX I/Q balance calibration table
+ * Version 1.6 2026-10-19 settings saved to flash
+ * Version 1.6 2026-10-19 ADPCM voice prompts
+ * Version 1.6 2026-10-19 prompts stored at 7812.5Hz
+ * Version 1.6 2026-10-19 prompt queue, announcements no longer dropped
+ * Version 1.6 2026-10-19 prompts packed by tools/promptpack.py
+ * Version 1.6 2026-10-19 prompt data prefetched to SRAM by DMA
+ * Version 1.6 2026-10-19 triple click speaks S meter, volume and keyer speed
+ * Version 1.6 2026-10-19 receiver ducked smoothly under voice prompts
+ * Version 1.6 2026-10-19 Si5351 register shadow, no I2C reads when tuning
+ * Version 1.6 2026-10-19 Si5351 writes only changed registers, PLL last
+ * Version 1.6 2026-10-19 fast tuning moves the PLL only, no phase reset
+ * Version 1.6 2026-10-19 Si5351 writes sent by DMA, tuning never waits for I2C
+ * Version 1.6 2026-10-19 Si5351 PLL and multisynth results cached
+ * Version 1.6 2026-10-19 quadrature retune resets the PLL only when phase is at risk
+ * Version 1.6 2026-10-19 four clicks in CW calibrates the TCXO on a received carrier
+ * Version 1.6 2026-10-19 interrupt driven encoder with spin acceleration
+ * Version 1.6 2026-10-19 core 1 sends DSP changes to core 0 through a mailbox
+ * Version 1.6 2026-10-19 core 1 runs as scheduled tasks on a timer wheel
+ * Version 1.6 2026-10-19 Kenwood CAT on UART0 (GP0 TX, GP1 RX, 38400)
+ * Version 1.6 2026-10-19 memories (5 clicks store, 6 recall, hold to scan), 7 clicks band scan
+ * Version 1.6 2026-10-19 I/Q spectrum frames on GP12 (PIO UART 230400), tools/spectrum.py
  *
  * TODO:
  *
@@ -53,20 +78,34 @@
 
 #include <Wire.h>
 #include "si5351.h"
+#include "i2cdma.h"
 #include "Rotary.h"
+#include "encoder.h"
 #include "filter.h"
 #include "dsp.h"
 #include "cw.h"
 #include "vfa.h"
 #include "announce.h"
+#include "trseq.h"
+#include "iqbal.h"
+#include "txcal.h"
+#include "settings.h"
+#include "mixer.h"
+#include "mailbox.h"
+#include "sched.h"
+#include "cat.h"
+#include "tcxocal.h"
+#include "memory.h"
+#include "scan.h"
+#include "spectrum.h"
 #include "hardware/pwm.h"
 #include "hardware/adc.h"
 #include "hardware/vreg.h"
 
-#define PIN_UNUSED0   0u // free pin
-#define PIN_UNUSED1   1u // free pin
+#define PIN_CAT_TX    0u // CAT UART0 TX
+#define PIN_CAT_RX    1u // CAT UART0 RX
 #define PIN_PTT       2u // Mic PTT (active low) and CW Paddle A
-#define PIN_UNUSED3   3u // free pin
+#define PIN_DEBUG_TX  3u // free pin, scheduler report with DEBUG_SCHED
 #define PIN_SDA       4u // I2C SDA
 #define PIN_SCL       5u // I2C SCL
 #define PIN_TX000     6u // TX PWM
@@ -75,7 +114,7 @@
 #define PIN_TX270     9u // TX PWM
 #define PIN_TXN      10u // Enable TX mixer (active low)
 #define PIN_UNUSED11 11u // free pin
-#define PIN_UNUSED12 12u // free pin
+#define PIN_SPECTRUM 12u // spectrum PIO UART TX
 #define PIN_1LED     13u // PWM LED signal level
 #define PIN_PADB     14u // CW Paddle B
 #define PIN_VOL      15u // PWM volume control
@@ -100,21 +139,50 @@
 #define DEFAULT_MODE       MODE_LSB
 #define DEFAULT_CW_MODE    CW_PADDLE
 #define DEFAULT_AUTO_MODE  false
+#define DEFAULT_CW_FILTER  1u
+#define DEFAULT_QSK_MODE   QSK_SEMI
 #define VOLUME_STEP        5u
 #define LONG_PRESS_TIME    1000u
+#define DOUBLE_CLICK_TIME  300u
+#define ENCODER_SLOW_US    25000ul // slower than 40 steps/s, one step
+#define ENCODER_FAST_US    2500ul  // faster than 400 steps/s, full acceleration
+#define ENCODER_MAX_STEPS  25ul
 #define MIN_FREQUENCY      7000000ul
 #define MAX_FREQUENCY      7300000ul
 #define MIN_VOL            80ul
 #define MAX_VOL            255ul
 #define TCXO_FREQ          27000000ul
+#define TCXO_MAX_PPB       20000l
 #define VFA_DELAY          2000ul
+#define SCAN_SQUELCH_DB    10.0f  // stop on a channel this far over the noise
+#define SCAN_HANG_MS       2000ul // carry on once it has been quiet this long
+#define SETTINGS_DELAY     5000ul
+#define CONTROLS_MS        1ul    // 1kHz encoder, button and PTT
+#define METER_MS           20ul   // 50Hz S meter and volume
+#define SETTINGS_MS        1000ul // 1Hz persistence
+#define PROMPT_DUCK_DB     -24.0f
+#define PROMPT_LEVEL_DB    0.0f
 #define QUADRATURE_DIVISOR 88ul
+#define I2C_CLOCK          400000ul // 1000000ul for fast mode plus
+#define CAT_BAUD           38400ul
+#define SPECTRUM_BAUD      230400ul
+#define SPECTRUM_MS        100ul  // 10 spectrum frames a second
+#define SPECTRUM_AVERAGE_MS 500ul
 #define MUTE               0u
 #define CW_STRAIGHT        0u
 #define CW_PADDLE          1u
+#define TR_MUTE_US         500ul
+#define TR_RX_OFF_US       250ul
+#define TR_TX_ON_US        250ul
+#define TR_BIAS_ON_US      250ul
+#define TR_BIAS_OFF_US     250ul
+#define TR_TX_OFF_US       250ul
+#define TR_RX_ON_US        1000ul
+#define TR_QSK_HANG_US     3000ul
 
 #define TEST_5351         0
 #define DEBUG_LED         0
+#define DEBUG_SCHED       0
 
 #define SIG_MUX 0u
 #if PIN_MIC == 26U
@@ -142,9 +210,10 @@ volatile static struct
   uint32_t volume;
   radio_mode_t mode;
   uint8_t cw_mode;
+  uint8_t cw_filter;
+  uint8_t qsk_mode;
   bool auto_mode;
   bool tx_enable;
-  bool keydown;
 }
 radio =
 {
@@ -153,11 +222,50 @@ radio =
   DEFAULT_VOLUME,
   DEFAULT_MODE,
   DEFAULT_CW_MODE,
+  DEFAULT_CW_FILTER,
+  DEFAULT_QSK_MODE,
   DEFAULT_AUTO_MODE,
-  false,
   false
 };
 
+// radio state saved in flash
+struct saved_state_t
+{
+  uint32_t frequency;
+  uint32_t tuning_step;
+  uint32_t volume;
+  uint8_t mode;
+  uint8_t cw_mode;
+  uint8_t cw_filter;
+  uint8_t qsk_mode;
+  bool auto_mode;
+};
+
+static saved_state_t saved_state;
+
+// core 1 event tasks
+static uint32_t tune_task = SCHED_NONE;
+static uint32_t announce_task = SCHED_NONE;
+static uint32_t announced_khz = 0;
+
+// PTT from CAT
+volatile static bool cat_ptt = false;
+
+// TCXO correction, also saved in flash
+static int32_t tcxo_ppb = 0;
+static uint32_t tcxo_cal_frequency = 0;
+static radio_mode_t tcxo_cal_mode = MODE_CWL;
+
+// memory channels, a frequency to store waits for the settings task
+static uint32_t memory_channel = 0;
+static MEMORY::channel_t memory_store = {};
+static bool scan_memories = false;
+
+#if defined DEBUG_SCHED && DEBUG_SCHED==1
+// task run times on a PIO UART, UART0 is CAT
+static SerialPIO report_port(PIN_DEBUG_TX,SerialPIO::NOPIN);
+#endif
+
 Si5351 si5351;
 Rotary r = Rotary(PIN_ENCB,PIN_ENCA);
 
@@ -217,10 +325,8 @@ void setup()
   pinMode(PIN_RXN,OUTPUT);
   pinMode(PIN_PTT,INPUT);
   pinMode(PIN_PADB,INPUT);
-  pinMode(PIN_UNUSED1,INPUT_PULLUP);
-  pinMode(PIN_UNUSED3,INPUT_PULLUP);
+  pinMode(PIN_DEBUG_TX,INPUT_PULLUP);
   pinMode(PIN_UNUSED11,INPUT_PULLUP);
-  pinMode(PIN_UNUSED12,INPUT_PULLUP);
   pinMode(PIN_REG,OUTPUT);
   pinMode(PIN_ENCBUT,INPUT_PULLUP);
   pinMode(PIN_ENCA,INPUT_PULLUP);
@@ -233,6 +339,11 @@ void setup()
   digitalWrite(PIN_RXN,LOW);
   digitalWrite(LED_BUILTIN,LOW);
 
+  // restore the saved settings
+  restore_settings();
+  MAILBOX::set_mode(radio.mode);
+  MAILBOX::post();
+
   // set TX pin function to PWM
   gpio_set_function(PIN_TX000,GPIO_FUNC_PWM); // 6  PWM
   gpio_set_function(PIN_TX180,GPIO_FUNC_PWM); // 7  PWM
@@ -266,7 +377,8 @@ void setup()
   // set up MS5351M
   Wire.setSDA(PIN_SDA);
   Wire.setSCL(PIN_SCL);
-  const bool si5351_found = si5351.init(SI5351_CRYSTAL_LOAD_0PF,TCXO_FREQ,0);
+  Wire.setClock(I2C_CLOCK);
+  const bool si5351_found = si5351.init(SI5351_CRYSTAL_LOAD_0PF,TCXO_FREQ,tcxo_ppb);
   if (!si5351_found)
   {
     for (;;)
@@ -279,13 +391,12 @@ void setup()
   }
   si5351.drive_strength(SI5351_CLK0,SI5351_DRIVE_8MA);
   si5351.drive_strength(SI5351_CLK1,SI5351_DRIVE_8MA);
-  const uint64_t f = radio.frequency*SI5351_FREQ_MULT;
-  const uint64_t p = radio.frequency*QUADRATURE_DIVISOR*SI5351_FREQ_MULT;
-  si5351.set_freq_manual(f,p,SI5351_CLK0);
-  si5351.set_freq_manual(f,p,SI5351_CLK1);
-  si5351.set_phase(SI5351_CLK0,0);
-  si5351.set_phase(SI5351_CLK1,QUADRATURE_DIVISOR);
-  si5351.pll_reset(SI5351_PLLA);
+  // both clocks from PLLA / 88, CLK1 a quarter cycle behind
+  si5351.set_freq_quadrature(radio.frequency*SI5351_FREQ_MULT,QUADRATURE_DIVISOR,SI5351_CLK0,SI5351_CLK1);
+
+  // from here on tuning doesn't wait for the I2C bus
+  I2CDMA::init(SI5351_BUS_BASE_ADDR);
+  si5351.set_transport(&I2CDMA::transport,NULL);
 
 #if defined TEST_5351 && TEST_5351==1
   for (;;)
@@ -298,10 +409,10 @@ void setup()
 #endif
 
   // if button pressed at startup
-  // then turn on auto mode
+  // then toggle auto mode
   if (digitalRead(PIN_ENCBUT)==LOW)
   {
-    radio.auto_mode = true;
+    radio.auto_mode = !radio.auto_mode;
     delay(50);
     while (digitalRead(PIN_ENCBUT)==LOW)
     {
@@ -311,10 +422,10 @@ void setup()
   }
 
   // if PTT pressed at startup
-  // then enable CW straight key
+  // then toggle CW straight key/paddle
   if (digitalRead(PIN_PTT)==LOW)
   {
-    radio.cw_mode = CW_STRAIGHT;
+    radio.cw_mode = (radio.cw_mode==CW_STRAIGHT)?CW_PADDLE:CW_STRAIGHT;
     delay(50);
     while (digitalRead(PIN_PTT)==LOW)
     {
@@ -323,12 +434,58 @@ void setup()
     delay(50);
   }
 
+  // if paddle B pressed at startup
+  // then toggle full/semi QSK
+  if (digitalRead(PIN_PADB)==LOW)
+  {
+    radio.qsk_mode = (radio.qsk_mode==QSK_FULL)?QSK_SEMI:QSK_FULL;
+    delay(50);
+    while (digitalRead(PIN_PADB)==LOW)
+    {
+      delay(50);
+    }
+    delay(50);
+  }
+
+  static const TR::timing_t tr_timing =
+  {
+    TR_MUTE_US,
+    TR_RX_OFF_US,
+    TR_TX_ON_US,
+    TR_BIAS_ON_US,
+    TR_BIAS_OFF_US,
+    TR_TX_OFF_US,
+    TR_RX_ON_US,
+    TR_QSK_HANG_US
+  };
+  TR::init(PIN_RXN,PIN_TXN,PIN_TXBIAS,tr_timing);
+
   r.begin();
+  CWFILTER::init(CWFILTER::bandwidths[radio.cw_filter],CW_SIDETONE);
+  ADPCM::init();
+  MIXER::set_levels(PROMPT_DUCK_DB,PROMPT_LEVEL_DB);
   init_adc();
   analogWrite(PIN_VOL,radio.volume);
   setup_complete = true;
 }
 
+static const uint32_t add_task(const char *name,void (*run)(void),const uint32_t period_ms,const uint32_t flags)
+{
+  // a task that doesn't fit would never run, trap it
+  const uint32_t id = SCHED::add(name,run,period_ms,flags);
+  if (id==SCHED_NONE)
+  {
+    for (;;)
+    {
+      digitalWrite(LED_BUILTIN,HIGH);
+      delay(250);
+      digitalWrite(LED_BUILTIN,LOW);
+      delay(25);
+    }
+  }
+  return id;
+}
+
 void setup1()
 {
   // wait for setup() to complete
@@ -346,6 +503,62 @@ void setup1()
     digitalWrite(LED_BUILTIN,LOW);
     delay(250);
   }
+#endif
+  // encoder interrupts on this core, keeps them off the DSP
+  static const ENCODER::acceleration_t acceleration =
+  {
+    ENCODER_SLOW_US,
+    ENCODER_FAST_US,
+    ENCODER_MAX_STEPS
+  };
+  ENCODER::init(r,PIN_ENCA,PIN_ENCB,acceleration);
+
+  // CAT on UART0
+  static const CAT::radio_t cat_radio =
+  {
+    cat_get_frequency,
+    cat_set_frequency,
+    cat_get_mode,
+    cat_set_mode,
+    cat_get_tx,
+    cat_set_tx,
+    cat_get_smeter
+  };
+  CAT::init(cat_radio,CAT_BAUD,PIN_CAT_TX,PIN_CAT_RX);
+
+  // scanner, signal detect on core 0
+  static const SCAN::radio_t scan_radio =
+  {
+    scan_next,
+    scan_ready,
+    scan_found
+  };
+  SCAN::init(scan_radio,SCAN_SQUELCH_DB,SCAN_HANG_MS);
+
+  // spectrum frames on a PIO UART
+  static const SPECTRUM::timing_t spectrum_timing =
+  {
+    SPECTRUM_MS,
+    SPECTRUM_AVERAGE_MS
+  };
+  SPECTRUM::init(spectrum_timing,PIN_SPECTRUM,SPECTRUM_BAUD);
+
+  // core 1 tasks, polled ones first then those due in this order
+  SCHED::init();
+  add_task("i2c",task_i2c,0,SCHED_POLL|SCHED_RX|SCHED_TX);
+  add_task("controls",task_controls,CONTROLS_MS,SCHED_RX);
+  tune_task = add_task("tune",task_tune,0,SCHED_RX);
+  add_task("ptt",task_ptt,CONTROLS_MS,SCHED_RX);
+  add_task("cat",CAT::process,CONTROLS_MS,SCHED_RX|SCHED_TX);
+  add_task("meter",task_meter,METER_MS,SCHED_RX);
+  announce_task = add_task("announce",task_announce,0,SCHED_RX);
+  add_task("settings",task_settings,SETTINGS_MS,SCHED_RX);
+  add_task("scan",SCAN::process,CONTROLS_MS,SCHED_RX);
+  add_task("spectrum",SPECTRUM::process,SPECTRUM_MS,SCHED_RX);
+  add_task("spec tx",SPECTRUM::send,0,SCHED_POLL|SCHED_RX|SCHED_TX);
+#if defined DEBUG_SCHED && DEBUG_SCHED==1
+  report_port.begin(115200);
+  add_task("report",task_report,5000ul,SCHED_RX|SCHED_TX);
 #endif
 }
 
@@ -452,7 +665,32 @@ void __not_in_flash_func(reset_adc_tx)(void)
 void __not_in_flash_func(loop)(void)
 {
   // run DSP on core 0
+  process_dsp();
+  // stay in SRAM while core 1 writes the settings to flash
+  SETTINGS::park(process_dsp);
+}
+
+static void __not_in_flash_func(process_dsp)(void)
+{
   static bool tx = false;
+  // core 0's copy of the radio, changed only between samples
+  static MAILBOX::command_t command = {DEFAULT_MODE,false,0,0,0.0f};
+  static uint8_t mute_count = 0;
+  static uint8_t agc_count = 0;
+  if (MAILBOX::receive(command))
+  {
+    if (command.mute!=mute_count)
+    {
+      mute_count = command.mute;
+      DSP::mute();
+    }
+    if (command.agc!=agc_count)
+    {
+      agc_count = command.agc;
+      DSP::agc_peak = command.agc_peak;
+    }
+  }
+  const radio_mode_t mode = (radio_mode_t)command.mode;
   if (tx)
   {
     // TX, check if changed to RX
@@ -463,32 +701,37 @@ void __not_in_flash_func(loop)(void)
         adc_value_ready = false;
         int16_t tx_i = 0;
         int16_t tx_q = 0;
-        switch (radio.mode)
+        switch (mode)
         {
           case MODE_LSB: DSP::process_mic(adc_value,tx_i,tx_q);     break;
           case MODE_USB: DSP::process_mic(adc_value,tx_q,tx_i);     break;
-          case MODE_CWL: CW::process_cw(radio.keydown,tx_i,tx_q);   break;
-          case MODE_CWU: CW::process_cw(radio.keydown,tx_q,tx_i);   break;
+          case MODE_CWL: CW::process_cw(command.keydown,tx_i,tx_q);   break;
+          case MODE_CWU: CW::process_cw(command.keydown,tx_q,tx_i);   break;
         }
+        // carrier and opposite sideband suppression, CW goes
+        // through the same mixer so it's corrected too
+        TXCAL::correct(tx_i,tx_q);
         tx_i = constrain(tx_i,-512,+511);
         tx_q = constrain(tx_q,-512,+511);
         dac_value_i_p = 512+tx_i;
         dac_value_i_n = 511-tx_i;
         dac_value_q_p = 512+tx_q;
         dac_value_q_n = 511-tx_q;
-        if (radio.mode==MODE_LSB || radio.mode==MODE_USB)
+        if (mode==MODE_LSB || mode==MODE_USB)
         {
           mic_peak_level = DSP::get_mic_peak_level(adc_value);
         }
-        else if (radio.mode==MODE_CWL || radio.mode==MODE_CWU)
+        else if (mode==MODE_CWL || mode==MODE_CWU)
         {
           // generate the sidetone
-          int32_t dac_audio = CW::sidetone(radio.keydown);
+          int32_t dac_audio = CW::sidetone(command.keydown);
           dac_audio = constrain(dac_audio,-2048l,+2047l);
           dac_audio += 2048l;
           dac_h = dac_audio >> 6;
           dac_l = dac_audio & 0x3f;
         }
+        // step the T/R sequencer
+        TR::process(CW::keyup,radio.tx_enable);
       }
     }
     else
@@ -517,21 +760,37 @@ void __not_in_flash_func(loop)(void)
       if (adc_value_ready)
       {
         adc_value_ready = false;
+        // step the T/R sequencer
+        const bool tr_mute = TR::process(CW::keyup,radio.tx_enable);
+        // correct I/Q gain and phase before the image rejection
+        float in_i = adc_value_i;
+        float in_q = adc_value_q;
+        IQBAL::correct(in_i,in_q);
+        // measure a carrier for the TCXO calibration
+        TCXOCAL::process(in_i,in_q);
+        // signal detect for the scanner
+        SCAN::detect(in_i,in_q);
+        // hand the I/Q to the spectrum on core 1
+        SPECTRUM::capture(in_i,in_q);
         int32_t rx_value = 0;
-        switch (radio.mode)
+        switch (mode)
         {
-          case MODE_LSB: rx_value = (int32_t)DSP::process_ssb(adc_value_i,adc_value_q); break;
-          case MODE_USB: rx_value = (int32_t)DSP::process_ssb(adc_value_q,adc_value_i); break;
-          case MODE_CWL: rx_value = (int32_t)DSP::process_cw(adc_value_i,adc_value_q);  break;
-          case MODE_CWU: rx_value = (int32_t)DSP::process_cw(adc_value_q,adc_value_i);  break;
+          case MODE_LSB: rx_value = (int32_t)DSP::process_ssb(in_i,in_q); break;
+          case MODE_USB: rx_value = (int32_t)DSP::process_ssb(in_q,in_i); break;
+          case MODE_CWL: rx_value = (int32_t)DSP::process_cw(in_i,in_q);  break;
+          case MODE_CWU: rx_value = (int32_t)DSP::process_cw(in_q,in_i);  break;
         }
-        if (VFA::active)
+        // duck the receiver under any prompt
+        const bool talking = PROMPT::active();
+        int32_t prompt_value = 0;
+        if (talking && MIXER::ducked())
         {
-          rx_value = (rx_value>>4) + VFA::announce();
+          prompt_value = PROMPT::announce();
         }
-        else if (ANNOUNCE::active)
+        rx_value = MIXER::mix(rx_value,prompt_value,talking);
+        if (tr_mute)
         {
-          rx_value = (rx_value>>4) + ANNOUNCE::announce();
+          rx_value = 0;
         }
         const int32_t dac_audio = constrain(rx_value,-2048l,+2047l)+2048l;
         dac_h = dac_audio >> 6;
@@ -541,6 +800,233 @@ void __not_in_flash_func(loop)(void)
   }
 }
 
+static void get_state(saved_state_t &state)
+{
+  memset(&state,0,sizeof(state));
+  state.frequency = radio.frequency;
+  state.tuning_step = radio.tuning_step;
+  state.volume = radio.volume;
+  state.mode = radio.mode;
+  state.cw_mode = radio.cw_mode;
+  state.cw_filter = radio.cw_filter;
+  state.qsk_mode = radio.qsk_mode;
+  state.auto_mode = radio.auto_mode;
+}
+
+static void restore_settings(void)
+{
+  // core 0 in setup(), sanity check everything
+  SETTINGS::init();
+  saved_state_t state;
+  if (SETTINGS::read(SETTINGS_TYPE_STATE,0,&state,sizeof(state)))
+  {
+    radio.frequency = constrain(state.frequency,MIN_FREQUENCY,MAX_FREQUENCY);
+    if (state.tuning_step==10ul || state.tuning_step==100ul || state.tuning_step==1000ul)
+    {
+      radio.tuning_step = state.tuning_step;
+    }
+    radio.volume = constrain(state.volume,MIN_VOL,MAX_VOL);
+    if (state.mode<=MODE_CWU)
+    {
+      radio.mode = (radio_mode_t)state.mode;
+    }
+    radio.cw_mode = (state.cw_mode==CW_STRAIGHT)?CW_STRAIGHT:CW_PADDLE;
+    if (state.cw_filter<CWFILTER::num_bandwidths)
+    {
+      radio.cw_filter = state.cw_filter;
+    }
+    radio.qsk_mode = (state.qsk_mode==QSK_FULL)?QSK_FULL:QSK_SEMI;
+    radio.auto_mode = state.auto_mode;
+  }
+  int32_t ppb = 0;
+  if (SETTINGS::read(SETTINGS_TYPE_TCXO,0,&ppb,sizeof(ppb)) && abs(ppb)<=TCXO_MAX_PPB)
+  {
+    tcxo_ppb = ppb;
+  }
+  MEMORY::init(MIN_FREQUENCY,MAX_FREQUENCY);
+  get_state(saved_state);
+}
+
+static void save_settings(void)
+{
+  // core 1, write the state once it has settled
+  // and only when core 0 won't be reading flash
+  static saved_state_t pending;
+  static uint32_t change_time = 0;
+  saved_state_t state;
+  get_state(state);
+  if (memcmp(&state,&pending,sizeof(state))!=0)
+  {
+    // changed, restart the timer
+    pending = state;
+    change_time = millis();
+    return;
+  }
+  if (memcmp(&pending,&saved_state,sizeof(pending))==0)
+  {
+    return;
+  }
+  if (millis()-change_time<SETTINGS_DELAY)
+  {
+    return;
+  }
+  if (radio.tx_enable || !TR::is_rx() || PROMPT::active())
+  {
+    return;
+  }
+  if (SETTINGS::write(SETTINGS_TYPE_STATE,0,&pending,sizeof(pending)))
+  {
+    saved_state = pending;
+  }
+}
+
+static void change_mode(const radio_mode_t mode)
+{
+  // core 1, mute while the DSP changes over
+  radio.mode = mode;
+  MAILBOX::mute();
+  MAILBOX::set_mode(mode);
+  MAILBOX::post();
+  if (!SCAN::active())
+  {
+    ANNOUNCE::setMode(mode);
+  }
+}
+
+static void change_volume(const int32_t clicks)
+{
+  // core 1, not accelerated
+  const int32_t volume = (int32_t)radio.volume + clicks * (int32_t)VOLUME_STEP;
+  radio.volume = constrain(volume,(int32_t)MIN_VOL,(int32_t)MAX_VOL);
+}
+
+static void calibrate_tcxo(void)
+{
+  // core 1, use the carrier measurement once it's done
+  // and only when core 0 won't be reading flash
+  if (tcxo_cal_frequency==0 || TCXOCAL::busy())
+  {
+    return;
+  }
+  if (radio.tx_enable || !TR::is_rx() || PROMPT::active())
+  {
+    return;
+  }
+  const uint32_t frequency = tcxo_cal_frequency;
+  tcxo_cal_frequency = 0;
+  float offset = 0.0f;
+  if (radio.frequency!=frequency || radio.mode!=tcxo_cal_mode || !TCXOCAL::result(offset))
+  {
+    // retuned or no clear carrier
+    VFA::setCalibration(false);
+    return;
+  }
+  // the LO is above the carrier in CWL so a high LO raises
+  // the beat note, in CWU it's below and lowers it
+  const bool cwl = tcxo_cal_mode==MODE_CWL;
+  const float lo = (float)(cwl?frequency+CW_SIDETONE:frequency-CW_SIDETONE);
+  const float error = (cwl?offset:-offset) / lo;
+  const int32_t ppb = tcxo_ppb + (int32_t)lroundf(error * 1.0e9f);
+  if (abs(ppb)>TCXO_MAX_PPB)
+  {
+    VFA::setCalibration(false);
+    return;
+  }
+  tcxo_ppb = ppb;
+  si5351.set_correction(tcxo_ppb,SI5351_PLL_INPUT_XO);
+  VFA::setCalibration(SETTINGS::write(SETTINGS_TYPE_TCXO,0,&tcxo_ppb,sizeof(tcxo_ppb)));
+}
+
+static void recall_memory(const uint32_t ch)
+{
+  // core 1, the controls task tunes it unless scanning
+  const MEMORY::channel_t &channel = MEMORY::get(ch);
+  if (channel.tuning_step==10ul || channel.tuning_step==100ul || channel.tuning_step==1000ul)
+  {
+    radio.tuning_step = channel.tuning_step;
+  }
+  if (channel.mode<=MODE_CWU && channel.mode!=radio.mode)
+  {
+    change_mode((radio_mode_t)channel.mode);
+  }
+  radio.frequency = channel.frequency;
+}
+
+static void store_memory(void)
+{
+  // core 1, write a channel to be stored
+  // only when core 0 won't be reading flash
+  if (memory_store.frequency==0)
+  {
+    return;
+  }
+  if (radio.tx_enable || !TR::is_rx() || PROMPT::active())
+  {
+    return;
+  }
+  const uint32_t ch = MEMORY::store(memory_store.frequency,memory_store.tuning_step,memory_store.mode);
+  memory_store.frequency = 0;
+  if (ch==MEMORY_NONE)
+  {
+    VFA::setChannel(0);
+    return;
+  }
+  memory_channel = ch;
+  VFA::setChannel(ch + 1u);
+}
+
+static bool scan_next(void)
+{
+  // core 1, the next memory or the next step up the band
+  if (radio.tx_enable)
+  {
+    return false;
+  }
+  if (scan_memories)
+  {
+    const uint32_t ch = MEMORY::next(memory_channel,+1);
+    if (ch==MEMORY_NONE)
+    {
+      return false;
+    }
+    memory_channel = ch;
+    recall_memory(ch);
+  }
+  else
+  {
+    const uint32_t frequency = (radio.frequency / radio.tuning_step + 1ul) * radio.tuning_step;
+    radio.frequency = frequency>MAX_FREQUENCY?MIN_FREQUENCY:frequency;
+  }
+  // straight to the Si5351 (fast path, same dividers), the
+  // controls task leaves the frequency alone while scanning
+  task_tune();
+  return true;
+}
+
+static bool scan_ready(void)
+{
+  return !si5351.busy();
+}
+
+static void scan_found(void)
+{
+  // say where, a memory by its channel number
+  if (scan_memories)
+  {
+    VFA::setChannel(memory_channel + 1u);
+  }
+  else
+  {
+    SCHED::trigger(announce_task);
+  }
+}
+
+static void start_scan(const bool memories)
+{
+  scan_memories = memories;
+  SCAN::start();
+}
+
 static void process_ssb_tx(void)
 {
   // 1. mute the receiver
@@ -553,24 +1039,16 @@ static void process_ssb_tx(void)
 
   // mute the receiver
   analogWrite(PIN_VOL,MUTE);
-  delay(10);
-
-  // disable QSD
-  digitalWrite(PIN_RXN,HIGH);
-
-  // enable MIC processing
-  radio.tx_enable = true;
-  delay(10);
 
-  // enable QSE and TX bias
-  digitalWrite(PIN_TXN,LOW);
-  digitalWrite(PIN_TXBIAS,HIGH);
-  delay(50);
+  // RX mixer off, enable MIC processing, TX mixer and bias on
+  TR::request(true);
+  TR::wait_tx();
 
-  // wait for PTT release
+  // wait for PTT release (or RX from CAT)
   uint32_t tx_LED_update = 0;
-  while (digitalRead(PIN_PTT)==LOW)
+  while (digitalRead(PIN_PTT)==LOW || cat_ptt)
   {
+    SCHED::run(SCHED_TX);
     const uint32_t now = millis();
     if (now>tx_LED_update)
     {
@@ -580,6 +1058,16 @@ static void process_ssb_tx(void)
   }
 }
 
+static void tx_delay(const uint32_t ms)
+{
+  // wait but keep the TX tasks going
+  const uint32_t delay_time = millis()+ms;
+  while (delay_time>millis())
+  {
+    SCHED::run(SCHED_TX);
+  }
+}
+
 static void cw_dit_delay(const uint32_t ms,const uint32_t level)
 {
   // delay here for dit and check for dah
@@ -587,6 +1075,7 @@ static void cw_dit_delay(const uint32_t ms,const uint32_t level)
   analogWrite(PIN_1LED,level);
   while (delay_time>millis())
   {
+    SCHED::run(SCHED_TX);
     // check for dah
     if (digitalRead(PIN_PADB)==LOW)
     {
@@ -602,6 +1091,7 @@ static void cw_dah_delay(const uint32_t ms,const uint32_t level)
   analogWrite(PIN_1LED,level);
   while (delay_time>millis())
   {
+    SCHED::run(SCHED_TX);
     // check for dit
     if (digitalRead(PIN_PTT)==LOW)
     {
@@ -610,20 +1100,31 @@ static void cw_dah_delay(const uint32_t ms,const uint32_t level)
   }
 }
 
-static void process_key(void)
+static void qsk_key_down(void)
 {
-  // disable QSD
-  digitalWrite(PIN_RXN,HIGH);
-  delay(10);
+  // with full QSK the receiver is on between elements
+  if (radio.qsk_mode==QSK_FULL)
+  {
+    TR::request(true);
+    TR::wait_tx();
+  }
+}
 
-  // enable TX processing
-  radio.keydown = false;
-  radio.tx_enable = true;
+static void qsk_key_up(void)
+{
+  // back to receive once the envelope and hang time are done
+  if (radio.qsk_mode==QSK_FULL)
+  {
+    TR::request(false);
+  }
+}
 
-  // enable QSE and TX bias
-  digitalWrite(PIN_TXN,LOW);
-  digitalWrite(PIN_TXBIAS,HIGH);
-  delay(10);
+static void process_key(void)
+{
+  // RX mixer off, enable TX processing, TX mixer and bias on
+  MAILBOX::send_key(false);
+  TR::request(true);
+  TR::wait_tx();
 
   // stay here until timeout after key up (PTT released)
   uint32_t cw_timeout = millis() + CW_TIMEOUT;
@@ -634,19 +1135,21 @@ static void process_key(void)
       if (digitalRead(PIN_PTT)==LOW)
       {
         // indicate PTT pressed
+        qsk_key_down();
         digitalWrite(LED_BUILTIN,HIGH);
-        radio.keydown = true;
+        MAILBOX::send_key(true);
         cw_timeout = millis() + CW_TIMEOUT;
         analogWrite(PIN_1LED,255u);
-        delay(20);
+        tx_delay(20);
       }
       else
       {
         // indicate PTT released
         digitalWrite(LED_BUILTIN,LOW);
-        radio.keydown = false;
+        MAILBOX::send_key(false);
+        qsk_key_up();
         analogWrite(PIN_1LED,0u);
-        delay(20);
+        tx_delay(20);
         if (millis()>cw_timeout)
         {
           break;
@@ -664,10 +1167,12 @@ static void process_key(void)
         // dit
         dit_latched = false;
         cw_dit_delay(CW_TIME,0u);
-        radio.keydown = true;
+        qsk_key_down();
+        MAILBOX::send_key(true);
         digitalWrite(LED_BUILTIN,HIGH);
         cw_dit_delay(CW_TIME,255u);
-        radio.keydown = false;
+        MAILBOX::send_key(false);
+        qsk_key_up();
         digitalWrite(LED_BUILTIN,LOW);
         cw_timeout = millis() + CW_TIMEOUT;
       }
@@ -676,10 +1181,12 @@ static void process_key(void)
         // dah
         dah_latched = false;
         cw_dah_delay(CW_TIME,0u);
-        radio.keydown = true;
+        qsk_key_down();
+        MAILBOX::send_key(true);
         digitalWrite(LED_BUILTIN,HIGH);
         cw_dah_delay(CW_TIME*3,255u);
-        radio.keydown = false;
+        MAILBOX::send_key(false);
+        qsk_key_up();
         digitalWrite(LED_BUILTIN,LOW);
         cw_timeout = millis() + CW_TIMEOUT;
       }
@@ -689,57 +1196,204 @@ static void process_key(void)
       }
     }
   }
+}
 
-  // mute during transition back to receive
-  analogWrite(PIN_VOL,MUTE);
-  delay(50);
+static uint32_t cat_get_frequency(void)
+{
+  return radio.frequency;
 }
 
-void __not_in_flash_func(loop1)(void)
+static bool cat_set_frequency(const uint32_t frequency)
 {
-  // remember the current frequency and button state
-  static uint32_t current_frequency = 0;
-  static uint32_t button_start_time = 0;
-  static uint32_t vfa_announce_time = 0;
-  static uint32_t current_vfa_frequency = 0;
-  static uint32_t new_vfa_frequency = 0;
-  static bool vfa_announce = false;
+  // tuned by the controls task like a turn of the knob
+  if (radio.tx_enable || frequency<MIN_FREQUENCY || frequency>MAX_FREQUENCY)
+  {
+    return false;
+  }
+  SCAN::stop();
+  radio.frequency = frequency;
+  return true;
+}
+
+static uint8_t cat_get_mode(void)
+{
+  // CWU is Kenwood CW, CWL is CW-R
+  switch (radio.mode)
+  {
+    case MODE_LSB: return 1u;
+    case MODE_USB: return 2u;
+    case MODE_CWU: return 3u;
+    case MODE_CWL: return 7u;
+  }
+  return 1u;
+}
+
+static bool cat_set_mode(const uint8_t mode)
+{
+  radio_mode_t new_mode = MODE_LSB;
+  switch (mode)
+  {
+    case 1u: new_mode = MODE_LSB; break;
+    case 2u: new_mode = MODE_USB; break;
+    case 3u: new_mode = MODE_CWU; break;
+    case 7u: new_mode = MODE_CWL; break;
+    default: return false;
+  }
+  if (radio.tx_enable)
+  {
+    return false;
+  }
+  SCAN::stop();
+  if (radio.mode!=new_mode)
+  {
+    change_mode(new_mode);
+  }
+  return true;
+}
+
+static bool cat_get_tx(void)
+{
+  return radio.tx_enable;
+}
+
+static bool cat_set_tx(const bool tx)
+{
+  // SSB only, CW is keyed from the paddle
+  if (tx && radio.mode!=MODE_LSB && radio.mode!=MODE_USB)
+  {
+    return false;
+  }
+  cat_ptt = tx;
+  return true;
+}
 
+static uint32_t cat_get_smeter(void)
+{
+  // TS-480 scale, S9 is 15 and S9+60dB is 30
+  uint32_t s_units = 0;
+  uint32_t db_over = 0;
+  DSP::signal_report(s_units,db_over);
+  return db_over>0?15u + db_over / 4u:s_units * 15u / 9u;
+}
+
+static void task_i2c(void)
+{
+  // send any queued Si5351 writes
+  si5351.poll();
+}
+
+static void task_meter(void)
+{
   // update volume and LED smeter
   analogWrite(PIN_VOL,radio.volume);
   analogWrite(PIN_1LED,DSP::smeter());
-    
-  // what's the rotary encoder doing?
-  const uint8_t rotary = r.process();
+}
+
+static void task_settings(void)
+{
+  // save any changed settings
+  save_settings();
+  calibrate_tcxo();
+  store_memory();
+}
+
+static void task_announce(void)
+{
+  // the frequency has settled, say it
+  announced_khz = radio.frequency / 1000ul;
+  VFA::setFreq(radio.frequency);
+}
+
+static void task_tune(void)
+{
+  // update the frequency
+  const uint32_t frequency = radio.frequency;
+  const uint32_t correct4cw = radio.mode==MODE_CWL?+CW_SIDETONE:radio.mode==MODE_CWU?-CW_SIDETONE:0u;
+  si5351.set_freq_quadrature((frequency + correct4cw)*SI5351_FREQ_MULT,QUADRATURE_DIVISOR,SI5351_CLK0,SI5351_CLK1);
+  IQBAL::set_frequency(frequency);
+  TXCAL::set_frequency(frequency);
+  SPECTRUM::set_centre(frequency + correct4cw);
+
+  // update the mode
+  if (radio.auto_mode)
+  {
+    volatile radio_mode_t new_mode = MODE_LSB;
+    if (frequency == 7074000ul)
+    {
+      new_mode = MODE_USB;
+    }
+    else if (frequency >= 7000000ul && frequency <= 7060000ul)
+    {
+      new_mode = MODE_CWL;
+    }
+    if (radio.mode != new_mode)
+    {
+      // only update the mode if it has changed
+      change_mode(new_mode);
+      if (new_mode==MODE_LSB || new_mode==MODE_USB)
+      {
+        // changed to SSB
+        radio.tuning_step = 1000u;
+      }
+      else if (radio.tuning_step==1000u)
+      {
+        // changed to CW
+        radio.tuning_step = 100u;
+      }
+    }
+  }
+}
+
+static void task_controls(void)
+{
+  // remember the current frequency and button state
+  static uint32_t current_frequency = 0;
+  static uint32_t button_start_time = 0;
+  static uint32_t button_release_time = 0;
+  static uint32_t button_clicks = 0;
+
+  // what's the rotary encoder done since last time?
+  int32_t steps = 0;
+  const int32_t clicks = ENCODER::take(steps);
 
   volatile static enum
   {
     STATE_TUNING,
     STATE_BUTTON_PRESS,
+    STATE_CLICK_WAIT,
     STATE_VOLUME,
-    STATE_WAIT_RELEASE
+    STATE_WAIT_RELEASE,
+    STATE_DEBOUNCE,
+    STATE_MEMORY,
+    STATE_MEMORY_PRESS
   } state = STATE_TUNING;
 
   switch (state)
   {
     case STATE_TUNING:
     {
-      // tuning
-      switch (rotary)
+      if (SCAN::active())
       {
-        case DIR_CW:
-        {
-          radio.frequency += radio.tuning_step - radio.frequency%radio.tuning_step;
-          radio.frequency = constrain(radio.frequency,MIN_FREQUENCY,MAX_FREQUENCY);
-          break;
-        }
-        case DIR_CCW:
+        // a turn or a press stops the scan where it is
+        if (clicks!=0 || digitalRead(PIN_ENCBUT)==LOW)
         {
-          const uint32_t modula = radio.frequency%radio.tuning_step;
-          radio.frequency -= (modula==0)?radio.tuning_step:modula;
-          radio.frequency = constrain(radio.frequency,MIN_FREQUENCY,MAX_FREQUENCY);
-          break;
+          SCAN::stop();
+          state = digitalRead(PIN_ENCBUT)==LOW?STATE_WAIT_RELEASE:STATE_TUNING;
         }
+        break;
+      }
+      // tuning, first step to a multiple of the step then whole steps
+      if (steps>0)
+      {
+        const uint32_t modula = radio.frequency%radio.tuning_step;
+        const uint32_t up = radio.tuning_step - modula + (uint32_t)(steps - 1) * radio.tuning_step;
+        radio.frequency = min(radio.frequency + up,MAX_FREQUENCY);
+      }
+      else if (steps<0)
+      {
+        const uint32_t modula = radio.frequency%radio.tuning_step;
+        const uint32_t down = ((modula==0)?radio.tuning_step:modula) + (uint32_t)(-steps - 1) * radio.tuning_step;
+        radio.frequency = radio.frequency - MIN_FREQUENCY>down?radio.frequency - down:MIN_FREQUENCY;
       }
       if (digitalRead(PIN_ENCBUT)==LOW)
       {
@@ -754,50 +1408,145 @@ void __not_in_flash_func(loop1)(void)
       if (press_time>LONG_PRESS_TIME)
       {
         // change mode
-        DSP::mute();
         switch (radio.mode)
         {
-          case MODE_LSB: radio.mode = MODE_USB; break;
-          case MODE_USB: radio.mode = MODE_CWL; break;
-          case MODE_CWL: radio.mode = MODE_CWU; break;
-          case MODE_CWU: radio.mode = MODE_LSB; break;
+          case MODE_LSB: change_mode(MODE_USB); break;
+          case MODE_USB: change_mode(MODE_CWL); break;
+          case MODE_CWL: change_mode(MODE_CWU); break;
+          case MODE_CWU: change_mode(MODE_LSB); break;
         }
-        ANNOUNCE::setMode(radio.mode);
+        button_clicks = 0;
         state = STATE_WAIT_RELEASE;
         break;
       }
-      switch (rotary)
+      if (clicks!=0)
       {
-        case DIR_CW:  radio.volume += VOLUME_STEP; state = STATE_VOLUME; break;
-        case DIR_CCW: radio.volume -= VOLUME_STEP; state = STATE_VOLUME; break;
+        change_volume(clicks);
+        button_clicks = 0;
+        state = STATE_VOLUME;
       }
       if (digitalRead(PIN_ENCBUT)==HIGH)
       {
-        // change step
         if (press_time<50)
         {
           // avoid bounce
           break;
         }
-        switch (radio.tuning_step)
+        // short press, wait to see if there's another
+        button_clicks++;
+        button_release_time = millis();
+        state = STATE_CLICK_WAIT;
+      }
+      break;
+    }
+    case STATE_CLICK_WAIT:
+    {
+      const uint32_t wait_time = millis()-button_release_time;
+      if (digitalRead(PIN_ENCBUT)==LOW)
+      {
+        if (wait_time>50)
         {
-          case 1000: radio.tuning_step = 100;  break;
-          case 100:  radio.tuning_step = 10;   break;
-          case 10:   radio.tuning_step = 1000; break;
+          // another click
+          button_start_time = millis();
+          state = STATE_BUTTON_PRESS;
+        }
+        break;
+      }
+      if (wait_time<DOUBLE_CLICK_TIME)
+      {
+        break;
+      }
+      const uint32_t n = button_clicks;
+      button_clicks = 0;
+      state = STATE_TUNING;
+      switch (n)
+      {
+        case 1:
+        {
+          // single click, change step
+          switch (radio.tuning_step)
+          {
+            case 1000: radio.tuning_step = 100;  break;
+            case 100:  radio.tuning_step = 10;   break;
+            case 10:   radio.tuning_step = 1000; break;
+          }
+          ANNOUNCE::setStep(radio.tuning_step);
+          break;
+        }
+        case 2:
+        {
+          // double click, change CW filter
+          if (radio.mode==MODE_CWL || radio.mode==MODE_CWU)
+          {
+            radio.cw_filter = (radio.cw_filter + 1u) % CWFILTER::num_bandwidths;
+            const uint32_t bandwidth = CWFILTER::bandwidths[radio.cw_filter];
+            CWFILTER::set_bandwidth(bandwidth,CW_SIDETONE);
+            VFA::setNumber(bandwidth);
+          }
+          break;
+        }
+        case 3:
+        {
+          // triple click, speak S meter, volume and keyer speed
+          uint32_t s_units = 0;
+          uint32_t db_over = 0;
+          DSP::signal_report(s_units,db_over);
+          const uint32_t volume = (radio.volume - MIN_VOL) / VOLUME_STEP;
+          const bool cw = radio.mode==MODE_CWL || radio.mode==MODE_CWU;
+          VFA::setStatus(s_units,db_over,volume,cw?1200u/CW_TIME:0u);
+          break;
+        }
+        case 4:
+        {
+          // four clicks, calibrate the TCXO on a carrier
+          // tuned in with the beat note at the sidetone
+          if (radio.mode==MODE_CWL || radio.mode==MODE_CWU)
+          {
+            tcxo_cal_frequency = radio.frequency;
+            tcxo_cal_mode = radio.mode;
+            TCXOCAL::start(CW_SIDETONE);
+          }
+          break;
+        }
+        case 5:
+        {
+          // five clicks, store in a memory channel
+          // (written by the settings task)
+          memory_store.frequency = radio.frequency;
+          memory_store.tuning_step = radio.tuning_step;
+          memory_store.mode = radio.mode;
+          break;
+        }
+        case 6:
+        {
+          // six clicks, step through the memory channels
+          if (!MEMORY::used(memory_channel))
+          {
+            memory_channel = MEMORY::next(memory_channel,+1);
+          }
+          if (memory_channel==MEMORY_NONE)
+          {
+            memory_channel = 0;
+            VFA::setChannel(0);
+            break;
+          }
+          recall_memory(memory_channel);
+          VFA::setChannel(memory_channel + 1u);
+          state = STATE_MEMORY;
+          break;
+        }
+        case 7:
+        {
+          // seven clicks, scan up the band from here
+          start_scan(false);
+          break;
         }
-        ANNOUNCE::setStep(radio.tuning_step);
-        state = STATE_WAIT_RELEASE;
       }
       break;
     }
     case STATE_VOLUME:
     {
-      switch (rotary)
-      {
-        case DIR_CW:  radio.volume += VOLUME_STEP; break;
-        case DIR_CCW: radio.volume -= VOLUME_STEP; break;
-      }
-      radio.volume = constrain(radio.volume,MIN_VOL,MAX_VOL);
+      change_volume(clicks);
       if (digitalRead(PIN_ENCBUT)==HIGH)
       {
         state = STATE_WAIT_RELEASE;
@@ -808,83 +1557,85 @@ void __not_in_flash_func(loop1)(void)
     {
       if (digitalRead(PIN_ENCBUT)==HIGH)
       {
-        // debounce
         button_start_time = 0;
+        button_release_time = millis();
+        state = STATE_DEBOUNCE;
+      }
+      break;
+    }
+    case STATE_DEBOUNCE:
+    {
+      if (millis()-button_release_time>=50)
+      {
         state = STATE_TUNING;
-        delay(50);
       }
+      break;
     }
-  }
-
-  // frequency changed?
-  if (radio.frequency != current_frequency)
-  {
-    // update the frequency
-    current_frequency = radio.frequency;
-    new_vfa_frequency = radio.frequency / 1000ul;
-    const uint32_t correct4cw = radio.mode==MODE_CWL?+CW_SIDETONE:radio.mode==MODE_CWU?-CW_SIDETONE:0u;
-    const uint64_t f = (current_frequency + correct4cw) * SI5351_FREQ_MULT;
-    const uint64_t p = (current_frequency + correct4cw) * QUADRATURE_DIVISOR * SI5351_FREQ_MULT;
-    si5351.set_freq_manual(f,p,SI5351_CLK0);
-    si5351.set_freq_manual(f,p,SI5351_CLK1);
-
-    // reset announce time for any change
-    vfa_announce_time = millis() + VFA_DELAY;
-
-    // update the mode
-    if (radio.auto_mode)
+    case STATE_MEMORY:
     {
-      volatile radio_mode_t new_mode = MODE_LSB;
-      if (radio.frequency == 7074000ul)
+      // turn for the next or previous channel, press to
+      // leave, hold to scan the channels
+      if (clicks!=0)
       {
-        new_mode = MODE_USB;
+        const uint32_t ch = MEMORY::next(memory_channel,clicks);
+        if (ch!=MEMORY_NONE)
+        {
+          memory_channel = ch;
+          recall_memory(ch);
+          VFA::setChannel(ch + 1u);
+        }
       }
-      else if (radio.frequency >= 7000000ul && radio.frequency <= 7060000ul)
+      if (digitalRead(PIN_ENCBUT)==LOW)
       {
-        new_mode = MODE_CWL;
+        button_start_time = millis();
+        state = STATE_MEMORY_PRESS;
       }
-      if (radio.mode != new_mode)
+      break;
+    }
+    case STATE_MEMORY_PRESS:
+    {
+      const uint32_t press_time = millis()-button_start_time;
+      if (press_time>LONG_PRESS_TIME)
       {
-        // only update the mode if it has changed
-        DSP::mute();
-        ANNOUNCE::setMode(new_mode);
-        radio.mode = new_mode;
-        if (new_mode==MODE_LSB || new_mode==MODE_USB)
-        {
-          // changed to SSB
-          radio.tuning_step = 1000u;
-        }
-        else if (radio.tuning_step==1000u)
-        {
-          // changed to CW
-          radio.tuning_step = 100u;
-        }
+        start_scan(true);
+        state = STATE_WAIT_RELEASE;
+      }
+      else if (digitalRead(PIN_ENCBUT)==HIGH && press_time>=50)
+      {
+        // short press, back to tuning
+        button_release_time = millis();
+        state = STATE_DEBOUNCE;
       }
+      break;
     }
   }
 
-  // VFA processing
-  if (current_vfa_frequency != new_vfa_frequency)
-  {
-    current_vfa_frequency = new_vfa_frequency;
-    vfa_announce = true;
-  }
+  // a prompt the queue had no room for, core 0 frees
+  // a stale entry each sample so it's soon said
+  PROMPT::retry();
 
-  // announce frequency
-  if (vfa_announce)
+  // frequency changed? tune now, announce once it settles,
+  // the scanner tunes for itself
+  if (radio.frequency != current_frequency && !SCAN::active())
   {
-    if (millis() > vfa_announce_time)
+    current_frequency = radio.frequency;
+    SCHED::trigger(tune_task);
+    if (current_frequency / 1000ul != announced_khz || SCHED::pending(announce_task))
     {
-      vfa_announce = false;
-      VFA::setFreq(radio.frequency);
+      SCHED::trigger_after(announce_task,VFA_DELAY);
     }
   }
+}
 
+static void task_ptt(void)
+{
   // check for PTT
-  const bool b_PTT = (digitalRead(PIN_PTT)==LOW);
+  const bool ssb = radio.mode==MODE_LSB || radio.mode==MODE_USB;
+  const bool b_PTT = (digitalRead(PIN_PTT)==LOW) || (cat_ptt && ssb);
   const bool b_PADB = (digitalRead(PIN_PADB)==LOW);
   if (b_PTT || b_PADB)
   {
+    SCAN::stop();
     bool back_to_receive = false;
     const float saved_agc = DSP::agc_peak;
     if (radio.mode==MODE_CWL || radio.mode==MODE_CWU)
@@ -900,14 +1651,36 @@ void __not_in_flash_func(loop1)(void)
     if (back_to_receive)
     {
       // back to receive
-      digitalWrite(PIN_TXBIAS,LOW);
-      digitalWrite(PIN_TXN,HIGH);
-      radio.tx_enable = false;
-      delay(10);
-      digitalWrite(PIN_RXN,LOW);
+      // TX bias off, TX mixer off, RX mixer on, unmute
+      TR::request(false);
+      TR::wait_rx();
       digitalWrite(LED_BUILTIN,LOW);
-      delay(50);
-      DSP::agc_peak = saved_agc;
+      MAILBOX::set_agc(saved_agc);
+      MAILBOX::post();
     }
   }
+}
+
+#if defined DEBUG_SCHED && DEBUG_SCHED==1
+static void task_report(void)
+{
+  // task run times every 5 seconds
+  for (uint32_t id=0;id<SCHED::num_tasks;id++)
+  {
+    const SCHED::task_t &t = SCHED::stats(id);
+    const uint32_t mean = t.runs>0?(uint32_t)(t.total_us / t.runs):0u;
+    report_port.printf("%-8s runs %lu late %lu mean %luus max %luus\n",t.name,t.runs,t.late,mean,t.max_us);
+  }
+  report_port.printf("scan %lu ch/s\n",SCAN::rate());
+  // quadrature retunes since power up, a reset is a click
+  const Si5351PhaseStats &phase = si5351.phase_stats;
+  report_port.printf("si5351 fast %lu full %lu reset %lu\n",phase.fast,phase.full,phase.resets);
+  SCHED::clear_stats();
+}
+#endif
+
+void __not_in_flash_func(loop1)(void)
+{
+  // everything on core 1 is a task
+  SCHED::run(SCHED_RX);
 }
\ No newline at end of file
@@ -20,201 +20,125 @@
 #ifndef VFA_H
 #define VFA_H
 
+#include "prompt.h"
+
 // Voice Frequency Announce
 #define VFA_TESTS 0
 
 namespace VFA
 {
-  #include "vfadata.h"
-
-  #define WORD_POINT 16u
-  #define WORD_MEGAHERTZ 17u
-
-  const static uint32_t data_size = sizeof(data);
+  #define WORD_POINT PROMPT::CLIP_POINT
+  #define WORD_MEGAHERTZ PROMPT::CLIP_MEGAHERTZ
 
-  static const struct
-  {
-    const uint32_t begin;
-    const uint32_t end;
-  }
-  word[] =
+  static void setFreq(const uint32_t frequency)
   {
-    {356ul,31294ul},     // zero
-    {40669ul,65669ul},   // one
-    {68794ul,93794ul},   // two
-    {106294ul,131294ul}, // three
-    {140669ul,165669ul}, // four
-    {162544ul,193794ul}, // five
-    {193794ul,225044ul}, // six
-    {225044ul,253169ul}, // seven
-    {250044ul,275044ul}, // eight
-    {275044ul,300044ul}, // nine
-    {300044ul,328169ul}, // ten
-    {328169ul,356294ul}, // eleven
-    {353169ul,384419ul}, // twelve
-    {387544ul,410981ul}, // thirteen
-    {412544ul,428169ul}, // fourteen
-    {429731ul,453169ul}, // fifteen
-    {456294ul,473481ul}, // point
-    {473481ul,509419ul}  // megahertz
-  };
-
-  // n.nnn MHz
-  volatile static uint32_t speak[6] = {0};
-  volatile static uint32_t p_word = 0;
-  volatile static uint32_t p_sample = 0;
-  volatile static bool active = false;
-
-  static void __not_in_flash_func(setFreq)(const uint32_t frequency)
-  {
-    if (active)
-    {
-      return;
-    }
+    // n.nnn MHz
     const uint32_t MHz = frequency / 1000000ul;
     const uint32_t KHz = (frequency - MHz*1000000ul) / 1000;
     const uint32_t dig3 = KHz / 100ul;
     const uint32_t dig2 = (KHz - dig3*100ul) / 10ul;
     const uint32_t dig1 = KHz - dig3*100ul - dig2*10ul;
-    speak[0] = MHz;
-    speak[1] = WORD_POINT;
-    speak[2] = dig3;
-    speak[3] = dig2;
-    speak[4] = dig1;
-    speak[5] = WORD_MEGAHERTZ;
-    p_word = 0;
-    p_sample = word[speak[p_word]].begin;
-    active = true;
+    const uint8_t speak[6] =
+    {
+      (uint8_t)(PROMPT::CLIP_ZERO + MHz),
+      WORD_POINT,
+      (uint8_t)(PROMPT::CLIP_ZERO + dig3),
+      (uint8_t)(PROMPT::CLIP_ZERO + dig2),
+      (uint8_t)(PROMPT::CLIP_ZERO + dig1),
+      WORD_MEGAHERTZ
+    };
+    PROMPT::speak(speak,6,PROMPT_PRIORITY_LOW);
   }
 
-  static const int16_t __not_in_flash_func(announce)(void)
+  static void setNumber(const uint32_t number)
   {
-    if (!active)
-    {
-      return 0;
-    }
-    if (p_sample>=data_size)
+    // speak each digit, up to 6 digits
+    uint8_t digits[6] = {0};
+    uint8_t speak[6] = {0};
+    uint32_t n = 0;
+    uint32_t value = number;
+    do
     {
-      active = false;
-      return 0;
+      digits[n++] = value % 10ul;
+      value /= 10ul;
     }
-    const int16_t sample = (int16_t)data[p_sample++] - 128;
-    if (p_sample>word[speak[p_word]].end)
+    while (value>0 && n<6);
+    for (uint32_t i=0;i<n;i++)
     {
-      p_word++;
-      if (p_word>=6)
-      {
-        active = false;
-      }
-      else
-      {
-        p_sample = word[speak[p_word]].begin;
-      }
+      speak[i] = PROMPT::CLIP_ZERO + digits[n-i-1];
     }
-    return sample<<3;
+    PROMPT::speak(speak,n,PROMPT_PRIORITY_LOW);
   }
 
-#if defined VFA_TESTS && VFA_TESTS==1
-  static void __not_in_flash_func(init_test_1)(const uint32_t start = 0)
+  static void setStatus(const uint32_t s_units,const uint32_t db_over,const uint32_t volume,const uint32_t wpm)
   {
-    if (active)
-    {
-      return;
-    }
-    p_sample = start;
-    p_word = 0;
-    active = true;
+    // "S seven plus ten, V twelve, W two zero"
+    // no recordings of S, plus etc so they are Morse letters
+    PROMPT::phrase_t phrase = {};
+    PROMPT::add_morse(phrase,"...");
+    PROMPT::add_number(phrase,s_units);
+    if (db_over>0)
+    {
+      PROMPT::add_morse(phrase,".-.-.");
+      PROMPT::add_number(phrase,db_over);
+    }
+    PROMPT::add(phrase,PROMPT::CLIP_PAUSE);
+    PROMPT::add_morse(phrase,"...-");
+    PROMPT::add_number(phrase,volume);
+    if (wpm>0)
+    {
+      PROMPT::add(phrase,PROMPT::CLIP_PAUSE);
+      PROMPT::add_morse(phrase,".--");
+      PROMPT::add_number(phrase,wpm);
+    }
+    PROMPT::speak(phrase,PROMPT_PRIORITY_HIGH);
   }
 
-  static const int16_t __not_in_flash_func(run_test_1)(void)
+  static void setCalibration(const bool ok)
   {
-    // all data
-    if (!active)
-    {
-      return 0;
-    }
-    if (p_sample>=data_size)
-    {
-      active = false;
-      return 0;
-    }
-    const int16_t sample = (int16_t)data[p_sample++] - 128;
-    return sample<<2;
-  }
-
-  static void __not_in_flash_func(init_test_2)(void)
-  {
-    if (active)
-    {
-      return;
-    }
-    p_word = 0;
-    p_sample = word[p_word].begin;
-    active = true;
+    // "R" when the TCXO correction was updated, "?" when it wasn't
+    PROMPT::phrase_t phrase = {};
+    PROMPT::add_morse(phrase,ok?".-.":"..--..");
+    PROMPT::speak(phrase,PROMPT_PRIORITY_HIGH);
   }
 
-  static const int16_t __not_in_flash_func(run_test_2)(void)
+  static void setChannel(const uint32_t channel)
   {
-    // all words
-    if (!active)
-    {
-      return 0;
-    }
-    if (p_word>WORD_MEGAHERTZ || p_sample>=data_size)
+    // "M three" for memory channel 3, "M ?" for no channel (0),
+    // low priority so it waits for a mode change being said
+    PROMPT::phrase_t phrase = {};
+    PROMPT::add_morse(phrase,"--");
+    if (channel>0)
     {
-      active = false;
-      return 0;
+      PROMPT::add_number(phrase,channel);
     }
-    const int16_t sample = (int16_t)data[p_sample++] - 128;
-    if (p_sample>word[p_word].end)
+    else
     {
-      p_word++;
-      if (p_word>WORD_MEGAHERTZ)
-      {
-        active = false;
-      }
-      else
-      {
-        p_sample = word[p_word].begin;
-      }
+      PROMPT::add_morse(phrase,"..--..");
     }
-    return sample<<2;
+    PROMPT::speak(phrase,PROMPT_PRIORITY_LOW);
   }
 
-  static void __not_in_flash_func(init_test_word)(const uint32_t the_word)
+#if defined VFA_TESTS && VFA_TESTS==1
+  static void init_test_word(const uint32_t the_word)
   {
-    if (active)
-    {
-      return;
-    }
-    if (the_word>WORD_MEGAHERTZ)
+    // one word
+    if (the_word<=WORD_MEGAHERTZ)
     {
-      active = false;
-      return;
+      PROMPT::speak((uint8_t)the_word,PROMPT_PRIORITY_LOW);
     }
-    p_word = the_word;
-    p_sample = word[p_word].begin;
-    active = true;
   }
 
-  static const int16_t __not_in_flash_func(run_test_word)(void)
+  static void init_test_words(const uint32_t first)
   {
-    // all words
-    if (!active)
-    {
-      return 0;
-    }
-    if (p_word>WORD_MEGAHERTZ || p_sample>=data_size)
-    {
-      active = false;
-      return 0;
-    }
-    const int16_t sample = (int16_t)data[p_sample++] - 128;
-    if (p_sample>word[p_word].end)
+    // six words from first
+    uint8_t speak[6] = {0};
+    uint32_t n = 0;
+    for (uint32_t i=first;i<=WORD_MEGAHERTZ && n<6;i++)
     {
-      active = false;
+      speak[n++] = (uint8_t)i;
     }
-    return sample<<2;
+    PROMPT::speak(speak,n,PROMPT_PRIORITY_LOW);
   }
 #endif
 }
@@ -0,0 +1,88 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Time per 31250Hz output sample of ADPCM::decode() over every clip,
+// and of next() alone (the ADPCM decode at 7812.5Hz). The difference
+// is the cost of the interpolator. On this PC, not the radio, so the
+// numbers are for comparing changes, not for the sample budget.
+
+#include <chrono>
+#include "check.h"
+#include "Arduino.h"
+#include "adpcm.h"
+
+namespace PROMPT
+{
+  #include "promptdata.h"
+}
+
+static volatile int32_t sink = 0;
+
+template <const bool (*step)(ADPCM::decoder_t &,int16_t &)>
+static double time_per_sample(const uint32_t passes,uint32_t &samples)
+{
+  using clock = std::chrono::steady_clock;
+  samples = 0;
+  int32_t sum = 0;
+  const clock::time_point t0 = clock::now();
+  for (uint32_t pass=0;pass<passes;pass++)
+  {
+    for (uint32_t id=0;id<PROMPT::NUM_CLIPS;id++)
+    {
+      const ADPCM::clip_t clip =
+      {
+        PROMPT::blob + PROMPT::clip_index[id].offset,
+        PROMPT::clip_index[id].samples
+      };
+      ADPCM::decoder_t decoder;
+      ADPCM::start(decoder,clip);
+      int16_t sample = 0;
+      while (step(decoder,sample))
+      {
+        sum += sample;
+        samples++;
+      }
+    }
+  }
+  const clock::time_point t1 = clock::now();
+  sink = sum;
+  return std::chrono::duration<double,std::nano>(t1 - t0).count() / samples;
+}
+
+int main(void)
+{
+  ADPCM::init();
+  const uint32_t passes = 20;
+  uint32_t adpcm_samples = 0;
+  uint32_t output_samples = 0;
+  // best of three, the first warms the caches
+  double adpcm_ns = 1.0e9;
+  double output_ns = 1.0e9;
+  for (uint32_t i=0;i<3;i++)
+  {
+    adpcm_ns = min(adpcm_ns,time_per_sample<ADPCM::next>(passes,adpcm_samples));
+    output_ns = min(output_ns,time_per_sample<ADPCM::decode>(passes,output_samples));
+  }
+  CHECK_EQ(output_samples,adpcm_samples * ADPCM_UPSAMPLE);
+  // each output sample carries a quarter of an ADPCM sample
+  const double interpolator_ns = output_ns - adpcm_ns / ADPCM_UPSAMPLE;
+  printf("ADPCM::next() %.2fns a 7812.5Hz sample\n",adpcm_ns);
+  printf("ADPCM::decode() %.2fns a 31250Hz sample, interpolator %.2fns of it\n",output_ns,interpolator_ns);
+  return check_result("adpcm_bench");
+}
@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+#
+# uP40 - 40M Phasing Transceiver
+#
+# Copyright (C) 2025 Ian Mitchell VK7IAN
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Reference output for tests/adpcm_test: every clip in promptdata.h
+decoded and upsampled to 31250Hz by tools/adpcm.py.
+
+  python3 tests/adpcm_reference.py src/promptdata.h out.bin
+
+out.bin is little endian: the number of clips, then for each clip in
+clip ID order the number of samples and the int16 samples.
+"""
+
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'tools'))
+
+import adpcm
+import promptpack
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    blob, index = promptpack.read_header(sys.argv[1])
+    # the index is in clip ID order
+    with open(sys.argv[2], 'wb') as f:
+        f.write(struct.pack('<I', len(index)))
+        for offset, size, samples in index.values():
+            pcm = adpcm.upsample(adpcm.decode(blob[offset:offset + size], samples))
+            f.write(struct.pack('<I', len(pcm)))
+            f.write(struct.pack('<%dh' % len(pcm), *pcm))
+
+
+if __name__ == '__main__':
+    main()
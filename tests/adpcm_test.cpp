@@ -0,0 +1,90 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Every clip in promptdata.h through ADPCM::decode(), as the radio
+// plays it (block prefetch by DMA, 31250Hz out), has to match
+// tools/adpcm.py sample for sample. The Python output is made by
+// adpcm_reference.py and its file name is the only argument.
+
+#include <vector>
+#include "check.h"
+#include "Arduino.h"
+#include "adpcm.h"
+
+namespace PROMPT
+{
+  #include "promptdata.h"
+}
+
+static bool read_u32(FILE *f,uint32_t &value)
+{
+  uint8_t b[4];
+  if (fread(b,1,4,f)!=4)
+  {
+    return false;
+  }
+  value = b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+  return true;
+}
+
+int main(int argc,char **argv)
+{
+  FILE *f = argc==2?fopen(argv[1],"rb"):NULL;
+  if (f==NULL)
+  {
+    printf("adpcm_test: no reference file\n");
+    return 1;
+  }
+  uint32_t clips = 0;
+  CHECK(read_u32(f,clips));
+  CHECK_EQ(clips,PROMPT::NUM_CLIPS);
+  ADPCM::init();
+  uint32_t total = 0;
+  for (uint32_t id=0;id<PROMPT::NUM_CLIPS && id<clips;id++)
+  {
+    uint32_t samples = 0;
+    CHECK(read_u32(f,samples));
+    std::vector<int16_t> reference(samples);
+    CHECK_EQ(fread(reference.data(),sizeof(int16_t),samples,f),samples);
+    const ADPCM::clip_t clip =
+    {
+      PROMPT::blob + PROMPT::clip_index[id].offset,
+      PROMPT::clip_index[id].samples
+    };
+    ADPCM::decoder_t decoder;
+    ADPCM::start(decoder,clip);
+    uint32_t n = 0;
+    uint32_t mismatches = 0;
+    int16_t sample = 0;
+    while (ADPCM::decode(decoder,sample))
+    {
+      if (n<samples && sample!=reference[n] && mismatches++==0)
+      {
+        printf("clip %u sample %u: %d, tools/adpcm.py has %d\n",id,n,sample,reference[n]);
+      }
+      n++;
+    }
+    CHECK_EQ(n,samples);
+    CHECK_EQ(mismatches,0);
+    total += n;
+  }
+  fclose(f);
+  printf("%u clips, %u samples compared\n",clips,total);
+  return check_result("adpcm_test");
+}
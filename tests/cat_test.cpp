@@ -0,0 +1,144 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// CAT commands in through the receive ring, replies out of the
+// transmit DMA. Built with the address sanitizer so a reply written
+// past its buffer fails the test.
+
+#include "check.h"
+#include "Arduino.h"
+#include "cat.h"
+
+static uint32_t frequency = 7100000ul;
+static uint32_t set_count = 0;
+static uint8_t mode = 1;
+static bool tx = false;
+
+static uint32_t get_frequency(void) { return frequency; }
+static bool set_frequency(const uint32_t f) { set_count++; frequency = f; return true; }
+static uint8_t get_mode(void) { return mode; }
+static bool set_mode(const uint8_t m) { if (m!=1 && m!=2 && m!=3 && m!=7) return false; mode = m; return true; }
+static bool get_tx(void) { return tx; }
+static bool set_tx(const bool t) { tx = t; return true; }
+static uint32_t get_smeter(void) { return 99; }
+
+static const CAT::radio_t radio =
+{
+  get_frequency,
+  set_frequency,
+  get_mode,
+  set_mode,
+  get_tx,
+  set_tx,
+  get_smeter
+};
+
+static uint32_t rx_head = 0;
+static char reply[sizeof(host_dma_out) + 1u];
+
+static const char *command(const char *s)
+{
+  // as the UART DMA: into the ring, then the write address moves on
+  host_dma_out_length = 0;
+  for (;*s;s++)
+  {
+    CAT::rx_ring[rx_head++ & (CAT_RX_SIZE - 1u)] = (uint8_t)*s;
+  }
+  dma_channel_hw_addr(CAT::rx_channel)->write_addr = (uint32_t)(uintptr_t)&CAT::rx_ring[rx_head & (CAT_RX_SIZE - 1u)];
+  CAT::process();
+  memcpy(reply,host_dma_out,host_dma_out_length);
+  reply[host_dma_out_length] = 0;
+  return reply;
+}
+
+static bool is(const char *a,const char *b)
+{
+  if (strcmp(a,b)!=0)
+  {
+    printf("  got \"%s\", wanted \"%s\"\n",a,b);
+    return false;
+  }
+  return true;
+}
+
+static void test_frequency(void)
+{
+  CHECK(is(command("FA;"),"FA00007100000;"));
+  CHECK(is(command("FA00007074000;"),""));
+  CHECK_EQ(frequency,7074000ul);
+  CHECK(is(command("fa;"),"FA00007074000;"));
+  // all eleven digits
+  frequency = 4294967295ul;
+  CHECK(is(command("FA;"),"FA04294967295;"));
+  // the largest that fits, then one more and one more digit
+  set_count = 0;
+  CHECK(is(command("FA4294967295;"),""));
+  CHECK_EQ(frequency,4294967295ul);
+  CHECK(is(command("FA4294967296;"),"?;"));
+  CHECK(is(command("FA99999999999;"),"?;"));
+  CHECK(is(command("FA0000000000000000000001;"),""));
+  CHECK_EQ(frequency,1);
+  CHECK_EQ(set_count,2);
+  CHECK(is(command("FA7x00000;"),"?;"));
+  frequency = 7100000ul;
+}
+
+static void test_info(void)
+{
+  tx = true;
+  mode = 3;
+  const char *r = command("IF;");
+  CHECK_EQ(strlen(r),38);
+  CHECK(is(r,"IF00007100000     +000000000130000000;"));
+  tx = false;
+  mode = 1;
+}
+
+static void test_others(void)
+{
+  CHECK(is(command("MD;"),"MD1;"));
+  CHECK(is(command("MD2;MD;"),"MD2;"));
+  CHECK(is(command("MD5;"),"?;"));
+  CHECK(is(command("TX;"),""));
+  CHECK(tx);
+  CHECK(is(command("RX;"),""));
+  CHECK(!tx);
+  CHECK(is(command("SM0;"),"SM00030;"));
+  CHECK(is(command("ID;"),"ID020;"));
+  CHECK(is(command("AI;PS;"),"AI0;PS1;"));
+  CHECK(is(command("ZZ;"),"?;"));
+  CHECK(is(command("F;"),"?;"));
+  // too long for the command buffer
+  CHECK(is(command("FA000000000000000000000001;"),"?;"));
+  // split across two reads and round the end of the ring
+  for (uint32_t i=0;i<CAT_RX_SIZE/3u;i++)
+  {
+    command("PS");
+    CHECK(is(command(";"),"PS1;"));
+  }
+}
+
+int main(void)
+{
+  CAT::init(radio,38400,0,1);
+  test_frequency();
+  test_info();
+  test_others();
+  return check_result("cat_test");
+}
@@ -0,0 +1,114 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Just enough of arduino-pico and the Pico SDK to build the radio's
+// headers on a PC. Time only moves when a test moves host_time_us.
+// DMA copies at once when both ends increment, a transfer to a fixed
+// address (a UART) is appended to host_dma_out. Nothing is ever busy.
+//
+// min(), max() and constrain() are macros as on the Arduino, so
+// include any C++ library headers before this one.
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#define __not_in_flash_func(f) f
+#define __not_in_flash(s)
+#define __force_inline inline
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(a,l,h) ((a)<(l)?(l):((a)>(h)?(h):(a)))
+
+// so the uncached XIP alias is the same address
+#define XIP_BASE                 0u
+#define XIP_NOCACHE_NOALLOC_BASE 0u
+
+extern uint64_t host_time_us;
+
+uint32_t millis(void);
+uint32_t micros(void);
+uint32_t time_us_32(void);
+void delay(uint32_t ms);
+
+static inline void __dmb(void) {}
+static inline void tight_loop_contents(void) {}
+
+// DMA
+#define DMA_SIZE_8  0
+#define DMA_SIZE_16 1
+#define DMA_SIZE_32 2
+#define DREQ_FORCE  0x3f
+#define HOST_DMA_CHANNELS 12
+
+typedef struct
+{
+  uint32_t size;
+  bool read_increment;
+  bool write_increment;
+} dma_channel_config;
+
+typedef struct
+{
+  volatile uint32_t read_addr;
+  volatile uint32_t write_addr;
+  volatile uint32_t transfer_count;
+  volatile uint32_t ctrl_trig;
+} dma_channel_hw_t;
+
+extern uint8_t host_dma_out[4096];
+extern uint32_t host_dma_out_length;
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(int channel);
+void channel_config_set_transfer_data_size(dma_channel_config *c,int size);
+void channel_config_set_read_increment(dma_channel_config *c,bool increment);
+void channel_config_set_write_increment(dma_channel_config *c,bool increment);
+void channel_config_set_dreq(dma_channel_config *c,int dreq);
+void channel_config_set_ring(dma_channel_config *c,bool write,int bits);
+void dma_channel_configure(int channel,const dma_channel_config *c,volatile void *write,const volatile void *read,uint32_t count,bool trigger);
+bool dma_channel_is_busy(int channel);
+void dma_channel_wait_for_finish_blocking(int channel);
+dma_channel_hw_t *dma_channel_hw_addr(int channel);
+uint32_t dma_encode_endless_transfer_count(void);
+
+// UART
+typedef struct
+{
+  volatile uint32_t dr;
+} uart_hw_t;
+
+typedef struct uart_inst uart_inst_t;
+extern uart_inst_t *uart0;
+
+uint32_t uart_init(uart_inst_t *uart,uint32_t baud);
+uart_hw_t *uart_get_hw(uart_inst_t *uart);
+int uart_get_dreq(uart_inst_t *uart,bool tx);
+
+#define GPIO_FUNC_UART 2
+void gpio_set_function(uint32_t pin,int function);
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Mock I2C with one device behind it: a 256 byte register map with an
+// auto-incrementing address, as the Si5351. Every transaction is
+// counted so a test can say how much bus traffic a call makes.
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire
+{
+public:
+  void begin(void) {}
+  void setSDA(int) {}
+  void setSCL(int) {}
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t address);
+  uint8_t endTransmission(bool stop = true);
+  size_t write(uint8_t data);
+  uint8_t requestFrom(uint8_t address,uint8_t bytes);
+  int available(void);
+  int read(void);
+
+  void clear_counts(void);
+
+  uint8_t regs[256];
+  uint32_t transmissions;  // endTransmission()
+  uint32_t requests;       // requestFrom()
+  uint32_t bytes_written;  // including the register address
+  uint32_t bytes_read;
+
+private:
+  uint8_t pointer = 0;
+  bool address_next = false;
+  uint32_t pending = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// CHECK() prints the failing line and carries on, main() returns
+// check_result() so make stops on the first test program that fails.
+
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+#include <stdio.h>
+
+static int check_failures = 0;
+static int check_count = 0;
+
+#define CHECK(x) \
+  do \
+  { \
+    check_count++; \
+    if (!(x)) \
+    { \
+      check_failures++; \
+      printf("%s:%d: CHECK(%s) failed\n",__FILE__,__LINE__,#x); \
+    } \
+  } \
+  while (0)
+
+#define CHECK_EQ(a,b) \
+  do \
+  { \
+    check_count++; \
+    const long long check_a = (long long)(a); \
+    const long long check_b = (long long)(b); \
+    if (check_a!=check_b) \
+    { \
+      check_failures++; \
+      printf("%s:%d: CHECK_EQ(%s,%s) failed, %lld != %lld\n",__FILE__,__LINE__,#a,#b,check_a,check_b); \
+    } \
+  } \
+  while (0)
+
+static int check_result(const char *name)
+{
+  printf("%s: %d checks, %d failed\n",name,check_count,check_failures);
+  return check_failures?1:0;
+}
+
+#endif
@@ -0,0 +1,209 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// The host side of Arduino.h and Wire.h
+
+#include "Arduino.h"
+#include "Wire.h"
+
+uint64_t host_time_us = 0;
+
+uint32_t millis(void)
+{
+  return (uint32_t)(host_time_us / 1000u);
+}
+
+uint32_t micros(void)
+{
+  return (uint32_t)host_time_us;
+}
+
+uint32_t time_us_32(void)
+{
+  return (uint32_t)host_time_us;
+}
+
+void delay(uint32_t ms)
+{
+  host_time_us += (uint64_t)ms * 1000u;
+}
+
+// DMA
+
+static dma_channel_hw_t dma_hw[HOST_DMA_CHANNELS];
+static int dma_claimed = 0;
+uint8_t host_dma_out[4096];
+uint32_t host_dma_out_length = 0;
+
+int dma_claim_unused_channel(bool)
+{
+  return dma_claimed<HOST_DMA_CHANNELS?dma_claimed++:-1;
+}
+
+dma_channel_config dma_channel_get_default_config(int)
+{
+  dma_channel_config c = {4u,true,false};
+  return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c,int size)
+{
+  c->size = 1u << size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c,bool increment)
+{
+  c->read_increment = increment;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c,bool increment)
+{
+  c->write_increment = increment;
+}
+
+void channel_config_set_dreq(dma_channel_config *,int) {}
+
+void channel_config_set_ring(dma_channel_config *,bool,int) {}
+
+void dma_channel_configure(int channel,const dma_channel_config *c,volatile void *write,const volatile void *read,uint32_t count,bool trigger)
+{
+  // addresses kept as the low 32 bits, as the hardware registers
+  dma_hw[channel].read_addr = (uint32_t)(uintptr_t)read;
+  dma_hw[channel].write_addr = (uint32_t)(uintptr_t)write;
+  dma_hw[channel].transfer_count = count;
+  if (!trigger)
+  {
+    return;
+  }
+  const uint32_t bytes = count * c->size;
+  if (c->read_increment && c->write_increment)
+  {
+    memcpy((void *)write,(const void *)read,bytes);
+  }
+  else if (c->read_increment && bytes<=sizeof(host_dma_out) - host_dma_out_length)
+  {
+    memcpy(host_dma_out + host_dma_out_length,(const void *)read,bytes);
+    host_dma_out_length += bytes;
+  }
+}
+
+bool dma_channel_is_busy(int)
+{
+  return false;
+}
+
+void dma_channel_wait_for_finish_blocking(int) {}
+
+dma_channel_hw_t *dma_channel_hw_addr(int channel)
+{
+  return &dma_hw[channel];
+}
+
+uint32_t dma_encode_endless_transfer_count(void)
+{
+  return 0xf0000000u;
+}
+
+// UART
+
+struct uart_inst
+{
+  uart_hw_t hw;
+};
+
+static uart_inst uart0_inst;
+uart_inst_t *uart0 = &uart0_inst;
+
+uint32_t uart_init(uart_inst_t *,uint32_t baud)
+{
+  return baud;
+}
+
+uart_hw_t *uart_get_hw(uart_inst_t *uart)
+{
+  return &uart->hw;
+}
+
+int uart_get_dreq(uart_inst_t *,bool)
+{
+  return 0;
+}
+
+void gpio_set_function(uint32_t,int) {}
+
+// I2C
+
+TwoWire Wire;
+
+void TwoWire::beginTransmission(uint8_t)
+{
+  address_next = true;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+  transmissions++;
+  return 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+  bytes_written++;
+  if (address_next)
+  {
+    pointer = data;
+    address_next = false;
+  }
+  else
+  {
+    regs[pointer++] = data;
+  }
+  return 1;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t,uint8_t bytes)
+{
+  requests++;
+  pending = bytes;
+  return bytes;
+}
+
+int TwoWire::available(void)
+{
+  return (int)pending;
+}
+
+int TwoWire::read(void)
+{
+  if (pending==0)
+  {
+    return -1;
+  }
+  pending--;
+  bytes_read++;
+  return regs[pointer++];
+}
+
+void TwoWire::clear_counts(void)
+{
+  transmissions = 0;
+  requests = 0;
+  bytes_written = 0;
+  bytes_read = 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// The voice prompt queue: core 1 says phrases, core 0 (announce() once
+// a sample) plays them. A phrase that pre-empts fits beside a whole
+// phrase of stale entries, one that doesn't fit changes nothing and
+// speak() holds it for retry().
+
+#include <vector>
+#include "check.h"
+#include "Arduino.h"
+#include "vfa.h"
+
+static std::vector<uint8_t> played;
+
+static void play(const uint32_t samples)
+{
+  // core 0 for a while, noting each clip as it starts
+  for (uint32_t i=0;i<samples;i++)
+  {
+    const uint32_t before = PROMPT::tail;
+    PROMPT::announce();
+    if (PROMPT::tail!=before && PROMPT::playing)
+    {
+      played.push_back(PROMPT::queue[before & PROMPT_RING_MASK] & 0xffu);
+    }
+  }
+}
+
+static void play_all(void)
+{
+  for (uint32_t i=0;i<10000u && PROMPT::active();i++)
+  {
+    play(SAMPLERATE / 10u);
+  }
+  CHECK(!PROMPT::active());
+}
+
+static void readout(std::vector<uint8_t> &ids)
+{
+  // a frequency readout, 6 entries, low priority
+  const uint32_t h = PROMPT::head;
+  VFA::setFreq(7074000ul);
+  CHECK_EQ(PROMPT::head - h,6);
+  ids.clear();
+  for (uint32_t i=h;i!=PROMPT::head;i++)
+  {
+    ids.push_back(PROMPT::queue[i & PROMPT_RING_MASK] & 0xffu);
+  }
+}
+
+static void longest(std::vector<uint8_t> &ids)
+{
+  // the longest status, "S nine plus six zero, V two zero, W two five"
+  const uint32_t h = PROMPT::head;
+  VFA::setStatus(9,60,20,25);
+  ids.clear();
+  for (uint32_t i=h;i!=PROMPT::head;i++)
+  {
+    ids.push_back(PROMPT::queue[i & PROMPT_RING_MASK] & 0xffu);
+  }
+}
+
+static void test_preempt_readout(void)
+{
+  // a 28 entry phrase pre-empts a 6 entry readout just started, all
+  // 6 still in the ring, and is said in full
+  std::vector<uint8_t> freq;
+  std::vector<uint8_t> status;
+  readout(freq);
+  played.clear();
+  play(1);
+  CHECK_EQ(played.size(),1);
+  CHECK(PROMPT::playing);
+  longest(status);
+  CHECK_EQ(status.size(),28);
+  CHECK(PROMPT::head - PROMPT::tail>PROMPT_QUEUE_SIZE);
+  play_all();
+  CHECK_EQ(played.size(),1 + status.size());
+  CHECK(std::vector<uint8_t>(played.begin() + 1,played.end())==status);
+}
+
+static void test_no_room_no_change(void)
+{
+  // a low priority phrase that can't wait behind the status is turned
+  // away and the status carries on
+  std::vector<uint8_t> status;
+  longest(status);
+  const uint32_t epoch = PROMPT::epoch;
+  const uint32_t head = PROMPT::head;
+  const uint8_t ids[6] = {PROMPT::CLIP_ZERO,PROMPT::CLIP_POINT,PROMPT::CLIP_ZERO,PROMPT::CLIP_ZERO,PROMPT::CLIP_ZERO,PROMPT::CLIP_MEGAHERTZ};
+  CHECK(!PROMPT::say(ids,6,PROMPT_PRIORITY_LOW));
+  CHECK_EQ(PROMPT::epoch,epoch);
+  CHECK_EQ(PROMPT::head,head);
+  CHECK_EQ(PROMPT::queued_priority,PROMPT_PRIORITY_HIGH);
+  // one that would fit waits its turn
+  CHECK(PROMPT::say(ids,4,PROMPT_PRIORITY_LOW));
+  CHECK_EQ(PROMPT::epoch,epoch);
+  played.clear();
+  play_all();
+  CHECK_EQ(played.size(),32);
+
+  // longer than any phrase is never taken
+  uint8_t too_long[PROMPT_QUEUE_SIZE + 1u] = {0};
+  CHECK(!PROMPT::say(too_long,PROMPT_QUEUE_SIZE + 1u,PROMPT_PRIORITY_HIGH));
+  CHECK(!PROMPT::active());
+}
+
+static void test_preempt_twice(void)
+{
+  // two whole phrases of stale entries, a third pre-empt waits until
+  // core 0 has skipped some, and it's the last that's said
+  uint8_t a[PROMPT_QUEUE_SIZE];
+  uint8_t b[PROMPT_QUEUE_SIZE];
+  memset(a,PROMPT::CLIP_ONE,sizeof(a));
+  memset(b,PROMPT::CLIP_TWO,sizeof(b));
+  CHECK(PROMPT::say(a,PROMPT_QUEUE_SIZE,PROMPT_PRIORITY_HIGH));
+  CHECK(PROMPT::say(b,PROMPT_QUEUE_SIZE,PROMPT_PRIORITY_HIGH));
+  const uint32_t epoch = PROMPT::epoch;
+  CHECK(!PROMPT::say(PROMPT::CLIP_USB,PROMPT_PRIORITY_HIGH));
+  CHECK_EQ(PROMPT::epoch,epoch);
+  play(PROMPT_QUEUE_SIZE + 1u);
+  CHECK(PROMPT::say(PROMPT::CLIP_USB,PROMPT_PRIORITY_HIGH));
+  played.clear();
+  play_all();
+  CHECK_EQ(played.size(),1);
+  CHECK_EQ(played[0],PROMPT::CLIP_USB);
+}
+
+static void test_held(void)
+{
+  // no room, held and said by retry() once there is, and replaced by
+  // a later phrase of the same priority
+  uint8_t a[PROMPT_QUEUE_SIZE];
+  memset(a,PROMPT::CLIP_ONE,sizeof(a));
+  CHECK(PROMPT::say(a,PROMPT_QUEUE_SIZE,PROMPT_PRIORITY_HIGH));
+  CHECK(PROMPT::say(a,PROMPT_QUEUE_SIZE,PROMPT_PRIORITY_HIGH));
+  std::vector<uint8_t> status;
+  longest(status);
+  CHECK(status.empty());
+  CHECK(!PROMPT::retry());
+  VFA::setNumber(42);
+  CHECK(!PROMPT::retry());
+  VFA::setCalibration(true);
+  CHECK(!PROMPT::retry());
+  play(PROMPT_QUEUE_SIZE + 1u);
+  CHECK(PROMPT::retry());
+  played.clear();
+  play_all();
+  const std::vector<uint8_t> r = {PROMPT::CLIP_DIT,PROMPT::CLIP_DAH,PROMPT::CLIP_DIT,PROMPT::CLIP_PAUSE};
+  CHECK(played==r);
+
+  // too long is never said
+  PROMPT::phrase_t phrase = {};
+  for (uint32_t i=0;i<PROMPT_QUEUE_SIZE + 1u;i++)
+  {
+    PROMPT::add(phrase,PROMPT::CLIP_ONE);
+  }
+  CHECK_EQ(phrase.count,PROMPT_QUEUE_SIZE + 1u);
+  PROMPT::speak(phrase,PROMPT_PRIORITY_HIGH);
+  CHECK(!PROMPT::active());
+  CHECK(PROMPT::retry());
+}
+
+int main(void)
+{
+  ADPCM::init();
+  test_preempt_readout();
+  test_no_room_no_change();
+  test_preempt_twice();
+  test_held();
+  return check_result("prompt_test");
+}
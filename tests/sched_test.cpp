@@ -0,0 +1,182 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// SCHED on host time: rates, order, RX only tasks held off in TX, and
+// run() called from inside a task as the TX loops do, with a CAT like
+// task that has to keep running to unkey.
+
+#include "check.h"
+#include "Arduino.h"
+#include "sched.h"
+
+static char order[64];
+static uint32_t order_length = 0;
+
+static void note(const char c)
+{
+  if (order_length<sizeof(order) - 1u)
+  {
+    order[order_length++] = c;
+    order[order_length] = 0;
+  }
+}
+
+static void reset(void)
+{
+  host_time_us = 1000000ull;
+  order_length = 0;
+  order[0] = 0;
+  SCHED::init();
+}
+
+static void step_ms(const uint32_t ms,const uint32_t mask)
+{
+  // one pass every millisecond
+  for (uint32_t i=0;i<ms;i++)
+  {
+    host_time_us += 1000u;
+    SCHED::run(mask);
+  }
+}
+
+static void task_a(void) { note('a'); }
+static void task_b(void) { note('b'); }
+static void task_c(void) { note('c'); }
+
+static void test_rate(void)
+{
+  reset();
+  const uint32_t a = SCHED::add("a",task_a,10,SCHED_RX);
+  const uint32_t b = SCHED::add("b",task_b,250,SCHED_RX);
+  order_length = sizeof(order);
+  step_ms(1000,SCHED_RX);
+  CHECK_EQ(SCHED::stats(a).runs,100);
+  CHECK_EQ(SCHED::stats(b).runs,4);
+  CHECK_EQ(SCHED::stats(a).late,0);
+}
+
+static void test_order(void)
+{
+  // due together they run in the order added, whatever the slot order
+  reset();
+  const uint32_t c = SCHED::add("c",task_c,0,SCHED_RX);
+  const uint32_t b = SCHED::add("b",task_b,0,SCHED_RX);
+  const uint32_t a = SCHED::add("a",task_a,0,SCHED_RX);
+  SCHED::trigger_after(a,3);
+  SCHED::trigger_after(b,5);
+  SCHED::trigger_after(c,4);
+  // a whole 10ms goes by before the next pass
+  host_time_us += 10000u;
+  SCHED::run(SCHED_RX);
+  CHECK(strcmp(order,"cba")==0);
+  CHECK(!SCHED::pending(a) && !SCHED::pending(b) && !SCHED::pending(c));
+}
+
+static void test_tx_only(void)
+{
+  // an RX task waits out the transmission then runs once
+  reset();
+  const uint32_t a = SCHED::add("a",task_a,0,SCHED_RX);
+  const uint32_t b = SCHED::add("b",task_b,5,SCHED_RX|SCHED_TX);
+  SCHED::trigger(a);
+  step_ms(20,SCHED_TX);
+  CHECK_EQ(SCHED::stats(a).runs,0);
+  CHECK_EQ(SCHED::stats(b).runs,4);
+  CHECK(SCHED::pending(a));
+  step_ms(1,SCHED_RX);
+  CHECK_EQ(SCHED::stats(a).runs,1);
+  CHECK(!SCHED::pending(a));
+}
+
+// the PTT task keys up and stays in its TX loop until the CAT task,
+// due at the same time but added after it, says RX
+static bool pressed = false;
+static bool keyed = false;
+static uint32_t cat_runs_in_tx = 0;
+static uint32_t tx_loops = 0;
+static uint32_t event_runs = 0;
+static uint32_t event_task = SCHED_NONE;
+
+static void task_ptt(void)
+{
+  if (!pressed)
+  {
+    return;
+  }
+  pressed = false;
+  keyed = true;
+  tx_loops = 0;
+  while (keyed && tx_loops<1000u)
+  {
+    tx_loops++;
+    host_time_us += 1000u;
+    SCHED::run(SCHED_TX);
+  }
+  keyed = false;
+}
+
+static void task_cat(void)
+{
+  if (keyed && ++cat_runs_in_tx==5u)
+  {
+    // RX;
+    keyed = false;
+  }
+}
+
+static void task_event(void)
+{
+  event_runs++;
+}
+
+static void test_nested(void)
+{
+  reset();
+  pressed = true;
+  keyed = false;
+  cat_runs_in_tx = 0;
+  event_runs = 0;
+  const uint32_t ptt = SCHED::add("ptt",task_ptt,10,SCHED_RX);
+  const uint32_t cat = SCHED::add("cat",task_cat,10,SCHED_RX|SCHED_TX);
+  event_task = SCHED::add("event",task_event,0,SCHED_RX|SCHED_TX);
+  // all three fall due together, the PTT task first off the wheel
+  SCHED::trigger_after(event_task,10);
+  SCHED::trigger_after(ptt,10);
+  step_ms(10,SCHED_RX);
+  CHECK(!pressed);
+  CHECK_EQ(cat_runs_in_tx,5);
+  CHECK(!keyed);
+  CHECK(tx_loops<=60u);
+  // the event ran once, inside the TX loop, not again afterwards
+  CHECK_EQ(event_runs,1);
+  CHECK(!SCHED::pending(event_task));
+  // and the CAT task kept its rate through it all
+  const uint32_t before = SCHED::stats(cat).runs;
+  step_ms(100,SCHED_RX);
+  CHECK_EQ(SCHED::stats(cat).runs - before,10);
+}
+
+int main(void)
+{
+  test_rate();
+  test_order();
+  test_tx_only();
+  test_nested();
+  return check_result("sched_test");
+}
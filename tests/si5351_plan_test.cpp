@@ -0,0 +1,194 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// The Si5351 plan cache: hits give the same registers as working them
+// out, the least recently used plan goes first, a change of correction
+// or reference misses. Then the time for a hit against the arithmetic.
+
+#include <chrono>
+#include "check.h"
+#include "Arduino.h"
+#include "Wire.h"
+#define private public
+#include "si5351.h"
+#undef private
+
+static Si5351 si5351;
+
+static uint64_t pll_frequency(const uint32_t n)
+{
+  // PLL frequencies as the radio uses, 88 x 7.0MHz and up in 10Hz steps
+  return (7000000ull + 10ull * n) * 88ull * SI5351_FREQ_MULT;
+}
+
+static uint64_t reference(void)
+{
+  return si5351.xtal_freq[(uint8_t)si5351.plla_ref_osc];
+}
+
+static bool same(const Si5351RegSet &a,const Si5351RegSet &b)
+{
+  return a.p1==b.p1 && a.p2==b.p2 && a.p3==b.p3;
+}
+
+static bool cached(const si5351_plan_kind kind,const uint64_t f,const uint64_t ref,const int32_t correction)
+{
+  // as plan_find() but leaves the use order alone
+  for (uint32_t i=0;i<SI5351_PLAN_CACHE_SIZE;i++)
+  {
+    const Si5351Plan &p = si5351.plan[i];
+    if (p.kind==kind && p.freq==f && p.ref==ref && p.correction==correction)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void clear_cache(void)
+{
+  for (uint32_t i=0;i<SI5351_PLAN_CACHE_SIZE;i++)
+  {
+    si5351.plan[i].kind = SI5351_PLAN_EMPTY;
+  }
+}
+
+static void test_hit_matches(void)
+{
+  // a hit gives exactly what the arithmetic gives
+  clear_cache();
+  for (uint32_t pass=0;pass<2;pass++)
+  {
+    for (uint32_t n=0;n<SI5351_PLAN_CACHE_SIZE;n++)
+    {
+      Si5351RegSet from_cache;
+      Si5351RegSet worked;
+      const uint64_t a = si5351.pll_calc(SI5351_PLLA,pll_frequency(n),&from_cache,0,0);
+      const uint64_t b = si5351.pll_calc_uncached(SI5351_PLLA,pll_frequency(n),&worked,0,0);
+      CHECK_EQ(a,b);
+      CHECK(same(from_cache,worked));
+    }
+  }
+  for (uint32_t n=0;n<SI5351_PLAN_CACHE_SIZE;n++)
+  {
+    CHECK(cached(SI5351_PLAN_PLL,pll_frequency(n),reference(),0));
+  }
+}
+
+static void test_lru(void)
+{
+  // fill the cache, use the oldest again, the next new plan replaces
+  // the one used longest ago instead
+  clear_cache();
+  Si5351RegSet reg;
+  for (uint32_t n=0;n<SI5351_PLAN_CACHE_SIZE;n++)
+  {
+    si5351.pll_calc(SI5351_PLLA,pll_frequency(n),&reg,0,0);
+  }
+  si5351.pll_calc(SI5351_PLLA,pll_frequency(0),&reg,0,0);
+  si5351.pll_calc(SI5351_PLLA,pll_frequency(100),&reg,0,0);
+  CHECK(cached(SI5351_PLAN_PLL,pll_frequency(0),reference(),0));
+  CHECK(!cached(SI5351_PLAN_PLL,pll_frequency(1),reference(),0));
+  CHECK(cached(SI5351_PLAN_PLL,pll_frequency(100),reference(),0));
+  for (uint32_t n=2;n<SI5351_PLAN_CACHE_SIZE;n++)
+  {
+    CHECK(cached(SI5351_PLAN_PLL,pll_frequency(n),reference(),0));
+  }
+  // the next goes in place of 2, now the oldest
+  si5351.pll_calc(SI5351_PLLA,pll_frequency(101),&reg,0,0);
+  CHECK(!cached(SI5351_PLAN_PLL,pll_frequency(2),reference(),0));
+  CHECK(cached(SI5351_PLAN_PLL,pll_frequency(101),reference(),0));
+}
+
+static void test_correction_misses(void)
+{
+  // the same frequency with another correction is worked out again,
+  // and a multisynth plan never answers for a PLL one
+  clear_cache();
+  const uint64_t f = pll_frequency(7);
+  Si5351RegSet reg0;
+  Si5351RegSet reg1;
+  Si5351RegSet worked;
+  si5351.pll_calc(SI5351_PLLA,f,&reg0,0,0);
+  CHECK(!cached(SI5351_PLAN_PLL,f,reference(),2500));
+  si5351.pll_calc(SI5351_PLLA,f,&reg1,2500,0);
+  si5351.pll_calc_uncached(SI5351_PLLA,f,&worked,2500,0);
+  CHECK(same(reg1,worked));
+  CHECK(!same(reg0,reg1));
+  CHECK(cached(SI5351_PLAN_PLL,f,reference(),0));
+  CHECK(cached(SI5351_PLAN_PLL,f,reference(),2500));
+  CHECK(!cached(SI5351_PLAN_MS,f,reference(),0));
+  CHECK(!cached(SI5351_PLAN_PLL,f,reference() + 1u,0));
+
+  // and through set_correction(), as a TCXO calibration does
+  clear_cache();
+  const uint64_t out = 7100000ull * SI5351_FREQ_MULT;
+  si5351.set_freq_quadrature(out,88,SI5351_CLK0,SI5351_CLK1);
+  uint8_t before[SI5351_PARAMETERS_LENGTH];
+  memcpy(before,&si5351.shadow[SI5351_PLLA_PARAMETERS],sizeof(before));
+  si5351.set_correction(2500,SI5351_PLL_INPUT_XO);
+  si5351.set_freq_quadrature(out,88,SI5351_CLK0,SI5351_CLK1);
+  CHECK(memcmp(before,&si5351.shadow[SI5351_PLLA_PARAMETERS],sizeof(before))!=0);
+  Si5351RegSet expected;
+  si5351.pll_calc_uncached(SI5351_PLLA,out * 88ull,&expected,2500,0);
+  CHECK_EQ(si5351.shadow[SI5351_PLLA_PARAMETERS + 7],expected.p2 & 0xffu);
+  si5351.set_correction(0,SI5351_PLL_INPUT_XO);
+}
+
+static void bench(void)
+{
+  // the time for a hit (plan_find() and the copy) against the cold
+  // path (pll_calc_uncached()), on this PC, over a few tuning steps
+  using clock = std::chrono::steady_clock;
+  const uint32_t loops = 200000;
+  const uint32_t steps = 4;
+  volatile uint64_t sink = 0;
+  Si5351RegSet reg;
+  clear_cache();
+  for (uint32_t n=0;n<steps;n++)
+  {
+    si5351.pll_calc(SI5351_PLLA,pll_frequency(n),&reg,0,0);
+  }
+  const clock::time_point t0 = clock::now();
+  for (uint32_t i=0;i<loops;i++)
+  {
+    sink = sink + si5351.pll_calc(SI5351_PLLA,pll_frequency(i % steps),&reg,0,0) + reg.p2;
+  }
+  const clock::time_point t1 = clock::now();
+  for (uint32_t i=0;i<loops;i++)
+  {
+    sink = sink + si5351.pll_calc_uncached(SI5351_PLLA,pll_frequency(i % steps),&reg,0,0) + reg.p2;
+  }
+  const clock::time_point t2 = clock::now();
+  const double hit_ns = std::chrono::duration<double,std::nano>(t1 - t0).count() / loops;
+  const double cold_ns = std::chrono::duration<double,std::nano>(t2 - t1).count() / loops;
+  printf("pll_calc: hit %.1fns, cold %.1fns, %.1f times faster\n",hit_ns,cold_ns,cold_ns / hit_ns);
+  CHECK(hit_ns<cold_ns);
+}
+
+int main(void)
+{
+  memset(Wire.regs,0,sizeof(Wire.regs));
+  CHECK(si5351.init(SI5351_CRYSTAL_LOAD_0PF,27000000ul,0));
+  test_hit_matches();
+  test_lru();
+  test_correction_misses();
+  bench();
+  return check_result("si5351_plan_test");
+}
@@ -0,0 +1,313 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Si5351 writes through a mock asynchronous transport: queueing in
+// order, widening the newest queued write, done() busy, a transfer
+// that fails, and flush() before anything is read from the bus.
+
+#include "check.h"
+#include "Arduino.h"
+#include "Wire.h"
+#define private public
+#include "si5351.h"
+#undef private
+
+static Si5351 si5351;
+
+// the transport, a write lands in the mock device when it finishes
+struct transfer_t
+{
+  uint8_t reg;
+  uint8_t bytes;
+  uint8_t data[SI5351_XFER_MAX];
+};
+
+static transfer_t started[64];
+static uint32_t num_started = 0;
+static uint32_t num_done = 0;
+static bool active = false;
+static uint32_t busy_polls = 2;   // done() says busy this many times
+static uint32_t busy_left = 0;
+static uint8_t fail_status = 0;   // the next transfer fails with this
+
+static void mock_start(uint8_t addr,uint8_t reg,const uint8_t *data,uint8_t bytes)
+{
+  CHECK_EQ(addr,SI5351_BUS_BASE_ADDR);
+  CHECK(!active);
+  CHECK(bytes>0 && bytes<=SI5351_XFER_MAX);
+  if (num_started<64)
+  {
+    transfer_t &t = started[num_started];
+    t.reg = reg;
+    t.bytes = bytes;
+    memcpy(t.data,data,bytes);
+  }
+  num_started++;
+  active = true;
+  busy_left = busy_polls;
+}
+
+static uint8_t mock_done(void)
+{
+  CHECK(active);
+  if (busy_left>0)
+  {
+    busy_left--;
+    return SI5351_XFER_BUSY;
+  }
+  active = false;
+  const uint8_t status = fail_status;
+  fail_status = 0;
+  if (status==0)
+  {
+    const transfer_t &t = started[(num_started - 1u) % 64u];
+    memcpy(&Wire.regs[t.reg],t.data,t.bytes);
+  }
+  num_done++;
+  return status;
+}
+
+static const Si5351Transport transport = {mock_start,mock_done};
+
+static uint8_t callback_reg[64];
+static uint8_t callback_status[64];
+static uint32_t num_callbacks = 0;
+
+static void callback(uint8_t reg,uint8_t status)
+{
+  if (num_callbacks<64)
+  {
+    callback_reg[num_callbacks] = reg;
+    callback_status[num_callbacks] = status;
+  }
+  num_callbacks++;
+}
+
+static void reset(void)
+{
+  si5351.set_transport(NULL,NULL);
+  memset(Wire.regs,0,sizeof(Wire.regs));
+  CHECK(si5351.init(SI5351_CRYSTAL_LOAD_0PF,27000000ul,0));
+  si5351.set_transport(&transport,callback);
+  num_started = 0;
+  num_done = 0;
+  num_callbacks = 0;
+  busy_polls = 2;
+  fail_status = 0;
+  Wire.clear_counts();
+}
+
+static void finish(void)
+{
+  for (uint32_t i=0;i<100000u && si5351.busy();i++)
+  {
+    si5351.poll();
+  }
+  CHECK(!si5351.busy());
+  CHECK(!active);
+}
+
+static void test_queue(void)
+{
+  // separate writes go one after another in order, nothing on Wire
+  reset();
+  si5351.si5351_write(20,0x11);
+  CHECK_EQ(num_started,1);
+  CHECK(si5351.busy());
+  si5351.si5351_write(40,0x22);
+  si5351.si5351_write(60,0x33);
+  CHECK_EQ(si5351.queue_count,3);
+  CHECK_EQ(num_started,1);
+  finish();
+  CHECK_EQ(num_started,3);
+  CHECK_EQ(num_callbacks,3);
+  CHECK_EQ(callback_reg[0],20);
+  CHECK_EQ(callback_reg[1],40);
+  CHECK_EQ(callback_reg[2],60);
+  CHECK_EQ(callback_status[0] | callback_status[1] | callback_status[2],0);
+  CHECK_EQ(Wire.regs[20],0x11);
+  CHECK_EQ(Wire.regs[40],0x22);
+  CHECK_EQ(Wire.regs[60],0x33);
+  CHECK_EQ(Wire.transmissions + Wire.requests,0);
+}
+
+static void test_queue_full(void)
+{
+  // more separate writes than the queue holds, the extra ones wait
+  reset();
+  for (uint32_t i=0;i<SI5351_QUEUE_SIZE + 4u;i++)
+  {
+    si5351.si5351_write((uint8_t)(16u + 4u * i),(uint8_t)(0x40u + i));
+    CHECK(si5351.queue_count<=SI5351_QUEUE_SIZE);
+  }
+  finish();
+  CHECK_EQ(num_started,SI5351_QUEUE_SIZE + 4u);
+  for (uint32_t i=0;i<SI5351_QUEUE_SIZE + 4u;i++)
+  {
+    CHECK_EQ(callback_reg[i],16u + 4u * i);
+    CHECK_EQ(Wire.regs[16u + 4u * i],0x40u + i);
+  }
+}
+
+static void test_coalesce(void)
+{
+  // writes to the same or next registers widen the newest queued
+  // write, not the one being sent or any older one
+  reset();
+  busy_polls = 1000;
+  si5351.si5351_write(30,0x01);  // started at once
+  si5351.si5351_write(31,0x02);  // queued
+  si5351.si5351_write(32,0x03);  // widens 31
+  si5351.si5351_write(30,0x04);  // widens it again, to 30-32
+  si5351.si5351_write(32,0x05);  // already in it, the newer value goes
+  CHECK_EQ(si5351.queue_count,2);
+  si5351.si5351_write(50,0x06);  // not next to it, a new write
+  si5351.si5351_write(33,0x07);  // next to an older write, not merged
+  CHECK_EQ(si5351.queue_count,4);
+  finish();
+  CHECK_EQ(num_started,4);
+  CHECK_EQ(started[0].reg,30);
+  CHECK_EQ(started[0].bytes,1);
+  CHECK_EQ(started[1].reg,30);
+  CHECK_EQ(started[1].bytes,3);
+  CHECK_EQ(started[1].data[0],0x04);
+  CHECK_EQ(started[1].data[1],0x02);
+  CHECK_EQ(started[1].data[2],0x05);
+  CHECK_EQ(started[2].reg,50);
+  CHECK_EQ(started[3].reg,33);
+  CHECK_EQ(Wire.regs[30],0x04);
+  CHECK_EQ(Wire.regs[33],0x07);
+
+  // no wider than one transfer
+  reset();
+  uint8_t block[SI5351_XFER_MAX];
+  memset(block,0x5a,sizeof(block));
+  si5351.si5351_write(10,0x01);
+  si5351.si5351_write_bulk(20,SI5351_XFER_MAX,block);
+  si5351.si5351_write(20 + SI5351_XFER_MAX,0x02);
+  CHECK_EQ(si5351.queue_count,3);
+  finish();
+  CHECK_EQ(num_started,3);
+}
+
+static void test_busy(void)
+{
+  // while done() says busy nothing moves
+  reset();
+  busy_polls = 50;
+  const uint8_t before = Wire.regs[20];
+  si5351.si5351_write(20,before ^ 0xffu);
+  si5351.si5351_write(40,0x22);
+  for (uint32_t i=0;i<40;i++)
+  {
+    si5351.poll();
+    CHECK_EQ(si5351.queue_count,2);
+  }
+  CHECK_EQ(num_started,1);
+  CHECK_EQ(num_callbacks,0);
+  CHECK_EQ(Wire.regs[20],before);
+  for (uint32_t i=0;i<20 && num_callbacks==0;i++)
+  {
+    si5351.poll();
+  }
+  CHECK_EQ(num_callbacks,1);
+  CHECK_EQ(Wire.regs[20],before ^ 0xffu);
+  CHECK_EQ(num_started,2);
+  CHECK_EQ(si5351.queue_count,1);
+  finish();
+  CHECK_EQ(num_callbacks,2);
+}
+
+static void test_error(void)
+{
+  // a transfer that fails is reported with its status and the queue
+  // carries on with the next
+  reset();
+  const uint8_t before = Wire.regs[20];
+  si5351.si5351_write(20,before ^ 0xffu);
+  si5351.si5351_write(40,0x22);
+  fail_status = 4;
+  finish();
+  CHECK_EQ(num_callbacks,2);
+  CHECK_EQ(callback_reg[0],20);
+  CHECK_EQ(callback_status[0],4);
+  CHECK_EQ(callback_reg[1],40);
+  CHECK_EQ(callback_status[1],0);
+  CHECK_EQ(Wire.regs[20],before);
+  CHECK_EQ(Wire.regs[40],0x22);
+  // the shadow still has what was asked for
+  CHECK_EQ(si5351.si5351_read(20),before ^ 0xffu);
+}
+
+static void test_flush_before_read(void)
+{
+  // a bus read waits for everything queued to land first
+  reset();
+  busy_polls = 5;
+  si5351.si5351_write(20,0x11);
+  si5351.si5351_write(40,0x22);
+  si5351.si5351_write(60,0x33);
+  CHECK(si5351.busy());
+  CHECK_EQ(si5351.si5351_read_bus(60),0x33);
+  CHECK(!si5351.busy());
+  CHECK_EQ(num_done,3);
+  CHECK_EQ(Wire.transmissions,1);
+  CHECK_EQ(Wire.requests,1);
+  // and the status register, which never comes from the shadow
+  si5351.si5351_write(80,0x44);
+  Wire.regs[SI5351_DEVICE_STATUS] = 0x10;
+  CHECK_EQ(si5351.si5351_read(SI5351_DEVICE_STATUS),0x10);
+  CHECK(!si5351.busy());
+  CHECK_EQ(Wire.regs[80],0x44);
+  // going back to Wire flushes too
+  si5351.si5351_write(90,0x55);
+  si5351.set_transport(NULL,NULL);
+  CHECK_EQ(Wire.regs[90],0x55);
+  CHECK(!active);
+}
+
+static void test_tuning(void)
+{
+  // as the radio: the device ends up the same as the shadow
+  reset();
+  busy_polls = 3;
+  si5351.drive_strength(SI5351_CLK0,SI5351_DRIVE_8MA);
+  si5351.drive_strength(SI5351_CLK1,SI5351_DRIVE_8MA);
+  for (uint32_t i=0;i<100;i++)
+  {
+    si5351.set_freq_quadrature((7100000ull + i * 10ull)*SI5351_FREQ_MULT,88,SI5351_CLK0,SI5351_CLK1);
+    si5351.poll();
+  }
+  finish();
+  CHECK(memcmp(si5351.shadow,Wire.regs,SI5351_SHADOW_SIZE)==0);
+  CHECK_EQ(Wire.transmissions + Wire.requests,0);
+  printf("100 tuning steps: %u transfers\n",num_started);
+}
+
+int main(void)
+{
+  test_queue();
+  test_queue_full();
+  test_coalesce();
+  test_busy();
+  test_error();
+  test_flush_before_read();
+  test_tuning();
+  return check_result("si5351_transport_test");
+}
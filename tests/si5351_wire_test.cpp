@@ -0,0 +1,115 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Si5351 bus traffic through the mock Wire: the register shadow is
+// loaded in SI5351_READ_CHUNK bursts, a bulk write is one transaction,
+// reads come from the shadow and the shadow always matches the device.
+
+#include "check.h"
+#include "Arduino.h"
+#include "Wire.h"
+#define private public
+#include "si5351.h"
+#undef private
+
+static Si5351 si5351;
+
+static void test_shadow_load(void)
+{
+  // the device's registers end up in the shadow, one write of the
+  // start address and one read per chunk
+  for (uint32_t i=0;i<256;i++)
+  {
+    Wire.regs[i] = (uint8_t)(i * 7u + 3u);
+  }
+  Wire.regs[SI5351_DEVICE_STATUS] = 0;
+  Wire.clear_counts();
+  si5351.shadow_load();
+  const uint32_t chunks = (SI5351_SHADOW_SIZE + SI5351_READ_CHUNK - 1) / SI5351_READ_CHUNK;
+  CHECK_EQ(Wire.transmissions,chunks);
+  CHECK_EQ(Wire.requests,chunks);
+  CHECK_EQ(Wire.bytes_written,chunks);
+  CHECK_EQ(Wire.bytes_read,SI5351_SHADOW_SIZE);
+  CHECK(si5351.shadow_valid);
+  CHECK(memcmp(si5351.shadow,Wire.regs,SI5351_SHADOW_SIZE)==0);
+}
+
+static void test_write_bulk(void)
+{
+  // one transaction, the address then the data
+  uint8_t data[SI5351_PARAMETERS_LENGTH];
+  for (uint32_t i=0;i<SI5351_PARAMETERS_LENGTH;i++)
+  {
+    data[i] = (uint8_t)(0xa0u + i);
+  }
+  Wire.clear_counts();
+  si5351.si5351_write_bulk(SI5351_PLLA_PARAMETERS,SI5351_PARAMETERS_LENGTH,data);
+  CHECK_EQ(Wire.transmissions,1);
+  CHECK_EQ(Wire.requests,0);
+  CHECK_EQ(Wire.bytes_written,SI5351_PARAMETERS_LENGTH + 1);
+  CHECK(memcmp(Wire.regs + SI5351_PLLA_PARAMETERS,data,SI5351_PARAMETERS_LENGTH)==0);
+  CHECK(memcmp(si5351.shadow + SI5351_PLLA_PARAMETERS,data,SI5351_PARAMETERS_LENGTH)==0);
+}
+
+static void test_read_from_shadow(void)
+{
+  // configuration registers never touch the bus, status does
+  Wire.clear_counts();
+  for (uint8_t addr=SI5351_INTERRUPT_STATUS+1;addr<SI5351_SHADOW_SIZE;addr++)
+  {
+    CHECK_EQ(si5351.si5351_read(addr),si5351.shadow[addr]);
+  }
+  CHECK_EQ(Wire.transmissions,0);
+  CHECK_EQ(Wire.requests,0);
+  si5351.si5351_read(SI5351_DEVICE_STATUS);
+  CHECK_EQ(Wire.transmissions,1);
+  CHECK_EQ(Wire.requests,1);
+}
+
+static void test_tuning(void)
+{
+  // as the radio: set up the quadrature pair then tune in 10Hz steps,
+  // nothing is read back and the device always matches the shadow
+  memset(Wire.regs,0,sizeof(Wire.regs));
+  CHECK(si5351.init(SI5351_CRYSTAL_LOAD_0PF,27000000ul,0));
+  si5351.drive_strength(SI5351_CLK0,SI5351_DRIVE_8MA);
+  si5351.drive_strength(SI5351_CLK1,SI5351_DRIVE_8MA);
+  si5351.set_freq_quadrature(7100000ull*SI5351_FREQ_MULT,88,SI5351_CLK0,SI5351_CLK1);
+  CHECK(memcmp(si5351.shadow,Wire.regs,SI5351_SHADOW_SIZE)==0);
+  Wire.clear_counts();
+  const uint32_t steps = 100;
+  for (uint32_t i=1;i<=steps;i++)
+  {
+    si5351.set_freq_quadrature((7100000ull + i * 10ull)*SI5351_FREQ_MULT,88,SI5351_CLK0,SI5351_CLK1);
+  }
+  CHECK_EQ(Wire.requests,0);
+  CHECK(Wire.transmissions>=steps);
+  CHECK(Wire.transmissions<=2u * steps);
+  CHECK(memcmp(si5351.shadow,Wire.regs,SI5351_SHADOW_SIZE)==0);
+  printf("%u tuning steps: %u transactions, %u bytes\n",steps,Wire.transmissions,Wire.bytes_written);
+}
+
+int main(void)
+{
+  test_shadow_load();
+  test_write_bulk();
+  test_read_from_shadow();
+  test_tuning();
+  return check_result("si5351_wire_test");
+}
@@ -0,0 +1,117 @@
+/*
+ * uP40 - 40M Phasing Transceiver
+ *
+ * Copyright (C) 2025 Ian Mitchell VK7IAN
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// TCXO calibration on a simulated carrier. The TCXO is off by a known
+// number of ppb, so the LO is off and the beat note moves. The I/Q is
+// that beat note on either side of zero (the I/Q wiring), with ADC
+// offsets, some I/Q imbalance and noise. The measured offset is turned
+// into ppb as calibrate_tcxo() in uP40.ino does and has to come back
+// to the TCXO error.
+
+#include <random>
+#include "check.h"
+#include "Arduino.h"
+#include "tcxocal.h"
+
+#define CW_SIDETONE 700ul
+#define CARRIER     7030000ul
+
+static std::mt19937 noise_generator(1);
+static std::normal_distribution<float> noise(0.0f,1.0f);
+
+static bool measure(const double beat,const int side,const float snr_db,float &offset)
+{
+  // beat note in Hz, side +1 or -1 for which side of zero it lands,
+  // SNR in 500Hz
+  const float amplitude = 200.0f;
+  const float sigma = amplitude / sqrtf(2.0f) * powf(10.0f,-snr_db / 20.0f) * sqrtf((float)SAMPLERATE / 500.0f);
+  const double w = 2.0 * M_PI * beat / (double)SAMPLERATE * side;
+  double phase = 0.3;
+  TCXOCAL::start(CW_SIDETONE);
+  while (TCXOCAL::busy())
+  {
+    const float i = amplitude * (float)cos(phase) + sigma * noise(noise_generator) + 37.0f;
+    const float q = 0.97f * amplitude * (float)sin(phase + 0.02) + sigma * noise(noise_generator) - 21.0f;
+    phase = fmod(phase + w,2.0 * M_PI);
+    TCXOCAL::process(i,q);
+  }
+  return TCXOCAL::result(offset);
+}
+
+static int32_t to_ppb(const bool cwl,const float offset)
+{
+  // as calibrate_tcxo(), from a correction of zero
+  const float lo = (float)(cwl?CARRIER+CW_SIDETONE:CARRIER-CW_SIDETONE);
+  const float error = (cwl?offset:-offset) / lo;
+  return (int32_t)lroundf(error * 1.0e9f);
+}
+
+static void test_recovers_ppb(const float snr_db,const int32_t tolerance)
+{
+  const int32_t errors[] = {-2500,-300,-17,0,40,850,2500};
+  int32_t worst = 0;
+  for (uint32_t mode=0;mode<2;mode++)
+  {
+    const bool cwl = mode==0;
+    for (int side=-1;side<=1;side+=2)
+    {
+      for (const int32_t ppb : errors)
+      {
+        // the LO is above the carrier in CWL and below it in CWU, a
+        // fast TCXO moves it up by ppb of its frequency
+        const double lo = cwl?CARRIER+CW_SIDETONE:CARRIER-CW_SIDETONE;
+        const double lo_actual = lo * (1.0 + ppb * 1.0e-9);
+        const double beat = fabs(lo_actual - (double)CARRIER);
+        float offset = 0.0f;
+        const bool ok = measure(beat,side,snr_db,offset);
+        CHECK(ok);
+        const int32_t got = to_ppb(cwl,offset);
+        if (abs(got - ppb)>tolerance)
+        {
+          printf("  %s side %+d %ddB: %d ppb came back as %d\n",cwl?"CWL":"CWU",side,(int)snr_db,ppb,got);
+        }
+        CHECK(abs(got - ppb)<=tolerance);
+        worst = max(worst,abs(got - ppb));
+      }
+    }
+  }
+  printf("SNR %2.0fdB in 500Hz: worst error %d ppb\n",snr_db,worst);
+}
+
+static void test_no_carrier(void)
+{
+  // noise alone is not a carrier
+  TCXOCAL::start(CW_SIDETONE);
+  while (TCXOCAL::busy())
+  {
+    TCXOCAL::process(100.0f * noise(noise_generator),100.0f * noise(noise_generator));
+  }
+  float offset = 0.0f;
+  CHECK(!TCXOCAL::result(offset));
+}
+
+int main(void)
+{
+  // 1ppb is 7mHz, at 0dB the spread is about 0.5Hz rms
+  test_recovers_ppb(30.0f,1);
+  test_recovers_ppb(10.0f,30);
+  test_recovers_ppb(0.0f,300);
+  test_no_carrier();
+  return check_result("tcxocal_test");
+}
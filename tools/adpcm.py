@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+# uP40 - 40M Phasing Transceiver
+#
+# Copyright (C) 2025 Ian Mitchell VK7IAN
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+IMA ADPCM codec for the voice prompts (src/adpcm.h).
+
+The prompts are 8 bit mono 31250Hz WAV files. They are low pass
+filtered and decimated by 4 to 7812.5Hz (speech needs no more) then
+encoded into 4 bit IMA ADPCM blocks:
+
+  block = predictor (int16), step index (uint8), 0, 128 bytes of
+          nibbles (256 samples, low nibble first)
+
+The radio interpolates back up to 31250Hz with a 48 tap polyphase low
+pass (12 taps per output sample). decode() and upsample() below are
+the same integer arithmetic as ADPCM::decode() so the output here is
+bit exact with the radio.
+
+Used by tools/promptpack.py. On its own it round trips one WAV file
+so a recording can be checked by ear before it is packed:
+
+  python3 tools/adpcm.py new.wav check.wav
+"""
+
+import argparse
+import math
+import sys
+import wave
+
+RATE = 31250
+UPSAMPLE = 4
+BLOCK_SAMPLES = 256
+BLOCK_BYTES = 4 + BLOCK_SAMPLES // 2
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+
+# 48 tap low pass, 3300Hz at 31250Hz (-6dB), images below -33dB
+# [phase][tap], Q15, same as ADPCM::interpolator
+INTERPOLATOR = [
+    [0, 22, -279, 1263, -3520, 7960, 27134, 1239, -1705, 881, -252, 27],
+    [2, -30, -101, 1073, -4315, 15881, 22957, -2947, 44, 324, -136, 13],
+    [13, -136, 324, 44, -2947, 22957, 15881, -4315, 1073, -101, -30, 2],
+    [27, -252, 881, -1705, 1239, 27134, 7960, -3520, 1263, -279, 22, 0]]
+TAPS = len(INTERPOLATOR[0])
+
+def read_wav(path):
+    with wave.open(path, 'rb') as w:
+        if w.getnchannels() != 1 or w.getsampwidth() != 1 or w.getframerate() != RATE:
+            sys.exit('adpcm: %s must be 8 bit mono %dHz' % (path, RATE))
+        pcm = w.readframes(w.getnframes())
+    # 8 bit unsigned to 16 bit signed
+    return [(b - 128) << 8 for b in pcm]
+
+
+def decimate(samples):
+    # the interpolator's low pass (in time order) then every 4th sample
+    h = [INTERPOLATOR[n % UPSAMPLE][n // UPSAMPLE] / 32768.0 / UPSAMPLE for n in range(TAPS * UPSAMPLE)]
+    delay = len(h) // 2
+    padded = [0] * delay + samples + [0] * delay
+    out = []
+    for m in range(0, len(samples), UPSAMPLE):
+        acc = sum(h[k] * padded[m + len(h) - 1 - k] for k in range(len(h)))
+        out.append(clamp(int(round(acc)), -32768, 32767))
+    return out
+
+
+def write_wav(path, samples):
+    with wave.open(path, 'wb') as w:
+        w.setnchannels(1)
+        w.setsampwidth(2)
+        w.setframerate(RATE)
+        w.writeframes(b''.join(int(s).to_bytes(2, 'little', signed=True) for s in samples))
+
+
+def clamp(v, lo, hi):
+    return max(lo, min(hi, v))
+
+
+def step_delta(step, nibble):
+    delta = step >> 3
+    if nibble & 4:
+        delta += step
+    if nibble & 2:
+        delta += step >> 1
+    if nibble & 1:
+        delta += step >> 2
+    return -delta if nibble & 8 else delta
+
+
+def encode(samples):
+    # returns (data, decoded samples)
+    data = bytearray()
+    decoded = []
+    predictor = 0
+    index = 0
+    for start in range(0, len(samples), BLOCK_SAMPLES):
+        block = samples[start:start + BLOCK_SAMPLES]
+        block += [0] * (BLOCK_SAMPLES - len(block))
+        if start == 0:
+            predictor = block[0]
+        data += (predictor & 0xffff).to_bytes(2, 'little') + bytes([index, 0])
+        nibbles = []
+        for s in block:
+            step = STEP_TABLE[index]
+            diff = s - predictor
+            nibble = 8 if diff < 0 else 0
+            diff = abs(diff)
+            if diff >= step:
+                nibble |= 4
+                diff -= step
+            if diff >= step >> 1:
+                nibble |= 2
+                diff -= step >> 1
+            if diff >= step >> 2:
+                nibble |= 1
+            predictor = clamp(predictor + step_delta(step, nibble), -32768, 32767)
+            index = clamp(index + INDEX_TABLE[nibble], 0, 88)
+            nibbles.append(nibble)
+            decoded.append(predictor)
+        data += bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, BLOCK_SAMPLES, 2))
+    return bytes(data), decoded[:len(samples)]
+
+
+def decode(data, count):
+    # same as ADPCM::decode()
+    out = []
+    p = 0
+    predictor = 0
+    index = 0
+    for n in range(count):
+        k = n % BLOCK_SAMPLES
+        if k == 0:
+            predictor = int.from_bytes(data[p:p + 2], 'little', signed=True)
+            index = min(data[p + 2], 88)
+            p += 4
+        nibble = (data[p] >> 4) if (k & 1) else (data[p] & 0x0f)
+        if k & 1:
+            p += 1
+        predictor = clamp(predictor + step_delta(STEP_TABLE[index], nibble), -32768, 32767)
+        index = clamp(index + INDEX_TABLE[nibble], 0, 88)
+        out.append(predictor)
+    return out
+
+
+def upsample(samples):
+    # same as the interpolator in ADPCM::decode()
+    history = [0] * TAPS
+    out = []
+    for s in samples:
+        history = [s] + history[:-1]
+        for phase in range(UPSAMPLE):
+            acc = sum(c * x for c, x in zip(INTERPOLATOR[phase], history))
+            out.append(clamp(acc >> 15, -32768, 32767))
+    return out
+
+
+def snr(reference, decoded):
+    signal = sum(s * s for s in reference)
+    noise = sum((a - b) * (a - b) for a, b in zip(reference, decoded))
+    if noise == 0:
+        return float('inf')
+    return 10.0 * math.log10(max(signal, 1) / noise)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('wav', help='8 bit mono %dHz WAV' % RATE)
+    parser.add_argument('out', help='16 bit WAV, as the radio will play it')
+    args = parser.parse_args()
+    samples = decimate(read_wav(args.wav))
+    data, reference = encode(samples)
+    decoded = decode(data, len(samples))
+    assert decoded == reference
+    write_wav(args.out, upsample(decoded))
+    print('%d samples, %d bytes, SNR %.1fdB' % (len(samples), len(data), snr(samples, decoded)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# uP40 - 40M Phasing Transceiver
+#
+# Copyright (C) 2025 Ian Mitchell VK7IAN
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Pack the voice prompts into src/promptdata.h.
+
+prompts/prompts.txt lists the clips, one name per line, in clip ID
+order. Each name is a WAV file in prompts/ (8 bit mono 31250Hz). Every
+clip is:
+
+  - trimmed of leading and trailing silence (keeping a short margin)
+  - normalised to the same peak level
+  - decimated and ADPCM encoded (tools/adpcm.py)
+  - placed in one blob, starting on a 32 byte boundary
+
+The header has the clip ID enum (CLIP_<NAME>), the blob and an index
+of offset/size/samples which PROMPT checks at compile time. To add a
+word, drop the WAV in prompts/, add its name to prompts.txt and run
+
+  python3 tools/promptpack.py build
+  python3 tools/promptpack.py verify     header up to date, bit exact
+  python3 tools/promptpack.py play NAME x.wav
+"""
+
+import argparse
+import os
+import re
+import sys
+
+import adpcm
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+ALIGN = 32
+THRESHOLD = 4 << 8      # silence, 4 steps of the 8 bit source
+MARGIN = 625            # 20ms kept either side of the sound
+PEAK = 16384            # normalised peak, half scale
+
+
+def read_manifest(prompts):
+    names = []
+    with open(os.path.join(prompts, 'prompts.txt')) as f:
+        for line in f:
+            name = line.split('#')[0].strip()
+            if not name:
+                continue
+            if not re.match(r'^[a-z][a-z0-9_]*$', name):
+                sys.exit('promptpack: bad clip name %r' % name)
+            if name in names:
+                sys.exit('promptpack: %s listed twice' % name)
+            names.append(name)
+    return names
+
+
+def trim(samples):
+    loud = [n for n, s in enumerate(samples) if abs(s) >= THRESHOLD]
+    if not loud:
+        return samples[:1]
+    return samples[max(loud[0] - MARGIN, 0):min(loud[-1] + MARGIN + 1, len(samples))]
+
+
+def normalise(samples):
+    peak = max(abs(s) for s in samples)
+    if peak == 0:
+        return samples
+    return [adpcm.clamp(int(round(s * PEAK / peak)), -32768, 32767) for s in samples]
+
+
+def prepare(prompts, name):
+    # source clip as it should sound at 7812.5Hz
+    pcm = adpcm.read_wav(os.path.join(prompts, name + '.wav'))
+    return len(pcm), adpcm.decimate(normalise(trim(pcm)))
+
+
+def pack(prompts):
+    blob = bytearray()
+    clips = []
+    for name in read_manifest(prompts):
+        source_length, samples = prepare(prompts, name)
+        data, reference = adpcm.encode(samples)
+        blob += bytes(-len(blob) % ALIGN)
+        clips.append({
+            'name': name, 'offset': len(blob), 'bytes': len(data), 'samples': len(samples),
+            'source': source_length, 'reference': reference, 'pcm': samples})
+        blob += data
+    return bytes(blob), clips
+
+
+def build(args):
+    blob, clips = pack(args.prompts)
+    path = os.path.join(args.src, 'promptdata.h')
+    with open(path, 'w') as out:
+        out.write('// generated by tools/promptpack.py from prompts/, do not edit\n')
+        out.write('// IMA ADPCM, %gHz, %d samples per block\n\n' % (adpcm.RATE / adpcm.UPSAMPLE, adpcm.BLOCK_SAMPLES))
+        out.write('#ifndef PROMPTDATA_H\n#define PROMPTDATA_H\n\n')
+        out.write('#define PROMPT_ALIGN     %du\n' % ALIGN)
+        out.write('#define PROMPT_BLOB_SIZE %du\n\n' % len(blob))
+        out.write('enum clip_id_t\n{\n')
+        for c in clips:
+            out.write('  CLIP_%s,\n' % c['name'].upper())
+        out.write('  NUM_CLIPS\n};\n\n')
+        out.write('static const uint8_t __attribute__((aligned(PROMPT_ALIGN))) blob[PROMPT_BLOB_SIZE] =\n{\n')
+        starts = {c['offset']: c['name'] for c in clips}
+        for i in range(0, len(blob), 16):
+            if i in starts:
+                out.write('  // %s\n' % starts[i])
+            row = ', '.join('0x%02X' % b for b in blob[i:i + 16])
+            out.write('  %s%s\n' % (row, ',' if i + 16 < len(blob) else ''))
+        out.write('};\n\n')
+        out.write('static constexpr struct\n{\n  uint32_t offset;\n  uint32_t bytes;\n  uint32_t samples;\n}\n')
+        out.write('clip_index[NUM_CLIPS] =\n{\n')
+        for n, c in enumerate(clips):
+            out.write('  {%dul,%dul,%dul}%s // %s\n' % (
+                c['offset'], c['bytes'], c['samples'], ',' if n < len(clips) - 1 else ' ', c['name']))
+        out.write('};\n\n#endif\n')
+    source = sum(c['source'] for c in clips)
+    print('promptdata.h: %d clips, %d bytes (%d bytes of 8 bit source)' % (len(clips), len(blob), source), file=sys.stderr)
+
+
+def read_header(path):
+    text = open(path).read()
+    m = re.search(r'blob\[PROMPT_BLOB_SIZE\] =\s*\{(.*?)\};', text, re.S)
+    blob = bytes(int(x, 16) for x in re.findall(r'0x([0-9A-F]{2})', m.group(1))) if m else b''
+    index = {}
+    for m in re.finditer(r'\{(\d+)ul,(\d+)ul,(\d+)ul\}.? // (\w+)', text):
+        index[m.group(4)] = tuple(int(m.group(i)) for i in (1, 2, 3))
+    return blob, index
+
+
+def verify(args):
+    blob, clips = pack(args.prompts)
+    header_blob, index = read_header(os.path.join(args.src, 'promptdata.h'))
+    ok = header_blob == blob
+    if not ok:
+        print('promptdata.h out of date, run promptpack.py build')
+    for c in clips:
+        if index.get(c['name']) != (c['offset'], c['bytes'], c['samples']):
+            print('%-10s index out of date' % c['name'])
+            ok = False
+            continue
+        decoded = adpcm.decode(header_blob[c['offset']:c['offset'] + c['bytes']], c['samples'])
+        exact = decoded == c['reference']
+        ok = ok and exact
+        print('%-10s %6d bytes %6d samples  %s  SNR %.1fdB' % (
+            c['name'], c['bytes'], c['samples'], 'bit exact' if exact else 'MISMATCH', adpcm.snr(c['pcm'], decoded)))
+    sys.exit(0 if ok else 1)
+
+
+def play(args):
+    blob, index = read_header(os.path.join(args.src, 'promptdata.h'))
+    if args.name not in index:
+        sys.exit('promptpack: no clip %s' % args.name)
+    offset, size, samples = index[args.name]
+    adpcm.write_wav(args.wav, adpcm.upsample(adpcm.decode(blob[offset:offset + size], samples)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--prompts', default=os.path.join(ROOT, 'prompts'), help='WAV directory')
+    parser.add_argument('--src', default=os.path.join(ROOT, 'src'), help='sketch directory')
+    sub = parser.add_subparsers(dest='command', required=True)
+    sub.add_parser('build', help='pack the WAV files into promptdata.h').set_defaults(func=build)
+    sub.add_parser('verify', help='check promptdata.h is up to date and bit exact').set_defaults(func=verify)
+    p = sub.add_parser('play', help='decode one clip to a 16 bit 31250Hz WAV')
+    p.add_argument('name')
+    p.add_argument('wav')
+    p.set_defaults(func=play)
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
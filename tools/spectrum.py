@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+#
+# uP40 - 40M Phasing Transceiver
+#
+# Copyright (C) 2025 Ian Mitchell VK7IAN
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Decode and view the spectrum frames from the radio (src/spectrum.h).
+
+The frames come out of GP12 (PIO UART, 230400 8N1). SOURCE is the
+serial device the USB-serial adapter shows up as, a file captured from
+it, or - for stdin. Each frame is one line of a text waterfall, or one
+CSV line of bin levels in dB with --csv.
+
+  python3 tools/spectrum.py /dev/ttyUSB0
+  python3 tools/spectrum.py /dev/ttyUSB0 --flip --floor -20 --range 60
+  python3 tools/spectrum.py capture.bin --csv > spectrum.csv
+
+Which side of the LO is up depends on the I/Q wiring, --flip turns
+the bins round if signals move the wrong way when tuning. Frames with
+a bad CRC are dropped and counted, as are gaps in the sequence.
+"""
+
+import argparse
+import os
+import shutil
+import struct
+import sys
+
+SYNC = b'\xa5\x5a'
+HEADER = 14
+SHADES = ' .:-=+*#%@'
+
+
+def crc16(data):
+    # CRC-16/CCITT, as the radio
+    crc = 0xffff
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xffff
+    return crc
+
+
+class Decoder:
+    """Byte stream in, frames out, resynchronising on errors."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.frames = 0
+        self.bad_crc = 0
+        self.missed = 0
+        self.last_sequence = None
+
+    def feed(self, data):
+        self.buffer += data
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # keep a last byte that may be the start of a sync
+                del self.buffer[:max(0, len(self.buffer) - 1)]
+                return
+            del self.buffer[:start]
+            if len(self.buffer) < HEADER:
+                return
+            bits = self.buffer[3]
+            if bits < 8 or bits > 10:
+                del self.buffer[:1]
+                continue
+            length = HEADER + (1 << bits) + 2
+            if len(self.buffer) < length:
+                return
+            frame = bytes(self.buffer[:length])
+            if crc16(frame[2:length - 2]) != struct.unpack_from('<H', frame, length - 2)[0]:
+                self.bad_crc += 1
+                del self.buffer[:1]
+                continue
+            del self.buffer[:length]
+            yield self.decode(frame, bits)
+
+    def decode(self, frame, bits):
+        sequence, _, centre, rate, reference = struct.unpack_from('<BBIIh', frame, 2)
+        if self.last_sequence is not None:
+            self.missed += (sequence - self.last_sequence - 1) & 0xff
+        self.last_sequence = sequence
+        self.frames += 1
+        bins = frame[HEADER:HEADER + (1 << bits)]
+        return {
+            'sequence': sequence,
+            'centre': centre,
+            'rate': rate,
+            'levels': [(reference + b) / 2.0 for b in bins],
+        }
+
+
+def open_source(path, baud):
+    if path == '-':
+        return sys.stdin.buffer
+    f = open(path, 'rb', buffering=0)
+    if os.isatty(f.fileno()):
+        import termios
+        import tty
+        tty.setraw(f.fileno())
+        attrs = termios.tcgetattr(f.fileno())
+        speed = getattr(termios, 'B%d' % baud)
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(f.fileno(), termios.TCSANOW, attrs)
+    return f
+
+
+def squash(levels, width):
+    # the strongest of each group of bins, so narrow signals still show
+    if len(levels) <= width:
+        return levels
+    n = len(levels)
+    return [max(levels[i * n // width:(i + 1) * n // width]) for i in range(width)]
+
+
+def show_text(frame, args, width):
+    levels = squash(frame['levels'], width)
+    shades = len(SHADES) - 1
+    line = ''
+    for level in levels:
+        x = (level - args.floor) / args.range
+        line += SHADES[max(0, min(shades, int(x * shades)))]
+    span = frame['rate'] / 2
+    print('%9.3f %s %-9.3f' % ((frame['centre'] - span) / 1e3, line, (frame['centre'] + span) / 1e3), flush=True)
+
+
+def show_csv(frame, first, flip):
+    n = len(frame['levels'])
+    step = frame['rate'] / n
+    if first:
+        # bin n/2 is the LO, one bin over once flipped
+        offset = n // 2 - (1 if flip else 0)
+        print('sequence,' + ','.join('%.0f' % (frame['centre'] + (i - offset) * step) for i in range(n)))
+    print('%d,' % frame['sequence'] + ','.join('%.1f' % v for v in frame['levels']), flush=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('source', help='serial device, capture file or - for stdin')
+    parser.add_argument('--baud', type=int, default=230400, help='serial speed (default 230400)')
+    parser.add_argument('--flip', action='store_true', help='reverse the bins')
+    parser.add_argument('--csv', action='store_true', help='CSV of levels in dB, one line a frame')
+    parser.add_argument('--floor', type=float, default=-30.0, help='waterfall bottom, dB re one ADC count (default -30)')
+    parser.add_argument('--range', type=float, default=80.0, help='waterfall span, dB (default 80)')
+    args = parser.parse_args()
+
+    source = open_source(args.source, args.baud)
+    decoder = Decoder()
+    width = max(16, shutil.get_terminal_size().columns - 22)
+    first = True
+    try:
+        while True:
+            data = source.read(4096)
+            if not data:
+                break
+            for frame in decoder.feed(data):
+                if args.flip:
+                    frame['levels'].reverse()
+                if args.csv:
+                    show_csv(frame, first, args.flip)
+                else:
+                    show_text(frame, args, width)
+                first = False
+    except KeyboardInterrupt:
+        pass
+    print('spectrum: %d frames, %d bad CRC, %d missed' % (decoder.frames, decoder.bad_crc, decoder.missed), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+#
+# uP40 - 40M Phasing Transceiver
+#
+# Copyright (C) 2025 Ian Mitchell VK7IAN
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Fit the TX I/Q balance table (src/txcaldata.h) from measurements.
+
+Input is a CSV file, one line per measured frequency:
+
+  frequency_hz, gain, phase_degrees, dc_i, dc_q
+
+gain and phase are the Q channel correction that best nulled the
+opposite sideband, dc_i and dc_q (DAC steps, +/-512 full scale) the
+offsets that best nulled the carrier. Lines starting with # are ignored.
+
+Each column is fitted with a least squares polynomial (default order 2,
+lower if there are fewer points) and evaluated every 50kHz across the
+band so that a few noisy measurements give a smooth table.
+
+  python3 tools/txcal.py measurements.csv > src/txcaldata.h
+"""
+
+import argparse
+import csv
+import math
+import sys
+
+START = 7000000
+STOP = 7300000
+STEP = 50000
+SHIFT = 14
+
+
+def fit(xs, ys, order):
+    # least squares polynomial, normal equations (small order only)
+    order = min(order, len(xs) - 1)
+    n = order + 1
+    a = [[sum(x ** (i + j) for x in xs) for j in range(n)] for i in range(n)]
+    b = [sum(y * x ** i for x, y in zip(xs, ys)) for i in range(n)]
+    # gaussian elimination with partial pivoting
+    for c in range(n):
+        p = max(range(c, n), key=lambda r: abs(a[r][c]))
+        a[c], a[p] = a[p], a[c]
+        b[c], b[p] = b[p], b[c]
+        for r in range(c + 1, n):
+            f = a[r][c] / a[c][c]
+            for k in range(c, n):
+                a[r][k] -= f * a[c][k]
+            b[r] -= f * b[c]
+    coeff = [0.0] * n
+    for r in reversed(range(n)):
+        coeff[r] = (b[r] - sum(a[r][k] * coeff[k] for k in range(r + 1, n))) / a[r][r]
+    return lambda x: sum(c * x ** i for i, c in enumerate(coeff))
+
+
+def read_measurements(path):
+    rows = []
+    with open(path, newline='') as f:
+        for row in csv.reader(f):
+            if not row or row[0].strip().startswith('#'):
+                continue
+            rows.append([float(v) for v in row[:5]])
+    if not rows:
+        sys.exit('txcal: no measurements in %s' % path)
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('measurements', help='CSV: frequency_hz, gain, phase_degrees, dc_i, dc_q')
+    parser.add_argument('--order', type=int, default=2, help='polynomial order (default 2)')
+    args = parser.parse_args()
+
+    rows = read_measurements(args.measurements)
+    # fit against MHz offset from the band start to keep the numbers sane
+    xs = [(r[0] - START) / 1.0e6 for r in rows]
+    gain = fit(xs, [r[1] for r in rows], args.order)
+    phase = fit(xs, [r[2] for r in rows], args.order)
+    dc_i = fit(xs, [r[3] for r in rows], args.order)
+    dc_q = fit(xs, [r[4] for r in rows], args.order)
+
+    one = 1 << SHIFT
+    clamp = lambda v: max(-32768, min(32767, int(round(v))))
+    out = sys.stdout
+    out.write('// generated by tools/txcal.py, do not edit\n')
+    out.write('// from %s, %d measurements\n\n' % (args.measurements, len(rows)))
+    out.write('#ifndef TXCALDATA_H\n#define TXCALDATA_H\n\n')
+    out.write('#define TXCAL_START %dul\n' % START)
+    out.write('#define TXCAL_STEP  %dul\n\n' % STEP)
+    out.write('static const struct\n{\n  int16_t gain;\n  int16_t phase;\n  int16_t dc_i;\n  int16_t dc_q;\n}\ntable[] =\n{\n')
+    points = list(range(START, STOP + STEP, STEP))
+    for n, f in enumerate(points):
+        x = (f - START) / 1.0e6
+        entry = '{%d,%d,%d,%d}' % (
+            clamp(gain(x) * one),
+            clamp(math.sin(math.radians(phase(x))) * one),
+            clamp(dc_i(x)),
+            clamp(dc_q(x)))
+        sep = ',' if n < len(points) - 1 else ' '
+        out.write('  %s%s // %.3f\n' % (entry, sep, f / 1.0e6))
+    out.write('};\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()